@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+#include "codepoint.hpp"
+
+namespace auc {
+
+// Decodes the codepoints of borrowed UTF-8 bytes one character at a time,
+// without copying them
+class codepoint_iterator {
+ public:
+  // Only a forward iterator to the standard ranges, as a C++17 forward
+  // iterator has to dereference to a real reference
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::input_iterator_tag;
+  using value_type = codepoint;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = codepoint;
+
+  codepoint_iterator() = default;
+
+  explicit codepoint_iterator(std::string_view bytes) : bytes_(bytes) {}
+
+  codepoint operator*() const;
+
+  codepoint_iterator& operator++();
+
+  codepoint_iterator operator++(int) {
+    codepoint_iterator itr = *this;
+    ++(*this);
+    return itr;
+  }
+
+  friend bool operator==(const codepoint_iterator& itr,
+                         std::default_sentinel_t) {
+    return itr.bytes_.empty();
+  }
+
+  friend bool operator==(const codepoint_iterator& itr1,
+                         const codepoint_iterator& itr2) {
+    return (itr1.bytes_.data() == itr2.bytes_.data() &&
+            itr1.bytes_.size() == itr2.bytes_.size());
+  }
+
+ private:
+  // The bytes which haven't been iterated over yet
+  std::string_view bytes_;
+};
+
+using codepoint_range =
+    std::ranges::subrange<codepoint_iterator, std::default_sentinel_t>;
+
+}  // namespace auc
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "validation.hpp"
+
+namespace auc {
+
+// U+FFFD, what ill-formed sequences decode to
+inline constexpr std::uint32_t replacement_character = 0xFFFDu;
+
+enum class decode_status : int {
+  Ok = 0,
+  // The sequence is ill-formed
+  Invalid = 1,
+  // The sequence is well-formed so far, but was cut short by the end of
+  // the input
+  Truncated = 2
+};
+
+struct decode_result {
+  std::uint32_t codepoint_{replacement_character};
+  decode_status status_{decode_status::Invalid};
+};
+
+// Decodes the character starting at p (which must be before end) and
+// advances p past it. Ill-formed and truncated sequences decode to U+FFFD,
+// and p is only advanced past their maximal subpart so decoding can resume
+// at the next byte that could start a character.
+decode_result decode_next(const char*& p, const char* end);
+
+namespace detail {
+
+std::size_t count_codepoints(simd_level level, std::string_view bytes);
+
+std::size_t decode_utf8_to_utf32(simd_level level,
+                                 std::string_view bytes,
+                                 std::span<char32_t> out);
+
+}  // namespace detail
+
+// The exact number of codepoints decode_utf8_to_utf32 writes for bytes,
+// i.e. how many times decode_next would have to be called to reach the end.
+// Well-formed input is counted with SSE4.2 or AVX2 when the CPU supports
+// it, as the population count of the bytes that aren't continuation bytes.
+std::size_t count_codepoints(std::string_view bytes);
+
+// Decodes all of bytes into out, which must have room for
+// count_codepoints(bytes) codepoints, and returns the number written.
+// Ill-formed sequences decode to U+FFFD just like with decode_next.
+// Well-formed input is decoded with SSE4.2 or AVX2 when the CPU supports
+// it, with ASCII expanded a block at a time and other characters of up to
+// 3 bytes decoded 4 at a time.
+std::size_t decode_utf8_to_utf32(std::string_view bytes,
+                                 std::span<char32_t> out);
+
+}  // namespace auc
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "codepoint.hpp"
+#include "validation.hpp"
+
+namespace auc {
+
+// The most bytes a single codepoint encodes to
+inline constexpr std::size_t max_encoded_size = 4u;
+
+// The largest codepoint UTF-8 can encode
+inline constexpr std::uint32_t max_codepoint = 0x10FFFFu;
+
+namespace detail {
+
+std::size_t encode(simd_level level,
+                   std::span<const codepoint> cps,
+                   std::span<char> out);
+
+}  // namespace detail
+
+// Encodes cp into out, which must have room for max_encoded_size bytes, and
+// returns the number of bytes written. Codepoints past U+10FFFF can't be
+// encoded and write nothing. Surrogates are still encoded as 3 bytes, even
+// though the result isn't well-formed UTF-8.
+std::size_t encode_into(std::uint32_t cp, char* out);
+
+// The exact number of bytes encode writes for cps
+std::size_t encoded_size(std::span<const codepoint> cps);
+std::size_t encoded_size(std::span<const char32_t> cps);
+
+// Encodes every codepoint in cps back to back into out, which must have room
+// for encoded_size(cps) bytes, and returns the number of bytes written. Like
+// encode_into, codepoints past U+10FFFF are skipped. ASCII and BMP runs are
+// encoded with SSE4.2 or AVX2 when the CPU supports it.
+std::size_t encode(std::span<const codepoint> cps, std::span<char> out);
+std::size_t encode(std::span<const char32_t> cps, std::span<char> out);
+
+}  // namespace auc
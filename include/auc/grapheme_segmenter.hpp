@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+#include "encode.hpp"
+#include "graphemecluster.hpp"
+
+namespace auc {
+
+// Segments UTF-8 text that arrives in chunks into grapheme clusters, without
+// ever holding on to more than a partial character. Chunks may split both
+// characters and grapheme clusters anywhere. Ill-formed sequences are
+// segmented as U+FFFD, the same way u8text decodes them.
+class grapheme_segmenter {
+ public:
+  // Called with the byte offset, counted from the start of the stream, at
+  // which each grapheme cluster ends
+  using boundary_callback = std::function<void(std::size_t)>;
+
+  explicit grapheme_segmenter(boundary_callback on_boundary);
+
+  // Reports every cluster that is known to have ended once chunk is taken
+  // in. The last cluster could still be extended by the next chunk.
+  void feed(std::string_view chunk);
+
+  // Ends the stream, reporting the end of the last cluster. The segmenter
+  // can then be fed a new stream.
+  void finish();
+
+ private:
+  void next_char(std::uint32_t cp, std::size_t num_bytes);
+
+  boundary_callback on_boundary_;
+  detail::grapheme_break_state state_;
+  // Offset of the next character in the stream
+  std::size_t offset_{0u};
+  // The leading bytes of a character split across chunks
+  std::array<char, max_encoded_size> partial_{};
+  std::size_t num_partial_{0u};
+};
+
+}  // namespace auc
@@ -1,22 +1,204 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string_view>
 #include <vector>
 
+#include "codepoint_iterator.hpp"
+#include "decode.hpp"
 #include "u8char.hpp"
 
 namespace auc {
 
-struct graphemecluster;
-
 namespace detail {
 
-std::vector<graphemecluster> build_grapheme_clusters(
-    const std::vector<u8char>& chars);
+// https://www.unicode.org/reports/tr29/#Grapheme_Cluster_Boundary_Rules
+// Segmentation as a state machine over the characters of a text, each of
+// which is looked at exactly once. Besides the previous character, GB11 and
+// GB12/GB13 only need to know whether it ends an emoji ZWJ sequence and how
+// many regional indicators it ends, so the state has a constant size however
+// long a cluster gets.
+class grapheme_break_state {
+ public:
+  // Moves past the character cp, returning whether there is a grapheme
+  // cluster boundary between it and the previous character. There is none
+  // before the first character.
+  bool advance(std::uint32_t cp);
+
+ private:
+  enum class emoji_state : std::uint8_t {
+    None,
+    ExtPict,     // \p{Extended_Pictographic} Extend*
+    ExtPictZwj,  // \p{Extended_Pictographic} Extend* ZWJ
+  };
+  static constexpr std::uint8_t no_class = 0xFFu;
+
+  std::uint8_t previous_class_{no_class};
+  emoji_state emoji_{emoji_state::None};
+  // Whether the previous character ends an odd length run of regional
+  // indicators
+  bool odd_ri_{false};
+};
+
+// Number of bytes taken up by the grapheme cluster at the front of bytes
+std::size_t grapheme_cluster_size(std::string_view bytes);
+
+// Start of the grapheme cluster ending at boundary, which must be a
+// boundary of text. Unlike previous_grapheme_boundary, this steps back
+// through a run of regional indicators a flag at a time instead of
+// counting the run over again at every step.
+std::size_t previous_cluster_start(std::string_view text,
+                                   std::size_t boundary);
 
 }  // namespace detail
 
+// https://www.unicode.org/reports/tr29/#Random_Access
+// The grapheme cluster boundaries of text nearest to a byte offset, found by
+// backing up to a character segmentation can restart from and segmenting
+// only from there. next_grapheme_boundary is the first boundary after
+// offset, or the end of text. previous_grapheme_boundary is the last one
+// before offset, or the start of text.
+std::size_t next_grapheme_boundary(std::string_view text, std::size_t offset);
+std::size_t previous_grapheme_boundary(std::string_view text,
+                                       std::size_t offset);
+
+// The number of grapheme clusters in text. ASCII runs, in which every
+// character bar an LF after a CR is a cluster of its own, are found with
+// SIMD and counted without being decoded or looked up.
+std::size_t count_graphemes(std::string_view text);
+
+// How much of a text truncate_graphemes keeps. Either limit (or both) can
+// be left unlimited.
+struct truncation_limits {
+  std::size_t max_bytes_{std::string_view::npos};
+  std::size_t max_clusters_{std::string_view::npos};
+};
+
+// The longest prefix of text made up of whole grapheme clusters that fits
+// within limits. Segmentation stops as soon as either limit is reached, and
+// never looks further than a character past max_bytes_.
+std::string_view truncate_graphemes(std::string_view text,
+                                    truncation_limits limits);
+
 struct graphemecluster {
   std::vector<u8char> chars_;
 };
 
+// A grapheme cluster of a text, referring to its bytes in the text rather
+// than owning a copy of them. The text must outlive the view.
+class graphemecluster_view {
+ public:
+  graphemecluster_view() = default;
+
+  explicit graphemecluster_view(std::string_view bytes) : bytes_(bytes) {}
+
+  std::string_view data() const { return bytes_; }
+
+  codepoint_range get_codepoints() const {
+    return codepoint_range{codepoint_iterator{bytes_}, std::default_sentinel};
+  }
+
+  std::size_t byte_size() const { return bytes_.size(); }
+
+  std::size_t codepoint_count() const { return count_codepoints(bytes_); }
+
+  // Views are equal when they refer to the same bytes of the same text
+  friend bool operator==(const graphemecluster_view& view1,
+                         const graphemecluster_view& view2) {
+    return (view1.bytes_.data() == view2.bytes_.data() &&
+            view1.bytes_.size() == view2.bytes_.size());
+  }
+
+ private:
+  std::string_view bytes_;
+};
+
+// Segments borrowed UTF-8 bytes into grapheme clusters as it is advanced,
+// yielding a view of each cluster without copying it. Going backwards only
+// looks back as far as previous_grapheme_boundary has to, and over a run of
+// regional indicators only as far as the flag before.
+class graphemecluster_iterator {
+ public:
+  // Clusters are yielded by value, so to older algorithms, which expect
+  // references to them, this is just an input iterator
+  using iterator_concept = std::bidirectional_iterator_tag;
+  using iterator_category = std::input_iterator_tag;
+  using value_type = graphemecluster_view;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = graphemecluster_view;
+
+  graphemecluster_iterator() = default;
+
+  // An iterator to the cluster starting at the boundary offset of bytes
+  explicit graphemecluster_iterator(std::string_view bytes,
+                                    std::size_t offset = 0u)
+      : bytes_(bytes),
+        offset_(offset),
+        cluster_size_(detail::grapheme_cluster_size(bytes.substr(offset))) {}
+
+  graphemecluster_view operator*() const {
+    return graphemecluster_view{bytes_.substr(offset_, cluster_size_)};
+  }
+
+  graphemecluster_iterator& operator++() {
+    offset_ += cluster_size_;
+    cluster_size_ = detail::grapheme_cluster_size(bytes_.substr(offset_));
+    return *this;
+  }
+
+  graphemecluster_iterator operator++(int) {
+    graphemecluster_iterator itr = *this;
+    ++(*this);
+    return itr;
+  }
+
+  graphemecluster_iterator& operator--() {
+    const std::size_t end = offset_;
+    offset_ = detail::previous_cluster_start(bytes_, end);
+    cluster_size_ = end - offset_;
+    return *this;
+  }
+
+  graphemecluster_iterator operator--(int) {
+    graphemecluster_iterator itr = *this;
+    --(*this);
+    return itr;
+  }
+
+  friend bool operator==(const graphemecluster_iterator& itr,
+                         std::default_sentinel_t) {
+    return itr.offset_ == itr.bytes_.size();
+  }
+
+  friend bool operator==(const graphemecluster_iterator& itr1,
+                         const graphemecluster_iterator& itr2) {
+    return (itr1.bytes_.data() + itr1.offset_ ==
+                itr2.bytes_.data() + itr2.offset_ &&
+            itr1.bytes_.size() - itr1.offset_ ==
+                itr2.bytes_.size() - itr2.offset_);
+  }
+
+ private:
+  // The bytes being iterated over, the current cluster being the
+  // cluster_size_ of them starting at offset_
+  std::string_view bytes_;
+  std::size_t offset_{0};
+  std::size_t cluster_size_{0};
+};
+
+// Can be iterated over in reverse, e.g. with std::views::reverse
+using graphemecluster_range =
+    std::ranges::subrange<graphemecluster_iterator, graphemecluster_iterator>;
+
+// The grapheme clusters of borrowed UTF-8 bytes
+inline graphemecluster_range make_graphemecluster_range(
+    std::string_view bytes) {
+  return graphemecluster_range{graphemecluster_iterator{bytes},
+                               graphemecluster_iterator{bytes, bytes.size()}};
+}
+
 }  // namespace auc
@@ -1,9 +1,8 @@
 #pragma once
 
+#include <bit>
 #include <cstdint>
-#include <unordered_map>
-#include <variant>
-#include <vector>
+#include <initializer_list>
 
 namespace auc {
 
@@ -32,23 +31,41 @@ class property {
     Ext_Pict = 19
   };
 
+  // One bit per type
+  using mask = std::uint32_t;
+
+  static constexpr mask mask_of(property::type prop_type) {
+    return mask{1u} << static_cast<int>(prop_type);
+  }
+  static constexpr mask mask_of(
+      std::initializer_list<property::type> prop_types) {
+    mask prop_mask = 0u;
+    for (const property::type prop_type : prop_types) {
+      prop_mask |= mask_of(prop_type);
+    }
+    return prop_mask;
+  }
+
   property(std::uint32_t cp);
 
-  bool has_property(property::type prop_type) const;
-  bool has_property(const std::vector<property::type>& prop_types) const;
+  bool has_property(property::type prop_type) const {
+    return has_any(mask_of(prop_type));
+  }
 
- private:
-  struct graphemebreak {
-    type prop_ = type::Other;
-  };
-  struct emoji {
-    std::vector<type> props_;
-  };
-  using property_t = std::variant<graphemebreak, emoji>;
+  // Whether any of the types in prop_mask apply
+  bool has_any(mask prop_mask) const { return (props_ & prop_mask) != 0u; }
 
-  property_t init_prop(std::uint32_t cp);
+  // The Grapheme_Cluster_Break value, Other through ZWJ
+  property::type grapheme_break() const {
+    constexpr mask grapheme_break_mask =
+        (mask_of(property::type::ZWJ) << 1u) - 1u;
+    return static_cast<property::type>(
+        std::countr_zero(props_ & grapheme_break_mask));
+  }
 
-  property_t prop_;
+ private:
+  // The Grapheme_Cluster_Break value and every emoji property that applies
+  mask props_{0u};
 };
 
 }  // namespace auc
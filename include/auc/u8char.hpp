@@ -1,8 +1,8 @@
 #pragma once
 
+#include <array>
 #include <string>
 #include <string_view>
-#include <vector>
 
 #include "codepoint.hpp"
 
@@ -22,9 +22,14 @@ bool is_sequence(const char c);
 
 std::size_t num_octets(const char c);
 
-std::uint32_t to_codepoint(const std::vector<char>& encoded_bytes);
+// Number of bytes taken up by the character at the front of bytes. For
+// ill-formed sequences (including ones truncated by the end of bytes) this
+// is the maximal subpart, so parsing always resumes at the next byte that
+// could start a character.
+std::size_t char_size(std::string_view bytes);
 
-std::vector<char> to_encoded_bytes(std::uint32_t codepoint);
+// Whether bytes is exactly one well-formed UTF-8 character
+bool is_valid_char(std::string_view bytes);
 
 }  // namespace detail
 
@@ -48,19 +53,26 @@ class u8char {
 
   const codepoint& get_codepoint() const { return codepoint_; }
 
-  std::size_t get_num_bytes() const { return encoded_storage_.size(); }
+  std::size_t get_num_bytes() const { return num_bytes_; }
 
   std::string data() const {
-    return std::string(encoded_storage_.data(), encoded_storage_.size());
+    return std::string(encoded_storage_.data(), num_bytes_);
   }
 
  private:
+  static constexpr std::size_t max_num_bytes = 4u;
+
   explicit u8char(codepoint cp,
-                  const std::vector<char>& encoded_bytes,
+                  std::string_view encoded_bytes,
                   const bool valid_encoding);
 
+  void append_byte(const char byte);
+
+  // A UTF-8 character is at most 4 octets, so the encoded bytes are stored
+  // inline to keep u8char trivially copyable and free of heap allocations
+  std::array<char, max_num_bytes> encoded_storage_{};
+  std::uint8_t num_bytes_{0};
   bool valid_encoding_{false};
-  std::vector<char> encoded_storage_;
   codepoint codepoint_{0};
 };
 
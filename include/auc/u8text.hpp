@@ -1,13 +1,57 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "graphemecluster.hpp"
 #include "u8char.hpp"
 
 namespace auc {
 
+namespace detail {
+
+// Number of bytes taken up by a leading byte order mark, never more than
+// length
+std::size_t parse_bom(const char* bytes, const std::size_t length);
+
+// A count that is only computed the first time it is asked for. Threads
+// racing to compute it all come up with the same count, so it doesn't
+// matter whose is kept.
+class memoized_count {
+ public:
+  memoized_count() = default;
+
+  memoized_count(const memoized_count& other)
+      : count_(other.count_.load(std::memory_order_relaxed)) {}
+
+  memoized_count& operator=(const memoized_count& other) {
+    count_.store(other.count_.load(std::memory_order_relaxed),
+                 std::memory_order_relaxed);
+    return *this;
+  }
+
+  template <class Compute>
+  std::size_t get(Compute compute) const {
+    std::size_t count = count_.load(std::memory_order_relaxed);
+    if (count == unknown) {
+      count = compute();
+      count_.store(count, std::memory_order_relaxed);
+    }
+    return count;
+  }
+
+ private:
+  static constexpr std::size_t unknown = static_cast<std::size_t>(-1);
+
+  mutable std::atomic<std::size_t> count_{unknown};
+};
+
+}  // namespace detail
+
 class u8text {
  public:
   explicit u8text(std::string_view bytes);
@@ -15,19 +59,43 @@ class u8text {
 
   static u8text from_codepoints(const std::vector<codepoint>& cps);
 
+  // Same as u8text(bytes), but large texts are split at character boundaries
+  // into chunks which are validated and indexed on up to num_threads threads
+  // (by default one per hardware thread)
+  static u8text parse_parallel(std::string_view bytes,
+                               unsigned int num_threads = 0u);
+
   bool is_valid() const;
 
   std::vector<codepoint> get_codepoints() const;
 
   // TODO: std::vector<u8char> get_codepoint_characters() const;
 
-  const std::vector<graphemecluster>& get_grapheme_clusters() const;
+  // Segments the text into grapheme clusters as it is iterated over, yielding
+  // views of them without copying or allocating anything
+  graphemecluster_range graphemes() const {
+    return make_graphemecluster_range(bytes_);
+  }
+
+  // Copies every grapheme cluster of the text out of it
+  std::vector<graphemecluster> get_grapheme_clusters() const;
+
+  std::string_view data() const { return bytes_; }
 
-  std::string data() const;
+  std::size_t byte_size() const { return bytes_.size(); }
+
+  // The number of characters parsing found, ill-formed sequences counting
+  // as a single U+FFFD each
+  std::size_t codepoint_count() const { return char_offsets_.size(); }
+
+  // Segments the text the first time it is called, later calls are O(1)
+  std::size_t grapheme_count() const {
+    return grapheme_count_.get([this] { return count_graphemes(bytes_); });
+  }
 
   // TODO: All implementation details for the util/helper methods
   //  (e.g. length, find/contains,sort) on the class will
-  //  be implemented via the list of u8char's
+  //  be implemented via the byte buffer and its character offsets
 
   // TODO: Depend on libfmt and add support for printing and formatting
   // auc::u8text.
@@ -35,16 +103,21 @@ class u8text {
   //  and printer if the user has the libfmt dependency
 
  private:
-  explicit u8text(const std::vector<u8char> chars);
+  u8text() = default;
+
+  void parse_chars();
 
-  void parse_chars(const char* bytes, const std::size_t length);
+  void parse_chars_parallel(unsigned int num_threads);
 
-  std::vector<u8char> chars_;
+  std::string_view char_bytes(std::size_t char_idx) const;
 
-  // TODO: Handle Grapheme Clusters, need this before we can implement utf8 text
-  // things like unicode equality or starts_with/ends_with/contains/sorting
-  // u8text methods
-  std::vector<graphemecluster> grapheme_clusters_;
+  // The UTF-8 encoded text (without any BOM), kept as a single contiguous
+  // buffer. Characters are recorded as the byte offset they start at, which
+  // limits a u8text to 4 GiB. Grapheme clusters are only segmented on demand.
+  std::string bytes_;
+  std::vector<std::uint32_t> char_offsets_;
+  detail::memoized_count grapheme_count_;
+  bool valid_{true};
 };
 
 }  // namespace auc
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string_view>
+
+#include "codepoint_iterator.hpp"
+#include "graphemecluster.hpp"
+
+namespace auc {
+
+// A non-owning counterpart to u8text. The borrowed bytes must outlive the
+// view, nothing is copied or decoded up front: validation, decoding and
+// segmentation all happen on demand while iterating over the bytes.
+class u8text_view {
+ public:
+  u8text_view() = default;
+
+  explicit u8text_view(std::string_view bytes);
+  explicit u8text_view(std::u8string_view bytes);
+
+  bool is_valid() const;
+
+  codepoint_range get_codepoints() const {
+    return codepoint_range{codepoint_iterator{bytes_}, std::default_sentinel};
+  }
+
+  graphemecluster_range get_grapheme_clusters() const {
+    return make_graphemecluster_range(bytes_);
+  }
+
+  std::string_view data() const { return bytes_; }
+
+ private:
+  std::string_view bytes_;
+};
+
+}  // namespace auc
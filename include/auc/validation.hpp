@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace auc {
+
+namespace detail {
+
+// Instruction sets validate_utf8 can dispatch to, from slowest to fastest
+enum class simd_level : int { Scalar = 0, SSE42 = 1, AVX2 = 2, AVX512 = 3 };
+
+// The fastest instruction set supported by both the build and the CPU
+simd_level detect_simd_level();
+
+bool validate_utf8(simd_level level, const char* bytes, std::size_t length);
+
+}  // namespace detail
+
+// https://www.rfc-editor.org/rfc/rfc3629#section-4
+// Whether bytes is a well-formed UTF-8 sequence. Overlong encodings,
+// surrogates, codepoints past U+10FFFF and truncated sequences are all
+// rejected.
+bool validate_utf8(const char* bytes, std::size_t length);
+
+// Validates UTF-8 that arrives in chunks, which may split characters
+// anywhere. Whole characters are validated a chunk at a time with
+// validate_utf8, only a character split across chunks is carried over to the
+// next one.
+class utf8_validator {
+ public:
+  // Takes in the next chunk, returning false once the stream is known to be
+  // ill-formed
+  bool update(std::string_view chunk);
+
+  // Ends the stream, returning whether all of it was well-formed. A stream
+  // ending in the middle of a character is not.
+  bool finish();
+
+  // The byte offset, counted from the start of the stream, of the first
+  // ill-formed sequence
+  std::optional<std::size_t> error_offset() const { return error_offset_; }
+
+ private:
+  // Bytes taken in so far
+  std::size_t offset_{0u};
+  // Where the character split across chunks starts, and the DFA state its
+  // bytes so far lead to
+  std::size_t partial_offset_{0u};
+  std::uint8_t partial_state_{0u};
+  std::optional<std::size_t> error_offset_;
+};
+
+}  // namespace auc
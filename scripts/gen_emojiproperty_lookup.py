@@ -1,57 +0,0 @@
-from ucd_parsing_utils import get_properties, PROP_CPP_CONV
-
-
-class EmojiProperty:
-    def __init__(self, codepoint, prop_type):
-        self.codepoint = codepoint
-        # Emoji's can have more than one property (e.g. both Emoji and Extended_Pictographic)
-        self.prop_types = [PROP_CPP_CONV[prop_type]]
-
-    def append(self, prop_type):
-        self.prop_types.append(PROP_CPP_CONV[prop_type])
-
-
-def get_cpp_unordermap_data(props):
-    start_header_data = \
-        '// NOTE: This file was autogenerated via ' \
-        'scripts/gen_emojiproperty_lookup.py\n' \
-        '#include <unordered_map>\n' \
-        '#include <vector>\n\n' \
-        '#include <auc/property.hpp>\n' \
-        '#include <cstdint>\n\n' \
-        '// https://www.unicode.org/' \
-        'Public/15.0.0/ucd/emoji/emoji-data.txt\n'\
-        'namespace auc {\n' \
-        'namespace detail {\n\n' \
-        'static std::unordered_map<std::uint32_t, std::vector<property::type>> ' \
-        'codepoint_emoji_lookup = {\n'
-
-    header_data = ''
-    num_props = len(props)
-    for prop_idx in range(num_props):
-        prop = props[prop_idx]
-        num_data = len(prop.prop_types)
-        props_data = ''
-        for data_idx in range(num_data):
-            props_data += prop.prop_types[data_idx]
-            if data_idx < num_data - 1:
-                props_data += ', '
-        header_data += \
-            f'  {{{prop.codepoint}u, {{{props_data}}}}}'
-        if prop_idx < num_props - 1:
-            header_data += ',\n'
-
-    end_header_data = \
-        '\n};\n\n' \
-        '} // namespace detail\n' \
-        '} // namespace auc\n'
-
-    return f'{start_header_data}{header_data}{end_header_data}'
-
-
-cpp_header = get_cpp_unordermap_data(
-    get_properties('emoji-data.txt', EmojiProperty)
-)
-with open('../src/emojiproperty_lookup.hpp', 'w') as gen_header_file:
-    gen_header_file.write(cpp_header)
-
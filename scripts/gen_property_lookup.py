@@ -0,0 +1,218 @@
+from ucd_parsing_utils import get_property_ranges, PROP_CPP_CONV
+
+MAX_CODEPOINT = 0x10FFFF
+EMOJI_PROPS = [
+    'Emoji',
+    'Emoji_Presentation',
+    'Emoji_Modifier',
+    'Emoji_Modifier_Base',
+    'Emoji_Component',
+    'Extended_Pictographic'
+]
+
+
+def get_entries(break_ranges, emoji_ranges):
+    # Every codepoint maps to an entry, i.e. its Grapheme_Cluster_Break value
+    # and emoji flags. There are only a handful of distinct entries, so each
+    # codepoint only needs a byte to index them.
+    break_props = ['Other'] * (MAX_CODEPOINT + 1)
+    for start, end, prop_type in break_ranges:
+        for cp in range(start, end + 1):
+            break_props[cp] = prop_type
+    emoji_props = [0] * (MAX_CODEPOINT + 1)
+    for start, end, prop_type in emoji_ranges:
+        for cp in range(start, end + 1):
+            emoji_props[cp] |= 1 << EMOJI_PROPS.index(prop_type)
+
+    entries = [('Other', 0)]
+    entry_indexes = {entries[0]: 0}
+    values = []
+    for cp in range(MAX_CODEPOINT + 1):
+        entry = (break_props[cp], emoji_props[cp])
+        if entry not in entry_indexes:
+            entry_indexes[entry] = len(entries)
+            entries.append(entry)
+        values.append(entry_indexes[entry])
+
+    assert len(entries) <= 256
+    return entries, values
+
+
+def get_ranges(values):
+    # Runs of codepoints sharing an entry. The runs cover every codepoint, so
+    # a run ends where the next one starts and only its start needs storing.
+    ranges = [(0, values[0])]
+    for cp in range(1, len(values)):
+        if values[cp] != values[cp - 1]:
+            ranges.append((cp, values[cp]))
+    return ranges
+
+
+def split_blocks(values, block_size):
+    # Identical blocks are only stored once
+    blocks = []
+    block_indexes = {}
+    indexes = []
+    for start in range(0, len(values), block_size):
+        block = tuple(values[start:start + block_size])
+        if block not in block_indexes:
+            block_indexes[block] = len(blocks)
+            blocks.append(block)
+        indexes.append(block_indexes[block])
+    return indexes, [value for block in blocks for value in block]
+
+
+def int_type(values):
+    return 'std::uint8_t' if max(values) < 256 else 'std::uint16_t'
+
+
+def int_size(values):
+    return 1 if max(values) < 256 else 2
+
+
+def build_trie(values):
+    # Three stages: the high bits of the codepoint pick a block of middle
+    # stage indexes, its middle bits a block of entry indexes, and its low
+    # bits the entry index itself. Pick the split taking up the least space.
+    best = None
+    for high_shift in range(8, 13):
+        for low_shift in range(3, high_shift):
+            middle, stage3 = split_blocks(values, 1 << low_shift)
+            stage1, stage2 = split_blocks(middle, 1 << (high_shift - low_shift))
+            size = (len(stage1) * int_size(stage1) +
+                    len(stage2) * int_size(stage2) +
+                    len(stage3) * int_size(stage3))
+            if best is None or size < best[0]:
+                best = (size, high_shift, low_shift, stage1, stage2, stage3)
+    return best[1:]
+
+
+def get_cpp_array_data(name, values):
+    array_data = \
+        f'inline constexpr {int_type(values)} {name}[{len(values)}] = {{\n'
+    for start in range(0, len(values), 16):
+        row = ', '.join(f'{value}' for value in values[start:start + 16])
+        array_data += f'  {row}'
+        if start + 16 < len(values):
+            array_data += ','
+        array_data += '\n'
+    array_data += '};\n\n'
+    return array_data
+
+
+def get_cpp_entries_data(script_name, entries):
+    start_header_data = \
+        '// NOTE: This file was autogenerated via ' \
+        f'scripts/{script_name}\n' \
+        '#include <auc/property.hpp>\n' \
+        '#include <cstddef>\n' \
+        '#include <cstdint>\n\n' \
+        '// https://www.unicode.org/' \
+        'Public/15.0.0/ucd/auxiliary/GraphemeBreakProperty.txt\n' \
+        '// https://www.unicode.org/' \
+        'Public/15.0.0/ucd/emoji/emoji-data.txt\n' \
+        'namespace auc {\n' \
+        'namespace detail {\n\n' \
+        'struct property_entry {\n' \
+        '  property::type break_prop_;\n' \
+        '  // Bit N is set for property::type::Emoji + N\n' \
+        '  std::uint8_t emoji_props_;\n' \
+        '};\n\n'
+
+    header_data = \
+        f'inline constexpr property_entry property_entries[{len(entries)}] = {{\n'
+    for entry_idx, (break_prop, emoji_props) in enumerate(entries):
+        header_data += \
+            f'  {{{PROP_CPP_CONV[break_prop]}, {emoji_props}u}}'
+        if entry_idx < len(entries) - 1:
+            header_data += ','
+        header_data += '\n'
+    header_data += '};\n\n'
+
+    return f'{start_header_data}{header_data}'
+
+
+def get_cpp_trie_data(script_name, entries, values):
+    high_shift, low_shift, stage1, stage2, stage3 = build_trie(values)
+
+    header_data = get_cpp_entries_data(script_name, entries)
+    header_data += get_cpp_array_data('property_stage1', stage1)
+    header_data += get_cpp_array_data('property_stage2', stage2)
+    header_data += get_cpp_array_data('property_stage3', stage3)
+
+    middle_mask = (1 << (high_shift - low_shift)) - 1
+    low_mask = (1 << low_shift) - 1
+    end_header_data = \
+        '// Usable at compile time, the tables are constant initialized read-only\n' \
+        '// data so there is nothing to construct at startup\n' \
+        'constexpr const property_entry& lookup_property(std::uint32_t cp) {\n' \
+        f'  if (cp > 0x{MAX_CODEPOINT:X}u)\n' \
+        '    return property_entries[0];\n\n' \
+        f'  const std::uint32_t middle = property_stage1[cp >> {high_shift}u];\n' \
+        '  const std::uint32_t low = property_stage2[\n' \
+        f'      (middle << {high_shift - low_shift}u) | ' \
+        f'((cp >> {low_shift}u) & {middle_mask}u)];\n' \
+        '  return property_entries[\n' \
+        f'      property_stage3[(low << {low_shift}u) | (cp & {low_mask}u)]];\n' \
+        '}\n\n' \
+        '} // namespace detail\n' \
+        '} // namespace auc\n'
+
+    return f'{header_data}{end_header_data}'
+
+
+def get_cpp_range_data(script_name, entries, values):
+    ranges = get_ranges(values)
+
+    header_data = get_cpp_entries_data(script_name, entries)
+    header_data += \
+        '// Each range runs up to the start of the next one\n' \
+        'struct property_range {\n' \
+        '  std::uint32_t start_ : 24;\n' \
+        '  std::uint32_t entry_ : 8;\n' \
+        '};\n' \
+        'static_assert(sizeof(property_range) == 4u);\n\n' \
+        f'inline constexpr property_range property_ranges[{len(ranges)}] = {{\n'
+    for range_idx, (start, entry) in enumerate(ranges):
+        header_data += f'  {{0x{start:X}u, {entry}u}}'
+        if range_idx < len(ranges) - 1:
+            header_data += ','
+        header_data += '\n'
+    header_data += '};\n\n'
+
+    end_header_data = \
+        '// Usable at compile time, the tables are constant initialized read-only\n' \
+        '// data so there is nothing to construct at startup\n' \
+        'constexpr const property_entry& lookup_property(std::uint32_t cp) {\n' \
+        f'  if (cp > 0x{MAX_CODEPOINT:X}u)\n' \
+        '    return property_entries[0];\n\n' \
+        '  // Binary search for the last range starting at or before cp, the\n' \
+        '  // first one starts at 0 so there always is one\n' \
+        '  std::size_t low = 1u;\n' \
+        f'  std::size_t high = {len(ranges)}u;\n' \
+        '  while (low < high) {\n' \
+        '    const std::size_t mid = low + (high - low) / 2u;\n' \
+        '    if (property_ranges[mid].start_ <= cp) {\n' \
+        '      low = mid + 1u;\n' \
+        '    } else {\n' \
+        '      high = mid;\n' \
+        '    }\n' \
+        '  }\n' \
+        '  return property_entries[property_ranges[low - 1u].entry_];\n' \
+        '}\n\n' \
+        '} // namespace detail\n' \
+        '} // namespace auc\n'
+
+    return f'{header_data}{end_header_data}'
+
+
+entries, values = get_entries(
+    get_property_ranges('GraphemeBreakProperty.txt'),
+    get_property_ranges('emoji-data.txt')
+)
+with open('../src/property_lookup.hpp', 'w') as gen_header_file:
+    gen_header_file.write(
+        get_cpp_trie_data('gen_property_lookup.py', entries, values))
+with open('../src/property_range_lookup.hpp', 'w') as gen_header_file:
+    gen_header_file.write(
+        get_cpp_range_data('gen_property_lookup.py', entries, values))
@@ -1,4 +1,5 @@
 PROP_CPP_CONV = {
+    'Other': 'property::type::Other',
     'CR': 'property::type::CR',
     'LF': 'property::type::LF',
     'Control': 'property::type::Control',
@@ -22,29 +23,19 @@ PROP_CPP_CONV = {
 
 
 def codepoint_range(codepoint):
-    if '..' in codepoint:
-        start = 0
-        end = 0
+    # Either a single codepoint or an inclusive XXXX..YYYY range, which is
+    # kept as is rather than expanded into every codepoint in it
+    bounds = codepoint.split('..')
+    start = int(bounds[0], base=16)
+    end = int(bounds[-1], base=16)
+    if start > end:
+        return None
 
-        if len(codepoint) == 10:
-            # U+XXXX
-            start = int(codepoint[0:4], base=16)
-            end = int(codepoint[6:10], base=16)
-        elif len(codepoint) == 12:
-            # U+XXXXX
-            start = int(codepoint[0:5], base=16)
-            end = int(codepoint[7:12], base=16)
+    return start, end
 
-        if start == end or start > end:
-            return None
 
-        return [cp for cp in range(start, end + 1)]
-    else:
-        return [int(codepoint, base=16)]
-
-
-def get_properties(ucd_file, Property):
-    props = {}
+def get_property_ranges(ucd_file):
+    ranges = []
     with open(ucd_file, 'r', encoding='utf-8') as gpb_file:
         lines = gpb_file.readlines()
         for line in lines:
@@ -64,12 +55,6 @@ def get_properties(ucd_file, Property):
                 continue
 
             prop_type = second_section[0].strip()
-            for cp in codepoints:
-                if cp in props.keys():
-                    prop = props[cp]
-                    if hasattr(prop, 'append'):
-                        prop.append(prop_type)
-                else:
-                    props[cp] = Property(cp, prop_type)
+            ranges.append((codepoints[0], codepoints[1], prop_type))
 
-    return list(props.values())
+    return sorted(ranges)
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace auc {
+namespace detail {
+
+// The number of ASCII bytes bytes starts with, checked a whole SIMD block
+// at a time when the CPU supports it
+std::size_t ascii_prefix_length(const char* bytes, std::size_t length);
+
+// NOTE: This has internal linkage as the SIMD kernels include it too, and
+// an inline function compiled for their instruction set must not be picked
+// for the generic code.
+namespace {
+
+// Checks 8 bytes at a time for any of their high bits
+inline std::size_t ascii_prefix_length_words(const char* bytes,
+                                             std::size_t length) {
+  constexpr std::uint64_t high_bits = 0x8080808080808080u;
+  std::size_t idx = 0u;
+  for (; idx + 8u <= length; idx += 8u) {
+    std::uint64_t word = 0u;
+    std::memcpy(&word, bytes + idx, sizeof(word));
+    if ((word & high_bits) != 0u) {
+      break;
+    }
+  }
+  while (idx < length && static_cast<std::uint8_t>(bytes[idx]) < 0x80u) {
+    ++idx;
+  }
+  return idx;
+}
+
+}  // namespace
+
+}  // namespace detail
+}  // namespace auc
@@ -0,0 +1,18 @@
+#include <auc/codepoint_iterator.hpp>
+#include <auc/decode.hpp>
+
+namespace auc {
+
+codepoint codepoint_iterator::operator*() const {
+  const char* p = bytes_.data();
+  return codepoint{decode_next(p, bytes_.data() + bytes_.size()).codepoint_};
+}
+
+codepoint_iterator& codepoint_iterator::operator++() {
+  const char* p = bytes_.data();
+  decode_next(p, bytes_.data() + bytes_.size());
+  bytes_.remove_prefix(static_cast<std::size_t>(p - bytes_.data()));
+  return *this;
+}
+
+}  // namespace auc
@@ -0,0 +1,134 @@
+#include "decode_kernels.hpp"
+#include "utf8_dfa.hpp"
+
+#include <auc/decode.hpp>
+
+namespace auc {
+
+namespace detail {
+
+std::size_t decode_utf8_scalar(const char* bytes,
+                               std::size_t length,
+                               char32_t* out,
+                               char32_t*) {
+  char32_t* const begin = out;
+  const char* end = bytes + length;
+  for (const char* p = bytes; p != end;) {
+    *out++ = decode_char(p, end).codepoint_;
+  }
+  return static_cast<std::size_t>(out - begin);
+}
+
+std::size_t count_chars_scalar(const char* bytes, std::size_t length) {
+  std::size_t count = 0u;
+  for (std::size_t idx = 0u; idx < length; ++idx) {
+    count += (static_cast<std::int8_t>(bytes[idx]) > -65) ? 1u : 0u;
+  }
+  return count;
+}
+
+namespace {
+
+using decode_kernel = std::size_t (*)(const char*,
+                                      std::size_t,
+                                      char32_t*,
+                                      char32_t*);
+
+decode_kernel select_kernel(simd_level level) {
+  switch (level) {
+#if defined(AUC_X86_64_KERNELS)
+    case simd_level::AVX512:
+    case simd_level::AVX2:
+      return decode_utf8_avx2;
+    case simd_level::SSE42:
+      return decode_utf8_sse42;
+#endif
+    case simd_level::Scalar:
+    default:
+      return decode_utf8_scalar;
+  }
+}
+
+std::size_t run_kernel(decode_kernel kernel,
+                       bool valid,
+                       std::string_view bytes,
+                       std::span<char32_t> out) {
+  // The kernels only handle well-formed input, anything else goes through
+  // the DFA so that it decodes to U+FFFD in exactly the same places
+  if (!valid) {
+    kernel = decode_utf8_scalar;
+  }
+  return kernel(bytes.data(), bytes.size(), out.data(),
+                out.data() + out.size());
+}
+
+using count_kernel = std::size_t (*)(const char*, std::size_t);
+
+count_kernel select_count_kernel(simd_level level) {
+  switch (level) {
+#if defined(AUC_X86_64_KERNELS)
+    case simd_level::AVX512:
+    case simd_level::AVX2:
+      return count_chars_avx2;
+    case simd_level::SSE42:
+      return count_chars_sse42;
+#endif
+    case simd_level::Scalar:
+    default:
+      return count_chars_scalar;
+  }
+}
+
+std::size_t count_with_kernel(count_kernel kernel,
+                              bool valid,
+                              std::string_view bytes) {
+  if (valid) {
+    // Every character has exactly one byte that isn't a continuation
+    return kernel(bytes.data(), bytes.size());
+  }
+
+  // Ill-formed sequences take up as many characters as decode_next finds
+  std::size_t count = 0u;
+  const char* end = bytes.data() + bytes.size();
+  for (const char* p = bytes.data(); p != end; ++count) {
+    decode_char(p, end);
+  }
+  return count;
+}
+
+}  // namespace
+
+std::size_t count_codepoints(simd_level level, std::string_view bytes) {
+  const bool valid = validate_utf8(level, bytes.data(), bytes.size());
+  return count_with_kernel(select_count_kernel(level), valid, bytes);
+}
+
+std::size_t decode_utf8_to_utf32(simd_level level,
+                                 std::string_view bytes,
+                                 std::span<char32_t> out) {
+  const bool valid = validate_utf8(level, bytes.data(), bytes.size());
+  return run_kernel(select_kernel(level), valid, bytes, out);
+}
+
+}  // namespace detail
+
+decode_result decode_next(const char*& p, const char* end) {
+  return detail::decode_char(p, end);
+}
+
+std::size_t count_codepoints(std::string_view bytes) {
+  static const detail::count_kernel kernel =
+      detail::select_count_kernel(detail::detect_simd_level());
+  const bool valid = validate_utf8(bytes.data(), bytes.size());
+  return detail::count_with_kernel(kernel, valid, bytes);
+}
+
+std::size_t decode_utf8_to_utf32(std::string_view bytes,
+                                 std::span<char32_t> out) {
+  static const detail::decode_kernel kernel =
+      detail::select_kernel(detail::detect_simd_level());
+  const bool valid = validate_utf8(bytes.data(), bytes.size());
+  return detail::run_kernel(kernel, valid, bytes, out);
+}
+
+}  // namespace auc
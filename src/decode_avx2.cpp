@@ -0,0 +1,61 @@
+#include "decode_kernels.hpp"
+#include "decode_lookup.hpp"
+
+#include <bit>
+
+namespace auc {
+namespace detail {
+
+std::size_t decode_utf8_avx2(const char* bytes,
+                             std::size_t length,
+                             char32_t* out,
+                             char32_t* out_end) {
+  char32_t* const begin = out;
+  const char* p = bytes;
+  const char* end = bytes + length;
+
+  while (end - p >= 32 && out_end - out >= 32) {
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    if (_mm256_movemask_epi8(block) == 0) {
+      // Zero extend each ASCII byte to 32 bits, 8 at a time
+      auto* dst = reinterpret_cast<__m256i*>(out);
+      for (int idx = 0; idx < 4; ++idx) {
+        const __m128i eight_bytes =
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + 8 * idx));
+        _mm256_storeu_si256(dst + idx, _mm256_cvtepu8_epi32(eight_bytes));
+      }
+      p += 32;
+      out += 32;
+      continue;
+    }
+    decode_pack(p, out);
+  }
+
+  while (end - p >= 16 && out_end - out >= 4) {
+    decode_pack(p, out);
+  }
+  while (p != end) {
+    *out++ = decode_valid_char(p);
+  }
+  return static_cast<std::size_t>(out - begin);
+}
+
+std::size_t count_chars_avx2(const char* bytes, std::size_t length) {
+  std::size_t count = 0u;
+  const char* p = bytes;
+  const char* end = bytes + length;
+  // Continuation bytes are the ones below -64 as signed integers
+  while (end - p >= 32) {
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i is_lead = _mm256_cmpgt_epi8(block, _mm256_set1_epi8(-65));
+    count += static_cast<std::size_t>(std::popcount(
+        static_cast<unsigned int>(_mm256_movemask_epi8(is_lead))));
+    p += 32;
+  }
+  return count + count_chars_scalar(p, static_cast<std::size_t>(end - p));
+}
+
+}  // namespace detail
+}  // namespace auc
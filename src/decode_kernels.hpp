@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+
+namespace auc {
+namespace detail {
+
+// Each kernel decodes length bytes of well-formed UTF-8 into out and
+// returns the number of codepoints written. out_end bounds how far the SIMD
+// kernels may store, as they write whole registers and only advance by the
+// codepoints that were decoded.
+std::size_t decode_utf8_scalar(const char* bytes,
+                               std::size_t length,
+                               char32_t* out,
+                               char32_t* out_end);
+
+#if defined(AUC_X86_64_KERNELS)
+std::size_t decode_utf8_sse42(const char* bytes,
+                              std::size_t length,
+                              char32_t* out,
+                              char32_t* out_end);
+std::size_t decode_utf8_avx2(const char* bytes,
+                             std::size_t length,
+                             char32_t* out,
+                             char32_t* out_end);
+#endif
+
+// Each kernel counts the bytes that aren't UTF-8 continuation bytes, which
+// for well-formed UTF-8 is the number of characters
+std::size_t count_chars_scalar(const char* bytes, std::size_t length);
+
+#if defined(AUC_X86_64_KERNELS)
+std::size_t count_chars_sse42(const char* bytes, std::size_t length);
+std::size_t count_chars_avx2(const char* bytes, std::size_t length);
+#endif
+
+}  // namespace detail
+}  // namespace auc
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+// NOTE: This header is only included by the decode_<isa>.cpp kernels, so
+// like validation_lookup.hpp everything here has internal linkage.
+
+// Up to 4 characters of at most 3 bytes are decoded from the next 12 bytes
+// at once. The positions of their lead bytes select a byte shuffle which
+// moves each character into its own 32 bit lane, last byte first, from
+// where the payload bits are masked and shifted into place. The input is
+// known to be well-formed by the time it gets here.
+namespace auc {
+namespace detail {
+namespace {
+
+struct utf8_pack {
+  alignas(16) std::uint8_t shuffle_[16];
+  std::uint8_t num_chars_;
+  std::uint8_t num_bytes_;
+};
+
+// Packs are numbered by their character lengths, shorter packs first:
+// 1 + 3 + 9 + 27 + 81 of them
+constexpr std::size_t utf8_num_packs = 121u;
+
+constexpr std::size_t pack_id(const std::size_t (&lengths)[4],
+                              std::size_t num_chars) {
+  std::size_t id = 0u;
+  std::size_t first_id = 0u;
+  std::size_t num_ids = 1u;
+  for (std::size_t idx = 0u; idx < num_chars; ++idx) {
+    id += (lengths[idx] - 1u) * num_ids;
+    first_id += num_ids;
+    num_ids *= 3u;
+  }
+  return first_id + id;
+}
+
+// Splits the lead byte positions of the next 13 bytes into characters. The
+// first byte always starts one, so only the other 12 are in the mask.
+constexpr std::size_t split_chars(std::size_t starts,
+                                  std::size_t (&lengths)[4]) {
+  std::size_t num_chars = 0u;
+  std::size_t pos = 0u;
+  while (num_chars < 4u) {
+    std::size_t next = pos + 1u;
+    while (next <= 12u && !((starts >> (next - 1u)) & 1u)) {
+      ++next;
+    }
+    // 4 byte characters, and ones whose end isn't in sight, are left to the
+    // scalar decoder
+    if (next > 12u || next - pos > 3u) {
+      break;
+    }
+    lengths[num_chars++] = next - pos;
+    pos = next;
+  }
+  return num_chars;
+}
+
+constexpr std::array<utf8_pack, utf8_num_packs> utf8_pack_table = [] {
+  std::array<utf8_pack, utf8_num_packs> table{};
+  for (std::size_t starts = 0u; starts < 4096u; ++starts) {
+    std::size_t lengths[4] = {};
+    const std::size_t num_chars = split_chars(starts, lengths);
+    utf8_pack& pack = table[pack_id(lengths, num_chars)];
+
+    for (std::uint8_t& byte : pack.shuffle_) {
+      byte = 0x80u;
+    }
+    std::size_t pos = 0u;
+    for (std::size_t idx = 0u; idx < num_chars; ++idx) {
+      for (std::size_t byte = 0u; byte < lengths[idx]; ++byte) {
+        pack.shuffle_[4u * idx + byte] =
+            static_cast<std::uint8_t>(pos + lengths[idx] - 1u - byte);
+      }
+      pos += lengths[idx];
+    }
+    pack.num_chars_ = static_cast<std::uint8_t>(num_chars);
+    pack.num_bytes_ = static_cast<std::uint8_t>(pos);
+  }
+  return table;
+}();
+
+// Indexed by the lead byte mask of bytes 1-12
+constexpr std::array<std::uint8_t, 4096> utf8_pack_index = [] {
+  std::array<std::uint8_t, 4096> table{};
+  for (std::size_t starts = 0u; starts < table.size(); ++starts) {
+    std::size_t lengths[4] = {};
+    const std::size_t num_chars = split_chars(starts, lengths);
+    table[starts] = static_cast<std::uint8_t>(pack_id(lengths, num_chars));
+  }
+  return table;
+}();
+
+inline char32_t decode_valid_char(const char*& p) {
+  const auto lead = static_cast<std::uint8_t>(p[0]);
+  if (lead < 0x80u) {
+    p += 1;
+    return lead;
+  }
+  const auto tail = [&p](std::size_t idx) -> char32_t {
+    return static_cast<std::uint8_t>(p[idx]) & 0x3Fu;
+  };
+  char32_t cp = 0u;
+  if (lead < 0xE0u) {
+    cp = ((lead & 0x1Fu) << 6u) | tail(1u);
+    p += 2;
+  } else if (lead < 0xF0u) {
+    cp = ((lead & 0x0Fu) << 12u) | (tail(1u) << 6u) | tail(2u);
+    p += 3;
+  } else {
+    cp = ((lead & 0x07u) << 18u) | (tail(1u) << 12u) | (tail(2u) << 6u) |
+         tail(3u);
+    p += 4;
+  }
+  return cp;
+}
+
+// Decodes the characters starting in the next 12 bytes, reading 16 bytes
+// from p and writing 4 codepoints to out
+inline void decode_pack(const char*& p, char32_t*& out) {
+  const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+  // Continuation bytes are 0x80-0xBF, the only ones at or below -65 signed
+  const unsigned int starts = static_cast<unsigned int>(
+      _mm_movemask_epi8(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(-65))));
+  const utf8_pack& pack =
+      utf8_pack_table[utf8_pack_index[(starts >> 1u) & 0xFFFu]];
+  if (pack.num_chars_ == 0u) {
+    *out++ = decode_valid_char(p);
+    return;
+  }
+
+  // With the last byte in the low byte of a lane, the lead byte's marker
+  // bits are always clear of the payload masks below: 0_______ and
+  // 10______ in the 1st byte, 110_____ and 10______ in the 2nd and
+  // 1110____ in the 3rd.
+  const __m128i lanes = _mm_shuffle_epi8(
+      bytes, _mm_load_si128(reinterpret_cast<const __m128i*>(pack.shuffle_)));
+  const __m128i cps = _mm_or_si128(
+      _mm_or_si128(_mm_and_si128(lanes, _mm_set1_epi32(0x7F)),
+                   _mm_and_si128(_mm_srli_epi32(lanes, 2),
+                                 _mm_set1_epi32(0x3F << 6))),
+      _mm_and_si128(_mm_srli_epi32(lanes, 4), _mm_set1_epi32(0x1F << 12)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), cps);
+  out += pack.num_chars_;
+  p += pack.num_bytes_;
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace auc
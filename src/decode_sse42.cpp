@@ -0,0 +1,58 @@
+#include "decode_kernels.hpp"
+#include "decode_lookup.hpp"
+
+#include <bit>
+
+namespace auc {
+namespace detail {
+
+std::size_t decode_utf8_sse42(const char* bytes,
+                              std::size_t length,
+                              char32_t* out,
+                              char32_t* out_end) {
+  char32_t* const begin = out;
+  const char* p = bytes;
+  const char* end = bytes + length;
+
+  while (end - p >= 16 && out_end - out >= 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    if (_mm_movemask_epi8(block) == 0) {
+      // Zero extend each ASCII byte to 32 bits
+      auto* dst = reinterpret_cast<__m128i*>(out);
+      _mm_storeu_si128(dst, _mm_cvtepu8_epi32(block));
+      _mm_storeu_si128(dst + 1, _mm_cvtepu8_epi32(_mm_srli_si128(block, 4)));
+      _mm_storeu_si128(dst + 2, _mm_cvtepu8_epi32(_mm_srli_si128(block, 8)));
+      _mm_storeu_si128(dst + 3, _mm_cvtepu8_epi32(_mm_srli_si128(block, 12)));
+      p += 16;
+      out += 16;
+      continue;
+    }
+    decode_pack(p, out);
+  }
+
+  while (end - p >= 16 && out_end - out >= 4) {
+    decode_pack(p, out);
+  }
+  while (p != end) {
+    *out++ = decode_valid_char(p);
+  }
+  return static_cast<std::size_t>(out - begin);
+}
+
+std::size_t count_chars_sse42(const char* bytes, std::size_t length) {
+  std::size_t count = 0u;
+  const char* p = bytes;
+  const char* end = bytes + length;
+  // Continuation bytes are the ones below -64 as signed integers
+  while (end - p >= 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i is_lead = _mm_cmpgt_epi8(block, _mm_set1_epi8(-65));
+    count += static_cast<std::size_t>(
+        std::popcount(static_cast<unsigned int>(_mm_movemask_epi8(is_lead))));
+    p += 16;
+  }
+  return count + count_chars_scalar(p, static_cast<std::size_t>(end - p));
+}
+
+}  // namespace detail
+}  // namespace auc
@@ -1,3694 +0,0 @@
-// NOTE: This file was autogenerated via scripts/gen_emojiproperty_lookup.py
-#include <unordered_map>
-#include <vector>
-
-#include <auc/property.hpp>
-#include <cstdint>
-
-// https://www.unicode.org/Public/15.0.0/ucd/emoji/emoji-data.txt
-namespace auc {
-namespace detail {
-
-static std::unordered_map<std::uint32_t, std::vector<property::type>> codepoint_emoji_lookup = {
-  {42u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {48u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {49u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {50u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {51u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {52u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {53u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {54u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {55u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {56u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {57u, {property::type::Emoji, property::type::Emoji_Comp}},
-  {169u, {property::type::Emoji, property::type::Ext_Pict}},
-  {174u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8252u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8265u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8482u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8505u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8596u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8597u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8598u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8599u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8600u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8601u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8617u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8618u, {property::type::Emoji, property::type::Ext_Pict}},
-  {8986u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {8987u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9000u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9167u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9193u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9194u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9195u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9196u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9197u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9198u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9199u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9200u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9201u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9202u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9203u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9208u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9209u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9210u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9410u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9642u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9643u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9654u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9664u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9723u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9724u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9725u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9726u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9728u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9729u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9730u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9731u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9732u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9742u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9745u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9748u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9749u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9752u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9757u, {property::type::Emoji, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {9760u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9762u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9763u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9766u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9770u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9774u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9775u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9784u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9785u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9786u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9792u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9794u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9800u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9801u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9802u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9803u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9804u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9805u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9806u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9807u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9808u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9809u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9810u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9811u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9823u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9824u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9827u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9829u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9830u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9832u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9851u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9854u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9855u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9874u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9875u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9876u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9877u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9878u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9879u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9881u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9883u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9884u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9888u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9889u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9895u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9898u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9899u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9904u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9905u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9917u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9918u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9924u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9925u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9928u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9934u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9935u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9937u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9939u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9940u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9961u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9962u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9968u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9969u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9970u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9971u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9972u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9973u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9975u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9976u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9977u, {property::type::Emoji, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {9978u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9981u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9986u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9989u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {9992u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9993u, {property::type::Emoji, property::type::Ext_Pict}},
-  {9994u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {9995u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {9996u, {property::type::Emoji, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {9997u, {property::type::Emoji, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {9999u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10002u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10004u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10006u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10013u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10017u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10024u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10035u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10036u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10052u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10055u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10060u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10062u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10067u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10068u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10069u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10071u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10083u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10084u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10133u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10134u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10135u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10145u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10160u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10175u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {10548u, {property::type::Emoji, property::type::Ext_Pict}},
-  {10549u, {property::type::Emoji, property::type::Ext_Pict}},
-  {11013u, {property::type::Emoji, property::type::Ext_Pict}},
-  {11014u, {property::type::Emoji, property::type::Ext_Pict}},
-  {11015u, {property::type::Emoji, property::type::Ext_Pict}},
-  {11035u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {11036u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {11088u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {11093u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {12336u, {property::type::Emoji, property::type::Ext_Pict}},
-  {12349u, {property::type::Emoji, property::type::Ext_Pict}},
-  {12951u, {property::type::Emoji, property::type::Ext_Pict}},
-  {12953u, {property::type::Emoji, property::type::Ext_Pict}},
-  {126980u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127183u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127344u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127345u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127358u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127359u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127374u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127377u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127378u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127379u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127380u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127381u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127382u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127383u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127384u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127385u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127386u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127462u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127463u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127464u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127465u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127466u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127467u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127468u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127469u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127470u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127471u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127472u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127473u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127474u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127475u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127476u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127477u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127478u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127479u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127480u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127481u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127482u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127483u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127484u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127485u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127486u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127487u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp}},
-  {127489u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127490u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127514u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127535u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127538u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127539u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127540u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127541u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127542u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127543u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127544u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127545u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127546u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127568u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127569u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127744u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127745u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127746u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127747u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127748u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127749u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127750u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127751u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127752u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127753u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127754u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127755u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127756u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127757u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127758u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127759u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127760u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127761u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127762u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127763u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127764u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127765u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127766u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127767u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127768u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127769u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127770u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127771u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127772u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127773u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127774u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127775u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127776u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127777u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127780u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127781u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127782u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127783u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127784u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127785u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127786u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127787u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127788u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127789u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127790u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127791u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127792u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127793u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127794u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127795u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127796u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127797u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127798u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127799u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127800u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127801u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127802u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127803u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127804u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127805u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127806u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127807u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127808u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127809u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127810u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127811u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127812u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127813u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127814u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127815u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127816u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127817u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127818u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127819u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127820u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127821u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127822u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127823u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127824u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127825u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127826u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127827u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127828u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127829u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127830u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127831u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127832u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127833u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127834u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127835u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127836u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127837u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127838u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127839u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127840u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127841u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127842u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127843u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127844u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127845u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127846u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127847u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127848u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127849u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127850u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127851u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127852u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127853u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127854u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127855u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127856u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127857u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127858u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127859u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127860u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127861u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127862u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127863u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127864u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127865u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127866u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127867u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127868u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127869u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127870u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127871u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127872u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127873u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127874u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127875u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127876u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127877u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {127878u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127879u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127880u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127881u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127882u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127883u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127884u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127885u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127886u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127887u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127888u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127889u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127890u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127891u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127894u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127895u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127897u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127898u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127899u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127902u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127903u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127904u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127905u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127906u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127907u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127908u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127909u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127910u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127911u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127912u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127913u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127914u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127915u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127916u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127917u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127918u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127919u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127920u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127921u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127922u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127923u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127924u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127925u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127926u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127927u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127928u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127929u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127930u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127931u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127932u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127933u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127934u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127935u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127936u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127937u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127938u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {127939u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {127940u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {127941u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127942u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127943u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {127944u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127945u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127946u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {127947u, {property::type::Emoji, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {127948u, {property::type::Emoji, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {127949u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127950u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127951u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127952u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127953u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127954u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127955u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127956u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127957u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127958u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127959u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127960u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127961u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127962u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127963u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127964u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127965u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127966u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127967u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127968u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127969u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127970u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127971u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127972u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127973u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127974u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127975u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127976u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127977u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127978u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127979u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127980u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127981u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127982u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127983u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127984u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127987u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127988u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127989u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127991u, {property::type::Emoji, property::type::Ext_Pict}},
-  {127992u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127993u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127994u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {127995u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod, property::type::Emoji_Comp}},
-  {127996u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod, property::type::Emoji_Comp}},
-  {127997u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod, property::type::Emoji_Comp}},
-  {127998u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod, property::type::Emoji_Comp}},
-  {127999u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod, property::type::Emoji_Comp}},
-  {128000u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128001u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128002u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128003u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128004u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128005u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128006u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128007u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128008u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128009u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128010u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128011u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128012u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128013u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128014u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128015u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128016u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128017u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128018u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128019u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128020u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128021u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128022u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128023u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128024u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128025u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128026u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128027u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128028u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128029u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128030u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128031u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128032u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128033u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128034u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128035u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128036u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128037u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128038u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128039u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128040u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128041u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128042u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128043u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128044u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128045u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128046u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128047u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128048u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128049u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128050u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128051u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128052u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128053u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128054u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128055u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128056u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128057u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128058u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128059u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128060u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128061u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128062u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128063u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128064u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128065u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128066u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128067u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128068u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128069u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128070u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128071u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128072u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128073u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128074u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128075u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128076u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128077u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128078u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128079u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128080u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128081u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128082u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128083u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128084u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128085u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128086u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128087u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128088u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128089u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128090u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128091u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128092u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128093u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128094u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128095u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128096u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128097u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128098u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128099u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128100u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128101u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128102u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128103u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128104u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128105u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128106u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128107u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128108u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128109u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128110u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128111u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128112u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128113u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128114u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128115u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128116u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128117u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128118u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128119u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128120u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128121u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128122u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128123u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128124u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128125u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128126u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128127u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128128u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128129u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128130u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128131u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128132u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128133u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128134u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128135u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128136u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128137u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128138u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128139u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128140u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128141u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128142u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128143u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128144u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128145u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128146u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128147u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128148u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128149u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128150u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128151u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128152u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128153u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128154u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128155u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128156u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128157u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128158u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128159u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128160u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128161u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128162u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128163u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128164u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128165u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128166u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128167u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128168u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128169u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128170u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128171u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128172u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128173u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128174u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128175u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128176u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128177u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128178u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128179u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128180u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128181u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128182u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128183u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128184u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128185u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128186u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128187u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128188u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128189u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128190u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128191u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128192u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128193u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128194u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128195u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128196u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128197u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128198u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128199u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128200u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128201u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128202u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128203u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128204u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128205u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128206u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128207u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128208u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128209u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128210u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128211u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128212u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128213u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128214u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128215u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128216u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128217u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128218u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128219u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128220u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128221u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128222u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128223u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128224u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128225u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128226u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128227u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128228u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128229u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128230u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128231u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128232u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128233u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128234u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128235u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128236u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128237u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128238u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128239u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128240u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128241u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128242u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128243u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128244u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128245u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128246u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128247u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128248u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128249u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128250u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128251u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128252u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128253u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128255u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128256u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128257u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128258u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128259u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128260u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128261u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128262u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128263u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128264u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128265u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128266u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128267u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128268u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128269u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128270u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128271u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128272u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128273u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128274u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128275u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128276u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128277u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128278u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128279u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128280u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128281u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128282u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128283u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128284u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128285u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128286u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128287u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128288u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128289u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128290u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128291u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128292u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128293u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128294u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128295u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128296u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128297u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128298u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128299u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128300u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128301u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128302u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128303u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128304u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128305u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128306u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128307u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128308u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128309u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128310u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128311u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128312u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128313u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128314u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128315u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128316u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128317u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128329u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128330u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128331u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128332u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128333u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128334u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128336u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128337u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128338u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128339u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128340u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128341u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128342u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128343u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128344u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128345u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128346u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128347u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128348u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128349u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128350u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128351u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128352u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128353u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128354u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128355u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128356u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128357u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128358u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128359u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128367u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128368u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128371u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128372u, {property::type::Emoji, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128373u, {property::type::Emoji, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128374u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128375u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128376u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128377u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128378u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128391u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128394u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128395u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128396u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128397u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128400u, {property::type::Emoji, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128405u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128406u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128420u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128421u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128424u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128433u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128434u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128444u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128450u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128451u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128452u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128465u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128466u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128467u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128476u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128477u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128478u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128481u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128483u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128488u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128495u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128499u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128506u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128507u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128508u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128509u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128510u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128511u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128512u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128513u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128514u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128515u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128516u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128517u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128518u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128519u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128520u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128521u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128522u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128523u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128524u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128525u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128526u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128527u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128528u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128529u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128530u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128531u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128532u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128533u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128534u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128535u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128536u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128537u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128538u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128539u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128540u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128541u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128542u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128543u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128544u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128545u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128546u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128547u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128548u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128549u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128550u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128551u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128552u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128553u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128554u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128555u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128556u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128557u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128558u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128559u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128560u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128561u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128562u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128563u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128564u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128565u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128566u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128567u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128568u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128569u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128570u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128571u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128572u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128573u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128574u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128575u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128576u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128577u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128578u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128579u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128580u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128581u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128582u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128583u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128584u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128585u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128586u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128587u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128588u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128589u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128590u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128591u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128640u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128641u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128642u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128643u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128644u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128645u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128646u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128647u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128648u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128649u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128650u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128651u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128652u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128653u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128654u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128655u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128656u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128657u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128658u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128659u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128660u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128661u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128662u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128663u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128664u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128665u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128666u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128667u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128668u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128669u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128670u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128671u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128672u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128673u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128674u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128675u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128676u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128677u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128678u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128679u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128680u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128681u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128682u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128683u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128684u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128685u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128686u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128687u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128688u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128689u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128690u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128691u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128692u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128693u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128694u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128695u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128696u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128697u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128698u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128699u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128700u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128701u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128702u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128703u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128704u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128705u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128706u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128707u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128708u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128709u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128715u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128716u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {128717u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128718u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128719u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128720u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128721u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128722u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128725u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128726u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128727u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128732u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128733u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128734u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128735u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128736u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128737u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128738u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128739u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128740u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128741u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128745u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128747u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128748u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128752u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128755u, {property::type::Emoji, property::type::Ext_Pict}},
-  {128756u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128757u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128758u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128759u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128760u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128761u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128762u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128763u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128764u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128992u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128993u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128994u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128995u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128996u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128997u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128998u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {128999u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129000u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129001u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129002u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129003u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129008u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129292u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129293u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129294u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129295u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129296u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129297u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129298u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129299u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129300u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129301u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129302u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129303u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129304u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129305u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129306u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129307u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129308u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129309u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129310u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129311u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129312u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129313u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129314u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129315u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129316u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129317u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129318u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129319u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129320u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129321u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129322u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129323u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129324u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129325u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129326u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129327u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129328u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129329u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129330u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129331u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129332u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129333u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129334u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129335u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129336u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129337u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129338u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129340u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129341u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129342u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129343u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129344u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129345u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129346u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129347u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129348u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129349u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129351u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129352u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129353u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129354u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129355u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129356u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129357u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129358u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129359u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129360u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129361u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129362u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129363u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129364u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129365u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129366u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129367u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129368u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129369u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129370u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129371u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129372u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129373u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129374u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129375u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129376u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129377u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129378u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129379u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129380u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129381u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129382u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129383u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129384u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129385u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129386u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129387u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129388u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129389u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129390u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129391u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129392u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129393u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129394u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129395u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129396u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129397u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129398u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129399u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129400u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129401u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129402u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129403u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129404u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129405u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129406u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129407u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129408u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129409u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129410u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129411u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129412u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129413u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129414u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129415u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129416u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129417u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129418u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129419u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129420u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129421u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129422u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129423u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129424u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129425u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129426u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129427u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129428u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129429u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129430u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129431u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129432u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129433u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129434u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129435u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129436u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129437u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129438u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129439u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129440u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129441u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129442u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129443u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129444u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129445u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129446u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129447u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129448u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129449u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129450u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129451u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129452u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129453u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129454u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129455u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129456u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp, property::type::Ext_Pict}},
-  {129457u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp, property::type::Ext_Pict}},
-  {129458u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp, property::type::Ext_Pict}},
-  {129459u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Comp, property::type::Ext_Pict}},
-  {129460u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129461u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129462u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129463u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129464u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129465u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129466u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129467u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129468u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129469u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129470u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129471u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129472u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129473u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129474u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129475u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129476u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129477u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129478u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129479u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129480u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129481u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129482u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129483u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129484u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129485u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129486u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129487u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129488u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129489u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129490u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129491u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129492u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129493u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129494u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129495u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129496u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129497u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129498u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129499u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129500u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129501u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129502u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129503u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129504u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129505u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129506u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129507u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129508u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129509u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129510u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129511u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129512u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129513u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129514u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129515u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129516u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129517u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129518u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129519u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129520u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129521u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129522u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129523u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129524u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129525u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129526u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129527u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129528u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129529u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129530u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129531u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129532u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129533u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129534u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129535u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129648u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129649u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129650u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129651u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129652u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129653u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129654u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129655u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129656u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129657u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129658u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129659u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129660u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129664u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129665u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129666u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129667u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129668u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129669u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129670u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129671u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129672u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129680u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129681u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129682u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129683u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129684u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129685u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129686u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129687u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129688u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129689u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129690u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129691u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129692u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129693u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129694u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129695u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129696u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129697u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129698u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129699u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129700u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129701u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129702u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129703u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129704u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129705u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129706u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129707u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129708u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129709u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129710u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129711u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129712u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129713u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129714u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129715u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129716u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129717u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129718u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129719u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129720u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129721u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129722u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129723u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129724u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129725u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129727u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129728u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129729u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129730u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129731u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129732u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129733u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129742u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129743u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129744u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129745u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129746u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129747u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129748u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129749u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129750u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129751u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129752u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129753u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129754u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129755u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129760u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129761u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129762u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129763u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129764u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129765u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129766u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129767u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129768u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Ext_Pict}},
-  {129776u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129777u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129778u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129779u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129780u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129781u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129782u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129783u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {129784u, {property::type::Emoji, property::type::Emoji_Pres, property::type::Emoji_Mod_Base, property::type::Ext_Pict}},
-  {8205u, {property::type::Emoji_Comp}},
-  {8419u, {property::type::Emoji_Comp}},
-  {65039u, {property::type::Emoji_Comp}},
-  {917536u, {property::type::Emoji_Comp}},
-  {917537u, {property::type::Emoji_Comp}},
-  {917538u, {property::type::Emoji_Comp}},
-  {917539u, {property::type::Emoji_Comp}},
-  {917540u, {property::type::Emoji_Comp}},
-  {917541u, {property::type::Emoji_Comp}},
-  {917542u, {property::type::Emoji_Comp}},
-  {917543u, {property::type::Emoji_Comp}},
-  {917544u, {property::type::Emoji_Comp}},
-  {917545u, {property::type::Emoji_Comp}},
-  {917546u, {property::type::Emoji_Comp}},
-  {917547u, {property::type::Emoji_Comp}},
-  {917548u, {property::type::Emoji_Comp}},
-  {917549u, {property::type::Emoji_Comp}},
-  {917550u, {property::type::Emoji_Comp}},
-  {917551u, {property::type::Emoji_Comp}},
-  {917552u, {property::type::Emoji_Comp}},
-  {917553u, {property::type::Emoji_Comp}},
-  {917554u, {property::type::Emoji_Comp}},
-  {917555u, {property::type::Emoji_Comp}},
-  {917556u, {property::type::Emoji_Comp}},
-  {917557u, {property::type::Emoji_Comp}},
-  {917558u, {property::type::Emoji_Comp}},
-  {917559u, {property::type::Emoji_Comp}},
-  {917560u, {property::type::Emoji_Comp}},
-  {917561u, {property::type::Emoji_Comp}},
-  {917562u, {property::type::Emoji_Comp}},
-  {917563u, {property::type::Emoji_Comp}},
-  {917564u, {property::type::Emoji_Comp}},
-  {917565u, {property::type::Emoji_Comp}},
-  {917566u, {property::type::Emoji_Comp}},
-  {917567u, {property::type::Emoji_Comp}},
-  {917568u, {property::type::Emoji_Comp}},
-  {917569u, {property::type::Emoji_Comp}},
-  {917570u, {property::type::Emoji_Comp}},
-  {917571u, {property::type::Emoji_Comp}},
-  {917572u, {property::type::Emoji_Comp}},
-  {917573u, {property::type::Emoji_Comp}},
-  {917574u, {property::type::Emoji_Comp}},
-  {917575u, {property::type::Emoji_Comp}},
-  {917576u, {property::type::Emoji_Comp}},
-  {917577u, {property::type::Emoji_Comp}},
-  {917578u, {property::type::Emoji_Comp}},
-  {917579u, {property::type::Emoji_Comp}},
-  {917580u, {property::type::Emoji_Comp}},
-  {917581u, {property::type::Emoji_Comp}},
-  {917582u, {property::type::Emoji_Comp}},
-  {917583u, {property::type::Emoji_Comp}},
-  {917584u, {property::type::Emoji_Comp}},
-  {917585u, {property::type::Emoji_Comp}},
-  {917586u, {property::type::Emoji_Comp}},
-  {917587u, {property::type::Emoji_Comp}},
-  {917588u, {property::type::Emoji_Comp}},
-  {917589u, {property::type::Emoji_Comp}},
-  {917590u, {property::type::Emoji_Comp}},
-  {917591u, {property::type::Emoji_Comp}},
-  {917592u, {property::type::Emoji_Comp}},
-  {917593u, {property::type::Emoji_Comp}},
-  {917594u, {property::type::Emoji_Comp}},
-  {917595u, {property::type::Emoji_Comp}},
-  {917596u, {property::type::Emoji_Comp}},
-  {917597u, {property::type::Emoji_Comp}},
-  {917598u, {property::type::Emoji_Comp}},
-  {917599u, {property::type::Emoji_Comp}},
-  {917600u, {property::type::Emoji_Comp}},
-  {917601u, {property::type::Emoji_Comp}},
-  {917602u, {property::type::Emoji_Comp}},
-  {917603u, {property::type::Emoji_Comp}},
-  {917604u, {property::type::Emoji_Comp}},
-  {917605u, {property::type::Emoji_Comp}},
-  {917606u, {property::type::Emoji_Comp}},
-  {917607u, {property::type::Emoji_Comp}},
-  {917608u, {property::type::Emoji_Comp}},
-  {917609u, {property::type::Emoji_Comp}},
-  {917610u, {property::type::Emoji_Comp}},
-  {917611u, {property::type::Emoji_Comp}},
-  {917612u, {property::type::Emoji_Comp}},
-  {917613u, {property::type::Emoji_Comp}},
-  {917614u, {property::type::Emoji_Comp}},
-  {917615u, {property::type::Emoji_Comp}},
-  {917616u, {property::type::Emoji_Comp}},
-  {917617u, {property::type::Emoji_Comp}},
-  {917618u, {property::type::Emoji_Comp}},
-  {917619u, {property::type::Emoji_Comp}},
-  {917620u, {property::type::Emoji_Comp}},
-  {917621u, {property::type::Emoji_Comp}},
-  {917622u, {property::type::Emoji_Comp}},
-  {917623u, {property::type::Emoji_Comp}},
-  {917624u, {property::type::Emoji_Comp}},
-  {917625u, {property::type::Emoji_Comp}},
-  {917626u, {property::type::Emoji_Comp}},
-  {917627u, {property::type::Emoji_Comp}},
-  {917628u, {property::type::Emoji_Comp}},
-  {917629u, {property::type::Emoji_Comp}},
-  {917630u, {property::type::Emoji_Comp}},
-  {917631u, {property::type::Emoji_Comp}},
-  {9096u, {property::type::Ext_Pict}},
-  {9733u, {property::type::Ext_Pict}},
-  {9735u, {property::type::Ext_Pict}},
-  {9736u, {property::type::Ext_Pict}},
-  {9737u, {property::type::Ext_Pict}},
-  {9738u, {property::type::Ext_Pict}},
-  {9739u, {property::type::Ext_Pict}},
-  {9740u, {property::type::Ext_Pict}},
-  {9741u, {property::type::Ext_Pict}},
-  {9743u, {property::type::Ext_Pict}},
-  {9744u, {property::type::Ext_Pict}},
-  {9746u, {property::type::Ext_Pict}},
-  {9750u, {property::type::Ext_Pict}},
-  {9751u, {property::type::Ext_Pict}},
-  {9753u, {property::type::Ext_Pict}},
-  {9754u, {property::type::Ext_Pict}},
-  {9755u, {property::type::Ext_Pict}},
-  {9756u, {property::type::Ext_Pict}},
-  {9758u, {property::type::Ext_Pict}},
-  {9759u, {property::type::Ext_Pict}},
-  {9761u, {property::type::Ext_Pict}},
-  {9764u, {property::type::Ext_Pict}},
-  {9765u, {property::type::Ext_Pict}},
-  {9767u, {property::type::Ext_Pict}},
-  {9768u, {property::type::Ext_Pict}},
-  {9769u, {property::type::Ext_Pict}},
-  {9771u, {property::type::Ext_Pict}},
-  {9772u, {property::type::Ext_Pict}},
-  {9773u, {property::type::Ext_Pict}},
-  {9776u, {property::type::Ext_Pict}},
-  {9777u, {property::type::Ext_Pict}},
-  {9778u, {property::type::Ext_Pict}},
-  {9779u, {property::type::Ext_Pict}},
-  {9780u, {property::type::Ext_Pict}},
-  {9781u, {property::type::Ext_Pict}},
-  {9782u, {property::type::Ext_Pict}},
-  {9783u, {property::type::Ext_Pict}},
-  {9787u, {property::type::Ext_Pict}},
-  {9788u, {property::type::Ext_Pict}},
-  {9789u, {property::type::Ext_Pict}},
-  {9790u, {property::type::Ext_Pict}},
-  {9791u, {property::type::Ext_Pict}},
-  {9793u, {property::type::Ext_Pict}},
-  {9795u, {property::type::Ext_Pict}},
-  {9796u, {property::type::Ext_Pict}},
-  {9797u, {property::type::Ext_Pict}},
-  {9798u, {property::type::Ext_Pict}},
-  {9799u, {property::type::Ext_Pict}},
-  {9812u, {property::type::Ext_Pict}},
-  {9813u, {property::type::Ext_Pict}},
-  {9814u, {property::type::Ext_Pict}},
-  {9815u, {property::type::Ext_Pict}},
-  {9816u, {property::type::Ext_Pict}},
-  {9817u, {property::type::Ext_Pict}},
-  {9818u, {property::type::Ext_Pict}},
-  {9819u, {property::type::Ext_Pict}},
-  {9820u, {property::type::Ext_Pict}},
-  {9821u, {property::type::Ext_Pict}},
-  {9822u, {property::type::Ext_Pict}},
-  {9825u, {property::type::Ext_Pict}},
-  {9826u, {property::type::Ext_Pict}},
-  {9828u, {property::type::Ext_Pict}},
-  {9831u, {property::type::Ext_Pict}},
-  {9833u, {property::type::Ext_Pict}},
-  {9834u, {property::type::Ext_Pict}},
-  {9835u, {property::type::Ext_Pict}},
-  {9836u, {property::type::Ext_Pict}},
-  {9837u, {property::type::Ext_Pict}},
-  {9838u, {property::type::Ext_Pict}},
-  {9839u, {property::type::Ext_Pict}},
-  {9840u, {property::type::Ext_Pict}},
-  {9841u, {property::type::Ext_Pict}},
-  {9842u, {property::type::Ext_Pict}},
-  {9843u, {property::type::Ext_Pict}},
-  {9844u, {property::type::Ext_Pict}},
-  {9845u, {property::type::Ext_Pict}},
-  {9846u, {property::type::Ext_Pict}},
-  {9847u, {property::type::Ext_Pict}},
-  {9848u, {property::type::Ext_Pict}},
-  {9849u, {property::type::Ext_Pict}},
-  {9850u, {property::type::Ext_Pict}},
-  {9852u, {property::type::Ext_Pict}},
-  {9853u, {property::type::Ext_Pict}},
-  {9856u, {property::type::Ext_Pict}},
-  {9857u, {property::type::Ext_Pict}},
-  {9858u, {property::type::Ext_Pict}},
-  {9859u, {property::type::Ext_Pict}},
-  {9860u, {property::type::Ext_Pict}},
-  {9861u, {property::type::Ext_Pict}},
-  {9872u, {property::type::Ext_Pict}},
-  {9873u, {property::type::Ext_Pict}},
-  {9880u, {property::type::Ext_Pict}},
-  {9882u, {property::type::Ext_Pict}},
-  {9885u, {property::type::Ext_Pict}},
-  {9886u, {property::type::Ext_Pict}},
-  {9887u, {property::type::Ext_Pict}},
-  {9890u, {property::type::Ext_Pict}},
-  {9891u, {property::type::Ext_Pict}},
-  {9892u, {property::type::Ext_Pict}},
-  {9893u, {property::type::Ext_Pict}},
-  {9894u, {property::type::Ext_Pict}},
-  {9896u, {property::type::Ext_Pict}},
-  {9897u, {property::type::Ext_Pict}},
-  {9900u, {property::type::Ext_Pict}},
-  {9901u, {property::type::Ext_Pict}},
-  {9902u, {property::type::Ext_Pict}},
-  {9903u, {property::type::Ext_Pict}},
-  {9906u, {property::type::Ext_Pict}},
-  {9907u, {property::type::Ext_Pict}},
-  {9908u, {property::type::Ext_Pict}},
-  {9909u, {property::type::Ext_Pict}},
-  {9910u, {property::type::Ext_Pict}},
-  {9911u, {property::type::Ext_Pict}},
-  {9912u, {property::type::Ext_Pict}},
-  {9913u, {property::type::Ext_Pict}},
-  {9914u, {property::type::Ext_Pict}},
-  {9915u, {property::type::Ext_Pict}},
-  {9916u, {property::type::Ext_Pict}},
-  {9919u, {property::type::Ext_Pict}},
-  {9920u, {property::type::Ext_Pict}},
-  {9921u, {property::type::Ext_Pict}},
-  {9922u, {property::type::Ext_Pict}},
-  {9923u, {property::type::Ext_Pict}},
-  {9926u, {property::type::Ext_Pict}},
-  {9927u, {property::type::Ext_Pict}},
-  {9929u, {property::type::Ext_Pict}},
-  {9930u, {property::type::Ext_Pict}},
-  {9931u, {property::type::Ext_Pict}},
-  {9932u, {property::type::Ext_Pict}},
-  {9933u, {property::type::Ext_Pict}},
-  {9936u, {property::type::Ext_Pict}},
-  {9938u, {property::type::Ext_Pict}},
-  {9941u, {property::type::Ext_Pict}},
-  {9942u, {property::type::Ext_Pict}},
-  {9943u, {property::type::Ext_Pict}},
-  {9944u, {property::type::Ext_Pict}},
-  {9945u, {property::type::Ext_Pict}},
-  {9946u, {property::type::Ext_Pict}},
-  {9947u, {property::type::Ext_Pict}},
-  {9948u, {property::type::Ext_Pict}},
-  {9949u, {property::type::Ext_Pict}},
-  {9950u, {property::type::Ext_Pict}},
-  {9951u, {property::type::Ext_Pict}},
-  {9952u, {property::type::Ext_Pict}},
-  {9953u, {property::type::Ext_Pict}},
-  {9954u, {property::type::Ext_Pict}},
-  {9955u, {property::type::Ext_Pict}},
-  {9956u, {property::type::Ext_Pict}},
-  {9957u, {property::type::Ext_Pict}},
-  {9958u, {property::type::Ext_Pict}},
-  {9959u, {property::type::Ext_Pict}},
-  {9960u, {property::type::Ext_Pict}},
-  {9963u, {property::type::Ext_Pict}},
-  {9964u, {property::type::Ext_Pict}},
-  {9965u, {property::type::Ext_Pict}},
-  {9966u, {property::type::Ext_Pict}},
-  {9967u, {property::type::Ext_Pict}},
-  {9974u, {property::type::Ext_Pict}},
-  {9979u, {property::type::Ext_Pict}},
-  {9980u, {property::type::Ext_Pict}},
-  {9982u, {property::type::Ext_Pict}},
-  {9983u, {property::type::Ext_Pict}},
-  {9984u, {property::type::Ext_Pict}},
-  {9985u, {property::type::Ext_Pict}},
-  {9987u, {property::type::Ext_Pict}},
-  {9988u, {property::type::Ext_Pict}},
-  {9998u, {property::type::Ext_Pict}},
-  {10000u, {property::type::Ext_Pict}},
-  {10001u, {property::type::Ext_Pict}},
-  {10085u, {property::type::Ext_Pict}},
-  {10086u, {property::type::Ext_Pict}},
-  {10087u, {property::type::Ext_Pict}},
-  {126976u, {property::type::Ext_Pict}},
-  {126977u, {property::type::Ext_Pict}},
-  {126978u, {property::type::Ext_Pict}},
-  {126979u, {property::type::Ext_Pict}},
-  {126981u, {property::type::Ext_Pict}},
-  {126982u, {property::type::Ext_Pict}},
-  {126983u, {property::type::Ext_Pict}},
-  {126984u, {property::type::Ext_Pict}},
-  {126985u, {property::type::Ext_Pict}},
-  {126986u, {property::type::Ext_Pict}},
-  {126987u, {property::type::Ext_Pict}},
-  {126988u, {property::type::Ext_Pict}},
-  {126989u, {property::type::Ext_Pict}},
-  {126990u, {property::type::Ext_Pict}},
-  {126991u, {property::type::Ext_Pict}},
-  {126992u, {property::type::Ext_Pict}},
-  {126993u, {property::type::Ext_Pict}},
-  {126994u, {property::type::Ext_Pict}},
-  {126995u, {property::type::Ext_Pict}},
-  {126996u, {property::type::Ext_Pict}},
-  {126997u, {property::type::Ext_Pict}},
-  {126998u, {property::type::Ext_Pict}},
-  {126999u, {property::type::Ext_Pict}},
-  {127000u, {property::type::Ext_Pict}},
-  {127001u, {property::type::Ext_Pict}},
-  {127002u, {property::type::Ext_Pict}},
-  {127003u, {property::type::Ext_Pict}},
-  {127004u, {property::type::Ext_Pict}},
-  {127005u, {property::type::Ext_Pict}},
-  {127006u, {property::type::Ext_Pict}},
-  {127007u, {property::type::Ext_Pict}},
-  {127008u, {property::type::Ext_Pict}},
-  {127009u, {property::type::Ext_Pict}},
-  {127010u, {property::type::Ext_Pict}},
-  {127011u, {property::type::Ext_Pict}},
-  {127012u, {property::type::Ext_Pict}},
-  {127013u, {property::type::Ext_Pict}},
-  {127014u, {property::type::Ext_Pict}},
-  {127015u, {property::type::Ext_Pict}},
-  {127016u, {property::type::Ext_Pict}},
-  {127017u, {property::type::Ext_Pict}},
-  {127018u, {property::type::Ext_Pict}},
-  {127019u, {property::type::Ext_Pict}},
-  {127020u, {property::type::Ext_Pict}},
-  {127021u, {property::type::Ext_Pict}},
-  {127022u, {property::type::Ext_Pict}},
-  {127023u, {property::type::Ext_Pict}},
-  {127024u, {property::type::Ext_Pict}},
-  {127025u, {property::type::Ext_Pict}},
-  {127026u, {property::type::Ext_Pict}},
-  {127027u, {property::type::Ext_Pict}},
-  {127028u, {property::type::Ext_Pict}},
-  {127029u, {property::type::Ext_Pict}},
-  {127030u, {property::type::Ext_Pict}},
-  {127031u, {property::type::Ext_Pict}},
-  {127032u, {property::type::Ext_Pict}},
-  {127033u, {property::type::Ext_Pict}},
-  {127034u, {property::type::Ext_Pict}},
-  {127035u, {property::type::Ext_Pict}},
-  {127036u, {property::type::Ext_Pict}},
-  {127037u, {property::type::Ext_Pict}},
-  {127038u, {property::type::Ext_Pict}},
-  {127039u, {property::type::Ext_Pict}},
-  {127040u, {property::type::Ext_Pict}},
-  {127041u, {property::type::Ext_Pict}},
-  {127042u, {property::type::Ext_Pict}},
-  {127043u, {property::type::Ext_Pict}},
-  {127044u, {property::type::Ext_Pict}},
-  {127045u, {property::type::Ext_Pict}},
-  {127046u, {property::type::Ext_Pict}},
-  {127047u, {property::type::Ext_Pict}},
-  {127048u, {property::type::Ext_Pict}},
-  {127049u, {property::type::Ext_Pict}},
-  {127050u, {property::type::Ext_Pict}},
-  {127051u, {property::type::Ext_Pict}},
-  {127052u, {property::type::Ext_Pict}},
-  {127053u, {property::type::Ext_Pict}},
-  {127054u, {property::type::Ext_Pict}},
-  {127055u, {property::type::Ext_Pict}},
-  {127056u, {property::type::Ext_Pict}},
-  {127057u, {property::type::Ext_Pict}},
-  {127058u, {property::type::Ext_Pict}},
-  {127059u, {property::type::Ext_Pict}},
-  {127060u, {property::type::Ext_Pict}},
-  {127061u, {property::type::Ext_Pict}},
-  {127062u, {property::type::Ext_Pict}},
-  {127063u, {property::type::Ext_Pict}},
-  {127064u, {property::type::Ext_Pict}},
-  {127065u, {property::type::Ext_Pict}},
-  {127066u, {property::type::Ext_Pict}},
-  {127067u, {property::type::Ext_Pict}},
-  {127068u, {property::type::Ext_Pict}},
-  {127069u, {property::type::Ext_Pict}},
-  {127070u, {property::type::Ext_Pict}},
-  {127071u, {property::type::Ext_Pict}},
-  {127072u, {property::type::Ext_Pict}},
-  {127073u, {property::type::Ext_Pict}},
-  {127074u, {property::type::Ext_Pict}},
-  {127075u, {property::type::Ext_Pict}},
-  {127076u, {property::type::Ext_Pict}},
-  {127077u, {property::type::Ext_Pict}},
-  {127078u, {property::type::Ext_Pict}},
-  {127079u, {property::type::Ext_Pict}},
-  {127080u, {property::type::Ext_Pict}},
-  {127081u, {property::type::Ext_Pict}},
-  {127082u, {property::type::Ext_Pict}},
-  {127083u, {property::type::Ext_Pict}},
-  {127084u, {property::type::Ext_Pict}},
-  {127085u, {property::type::Ext_Pict}},
-  {127086u, {property::type::Ext_Pict}},
-  {127087u, {property::type::Ext_Pict}},
-  {127088u, {property::type::Ext_Pict}},
-  {127089u, {property::type::Ext_Pict}},
-  {127090u, {property::type::Ext_Pict}},
-  {127091u, {property::type::Ext_Pict}},
-  {127092u, {property::type::Ext_Pict}},
-  {127093u, {property::type::Ext_Pict}},
-  {127094u, {property::type::Ext_Pict}},
-  {127095u, {property::type::Ext_Pict}},
-  {127096u, {property::type::Ext_Pict}},
-  {127097u, {property::type::Ext_Pict}},
-  {127098u, {property::type::Ext_Pict}},
-  {127099u, {property::type::Ext_Pict}},
-  {127100u, {property::type::Ext_Pict}},
-  {127101u, {property::type::Ext_Pict}},
-  {127102u, {property::type::Ext_Pict}},
-  {127103u, {property::type::Ext_Pict}},
-  {127104u, {property::type::Ext_Pict}},
-  {127105u, {property::type::Ext_Pict}},
-  {127106u, {property::type::Ext_Pict}},
-  {127107u, {property::type::Ext_Pict}},
-  {127108u, {property::type::Ext_Pict}},
-  {127109u, {property::type::Ext_Pict}},
-  {127110u, {property::type::Ext_Pict}},
-  {127111u, {property::type::Ext_Pict}},
-  {127112u, {property::type::Ext_Pict}},
-  {127113u, {property::type::Ext_Pict}},
-  {127114u, {property::type::Ext_Pict}},
-  {127115u, {property::type::Ext_Pict}},
-  {127116u, {property::type::Ext_Pict}},
-  {127117u, {property::type::Ext_Pict}},
-  {127118u, {property::type::Ext_Pict}},
-  {127119u, {property::type::Ext_Pict}},
-  {127120u, {property::type::Ext_Pict}},
-  {127121u, {property::type::Ext_Pict}},
-  {127122u, {property::type::Ext_Pict}},
-  {127123u, {property::type::Ext_Pict}},
-  {127124u, {property::type::Ext_Pict}},
-  {127125u, {property::type::Ext_Pict}},
-  {127126u, {property::type::Ext_Pict}},
-  {127127u, {property::type::Ext_Pict}},
-  {127128u, {property::type::Ext_Pict}},
-  {127129u, {property::type::Ext_Pict}},
-  {127130u, {property::type::Ext_Pict}},
-  {127131u, {property::type::Ext_Pict}},
-  {127132u, {property::type::Ext_Pict}},
-  {127133u, {property::type::Ext_Pict}},
-  {127134u, {property::type::Ext_Pict}},
-  {127135u, {property::type::Ext_Pict}},
-  {127136u, {property::type::Ext_Pict}},
-  {127137u, {property::type::Ext_Pict}},
-  {127138u, {property::type::Ext_Pict}},
-  {127139u, {property::type::Ext_Pict}},
-  {127140u, {property::type::Ext_Pict}},
-  {127141u, {property::type::Ext_Pict}},
-  {127142u, {property::type::Ext_Pict}},
-  {127143u, {property::type::Ext_Pict}},
-  {127144u, {property::type::Ext_Pict}},
-  {127145u, {property::type::Ext_Pict}},
-  {127146u, {property::type::Ext_Pict}},
-  {127147u, {property::type::Ext_Pict}},
-  {127148u, {property::type::Ext_Pict}},
-  {127149u, {property::type::Ext_Pict}},
-  {127150u, {property::type::Ext_Pict}},
-  {127151u, {property::type::Ext_Pict}},
-  {127152u, {property::type::Ext_Pict}},
-  {127153u, {property::type::Ext_Pict}},
-  {127154u, {property::type::Ext_Pict}},
-  {127155u, {property::type::Ext_Pict}},
-  {127156u, {property::type::Ext_Pict}},
-  {127157u, {property::type::Ext_Pict}},
-  {127158u, {property::type::Ext_Pict}},
-  {127159u, {property::type::Ext_Pict}},
-  {127160u, {property::type::Ext_Pict}},
-  {127161u, {property::type::Ext_Pict}},
-  {127162u, {property::type::Ext_Pict}},
-  {127163u, {property::type::Ext_Pict}},
-  {127164u, {property::type::Ext_Pict}},
-  {127165u, {property::type::Ext_Pict}},
-  {127166u, {property::type::Ext_Pict}},
-  {127167u, {property::type::Ext_Pict}},
-  {127168u, {property::type::Ext_Pict}},
-  {127169u, {property::type::Ext_Pict}},
-  {127170u, {property::type::Ext_Pict}},
-  {127171u, {property::type::Ext_Pict}},
-  {127172u, {property::type::Ext_Pict}},
-  {127173u, {property::type::Ext_Pict}},
-  {127174u, {property::type::Ext_Pict}},
-  {127175u, {property::type::Ext_Pict}},
-  {127176u, {property::type::Ext_Pict}},
-  {127177u, {property::type::Ext_Pict}},
-  {127178u, {property::type::Ext_Pict}},
-  {127179u, {property::type::Ext_Pict}},
-  {127180u, {property::type::Ext_Pict}},
-  {127181u, {property::type::Ext_Pict}},
-  {127182u, {property::type::Ext_Pict}},
-  {127184u, {property::type::Ext_Pict}},
-  {127185u, {property::type::Ext_Pict}},
-  {127186u, {property::type::Ext_Pict}},
-  {127187u, {property::type::Ext_Pict}},
-  {127188u, {property::type::Ext_Pict}},
-  {127189u, {property::type::Ext_Pict}},
-  {127190u, {property::type::Ext_Pict}},
-  {127191u, {property::type::Ext_Pict}},
-  {127192u, {property::type::Ext_Pict}},
-  {127193u, {property::type::Ext_Pict}},
-  {127194u, {property::type::Ext_Pict}},
-  {127195u, {property::type::Ext_Pict}},
-  {127196u, {property::type::Ext_Pict}},
-  {127197u, {property::type::Ext_Pict}},
-  {127198u, {property::type::Ext_Pict}},
-  {127199u, {property::type::Ext_Pict}},
-  {127200u, {property::type::Ext_Pict}},
-  {127201u, {property::type::Ext_Pict}},
-  {127202u, {property::type::Ext_Pict}},
-  {127203u, {property::type::Ext_Pict}},
-  {127204u, {property::type::Ext_Pict}},
-  {127205u, {property::type::Ext_Pict}},
-  {127206u, {property::type::Ext_Pict}},
-  {127207u, {property::type::Ext_Pict}},
-  {127208u, {property::type::Ext_Pict}},
-  {127209u, {property::type::Ext_Pict}},
-  {127210u, {property::type::Ext_Pict}},
-  {127211u, {property::type::Ext_Pict}},
-  {127212u, {property::type::Ext_Pict}},
-  {127213u, {property::type::Ext_Pict}},
-  {127214u, {property::type::Ext_Pict}},
-  {127215u, {property::type::Ext_Pict}},
-  {127216u, {property::type::Ext_Pict}},
-  {127217u, {property::type::Ext_Pict}},
-  {127218u, {property::type::Ext_Pict}},
-  {127219u, {property::type::Ext_Pict}},
-  {127220u, {property::type::Ext_Pict}},
-  {127221u, {property::type::Ext_Pict}},
-  {127222u, {property::type::Ext_Pict}},
-  {127223u, {property::type::Ext_Pict}},
-  {127224u, {property::type::Ext_Pict}},
-  {127225u, {property::type::Ext_Pict}},
-  {127226u, {property::type::Ext_Pict}},
-  {127227u, {property::type::Ext_Pict}},
-  {127228u, {property::type::Ext_Pict}},
-  {127229u, {property::type::Ext_Pict}},
-  {127230u, {property::type::Ext_Pict}},
-  {127231u, {property::type::Ext_Pict}},
-  {127245u, {property::type::Ext_Pict}},
-  {127246u, {property::type::Ext_Pict}},
-  {127247u, {property::type::Ext_Pict}},
-  {127279u, {property::type::Ext_Pict}},
-  {127340u, {property::type::Ext_Pict}},
-  {127341u, {property::type::Ext_Pict}},
-  {127342u, {property::type::Ext_Pict}},
-  {127343u, {property::type::Ext_Pict}},
-  {127405u, {property::type::Ext_Pict}},
-  {127406u, {property::type::Ext_Pict}},
-  {127407u, {property::type::Ext_Pict}},
-  {127408u, {property::type::Ext_Pict}},
-  {127409u, {property::type::Ext_Pict}},
-  {127410u, {property::type::Ext_Pict}},
-  {127411u, {property::type::Ext_Pict}},
-  {127412u, {property::type::Ext_Pict}},
-  {127413u, {property::type::Ext_Pict}},
-  {127414u, {property::type::Ext_Pict}},
-  {127415u, {property::type::Ext_Pict}},
-  {127416u, {property::type::Ext_Pict}},
-  {127417u, {property::type::Ext_Pict}},
-  {127418u, {property::type::Ext_Pict}},
-  {127419u, {property::type::Ext_Pict}},
-  {127420u, {property::type::Ext_Pict}},
-  {127421u, {property::type::Ext_Pict}},
-  {127422u, {property::type::Ext_Pict}},
-  {127423u, {property::type::Ext_Pict}},
-  {127424u, {property::type::Ext_Pict}},
-  {127425u, {property::type::Ext_Pict}},
-  {127426u, {property::type::Ext_Pict}},
-  {127427u, {property::type::Ext_Pict}},
-  {127428u, {property::type::Ext_Pict}},
-  {127429u, {property::type::Ext_Pict}},
-  {127430u, {property::type::Ext_Pict}},
-  {127431u, {property::type::Ext_Pict}},
-  {127432u, {property::type::Ext_Pict}},
-  {127433u, {property::type::Ext_Pict}},
-  {127434u, {property::type::Ext_Pict}},
-  {127435u, {property::type::Ext_Pict}},
-  {127436u, {property::type::Ext_Pict}},
-  {127437u, {property::type::Ext_Pict}},
-  {127438u, {property::type::Ext_Pict}},
-  {127439u, {property::type::Ext_Pict}},
-  {127440u, {property::type::Ext_Pict}},
-  {127441u, {property::type::Ext_Pict}},
-  {127442u, {property::type::Ext_Pict}},
-  {127443u, {property::type::Ext_Pict}},
-  {127444u, {property::type::Ext_Pict}},
-  {127445u, {property::type::Ext_Pict}},
-  {127446u, {property::type::Ext_Pict}},
-  {127447u, {property::type::Ext_Pict}},
-  {127448u, {property::type::Ext_Pict}},
-  {127449u, {property::type::Ext_Pict}},
-  {127450u, {property::type::Ext_Pict}},
-  {127451u, {property::type::Ext_Pict}},
-  {127452u, {property::type::Ext_Pict}},
-  {127453u, {property::type::Ext_Pict}},
-  {127454u, {property::type::Ext_Pict}},
-  {127455u, {property::type::Ext_Pict}},
-  {127456u, {property::type::Ext_Pict}},
-  {127457u, {property::type::Ext_Pict}},
-  {127458u, {property::type::Ext_Pict}},
-  {127459u, {property::type::Ext_Pict}},
-  {127460u, {property::type::Ext_Pict}},
-  {127461u, {property::type::Ext_Pict}},
-  {127491u, {property::type::Ext_Pict}},
-  {127492u, {property::type::Ext_Pict}},
-  {127493u, {property::type::Ext_Pict}},
-  {127494u, {property::type::Ext_Pict}},
-  {127495u, {property::type::Ext_Pict}},
-  {127496u, {property::type::Ext_Pict}},
-  {127497u, {property::type::Ext_Pict}},
-  {127498u, {property::type::Ext_Pict}},
-  {127499u, {property::type::Ext_Pict}},
-  {127500u, {property::type::Ext_Pict}},
-  {127501u, {property::type::Ext_Pict}},
-  {127502u, {property::type::Ext_Pict}},
-  {127503u, {property::type::Ext_Pict}},
-  {127548u, {property::type::Ext_Pict}},
-  {127549u, {property::type::Ext_Pict}},
-  {127550u, {property::type::Ext_Pict}},
-  {127551u, {property::type::Ext_Pict}},
-  {127561u, {property::type::Ext_Pict}},
-  {127562u, {property::type::Ext_Pict}},
-  {127563u, {property::type::Ext_Pict}},
-  {127564u, {property::type::Ext_Pict}},
-  {127565u, {property::type::Ext_Pict}},
-  {127566u, {property::type::Ext_Pict}},
-  {127567u, {property::type::Ext_Pict}},
-  {127570u, {property::type::Ext_Pict}},
-  {127571u, {property::type::Ext_Pict}},
-  {127572u, {property::type::Ext_Pict}},
-  {127573u, {property::type::Ext_Pict}},
-  {127574u, {property::type::Ext_Pict}},
-  {127575u, {property::type::Ext_Pict}},
-  {127576u, {property::type::Ext_Pict}},
-  {127577u, {property::type::Ext_Pict}},
-  {127578u, {property::type::Ext_Pict}},
-  {127579u, {property::type::Ext_Pict}},
-  {127580u, {property::type::Ext_Pict}},
-  {127581u, {property::type::Ext_Pict}},
-  {127582u, {property::type::Ext_Pict}},
-  {127583u, {property::type::Ext_Pict}},
-  {127584u, {property::type::Ext_Pict}},
-  {127585u, {property::type::Ext_Pict}},
-  {127586u, {property::type::Ext_Pict}},
-  {127587u, {property::type::Ext_Pict}},
-  {127588u, {property::type::Ext_Pict}},
-  {127589u, {property::type::Ext_Pict}},
-  {127590u, {property::type::Ext_Pict}},
-  {127591u, {property::type::Ext_Pict}},
-  {127592u, {property::type::Ext_Pict}},
-  {127593u, {property::type::Ext_Pict}},
-  {127594u, {property::type::Ext_Pict}},
-  {127595u, {property::type::Ext_Pict}},
-  {127596u, {property::type::Ext_Pict}},
-  {127597u, {property::type::Ext_Pict}},
-  {127598u, {property::type::Ext_Pict}},
-  {127599u, {property::type::Ext_Pict}},
-  {127600u, {property::type::Ext_Pict}},
-  {127601u, {property::type::Ext_Pict}},
-  {127602u, {property::type::Ext_Pict}},
-  {127603u, {property::type::Ext_Pict}},
-  {127604u, {property::type::Ext_Pict}},
-  {127605u, {property::type::Ext_Pict}},
-  {127606u, {property::type::Ext_Pict}},
-  {127607u, {property::type::Ext_Pict}},
-  {127608u, {property::type::Ext_Pict}},
-  {127609u, {property::type::Ext_Pict}},
-  {127610u, {property::type::Ext_Pict}},
-  {127611u, {property::type::Ext_Pict}},
-  {127612u, {property::type::Ext_Pict}},
-  {127613u, {property::type::Ext_Pict}},
-  {127614u, {property::type::Ext_Pict}},
-  {127615u, {property::type::Ext_Pict}},
-  {127616u, {property::type::Ext_Pict}},
-  {127617u, {property::type::Ext_Pict}},
-  {127618u, {property::type::Ext_Pict}},
-  {127619u, {property::type::Ext_Pict}},
-  {127620u, {property::type::Ext_Pict}},
-  {127621u, {property::type::Ext_Pict}},
-  {127622u, {property::type::Ext_Pict}},
-  {127623u, {property::type::Ext_Pict}},
-  {127624u, {property::type::Ext_Pict}},
-  {127625u, {property::type::Ext_Pict}},
-  {127626u, {property::type::Ext_Pict}},
-  {127627u, {property::type::Ext_Pict}},
-  {127628u, {property::type::Ext_Pict}},
-  {127629u, {property::type::Ext_Pict}},
-  {127630u, {property::type::Ext_Pict}},
-  {127631u, {property::type::Ext_Pict}},
-  {127632u, {property::type::Ext_Pict}},
-  {127633u, {property::type::Ext_Pict}},
-  {127634u, {property::type::Ext_Pict}},
-  {127635u, {property::type::Ext_Pict}},
-  {127636u, {property::type::Ext_Pict}},
-  {127637u, {property::type::Ext_Pict}},
-  {127638u, {property::type::Ext_Pict}},
-  {127639u, {property::type::Ext_Pict}},
-  {127640u, {property::type::Ext_Pict}},
-  {127641u, {property::type::Ext_Pict}},
-  {127642u, {property::type::Ext_Pict}},
-  {127643u, {property::type::Ext_Pict}},
-  {127644u, {property::type::Ext_Pict}},
-  {127645u, {property::type::Ext_Pict}},
-  {127646u, {property::type::Ext_Pict}},
-  {127647u, {property::type::Ext_Pict}},
-  {127648u, {property::type::Ext_Pict}},
-  {127649u, {property::type::Ext_Pict}},
-  {127650u, {property::type::Ext_Pict}},
-  {127651u, {property::type::Ext_Pict}},
-  {127652u, {property::type::Ext_Pict}},
-  {127653u, {property::type::Ext_Pict}},
-  {127654u, {property::type::Ext_Pict}},
-  {127655u, {property::type::Ext_Pict}},
-  {127656u, {property::type::Ext_Pict}},
-  {127657u, {property::type::Ext_Pict}},
-  {127658u, {property::type::Ext_Pict}},
-  {127659u, {property::type::Ext_Pict}},
-  {127660u, {property::type::Ext_Pict}},
-  {127661u, {property::type::Ext_Pict}},
-  {127662u, {property::type::Ext_Pict}},
-  {127663u, {property::type::Ext_Pict}},
-  {127664u, {property::type::Ext_Pict}},
-  {127665u, {property::type::Ext_Pict}},
-  {127666u, {property::type::Ext_Pict}},
-  {127667u, {property::type::Ext_Pict}},
-  {127668u, {property::type::Ext_Pict}},
-  {127669u, {property::type::Ext_Pict}},
-  {127670u, {property::type::Ext_Pict}},
-  {127671u, {property::type::Ext_Pict}},
-  {127672u, {property::type::Ext_Pict}},
-  {127673u, {property::type::Ext_Pict}},
-  {127674u, {property::type::Ext_Pict}},
-  {127675u, {property::type::Ext_Pict}},
-  {127676u, {property::type::Ext_Pict}},
-  {127677u, {property::type::Ext_Pict}},
-  {127678u, {property::type::Ext_Pict}},
-  {127679u, {property::type::Ext_Pict}},
-  {127680u, {property::type::Ext_Pict}},
-  {127681u, {property::type::Ext_Pict}},
-  {127682u, {property::type::Ext_Pict}},
-  {127683u, {property::type::Ext_Pict}},
-  {127684u, {property::type::Ext_Pict}},
-  {127685u, {property::type::Ext_Pict}},
-  {127686u, {property::type::Ext_Pict}},
-  {127687u, {property::type::Ext_Pict}},
-  {127688u, {property::type::Ext_Pict}},
-  {127689u, {property::type::Ext_Pict}},
-  {127690u, {property::type::Ext_Pict}},
-  {127691u, {property::type::Ext_Pict}},
-  {127692u, {property::type::Ext_Pict}},
-  {127693u, {property::type::Ext_Pict}},
-  {127694u, {property::type::Ext_Pict}},
-  {127695u, {property::type::Ext_Pict}},
-  {127696u, {property::type::Ext_Pict}},
-  {127697u, {property::type::Ext_Pict}},
-  {127698u, {property::type::Ext_Pict}},
-  {127699u, {property::type::Ext_Pict}},
-  {127700u, {property::type::Ext_Pict}},
-  {127701u, {property::type::Ext_Pict}},
-  {127702u, {property::type::Ext_Pict}},
-  {127703u, {property::type::Ext_Pict}},
-  {127704u, {property::type::Ext_Pict}},
-  {127705u, {property::type::Ext_Pict}},
-  {127706u, {property::type::Ext_Pict}},
-  {127707u, {property::type::Ext_Pict}},
-  {127708u, {property::type::Ext_Pict}},
-  {127709u, {property::type::Ext_Pict}},
-  {127710u, {property::type::Ext_Pict}},
-  {127711u, {property::type::Ext_Pict}},
-  {127712u, {property::type::Ext_Pict}},
-  {127713u, {property::type::Ext_Pict}},
-  {127714u, {property::type::Ext_Pict}},
-  {127715u, {property::type::Ext_Pict}},
-  {127716u, {property::type::Ext_Pict}},
-  {127717u, {property::type::Ext_Pict}},
-  {127718u, {property::type::Ext_Pict}},
-  {127719u, {property::type::Ext_Pict}},
-  {127720u, {property::type::Ext_Pict}},
-  {127721u, {property::type::Ext_Pict}},
-  {127722u, {property::type::Ext_Pict}},
-  {127723u, {property::type::Ext_Pict}},
-  {127724u, {property::type::Ext_Pict}},
-  {127725u, {property::type::Ext_Pict}},
-  {127726u, {property::type::Ext_Pict}},
-  {127727u, {property::type::Ext_Pict}},
-  {127728u, {property::type::Ext_Pict}},
-  {127729u, {property::type::Ext_Pict}},
-  {127730u, {property::type::Ext_Pict}},
-  {127731u, {property::type::Ext_Pict}},
-  {127732u, {property::type::Ext_Pict}},
-  {127733u, {property::type::Ext_Pict}},
-  {127734u, {property::type::Ext_Pict}},
-  {127735u, {property::type::Ext_Pict}},
-  {127736u, {property::type::Ext_Pict}},
-  {127737u, {property::type::Ext_Pict}},
-  {127738u, {property::type::Ext_Pict}},
-  {127739u, {property::type::Ext_Pict}},
-  {127740u, {property::type::Ext_Pict}},
-  {127741u, {property::type::Ext_Pict}},
-  {127742u, {property::type::Ext_Pict}},
-  {127743u, {property::type::Ext_Pict}},
-  {127778u, {property::type::Ext_Pict}},
-  {127779u, {property::type::Ext_Pict}},
-  {127892u, {property::type::Ext_Pict}},
-  {127893u, {property::type::Ext_Pict}},
-  {127896u, {property::type::Ext_Pict}},
-  {127900u, {property::type::Ext_Pict}},
-  {127901u, {property::type::Ext_Pict}},
-  {127985u, {property::type::Ext_Pict}},
-  {127986u, {property::type::Ext_Pict}},
-  {127990u, {property::type::Ext_Pict}},
-  {128254u, {property::type::Ext_Pict}},
-  {128326u, {property::type::Ext_Pict}},
-  {128327u, {property::type::Ext_Pict}},
-  {128328u, {property::type::Ext_Pict}},
-  {128335u, {property::type::Ext_Pict}},
-  {128360u, {property::type::Ext_Pict}},
-  {128361u, {property::type::Ext_Pict}},
-  {128362u, {property::type::Ext_Pict}},
-  {128363u, {property::type::Ext_Pict}},
-  {128364u, {property::type::Ext_Pict}},
-  {128365u, {property::type::Ext_Pict}},
-  {128366u, {property::type::Ext_Pict}},
-  {128369u, {property::type::Ext_Pict}},
-  {128370u, {property::type::Ext_Pict}},
-  {128379u, {property::type::Ext_Pict}},
-  {128380u, {property::type::Ext_Pict}},
-  {128381u, {property::type::Ext_Pict}},
-  {128382u, {property::type::Ext_Pict}},
-  {128383u, {property::type::Ext_Pict}},
-  {128384u, {property::type::Ext_Pict}},
-  {128385u, {property::type::Ext_Pict}},
-  {128386u, {property::type::Ext_Pict}},
-  {128387u, {property::type::Ext_Pict}},
-  {128388u, {property::type::Ext_Pict}},
-  {128389u, {property::type::Ext_Pict}},
-  {128390u, {property::type::Ext_Pict}},
-  {128392u, {property::type::Ext_Pict}},
-  {128393u, {property::type::Ext_Pict}},
-  {128398u, {property::type::Ext_Pict}},
-  {128399u, {property::type::Ext_Pict}},
-  {128401u, {property::type::Ext_Pict}},
-  {128402u, {property::type::Ext_Pict}},
-  {128403u, {property::type::Ext_Pict}},
-  {128404u, {property::type::Ext_Pict}},
-  {128407u, {property::type::Ext_Pict}},
-  {128408u, {property::type::Ext_Pict}},
-  {128409u, {property::type::Ext_Pict}},
-  {128410u, {property::type::Ext_Pict}},
-  {128411u, {property::type::Ext_Pict}},
-  {128412u, {property::type::Ext_Pict}},
-  {128413u, {property::type::Ext_Pict}},
-  {128414u, {property::type::Ext_Pict}},
-  {128415u, {property::type::Ext_Pict}},
-  {128416u, {property::type::Ext_Pict}},
-  {128417u, {property::type::Ext_Pict}},
-  {128418u, {property::type::Ext_Pict}},
-  {128419u, {property::type::Ext_Pict}},
-  {128422u, {property::type::Ext_Pict}},
-  {128423u, {property::type::Ext_Pict}},
-  {128425u, {property::type::Ext_Pict}},
-  {128426u, {property::type::Ext_Pict}},
-  {128427u, {property::type::Ext_Pict}},
-  {128428u, {property::type::Ext_Pict}},
-  {128429u, {property::type::Ext_Pict}},
-  {128430u, {property::type::Ext_Pict}},
-  {128431u, {property::type::Ext_Pict}},
-  {128432u, {property::type::Ext_Pict}},
-  {128435u, {property::type::Ext_Pict}},
-  {128436u, {property::type::Ext_Pict}},
-  {128437u, {property::type::Ext_Pict}},
-  {128438u, {property::type::Ext_Pict}},
-  {128439u, {property::type::Ext_Pict}},
-  {128440u, {property::type::Ext_Pict}},
-  {128441u, {property::type::Ext_Pict}},
-  {128442u, {property::type::Ext_Pict}},
-  {128443u, {property::type::Ext_Pict}},
-  {128445u, {property::type::Ext_Pict}},
-  {128446u, {property::type::Ext_Pict}},
-  {128447u, {property::type::Ext_Pict}},
-  {128448u, {property::type::Ext_Pict}},
-  {128449u, {property::type::Ext_Pict}},
-  {128453u, {property::type::Ext_Pict}},
-  {128454u, {property::type::Ext_Pict}},
-  {128455u, {property::type::Ext_Pict}},
-  {128456u, {property::type::Ext_Pict}},
-  {128457u, {property::type::Ext_Pict}},
-  {128458u, {property::type::Ext_Pict}},
-  {128459u, {property::type::Ext_Pict}},
-  {128460u, {property::type::Ext_Pict}},
-  {128461u, {property::type::Ext_Pict}},
-  {128462u, {property::type::Ext_Pict}},
-  {128463u, {property::type::Ext_Pict}},
-  {128464u, {property::type::Ext_Pict}},
-  {128468u, {property::type::Ext_Pict}},
-  {128469u, {property::type::Ext_Pict}},
-  {128470u, {property::type::Ext_Pict}},
-  {128471u, {property::type::Ext_Pict}},
-  {128472u, {property::type::Ext_Pict}},
-  {128473u, {property::type::Ext_Pict}},
-  {128474u, {property::type::Ext_Pict}},
-  {128475u, {property::type::Ext_Pict}},
-  {128479u, {property::type::Ext_Pict}},
-  {128480u, {property::type::Ext_Pict}},
-  {128482u, {property::type::Ext_Pict}},
-  {128484u, {property::type::Ext_Pict}},
-  {128485u, {property::type::Ext_Pict}},
-  {128486u, {property::type::Ext_Pict}},
-  {128487u, {property::type::Ext_Pict}},
-  {128489u, {property::type::Ext_Pict}},
-  {128490u, {property::type::Ext_Pict}},
-  {128491u, {property::type::Ext_Pict}},
-  {128492u, {property::type::Ext_Pict}},
-  {128493u, {property::type::Ext_Pict}},
-  {128494u, {property::type::Ext_Pict}},
-  {128496u, {property::type::Ext_Pict}},
-  {128497u, {property::type::Ext_Pict}},
-  {128498u, {property::type::Ext_Pict}},
-  {128500u, {property::type::Ext_Pict}},
-  {128501u, {property::type::Ext_Pict}},
-  {128502u, {property::type::Ext_Pict}},
-  {128503u, {property::type::Ext_Pict}},
-  {128504u, {property::type::Ext_Pict}},
-  {128505u, {property::type::Ext_Pict}},
-  {128710u, {property::type::Ext_Pict}},
-  {128711u, {property::type::Ext_Pict}},
-  {128712u, {property::type::Ext_Pict}},
-  {128713u, {property::type::Ext_Pict}},
-  {128714u, {property::type::Ext_Pict}},
-  {128723u, {property::type::Ext_Pict}},
-  {128724u, {property::type::Ext_Pict}},
-  {128728u, {property::type::Ext_Pict}},
-  {128729u, {property::type::Ext_Pict}},
-  {128730u, {property::type::Ext_Pict}},
-  {128731u, {property::type::Ext_Pict}},
-  {128742u, {property::type::Ext_Pict}},
-  {128743u, {property::type::Ext_Pict}},
-  {128744u, {property::type::Ext_Pict}},
-  {128746u, {property::type::Ext_Pict}},
-  {128749u, {property::type::Ext_Pict}},
-  {128750u, {property::type::Ext_Pict}},
-  {128751u, {property::type::Ext_Pict}},
-  {128753u, {property::type::Ext_Pict}},
-  {128754u, {property::type::Ext_Pict}},
-  {128765u, {property::type::Ext_Pict}},
-  {128766u, {property::type::Ext_Pict}},
-  {128767u, {property::type::Ext_Pict}},
-  {128884u, {property::type::Ext_Pict}},
-  {128885u, {property::type::Ext_Pict}},
-  {128886u, {property::type::Ext_Pict}},
-  {128887u, {property::type::Ext_Pict}},
-  {128888u, {property::type::Ext_Pict}},
-  {128889u, {property::type::Ext_Pict}},
-  {128890u, {property::type::Ext_Pict}},
-  {128891u, {property::type::Ext_Pict}},
-  {128892u, {property::type::Ext_Pict}},
-  {128893u, {property::type::Ext_Pict}},
-  {128894u, {property::type::Ext_Pict}},
-  {128895u, {property::type::Ext_Pict}},
-  {128981u, {property::type::Ext_Pict}},
-  {128982u, {property::type::Ext_Pict}},
-  {128983u, {property::type::Ext_Pict}},
-  {128984u, {property::type::Ext_Pict}},
-  {128985u, {property::type::Ext_Pict}},
-  {128986u, {property::type::Ext_Pict}},
-  {128987u, {property::type::Ext_Pict}},
-  {128988u, {property::type::Ext_Pict}},
-  {128989u, {property::type::Ext_Pict}},
-  {128990u, {property::type::Ext_Pict}},
-  {128991u, {property::type::Ext_Pict}},
-  {129004u, {property::type::Ext_Pict}},
-  {129005u, {property::type::Ext_Pict}},
-  {129006u, {property::type::Ext_Pict}},
-  {129007u, {property::type::Ext_Pict}},
-  {129009u, {property::type::Ext_Pict}},
-  {129010u, {property::type::Ext_Pict}},
-  {129011u, {property::type::Ext_Pict}},
-  {129012u, {property::type::Ext_Pict}},
-  {129013u, {property::type::Ext_Pict}},
-  {129014u, {property::type::Ext_Pict}},
-  {129015u, {property::type::Ext_Pict}},
-  {129016u, {property::type::Ext_Pict}},
-  {129017u, {property::type::Ext_Pict}},
-  {129018u, {property::type::Ext_Pict}},
-  {129019u, {property::type::Ext_Pict}},
-  {129020u, {property::type::Ext_Pict}},
-  {129021u, {property::type::Ext_Pict}},
-  {129022u, {property::type::Ext_Pict}},
-  {129023u, {property::type::Ext_Pict}},
-  {129036u, {property::type::Ext_Pict}},
-  {129037u, {property::type::Ext_Pict}},
-  {129038u, {property::type::Ext_Pict}},
-  {129039u, {property::type::Ext_Pict}},
-  {129096u, {property::type::Ext_Pict}},
-  {129097u, {property::type::Ext_Pict}},
-  {129098u, {property::type::Ext_Pict}},
-  {129099u, {property::type::Ext_Pict}},
-  {129100u, {property::type::Ext_Pict}},
-  {129101u, {property::type::Ext_Pict}},
-  {129102u, {property::type::Ext_Pict}},
-  {129103u, {property::type::Ext_Pict}},
-  {129114u, {property::type::Ext_Pict}},
-  {129115u, {property::type::Ext_Pict}},
-  {129116u, {property::type::Ext_Pict}},
-  {129117u, {property::type::Ext_Pict}},
-  {129118u, {property::type::Ext_Pict}},
-  {129119u, {property::type::Ext_Pict}},
-  {129160u, {property::type::Ext_Pict}},
-  {129161u, {property::type::Ext_Pict}},
-  {129162u, {property::type::Ext_Pict}},
-  {129163u, {property::type::Ext_Pict}},
-  {129164u, {property::type::Ext_Pict}},
-  {129165u, {property::type::Ext_Pict}},
-  {129166u, {property::type::Ext_Pict}},
-  {129167u, {property::type::Ext_Pict}},
-  {129198u, {property::type::Ext_Pict}},
-  {129199u, {property::type::Ext_Pict}},
-  {129200u, {property::type::Ext_Pict}},
-  {129201u, {property::type::Ext_Pict}},
-  {129202u, {property::type::Ext_Pict}},
-  {129203u, {property::type::Ext_Pict}},
-  {129204u, {property::type::Ext_Pict}},
-  {129205u, {property::type::Ext_Pict}},
-  {129206u, {property::type::Ext_Pict}},
-  {129207u, {property::type::Ext_Pict}},
-  {129208u, {property::type::Ext_Pict}},
-  {129209u, {property::type::Ext_Pict}},
-  {129210u, {property::type::Ext_Pict}},
-  {129211u, {property::type::Ext_Pict}},
-  {129212u, {property::type::Ext_Pict}},
-  {129213u, {property::type::Ext_Pict}},
-  {129214u, {property::type::Ext_Pict}},
-  {129215u, {property::type::Ext_Pict}},
-  {129216u, {property::type::Ext_Pict}},
-  {129217u, {property::type::Ext_Pict}},
-  {129218u, {property::type::Ext_Pict}},
-  {129219u, {property::type::Ext_Pict}},
-  {129220u, {property::type::Ext_Pict}},
-  {129221u, {property::type::Ext_Pict}},
-  {129222u, {property::type::Ext_Pict}},
-  {129223u, {property::type::Ext_Pict}},
-  {129224u, {property::type::Ext_Pict}},
-  {129225u, {property::type::Ext_Pict}},
-  {129226u, {property::type::Ext_Pict}},
-  {129227u, {property::type::Ext_Pict}},
-  {129228u, {property::type::Ext_Pict}},
-  {129229u, {property::type::Ext_Pict}},
-  {129230u, {property::type::Ext_Pict}},
-  {129231u, {property::type::Ext_Pict}},
-  {129232u, {property::type::Ext_Pict}},
-  {129233u, {property::type::Ext_Pict}},
-  {129234u, {property::type::Ext_Pict}},
-  {129235u, {property::type::Ext_Pict}},
-  {129236u, {property::type::Ext_Pict}},
-  {129237u, {property::type::Ext_Pict}},
-  {129238u, {property::type::Ext_Pict}},
-  {129239u, {property::type::Ext_Pict}},
-  {129240u, {property::type::Ext_Pict}},
-  {129241u, {property::type::Ext_Pict}},
-  {129242u, {property::type::Ext_Pict}},
-  {129243u, {property::type::Ext_Pict}},
-  {129244u, {property::type::Ext_Pict}},
-  {129245u, {property::type::Ext_Pict}},
-  {129246u, {property::type::Ext_Pict}},
-  {129247u, {property::type::Ext_Pict}},
-  {129248u, {property::type::Ext_Pict}},
-  {129249u, {property::type::Ext_Pict}},
-  {129250u, {property::type::Ext_Pict}},
-  {129251u, {property::type::Ext_Pict}},
-  {129252u, {property::type::Ext_Pict}},
-  {129253u, {property::type::Ext_Pict}},
-  {129254u, {property::type::Ext_Pict}},
-  {129255u, {property::type::Ext_Pict}},
-  {129256u, {property::type::Ext_Pict}},
-  {129257u, {property::type::Ext_Pict}},
-  {129258u, {property::type::Ext_Pict}},
-  {129259u, {property::type::Ext_Pict}},
-  {129260u, {property::type::Ext_Pict}},
-  {129261u, {property::type::Ext_Pict}},
-  {129262u, {property::type::Ext_Pict}},
-  {129263u, {property::type::Ext_Pict}},
-  {129264u, {property::type::Ext_Pict}},
-  {129265u, {property::type::Ext_Pict}},
-  {129266u, {property::type::Ext_Pict}},
-  {129267u, {property::type::Ext_Pict}},
-  {129268u, {property::type::Ext_Pict}},
-  {129269u, {property::type::Ext_Pict}},
-  {129270u, {property::type::Ext_Pict}},
-  {129271u, {property::type::Ext_Pict}},
-  {129272u, {property::type::Ext_Pict}},
-  {129273u, {property::type::Ext_Pict}},
-  {129274u, {property::type::Ext_Pict}},
-  {129275u, {property::type::Ext_Pict}},
-  {129276u, {property::type::Ext_Pict}},
-  {129277u, {property::type::Ext_Pict}},
-  {129278u, {property::type::Ext_Pict}},
-  {129279u, {property::type::Ext_Pict}},
-  {129536u, {property::type::Ext_Pict}},
-  {129537u, {property::type::Ext_Pict}},
-  {129538u, {property::type::Ext_Pict}},
-  {129539u, {property::type::Ext_Pict}},
-  {129540u, {property::type::Ext_Pict}},
-  {129541u, {property::type::Ext_Pict}},
-  {129542u, {property::type::Ext_Pict}},
-  {129543u, {property::type::Ext_Pict}},
-  {129544u, {property::type::Ext_Pict}},
-  {129545u, {property::type::Ext_Pict}},
-  {129546u, {property::type::Ext_Pict}},
-  {129547u, {property::type::Ext_Pict}},
-  {129548u, {property::type::Ext_Pict}},
-  {129549u, {property::type::Ext_Pict}},
-  {129550u, {property::type::Ext_Pict}},
-  {129551u, {property::type::Ext_Pict}},
-  {129552u, {property::type::Ext_Pict}},
-  {129553u, {property::type::Ext_Pict}},
-  {129554u, {property::type::Ext_Pict}},
-  {129555u, {property::type::Ext_Pict}},
-  {129556u, {property::type::Ext_Pict}},
-  {129557u, {property::type::Ext_Pict}},
-  {129558u, {property::type::Ext_Pict}},
-  {129559u, {property::type::Ext_Pict}},
-  {129560u, {property::type::Ext_Pict}},
-  {129561u, {property::type::Ext_Pict}},
-  {129562u, {property::type::Ext_Pict}},
-  {129563u, {property::type::Ext_Pict}},
-  {129564u, {property::type::Ext_Pict}},
-  {129565u, {property::type::Ext_Pict}},
-  {129566u, {property::type::Ext_Pict}},
-  {129567u, {property::type::Ext_Pict}},
-  {129568u, {property::type::Ext_Pict}},
-  {129569u, {property::type::Ext_Pict}},
-  {129570u, {property::type::Ext_Pict}},
-  {129571u, {property::type::Ext_Pict}},
-  {129572u, {property::type::Ext_Pict}},
-  {129573u, {property::type::Ext_Pict}},
-  {129574u, {property::type::Ext_Pict}},
-  {129575u, {property::type::Ext_Pict}},
-  {129576u, {property::type::Ext_Pict}},
-  {129577u, {property::type::Ext_Pict}},
-  {129578u, {property::type::Ext_Pict}},
-  {129579u, {property::type::Ext_Pict}},
-  {129580u, {property::type::Ext_Pict}},
-  {129581u, {property::type::Ext_Pict}},
-  {129582u, {property::type::Ext_Pict}},
-  {129583u, {property::type::Ext_Pict}},
-  {129584u, {property::type::Ext_Pict}},
-  {129585u, {property::type::Ext_Pict}},
-  {129586u, {property::type::Ext_Pict}},
-  {129587u, {property::type::Ext_Pict}},
-  {129588u, {property::type::Ext_Pict}},
-  {129589u, {property::type::Ext_Pict}},
-  {129590u, {property::type::Ext_Pict}},
-  {129591u, {property::type::Ext_Pict}},
-  {129592u, {property::type::Ext_Pict}},
-  {129593u, {property::type::Ext_Pict}},
-  {129594u, {property::type::Ext_Pict}},
-  {129595u, {property::type::Ext_Pict}},
-  {129596u, {property::type::Ext_Pict}},
-  {129597u, {property::type::Ext_Pict}},
-  {129598u, {property::type::Ext_Pict}},
-  {129599u, {property::type::Ext_Pict}},
-  {129600u, {property::type::Ext_Pict}},
-  {129601u, {property::type::Ext_Pict}},
-  {129602u, {property::type::Ext_Pict}},
-  {129603u, {property::type::Ext_Pict}},
-  {129604u, {property::type::Ext_Pict}},
-  {129605u, {property::type::Ext_Pict}},
-  {129606u, {property::type::Ext_Pict}},
-  {129607u, {property::type::Ext_Pict}},
-  {129608u, {property::type::Ext_Pict}},
-  {129609u, {property::type::Ext_Pict}},
-  {129610u, {property::type::Ext_Pict}},
-  {129611u, {property::type::Ext_Pict}},
-  {129612u, {property::type::Ext_Pict}},
-  {129613u, {property::type::Ext_Pict}},
-  {129614u, {property::type::Ext_Pict}},
-  {129615u, {property::type::Ext_Pict}},
-  {129616u, {property::type::Ext_Pict}},
-  {129617u, {property::type::Ext_Pict}},
-  {129618u, {property::type::Ext_Pict}},
-  {129619u, {property::type::Ext_Pict}},
-  {129620u, {property::type::Ext_Pict}},
-  {129621u, {property::type::Ext_Pict}},
-  {129622u, {property::type::Ext_Pict}},
-  {129623u, {property::type::Ext_Pict}},
-  {129624u, {property::type::Ext_Pict}},
-  {129625u, {property::type::Ext_Pict}},
-  {129626u, {property::type::Ext_Pict}},
-  {129627u, {property::type::Ext_Pict}},
-  {129628u, {property::type::Ext_Pict}},
-  {129629u, {property::type::Ext_Pict}},
-  {129630u, {property::type::Ext_Pict}},
-  {129631u, {property::type::Ext_Pict}},
-  {129632u, {property::type::Ext_Pict}},
-  {129633u, {property::type::Ext_Pict}},
-  {129634u, {property::type::Ext_Pict}},
-  {129635u, {property::type::Ext_Pict}},
-  {129636u, {property::type::Ext_Pict}},
-  {129637u, {property::type::Ext_Pict}},
-  {129638u, {property::type::Ext_Pict}},
-  {129639u, {property::type::Ext_Pict}},
-  {129640u, {property::type::Ext_Pict}},
-  {129641u, {property::type::Ext_Pict}},
-  {129642u, {property::type::Ext_Pict}},
-  {129643u, {property::type::Ext_Pict}},
-  {129644u, {property::type::Ext_Pict}},
-  {129645u, {property::type::Ext_Pict}},
-  {129646u, {property::type::Ext_Pict}},
-  {129647u, {property::type::Ext_Pict}},
-  {129661u, {property::type::Ext_Pict}},
-  {129662u, {property::type::Ext_Pict}},
-  {129663u, {property::type::Ext_Pict}},
-  {129673u, {property::type::Ext_Pict}},
-  {129674u, {property::type::Ext_Pict}},
-  {129675u, {property::type::Ext_Pict}},
-  {129676u, {property::type::Ext_Pict}},
-  {129677u, {property::type::Ext_Pict}},
-  {129678u, {property::type::Ext_Pict}},
-  {129679u, {property::type::Ext_Pict}},
-  {129726u, {property::type::Ext_Pict}},
-  {129734u, {property::type::Ext_Pict}},
-  {129735u, {property::type::Ext_Pict}},
-  {129736u, {property::type::Ext_Pict}},
-  {129737u, {property::type::Ext_Pict}},
-  {129738u, {property::type::Ext_Pict}},
-  {129739u, {property::type::Ext_Pict}},
-  {129740u, {property::type::Ext_Pict}},
-  {129741u, {property::type::Ext_Pict}},
-  {129756u, {property::type::Ext_Pict}},
-  {129757u, {property::type::Ext_Pict}},
-  {129758u, {property::type::Ext_Pict}},
-  {129759u, {property::type::Ext_Pict}},
-  {129769u, {property::type::Ext_Pict}},
-  {129770u, {property::type::Ext_Pict}},
-  {129771u, {property::type::Ext_Pict}},
-  {129772u, {property::type::Ext_Pict}},
-  {129773u, {property::type::Ext_Pict}},
-  {129774u, {property::type::Ext_Pict}},
-  {129775u, {property::type::Ext_Pict}},
-  {129785u, {property::type::Ext_Pict}},
-  {129786u, {property::type::Ext_Pict}},
-  {129787u, {property::type::Ext_Pict}},
-  {129788u, {property::type::Ext_Pict}},
-  {129789u, {property::type::Ext_Pict}},
-  {129790u, {property::type::Ext_Pict}},
-  {129791u, {property::type::Ext_Pict}},
-  {130048u, {property::type::Ext_Pict}},
-  {130049u, {property::type::Ext_Pict}},
-  {130050u, {property::type::Ext_Pict}},
-  {130051u, {property::type::Ext_Pict}},
-  {130052u, {property::type::Ext_Pict}},
-  {130053u, {property::type::Ext_Pict}},
-  {130054u, {property::type::Ext_Pict}},
-  {130055u, {property::type::Ext_Pict}},
-  {130056u, {property::type::Ext_Pict}},
-  {130057u, {property::type::Ext_Pict}},
-  {130058u, {property::type::Ext_Pict}},
-  {130059u, {property::type::Ext_Pict}},
-  {130060u, {property::type::Ext_Pict}},
-  {130061u, {property::type::Ext_Pict}},
-  {130062u, {property::type::Ext_Pict}},
-  {130063u, {property::type::Ext_Pict}},
-  {130064u, {property::type::Ext_Pict}},
-  {130065u, {property::type::Ext_Pict}},
-  {130066u, {property::type::Ext_Pict}},
-  {130067u, {property::type::Ext_Pict}},
-  {130068u, {property::type::Ext_Pict}},
-  {130069u, {property::type::Ext_Pict}},
-  {130070u, {property::type::Ext_Pict}},
-  {130071u, {property::type::Ext_Pict}},
-  {130072u, {property::type::Ext_Pict}},
-  {130073u, {property::type::Ext_Pict}},
-  {130074u, {property::type::Ext_Pict}},
-  {130075u, {property::type::Ext_Pict}},
-  {130076u, {property::type::Ext_Pict}},
-  {130077u, {property::type::Ext_Pict}},
-  {130078u, {property::type::Ext_Pict}},
-  {130079u, {property::type::Ext_Pict}},
-  {130080u, {property::type::Ext_Pict}},
-  {130081u, {property::type::Ext_Pict}},
-  {130082u, {property::type::Ext_Pict}},
-  {130083u, {property::type::Ext_Pict}},
-  {130084u, {property::type::Ext_Pict}},
-  {130085u, {property::type::Ext_Pict}},
-  {130086u, {property::type::Ext_Pict}},
-  {130087u, {property::type::Ext_Pict}},
-  {130088u, {property::type::Ext_Pict}},
-  {130089u, {property::type::Ext_Pict}},
-  {130090u, {property::type::Ext_Pict}},
-  {130091u, {property::type::Ext_Pict}},
-  {130092u, {property::type::Ext_Pict}},
-  {130093u, {property::type::Ext_Pict}},
-  {130094u, {property::type::Ext_Pict}},
-  {130095u, {property::type::Ext_Pict}},
-  {130096u, {property::type::Ext_Pict}},
-  {130097u, {property::type::Ext_Pict}},
-  {130098u, {property::type::Ext_Pict}},
-  {130099u, {property::type::Ext_Pict}},
-  {130100u, {property::type::Ext_Pict}},
-  {130101u, {property::type::Ext_Pict}},
-  {130102u, {property::type::Ext_Pict}},
-  {130103u, {property::type::Ext_Pict}},
-  {130104u, {property::type::Ext_Pict}},
-  {130105u, {property::type::Ext_Pict}},
-  {130106u, {property::type::Ext_Pict}},
-  {130107u, {property::type::Ext_Pict}},
-  {130108u, {property::type::Ext_Pict}},
-  {130109u, {property::type::Ext_Pict}},
-  {130110u, {property::type::Ext_Pict}},
-  {130111u, {property::type::Ext_Pict}},
-  {130112u, {property::type::Ext_Pict}},
-  {130113u, {property::type::Ext_Pict}},
-  {130114u, {property::type::Ext_Pict}},
-  {130115u, {property::type::Ext_Pict}},
-  {130116u, {property::type::Ext_Pict}},
-  {130117u, {property::type::Ext_Pict}},
-  {130118u, {property::type::Ext_Pict}},
-  {130119u, {property::type::Ext_Pict}},
-  {130120u, {property::type::Ext_Pict}},
-  {130121u, {property::type::Ext_Pict}},
-  {130122u, {property::type::Ext_Pict}},
-  {130123u, {property::type::Ext_Pict}},
-  {130124u, {property::type::Ext_Pict}},
-  {130125u, {property::type::Ext_Pict}},
-  {130126u, {property::type::Ext_Pict}},
-  {130127u, {property::type::Ext_Pict}},
-  {130128u, {property::type::Ext_Pict}},
-  {130129u, {property::type::Ext_Pict}},
-  {130130u, {property::type::Ext_Pict}},
-  {130131u, {property::type::Ext_Pict}},
-  {130132u, {property::type::Ext_Pict}},
-  {130133u, {property::type::Ext_Pict}},
-  {130134u, {property::type::Ext_Pict}},
-  {130135u, {property::type::Ext_Pict}},
-  {130136u, {property::type::Ext_Pict}},
-  {130137u, {property::type::Ext_Pict}},
-  {130138u, {property::type::Ext_Pict}},
-  {130139u, {property::type::Ext_Pict}},
-  {130140u, {property::type::Ext_Pict}},
-  {130141u, {property::type::Ext_Pict}},
-  {130142u, {property::type::Ext_Pict}},
-  {130143u, {property::type::Ext_Pict}},
-  {130144u, {property::type::Ext_Pict}},
-  {130145u, {property::type::Ext_Pict}},
-  {130146u, {property::type::Ext_Pict}},
-  {130147u, {property::type::Ext_Pict}},
-  {130148u, {property::type::Ext_Pict}},
-  {130149u, {property::type::Ext_Pict}},
-  {130150u, {property::type::Ext_Pict}},
-  {130151u, {property::type::Ext_Pict}},
-  {130152u, {property::type::Ext_Pict}},
-  {130153u, {property::type::Ext_Pict}},
-  {130154u, {property::type::Ext_Pict}},
-  {130155u, {property::type::Ext_Pict}},
-  {130156u, {property::type::Ext_Pict}},
-  {130157u, {property::type::Ext_Pict}},
-  {130158u, {property::type::Ext_Pict}},
-  {130159u, {property::type::Ext_Pict}},
-  {130160u, {property::type::Ext_Pict}},
-  {130161u, {property::type::Ext_Pict}},
-  {130162u, {property::type::Ext_Pict}},
-  {130163u, {property::type::Ext_Pict}},
-  {130164u, {property::type::Ext_Pict}},
-  {130165u, {property::type::Ext_Pict}},
-  {130166u, {property::type::Ext_Pict}},
-  {130167u, {property::type::Ext_Pict}},
-  {130168u, {property::type::Ext_Pict}},
-  {130169u, {property::type::Ext_Pict}},
-  {130170u, {property::type::Ext_Pict}},
-  {130171u, {property::type::Ext_Pict}},
-  {130172u, {property::type::Ext_Pict}},
-  {130173u, {property::type::Ext_Pict}},
-  {130174u, {property::type::Ext_Pict}},
-  {130175u, {property::type::Ext_Pict}},
-  {130176u, {property::type::Ext_Pict}},
-  {130177u, {property::type::Ext_Pict}},
-  {130178u, {property::type::Ext_Pict}},
-  {130179u, {property::type::Ext_Pict}},
-  {130180u, {property::type::Ext_Pict}},
-  {130181u, {property::type::Ext_Pict}},
-  {130182u, {property::type::Ext_Pict}},
-  {130183u, {property::type::Ext_Pict}},
-  {130184u, {property::type::Ext_Pict}},
-  {130185u, {property::type::Ext_Pict}},
-  {130186u, {property::type::Ext_Pict}},
-  {130187u, {property::type::Ext_Pict}},
-  {130188u, {property::type::Ext_Pict}},
-  {130189u, {property::type::Ext_Pict}},
-  {130190u, {property::type::Ext_Pict}},
-  {130191u, {property::type::Ext_Pict}},
-  {130192u, {property::type::Ext_Pict}},
-  {130193u, {property::type::Ext_Pict}},
-  {130194u, {property::type::Ext_Pict}},
-  {130195u, {property::type::Ext_Pict}},
-  {130196u, {property::type::Ext_Pict}},
-  {130197u, {property::type::Ext_Pict}},
-  {130198u, {property::type::Ext_Pict}},
-  {130199u, {property::type::Ext_Pict}},
-  {130200u, {property::type::Ext_Pict}},
-  {130201u, {property::type::Ext_Pict}},
-  {130202u, {property::type::Ext_Pict}},
-  {130203u, {property::type::Ext_Pict}},
-  {130204u, {property::type::Ext_Pict}},
-  {130205u, {property::type::Ext_Pict}},
-  {130206u, {property::type::Ext_Pict}},
-  {130207u, {property::type::Ext_Pict}},
-  {130208u, {property::type::Ext_Pict}},
-  {130209u, {property::type::Ext_Pict}},
-  {130210u, {property::type::Ext_Pict}},
-  {130211u, {property::type::Ext_Pict}},
-  {130212u, {property::type::Ext_Pict}},
-  {130213u, {property::type::Ext_Pict}},
-  {130214u, {property::type::Ext_Pict}},
-  {130215u, {property::type::Ext_Pict}},
-  {130216u, {property::type::Ext_Pict}},
-  {130217u, {property::type::Ext_Pict}},
-  {130218u, {property::type::Ext_Pict}},
-  {130219u, {property::type::Ext_Pict}},
-  {130220u, {property::type::Ext_Pict}},
-  {130221u, {property::type::Ext_Pict}},
-  {130222u, {property::type::Ext_Pict}},
-  {130223u, {property::type::Ext_Pict}},
-  {130224u, {property::type::Ext_Pict}},
-  {130225u, {property::type::Ext_Pict}},
-  {130226u, {property::type::Ext_Pict}},
-  {130227u, {property::type::Ext_Pict}},
-  {130228u, {property::type::Ext_Pict}},
-  {130229u, {property::type::Ext_Pict}},
-  {130230u, {property::type::Ext_Pict}},
-  {130231u, {property::type::Ext_Pict}},
-  {130232u, {property::type::Ext_Pict}},
-  {130233u, {property::type::Ext_Pict}},
-  {130234u, {property::type::Ext_Pict}},
-  {130235u, {property::type::Ext_Pict}},
-  {130236u, {property::type::Ext_Pict}},
-  {130237u, {property::type::Ext_Pict}},
-  {130238u, {property::type::Ext_Pict}},
-  {130239u, {property::type::Ext_Pict}},
-  {130240u, {property::type::Ext_Pict}},
-  {130241u, {property::type::Ext_Pict}},
-  {130242u, {property::type::Ext_Pict}},
-  {130243u, {property::type::Ext_Pict}},
-  {130244u, {property::type::Ext_Pict}},
-  {130245u, {property::type::Ext_Pict}},
-  {130246u, {property::type::Ext_Pict}},
-  {130247u, {property::type::Ext_Pict}},
-  {130248u, {property::type::Ext_Pict}},
-  {130249u, {property::type::Ext_Pict}},
-  {130250u, {property::type::Ext_Pict}},
-  {130251u, {property::type::Ext_Pict}},
-  {130252u, {property::type::Ext_Pict}},
-  {130253u, {property::type::Ext_Pict}},
-  {130254u, {property::type::Ext_Pict}},
-  {130255u, {property::type::Ext_Pict}},
-  {130256u, {property::type::Ext_Pict}},
-  {130257u, {property::type::Ext_Pict}},
-  {130258u, {property::type::Ext_Pict}},
-  {130259u, {property::type::Ext_Pict}},
-  {130260u, {property::type::Ext_Pict}},
-  {130261u, {property::type::Ext_Pict}},
-  {130262u, {property::type::Ext_Pict}},
-  {130263u, {property::type::Ext_Pict}},
-  {130264u, {property::type::Ext_Pict}},
-  {130265u, {property::type::Ext_Pict}},
-  {130266u, {property::type::Ext_Pict}},
-  {130267u, {property::type::Ext_Pict}},
-  {130268u, {property::type::Ext_Pict}},
-  {130269u, {property::type::Ext_Pict}},
-  {130270u, {property::type::Ext_Pict}},
-  {130271u, {property::type::Ext_Pict}},
-  {130272u, {property::type::Ext_Pict}},
-  {130273u, {property::type::Ext_Pict}},
-  {130274u, {property::type::Ext_Pict}},
-  {130275u, {property::type::Ext_Pict}},
-  {130276u, {property::type::Ext_Pict}},
-  {130277u, {property::type::Ext_Pict}},
-  {130278u, {property::type::Ext_Pict}},
-  {130279u, {property::type::Ext_Pict}},
-  {130280u, {property::type::Ext_Pict}},
-  {130281u, {property::type::Ext_Pict}},
-  {130282u, {property::type::Ext_Pict}},
-  {130283u, {property::type::Ext_Pict}},
-  {130284u, {property::type::Ext_Pict}},
-  {130285u, {property::type::Ext_Pict}},
-  {130286u, {property::type::Ext_Pict}},
-  {130287u, {property::type::Ext_Pict}},
-  {130288u, {property::type::Ext_Pict}},
-  {130289u, {property::type::Ext_Pict}},
-  {130290u, {property::type::Ext_Pict}},
-  {130291u, {property::type::Ext_Pict}},
-  {130292u, {property::type::Ext_Pict}},
-  {130293u, {property::type::Ext_Pict}},
-  {130294u, {property::type::Ext_Pict}},
-  {130295u, {property::type::Ext_Pict}},
-  {130296u, {property::type::Ext_Pict}},
-  {130297u, {property::type::Ext_Pict}},
-  {130298u, {property::type::Ext_Pict}},
-  {130299u, {property::type::Ext_Pict}},
-  {130300u, {property::type::Ext_Pict}},
-  {130301u, {property::type::Ext_Pict}},
-  {130302u, {property::type::Ext_Pict}},
-  {130303u, {property::type::Ext_Pict}},
-  {130304u, {property::type::Ext_Pict}},
-  {130305u, {property::type::Ext_Pict}},
-  {130306u, {property::type::Ext_Pict}},
-  {130307u, {property::type::Ext_Pict}},
-  {130308u, {property::type::Ext_Pict}},
-  {130309u, {property::type::Ext_Pict}},
-  {130310u, {property::type::Ext_Pict}},
-  {130311u, {property::type::Ext_Pict}},
-  {130312u, {property::type::Ext_Pict}},
-  {130313u, {property::type::Ext_Pict}},
-  {130314u, {property::type::Ext_Pict}},
-  {130315u, {property::type::Ext_Pict}},
-  {130316u, {property::type::Ext_Pict}},
-  {130317u, {property::type::Ext_Pict}},
-  {130318u, {property::type::Ext_Pict}},
-  {130319u, {property::type::Ext_Pict}},
-  {130320u, {property::type::Ext_Pict}},
-  {130321u, {property::type::Ext_Pict}},
-  {130322u, {property::type::Ext_Pict}},
-  {130323u, {property::type::Ext_Pict}},
-  {130324u, {property::type::Ext_Pict}},
-  {130325u, {property::type::Ext_Pict}},
-  {130326u, {property::type::Ext_Pict}},
-  {130327u, {property::type::Ext_Pict}},
-  {130328u, {property::type::Ext_Pict}},
-  {130329u, {property::type::Ext_Pict}},
-  {130330u, {property::type::Ext_Pict}},
-  {130331u, {property::type::Ext_Pict}},
-  {130332u, {property::type::Ext_Pict}},
-  {130333u, {property::type::Ext_Pict}},
-  {130334u, {property::type::Ext_Pict}},
-  {130335u, {property::type::Ext_Pict}},
-  {130336u, {property::type::Ext_Pict}},
-  {130337u, {property::type::Ext_Pict}},
-  {130338u, {property::type::Ext_Pict}},
-  {130339u, {property::type::Ext_Pict}},
-  {130340u, {property::type::Ext_Pict}},
-  {130341u, {property::type::Ext_Pict}},
-  {130342u, {property::type::Ext_Pict}},
-  {130343u, {property::type::Ext_Pict}},
-  {130344u, {property::type::Ext_Pict}},
-  {130345u, {property::type::Ext_Pict}},
-  {130346u, {property::type::Ext_Pict}},
-  {130347u, {property::type::Ext_Pict}},
-  {130348u, {property::type::Ext_Pict}},
-  {130349u, {property::type::Ext_Pict}},
-  {130350u, {property::type::Ext_Pict}},
-  {130351u, {property::type::Ext_Pict}},
-  {130352u, {property::type::Ext_Pict}},
-  {130353u, {property::type::Ext_Pict}},
-  {130354u, {property::type::Ext_Pict}},
-  {130355u, {property::type::Ext_Pict}},
-  {130356u, {property::type::Ext_Pict}},
-  {130357u, {property::type::Ext_Pict}},
-  {130358u, {property::type::Ext_Pict}},
-  {130359u, {property::type::Ext_Pict}},
-  {130360u, {property::type::Ext_Pict}},
-  {130361u, {property::type::Ext_Pict}},
-  {130362u, {property::type::Ext_Pict}},
-  {130363u, {property::type::Ext_Pict}},
-  {130364u, {property::type::Ext_Pict}},
-  {130365u, {property::type::Ext_Pict}},
-  {130366u, {property::type::Ext_Pict}},
-  {130367u, {property::type::Ext_Pict}},
-  {130368u, {property::type::Ext_Pict}},
-  {130369u, {property::type::Ext_Pict}},
-  {130370u, {property::type::Ext_Pict}},
-  {130371u, {property::type::Ext_Pict}},
-  {130372u, {property::type::Ext_Pict}},
-  {130373u, {property::type::Ext_Pict}},
-  {130374u, {property::type::Ext_Pict}},
-  {130375u, {property::type::Ext_Pict}},
-  {130376u, {property::type::Ext_Pict}},
-  {130377u, {property::type::Ext_Pict}},
-  {130378u, {property::type::Ext_Pict}},
-  {130379u, {property::type::Ext_Pict}},
-  {130380u, {property::type::Ext_Pict}},
-  {130381u, {property::type::Ext_Pict}},
-  {130382u, {property::type::Ext_Pict}},
-  {130383u, {property::type::Ext_Pict}},
-  {130384u, {property::type::Ext_Pict}},
-  {130385u, {property::type::Ext_Pict}},
-  {130386u, {property::type::Ext_Pict}},
-  {130387u, {property::type::Ext_Pict}},
-  {130388u, {property::type::Ext_Pict}},
-  {130389u, {property::type::Ext_Pict}},
-  {130390u, {property::type::Ext_Pict}},
-  {130391u, {property::type::Ext_Pict}},
-  {130392u, {property::type::Ext_Pict}},
-  {130393u, {property::type::Ext_Pict}},
-  {130394u, {property::type::Ext_Pict}},
-  {130395u, {property::type::Ext_Pict}},
-  {130396u, {property::type::Ext_Pict}},
-  {130397u, {property::type::Ext_Pict}},
-  {130398u, {property::type::Ext_Pict}},
-  {130399u, {property::type::Ext_Pict}},
-  {130400u, {property::type::Ext_Pict}},
-  {130401u, {property::type::Ext_Pict}},
-  {130402u, {property::type::Ext_Pict}},
-  {130403u, {property::type::Ext_Pict}},
-  {130404u, {property::type::Ext_Pict}},
-  {130405u, {property::type::Ext_Pict}},
-  {130406u, {property::type::Ext_Pict}},
-  {130407u, {property::type::Ext_Pict}},
-  {130408u, {property::type::Ext_Pict}},
-  {130409u, {property::type::Ext_Pict}},
-  {130410u, {property::type::Ext_Pict}},
-  {130411u, {property::type::Ext_Pict}},
-  {130412u, {property::type::Ext_Pict}},
-  {130413u, {property::type::Ext_Pict}},
-  {130414u, {property::type::Ext_Pict}},
-  {130415u, {property::type::Ext_Pict}},
-  {130416u, {property::type::Ext_Pict}},
-  {130417u, {property::type::Ext_Pict}},
-  {130418u, {property::type::Ext_Pict}},
-  {130419u, {property::type::Ext_Pict}},
-  {130420u, {property::type::Ext_Pict}},
-  {130421u, {property::type::Ext_Pict}},
-  {130422u, {property::type::Ext_Pict}},
-  {130423u, {property::type::Ext_Pict}},
-  {130424u, {property::type::Ext_Pict}},
-  {130425u, {property::type::Ext_Pict}},
-  {130426u, {property::type::Ext_Pict}},
-  {130427u, {property::type::Ext_Pict}},
-  {130428u, {property::type::Ext_Pict}},
-  {130429u, {property::type::Ext_Pict}},
-  {130430u, {property::type::Ext_Pict}},
-  {130431u, {property::type::Ext_Pict}},
-  {130432u, {property::type::Ext_Pict}},
-  {130433u, {property::type::Ext_Pict}},
-  {130434u, {property::type::Ext_Pict}},
-  {130435u, {property::type::Ext_Pict}},
-  {130436u, {property::type::Ext_Pict}},
-  {130437u, {property::type::Ext_Pict}},
-  {130438u, {property::type::Ext_Pict}},
-  {130439u, {property::type::Ext_Pict}},
-  {130440u, {property::type::Ext_Pict}},
-  {130441u, {property::type::Ext_Pict}},
-  {130442u, {property::type::Ext_Pict}},
-  {130443u, {property::type::Ext_Pict}},
-  {130444u, {property::type::Ext_Pict}},
-  {130445u, {property::type::Ext_Pict}},
-  {130446u, {property::type::Ext_Pict}},
-  {130447u, {property::type::Ext_Pict}},
-  {130448u, {property::type::Ext_Pict}},
-  {130449u, {property::type::Ext_Pict}},
-  {130450u, {property::type::Ext_Pict}},
-  {130451u, {property::type::Ext_Pict}},
-  {130452u, {property::type::Ext_Pict}},
-  {130453u, {property::type::Ext_Pict}},
-  {130454u, {property::type::Ext_Pict}},
-  {130455u, {property::type::Ext_Pict}},
-  {130456u, {property::type::Ext_Pict}},
-  {130457u, {property::type::Ext_Pict}},
-  {130458u, {property::type::Ext_Pict}},
-  {130459u, {property::type::Ext_Pict}},
-  {130460u, {property::type::Ext_Pict}},
-  {130461u, {property::type::Ext_Pict}},
-  {130462u, {property::type::Ext_Pict}},
-  {130463u, {property::type::Ext_Pict}},
-  {130464u, {property::type::Ext_Pict}},
-  {130465u, {property::type::Ext_Pict}},
-  {130466u, {property::type::Ext_Pict}},
-  {130467u, {property::type::Ext_Pict}},
-  {130468u, {property::type::Ext_Pict}},
-  {130469u, {property::type::Ext_Pict}},
-  {130470u, {property::type::Ext_Pict}},
-  {130471u, {property::type::Ext_Pict}},
-  {130472u, {property::type::Ext_Pict}},
-  {130473u, {property::type::Ext_Pict}},
-  {130474u, {property::type::Ext_Pict}},
-  {130475u, {property::type::Ext_Pict}},
-  {130476u, {property::type::Ext_Pict}},
-  {130477u, {property::type::Ext_Pict}},
-  {130478u, {property::type::Ext_Pict}},
-  {130479u, {property::type::Ext_Pict}},
-  {130480u, {property::type::Ext_Pict}},
-  {130481u, {property::type::Ext_Pict}},
-  {130482u, {property::type::Ext_Pict}},
-  {130483u, {property::type::Ext_Pict}},
-  {130484u, {property::type::Ext_Pict}},
-  {130485u, {property::type::Ext_Pict}},
-  {130486u, {property::type::Ext_Pict}},
-  {130487u, {property::type::Ext_Pict}},
-  {130488u, {property::type::Ext_Pict}},
-  {130489u, {property::type::Ext_Pict}},
-  {130490u, {property::type::Ext_Pict}},
-  {130491u, {property::type::Ext_Pict}},
-  {130492u, {property::type::Ext_Pict}},
-  {130493u, {property::type::Ext_Pict}},
-  {130494u, {property::type::Ext_Pict}},
-  {130495u, {property::type::Ext_Pict}},
-  {130496u, {property::type::Ext_Pict}},
-  {130497u, {property::type::Ext_Pict}},
-  {130498u, {property::type::Ext_Pict}},
-  {130499u, {property::type::Ext_Pict}},
-  {130500u, {property::type::Ext_Pict}},
-  {130501u, {property::type::Ext_Pict}},
-  {130502u, {property::type::Ext_Pict}},
-  {130503u, {property::type::Ext_Pict}},
-  {130504u, {property::type::Ext_Pict}},
-  {130505u, {property::type::Ext_Pict}},
-  {130506u, {property::type::Ext_Pict}},
-  {130507u, {property::type::Ext_Pict}},
-  {130508u, {property::type::Ext_Pict}},
-  {130509u, {property::type::Ext_Pict}},
-  {130510u, {property::type::Ext_Pict}},
-  {130511u, {property::type::Ext_Pict}},
-  {130512u, {property::type::Ext_Pict}},
-  {130513u, {property::type::Ext_Pict}},
-  {130514u, {property::type::Ext_Pict}},
-  {130515u, {property::type::Ext_Pict}},
-  {130516u, {property::type::Ext_Pict}},
-  {130517u, {property::type::Ext_Pict}},
-  {130518u, {property::type::Ext_Pict}},
-  {130519u, {property::type::Ext_Pict}},
-  {130520u, {property::type::Ext_Pict}},
-  {130521u, {property::type::Ext_Pict}},
-  {130522u, {property::type::Ext_Pict}},
-  {130523u, {property::type::Ext_Pict}},
-  {130524u, {property::type::Ext_Pict}},
-  {130525u, {property::type::Ext_Pict}},
-  {130526u, {property::type::Ext_Pict}},
-  {130527u, {property::type::Ext_Pict}},
-  {130528u, {property::type::Ext_Pict}},
-  {130529u, {property::type::Ext_Pict}},
-  {130530u, {property::type::Ext_Pict}},
-  {130531u, {property::type::Ext_Pict}},
-  {130532u, {property::type::Ext_Pict}},
-  {130533u, {property::type::Ext_Pict}},
-  {130534u, {property::type::Ext_Pict}},
-  {130535u, {property::type::Ext_Pict}},
-  {130536u, {property::type::Ext_Pict}},
-  {130537u, {property::type::Ext_Pict}},
-  {130538u, {property::type::Ext_Pict}},
-  {130539u, {property::type::Ext_Pict}},
-  {130540u, {property::type::Ext_Pict}},
-  {130541u, {property::type::Ext_Pict}},
-  {130542u, {property::type::Ext_Pict}},
-  {130543u, {property::type::Ext_Pict}},
-  {130544u, {property::type::Ext_Pict}},
-  {130545u, {property::type::Ext_Pict}},
-  {130546u, {property::type::Ext_Pict}},
-  {130547u, {property::type::Ext_Pict}},
-  {130548u, {property::type::Ext_Pict}},
-  {130549u, {property::type::Ext_Pict}},
-  {130550u, {property::type::Ext_Pict}},
-  {130551u, {property::type::Ext_Pict}},
-  {130552u, {property::type::Ext_Pict}},
-  {130553u, {property::type::Ext_Pict}},
-  {130554u, {property::type::Ext_Pict}},
-  {130555u, {property::type::Ext_Pict}},
-  {130556u, {property::type::Ext_Pict}},
-  {130557u, {property::type::Ext_Pict}},
-  {130558u, {property::type::Ext_Pict}},
-  {130559u, {property::type::Ext_Pict}},
-  {130560u, {property::type::Ext_Pict}},
-  {130561u, {property::type::Ext_Pict}},
-  {130562u, {property::type::Ext_Pict}},
-  {130563u, {property::type::Ext_Pict}},
-  {130564u, {property::type::Ext_Pict}},
-  {130565u, {property::type::Ext_Pict}},
-  {130566u, {property::type::Ext_Pict}},
-  {130567u, {property::type::Ext_Pict}},
-  {130568u, {property::type::Ext_Pict}},
-  {130569u, {property::type::Ext_Pict}},
-  {130570u, {property::type::Ext_Pict}},
-  {130571u, {property::type::Ext_Pict}},
-  {130572u, {property::type::Ext_Pict}},
-  {130573u, {property::type::Ext_Pict}},
-  {130574u, {property::type::Ext_Pict}},
-  {130575u, {property::type::Ext_Pict}},
-  {130576u, {property::type::Ext_Pict}},
-  {130577u, {property::type::Ext_Pict}},
-  {130578u, {property::type::Ext_Pict}},
-  {130579u, {property::type::Ext_Pict}},
-  {130580u, {property::type::Ext_Pict}},
-  {130581u, {property::type::Ext_Pict}},
-  {130582u, {property::type::Ext_Pict}},
-  {130583u, {property::type::Ext_Pict}},
-  {130584u, {property::type::Ext_Pict}},
-  {130585u, {property::type::Ext_Pict}},
-  {130586u, {property::type::Ext_Pict}},
-  {130587u, {property::type::Ext_Pict}},
-  {130588u, {property::type::Ext_Pict}},
-  {130589u, {property::type::Ext_Pict}},
-  {130590u, {property::type::Ext_Pict}},
-  {130591u, {property::type::Ext_Pict}},
-  {130592u, {property::type::Ext_Pict}},
-  {130593u, {property::type::Ext_Pict}},
-  {130594u, {property::type::Ext_Pict}},
-  {130595u, {property::type::Ext_Pict}},
-  {130596u, {property::type::Ext_Pict}},
-  {130597u, {property::type::Ext_Pict}},
-  {130598u, {property::type::Ext_Pict}},
-  {130599u, {property::type::Ext_Pict}},
-  {130600u, {property::type::Ext_Pict}},
-  {130601u, {property::type::Ext_Pict}},
-  {130602u, {property::type::Ext_Pict}},
-  {130603u, {property::type::Ext_Pict}},
-  {130604u, {property::type::Ext_Pict}},
-  {130605u, {property::type::Ext_Pict}},
-  {130606u, {property::type::Ext_Pict}},
-  {130607u, {property::type::Ext_Pict}},
-  {130608u, {property::type::Ext_Pict}},
-  {130609u, {property::type::Ext_Pict}},
-  {130610u, {property::type::Ext_Pict}},
-  {130611u, {property::type::Ext_Pict}},
-  {130612u, {property::type::Ext_Pict}},
-  {130613u, {property::type::Ext_Pict}},
-  {130614u, {property::type::Ext_Pict}},
-  {130615u, {property::type::Ext_Pict}},
-  {130616u, {property::type::Ext_Pict}},
-  {130617u, {property::type::Ext_Pict}},
-  {130618u, {property::type::Ext_Pict}},
-  {130619u, {property::type::Ext_Pict}},
-  {130620u, {property::type::Ext_Pict}},
-  {130621u, {property::type::Ext_Pict}},
-  {130622u, {property::type::Ext_Pict}},
-  {130623u, {property::type::Ext_Pict}},
-  {130624u, {property::type::Ext_Pict}},
-  {130625u, {property::type::Ext_Pict}},
-  {130626u, {property::type::Ext_Pict}},
-  {130627u, {property::type::Ext_Pict}},
-  {130628u, {property::type::Ext_Pict}},
-  {130629u, {property::type::Ext_Pict}},
-  {130630u, {property::type::Ext_Pict}},
-  {130631u, {property::type::Ext_Pict}},
-  {130632u, {property::type::Ext_Pict}},
-  {130633u, {property::type::Ext_Pict}},
-  {130634u, {property::type::Ext_Pict}},
-  {130635u, {property::type::Ext_Pict}},
-  {130636u, {property::type::Ext_Pict}},
-  {130637u, {property::type::Ext_Pict}},
-  {130638u, {property::type::Ext_Pict}},
-  {130639u, {property::type::Ext_Pict}},
-  {130640u, {property::type::Ext_Pict}},
-  {130641u, {property::type::Ext_Pict}},
-  {130642u, {property::type::Ext_Pict}},
-  {130643u, {property::type::Ext_Pict}},
-  {130644u, {property::type::Ext_Pict}},
-  {130645u, {property::type::Ext_Pict}},
-  {130646u, {property::type::Ext_Pict}},
-  {130647u, {property::type::Ext_Pict}},
-  {130648u, {property::type::Ext_Pict}},
-  {130649u, {property::type::Ext_Pict}},
-  {130650u, {property::type::Ext_Pict}},
-  {130651u, {property::type::Ext_Pict}},
-  {130652u, {property::type::Ext_Pict}},
-  {130653u, {property::type::Ext_Pict}},
-  {130654u, {property::type::Ext_Pict}},
-  {130655u, {property::type::Ext_Pict}},
-  {130656u, {property::type::Ext_Pict}},
-  {130657u, {property::type::Ext_Pict}},
-  {130658u, {property::type::Ext_Pict}},
-  {130659u, {property::type::Ext_Pict}},
-  {130660u, {property::type::Ext_Pict}},
-  {130661u, {property::type::Ext_Pict}},
-  {130662u, {property::type::Ext_Pict}},
-  {130663u, {property::type::Ext_Pict}},
-  {130664u, {property::type::Ext_Pict}},
-  {130665u, {property::type::Ext_Pict}},
-  {130666u, {property::type::Ext_Pict}},
-  {130667u, {property::type::Ext_Pict}},
-  {130668u, {property::type::Ext_Pict}},
-  {130669u, {property::type::Ext_Pict}},
-  {130670u, {property::type::Ext_Pict}},
-  {130671u, {property::type::Ext_Pict}},
-  {130672u, {property::type::Ext_Pict}},
-  {130673u, {property::type::Ext_Pict}},
-  {130674u, {property::type::Ext_Pict}},
-  {130675u, {property::type::Ext_Pict}},
-  {130676u, {property::type::Ext_Pict}},
-  {130677u, {property::type::Ext_Pict}},
-  {130678u, {property::type::Ext_Pict}},
-  {130679u, {property::type::Ext_Pict}},
-  {130680u, {property::type::Ext_Pict}},
-  {130681u, {property::type::Ext_Pict}},
-  {130682u, {property::type::Ext_Pict}},
-  {130683u, {property::type::Ext_Pict}},
-  {130684u, {property::type::Ext_Pict}},
-  {130685u, {property::type::Ext_Pict}},
-  {130686u, {property::type::Ext_Pict}},
-  {130687u, {property::type::Ext_Pict}},
-  {130688u, {property::type::Ext_Pict}},
-  {130689u, {property::type::Ext_Pict}},
-  {130690u, {property::type::Ext_Pict}},
-  {130691u, {property::type::Ext_Pict}},
-  {130692u, {property::type::Ext_Pict}},
-  {130693u, {property::type::Ext_Pict}},
-  {130694u, {property::type::Ext_Pict}},
-  {130695u, {property::type::Ext_Pict}},
-  {130696u, {property::type::Ext_Pict}},
-  {130697u, {property::type::Ext_Pict}},
-  {130698u, {property::type::Ext_Pict}},
-  {130699u, {property::type::Ext_Pict}},
-  {130700u, {property::type::Ext_Pict}},
-  {130701u, {property::type::Ext_Pict}},
-  {130702u, {property::type::Ext_Pict}},
-  {130703u, {property::type::Ext_Pict}},
-  {130704u, {property::type::Ext_Pict}},
-  {130705u, {property::type::Ext_Pict}},
-  {130706u, {property::type::Ext_Pict}},
-  {130707u, {property::type::Ext_Pict}},
-  {130708u, {property::type::Ext_Pict}},
-  {130709u, {property::type::Ext_Pict}},
-  {130710u, {property::type::Ext_Pict}},
-  {130711u, {property::type::Ext_Pict}},
-  {130712u, {property::type::Ext_Pict}},
-  {130713u, {property::type::Ext_Pict}},
-  {130714u, {property::type::Ext_Pict}},
-  {130715u, {property::type::Ext_Pict}},
-  {130716u, {property::type::Ext_Pict}},
-  {130717u, {property::type::Ext_Pict}},
-  {130718u, {property::type::Ext_Pict}},
-  {130719u, {property::type::Ext_Pict}},
-  {130720u, {property::type::Ext_Pict}},
-  {130721u, {property::type::Ext_Pict}},
-  {130722u, {property::type::Ext_Pict}},
-  {130723u, {property::type::Ext_Pict}},
-  {130724u, {property::type::Ext_Pict}},
-  {130725u, {property::type::Ext_Pict}},
-  {130726u, {property::type::Ext_Pict}},
-  {130727u, {property::type::Ext_Pict}},
-  {130728u, {property::type::Ext_Pict}},
-  {130729u, {property::type::Ext_Pict}},
-  {130730u, {property::type::Ext_Pict}},
-  {130731u, {property::type::Ext_Pict}},
-  {130732u, {property::type::Ext_Pict}},
-  {130733u, {property::type::Ext_Pict}},
-  {130734u, {property::type::Ext_Pict}},
-  {130735u, {property::type::Ext_Pict}},
-  {130736u, {property::type::Ext_Pict}},
-  {130737u, {property::type::Ext_Pict}},
-  {130738u, {property::type::Ext_Pict}},
-  {130739u, {property::type::Ext_Pict}},
-  {130740u, {property::type::Ext_Pict}},
-  {130741u, {property::type::Ext_Pict}},
-  {130742u, {property::type::Ext_Pict}},
-  {130743u, {property::type::Ext_Pict}},
-  {130744u, {property::type::Ext_Pict}},
-  {130745u, {property::type::Ext_Pict}},
-  {130746u, {property::type::Ext_Pict}},
-  {130747u, {property::type::Ext_Pict}},
-  {130748u, {property::type::Ext_Pict}},
-  {130749u, {property::type::Ext_Pict}},
-  {130750u, {property::type::Ext_Pict}},
-  {130751u, {property::type::Ext_Pict}},
-  {130752u, {property::type::Ext_Pict}},
-  {130753u, {property::type::Ext_Pict}},
-  {130754u, {property::type::Ext_Pict}},
-  {130755u, {property::type::Ext_Pict}},
-  {130756u, {property::type::Ext_Pict}},
-  {130757u, {property::type::Ext_Pict}},
-  {130758u, {property::type::Ext_Pict}},
-  {130759u, {property::type::Ext_Pict}},
-  {130760u, {property::type::Ext_Pict}},
-  {130761u, {property::type::Ext_Pict}},
-  {130762u, {property::type::Ext_Pict}},
-  {130763u, {property::type::Ext_Pict}},
-  {130764u, {property::type::Ext_Pict}},
-  {130765u, {property::type::Ext_Pict}},
-  {130766u, {property::type::Ext_Pict}},
-  {130767u, {property::type::Ext_Pict}},
-  {130768u, {property::type::Ext_Pict}},
-  {130769u, {property::type::Ext_Pict}},
-  {130770u, {property::type::Ext_Pict}},
-  {130771u, {property::type::Ext_Pict}},
-  {130772u, {property::type::Ext_Pict}},
-  {130773u, {property::type::Ext_Pict}},
-  {130774u, {property::type::Ext_Pict}},
-  {130775u, {property::type::Ext_Pict}},
-  {130776u, {property::type::Ext_Pict}},
-  {130777u, {property::type::Ext_Pict}},
-  {130778u, {property::type::Ext_Pict}},
-  {130779u, {property::type::Ext_Pict}},
-  {130780u, {property::type::Ext_Pict}},
-  {130781u, {property::type::Ext_Pict}},
-  {130782u, {property::type::Ext_Pict}},
-  {130783u, {property::type::Ext_Pict}},
-  {130784u, {property::type::Ext_Pict}},
-  {130785u, {property::type::Ext_Pict}},
-  {130786u, {property::type::Ext_Pict}},
-  {130787u, {property::type::Ext_Pict}},
-  {130788u, {property::type::Ext_Pict}},
-  {130789u, {property::type::Ext_Pict}},
-  {130790u, {property::type::Ext_Pict}},
-  {130791u, {property::type::Ext_Pict}},
-  {130792u, {property::type::Ext_Pict}},
-  {130793u, {property::type::Ext_Pict}},
-  {130794u, {property::type::Ext_Pict}},
-  {130795u, {property::type::Ext_Pict}},
-  {130796u, {property::type::Ext_Pict}},
-  {130797u, {property::type::Ext_Pict}},
-  {130798u, {property::type::Ext_Pict}},
-  {130799u, {property::type::Ext_Pict}},
-  {130800u, {property::type::Ext_Pict}},
-  {130801u, {property::type::Ext_Pict}},
-  {130802u, {property::type::Ext_Pict}},
-  {130803u, {property::type::Ext_Pict}},
-  {130804u, {property::type::Ext_Pict}},
-  {130805u, {property::type::Ext_Pict}},
-  {130806u, {property::type::Ext_Pict}},
-  {130807u, {property::type::Ext_Pict}},
-  {130808u, {property::type::Ext_Pict}},
-  {130809u, {property::type::Ext_Pict}},
-  {130810u, {property::type::Ext_Pict}},
-  {130811u, {property::type::Ext_Pict}},
-  {130812u, {property::type::Ext_Pict}},
-  {130813u, {property::type::Ext_Pict}},
-  {130814u, {property::type::Ext_Pict}},
-  {130815u, {property::type::Ext_Pict}},
-  {130816u, {property::type::Ext_Pict}},
-  {130817u, {property::type::Ext_Pict}},
-  {130818u, {property::type::Ext_Pict}},
-  {130819u, {property::type::Ext_Pict}},
-  {130820u, {property::type::Ext_Pict}},
-  {130821u, {property::type::Ext_Pict}},
-  {130822u, {property::type::Ext_Pict}},
-  {130823u, {property::type::Ext_Pict}},
-  {130824u, {property::type::Ext_Pict}},
-  {130825u, {property::type::Ext_Pict}},
-  {130826u, {property::type::Ext_Pict}},
-  {130827u, {property::type::Ext_Pict}},
-  {130828u, {property::type::Ext_Pict}},
-  {130829u, {property::type::Ext_Pict}},
-  {130830u, {property::type::Ext_Pict}},
-  {130831u, {property::type::Ext_Pict}},
-  {130832u, {property::type::Ext_Pict}},
-  {130833u, {property::type::Ext_Pict}},
-  {130834u, {property::type::Ext_Pict}},
-  {130835u, {property::type::Ext_Pict}},
-  {130836u, {property::type::Ext_Pict}},
-  {130837u, {property::type::Ext_Pict}},
-  {130838u, {property::type::Ext_Pict}},
-  {130839u, {property::type::Ext_Pict}},
-  {130840u, {property::type::Ext_Pict}},
-  {130841u, {property::type::Ext_Pict}},
-  {130842u, {property::type::Ext_Pict}},
-  {130843u, {property::type::Ext_Pict}},
-  {130844u, {property::type::Ext_Pict}},
-  {130845u, {property::type::Ext_Pict}},
-  {130846u, {property::type::Ext_Pict}},
-  {130847u, {property::type::Ext_Pict}},
-  {130848u, {property::type::Ext_Pict}},
-  {130849u, {property::type::Ext_Pict}},
-  {130850u, {property::type::Ext_Pict}},
-  {130851u, {property::type::Ext_Pict}},
-  {130852u, {property::type::Ext_Pict}},
-  {130853u, {property::type::Ext_Pict}},
-  {130854u, {property::type::Ext_Pict}},
-  {130855u, {property::type::Ext_Pict}},
-  {130856u, {property::type::Ext_Pict}},
-  {130857u, {property::type::Ext_Pict}},
-  {130858u, {property::type::Ext_Pict}},
-  {130859u, {property::type::Ext_Pict}},
-  {130860u, {property::type::Ext_Pict}},
-  {130861u, {property::type::Ext_Pict}},
-  {130862u, {property::type::Ext_Pict}},
-  {130863u, {property::type::Ext_Pict}},
-  {130864u, {property::type::Ext_Pict}},
-  {130865u, {property::type::Ext_Pict}},
-  {130866u, {property::type::Ext_Pict}},
-  {130867u, {property::type::Ext_Pict}},
-  {130868u, {property::type::Ext_Pict}},
-  {130869u, {property::type::Ext_Pict}},
-  {130870u, {property::type::Ext_Pict}},
-  {130871u, {property::type::Ext_Pict}},
-  {130872u, {property::type::Ext_Pict}},
-  {130873u, {property::type::Ext_Pict}},
-  {130874u, {property::type::Ext_Pict}},
-  {130875u, {property::type::Ext_Pict}},
-  {130876u, {property::type::Ext_Pict}},
-  {130877u, {property::type::Ext_Pict}},
-  {130878u, {property::type::Ext_Pict}},
-  {130879u, {property::type::Ext_Pict}},
-  {130880u, {property::type::Ext_Pict}},
-  {130881u, {property::type::Ext_Pict}},
-  {130882u, {property::type::Ext_Pict}},
-  {130883u, {property::type::Ext_Pict}},
-  {130884u, {property::type::Ext_Pict}},
-  {130885u, {property::type::Ext_Pict}},
-  {130886u, {property::type::Ext_Pict}},
-  {130887u, {property::type::Ext_Pict}},
-  {130888u, {property::type::Ext_Pict}},
-  {130889u, {property::type::Ext_Pict}},
-  {130890u, {property::type::Ext_Pict}},
-  {130891u, {property::type::Ext_Pict}},
-  {130892u, {property::type::Ext_Pict}},
-  {130893u, {property::type::Ext_Pict}},
-  {130894u, {property::type::Ext_Pict}},
-  {130895u, {property::type::Ext_Pict}},
-  {130896u, {property::type::Ext_Pict}},
-  {130897u, {property::type::Ext_Pict}},
-  {130898u, {property::type::Ext_Pict}},
-  {130899u, {property::type::Ext_Pict}},
-  {130900u, {property::type::Ext_Pict}},
-  {130901u, {property::type::Ext_Pict}},
-  {130902u, {property::type::Ext_Pict}},
-  {130903u, {property::type::Ext_Pict}},
-  {130904u, {property::type::Ext_Pict}},
-  {130905u, {property::type::Ext_Pict}},
-  {130906u, {property::type::Ext_Pict}},
-  {130907u, {property::type::Ext_Pict}},
-  {130908u, {property::type::Ext_Pict}},
-  {130909u, {property::type::Ext_Pict}},
-  {130910u, {property::type::Ext_Pict}},
-  {130911u, {property::type::Ext_Pict}},
-  {130912u, {property::type::Ext_Pict}},
-  {130913u, {property::type::Ext_Pict}},
-  {130914u, {property::type::Ext_Pict}},
-  {130915u, {property::type::Ext_Pict}},
-  {130916u, {property::type::Ext_Pict}},
-  {130917u, {property::type::Ext_Pict}},
-  {130918u, {property::type::Ext_Pict}},
-  {130919u, {property::type::Ext_Pict}},
-  {130920u, {property::type::Ext_Pict}},
-  {130921u, {property::type::Ext_Pict}},
-  {130922u, {property::type::Ext_Pict}},
-  {130923u, {property::type::Ext_Pict}},
-  {130924u, {property::type::Ext_Pict}},
-  {130925u, {property::type::Ext_Pict}},
-  {130926u, {property::type::Ext_Pict}},
-  {130927u, {property::type::Ext_Pict}},
-  {130928u, {property::type::Ext_Pict}},
-  {130929u, {property::type::Ext_Pict}},
-  {130930u, {property::type::Ext_Pict}},
-  {130931u, {property::type::Ext_Pict}},
-  {130932u, {property::type::Ext_Pict}},
-  {130933u, {property::type::Ext_Pict}},
-  {130934u, {property::type::Ext_Pict}},
-  {130935u, {property::type::Ext_Pict}},
-  {130936u, {property::type::Ext_Pict}},
-  {130937u, {property::type::Ext_Pict}},
-  {130938u, {property::type::Ext_Pict}},
-  {130939u, {property::type::Ext_Pict}},
-  {130940u, {property::type::Ext_Pict}},
-  {130941u, {property::type::Ext_Pict}},
-  {130942u, {property::type::Ext_Pict}},
-  {130943u, {property::type::Ext_Pict}},
-  {130944u, {property::type::Ext_Pict}},
-  {130945u, {property::type::Ext_Pict}},
-  {130946u, {property::type::Ext_Pict}},
-  {130947u, {property::type::Ext_Pict}},
-  {130948u, {property::type::Ext_Pict}},
-  {130949u, {property::type::Ext_Pict}},
-  {130950u, {property::type::Ext_Pict}},
-  {130951u, {property::type::Ext_Pict}},
-  {130952u, {property::type::Ext_Pict}},
-  {130953u, {property::type::Ext_Pict}},
-  {130954u, {property::type::Ext_Pict}},
-  {130955u, {property::type::Ext_Pict}},
-  {130956u, {property::type::Ext_Pict}},
-  {130957u, {property::type::Ext_Pict}},
-  {130958u, {property::type::Ext_Pict}},
-  {130959u, {property::type::Ext_Pict}},
-  {130960u, {property::type::Ext_Pict}},
-  {130961u, {property::type::Ext_Pict}},
-  {130962u, {property::type::Ext_Pict}},
-  {130963u, {property::type::Ext_Pict}},
-  {130964u, {property::type::Ext_Pict}},
-  {130965u, {property::type::Ext_Pict}},
-  {130966u, {property::type::Ext_Pict}},
-  {130967u, {property::type::Ext_Pict}},
-  {130968u, {property::type::Ext_Pict}},
-  {130969u, {property::type::Ext_Pict}},
-  {130970u, {property::type::Ext_Pict}},
-  {130971u, {property::type::Ext_Pict}},
-  {130972u, {property::type::Ext_Pict}},
-  {130973u, {property::type::Ext_Pict}},
-  {130974u, {property::type::Ext_Pict}},
-  {130975u, {property::type::Ext_Pict}},
-  {130976u, {property::type::Ext_Pict}},
-  {130977u, {property::type::Ext_Pict}},
-  {130978u, {property::type::Ext_Pict}},
-  {130979u, {property::type::Ext_Pict}},
-  {130980u, {property::type::Ext_Pict}},
-  {130981u, {property::type::Ext_Pict}},
-  {130982u, {property::type::Ext_Pict}},
-  {130983u, {property::type::Ext_Pict}},
-  {130984u, {property::type::Ext_Pict}},
-  {130985u, {property::type::Ext_Pict}},
-  {130986u, {property::type::Ext_Pict}},
-  {130987u, {property::type::Ext_Pict}},
-  {130988u, {property::type::Ext_Pict}},
-  {130989u, {property::type::Ext_Pict}},
-  {130990u, {property::type::Ext_Pict}},
-  {130991u, {property::type::Ext_Pict}},
-  {130992u, {property::type::Ext_Pict}},
-  {130993u, {property::type::Ext_Pict}},
-  {130994u, {property::type::Ext_Pict}},
-  {130995u, {property::type::Ext_Pict}},
-  {130996u, {property::type::Ext_Pict}},
-  {130997u, {property::type::Ext_Pict}},
-  {130998u, {property::type::Ext_Pict}},
-  {130999u, {property::type::Ext_Pict}},
-  {131000u, {property::type::Ext_Pict}},
-  {131001u, {property::type::Ext_Pict}},
-  {131002u, {property::type::Ext_Pict}},
-  {131003u, {property::type::Ext_Pict}},
-  {131004u, {property::type::Ext_Pict}},
-  {131005u, {property::type::Ext_Pict}},
-  {131006u, {property::type::Ext_Pict}},
-  {131007u, {property::type::Ext_Pict}},
-  {131008u, {property::type::Ext_Pict}},
-  {131009u, {property::type::Ext_Pict}},
-  {131010u, {property::type::Ext_Pict}},
-  {131011u, {property::type::Ext_Pict}},
-  {131012u, {property::type::Ext_Pict}},
-  {131013u, {property::type::Ext_Pict}},
-  {131014u, {property::type::Ext_Pict}},
-  {131015u, {property::type::Ext_Pict}},
-  {131016u, {property::type::Ext_Pict}},
-  {131017u, {property::type::Ext_Pict}},
-  {131018u, {property::type::Ext_Pict}},
-  {131019u, {property::type::Ext_Pict}},
-  {131020u, {property::type::Ext_Pict}},
-  {131021u, {property::type::Ext_Pict}},
-  {131022u, {property::type::Ext_Pict}},
-  {131023u, {property::type::Ext_Pict}},
-  {131024u, {property::type::Ext_Pict}},
-  {131025u, {property::type::Ext_Pict}},
-  {131026u, {property::type::Ext_Pict}},
-  {131027u, {property::type::Ext_Pict}},
-  {131028u, {property::type::Ext_Pict}},
-  {131029u, {property::type::Ext_Pict}},
-  {131030u, {property::type::Ext_Pict}},
-  {131031u, {property::type::Ext_Pict}},
-  {131032u, {property::type::Ext_Pict}},
-  {131033u, {property::type::Ext_Pict}},
-  {131034u, {property::type::Ext_Pict}},
-  {131035u, {property::type::Ext_Pict}},
-  {131036u, {property::type::Ext_Pict}},
-  {131037u, {property::type::Ext_Pict}},
-  {131038u, {property::type::Ext_Pict}},
-  {131039u, {property::type::Ext_Pict}},
-  {131040u, {property::type::Ext_Pict}},
-  {131041u, {property::type::Ext_Pict}},
-  {131042u, {property::type::Ext_Pict}},
-  {131043u, {property::type::Ext_Pict}},
-  {131044u, {property::type::Ext_Pict}},
-  {131045u, {property::type::Ext_Pict}},
-  {131046u, {property::type::Ext_Pict}},
-  {131047u, {property::type::Ext_Pict}},
-  {131048u, {property::type::Ext_Pict}},
-  {131049u, {property::type::Ext_Pict}},
-  {131050u, {property::type::Ext_Pict}},
-  {131051u, {property::type::Ext_Pict}},
-  {131052u, {property::type::Ext_Pict}},
-  {131053u, {property::type::Ext_Pict}},
-  {131054u, {property::type::Ext_Pict}},
-  {131055u, {property::type::Ext_Pict}},
-  {131056u, {property::type::Ext_Pict}},
-  {131057u, {property::type::Ext_Pict}},
-  {131058u, {property::type::Ext_Pict}},
-  {131059u, {property::type::Ext_Pict}},
-  {131060u, {property::type::Ext_Pict}},
-  {131061u, {property::type::Ext_Pict}},
-  {131062u, {property::type::Ext_Pict}},
-  {131063u, {property::type::Ext_Pict}},
-  {131064u, {property::type::Ext_Pict}},
-  {131065u, {property::type::Ext_Pict}},
-  {131066u, {property::type::Ext_Pict}},
-  {131067u, {property::type::Ext_Pict}},
-  {131068u, {property::type::Ext_Pict}},
-  {131069u, {property::type::Ext_Pict}}
-};
-
-} // namespace detail
-} // namespace auc
@@ -0,0 +1,127 @@
+#include "encode_kernels.hpp"
+
+#include <algorithm>
+#include <array>
+#include <auc/encode.hpp>
+
+namespace auc {
+
+namespace detail {
+
+std::size_t encode_utf32_scalar(const char32_t* cps,
+                                std::size_t length,
+                                char* out,
+                                char*) {
+  char* const begin = out;
+  for (std::size_t idx = 0u; idx < length; ++idx) {
+    out += encode_char(cps[idx], out);
+  }
+  return static_cast<std::size_t>(out - begin);
+}
+
+namespace {
+
+using encode_kernel = std::size_t (*)(const char32_t*,
+                                      std::size_t,
+                                      char*,
+                                      char*);
+
+encode_kernel select_kernel(simd_level level) {
+  switch (level) {
+#if defined(AUC_X86_64_KERNELS)
+    case simd_level::AVX512:
+    case simd_level::AVX2:
+      return encode_utf32_avx2;
+    case simd_level::SSE42:
+      return encode_utf32_sse42;
+#endif
+    case simd_level::Scalar:
+    default:
+      return encode_utf32_scalar;
+  }
+}
+
+std::uint32_t num_of(const codepoint& cp) {
+  return cp.get_num();
+}
+
+std::uint32_t num_of(char32_t cp) {
+  return static_cast<std::uint32_t>(cp);
+}
+
+// Codepoints past max_codepoint are skipped by the encoders, so they take
+// up no bytes
+template <class T>
+std::size_t encoded_size(std::span<const T> cps) {
+  std::size_t size = 0u;
+  for (const T& cp : cps) {
+    const std::uint32_t num = num_of(cp);
+    size += (num <= max_codepoint)
+                ? (1u + (num >= 0x80u) + (num >= 0x800u) + (num >= 0x10000u))
+                : 0u;
+  }
+  return size;
+}
+
+encode_kernel dispatched_kernel() {
+  static const encode_kernel kernel = select_kernel(detect_simd_level());
+  return kernel;
+}
+
+std::size_t run_kernel(encode_kernel kernel,
+                       std::span<const char32_t> cps,
+                       std::span<char> out) {
+  return kernel(cps.data(), cps.size(), out.data(), out.data() + out.size());
+}
+
+// codepoint makes no promises about its layout, so rather than reading its
+// array as integers the kernels get its values copied out through get_num()
+// a block at a time
+std::size_t run_kernel(encode_kernel kernel,
+                       std::span<const codepoint> cps,
+                       std::span<char> out) {
+  constexpr std::size_t block_size = 256u;
+  std::array<char32_t, block_size> block;
+  std::size_t num_bytes = 0u;
+  for (std::size_t idx = 0u; idx < cps.size(); idx += block_size) {
+    const std::size_t length = std::min(block_size, cps.size() - idx);
+    for (std::size_t block_idx = 0u; block_idx < length; ++block_idx) {
+      block[block_idx] = static_cast<char32_t>(cps[idx + block_idx].get_num());
+    }
+    num_bytes += run_kernel(kernel, std::span(block.data(), length),
+                            out.subspan(num_bytes));
+  }
+  return num_bytes;
+}
+
+}  // namespace
+
+std::size_t encode(simd_level level,
+                   std::span<const codepoint> cps,
+                   std::span<char> out) {
+  return run_kernel(select_kernel(level), cps, out);
+}
+
+}  // namespace detail
+
+std::size_t encode_into(std::uint32_t cp, char* out) {
+  return detail::encode_char(cp, out);
+}
+
+std::size_t encoded_size(std::span<const codepoint> cps) {
+  return detail::encoded_size(cps);
+}
+
+std::size_t encoded_size(std::span<const char32_t> cps) {
+  return detail::encoded_size(cps);
+}
+
+std::size_t encode(std::span<const codepoint> cps, std::span<char> out) {
+  return detail::run_kernel(detail::dispatched_kernel(), cps, out);
+}
+
+std::size_t encode(std::span<const char32_t> cps, std::span<char> out) {
+  return detail::run_kernel(detail::dispatched_kernel(), cps, out);
+}
+
+}  // namespace auc
@@ -0,0 +1,113 @@
+#include "encode_kernels.hpp"
+#include "encode_lookup.hpp"
+
+#include <immintrin.h>
+
+namespace auc {
+namespace detail {
+namespace {
+
+__m256i load(const char32_t* cps) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cps));
+}
+
+__m128i load_shuffle(const bmp_pack& pack) {
+  return _mm_load_si128(reinterpret_cast<const __m128i*>(pack.shuffle_));
+}
+
+// Encodes 8 codepoints below U+10000 as two packs of 4, returning the bytes
+// written
+std::size_t encode_bmp(__m256i cps, char* out) {
+  const __m256i low_6_bits = _mm256_set1_epi32(0x3F);
+  const __m256i tail_marker = _mm256_set1_epi32(0x80);
+  const __m256i last =
+      _mm256_or_si256(_mm256_and_si256(cps, low_6_bits), tail_marker);
+  const __m256i middle = _mm256_or_si256(
+      _mm256_and_si256(_mm256_srli_epi32(cps, 6), low_6_bits), tail_marker);
+
+  const __m256i three_bytes = _mm256_or_si256(
+      _mm256_or_si256(_mm256_srli_epi32(cps, 12), _mm256_set1_epi32(0xE0)),
+      _mm256_or_si256(_mm256_slli_epi32(middle, 8),
+                      _mm256_slli_epi32(last, 16)));
+  const __m256i two_bytes = _mm256_or_si256(
+      _mm256_or_si256(_mm256_srli_epi32(cps, 6), _mm256_set1_epi32(0xC0)),
+      _mm256_slli_epi32(last, 8));
+
+  const __m256i below_80 = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x80), cps);
+  const __m256i below_800 = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x800), cps);
+  const __m256i lanes = _mm256_blendv_epi8(
+      _mm256_blendv_epi8(three_bytes, two_bytes, below_800), cps, below_80);
+
+  // vpshufb shuffles within each 128 bit half, so each half gets its own
+  // pack
+  const unsigned int below_80_mask =
+      _mm256_movemask_ps(_mm256_castsi256_ps(below_80));
+  const unsigned int below_800_mask =
+      _mm256_movemask_ps(_mm256_castsi256_ps(below_800));
+  const bmp_pack& low = lookup_bmp_pack(below_80_mask, below_800_mask);
+  const bmp_pack& high =
+      lookup_bmp_pack(below_80_mask >> 4u, below_800_mask >> 4u);
+  const __m256i packed = _mm256_shuffle_epi8(
+      lanes, _mm256_set_m128i(load_shuffle(high), load_shuffle(low)));
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                   _mm256_castsi256_si128(packed));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + low.length_),
+                   _mm256_extracti128_si256(packed, 1));
+  return low.length_ + high.length_;
+}
+
+}  // namespace
+
+std::size_t encode_utf32_avx2(const char32_t* cps,
+                              std::size_t length,
+                              char* out,
+                              char* out_end) {
+  char* const begin = out;
+  const __m256i non_ascii = _mm256_set1_epi32(~0x7F);
+  const __m256i non_bmp = _mm256_set1_epi32(~0xFFFF);
+
+  // The 32 bit lanes come out of the two packs interleaved by 128 bit half
+  const __m256i ascii_order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+  std::size_t idx = 0u;
+  while (idx + 8u <= length && out_end - out >= 32) {
+    if (idx + 32u <= length) {
+      const __m256i a = load(cps + idx);
+      const __m256i b = load(cps + idx + 8u);
+      const __m256i c = load(cps + idx + 16u);
+      const __m256i d = load(cps + idx + 24u);
+      const __m256i any =
+          _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+      if (_mm256_testz_si256(any, non_ascii)) {
+        const __m256i ascii =
+            _mm256_packus_epi16(_mm256_packus_epi32(a, b),
+                                _mm256_packus_epi32(c, d));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                            _mm256_permutevar8x32_epi32(ascii, ascii_order));
+        out += 32;
+        idx += 32u;
+        continue;
+      }
+    }
+
+    const __m256i block = load(cps + idx);
+    if (_mm256_testz_si256(block, non_bmp)) {
+      out += encode_bmp(block, out);
+    } else {
+      for (std::size_t end = idx + 8u; idx < end; ++idx) {
+        out += encode_char(cps[idx], out);
+      }
+      continue;
+    }
+    idx += 8u;
+  }
+
+  for (; idx < length; ++idx) {
+    out += encode_char(cps[idx], out);
+  }
+  return static_cast<std::size_t>(out - begin);
+}
+
+}  // namespace detail
+}  // namespace auc
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace auc {
+namespace detail {
+
+// Each kernel encodes length codepoints into out and returns the number of
+// bytes written. out_end bounds how far the SIMD kernels may store, as they
+// write whole registers and only advance by the bytes that were encoded.
+std::size_t encode_utf32_scalar(const char32_t* cps,
+                                std::size_t length,
+                                char* out,
+                                char* out_end);
+
+#if defined(AUC_X86_64_KERNELS)
+std::size_t encode_utf32_sse42(const char32_t* cps,
+                               std::size_t length,
+                               char* out,
+                               char* out_end);
+std::size_t encode_utf32_avx2(const char32_t* cps,
+                              std::size_t length,
+                              char* out,
+                              char* out_end);
+#endif
+
+// NOTE: This has internal linkage as the kernels include it too, and an
+// inline function compiled for their instruction set must not be picked
+// for the generic code.
+namespace {
+
+// https://www.rfc-editor.org/rfc/rfc3629#section-3
+// The lowest-order bits of the codepoint fill the last octet, the next
+// higher-order ones the octet before it and so on, with the lead octet
+// carrying the length marker in its high bits. Codepoints past U+10FFFF
+// write nothing.
+inline std::size_t encode_char(std::uint32_t cp, char* out) {
+  if (cp < 0x80u) {
+    out[0] = static_cast<char>(cp);
+    return 1u;
+  }
+  if (cp < 0x800u) {
+    out[0] = static_cast<char>(0xC0u | (cp >> 6u));
+    out[1] = static_cast<char>(0x80u | (cp & 0x3Fu));
+    return 2u;
+  }
+  if (cp < 0x10000u) {
+    out[0] = static_cast<char>(0xE0u | (cp >> 12u));
+    out[1] = static_cast<char>(0x80u | ((cp >> 6u) & 0x3Fu));
+    out[2] = static_cast<char>(0x80u | (cp & 0x3Fu));
+    return 3u;
+  }
+  if (cp <= 0x10FFFFu) {
+    out[0] = static_cast<char>(0xF0u | (cp >> 18u));
+    out[1] = static_cast<char>(0x80u | ((cp >> 12u) & 0x3Fu));
+    out[2] = static_cast<char>(0x80u | ((cp >> 6u) & 0x3Fu));
+    out[3] = static_cast<char>(0x80u | (cp & 0x3Fu));
+    return 4u;
+  }
+  return 0u;
+}
+
+}  // namespace
+
+}  // namespace detail
+}  // namespace auc
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// NOTE: This header is only included by the encode_<isa>.cpp kernels, so
+// like validation_lookup.hpp everything here has internal linkage.
+
+// Four BMP codepoints are encoded in parallel as up to 3 bytes each, one
+// codepoint per 32 bit lane. The lanes are then packed together with a
+// byte shuffle chosen by their encoded lengths.
+namespace auc {
+namespace detail {
+namespace {
+
+struct bmp_pack {
+  alignas(16) std::uint8_t shuffle_[16];
+  std::uint8_t length_;
+};
+
+// Indexed by the encoded length minus one of each lane, 2 bits per lane
+constexpr std::array<bmp_pack, 256> bmp_pack_table = [] {
+  std::array<bmp_pack, 256> table{};
+  for (std::size_t idx = 0u; idx < table.size(); ++idx) {
+    bmp_pack& pack = table[idx];
+    std::size_t length = 0u;
+    for (std::size_t lane = 0u; lane < 4u; ++lane) {
+      const std::size_t lane_length = ((idx >> (2u * lane)) & 0x3u) + 1u;
+      for (std::size_t byte = 0u; byte < lane_length && length < 16u;
+           ++byte) {
+        pack.shuffle_[length++] = static_cast<std::uint8_t>(4u * lane + byte);
+      }
+    }
+    for (std::size_t byte = length; byte < 16u; ++byte) {
+      pack.shuffle_[byte] = 0x80u;
+    }
+    pack.length_ = static_cast<std::uint8_t>(length);
+  }
+  return table;
+}();
+
+// Moves bit N of a 4 bit lane mask to bit 2N
+constexpr std::array<std::uint8_t, 16> spread_bits = [] {
+  std::array<std::uint8_t, 16> table{};
+  for (std::size_t mask = 0u; mask < table.size(); ++mask) {
+    for (std::size_t bit = 0u; bit < 4u; ++bit) {
+      table[mask] |= static_cast<std::uint8_t>(((mask >> bit) & 1u)
+                                               << (2u * bit));
+    }
+  }
+  return table;
+}();
+
+// below_80 and below_800 are the lane masks of codepoints below U+0080 and
+// U+0800, which are 1 and at most 2 bytes long respectively
+inline const bmp_pack& lookup_bmp_pack(unsigned int below_80,
+                                       unsigned int below_800) {
+  const unsigned int two_bytes = below_800 & ~below_80 & 0xFu;
+  const unsigned int three_bytes = ~below_800 & 0xFu;
+  return bmp_pack_table[spread_bits[two_bytes] |
+                        (spread_bits[three_bytes] << 1u)];
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace auc
@@ -0,0 +1,91 @@
+#include "encode_kernels.hpp"
+#include "encode_lookup.hpp"
+
+#include <immintrin.h>
+
+namespace auc {
+namespace detail {
+namespace {
+
+__m128i load(const char32_t* cps) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(cps));
+}
+
+// Encodes 4 codepoints below U+10000, returning the bytes written
+std::size_t encode_bmp(__m128i cps, char* out) {
+  const __m128i low_6_bits = _mm_set1_epi32(0x3F);
+  const __m128i tail_marker = _mm_set1_epi32(0x80);
+  const __m128i last =
+      _mm_or_si128(_mm_and_si128(cps, low_6_bits), tail_marker);
+  const __m128i middle = _mm_or_si128(
+      _mm_and_si128(_mm_srli_epi32(cps, 6), low_6_bits), tail_marker);
+
+  const __m128i three_bytes = _mm_or_si128(
+      _mm_or_si128(_mm_srli_epi32(cps, 12), _mm_set1_epi32(0xE0)),
+      _mm_or_si128(_mm_slli_epi32(middle, 8), _mm_slli_epi32(last, 16)));
+  const __m128i two_bytes = _mm_or_si128(
+      _mm_or_si128(_mm_srli_epi32(cps, 6), _mm_set1_epi32(0xC0)),
+      _mm_slli_epi32(last, 8));
+
+  const __m128i below_80 = _mm_cmplt_epi32(cps, _mm_set1_epi32(0x80));
+  const __m128i below_800 = _mm_cmplt_epi32(cps, _mm_set1_epi32(0x800));
+  const __m128i lanes = _mm_blendv_epi8(
+      _mm_blendv_epi8(three_bytes, two_bytes, below_800), cps, below_80);
+
+  const bmp_pack& pack =
+      lookup_bmp_pack(_mm_movemask_ps(_mm_castsi128_ps(below_80)),
+                      _mm_movemask_ps(_mm_castsi128_ps(below_800)));
+  const __m128i packed = _mm_shuffle_epi8(
+      lanes, _mm_load_si128(reinterpret_cast<const __m128i*>(pack.shuffle_)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), packed);
+  return pack.length_;
+}
+
+}  // namespace
+
+std::size_t encode_utf32_sse42(const char32_t* cps,
+                               std::size_t length,
+                               char* out,
+                               char* out_end) {
+  char* const begin = out;
+  const __m128i non_ascii = _mm_set1_epi32(~0x7F);
+  const __m128i non_bmp = _mm_set1_epi32(~0xFFFF);
+
+  std::size_t idx = 0u;
+  while (idx + 4u <= length && out_end - out >= 16) {
+    if (idx + 16u <= length) {
+      const __m128i a = load(cps + idx);
+      const __m128i b = load(cps + idx + 4u);
+      const __m128i c = load(cps + idx + 8u);
+      const __m128i d = load(cps + idx + 12u);
+      const __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+      if (_mm_testz_si128(any, non_ascii)) {
+        const __m128i ascii = _mm_packus_epi16(_mm_packus_epi32(a, b),
+                                               _mm_packus_epi32(c, d));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), ascii);
+        out += 16;
+        idx += 16u;
+        continue;
+      }
+    }
+
+    const __m128i block = load(cps + idx);
+    if (_mm_testz_si128(block, non_bmp)) {
+      out += encode_bmp(block, out);
+    } else {
+      for (std::size_t end = idx + 4u; idx < end; ++idx) {
+        out += encode_char(cps[idx], out);
+      }
+      continue;
+    }
+    idx += 4u;
+  }
+
+  for (; idx < length; ++idx) {
+    out += encode_char(cps[idx], out);
+  }
+  return static_cast<std::size_t>(out - begin);
+}
+
+}  // namespace detail
+}  // namespace auc
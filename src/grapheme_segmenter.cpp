@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <auc/decode.hpp>
+#include <auc/grapheme_segmenter.hpp>
+#include <utility>
+
+namespace auc {
+
+grapheme_segmenter::grapheme_segmenter(boundary_callback on_boundary)
+    : on_boundary_(std::move(on_boundary)) {}
+
+void grapheme_segmenter::feed(std::string_view chunk) {
+  if (num_partial_ > 0u) {
+    // Complete the character split by the previous chunk, which never takes
+    // more than the bytes it is missing
+    const std::size_t num_taken =
+        std::min(chunk.size(), partial_.size() - num_partial_);
+    std::array<char, max_encoded_size> bytes = partial_;
+    std::copy_n(chunk.data(), num_taken, bytes.data() + num_partial_);
+
+    const char* p = bytes.data();
+    const char* end = bytes.data() + num_partial_ + num_taken;
+    const decode_result decoded = decode_next(p, end);
+    if (decoded.status_ == decode_status::Truncated) {
+      // The chunk was too short to complete it as well
+      partial_ = bytes;
+      num_partial_ += num_taken;
+      return;
+    }
+
+    // Ill-formed sequences end at the latest with the first byte that
+    // doesn't continue them, so the carried bytes are always used up
+    const auto num_bytes = static_cast<std::size_t>(p - bytes.data());
+    chunk.remove_prefix(num_bytes - num_partial_);
+    num_partial_ = 0u;
+    next_char(decoded.codepoint_, num_bytes);
+  }
+
+  const char* p = chunk.data();
+  const char* end = chunk.data() + chunk.size();
+  while (p != end) {
+    const char* begin = p;
+    const decode_result decoded = decode_next(p, end);
+    if (decoded.status_ == decode_status::Truncated) {
+      num_partial_ = static_cast<std::size_t>(end - begin);
+      std::copy(begin, end, partial_.data());
+      break;
+    }
+    next_char(decoded.codepoint_, static_cast<std::size_t>(p - begin));
+  }
+}
+
+void grapheme_segmenter::finish() {
+  // A character the stream ended in the middle of is ill-formed
+  if (num_partial_ > 0u) {
+    next_char(replacement_character, num_partial_);
+    num_partial_ = 0u;
+  }
+
+  if (offset_ > 0u) {
+    on_boundary_(offset_);
+  }
+  state_ = detail::grapheme_break_state{};
+  offset_ = 0u;
+}
+
+void grapheme_segmenter::next_char(std::uint32_t cp, std::size_t num_bytes) {
+  if (state_.advance(cp)) {
+    on_boundary_(offset_);
+  }
+  offset_ += num_bytes;
+}
+
+}  // namespace auc
@@ -1,18018 +0,0 @@
-// NOTE: This file was autogenerated via scripts/gen_graphemebreakproperty_lookup.py
-#include <unordered_map>
-
-#include <auc/property.hpp>
-#include <cstdint>
-
-// https://www.unicode.org/Public/15.0.0/ucd/auxiliary/GraphemeBreakProperty.txt
-namespace auc {
-namespace detail {
-
-static std::unordered_map<std::uint32_t, property::type> codepoint_break_lookup = {
-  {1536u, property::type::Prepend},
-  {1537u, property::type::Prepend},
-  {1538u, property::type::Prepend},
-  {1539u, property::type::Prepend},
-  {1540u, property::type::Prepend},
-  {1541u, property::type::Prepend},
-  {1757u, property::type::Prepend},
-  {1807u, property::type::Prepend},
-  {2192u, property::type::Prepend},
-  {2193u, property::type::Prepend},
-  {2274u, property::type::Prepend},
-  {3406u, property::type::Prepend},
-  {69821u, property::type::Prepend},
-  {69837u, property::type::Prepend},
-  {70082u, property::type::Prepend},
-  {70083u, property::type::Prepend},
-  {71999u, property::type::Prepend},
-  {72001u, property::type::Prepend},
-  {72250u, property::type::Prepend},
-  {72324u, property::type::Prepend},
-  {72325u, property::type::Prepend},
-  {72326u, property::type::Prepend},
-  {72327u, property::type::Prepend},
-  {72328u, property::type::Prepend},
-  {72329u, property::type::Prepend},
-  {73030u, property::type::Prepend},
-  {73474u, property::type::Prepend},
-  {13u, property::type::CR},
-  {10u, property::type::LF},
-  {0u, property::type::Control},
-  {1u, property::type::Control},
-  {2u, property::type::Control},
-  {3u, property::type::Control},
-  {4u, property::type::Control},
-  {5u, property::type::Control},
-  {6u, property::type::Control},
-  {7u, property::type::Control},
-  {8u, property::type::Control},
-  {9u, property::type::Control},
-  {11u, property::type::Control},
-  {12u, property::type::Control},
-  {14u, property::type::Control},
-  {15u, property::type::Control},
-  {16u, property::type::Control},
-  {17u, property::type::Control},
-  {18u, property::type::Control},
-  {19u, property::type::Control},
-  {20u, property::type::Control},
-  {21u, property::type::Control},
-  {22u, property::type::Control},
-  {23u, property::type::Control},
-  {24u, property::type::Control},
-  {25u, property::type::Control},
-  {26u, property::type::Control},
-  {27u, property::type::Control},
-  {28u, property::type::Control},
-  {29u, property::type::Control},
-  {30u, property::type::Control},
-  {31u, property::type::Control},
-  {127u, property::type::Control},
-  {128u, property::type::Control},
-  {129u, property::type::Control},
-  {130u, property::type::Control},
-  {131u, property::type::Control},
-  {132u, property::type::Control},
-  {133u, property::type::Control},
-  {134u, property::type::Control},
-  {135u, property::type::Control},
-  {136u, property::type::Control},
-  {137u, property::type::Control},
-  {138u, property::type::Control},
-  {139u, property::type::Control},
-  {140u, property::type::Control},
-  {141u, property::type::Control},
-  {142u, property::type::Control},
-  {143u, property::type::Control},
-  {144u, property::type::Control},
-  {145u, property::type::Control},
-  {146u, property::type::Control},
-  {147u, property::type::Control},
-  {148u, property::type::Control},
-  {149u, property::type::Control},
-  {150u, property::type::Control},
-  {151u, property::type::Control},
-  {152u, property::type::Control},
-  {153u, property::type::Control},
-  {154u, property::type::Control},
-  {155u, property::type::Control},
-  {156u, property::type::Control},
-  {157u, property::type::Control},
-  {158u, property::type::Control},
-  {159u, property::type::Control},
-  {173u, property::type::Control},
-  {1564u, property::type::Control},
-  {6158u, property::type::Control},
-  {8203u, property::type::Control},
-  {8206u, property::type::Control},
-  {8207u, property::type::Control},
-  {8232u, property::type::Control},
-  {8233u, property::type::Control},
-  {8234u, property::type::Control},
-  {8235u, property::type::Control},
-  {8236u, property::type::Control},
-  {8237u, property::type::Control},
-  {8238u, property::type::Control},
-  {8288u, property::type::Control},
-  {8289u, property::type::Control},
-  {8290u, property::type::Control},
-  {8291u, property::type::Control},
-  {8292u, property::type::Control},
-  {8293u, property::type::Control},
-  {8294u, property::type::Control},
-  {8295u, property::type::Control},
-  {8296u, property::type::Control},
-  {8297u, property::type::Control},
-  {8298u, property::type::Control},
-  {8299u, property::type::Control},
-  {8300u, property::type::Control},
-  {8301u, property::type::Control},
-  {8302u, property::type::Control},
-  {8303u, property::type::Control},
-  {65279u, property::type::Control},
-  {65520u, property::type::Control},
-  {65521u, property::type::Control},
-  {65522u, property::type::Control},
-  {65523u, property::type::Control},
-  {65524u, property::type::Control},
-  {65525u, property::type::Control},
-  {65526u, property::type::Control},
-  {65527u, property::type::Control},
-  {65528u, property::type::Control},
-  {65529u, property::type::Control},
-  {65530u, property::type::Control},
-  {65531u, property::type::Control},
-  {78896u, property::type::Control},
-  {78897u, property::type::Control},
-  {78898u, property::type::Control},
-  {78899u, property::type::Control},
-  {78900u, property::type::Control},
-  {78901u, property::type::Control},
-  {78902u, property::type::Control},
-  {78903u, property::type::Control},
-  {78904u, property::type::Control},
-  {78905u, property::type::Control},
-  {78906u, property::type::Control},
-  {78907u, property::type::Control},
-  {78908u, property::type::Control},
-  {78909u, property::type::Control},
-  {78910u, property::type::Control},
-  {78911u, property::type::Control},
-  {113824u, property::type::Control},
-  {113825u, property::type::Control},
-  {113826u, property::type::Control},
-  {113827u, property::type::Control},
-  {119155u, property::type::Control},
-  {119156u, property::type::Control},
-  {119157u, property::type::Control},
-  {119158u, property::type::Control},
-  {119159u, property::type::Control},
-  {119160u, property::type::Control},
-  {119161u, property::type::Control},
-  {119162u, property::type::Control},
-  {917504u, property::type::Control},
-  {917505u, property::type::Control},
-  {917506u, property::type::Control},
-  {917507u, property::type::Control},
-  {917508u, property::type::Control},
-  {917509u, property::type::Control},
-  {917510u, property::type::Control},
-  {917511u, property::type::Control},
-  {917512u, property::type::Control},
-  {917513u, property::type::Control},
-  {917514u, property::type::Control},
-  {917515u, property::type::Control},
-  {917516u, property::type::Control},
-  {917517u, property::type::Control},
-  {917518u, property::type::Control},
-  {917519u, property::type::Control},
-  {917520u, property::type::Control},
-  {917521u, property::type::Control},
-  {917522u, property::type::Control},
-  {917523u, property::type::Control},
-  {917524u, property::type::Control},
-  {917525u, property::type::Control},
-  {917526u, property::type::Control},
-  {917527u, property::type::Control},
-  {917528u, property::type::Control},
-  {917529u, property::type::Control},
-  {917530u, property::type::Control},
-  {917531u, property::type::Control},
-  {917532u, property::type::Control},
-  {917533u, property::type::Control},
-  {917534u, property::type::Control},
-  {917535u, property::type::Control},
-  {917632u, property::type::Control},
-  {917633u, property::type::Control},
-  {917634u, property::type::Control},
-  {917635u, property::type::Control},
-  {917636u, property::type::Control},
-  {917637u, property::type::Control},
-  {917638u, property::type::Control},
-  {917639u, property::type::Control},
-  {917640u, property::type::Control},
-  {917641u, property::type::Control},
-  {917642u, property::type::Control},
-  {917643u, property::type::Control},
-  {917644u, property::type::Control},
-  {917645u, property::type::Control},
-  {917646u, property::type::Control},
-  {917647u, property::type::Control},
-  {917648u, property::type::Control},
-  {917649u, property::type::Control},
-  {917650u, property::type::Control},
-  {917651u, property::type::Control},
-  {917652u, property::type::Control},
-  {917653u, property::type::Control},
-  {917654u, property::type::Control},
-  {917655u, property::type::Control},
-  {917656u, property::type::Control},
-  {917657u, property::type::Control},
-  {917658u, property::type::Control},
-  {917659u, property::type::Control},
-  {917660u, property::type::Control},
-  {917661u, property::type::Control},
-  {917662u, property::type::Control},
-  {917663u, property::type::Control},
-  {917664u, property::type::Control},
-  {917665u, property::type::Control},
-  {917666u, property::type::Control},
-  {917667u, property::type::Control},
-  {917668u, property::type::Control},
-  {917669u, property::type::Control},
-  {917670u, property::type::Control},
-  {917671u, property::type::Control},
-  {917672u, property::type::Control},
-  {917673u, property::type::Control},
-  {917674u, property::type::Control},
-  {917675u, property::type::Control},
-  {917676u, property::type::Control},
-  {917677u, property::type::Control},
-  {917678u, property::type::Control},
-  {917679u, property::type::Control},
-  {917680u, property::type::Control},
-  {917681u, property::type::Control},
-  {917682u, property::type::Control},
-  {917683u, property::type::Control},
-  {917684u, property::type::Control},
-  {917685u, property::type::Control},
-  {917686u, property::type::Control},
-  {917687u, property::type::Control},
-  {917688u, property::type::Control},
-  {917689u, property::type::Control},
-  {917690u, property::type::Control},
-  {917691u, property::type::Control},
-  {917692u, property::type::Control},
-  {917693u, property::type::Control},
-  {917694u, property::type::Control},
-  {917695u, property::type::Control},
-  {917696u, property::type::Control},
-  {917697u, property::type::Control},
-  {917698u, property::type::Control},
-  {917699u, property::type::Control},
-  {917700u, property::type::Control},
-  {917701u, property::type::Control},
-  {917702u, property::type::Control},
-  {917703u, property::type::Control},
-  {917704u, property::type::Control},
-  {917705u, property::type::Control},
-  {917706u, property::type::Control},
-  {917707u, property::type::Control},
-  {917708u, property::type::Control},
-  {917709u, property::type::Control},
-  {917710u, property::type::Control},
-  {917711u, property::type::Control},
-  {917712u, property::type::Control},
-  {917713u, property::type::Control},
-  {917714u, property::type::Control},
-  {917715u, property::type::Control},
-  {917716u, property::type::Control},
-  {917717u, property::type::Control},
-  {917718u, property::type::Control},
-  {917719u, property::type::Control},
-  {917720u, property::type::Control},
-  {917721u, property::type::Control},
-  {917722u, property::type::Control},
-  {917723u, property::type::Control},
-  {917724u, property::type::Control},
-  {917725u, property::type::Control},
-  {917726u, property::type::Control},
-  {917727u, property::type::Control},
-  {917728u, property::type::Control},
-  {917729u, property::type::Control},
-  {917730u, property::type::Control},
-  {917731u, property::type::Control},
-  {917732u, property::type::Control},
-  {917733u, property::type::Control},
-  {917734u, property::type::Control},
-  {917735u, property::type::Control},
-  {917736u, property::type::Control},
-  {917737u, property::type::Control},
-  {917738u, property::type::Control},
-  {917739u, property::type::Control},
-  {917740u, property::type::Control},
-  {917741u, property::type::Control},
-  {917742u, property::type::Control},
-  {917743u, property::type::Control},
-  {917744u, property::type::Control},
-  {917745u, property::type::Control},
-  {917746u, property::type::Control},
-  {917747u, property::type::Control},
-  {917748u, property::type::Control},
-  {917749u, property::type::Control},
-  {917750u, property::type::Control},
-  {917751u, property::type::Control},
-  {917752u, property::type::Control},
-  {917753u, property::type::Control},
-  {917754u, property::type::Control},
-  {917755u, property::type::Control},
-  {917756u, property::type::Control},
-  {917757u, property::type::Control},
-  {917758u, property::type::Control},
-  {917759u, property::type::Control},
-  {918000u, property::type::Control},
-  {918001u, property::type::Control},
-  {918002u, property::type::Control},
-  {918003u, property::type::Control},
-  {918004u, property::type::Control},
-  {918005u, property::type::Control},
-  {918006u, property::type::Control},
-  {918007u, property::type::Control},
-  {918008u, property::type::Control},
-  {918009u, property::type::Control},
-  {918010u, property::type::Control},
-  {918011u, property::type::Control},
-  {918012u, property::type::Control},
-  {918013u, property::type::Control},
-  {918014u, property::type::Control},
-  {918015u, property::type::Control},
-  {918016u, property::type::Control},
-  {918017u, property::type::Control},
-  {918018u, property::type::Control},
-  {918019u, property::type::Control},
-  {918020u, property::type::Control},
-  {918021u, property::type::Control},
-  {918022u, property::type::Control},
-  {918023u, property::type::Control},
-  {918024u, property::type::Control},
-  {918025u, property::type::Control},
-  {918026u, property::type::Control},
-  {918027u, property::type::Control},
-  {918028u, property::type::Control},
-  {918029u, property::type::Control},
-  {918030u, property::type::Control},
-  {918031u, property::type::Control},
-  {918032u, property::type::Control},
-  {918033u, property::type::Control},
-  {918034u, property::type::Control},
-  {918035u, property::type::Control},
-  {918036u, property::type::Control},
-  {918037u, property::type::Control},
-  {918038u, property::type::Control},
-  {918039u, property::type::Control},
-  {918040u, property::type::Control},
-  {918041u, property::type::Control},
-  {918042u, property::type::Control},
-  {918043u, property::type::Control},
-  {918044u, property::type::Control},
-  {918045u, property::type::Control},
-  {918046u, property::type::Control},
-  {918047u, property::type::Control},
-  {918048u, property::type::Control},
-  {918049u, property::type::Control},
-  {918050u, property::type::Control},
-  {918051u, property::type::Control},
-  {918052u, property::type::Control},
-  {918053u, property::type::Control},
-  {918054u, property::type::Control},
-  {918055u, property::type::Control},
-  {918056u, property::type::Control},
-  {918057u, property::type::Control},
-  {918058u, property::type::Control},
-  {918059u, property::type::Control},
-  {918060u, property::type::Control},
-  {918061u, property::type::Control},
-  {918062u, property::type::Control},
-  {918063u, property::type::Control},
-  {918064u, property::type::Control},
-  {918065u, property::type::Control},
-  {918066u, property::type::Control},
-  {918067u, property::type::Control},
-  {918068u, property::type::Control},
-  {918069u, property::type::Control},
-  {918070u, property::type::Control},
-  {918071u, property::type::Control},
-  {918072u, property::type::Control},
-  {918073u, property::type::Control},
-  {918074u, property::type::Control},
-  {918075u, property::type::Control},
-  {918076u, property::type::Control},
-  {918077u, property::type::Control},
-  {918078u, property::type::Control},
-  {918079u, property::type::Control},
-  {918080u, property::type::Control},
-  {918081u, property::type::Control},
-  {918082u, property::type::Control},
-  {918083u, property::type::Control},
-  {918084u, property::type::Control},
-  {918085u, property::type::Control},
-  {918086u, property::type::Control},
-  {918087u, property::type::Control},
-  {918088u, property::type::Control},
-  {918089u, property::type::Control},
-  {918090u, property::type::Control},
-  {918091u, property::type::Control},
-  {918092u, property::type::Control},
-  {918093u, property::type::Control},
-  {918094u, property::type::Control},
-  {918095u, property::type::Control},
-  {918096u, property::type::Control},
-  {918097u, property::type::Control},
-  {918098u, property::type::Control},
-  {918099u, property::type::Control},
-  {918100u, property::type::Control},
-  {918101u, property::type::Control},
-  {918102u, property::type::Control},
-  {918103u, property::type::Control},
-  {918104u, property::type::Control},
-  {918105u, property::type::Control},
-  {918106u, property::type::Control},
-  {918107u, property::type::Control},
-  {918108u, property::type::Control},
-  {918109u, property::type::Control},
-  {918110u, property::type::Control},
-  {918111u, property::type::Control},
-  {918112u, property::type::Control},
-  {918113u, property::type::Control},
-  {918114u, property::type::Control},
-  {918115u, property::type::Control},
-  {918116u, property::type::Control},
-  {918117u, property::type::Control},
-  {918118u, property::type::Control},
-  {918119u, property::type::Control},
-  {918120u, property::type::Control},
-  {918121u, property::type::Control},
-  {918122u, property::type::Control},
-  {918123u, property::type::Control},
-  {918124u, property::type::Control},
-  {918125u, property::type::Control},
-  {918126u, property::type::Control},
-  {918127u, property::type::Control},
-  {918128u, property::type::Control},
-  {918129u, property::type::Control},
-  {918130u, property::type::Control},
-  {918131u, property::type::Control},
-  {918132u, property::type::Control},
-  {918133u, property::type::Control},
-  {918134u, property::type::Control},
-  {918135u, property::type::Control},
-  {918136u, property::type::Control},
-  {918137u, property::type::Control},
-  {918138u, property::type::Control},
-  {918139u, property::type::Control},
-  {918140u, property::type::Control},
-  {918141u, property::type::Control},
-  {918142u, property::type::Control},
-  {918143u, property::type::Control},
-  {918144u, property::type::Control},
-  {918145u, property::type::Control},
-  {918146u, property::type::Control},
-  {918147u, property::type::Control},
-  {918148u, property::type::Control},
-  {918149u, property::type::Control},
-  {918150u, property::type::Control},
-  {918151u, property::type::Control},
-  {918152u, property::type::Control},
-  {918153u, property::type::Control},
-  {918154u, property::type::Control},
-  {918155u, property::type::Control},
-  {918156u, property::type::Control},
-  {918157u, property::type::Control},
-  {918158u, property::type::Control},
-  {918159u, property::type::Control},
-  {918160u, property::type::Control},
-  {918161u, property::type::Control},
-  {918162u, property::type::Control},
-  {918163u, property::type::Control},
-  {918164u, property::type::Control},
-  {918165u, property::type::Control},
-  {918166u, property::type::Control},
-  {918167u, property::type::Control},
-  {918168u, property::type::Control},
-  {918169u, property::type::Control},
-  {918170u, property::type::Control},
-  {918171u, property::type::Control},
-  {918172u, property::type::Control},
-  {918173u, property::type::Control},
-  {918174u, property::type::Control},
-  {918175u, property::type::Control},
-  {918176u, property::type::Control},
-  {918177u, property::type::Control},
-  {918178u, property::type::Control},
-  {918179u, property::type::Control},
-  {918180u, property::type::Control},
-  {918181u, property::type::Control},
-  {918182u, property::type::Control},
-  {918183u, property::type::Control},
-  {918184u, property::type::Control},
-  {918185u, property::type::Control},
-  {918186u, property::type::Control},
-  {918187u, property::type::Control},
-  {918188u, property::type::Control},
-  {918189u, property::type::Control},
-  {918190u, property::type::Control},
-  {918191u, property::type::Control},
-  {918192u, property::type::Control},
-  {918193u, property::type::Control},
-  {918194u, property::type::Control},
-  {918195u, property::type::Control},
-  {918196u, property::type::Control},
-  {918197u, property::type::Control},
-  {918198u, property::type::Control},
-  {918199u, property::type::Control},
-  {918200u, property::type::Control},
-  {918201u, property::type::Control},
-  {918202u, property::type::Control},
-  {918203u, property::type::Control},
-  {918204u, property::type::Control},
-  {918205u, property::type::Control},
-  {918206u, property::type::Control},
-  {918207u, property::type::Control},
-  {918208u, property::type::Control},
-  {918209u, property::type::Control},
-  {918210u, property::type::Control},
-  {918211u, property::type::Control},
-  {918212u, property::type::Control},
-  {918213u, property::type::Control},
-  {918214u, property::type::Control},
-  {918215u, property::type::Control},
-  {918216u, property::type::Control},
-  {918217u, property::type::Control},
-  {918218u, property::type::Control},
-  {918219u, property::type::Control},
-  {918220u, property::type::Control},
-  {918221u, property::type::Control},
-  {918222u, property::type::Control},
-  {918223u, property::type::Control},
-  {918224u, property::type::Control},
-  {918225u, property::type::Control},
-  {918226u, property::type::Control},
-  {918227u, property::type::Control},
-  {918228u, property::type::Control},
-  {918229u, property::type::Control},
-  {918230u, property::type::Control},
-  {918231u, property::type::Control},
-  {918232u, property::type::Control},
-  {918233u, property::type::Control},
-  {918234u, property::type::Control},
-  {918235u, property::type::Control},
-  {918236u, property::type::Control},
-  {918237u, property::type::Control},
-  {918238u, property::type::Control},
-  {918239u, property::type::Control},
-  {918240u, property::type::Control},
-  {918241u, property::type::Control},
-  {918242u, property::type::Control},
-  {918243u, property::type::Control},
-  {918244u, property::type::Control},
-  {918245u, property::type::Control},
-  {918246u, property::type::Control},
-  {918247u, property::type::Control},
-  {918248u, property::type::Control},
-  {918249u, property::type::Control},
-  {918250u, property::type::Control},
-  {918251u, property::type::Control},
-  {918252u, property::type::Control},
-  {918253u, property::type::Control},
-  {918254u, property::type::Control},
-  {918255u, property::type::Control},
-  {918256u, property::type::Control},
-  {918257u, property::type::Control},
-  {918258u, property::type::Control},
-  {918259u, property::type::Control},
-  {918260u, property::type::Control},
-  {918261u, property::type::Control},
-  {918262u, property::type::Control},
-  {918263u, property::type::Control},
-  {918264u, property::type::Control},
-  {918265u, property::type::Control},
-  {918266u, property::type::Control},
-  {918267u, property::type::Control},
-  {918268u, property::type::Control},
-  {918269u, property::type::Control},
-  {918270u, property::type::Control},
-  {918271u, property::type::Control},
-  {918272u, property::type::Control},
-  {918273u, property::type::Control},
-  {918274u, property::type::Control},
-  {918275u, property::type::Control},
-  {918276u, property::type::Control},
-  {918277u, property::type::Control},
-  {918278u, property::type::Control},
-  {918279u, property::type::Control},
-  {918280u, property::type::Control},
-  {918281u, property::type::Control},
-  {918282u, property::type::Control},
-  {918283u, property::type::Control},
-  {918284u, property::type::Control},
-  {918285u, property::type::Control},
-  {918286u, property::type::Control},
-  {918287u, property::type::Control},
-  {918288u, property::type::Control},
-  {918289u, property::type::Control},
-  {918290u, property::type::Control},
-  {918291u, property::type::Control},
-  {918292u, property::type::Control},
-  {918293u, property::type::Control},
-  {918294u, property::type::Control},
-  {918295u, property::type::Control},
-  {918296u, property::type::Control},
-  {918297u, property::type::Control},
-  {918298u, property::type::Control},
-  {918299u, property::type::Control},
-  {918300u, property::type::Control},
-  {918301u, property::type::Control},
-  {918302u, property::type::Control},
-  {918303u, property::type::Control},
-  {918304u, property::type::Control},
-  {918305u, property::type::Control},
-  {918306u, property::type::Control},
-  {918307u, property::type::Control},
-  {918308u, property::type::Control},
-  {918309u, property::type::Control},
-  {918310u, property::type::Control},
-  {918311u, property::type::Control},
-  {918312u, property::type::Control},
-  {918313u, property::type::Control},
-  {918314u, property::type::Control},
-  {918315u, property::type::Control},
-  {918316u, property::type::Control},
-  {918317u, property::type::Control},
-  {918318u, property::type::Control},
-  {918319u, property::type::Control},
-  {918320u, property::type::Control},
-  {918321u, property::type::Control},
-  {918322u, property::type::Control},
-  {918323u, property::type::Control},
-  {918324u, property::type::Control},
-  {918325u, property::type::Control},
-  {918326u, property::type::Control},
-  {918327u, property::type::Control},
-  {918328u, property::type::Control},
-  {918329u, property::type::Control},
-  {918330u, property::type::Control},
-  {918331u, property::type::Control},
-  {918332u, property::type::Control},
-  {918333u, property::type::Control},
-  {918334u, property::type::Control},
-  {918335u, property::type::Control},
-  {918336u, property::type::Control},
-  {918337u, property::type::Control},
-  {918338u, property::type::Control},
-  {918339u, property::type::Control},
-  {918340u, property::type::Control},
-  {918341u, property::type::Control},
-  {918342u, property::type::Control},
-  {918343u, property::type::Control},
-  {918344u, property::type::Control},
-  {918345u, property::type::Control},
-  {918346u, property::type::Control},
-  {918347u, property::type::Control},
-  {918348u, property::type::Control},
-  {918349u, property::type::Control},
-  {918350u, property::type::Control},
-  {918351u, property::type::Control},
-  {918352u, property::type::Control},
-  {918353u, property::type::Control},
-  {918354u, property::type::Control},
-  {918355u, property::type::Control},
-  {918356u, property::type::Control},
-  {918357u, property::type::Control},
-  {918358u, property::type::Control},
-  {918359u, property::type::Control},
-  {918360u, property::type::Control},
-  {918361u, property::type::Control},
-  {918362u, property::type::Control},
-  {918363u, property::type::Control},
-  {918364u, property::type::Control},
-  {918365u, property::type::Control},
-  {918366u, property::type::Control},
-  {918367u, property::type::Control},
-  {918368u, property::type::Control},
-  {918369u, property::type::Control},
-  {918370u, property::type::Control},
-  {918371u, property::type::Control},
-  {918372u, property::type::Control},
-  {918373u, property::type::Control},
-  {918374u, property::type::Control},
-  {918375u, property::type::Control},
-  {918376u, property::type::Control},
-  {918377u, property::type::Control},
-  {918378u, property::type::Control},
-  {918379u, property::type::Control},
-  {918380u, property::type::Control},
-  {918381u, property::type::Control},
-  {918382u, property::type::Control},
-  {918383u, property::type::Control},
-  {918384u, property::type::Control},
-  {918385u, property::type::Control},
-  {918386u, property::type::Control},
-  {918387u, property::type::Control},
-  {918388u, property::type::Control},
-  {918389u, property::type::Control},
-  {918390u, property::type::Control},
-  {918391u, property::type::Control},
-  {918392u, property::type::Control},
-  {918393u, property::type::Control},
-  {918394u, property::type::Control},
-  {918395u, property::type::Control},
-  {918396u, property::type::Control},
-  {918397u, property::type::Control},
-  {918398u, property::type::Control},
-  {918399u, property::type::Control},
-  {918400u, property::type::Control},
-  {918401u, property::type::Control},
-  {918402u, property::type::Control},
-  {918403u, property::type::Control},
-  {918404u, property::type::Control},
-  {918405u, property::type::Control},
-  {918406u, property::type::Control},
-  {918407u, property::type::Control},
-  {918408u, property::type::Control},
-  {918409u, property::type::Control},
-  {918410u, property::type::Control},
-  {918411u, property::type::Control},
-  {918412u, property::type::Control},
-  {918413u, property::type::Control},
-  {918414u, property::type::Control},
-  {918415u, property::type::Control},
-  {918416u, property::type::Control},
-  {918417u, property::type::Control},
-  {918418u, property::type::Control},
-  {918419u, property::type::Control},
-  {918420u, property::type::Control},
-  {918421u, property::type::Control},
-  {918422u, property::type::Control},
-  {918423u, property::type::Control},
-  {918424u, property::type::Control},
-  {918425u, property::type::Control},
-  {918426u, property::type::Control},
-  {918427u, property::type::Control},
-  {918428u, property::type::Control},
-  {918429u, property::type::Control},
-  {918430u, property::type::Control},
-  {918431u, property::type::Control},
-  {918432u, property::type::Control},
-  {918433u, property::type::Control},
-  {918434u, property::type::Control},
-  {918435u, property::type::Control},
-  {918436u, property::type::Control},
-  {918437u, property::type::Control},
-  {918438u, property::type::Control},
-  {918439u, property::type::Control},
-  {918440u, property::type::Control},
-  {918441u, property::type::Control},
-  {918442u, property::type::Control},
-  {918443u, property::type::Control},
-  {918444u, property::type::Control},
-  {918445u, property::type::Control},
-  {918446u, property::type::Control},
-  {918447u, property::type::Control},
-  {918448u, property::type::Control},
-  {918449u, property::type::Control},
-  {918450u, property::type::Control},
-  {918451u, property::type::Control},
-  {918452u, property::type::Control},
-  {918453u, property::type::Control},
-  {918454u, property::type::Control},
-  {918455u, property::type::Control},
-  {918456u, property::type::Control},
-  {918457u, property::type::Control},
-  {918458u, property::type::Control},
-  {918459u, property::type::Control},
-  {918460u, property::type::Control},
-  {918461u, property::type::Control},
-  {918462u, property::type::Control},
-  {918463u, property::type::Control},
-  {918464u, property::type::Control},
-  {918465u, property::type::Control},
-  {918466u, property::type::Control},
-  {918467u, property::type::Control},
-  {918468u, property::type::Control},
-  {918469u, property::type::Control},
-  {918470u, property::type::Control},
-  {918471u, property::type::Control},
-  {918472u, property::type::Control},
-  {918473u, property::type::Control},
-  {918474u, property::type::Control},
-  {918475u, property::type::Control},
-  {918476u, property::type::Control},
-  {918477u, property::type::Control},
-  {918478u, property::type::Control},
-  {918479u, property::type::Control},
-  {918480u, property::type::Control},
-  {918481u, property::type::Control},
-  {918482u, property::type::Control},
-  {918483u, property::type::Control},
-  {918484u, property::type::Control},
-  {918485u, property::type::Control},
-  {918486u, property::type::Control},
-  {918487u, property::type::Control},
-  {918488u, property::type::Control},
-  {918489u, property::type::Control},
-  {918490u, property::type::Control},
-  {918491u, property::type::Control},
-  {918492u, property::type::Control},
-  {918493u, property::type::Control},
-  {918494u, property::type::Control},
-  {918495u, property::type::Control},
-  {918496u, property::type::Control},
-  {918497u, property::type::Control},
-  {918498u, property::type::Control},
-  {918499u, property::type::Control},
-  {918500u, property::type::Control},
-  {918501u, property::type::Control},
-  {918502u, property::type::Control},
-  {918503u, property::type::Control},
-  {918504u, property::type::Control},
-  {918505u, property::type::Control},
-  {918506u, property::type::Control},
-  {918507u, property::type::Control},
-  {918508u, property::type::Control},
-  {918509u, property::type::Control},
-  {918510u, property::type::Control},
-  {918511u, property::type::Control},
-  {918512u, property::type::Control},
-  {918513u, property::type::Control},
-  {918514u, property::type::Control},
-  {918515u, property::type::Control},
-  {918516u, property::type::Control},
-  {918517u, property::type::Control},
-  {918518u, property::type::Control},
-  {918519u, property::type::Control},
-  {918520u, property::type::Control},
-  {918521u, property::type::Control},
-  {918522u, property::type::Control},
-  {918523u, property::type::Control},
-  {918524u, property::type::Control},
-  {918525u, property::type::Control},
-  {918526u, property::type::Control},
-  {918527u, property::type::Control},
-  {918528u, property::type::Control},
-  {918529u, property::type::Control},
-  {918530u, property::type::Control},
-  {918531u, property::type::Control},
-  {918532u, property::type::Control},
-  {918533u, property::type::Control},
-  {918534u, property::type::Control},
-  {918535u, property::type::Control},
-  {918536u, property::type::Control},
-  {918537u, property::type::Control},
-  {918538u, property::type::Control},
-  {918539u, property::type::Control},
-  {918540u, property::type::Control},
-  {918541u, property::type::Control},
-  {918542u, property::type::Control},
-  {918543u, property::type::Control},
-  {918544u, property::type::Control},
-  {918545u, property::type::Control},
-  {918546u, property::type::Control},
-  {918547u, property::type::Control},
-  {918548u, property::type::Control},
-  {918549u, property::type::Control},
-  {918550u, property::type::Control},
-  {918551u, property::type::Control},
-  {918552u, property::type::Control},
-  {918553u, property::type::Control},
-  {918554u, property::type::Control},
-  {918555u, property::type::Control},
-  {918556u, property::type::Control},
-  {918557u, property::type::Control},
-  {918558u, property::type::Control},
-  {918559u, property::type::Control},
-  {918560u, property::type::Control},
-  {918561u, property::type::Control},
-  {918562u, property::type::Control},
-  {918563u, property::type::Control},
-  {918564u, property::type::Control},
-  {918565u, property::type::Control},
-  {918566u, property::type::Control},
-  {918567u, property::type::Control},
-  {918568u, property::type::Control},
-  {918569u, property::type::Control},
-  {918570u, property::type::Control},
-  {918571u, property::type::Control},
-  {918572u, property::type::Control},
-  {918573u, property::type::Control},
-  {918574u, property::type::Control},
-  {918575u, property::type::Control},
-  {918576u, property::type::Control},
-  {918577u, property::type::Control},
-  {918578u, property::type::Control},
-  {918579u, property::type::Control},
-  {918580u, property::type::Control},
-  {918581u, property::type::Control},
-  {918582u, property::type::Control},
-  {918583u, property::type::Control},
-  {918584u, property::type::Control},
-  {918585u, property::type::Control},
-  {918586u, property::type::Control},
-  {918587u, property::type::Control},
-  {918588u, property::type::Control},
-  {918589u, property::type::Control},
-  {918590u, property::type::Control},
-  {918591u, property::type::Control},
-  {918592u, property::type::Control},
-  {918593u, property::type::Control},
-  {918594u, property::type::Control},
-  {918595u, property::type::Control},
-  {918596u, property::type::Control},
-  {918597u, property::type::Control},
-  {918598u, property::type::Control},
-  {918599u, property::type::Control},
-  {918600u, property::type::Control},
-  {918601u, property::type::Control},
-  {918602u, property::type::Control},
-  {918603u, property::type::Control},
-  {918604u, property::type::Control},
-  {918605u, property::type::Control},
-  {918606u, property::type::Control},
-  {918607u, property::type::Control},
-  {918608u, property::type::Control},
-  {918609u, property::type::Control},
-  {918610u, property::type::Control},
-  {918611u, property::type::Control},
-  {918612u, property::type::Control},
-  {918613u, property::type::Control},
-  {918614u, property::type::Control},
-  {918615u, property::type::Control},
-  {918616u, property::type::Control},
-  {918617u, property::type::Control},
-  {918618u, property::type::Control},
-  {918619u, property::type::Control},
-  {918620u, property::type::Control},
-  {918621u, property::type::Control},
-  {918622u, property::type::Control},
-  {918623u, property::type::Control},
-  {918624u, property::type::Control},
-  {918625u, property::type::Control},
-  {918626u, property::type::Control},
-  {918627u, property::type::Control},
-  {918628u, property::type::Control},
-  {918629u, property::type::Control},
-  {918630u, property::type::Control},
-  {918631u, property::type::Control},
-  {918632u, property::type::Control},
-  {918633u, property::type::Control},
-  {918634u, property::type::Control},
-  {918635u, property::type::Control},
-  {918636u, property::type::Control},
-  {918637u, property::type::Control},
-  {918638u, property::type::Control},
-  {918639u, property::type::Control},
-  {918640u, property::type::Control},
-  {918641u, property::type::Control},
-  {918642u, property::type::Control},
-  {918643u, property::type::Control},
-  {918644u, property::type::Control},
-  {918645u, property::type::Control},
-  {918646u, property::type::Control},
-  {918647u, property::type::Control},
-  {918648u, property::type::Control},
-  {918649u, property::type::Control},
-  {918650u, property::type::Control},
-  {918651u, property::type::Control},
-  {918652u, property::type::Control},
-  {918653u, property::type::Control},
-  {918654u, property::type::Control},
-  {918655u, property::type::Control},
-  {918656u, property::type::Control},
-  {918657u, property::type::Control},
-  {918658u, property::type::Control},
-  {918659u, property::type::Control},
-  {918660u, property::type::Control},
-  {918661u, property::type::Control},
-  {918662u, property::type::Control},
-  {918663u, property::type::Control},
-  {918664u, property::type::Control},
-  {918665u, property::type::Control},
-  {918666u, property::type::Control},
-  {918667u, property::type::Control},
-  {918668u, property::type::Control},
-  {918669u, property::type::Control},
-  {918670u, property::type::Control},
-  {918671u, property::type::Control},
-  {918672u, property::type::Control},
-  {918673u, property::type::Control},
-  {918674u, property::type::Control},
-  {918675u, property::type::Control},
-  {918676u, property::type::Control},
-  {918677u, property::type::Control},
-  {918678u, property::type::Control},
-  {918679u, property::type::Control},
-  {918680u, property::type::Control},
-  {918681u, property::type::Control},
-  {918682u, property::type::Control},
-  {918683u, property::type::Control},
-  {918684u, property::type::Control},
-  {918685u, property::type::Control},
-  {918686u, property::type::Control},
-  {918687u, property::type::Control},
-  {918688u, property::type::Control},
-  {918689u, property::type::Control},
-  {918690u, property::type::Control},
-  {918691u, property::type::Control},
-  {918692u, property::type::Control},
-  {918693u, property::type::Control},
-  {918694u, property::type::Control},
-  {918695u, property::type::Control},
-  {918696u, property::type::Control},
-  {918697u, property::type::Control},
-  {918698u, property::type::Control},
-  {918699u, property::type::Control},
-  {918700u, property::type::Control},
-  {918701u, property::type::Control},
-  {918702u, property::type::Control},
-  {918703u, property::type::Control},
-  {918704u, property::type::Control},
-  {918705u, property::type::Control},
-  {918706u, property::type::Control},
-  {918707u, property::type::Control},
-  {918708u, property::type::Control},
-  {918709u, property::type::Control},
-  {918710u, property::type::Control},
-  {918711u, property::type::Control},
-  {918712u, property::type::Control},
-  {918713u, property::type::Control},
-  {918714u, property::type::Control},
-  {918715u, property::type::Control},
-  {918716u, property::type::Control},
-  {918717u, property::type::Control},
-  {918718u, property::type::Control},
-  {918719u, property::type::Control},
-  {918720u, property::type::Control},
-  {918721u, property::type::Control},
-  {918722u, property::type::Control},
-  {918723u, property::type::Control},
-  {918724u, property::type::Control},
-  {918725u, property::type::Control},
-  {918726u, property::type::Control},
-  {918727u, property::type::Control},
-  {918728u, property::type::Control},
-  {918729u, property::type::Control},
-  {918730u, property::type::Control},
-  {918731u, property::type::Control},
-  {918732u, property::type::Control},
-  {918733u, property::type::Control},
-  {918734u, property::type::Control},
-  {918735u, property::type::Control},
-  {918736u, property::type::Control},
-  {918737u, property::type::Control},
-  {918738u, property::type::Control},
-  {918739u, property::type::Control},
-  {918740u, property::type::Control},
-  {918741u, property::type::Control},
-  {918742u, property::type::Control},
-  {918743u, property::type::Control},
-  {918744u, property::type::Control},
-  {918745u, property::type::Control},
-  {918746u, property::type::Control},
-  {918747u, property::type::Control},
-  {918748u, property::type::Control},
-  {918749u, property::type::Control},
-  {918750u, property::type::Control},
-  {918751u, property::type::Control},
-  {918752u, property::type::Control},
-  {918753u, property::type::Control},
-  {918754u, property::type::Control},
-  {918755u, property::type::Control},
-  {918756u, property::type::Control},
-  {918757u, property::type::Control},
-  {918758u, property::type::Control},
-  {918759u, property::type::Control},
-  {918760u, property::type::Control},
-  {918761u, property::type::Control},
-  {918762u, property::type::Control},
-  {918763u, property::type::Control},
-  {918764u, property::type::Control},
-  {918765u, property::type::Control},
-  {918766u, property::type::Control},
-  {918767u, property::type::Control},
-  {918768u, property::type::Control},
-  {918769u, property::type::Control},
-  {918770u, property::type::Control},
-  {918771u, property::type::Control},
-  {918772u, property::type::Control},
-  {918773u, property::type::Control},
-  {918774u, property::type::Control},
-  {918775u, property::type::Control},
-  {918776u, property::type::Control},
-  {918777u, property::type::Control},
-  {918778u, property::type::Control},
-  {918779u, property::type::Control},
-  {918780u, property::type::Control},
-  {918781u, property::type::Control},
-  {918782u, property::type::Control},
-  {918783u, property::type::Control},
-  {918784u, property::type::Control},
-  {918785u, property::type::Control},
-  {918786u, property::type::Control},
-  {918787u, property::type::Control},
-  {918788u, property::type::Control},
-  {918789u, property::type::Control},
-  {918790u, property::type::Control},
-  {918791u, property::type::Control},
-  {918792u, property::type::Control},
-  {918793u, property::type::Control},
-  {918794u, property::type::Control},
-  {918795u, property::type::Control},
-  {918796u, property::type::Control},
-  {918797u, property::type::Control},
-  {918798u, property::type::Control},
-  {918799u, property::type::Control},
-  {918800u, property::type::Control},
-  {918801u, property::type::Control},
-  {918802u, property::type::Control},
-  {918803u, property::type::Control},
-  {918804u, property::type::Control},
-  {918805u, property::type::Control},
-  {918806u, property::type::Control},
-  {918807u, property::type::Control},
-  {918808u, property::type::Control},
-  {918809u, property::type::Control},
-  {918810u, property::type::Control},
-  {918811u, property::type::Control},
-  {918812u, property::type::Control},
-  {918813u, property::type::Control},
-  {918814u, property::type::Control},
-  {918815u, property::type::Control},
-  {918816u, property::type::Control},
-  {918817u, property::type::Control},
-  {918818u, property::type::Control},
-  {918819u, property::type::Control},
-  {918820u, property::type::Control},
-  {918821u, property::type::Control},
-  {918822u, property::type::Control},
-  {918823u, property::type::Control},
-  {918824u, property::type::Control},
-  {918825u, property::type::Control},
-  {918826u, property::type::Control},
-  {918827u, property::type::Control},
-  {918828u, property::type::Control},
-  {918829u, property::type::Control},
-  {918830u, property::type::Control},
-  {918831u, property::type::Control},
-  {918832u, property::type::Control},
-  {918833u, property::type::Control},
-  {918834u, property::type::Control},
-  {918835u, property::type::Control},
-  {918836u, property::type::Control},
-  {918837u, property::type::Control},
-  {918838u, property::type::Control},
-  {918839u, property::type::Control},
-  {918840u, property::type::Control},
-  {918841u, property::type::Control},
-  {918842u, property::type::Control},
-  {918843u, property::type::Control},
-  {918844u, property::type::Control},
-  {918845u, property::type::Control},
-  {918846u, property::type::Control},
-  {918847u, property::type::Control},
-  {918848u, property::type::Control},
-  {918849u, property::type::Control},
-  {918850u, property::type::Control},
-  {918851u, property::type::Control},
-  {918852u, property::type::Control},
-  {918853u, property::type::Control},
-  {918854u, property::type::Control},
-  {918855u, property::type::Control},
-  {918856u, property::type::Control},
-  {918857u, property::type::Control},
-  {918858u, property::type::Control},
-  {918859u, property::type::Control},
-  {918860u, property::type::Control},
-  {918861u, property::type::Control},
-  {918862u, property::type::Control},
-  {918863u, property::type::Control},
-  {918864u, property::type::Control},
-  {918865u, property::type::Control},
-  {918866u, property::type::Control},
-  {918867u, property::type::Control},
-  {918868u, property::type::Control},
-  {918869u, property::type::Control},
-  {918870u, property::type::Control},
-  {918871u, property::type::Control},
-  {918872u, property::type::Control},
-  {918873u, property::type::Control},
-  {918874u, property::type::Control},
-  {918875u, property::type::Control},
-  {918876u, property::type::Control},
-  {918877u, property::type::Control},
-  {918878u, property::type::Control},
-  {918879u, property::type::Control},
-  {918880u, property::type::Control},
-  {918881u, property::type::Control},
-  {918882u, property::type::Control},
-  {918883u, property::type::Control},
-  {918884u, property::type::Control},
-  {918885u, property::type::Control},
-  {918886u, property::type::Control},
-  {918887u, property::type::Control},
-  {918888u, property::type::Control},
-  {918889u, property::type::Control},
-  {918890u, property::type::Control},
-  {918891u, property::type::Control},
-  {918892u, property::type::Control},
-  {918893u, property::type::Control},
-  {918894u, property::type::Control},
-  {918895u, property::type::Control},
-  {918896u, property::type::Control},
-  {918897u, property::type::Control},
-  {918898u, property::type::Control},
-  {918899u, property::type::Control},
-  {918900u, property::type::Control},
-  {918901u, property::type::Control},
-  {918902u, property::type::Control},
-  {918903u, property::type::Control},
-  {918904u, property::type::Control},
-  {918905u, property::type::Control},
-  {918906u, property::type::Control},
-  {918907u, property::type::Control},
-  {918908u, property::type::Control},
-  {918909u, property::type::Control},
-  {918910u, property::type::Control},
-  {918911u, property::type::Control},
-  {918912u, property::type::Control},
-  {918913u, property::type::Control},
-  {918914u, property::type::Control},
-  {918915u, property::type::Control},
-  {918916u, property::type::Control},
-  {918917u, property::type::Control},
-  {918918u, property::type::Control},
-  {918919u, property::type::Control},
-  {918920u, property::type::Control},
-  {918921u, property::type::Control},
-  {918922u, property::type::Control},
-  {918923u, property::type::Control},
-  {918924u, property::type::Control},
-  {918925u, property::type::Control},
-  {918926u, property::type::Control},
-  {918927u, property::type::Control},
-  {918928u, property::type::Control},
-  {918929u, property::type::Control},
-  {918930u, property::type::Control},
-  {918931u, property::type::Control},
-  {918932u, property::type::Control},
-  {918933u, property::type::Control},
-  {918934u, property::type::Control},
-  {918935u, property::type::Control},
-  {918936u, property::type::Control},
-  {918937u, property::type::Control},
-  {918938u, property::type::Control},
-  {918939u, property::type::Control},
-  {918940u, property::type::Control},
-  {918941u, property::type::Control},
-  {918942u, property::type::Control},
-  {918943u, property::type::Control},
-  {918944u, property::type::Control},
-  {918945u, property::type::Control},
-  {918946u, property::type::Control},
-  {918947u, property::type::Control},
-  {918948u, property::type::Control},
-  {918949u, property::type::Control},
-  {918950u, property::type::Control},
-  {918951u, property::type::Control},
-  {918952u, property::type::Control},
-  {918953u, property::type::Control},
-  {918954u, property::type::Control},
-  {918955u, property::type::Control},
-  {918956u, property::type::Control},
-  {918957u, property::type::Control},
-  {918958u, property::type::Control},
-  {918959u, property::type::Control},
-  {918960u, property::type::Control},
-  {918961u, property::type::Control},
-  {918962u, property::type::Control},
-  {918963u, property::type::Control},
-  {918964u, property::type::Control},
-  {918965u, property::type::Control},
-  {918966u, property::type::Control},
-  {918967u, property::type::Control},
-  {918968u, property::type::Control},
-  {918969u, property::type::Control},
-  {918970u, property::type::Control},
-  {918971u, property::type::Control},
-  {918972u, property::type::Control},
-  {918973u, property::type::Control},
-  {918974u, property::type::Control},
-  {918975u, property::type::Control},
-  {918976u, property::type::Control},
-  {918977u, property::type::Control},
-  {918978u, property::type::Control},
-  {918979u, property::type::Control},
-  {918980u, property::type::Control},
-  {918981u, property::type::Control},
-  {918982u, property::type::Control},
-  {918983u, property::type::Control},
-  {918984u, property::type::Control},
-  {918985u, property::type::Control},
-  {918986u, property::type::Control},
-  {918987u, property::type::Control},
-  {918988u, property::type::Control},
-  {918989u, property::type::Control},
-  {918990u, property::type::Control},
-  {918991u, property::type::Control},
-  {918992u, property::type::Control},
-  {918993u, property::type::Control},
-  {918994u, property::type::Control},
-  {918995u, property::type::Control},
-  {918996u, property::type::Control},
-  {918997u, property::type::Control},
-  {918998u, property::type::Control},
-  {918999u, property::type::Control},
-  {919000u, property::type::Control},
-  {919001u, property::type::Control},
-  {919002u, property::type::Control},
-  {919003u, property::type::Control},
-  {919004u, property::type::Control},
-  {919005u, property::type::Control},
-  {919006u, property::type::Control},
-  {919007u, property::type::Control},
-  {919008u, property::type::Control},
-  {919009u, property::type::Control},
-  {919010u, property::type::Control},
-  {919011u, property::type::Control},
-  {919012u, property::type::Control},
-  {919013u, property::type::Control},
-  {919014u, property::type::Control},
-  {919015u, property::type::Control},
-  {919016u, property::type::Control},
-  {919017u, property::type::Control},
-  {919018u, property::type::Control},
-  {919019u, property::type::Control},
-  {919020u, property::type::Control},
-  {919021u, property::type::Control},
-  {919022u, property::type::Control},
-  {919023u, property::type::Control},
-  {919024u, property::type::Control},
-  {919025u, property::type::Control},
-  {919026u, property::type::Control},
-  {919027u, property::type::Control},
-  {919028u, property::type::Control},
-  {919029u, property::type::Control},
-  {919030u, property::type::Control},
-  {919031u, property::type::Control},
-  {919032u, property::type::Control},
-  {919033u, property::type::Control},
-  {919034u, property::type::Control},
-  {919035u, property::type::Control},
-  {919036u, property::type::Control},
-  {919037u, property::type::Control},
-  {919038u, property::type::Control},
-  {919039u, property::type::Control},
-  {919040u, property::type::Control},
-  {919041u, property::type::Control},
-  {919042u, property::type::Control},
-  {919043u, property::type::Control},
-  {919044u, property::type::Control},
-  {919045u, property::type::Control},
-  {919046u, property::type::Control},
-  {919047u, property::type::Control},
-  {919048u, property::type::Control},
-  {919049u, property::type::Control},
-  {919050u, property::type::Control},
-  {919051u, property::type::Control},
-  {919052u, property::type::Control},
-  {919053u, property::type::Control},
-  {919054u, property::type::Control},
-  {919055u, property::type::Control},
-  {919056u, property::type::Control},
-  {919057u, property::type::Control},
-  {919058u, property::type::Control},
-  {919059u, property::type::Control},
-  {919060u, property::type::Control},
-  {919061u, property::type::Control},
-  {919062u, property::type::Control},
-  {919063u, property::type::Control},
-  {919064u, property::type::Control},
-  {919065u, property::type::Control},
-  {919066u, property::type::Control},
-  {919067u, property::type::Control},
-  {919068u, property::type::Control},
-  {919069u, property::type::Control},
-  {919070u, property::type::Control},
-  {919071u, property::type::Control},
-  {919072u, property::type::Control},
-  {919073u, property::type::Control},
-  {919074u, property::type::Control},
-  {919075u, property::type::Control},
-  {919076u, property::type::Control},
-  {919077u, property::type::Control},
-  {919078u, property::type::Control},
-  {919079u, property::type::Control},
-  {919080u, property::type::Control},
-  {919081u, property::type::Control},
-  {919082u, property::type::Control},
-  {919083u, property::type::Control},
-  {919084u, property::type::Control},
-  {919085u, property::type::Control},
-  {919086u, property::type::Control},
-  {919087u, property::type::Control},
-  {919088u, property::type::Control},
-  {919089u, property::type::Control},
-  {919090u, property::type::Control},
-  {919091u, property::type::Control},
-  {919092u, property::type::Control},
-  {919093u, property::type::Control},
-  {919094u, property::type::Control},
-  {919095u, property::type::Control},
-  {919096u, property::type::Control},
-  {919097u, property::type::Control},
-  {919098u, property::type::Control},
-  {919099u, property::type::Control},
-  {919100u, property::type::Control},
-  {919101u, property::type::Control},
-  {919102u, property::type::Control},
-  {919103u, property::type::Control},
-  {919104u, property::type::Control},
-  {919105u, property::type::Control},
-  {919106u, property::type::Control},
-  {919107u, property::type::Control},
-  {919108u, property::type::Control},
-  {919109u, property::type::Control},
-  {919110u, property::type::Control},
-  {919111u, property::type::Control},
-  {919112u, property::type::Control},
-  {919113u, property::type::Control},
-  {919114u, property::type::Control},
-  {919115u, property::type::Control},
-  {919116u, property::type::Control},
-  {919117u, property::type::Control},
-  {919118u, property::type::Control},
-  {919119u, property::type::Control},
-  {919120u, property::type::Control},
-  {919121u, property::type::Control},
-  {919122u, property::type::Control},
-  {919123u, property::type::Control},
-  {919124u, property::type::Control},
-  {919125u, property::type::Control},
-  {919126u, property::type::Control},
-  {919127u, property::type::Control},
-  {919128u, property::type::Control},
-  {919129u, property::type::Control},
-  {919130u, property::type::Control},
-  {919131u, property::type::Control},
-  {919132u, property::type::Control},
-  {919133u, property::type::Control},
-  {919134u, property::type::Control},
-  {919135u, property::type::Control},
-  {919136u, property::type::Control},
-  {919137u, property::type::Control},
-  {919138u, property::type::Control},
-  {919139u, property::type::Control},
-  {919140u, property::type::Control},
-  {919141u, property::type::Control},
-  {919142u, property::type::Control},
-  {919143u, property::type::Control},
-  {919144u, property::type::Control},
-  {919145u, property::type::Control},
-  {919146u, property::type::Control},
-  {919147u, property::type::Control},
-  {919148u, property::type::Control},
-  {919149u, property::type::Control},
-  {919150u, property::type::Control},
-  {919151u, property::type::Control},
-  {919152u, property::type::Control},
-  {919153u, property::type::Control},
-  {919154u, property::type::Control},
-  {919155u, property::type::Control},
-  {919156u, property::type::Control},
-  {919157u, property::type::Control},
-  {919158u, property::type::Control},
-  {919159u, property::type::Control},
-  {919160u, property::type::Control},
-  {919161u, property::type::Control},
-  {919162u, property::type::Control},
-  {919163u, property::type::Control},
-  {919164u, property::type::Control},
-  {919165u, property::type::Control},
-  {919166u, property::type::Control},
-  {919167u, property::type::Control},
-  {919168u, property::type::Control},
-  {919169u, property::type::Control},
-  {919170u, property::type::Control},
-  {919171u, property::type::Control},
-  {919172u, property::type::Control},
-  {919173u, property::type::Control},
-  {919174u, property::type::Control},
-  {919175u, property::type::Control},
-  {919176u, property::type::Control},
-  {919177u, property::type::Control},
-  {919178u, property::type::Control},
-  {919179u, property::type::Control},
-  {919180u, property::type::Control},
-  {919181u, property::type::Control},
-  {919182u, property::type::Control},
-  {919183u, property::type::Control},
-  {919184u, property::type::Control},
-  {919185u, property::type::Control},
-  {919186u, property::type::Control},
-  {919187u, property::type::Control},
-  {919188u, property::type::Control},
-  {919189u, property::type::Control},
-  {919190u, property::type::Control},
-  {919191u, property::type::Control},
-  {919192u, property::type::Control},
-  {919193u, property::type::Control},
-  {919194u, property::type::Control},
-  {919195u, property::type::Control},
-  {919196u, property::type::Control},
-  {919197u, property::type::Control},
-  {919198u, property::type::Control},
-  {919199u, property::type::Control},
-  {919200u, property::type::Control},
-  {919201u, property::type::Control},
-  {919202u, property::type::Control},
-  {919203u, property::type::Control},
-  {919204u, property::type::Control},
-  {919205u, property::type::Control},
-  {919206u, property::type::Control},
-  {919207u, property::type::Control},
-  {919208u, property::type::Control},
-  {919209u, property::type::Control},
-  {919210u, property::type::Control},
-  {919211u, property::type::Control},
-  {919212u, property::type::Control},
-  {919213u, property::type::Control},
-  {919214u, property::type::Control},
-  {919215u, property::type::Control},
-  {919216u, property::type::Control},
-  {919217u, property::type::Control},
-  {919218u, property::type::Control},
-  {919219u, property::type::Control},
-  {919220u, property::type::Control},
-  {919221u, property::type::Control},
-  {919222u, property::type::Control},
-  {919223u, property::type::Control},
-  {919224u, property::type::Control},
-  {919225u, property::type::Control},
-  {919226u, property::type::Control},
-  {919227u, property::type::Control},
-  {919228u, property::type::Control},
-  {919229u, property::type::Control},
-  {919230u, property::type::Control},
-  {919231u, property::type::Control},
-  {919232u, property::type::Control},
-  {919233u, property::type::Control},
-  {919234u, property::type::Control},
-  {919235u, property::type::Control},
-  {919236u, property::type::Control},
-  {919237u, property::type::Control},
-  {919238u, property::type::Control},
-  {919239u, property::type::Control},
-  {919240u, property::type::Control},
-  {919241u, property::type::Control},
-  {919242u, property::type::Control},
-  {919243u, property::type::Control},
-  {919244u, property::type::Control},
-  {919245u, property::type::Control},
-  {919246u, property::type::Control},
-  {919247u, property::type::Control},
-  {919248u, property::type::Control},
-  {919249u, property::type::Control},
-  {919250u, property::type::Control},
-  {919251u, property::type::Control},
-  {919252u, property::type::Control},
-  {919253u, property::type::Control},
-  {919254u, property::type::Control},
-  {919255u, property::type::Control},
-  {919256u, property::type::Control},
-  {919257u, property::type::Control},
-  {919258u, property::type::Control},
-  {919259u, property::type::Control},
-  {919260u, property::type::Control},
-  {919261u, property::type::Control},
-  {919262u, property::type::Control},
-  {919263u, property::type::Control},
-  {919264u, property::type::Control},
-  {919265u, property::type::Control},
-  {919266u, property::type::Control},
-  {919267u, property::type::Control},
-  {919268u, property::type::Control},
-  {919269u, property::type::Control},
-  {919270u, property::type::Control},
-  {919271u, property::type::Control},
-  {919272u, property::type::Control},
-  {919273u, property::type::Control},
-  {919274u, property::type::Control},
-  {919275u, property::type::Control},
-  {919276u, property::type::Control},
-  {919277u, property::type::Control},
-  {919278u, property::type::Control},
-  {919279u, property::type::Control},
-  {919280u, property::type::Control},
-  {919281u, property::type::Control},
-  {919282u, property::type::Control},
-  {919283u, property::type::Control},
-  {919284u, property::type::Control},
-  {919285u, property::type::Control},
-  {919286u, property::type::Control},
-  {919287u, property::type::Control},
-  {919288u, property::type::Control},
-  {919289u, property::type::Control},
-  {919290u, property::type::Control},
-  {919291u, property::type::Control},
-  {919292u, property::type::Control},
-  {919293u, property::type::Control},
-  {919294u, property::type::Control},
-  {919295u, property::type::Control},
-  {919296u, property::type::Control},
-  {919297u, property::type::Control},
-  {919298u, property::type::Control},
-  {919299u, property::type::Control},
-  {919300u, property::type::Control},
-  {919301u, property::type::Control},
-  {919302u, property::type::Control},
-  {919303u, property::type::Control},
-  {919304u, property::type::Control},
-  {919305u, property::type::Control},
-  {919306u, property::type::Control},
-  {919307u, property::type::Control},
-  {919308u, property::type::Control},
-  {919309u, property::type::Control},
-  {919310u, property::type::Control},
-  {919311u, property::type::Control},
-  {919312u, property::type::Control},
-  {919313u, property::type::Control},
-  {919314u, property::type::Control},
-  {919315u, property::type::Control},
-  {919316u, property::type::Control},
-  {919317u, property::type::Control},
-  {919318u, property::type::Control},
-  {919319u, property::type::Control},
-  {919320u, property::type::Control},
-  {919321u, property::type::Control},
-  {919322u, property::type::Control},
-  {919323u, property::type::Control},
-  {919324u, property::type::Control},
-  {919325u, property::type::Control},
-  {919326u, property::type::Control},
-  {919327u, property::type::Control},
-  {919328u, property::type::Control},
-  {919329u, property::type::Control},
-  {919330u, property::type::Control},
-  {919331u, property::type::Control},
-  {919332u, property::type::Control},
-  {919333u, property::type::Control},
-  {919334u, property::type::Control},
-  {919335u, property::type::Control},
-  {919336u, property::type::Control},
-  {919337u, property::type::Control},
-  {919338u, property::type::Control},
-  {919339u, property::type::Control},
-  {919340u, property::type::Control},
-  {919341u, property::type::Control},
-  {919342u, property::type::Control},
-  {919343u, property::type::Control},
-  {919344u, property::type::Control},
-  {919345u, property::type::Control},
-  {919346u, property::type::Control},
-  {919347u, property::type::Control},
-  {919348u, property::type::Control},
-  {919349u, property::type::Control},
-  {919350u, property::type::Control},
-  {919351u, property::type::Control},
-  {919352u, property::type::Control},
-  {919353u, property::type::Control},
-  {919354u, property::type::Control},
-  {919355u, property::type::Control},
-  {919356u, property::type::Control},
-  {919357u, property::type::Control},
-  {919358u, property::type::Control},
-  {919359u, property::type::Control},
-  {919360u, property::type::Control},
-  {919361u, property::type::Control},
-  {919362u, property::type::Control},
-  {919363u, property::type::Control},
-  {919364u, property::type::Control},
-  {919365u, property::type::Control},
-  {919366u, property::type::Control},
-  {919367u, property::type::Control},
-  {919368u, property::type::Control},
-  {919369u, property::type::Control},
-  {919370u, property::type::Control},
-  {919371u, property::type::Control},
-  {919372u, property::type::Control},
-  {919373u, property::type::Control},
-  {919374u, property::type::Control},
-  {919375u, property::type::Control},
-  {919376u, property::type::Control},
-  {919377u, property::type::Control},
-  {919378u, property::type::Control},
-  {919379u, property::type::Control},
-  {919380u, property::type::Control},
-  {919381u, property::type::Control},
-  {919382u, property::type::Control},
-  {919383u, property::type::Control},
-  {919384u, property::type::Control},
-  {919385u, property::type::Control},
-  {919386u, property::type::Control},
-  {919387u, property::type::Control},
-  {919388u, property::type::Control},
-  {919389u, property::type::Control},
-  {919390u, property::type::Control},
-  {919391u, property::type::Control},
-  {919392u, property::type::Control},
-  {919393u, property::type::Control},
-  {919394u, property::type::Control},
-  {919395u, property::type::Control},
-  {919396u, property::type::Control},
-  {919397u, property::type::Control},
-  {919398u, property::type::Control},
-  {919399u, property::type::Control},
-  {919400u, property::type::Control},
-  {919401u, property::type::Control},
-  {919402u, property::type::Control},
-  {919403u, property::type::Control},
-  {919404u, property::type::Control},
-  {919405u, property::type::Control},
-  {919406u, property::type::Control},
-  {919407u, property::type::Control},
-  {919408u, property::type::Control},
-  {919409u, property::type::Control},
-  {919410u, property::type::Control},
-  {919411u, property::type::Control},
-  {919412u, property::type::Control},
-  {919413u, property::type::Control},
-  {919414u, property::type::Control},
-  {919415u, property::type::Control},
-  {919416u, property::type::Control},
-  {919417u, property::type::Control},
-  {919418u, property::type::Control},
-  {919419u, property::type::Control},
-  {919420u, property::type::Control},
-  {919421u, property::type::Control},
-  {919422u, property::type::Control},
-  {919423u, property::type::Control},
-  {919424u, property::type::Control},
-  {919425u, property::type::Control},
-  {919426u, property::type::Control},
-  {919427u, property::type::Control},
-  {919428u, property::type::Control},
-  {919429u, property::type::Control},
-  {919430u, property::type::Control},
-  {919431u, property::type::Control},
-  {919432u, property::type::Control},
-  {919433u, property::type::Control},
-  {919434u, property::type::Control},
-  {919435u, property::type::Control},
-  {919436u, property::type::Control},
-  {919437u, property::type::Control},
-  {919438u, property::type::Control},
-  {919439u, property::type::Control},
-  {919440u, property::type::Control},
-  {919441u, property::type::Control},
-  {919442u, property::type::Control},
-  {919443u, property::type::Control},
-  {919444u, property::type::Control},
-  {919445u, property::type::Control},
-  {919446u, property::type::Control},
-  {919447u, property::type::Control},
-  {919448u, property::type::Control},
-  {919449u, property::type::Control},
-  {919450u, property::type::Control},
-  {919451u, property::type::Control},
-  {919452u, property::type::Control},
-  {919453u, property::type::Control},
-  {919454u, property::type::Control},
-  {919455u, property::type::Control},
-  {919456u, property::type::Control},
-  {919457u, property::type::Control},
-  {919458u, property::type::Control},
-  {919459u, property::type::Control},
-  {919460u, property::type::Control},
-  {919461u, property::type::Control},
-  {919462u, property::type::Control},
-  {919463u, property::type::Control},
-  {919464u, property::type::Control},
-  {919465u, property::type::Control},
-  {919466u, property::type::Control},
-  {919467u, property::type::Control},
-  {919468u, property::type::Control},
-  {919469u, property::type::Control},
-  {919470u, property::type::Control},
-  {919471u, property::type::Control},
-  {919472u, property::type::Control},
-  {919473u, property::type::Control},
-  {919474u, property::type::Control},
-  {919475u, property::type::Control},
-  {919476u, property::type::Control},
-  {919477u, property::type::Control},
-  {919478u, property::type::Control},
-  {919479u, property::type::Control},
-  {919480u, property::type::Control},
-  {919481u, property::type::Control},
-  {919482u, property::type::Control},
-  {919483u, property::type::Control},
-  {919484u, property::type::Control},
-  {919485u, property::type::Control},
-  {919486u, property::type::Control},
-  {919487u, property::type::Control},
-  {919488u, property::type::Control},
-  {919489u, property::type::Control},
-  {919490u, property::type::Control},
-  {919491u, property::type::Control},
-  {919492u, property::type::Control},
-  {919493u, property::type::Control},
-  {919494u, property::type::Control},
-  {919495u, property::type::Control},
-  {919496u, property::type::Control},
-  {919497u, property::type::Control},
-  {919498u, property::type::Control},
-  {919499u, property::type::Control},
-  {919500u, property::type::Control},
-  {919501u, property::type::Control},
-  {919502u, property::type::Control},
-  {919503u, property::type::Control},
-  {919504u, property::type::Control},
-  {919505u, property::type::Control},
-  {919506u, property::type::Control},
-  {919507u, property::type::Control},
-  {919508u, property::type::Control},
-  {919509u, property::type::Control},
-  {919510u, property::type::Control},
-  {919511u, property::type::Control},
-  {919512u, property::type::Control},
-  {919513u, property::type::Control},
-  {919514u, property::type::Control},
-  {919515u, property::type::Control},
-  {919516u, property::type::Control},
-  {919517u, property::type::Control},
-  {919518u, property::type::Control},
-  {919519u, property::type::Control},
-  {919520u, property::type::Control},
-  {919521u, property::type::Control},
-  {919522u, property::type::Control},
-  {919523u, property::type::Control},
-  {919524u, property::type::Control},
-  {919525u, property::type::Control},
-  {919526u, property::type::Control},
-  {919527u, property::type::Control},
-  {919528u, property::type::Control},
-  {919529u, property::type::Control},
-  {919530u, property::type::Control},
-  {919531u, property::type::Control},
-  {919532u, property::type::Control},
-  {919533u, property::type::Control},
-  {919534u, property::type::Control},
-  {919535u, property::type::Control},
-  {919536u, property::type::Control},
-  {919537u, property::type::Control},
-  {919538u, property::type::Control},
-  {919539u, property::type::Control},
-  {919540u, property::type::Control},
-  {919541u, property::type::Control},
-  {919542u, property::type::Control},
-  {919543u, property::type::Control},
-  {919544u, property::type::Control},
-  {919545u, property::type::Control},
-  {919546u, property::type::Control},
-  {919547u, property::type::Control},
-  {919548u, property::type::Control},
-  {919549u, property::type::Control},
-  {919550u, property::type::Control},
-  {919551u, property::type::Control},
-  {919552u, property::type::Control},
-  {919553u, property::type::Control},
-  {919554u, property::type::Control},
-  {919555u, property::type::Control},
-  {919556u, property::type::Control},
-  {919557u, property::type::Control},
-  {919558u, property::type::Control},
-  {919559u, property::type::Control},
-  {919560u, property::type::Control},
-  {919561u, property::type::Control},
-  {919562u, property::type::Control},
-  {919563u, property::type::Control},
-  {919564u, property::type::Control},
-  {919565u, property::type::Control},
-  {919566u, property::type::Control},
-  {919567u, property::type::Control},
-  {919568u, property::type::Control},
-  {919569u, property::type::Control},
-  {919570u, property::type::Control},
-  {919571u, property::type::Control},
-  {919572u, property::type::Control},
-  {919573u, property::type::Control},
-  {919574u, property::type::Control},
-  {919575u, property::type::Control},
-  {919576u, property::type::Control},
-  {919577u, property::type::Control},
-  {919578u, property::type::Control},
-  {919579u, property::type::Control},
-  {919580u, property::type::Control},
-  {919581u, property::type::Control},
-  {919582u, property::type::Control},
-  {919583u, property::type::Control},
-  {919584u, property::type::Control},
-  {919585u, property::type::Control},
-  {919586u, property::type::Control},
-  {919587u, property::type::Control},
-  {919588u, property::type::Control},
-  {919589u, property::type::Control},
-  {919590u, property::type::Control},
-  {919591u, property::type::Control},
-  {919592u, property::type::Control},
-  {919593u, property::type::Control},
-  {919594u, property::type::Control},
-  {919595u, property::type::Control},
-  {919596u, property::type::Control},
-  {919597u, property::type::Control},
-  {919598u, property::type::Control},
-  {919599u, property::type::Control},
-  {919600u, property::type::Control},
-  {919601u, property::type::Control},
-  {919602u, property::type::Control},
-  {919603u, property::type::Control},
-  {919604u, property::type::Control},
-  {919605u, property::type::Control},
-  {919606u, property::type::Control},
-  {919607u, property::type::Control},
-  {919608u, property::type::Control},
-  {919609u, property::type::Control},
-  {919610u, property::type::Control},
-  {919611u, property::type::Control},
-  {919612u, property::type::Control},
-  {919613u, property::type::Control},
-  {919614u, property::type::Control},
-  {919615u, property::type::Control},
-  {919616u, property::type::Control},
-  {919617u, property::type::Control},
-  {919618u, property::type::Control},
-  {919619u, property::type::Control},
-  {919620u, property::type::Control},
-  {919621u, property::type::Control},
-  {919622u, property::type::Control},
-  {919623u, property::type::Control},
-  {919624u, property::type::Control},
-  {919625u, property::type::Control},
-  {919626u, property::type::Control},
-  {919627u, property::type::Control},
-  {919628u, property::type::Control},
-  {919629u, property::type::Control},
-  {919630u, property::type::Control},
-  {919631u, property::type::Control},
-  {919632u, property::type::Control},
-  {919633u, property::type::Control},
-  {919634u, property::type::Control},
-  {919635u, property::type::Control},
-  {919636u, property::type::Control},
-  {919637u, property::type::Control},
-  {919638u, property::type::Control},
-  {919639u, property::type::Control},
-  {919640u, property::type::Control},
-  {919641u, property::type::Control},
-  {919642u, property::type::Control},
-  {919643u, property::type::Control},
-  {919644u, property::type::Control},
-  {919645u, property::type::Control},
-  {919646u, property::type::Control},
-  {919647u, property::type::Control},
-  {919648u, property::type::Control},
-  {919649u, property::type::Control},
-  {919650u, property::type::Control},
-  {919651u, property::type::Control},
-  {919652u, property::type::Control},
-  {919653u, property::type::Control},
-  {919654u, property::type::Control},
-  {919655u, property::type::Control},
-  {919656u, property::type::Control},
-  {919657u, property::type::Control},
-  {919658u, property::type::Control},
-  {919659u, property::type::Control},
-  {919660u, property::type::Control},
-  {919661u, property::type::Control},
-  {919662u, property::type::Control},
-  {919663u, property::type::Control},
-  {919664u, property::type::Control},
-  {919665u, property::type::Control},
-  {919666u, property::type::Control},
-  {919667u, property::type::Control},
-  {919668u, property::type::Control},
-  {919669u, property::type::Control},
-  {919670u, property::type::Control},
-  {919671u, property::type::Control},
-  {919672u, property::type::Control},
-  {919673u, property::type::Control},
-  {919674u, property::type::Control},
-  {919675u, property::type::Control},
-  {919676u, property::type::Control},
-  {919677u, property::type::Control},
-  {919678u, property::type::Control},
-  {919679u, property::type::Control},
-  {919680u, property::type::Control},
-  {919681u, property::type::Control},
-  {919682u, property::type::Control},
-  {919683u, property::type::Control},
-  {919684u, property::type::Control},
-  {919685u, property::type::Control},
-  {919686u, property::type::Control},
-  {919687u, property::type::Control},
-  {919688u, property::type::Control},
-  {919689u, property::type::Control},
-  {919690u, property::type::Control},
-  {919691u, property::type::Control},
-  {919692u, property::type::Control},
-  {919693u, property::type::Control},
-  {919694u, property::type::Control},
-  {919695u, property::type::Control},
-  {919696u, property::type::Control},
-  {919697u, property::type::Control},
-  {919698u, property::type::Control},
-  {919699u, property::type::Control},
-  {919700u, property::type::Control},
-  {919701u, property::type::Control},
-  {919702u, property::type::Control},
-  {919703u, property::type::Control},
-  {919704u, property::type::Control},
-  {919705u, property::type::Control},
-  {919706u, property::type::Control},
-  {919707u, property::type::Control},
-  {919708u, property::type::Control},
-  {919709u, property::type::Control},
-  {919710u, property::type::Control},
-  {919711u, property::type::Control},
-  {919712u, property::type::Control},
-  {919713u, property::type::Control},
-  {919714u, property::type::Control},
-  {919715u, property::type::Control},
-  {919716u, property::type::Control},
-  {919717u, property::type::Control},
-  {919718u, property::type::Control},
-  {919719u, property::type::Control},
-  {919720u, property::type::Control},
-  {919721u, property::type::Control},
-  {919722u, property::type::Control},
-  {919723u, property::type::Control},
-  {919724u, property::type::Control},
-  {919725u, property::type::Control},
-  {919726u, property::type::Control},
-  {919727u, property::type::Control},
-  {919728u, property::type::Control},
-  {919729u, property::type::Control},
-  {919730u, property::type::Control},
-  {919731u, property::type::Control},
-  {919732u, property::type::Control},
-  {919733u, property::type::Control},
-  {919734u, property::type::Control},
-  {919735u, property::type::Control},
-  {919736u, property::type::Control},
-  {919737u, property::type::Control},
-  {919738u, property::type::Control},
-  {919739u, property::type::Control},
-  {919740u, property::type::Control},
-  {919741u, property::type::Control},
-  {919742u, property::type::Control},
-  {919743u, property::type::Control},
-  {919744u, property::type::Control},
-  {919745u, property::type::Control},
-  {919746u, property::type::Control},
-  {919747u, property::type::Control},
-  {919748u, property::type::Control},
-  {919749u, property::type::Control},
-  {919750u, property::type::Control},
-  {919751u, property::type::Control},
-  {919752u, property::type::Control},
-  {919753u, property::type::Control},
-  {919754u, property::type::Control},
-  {919755u, property::type::Control},
-  {919756u, property::type::Control},
-  {919757u, property::type::Control},
-  {919758u, property::type::Control},
-  {919759u, property::type::Control},
-  {919760u, property::type::Control},
-  {919761u, property::type::Control},
-  {919762u, property::type::Control},
-  {919763u, property::type::Control},
-  {919764u, property::type::Control},
-  {919765u, property::type::Control},
-  {919766u, property::type::Control},
-  {919767u, property::type::Control},
-  {919768u, property::type::Control},
-  {919769u, property::type::Control},
-  {919770u, property::type::Control},
-  {919771u, property::type::Control},
-  {919772u, property::type::Control},
-  {919773u, property::type::Control},
-  {919774u, property::type::Control},
-  {919775u, property::type::Control},
-  {919776u, property::type::Control},
-  {919777u, property::type::Control},
-  {919778u, property::type::Control},
-  {919779u, property::type::Control},
-  {919780u, property::type::Control},
-  {919781u, property::type::Control},
-  {919782u, property::type::Control},
-  {919783u, property::type::Control},
-  {919784u, property::type::Control},
-  {919785u, property::type::Control},
-  {919786u, property::type::Control},
-  {919787u, property::type::Control},
-  {919788u, property::type::Control},
-  {919789u, property::type::Control},
-  {919790u, property::type::Control},
-  {919791u, property::type::Control},
-  {919792u, property::type::Control},
-  {919793u, property::type::Control},
-  {919794u, property::type::Control},
-  {919795u, property::type::Control},
-  {919796u, property::type::Control},
-  {919797u, property::type::Control},
-  {919798u, property::type::Control},
-  {919799u, property::type::Control},
-  {919800u, property::type::Control},
-  {919801u, property::type::Control},
-  {919802u, property::type::Control},
-  {919803u, property::type::Control},
-  {919804u, property::type::Control},
-  {919805u, property::type::Control},
-  {919806u, property::type::Control},
-  {919807u, property::type::Control},
-  {919808u, property::type::Control},
-  {919809u, property::type::Control},
-  {919810u, property::type::Control},
-  {919811u, property::type::Control},
-  {919812u, property::type::Control},
-  {919813u, property::type::Control},
-  {919814u, property::type::Control},
-  {919815u, property::type::Control},
-  {919816u, property::type::Control},
-  {919817u, property::type::Control},
-  {919818u, property::type::Control},
-  {919819u, property::type::Control},
-  {919820u, property::type::Control},
-  {919821u, property::type::Control},
-  {919822u, property::type::Control},
-  {919823u, property::type::Control},
-  {919824u, property::type::Control},
-  {919825u, property::type::Control},
-  {919826u, property::type::Control},
-  {919827u, property::type::Control},
-  {919828u, property::type::Control},
-  {919829u, property::type::Control},
-  {919830u, property::type::Control},
-  {919831u, property::type::Control},
-  {919832u, property::type::Control},
-  {919833u, property::type::Control},
-  {919834u, property::type::Control},
-  {919835u, property::type::Control},
-  {919836u, property::type::Control},
-  {919837u, property::type::Control},
-  {919838u, property::type::Control},
-  {919839u, property::type::Control},
-  {919840u, property::type::Control},
-  {919841u, property::type::Control},
-  {919842u, property::type::Control},
-  {919843u, property::type::Control},
-  {919844u, property::type::Control},
-  {919845u, property::type::Control},
-  {919846u, property::type::Control},
-  {919847u, property::type::Control},
-  {919848u, property::type::Control},
-  {919849u, property::type::Control},
-  {919850u, property::type::Control},
-  {919851u, property::type::Control},
-  {919852u, property::type::Control},
-  {919853u, property::type::Control},
-  {919854u, property::type::Control},
-  {919855u, property::type::Control},
-  {919856u, property::type::Control},
-  {919857u, property::type::Control},
-  {919858u, property::type::Control},
-  {919859u, property::type::Control},
-  {919860u, property::type::Control},
-  {919861u, property::type::Control},
-  {919862u, property::type::Control},
-  {919863u, property::type::Control},
-  {919864u, property::type::Control},
-  {919865u, property::type::Control},
-  {919866u, property::type::Control},
-  {919867u, property::type::Control},
-  {919868u, property::type::Control},
-  {919869u, property::type::Control},
-  {919870u, property::type::Control},
-  {919871u, property::type::Control},
-  {919872u, property::type::Control},
-  {919873u, property::type::Control},
-  {919874u, property::type::Control},
-  {919875u, property::type::Control},
-  {919876u, property::type::Control},
-  {919877u, property::type::Control},
-  {919878u, property::type::Control},
-  {919879u, property::type::Control},
-  {919880u, property::type::Control},
-  {919881u, property::type::Control},
-  {919882u, property::type::Control},
-  {919883u, property::type::Control},
-  {919884u, property::type::Control},
-  {919885u, property::type::Control},
-  {919886u, property::type::Control},
-  {919887u, property::type::Control},
-  {919888u, property::type::Control},
-  {919889u, property::type::Control},
-  {919890u, property::type::Control},
-  {919891u, property::type::Control},
-  {919892u, property::type::Control},
-  {919893u, property::type::Control},
-  {919894u, property::type::Control},
-  {919895u, property::type::Control},
-  {919896u, property::type::Control},
-  {919897u, property::type::Control},
-  {919898u, property::type::Control},
-  {919899u, property::type::Control},
-  {919900u, property::type::Control},
-  {919901u, property::type::Control},
-  {919902u, property::type::Control},
-  {919903u, property::type::Control},
-  {919904u, property::type::Control},
-  {919905u, property::type::Control},
-  {919906u, property::type::Control},
-  {919907u, property::type::Control},
-  {919908u, property::type::Control},
-  {919909u, property::type::Control},
-  {919910u, property::type::Control},
-  {919911u, property::type::Control},
-  {919912u, property::type::Control},
-  {919913u, property::type::Control},
-  {919914u, property::type::Control},
-  {919915u, property::type::Control},
-  {919916u, property::type::Control},
-  {919917u, property::type::Control},
-  {919918u, property::type::Control},
-  {919919u, property::type::Control},
-  {919920u, property::type::Control},
-  {919921u, property::type::Control},
-  {919922u, property::type::Control},
-  {919923u, property::type::Control},
-  {919924u, property::type::Control},
-  {919925u, property::type::Control},
-  {919926u, property::type::Control},
-  {919927u, property::type::Control},
-  {919928u, property::type::Control},
-  {919929u, property::type::Control},
-  {919930u, property::type::Control},
-  {919931u, property::type::Control},
-  {919932u, property::type::Control},
-  {919933u, property::type::Control},
-  {919934u, property::type::Control},
-  {919935u, property::type::Control},
-  {919936u, property::type::Control},
-  {919937u, property::type::Control},
-  {919938u, property::type::Control},
-  {919939u, property::type::Control},
-  {919940u, property::type::Control},
-  {919941u, property::type::Control},
-  {919942u, property::type::Control},
-  {919943u, property::type::Control},
-  {919944u, property::type::Control},
-  {919945u, property::type::Control},
-  {919946u, property::type::Control},
-  {919947u, property::type::Control},
-  {919948u, property::type::Control},
-  {919949u, property::type::Control},
-  {919950u, property::type::Control},
-  {919951u, property::type::Control},
-  {919952u, property::type::Control},
-  {919953u, property::type::Control},
-  {919954u, property::type::Control},
-  {919955u, property::type::Control},
-  {919956u, property::type::Control},
-  {919957u, property::type::Control},
-  {919958u, property::type::Control},
-  {919959u, property::type::Control},
-  {919960u, property::type::Control},
-  {919961u, property::type::Control},
-  {919962u, property::type::Control},
-  {919963u, property::type::Control},
-  {919964u, property::type::Control},
-  {919965u, property::type::Control},
-  {919966u, property::type::Control},
-  {919967u, property::type::Control},
-  {919968u, property::type::Control},
-  {919969u, property::type::Control},
-  {919970u, property::type::Control},
-  {919971u, property::type::Control},
-  {919972u, property::type::Control},
-  {919973u, property::type::Control},
-  {919974u, property::type::Control},
-  {919975u, property::type::Control},
-  {919976u, property::type::Control},
-  {919977u, property::type::Control},
-  {919978u, property::type::Control},
-  {919979u, property::type::Control},
-  {919980u, property::type::Control},
-  {919981u, property::type::Control},
-  {919982u, property::type::Control},
-  {919983u, property::type::Control},
-  {919984u, property::type::Control},
-  {919985u, property::type::Control},
-  {919986u, property::type::Control},
-  {919987u, property::type::Control},
-  {919988u, property::type::Control},
-  {919989u, property::type::Control},
-  {919990u, property::type::Control},
-  {919991u, property::type::Control},
-  {919992u, property::type::Control},
-  {919993u, property::type::Control},
-  {919994u, property::type::Control},
-  {919995u, property::type::Control},
-  {919996u, property::type::Control},
-  {919997u, property::type::Control},
-  {919998u, property::type::Control},
-  {919999u, property::type::Control},
-  {920000u, property::type::Control},
-  {920001u, property::type::Control},
-  {920002u, property::type::Control},
-  {920003u, property::type::Control},
-  {920004u, property::type::Control},
-  {920005u, property::type::Control},
-  {920006u, property::type::Control},
-  {920007u, property::type::Control},
-  {920008u, property::type::Control},
-  {920009u, property::type::Control},
-  {920010u, property::type::Control},
-  {920011u, property::type::Control},
-  {920012u, property::type::Control},
-  {920013u, property::type::Control},
-  {920014u, property::type::Control},
-  {920015u, property::type::Control},
-  {920016u, property::type::Control},
-  {920017u, property::type::Control},
-  {920018u, property::type::Control},
-  {920019u, property::type::Control},
-  {920020u, property::type::Control},
-  {920021u, property::type::Control},
-  {920022u, property::type::Control},
-  {920023u, property::type::Control},
-  {920024u, property::type::Control},
-  {920025u, property::type::Control},
-  {920026u, property::type::Control},
-  {920027u, property::type::Control},
-  {920028u, property::type::Control},
-  {920029u, property::type::Control},
-  {920030u, property::type::Control},
-  {920031u, property::type::Control},
-  {920032u, property::type::Control},
-  {920033u, property::type::Control},
-  {920034u, property::type::Control},
-  {920035u, property::type::Control},
-  {920036u, property::type::Control},
-  {920037u, property::type::Control},
-  {920038u, property::type::Control},
-  {920039u, property::type::Control},
-  {920040u, property::type::Control},
-  {920041u, property::type::Control},
-  {920042u, property::type::Control},
-  {920043u, property::type::Control},
-  {920044u, property::type::Control},
-  {920045u, property::type::Control},
-  {920046u, property::type::Control},
-  {920047u, property::type::Control},
-  {920048u, property::type::Control},
-  {920049u, property::type::Control},
-  {920050u, property::type::Control},
-  {920051u, property::type::Control},
-  {920052u, property::type::Control},
-  {920053u, property::type::Control},
-  {920054u, property::type::Control},
-  {920055u, property::type::Control},
-  {920056u, property::type::Control},
-  {920057u, property::type::Control},
-  {920058u, property::type::Control},
-  {920059u, property::type::Control},
-  {920060u, property::type::Control},
-  {920061u, property::type::Control},
-  {920062u, property::type::Control},
-  {920063u, property::type::Control},
-  {920064u, property::type::Control},
-  {920065u, property::type::Control},
-  {920066u, property::type::Control},
-  {920067u, property::type::Control},
-  {920068u, property::type::Control},
-  {920069u, property::type::Control},
-  {920070u, property::type::Control},
-  {920071u, property::type::Control},
-  {920072u, property::type::Control},
-  {920073u, property::type::Control},
-  {920074u, property::type::Control},
-  {920075u, property::type::Control},
-  {920076u, property::type::Control},
-  {920077u, property::type::Control},
-  {920078u, property::type::Control},
-  {920079u, property::type::Control},
-  {920080u, property::type::Control},
-  {920081u, property::type::Control},
-  {920082u, property::type::Control},
-  {920083u, property::type::Control},
-  {920084u, property::type::Control},
-  {920085u, property::type::Control},
-  {920086u, property::type::Control},
-  {920087u, property::type::Control},
-  {920088u, property::type::Control},
-  {920089u, property::type::Control},
-  {920090u, property::type::Control},
-  {920091u, property::type::Control},
-  {920092u, property::type::Control},
-  {920093u, property::type::Control},
-  {920094u, property::type::Control},
-  {920095u, property::type::Control},
-  {920096u, property::type::Control},
-  {920097u, property::type::Control},
-  {920098u, property::type::Control},
-  {920099u, property::type::Control},
-  {920100u, property::type::Control},
-  {920101u, property::type::Control},
-  {920102u, property::type::Control},
-  {920103u, property::type::Control},
-  {920104u, property::type::Control},
-  {920105u, property::type::Control},
-  {920106u, property::type::Control},
-  {920107u, property::type::Control},
-  {920108u, property::type::Control},
-  {920109u, property::type::Control},
-  {920110u, property::type::Control},
-  {920111u, property::type::Control},
-  {920112u, property::type::Control},
-  {920113u, property::type::Control},
-  {920114u, property::type::Control},
-  {920115u, property::type::Control},
-  {920116u, property::type::Control},
-  {920117u, property::type::Control},
-  {920118u, property::type::Control},
-  {920119u, property::type::Control},
-  {920120u, property::type::Control},
-  {920121u, property::type::Control},
-  {920122u, property::type::Control},
-  {920123u, property::type::Control},
-  {920124u, property::type::Control},
-  {920125u, property::type::Control},
-  {920126u, property::type::Control},
-  {920127u, property::type::Control},
-  {920128u, property::type::Control},
-  {920129u, property::type::Control},
-  {920130u, property::type::Control},
-  {920131u, property::type::Control},
-  {920132u, property::type::Control},
-  {920133u, property::type::Control},
-  {920134u, property::type::Control},
-  {920135u, property::type::Control},
-  {920136u, property::type::Control},
-  {920137u, property::type::Control},
-  {920138u, property::type::Control},
-  {920139u, property::type::Control},
-  {920140u, property::type::Control},
-  {920141u, property::type::Control},
-  {920142u, property::type::Control},
-  {920143u, property::type::Control},
-  {920144u, property::type::Control},
-  {920145u, property::type::Control},
-  {920146u, property::type::Control},
-  {920147u, property::type::Control},
-  {920148u, property::type::Control},
-  {920149u, property::type::Control},
-  {920150u, property::type::Control},
-  {920151u, property::type::Control},
-  {920152u, property::type::Control},
-  {920153u, property::type::Control},
-  {920154u, property::type::Control},
-  {920155u, property::type::Control},
-  {920156u, property::type::Control},
-  {920157u, property::type::Control},
-  {920158u, property::type::Control},
-  {920159u, property::type::Control},
-  {920160u, property::type::Control},
-  {920161u, property::type::Control},
-  {920162u, property::type::Control},
-  {920163u, property::type::Control},
-  {920164u, property::type::Control},
-  {920165u, property::type::Control},
-  {920166u, property::type::Control},
-  {920167u, property::type::Control},
-  {920168u, property::type::Control},
-  {920169u, property::type::Control},
-  {920170u, property::type::Control},
-  {920171u, property::type::Control},
-  {920172u, property::type::Control},
-  {920173u, property::type::Control},
-  {920174u, property::type::Control},
-  {920175u, property::type::Control},
-  {920176u, property::type::Control},
-  {920177u, property::type::Control},
-  {920178u, property::type::Control},
-  {920179u, property::type::Control},
-  {920180u, property::type::Control},
-  {920181u, property::type::Control},
-  {920182u, property::type::Control},
-  {920183u, property::type::Control},
-  {920184u, property::type::Control},
-  {920185u, property::type::Control},
-  {920186u, property::type::Control},
-  {920187u, property::type::Control},
-  {920188u, property::type::Control},
-  {920189u, property::type::Control},
-  {920190u, property::type::Control},
-  {920191u, property::type::Control},
-  {920192u, property::type::Control},
-  {920193u, property::type::Control},
-  {920194u, property::type::Control},
-  {920195u, property::type::Control},
-  {920196u, property::type::Control},
-  {920197u, property::type::Control},
-  {920198u, property::type::Control},
-  {920199u, property::type::Control},
-  {920200u, property::type::Control},
-  {920201u, property::type::Control},
-  {920202u, property::type::Control},
-  {920203u, property::type::Control},
-  {920204u, property::type::Control},
-  {920205u, property::type::Control},
-  {920206u, property::type::Control},
-  {920207u, property::type::Control},
-  {920208u, property::type::Control},
-  {920209u, property::type::Control},
-  {920210u, property::type::Control},
-  {920211u, property::type::Control},
-  {920212u, property::type::Control},
-  {920213u, property::type::Control},
-  {920214u, property::type::Control},
-  {920215u, property::type::Control},
-  {920216u, property::type::Control},
-  {920217u, property::type::Control},
-  {920218u, property::type::Control},
-  {920219u, property::type::Control},
-  {920220u, property::type::Control},
-  {920221u, property::type::Control},
-  {920222u, property::type::Control},
-  {920223u, property::type::Control},
-  {920224u, property::type::Control},
-  {920225u, property::type::Control},
-  {920226u, property::type::Control},
-  {920227u, property::type::Control},
-  {920228u, property::type::Control},
-  {920229u, property::type::Control},
-  {920230u, property::type::Control},
-  {920231u, property::type::Control},
-  {920232u, property::type::Control},
-  {920233u, property::type::Control},
-  {920234u, property::type::Control},
-  {920235u, property::type::Control},
-  {920236u, property::type::Control},
-  {920237u, property::type::Control},
-  {920238u, property::type::Control},
-  {920239u, property::type::Control},
-  {920240u, property::type::Control},
-  {920241u, property::type::Control},
-  {920242u, property::type::Control},
-  {920243u, property::type::Control},
-  {920244u, property::type::Control},
-  {920245u, property::type::Control},
-  {920246u, property::type::Control},
-  {920247u, property::type::Control},
-  {920248u, property::type::Control},
-  {920249u, property::type::Control},
-  {920250u, property::type::Control},
-  {920251u, property::type::Control},
-  {920252u, property::type::Control},
-  {920253u, property::type::Control},
-  {920254u, property::type::Control},
-  {920255u, property::type::Control},
-  {920256u, property::type::Control},
-  {920257u, property::type::Control},
-  {920258u, property::type::Control},
-  {920259u, property::type::Control},
-  {920260u, property::type::Control},
-  {920261u, property::type::Control},
-  {920262u, property::type::Control},
-  {920263u, property::type::Control},
-  {920264u, property::type::Control},
-  {920265u, property::type::Control},
-  {920266u, property::type::Control},
-  {920267u, property::type::Control},
-  {920268u, property::type::Control},
-  {920269u, property::type::Control},
-  {920270u, property::type::Control},
-  {920271u, property::type::Control},
-  {920272u, property::type::Control},
-  {920273u, property::type::Control},
-  {920274u, property::type::Control},
-  {920275u, property::type::Control},
-  {920276u, property::type::Control},
-  {920277u, property::type::Control},
-  {920278u, property::type::Control},
-  {920279u, property::type::Control},
-  {920280u, property::type::Control},
-  {920281u, property::type::Control},
-  {920282u, property::type::Control},
-  {920283u, property::type::Control},
-  {920284u, property::type::Control},
-  {920285u, property::type::Control},
-  {920286u, property::type::Control},
-  {920287u, property::type::Control},
-  {920288u, property::type::Control},
-  {920289u, property::type::Control},
-  {920290u, property::type::Control},
-  {920291u, property::type::Control},
-  {920292u, property::type::Control},
-  {920293u, property::type::Control},
-  {920294u, property::type::Control},
-  {920295u, property::type::Control},
-  {920296u, property::type::Control},
-  {920297u, property::type::Control},
-  {920298u, property::type::Control},
-  {920299u, property::type::Control},
-  {920300u, property::type::Control},
-  {920301u, property::type::Control},
-  {920302u, property::type::Control},
-  {920303u, property::type::Control},
-  {920304u, property::type::Control},
-  {920305u, property::type::Control},
-  {920306u, property::type::Control},
-  {920307u, property::type::Control},
-  {920308u, property::type::Control},
-  {920309u, property::type::Control},
-  {920310u, property::type::Control},
-  {920311u, property::type::Control},
-  {920312u, property::type::Control},
-  {920313u, property::type::Control},
-  {920314u, property::type::Control},
-  {920315u, property::type::Control},
-  {920316u, property::type::Control},
-  {920317u, property::type::Control},
-  {920318u, property::type::Control},
-  {920319u, property::type::Control},
-  {920320u, property::type::Control},
-  {920321u, property::type::Control},
-  {920322u, property::type::Control},
-  {920323u, property::type::Control},
-  {920324u, property::type::Control},
-  {920325u, property::type::Control},
-  {920326u, property::type::Control},
-  {920327u, property::type::Control},
-  {920328u, property::type::Control},
-  {920329u, property::type::Control},
-  {920330u, property::type::Control},
-  {920331u, property::type::Control},
-  {920332u, property::type::Control},
-  {920333u, property::type::Control},
-  {920334u, property::type::Control},
-  {920335u, property::type::Control},
-  {920336u, property::type::Control},
-  {920337u, property::type::Control},
-  {920338u, property::type::Control},
-  {920339u, property::type::Control},
-  {920340u, property::type::Control},
-  {920341u, property::type::Control},
-  {920342u, property::type::Control},
-  {920343u, property::type::Control},
-  {920344u, property::type::Control},
-  {920345u, property::type::Control},
-  {920346u, property::type::Control},
-  {920347u, property::type::Control},
-  {920348u, property::type::Control},
-  {920349u, property::type::Control},
-  {920350u, property::type::Control},
-  {920351u, property::type::Control},
-  {920352u, property::type::Control},
-  {920353u, property::type::Control},
-  {920354u, property::type::Control},
-  {920355u, property::type::Control},
-  {920356u, property::type::Control},
-  {920357u, property::type::Control},
-  {920358u, property::type::Control},
-  {920359u, property::type::Control},
-  {920360u, property::type::Control},
-  {920361u, property::type::Control},
-  {920362u, property::type::Control},
-  {920363u, property::type::Control},
-  {920364u, property::type::Control},
-  {920365u, property::type::Control},
-  {920366u, property::type::Control},
-  {920367u, property::type::Control},
-  {920368u, property::type::Control},
-  {920369u, property::type::Control},
-  {920370u, property::type::Control},
-  {920371u, property::type::Control},
-  {920372u, property::type::Control},
-  {920373u, property::type::Control},
-  {920374u, property::type::Control},
-  {920375u, property::type::Control},
-  {920376u, property::type::Control},
-  {920377u, property::type::Control},
-  {920378u, property::type::Control},
-  {920379u, property::type::Control},
-  {920380u, property::type::Control},
-  {920381u, property::type::Control},
-  {920382u, property::type::Control},
-  {920383u, property::type::Control},
-  {920384u, property::type::Control},
-  {920385u, property::type::Control},
-  {920386u, property::type::Control},
-  {920387u, property::type::Control},
-  {920388u, property::type::Control},
-  {920389u, property::type::Control},
-  {920390u, property::type::Control},
-  {920391u, property::type::Control},
-  {920392u, property::type::Control},
-  {920393u, property::type::Control},
-  {920394u, property::type::Control},
-  {920395u, property::type::Control},
-  {920396u, property::type::Control},
-  {920397u, property::type::Control},
-  {920398u, property::type::Control},
-  {920399u, property::type::Control},
-  {920400u, property::type::Control},
-  {920401u, property::type::Control},
-  {920402u, property::type::Control},
-  {920403u, property::type::Control},
-  {920404u, property::type::Control},
-  {920405u, property::type::Control},
-  {920406u, property::type::Control},
-  {920407u, property::type::Control},
-  {920408u, property::type::Control},
-  {920409u, property::type::Control},
-  {920410u, property::type::Control},
-  {920411u, property::type::Control},
-  {920412u, property::type::Control},
-  {920413u, property::type::Control},
-  {920414u, property::type::Control},
-  {920415u, property::type::Control},
-  {920416u, property::type::Control},
-  {920417u, property::type::Control},
-  {920418u, property::type::Control},
-  {920419u, property::type::Control},
-  {920420u, property::type::Control},
-  {920421u, property::type::Control},
-  {920422u, property::type::Control},
-  {920423u, property::type::Control},
-  {920424u, property::type::Control},
-  {920425u, property::type::Control},
-  {920426u, property::type::Control},
-  {920427u, property::type::Control},
-  {920428u, property::type::Control},
-  {920429u, property::type::Control},
-  {920430u, property::type::Control},
-  {920431u, property::type::Control},
-  {920432u, property::type::Control},
-  {920433u, property::type::Control},
-  {920434u, property::type::Control},
-  {920435u, property::type::Control},
-  {920436u, property::type::Control},
-  {920437u, property::type::Control},
-  {920438u, property::type::Control},
-  {920439u, property::type::Control},
-  {920440u, property::type::Control},
-  {920441u, property::type::Control},
-  {920442u, property::type::Control},
-  {920443u, property::type::Control},
-  {920444u, property::type::Control},
-  {920445u, property::type::Control},
-  {920446u, property::type::Control},
-  {920447u, property::type::Control},
-  {920448u, property::type::Control},
-  {920449u, property::type::Control},
-  {920450u, property::type::Control},
-  {920451u, property::type::Control},
-  {920452u, property::type::Control},
-  {920453u, property::type::Control},
-  {920454u, property::type::Control},
-  {920455u, property::type::Control},
-  {920456u, property::type::Control},
-  {920457u, property::type::Control},
-  {920458u, property::type::Control},
-  {920459u, property::type::Control},
-  {920460u, property::type::Control},
-  {920461u, property::type::Control},
-  {920462u, property::type::Control},
-  {920463u, property::type::Control},
-  {920464u, property::type::Control},
-  {920465u, property::type::Control},
-  {920466u, property::type::Control},
-  {920467u, property::type::Control},
-  {920468u, property::type::Control},
-  {920469u, property::type::Control},
-  {920470u, property::type::Control},
-  {920471u, property::type::Control},
-  {920472u, property::type::Control},
-  {920473u, property::type::Control},
-  {920474u, property::type::Control},
-  {920475u, property::type::Control},
-  {920476u, property::type::Control},
-  {920477u, property::type::Control},
-  {920478u, property::type::Control},
-  {920479u, property::type::Control},
-  {920480u, property::type::Control},
-  {920481u, property::type::Control},
-  {920482u, property::type::Control},
-  {920483u, property::type::Control},
-  {920484u, property::type::Control},
-  {920485u, property::type::Control},
-  {920486u, property::type::Control},
-  {920487u, property::type::Control},
-  {920488u, property::type::Control},
-  {920489u, property::type::Control},
-  {920490u, property::type::Control},
-  {920491u, property::type::Control},
-  {920492u, property::type::Control},
-  {920493u, property::type::Control},
-  {920494u, property::type::Control},
-  {920495u, property::type::Control},
-  {920496u, property::type::Control},
-  {920497u, property::type::Control},
-  {920498u, property::type::Control},
-  {920499u, property::type::Control},
-  {920500u, property::type::Control},
-  {920501u, property::type::Control},
-  {920502u, property::type::Control},
-  {920503u, property::type::Control},
-  {920504u, property::type::Control},
-  {920505u, property::type::Control},
-  {920506u, property::type::Control},
-  {920507u, property::type::Control},
-  {920508u, property::type::Control},
-  {920509u, property::type::Control},
-  {920510u, property::type::Control},
-  {920511u, property::type::Control},
-  {920512u, property::type::Control},
-  {920513u, property::type::Control},
-  {920514u, property::type::Control},
-  {920515u, property::type::Control},
-  {920516u, property::type::Control},
-  {920517u, property::type::Control},
-  {920518u, property::type::Control},
-  {920519u, property::type::Control},
-  {920520u, property::type::Control},
-  {920521u, property::type::Control},
-  {920522u, property::type::Control},
-  {920523u, property::type::Control},
-  {920524u, property::type::Control},
-  {920525u, property::type::Control},
-  {920526u, property::type::Control},
-  {920527u, property::type::Control},
-  {920528u, property::type::Control},
-  {920529u, property::type::Control},
-  {920530u, property::type::Control},
-  {920531u, property::type::Control},
-  {920532u, property::type::Control},
-  {920533u, property::type::Control},
-  {920534u, property::type::Control},
-  {920535u, property::type::Control},
-  {920536u, property::type::Control},
-  {920537u, property::type::Control},
-  {920538u, property::type::Control},
-  {920539u, property::type::Control},
-  {920540u, property::type::Control},
-  {920541u, property::type::Control},
-  {920542u, property::type::Control},
-  {920543u, property::type::Control},
-  {920544u, property::type::Control},
-  {920545u, property::type::Control},
-  {920546u, property::type::Control},
-  {920547u, property::type::Control},
-  {920548u, property::type::Control},
-  {920549u, property::type::Control},
-  {920550u, property::type::Control},
-  {920551u, property::type::Control},
-  {920552u, property::type::Control},
-  {920553u, property::type::Control},
-  {920554u, property::type::Control},
-  {920555u, property::type::Control},
-  {920556u, property::type::Control},
-  {920557u, property::type::Control},
-  {920558u, property::type::Control},
-  {920559u, property::type::Control},
-  {920560u, property::type::Control},
-  {920561u, property::type::Control},
-  {920562u, property::type::Control},
-  {920563u, property::type::Control},
-  {920564u, property::type::Control},
-  {920565u, property::type::Control},
-  {920566u, property::type::Control},
-  {920567u, property::type::Control},
-  {920568u, property::type::Control},
-  {920569u, property::type::Control},
-  {920570u, property::type::Control},
-  {920571u, property::type::Control},
-  {920572u, property::type::Control},
-  {920573u, property::type::Control},
-  {920574u, property::type::Control},
-  {920575u, property::type::Control},
-  {920576u, property::type::Control},
-  {920577u, property::type::Control},
-  {920578u, property::type::Control},
-  {920579u, property::type::Control},
-  {920580u, property::type::Control},
-  {920581u, property::type::Control},
-  {920582u, property::type::Control},
-  {920583u, property::type::Control},
-  {920584u, property::type::Control},
-  {920585u, property::type::Control},
-  {920586u, property::type::Control},
-  {920587u, property::type::Control},
-  {920588u, property::type::Control},
-  {920589u, property::type::Control},
-  {920590u, property::type::Control},
-  {920591u, property::type::Control},
-  {920592u, property::type::Control},
-  {920593u, property::type::Control},
-  {920594u, property::type::Control},
-  {920595u, property::type::Control},
-  {920596u, property::type::Control},
-  {920597u, property::type::Control},
-  {920598u, property::type::Control},
-  {920599u, property::type::Control},
-  {920600u, property::type::Control},
-  {920601u, property::type::Control},
-  {920602u, property::type::Control},
-  {920603u, property::type::Control},
-  {920604u, property::type::Control},
-  {920605u, property::type::Control},
-  {920606u, property::type::Control},
-  {920607u, property::type::Control},
-  {920608u, property::type::Control},
-  {920609u, property::type::Control},
-  {920610u, property::type::Control},
-  {920611u, property::type::Control},
-  {920612u, property::type::Control},
-  {920613u, property::type::Control},
-  {920614u, property::type::Control},
-  {920615u, property::type::Control},
-  {920616u, property::type::Control},
-  {920617u, property::type::Control},
-  {920618u, property::type::Control},
-  {920619u, property::type::Control},
-  {920620u, property::type::Control},
-  {920621u, property::type::Control},
-  {920622u, property::type::Control},
-  {920623u, property::type::Control},
-  {920624u, property::type::Control},
-  {920625u, property::type::Control},
-  {920626u, property::type::Control},
-  {920627u, property::type::Control},
-  {920628u, property::type::Control},
-  {920629u, property::type::Control},
-  {920630u, property::type::Control},
-  {920631u, property::type::Control},
-  {920632u, property::type::Control},
-  {920633u, property::type::Control},
-  {920634u, property::type::Control},
-  {920635u, property::type::Control},
-  {920636u, property::type::Control},
-  {920637u, property::type::Control},
-  {920638u, property::type::Control},
-  {920639u, property::type::Control},
-  {920640u, property::type::Control},
-  {920641u, property::type::Control},
-  {920642u, property::type::Control},
-  {920643u, property::type::Control},
-  {920644u, property::type::Control},
-  {920645u, property::type::Control},
-  {920646u, property::type::Control},
-  {920647u, property::type::Control},
-  {920648u, property::type::Control},
-  {920649u, property::type::Control},
-  {920650u, property::type::Control},
-  {920651u, property::type::Control},
-  {920652u, property::type::Control},
-  {920653u, property::type::Control},
-  {920654u, property::type::Control},
-  {920655u, property::type::Control},
-  {920656u, property::type::Control},
-  {920657u, property::type::Control},
-  {920658u, property::type::Control},
-  {920659u, property::type::Control},
-  {920660u, property::type::Control},
-  {920661u, property::type::Control},
-  {920662u, property::type::Control},
-  {920663u, property::type::Control},
-  {920664u, property::type::Control},
-  {920665u, property::type::Control},
-  {920666u, property::type::Control},
-  {920667u, property::type::Control},
-  {920668u, property::type::Control},
-  {920669u, property::type::Control},
-  {920670u, property::type::Control},
-  {920671u, property::type::Control},
-  {920672u, property::type::Control},
-  {920673u, property::type::Control},
-  {920674u, property::type::Control},
-  {920675u, property::type::Control},
-  {920676u, property::type::Control},
-  {920677u, property::type::Control},
-  {920678u, property::type::Control},
-  {920679u, property::type::Control},
-  {920680u, property::type::Control},
-  {920681u, property::type::Control},
-  {920682u, property::type::Control},
-  {920683u, property::type::Control},
-  {920684u, property::type::Control},
-  {920685u, property::type::Control},
-  {920686u, property::type::Control},
-  {920687u, property::type::Control},
-  {920688u, property::type::Control},
-  {920689u, property::type::Control},
-  {920690u, property::type::Control},
-  {920691u, property::type::Control},
-  {920692u, property::type::Control},
-  {920693u, property::type::Control},
-  {920694u, property::type::Control},
-  {920695u, property::type::Control},
-  {920696u, property::type::Control},
-  {920697u, property::type::Control},
-  {920698u, property::type::Control},
-  {920699u, property::type::Control},
-  {920700u, property::type::Control},
-  {920701u, property::type::Control},
-  {920702u, property::type::Control},
-  {920703u, property::type::Control},
-  {920704u, property::type::Control},
-  {920705u, property::type::Control},
-  {920706u, property::type::Control},
-  {920707u, property::type::Control},
-  {920708u, property::type::Control},
-  {920709u, property::type::Control},
-  {920710u, property::type::Control},
-  {920711u, property::type::Control},
-  {920712u, property::type::Control},
-  {920713u, property::type::Control},
-  {920714u, property::type::Control},
-  {920715u, property::type::Control},
-  {920716u, property::type::Control},
-  {920717u, property::type::Control},
-  {920718u, property::type::Control},
-  {920719u, property::type::Control},
-  {920720u, property::type::Control},
-  {920721u, property::type::Control},
-  {920722u, property::type::Control},
-  {920723u, property::type::Control},
-  {920724u, property::type::Control},
-  {920725u, property::type::Control},
-  {920726u, property::type::Control},
-  {920727u, property::type::Control},
-  {920728u, property::type::Control},
-  {920729u, property::type::Control},
-  {920730u, property::type::Control},
-  {920731u, property::type::Control},
-  {920732u, property::type::Control},
-  {920733u, property::type::Control},
-  {920734u, property::type::Control},
-  {920735u, property::type::Control},
-  {920736u, property::type::Control},
-  {920737u, property::type::Control},
-  {920738u, property::type::Control},
-  {920739u, property::type::Control},
-  {920740u, property::type::Control},
-  {920741u, property::type::Control},
-  {920742u, property::type::Control},
-  {920743u, property::type::Control},
-  {920744u, property::type::Control},
-  {920745u, property::type::Control},
-  {920746u, property::type::Control},
-  {920747u, property::type::Control},
-  {920748u, property::type::Control},
-  {920749u, property::type::Control},
-  {920750u, property::type::Control},
-  {920751u, property::type::Control},
-  {920752u, property::type::Control},
-  {920753u, property::type::Control},
-  {920754u, property::type::Control},
-  {920755u, property::type::Control},
-  {920756u, property::type::Control},
-  {920757u, property::type::Control},
-  {920758u, property::type::Control},
-  {920759u, property::type::Control},
-  {920760u, property::type::Control},
-  {920761u, property::type::Control},
-  {920762u, property::type::Control},
-  {920763u, property::type::Control},
-  {920764u, property::type::Control},
-  {920765u, property::type::Control},
-  {920766u, property::type::Control},
-  {920767u, property::type::Control},
-  {920768u, property::type::Control},
-  {920769u, property::type::Control},
-  {920770u, property::type::Control},
-  {920771u, property::type::Control},
-  {920772u, property::type::Control},
-  {920773u, property::type::Control},
-  {920774u, property::type::Control},
-  {920775u, property::type::Control},
-  {920776u, property::type::Control},
-  {920777u, property::type::Control},
-  {920778u, property::type::Control},
-  {920779u, property::type::Control},
-  {920780u, property::type::Control},
-  {920781u, property::type::Control},
-  {920782u, property::type::Control},
-  {920783u, property::type::Control},
-  {920784u, property::type::Control},
-  {920785u, property::type::Control},
-  {920786u, property::type::Control},
-  {920787u, property::type::Control},
-  {920788u, property::type::Control},
-  {920789u, property::type::Control},
-  {920790u, property::type::Control},
-  {920791u, property::type::Control},
-  {920792u, property::type::Control},
-  {920793u, property::type::Control},
-  {920794u, property::type::Control},
-  {920795u, property::type::Control},
-  {920796u, property::type::Control},
-  {920797u, property::type::Control},
-  {920798u, property::type::Control},
-  {920799u, property::type::Control},
-  {920800u, property::type::Control},
-  {920801u, property::type::Control},
-  {920802u, property::type::Control},
-  {920803u, property::type::Control},
-  {920804u, property::type::Control},
-  {920805u, property::type::Control},
-  {920806u, property::type::Control},
-  {920807u, property::type::Control},
-  {920808u, property::type::Control},
-  {920809u, property::type::Control},
-  {920810u, property::type::Control},
-  {920811u, property::type::Control},
-  {920812u, property::type::Control},
-  {920813u, property::type::Control},
-  {920814u, property::type::Control},
-  {920815u, property::type::Control},
-  {920816u, property::type::Control},
-  {920817u, property::type::Control},
-  {920818u, property::type::Control},
-  {920819u, property::type::Control},
-  {920820u, property::type::Control},
-  {920821u, property::type::Control},
-  {920822u, property::type::Control},
-  {920823u, property::type::Control},
-  {920824u, property::type::Control},
-  {920825u, property::type::Control},
-  {920826u, property::type::Control},
-  {920827u, property::type::Control},
-  {920828u, property::type::Control},
-  {920829u, property::type::Control},
-  {920830u, property::type::Control},
-  {920831u, property::type::Control},
-  {920832u, property::type::Control},
-  {920833u, property::type::Control},
-  {920834u, property::type::Control},
-  {920835u, property::type::Control},
-  {920836u, property::type::Control},
-  {920837u, property::type::Control},
-  {920838u, property::type::Control},
-  {920839u, property::type::Control},
-  {920840u, property::type::Control},
-  {920841u, property::type::Control},
-  {920842u, property::type::Control},
-  {920843u, property::type::Control},
-  {920844u, property::type::Control},
-  {920845u, property::type::Control},
-  {920846u, property::type::Control},
-  {920847u, property::type::Control},
-  {920848u, property::type::Control},
-  {920849u, property::type::Control},
-  {920850u, property::type::Control},
-  {920851u, property::type::Control},
-  {920852u, property::type::Control},
-  {920853u, property::type::Control},
-  {920854u, property::type::Control},
-  {920855u, property::type::Control},
-  {920856u, property::type::Control},
-  {920857u, property::type::Control},
-  {920858u, property::type::Control},
-  {920859u, property::type::Control},
-  {920860u, property::type::Control},
-  {920861u, property::type::Control},
-  {920862u, property::type::Control},
-  {920863u, property::type::Control},
-  {920864u, property::type::Control},
-  {920865u, property::type::Control},
-  {920866u, property::type::Control},
-  {920867u, property::type::Control},
-  {920868u, property::type::Control},
-  {920869u, property::type::Control},
-  {920870u, property::type::Control},
-  {920871u, property::type::Control},
-  {920872u, property::type::Control},
-  {920873u, property::type::Control},
-  {920874u, property::type::Control},
-  {920875u, property::type::Control},
-  {920876u, property::type::Control},
-  {920877u, property::type::Control},
-  {920878u, property::type::Control},
-  {920879u, property::type::Control},
-  {920880u, property::type::Control},
-  {920881u, property::type::Control},
-  {920882u, property::type::Control},
-  {920883u, property::type::Control},
-  {920884u, property::type::Control},
-  {920885u, property::type::Control},
-  {920886u, property::type::Control},
-  {920887u, property::type::Control},
-  {920888u, property::type::Control},
-  {920889u, property::type::Control},
-  {920890u, property::type::Control},
-  {920891u, property::type::Control},
-  {920892u, property::type::Control},
-  {920893u, property::type::Control},
-  {920894u, property::type::Control},
-  {920895u, property::type::Control},
-  {920896u, property::type::Control},
-  {920897u, property::type::Control},
-  {920898u, property::type::Control},
-  {920899u, property::type::Control},
-  {920900u, property::type::Control},
-  {920901u, property::type::Control},
-  {920902u, property::type::Control},
-  {920903u, property::type::Control},
-  {920904u, property::type::Control},
-  {920905u, property::type::Control},
-  {920906u, property::type::Control},
-  {920907u, property::type::Control},
-  {920908u, property::type::Control},
-  {920909u, property::type::Control},
-  {920910u, property::type::Control},
-  {920911u, property::type::Control},
-  {920912u, property::type::Control},
-  {920913u, property::type::Control},
-  {920914u, property::type::Control},
-  {920915u, property::type::Control},
-  {920916u, property::type::Control},
-  {920917u, property::type::Control},
-  {920918u, property::type::Control},
-  {920919u, property::type::Control},
-  {920920u, property::type::Control},
-  {920921u, property::type::Control},
-  {920922u, property::type::Control},
-  {920923u, property::type::Control},
-  {920924u, property::type::Control},
-  {920925u, property::type::Control},
-  {920926u, property::type::Control},
-  {920927u, property::type::Control},
-  {920928u, property::type::Control},
-  {920929u, property::type::Control},
-  {920930u, property::type::Control},
-  {920931u, property::type::Control},
-  {920932u, property::type::Control},
-  {920933u, property::type::Control},
-  {920934u, property::type::Control},
-  {920935u, property::type::Control},
-  {920936u, property::type::Control},
-  {920937u, property::type::Control},
-  {920938u, property::type::Control},
-  {920939u, property::type::Control},
-  {920940u, property::type::Control},
-  {920941u, property::type::Control},
-  {920942u, property::type::Control},
-  {920943u, property::type::Control},
-  {920944u, property::type::Control},
-  {920945u, property::type::Control},
-  {920946u, property::type::Control},
-  {920947u, property::type::Control},
-  {920948u, property::type::Control},
-  {920949u, property::type::Control},
-  {920950u, property::type::Control},
-  {920951u, property::type::Control},
-  {920952u, property::type::Control},
-  {920953u, property::type::Control},
-  {920954u, property::type::Control},
-  {920955u, property::type::Control},
-  {920956u, property::type::Control},
-  {920957u, property::type::Control},
-  {920958u, property::type::Control},
-  {920959u, property::type::Control},
-  {920960u, property::type::Control},
-  {920961u, property::type::Control},
-  {920962u, property::type::Control},
-  {920963u, property::type::Control},
-  {920964u, property::type::Control},
-  {920965u, property::type::Control},
-  {920966u, property::type::Control},
-  {920967u, property::type::Control},
-  {920968u, property::type::Control},
-  {920969u, property::type::Control},
-  {920970u, property::type::Control},
-  {920971u, property::type::Control},
-  {920972u, property::type::Control},
-  {920973u, property::type::Control},
-  {920974u, property::type::Control},
-  {920975u, property::type::Control},
-  {920976u, property::type::Control},
-  {920977u, property::type::Control},
-  {920978u, property::type::Control},
-  {920979u, property::type::Control},
-  {920980u, property::type::Control},
-  {920981u, property::type::Control},
-  {920982u, property::type::Control},
-  {920983u, property::type::Control},
-  {920984u, property::type::Control},
-  {920985u, property::type::Control},
-  {920986u, property::type::Control},
-  {920987u, property::type::Control},
-  {920988u, property::type::Control},
-  {920989u, property::type::Control},
-  {920990u, property::type::Control},
-  {920991u, property::type::Control},
-  {920992u, property::type::Control},
-  {920993u, property::type::Control},
-  {920994u, property::type::Control},
-  {920995u, property::type::Control},
-  {920996u, property::type::Control},
-  {920997u, property::type::Control},
-  {920998u, property::type::Control},
-  {920999u, property::type::Control},
-  {921000u, property::type::Control},
-  {921001u, property::type::Control},
-  {921002u, property::type::Control},
-  {921003u, property::type::Control},
-  {921004u, property::type::Control},
-  {921005u, property::type::Control},
-  {921006u, property::type::Control},
-  {921007u, property::type::Control},
-  {921008u, property::type::Control},
-  {921009u, property::type::Control},
-  {921010u, property::type::Control},
-  {921011u, property::type::Control},
-  {921012u, property::type::Control},
-  {921013u, property::type::Control},
-  {921014u, property::type::Control},
-  {921015u, property::type::Control},
-  {921016u, property::type::Control},
-  {921017u, property::type::Control},
-  {921018u, property::type::Control},
-  {921019u, property::type::Control},
-  {921020u, property::type::Control},
-  {921021u, property::type::Control},
-  {921022u, property::type::Control},
-  {921023u, property::type::Control},
-  {921024u, property::type::Control},
-  {921025u, property::type::Control},
-  {921026u, property::type::Control},
-  {921027u, property::type::Control},
-  {921028u, property::type::Control},
-  {921029u, property::type::Control},
-  {921030u, property::type::Control},
-  {921031u, property::type::Control},
-  {921032u, property::type::Control},
-  {921033u, property::type::Control},
-  {921034u, property::type::Control},
-  {921035u, property::type::Control},
-  {921036u, property::type::Control},
-  {921037u, property::type::Control},
-  {921038u, property::type::Control},
-  {921039u, property::type::Control},
-  {921040u, property::type::Control},
-  {921041u, property::type::Control},
-  {921042u, property::type::Control},
-  {921043u, property::type::Control},
-  {921044u, property::type::Control},
-  {921045u, property::type::Control},
-  {921046u, property::type::Control},
-  {921047u, property::type::Control},
-  {921048u, property::type::Control},
-  {921049u, property::type::Control},
-  {921050u, property::type::Control},
-  {921051u, property::type::Control},
-  {921052u, property::type::Control},
-  {921053u, property::type::Control},
-  {921054u, property::type::Control},
-  {921055u, property::type::Control},
-  {921056u, property::type::Control},
-  {921057u, property::type::Control},
-  {921058u, property::type::Control},
-  {921059u, property::type::Control},
-  {921060u, property::type::Control},
-  {921061u, property::type::Control},
-  {921062u, property::type::Control},
-  {921063u, property::type::Control},
-  {921064u, property::type::Control},
-  {921065u, property::type::Control},
-  {921066u, property::type::Control},
-  {921067u, property::type::Control},
-  {921068u, property::type::Control},
-  {921069u, property::type::Control},
-  {921070u, property::type::Control},
-  {921071u, property::type::Control},
-  {921072u, property::type::Control},
-  {921073u, property::type::Control},
-  {921074u, property::type::Control},
-  {921075u, property::type::Control},
-  {921076u, property::type::Control},
-  {921077u, property::type::Control},
-  {921078u, property::type::Control},
-  {921079u, property::type::Control},
-  {921080u, property::type::Control},
-  {921081u, property::type::Control},
-  {921082u, property::type::Control},
-  {921083u, property::type::Control},
-  {921084u, property::type::Control},
-  {921085u, property::type::Control},
-  {921086u, property::type::Control},
-  {921087u, property::type::Control},
-  {921088u, property::type::Control},
-  {921089u, property::type::Control},
-  {921090u, property::type::Control},
-  {921091u, property::type::Control},
-  {921092u, property::type::Control},
-  {921093u, property::type::Control},
-  {921094u, property::type::Control},
-  {921095u, property::type::Control},
-  {921096u, property::type::Control},
-  {921097u, property::type::Control},
-  {921098u, property::type::Control},
-  {921099u, property::type::Control},
-  {921100u, property::type::Control},
-  {921101u, property::type::Control},
-  {921102u, property::type::Control},
-  {921103u, property::type::Control},
-  {921104u, property::type::Control},
-  {921105u, property::type::Control},
-  {921106u, property::type::Control},
-  {921107u, property::type::Control},
-  {921108u, property::type::Control},
-  {921109u, property::type::Control},
-  {921110u, property::type::Control},
-  {921111u, property::type::Control},
-  {921112u, property::type::Control},
-  {921113u, property::type::Control},
-  {921114u, property::type::Control},
-  {921115u, property::type::Control},
-  {921116u, property::type::Control},
-  {921117u, property::type::Control},
-  {921118u, property::type::Control},
-  {921119u, property::type::Control},
-  {921120u, property::type::Control},
-  {921121u, property::type::Control},
-  {921122u, property::type::Control},
-  {921123u, property::type::Control},
-  {921124u, property::type::Control},
-  {921125u, property::type::Control},
-  {921126u, property::type::Control},
-  {921127u, property::type::Control},
-  {921128u, property::type::Control},
-  {921129u, property::type::Control},
-  {921130u, property::type::Control},
-  {921131u, property::type::Control},
-  {921132u, property::type::Control},
-  {921133u, property::type::Control},
-  {921134u, property::type::Control},
-  {921135u, property::type::Control},
-  {921136u, property::type::Control},
-  {921137u, property::type::Control},
-  {921138u, property::type::Control},
-  {921139u, property::type::Control},
-  {921140u, property::type::Control},
-  {921141u, property::type::Control},
-  {921142u, property::type::Control},
-  {921143u, property::type::Control},
-  {921144u, property::type::Control},
-  {921145u, property::type::Control},
-  {921146u, property::type::Control},
-  {921147u, property::type::Control},
-  {921148u, property::type::Control},
-  {921149u, property::type::Control},
-  {921150u, property::type::Control},
-  {921151u, property::type::Control},
-  {921152u, property::type::Control},
-  {921153u, property::type::Control},
-  {921154u, property::type::Control},
-  {921155u, property::type::Control},
-  {921156u, property::type::Control},
-  {921157u, property::type::Control},
-  {921158u, property::type::Control},
-  {921159u, property::type::Control},
-  {921160u, property::type::Control},
-  {921161u, property::type::Control},
-  {921162u, property::type::Control},
-  {921163u, property::type::Control},
-  {921164u, property::type::Control},
-  {921165u, property::type::Control},
-  {921166u, property::type::Control},
-  {921167u, property::type::Control},
-  {921168u, property::type::Control},
-  {921169u, property::type::Control},
-  {921170u, property::type::Control},
-  {921171u, property::type::Control},
-  {921172u, property::type::Control},
-  {921173u, property::type::Control},
-  {921174u, property::type::Control},
-  {921175u, property::type::Control},
-  {921176u, property::type::Control},
-  {921177u, property::type::Control},
-  {921178u, property::type::Control},
-  {921179u, property::type::Control},
-  {921180u, property::type::Control},
-  {921181u, property::type::Control},
-  {921182u, property::type::Control},
-  {921183u, property::type::Control},
-  {921184u, property::type::Control},
-  {921185u, property::type::Control},
-  {921186u, property::type::Control},
-  {921187u, property::type::Control},
-  {921188u, property::type::Control},
-  {921189u, property::type::Control},
-  {921190u, property::type::Control},
-  {921191u, property::type::Control},
-  {921192u, property::type::Control},
-  {921193u, property::type::Control},
-  {921194u, property::type::Control},
-  {921195u, property::type::Control},
-  {921196u, property::type::Control},
-  {921197u, property::type::Control},
-  {921198u, property::type::Control},
-  {921199u, property::type::Control},
-  {921200u, property::type::Control},
-  {921201u, property::type::Control},
-  {921202u, property::type::Control},
-  {921203u, property::type::Control},
-  {921204u, property::type::Control},
-  {921205u, property::type::Control},
-  {921206u, property::type::Control},
-  {921207u, property::type::Control},
-  {921208u, property::type::Control},
-  {921209u, property::type::Control},
-  {921210u, property::type::Control},
-  {921211u, property::type::Control},
-  {921212u, property::type::Control},
-  {921213u, property::type::Control},
-  {921214u, property::type::Control},
-  {921215u, property::type::Control},
-  {921216u, property::type::Control},
-  {921217u, property::type::Control},
-  {921218u, property::type::Control},
-  {921219u, property::type::Control},
-  {921220u, property::type::Control},
-  {921221u, property::type::Control},
-  {921222u, property::type::Control},
-  {921223u, property::type::Control},
-  {921224u, property::type::Control},
-  {921225u, property::type::Control},
-  {921226u, property::type::Control},
-  {921227u, property::type::Control},
-  {921228u, property::type::Control},
-  {921229u, property::type::Control},
-  {921230u, property::type::Control},
-  {921231u, property::type::Control},
-  {921232u, property::type::Control},
-  {921233u, property::type::Control},
-  {921234u, property::type::Control},
-  {921235u, property::type::Control},
-  {921236u, property::type::Control},
-  {921237u, property::type::Control},
-  {921238u, property::type::Control},
-  {921239u, property::type::Control},
-  {921240u, property::type::Control},
-  {921241u, property::type::Control},
-  {921242u, property::type::Control},
-  {921243u, property::type::Control},
-  {921244u, property::type::Control},
-  {921245u, property::type::Control},
-  {921246u, property::type::Control},
-  {921247u, property::type::Control},
-  {921248u, property::type::Control},
-  {921249u, property::type::Control},
-  {921250u, property::type::Control},
-  {921251u, property::type::Control},
-  {921252u, property::type::Control},
-  {921253u, property::type::Control},
-  {921254u, property::type::Control},
-  {921255u, property::type::Control},
-  {921256u, property::type::Control},
-  {921257u, property::type::Control},
-  {921258u, property::type::Control},
-  {921259u, property::type::Control},
-  {921260u, property::type::Control},
-  {921261u, property::type::Control},
-  {921262u, property::type::Control},
-  {921263u, property::type::Control},
-  {921264u, property::type::Control},
-  {921265u, property::type::Control},
-  {921266u, property::type::Control},
-  {921267u, property::type::Control},
-  {921268u, property::type::Control},
-  {921269u, property::type::Control},
-  {921270u, property::type::Control},
-  {921271u, property::type::Control},
-  {921272u, property::type::Control},
-  {921273u, property::type::Control},
-  {921274u, property::type::Control},
-  {921275u, property::type::Control},
-  {921276u, property::type::Control},
-  {921277u, property::type::Control},
-  {921278u, property::type::Control},
-  {921279u, property::type::Control},
-  {921280u, property::type::Control},
-  {921281u, property::type::Control},
-  {921282u, property::type::Control},
-  {921283u, property::type::Control},
-  {921284u, property::type::Control},
-  {921285u, property::type::Control},
-  {921286u, property::type::Control},
-  {921287u, property::type::Control},
-  {921288u, property::type::Control},
-  {921289u, property::type::Control},
-  {921290u, property::type::Control},
-  {921291u, property::type::Control},
-  {921292u, property::type::Control},
-  {921293u, property::type::Control},
-  {921294u, property::type::Control},
-  {921295u, property::type::Control},
-  {921296u, property::type::Control},
-  {921297u, property::type::Control},
-  {921298u, property::type::Control},
-  {921299u, property::type::Control},
-  {921300u, property::type::Control},
-  {921301u, property::type::Control},
-  {921302u, property::type::Control},
-  {921303u, property::type::Control},
-  {921304u, property::type::Control},
-  {921305u, property::type::Control},
-  {921306u, property::type::Control},
-  {921307u, property::type::Control},
-  {921308u, property::type::Control},
-  {921309u, property::type::Control},
-  {921310u, property::type::Control},
-  {921311u, property::type::Control},
-  {921312u, property::type::Control},
-  {921313u, property::type::Control},
-  {921314u, property::type::Control},
-  {921315u, property::type::Control},
-  {921316u, property::type::Control},
-  {921317u, property::type::Control},
-  {921318u, property::type::Control},
-  {921319u, property::type::Control},
-  {921320u, property::type::Control},
-  {921321u, property::type::Control},
-  {921322u, property::type::Control},
-  {921323u, property::type::Control},
-  {921324u, property::type::Control},
-  {921325u, property::type::Control},
-  {921326u, property::type::Control},
-  {921327u, property::type::Control},
-  {921328u, property::type::Control},
-  {921329u, property::type::Control},
-  {921330u, property::type::Control},
-  {921331u, property::type::Control},
-  {921332u, property::type::Control},
-  {921333u, property::type::Control},
-  {921334u, property::type::Control},
-  {921335u, property::type::Control},
-  {921336u, property::type::Control},
-  {921337u, property::type::Control},
-  {921338u, property::type::Control},
-  {921339u, property::type::Control},
-  {921340u, property::type::Control},
-  {921341u, property::type::Control},
-  {921342u, property::type::Control},
-  {921343u, property::type::Control},
-  {921344u, property::type::Control},
-  {921345u, property::type::Control},
-  {921346u, property::type::Control},
-  {921347u, property::type::Control},
-  {921348u, property::type::Control},
-  {921349u, property::type::Control},
-  {921350u, property::type::Control},
-  {921351u, property::type::Control},
-  {921352u, property::type::Control},
-  {921353u, property::type::Control},
-  {921354u, property::type::Control},
-  {921355u, property::type::Control},
-  {921356u, property::type::Control},
-  {921357u, property::type::Control},
-  {921358u, property::type::Control},
-  {921359u, property::type::Control},
-  {921360u, property::type::Control},
-  {921361u, property::type::Control},
-  {921362u, property::type::Control},
-  {921363u, property::type::Control},
-  {921364u, property::type::Control},
-  {921365u, property::type::Control},
-  {921366u, property::type::Control},
-  {921367u, property::type::Control},
-  {921368u, property::type::Control},
-  {921369u, property::type::Control},
-  {921370u, property::type::Control},
-  {921371u, property::type::Control},
-  {921372u, property::type::Control},
-  {921373u, property::type::Control},
-  {921374u, property::type::Control},
-  {921375u, property::type::Control},
-  {921376u, property::type::Control},
-  {921377u, property::type::Control},
-  {921378u, property::type::Control},
-  {921379u, property::type::Control},
-  {921380u, property::type::Control},
-  {921381u, property::type::Control},
-  {921382u, property::type::Control},
-  {921383u, property::type::Control},
-  {921384u, property::type::Control},
-  {921385u, property::type::Control},
-  {921386u, property::type::Control},
-  {921387u, property::type::Control},
-  {921388u, property::type::Control},
-  {921389u, property::type::Control},
-  {921390u, property::type::Control},
-  {921391u, property::type::Control},
-  {921392u, property::type::Control},
-  {921393u, property::type::Control},
-  {921394u, property::type::Control},
-  {921395u, property::type::Control},
-  {921396u, property::type::Control},
-  {921397u, property::type::Control},
-  {921398u, property::type::Control},
-  {921399u, property::type::Control},
-  {921400u, property::type::Control},
-  {921401u, property::type::Control},
-  {921402u, property::type::Control},
-  {921403u, property::type::Control},
-  {921404u, property::type::Control},
-  {921405u, property::type::Control},
-  {921406u, property::type::Control},
-  {921407u, property::type::Control},
-  {921408u, property::type::Control},
-  {921409u, property::type::Control},
-  {921410u, property::type::Control},
-  {921411u, property::type::Control},
-  {921412u, property::type::Control},
-  {921413u, property::type::Control},
-  {921414u, property::type::Control},
-  {921415u, property::type::Control},
-  {921416u, property::type::Control},
-  {921417u, property::type::Control},
-  {921418u, property::type::Control},
-  {921419u, property::type::Control},
-  {921420u, property::type::Control},
-  {921421u, property::type::Control},
-  {921422u, property::type::Control},
-  {921423u, property::type::Control},
-  {921424u, property::type::Control},
-  {921425u, property::type::Control},
-  {921426u, property::type::Control},
-  {921427u, property::type::Control},
-  {921428u, property::type::Control},
-  {921429u, property::type::Control},
-  {921430u, property::type::Control},
-  {921431u, property::type::Control},
-  {921432u, property::type::Control},
-  {921433u, property::type::Control},
-  {921434u, property::type::Control},
-  {921435u, property::type::Control},
-  {921436u, property::type::Control},
-  {921437u, property::type::Control},
-  {921438u, property::type::Control},
-  {921439u, property::type::Control},
-  {921440u, property::type::Control},
-  {921441u, property::type::Control},
-  {921442u, property::type::Control},
-  {921443u, property::type::Control},
-  {921444u, property::type::Control},
-  {921445u, property::type::Control},
-  {921446u, property::type::Control},
-  {921447u, property::type::Control},
-  {921448u, property::type::Control},
-  {921449u, property::type::Control},
-  {921450u, property::type::Control},
-  {921451u, property::type::Control},
-  {921452u, property::type::Control},
-  {921453u, property::type::Control},
-  {921454u, property::type::Control},
-  {921455u, property::type::Control},
-  {921456u, property::type::Control},
-  {921457u, property::type::Control},
-  {921458u, property::type::Control},
-  {921459u, property::type::Control},
-  {921460u, property::type::Control},
-  {921461u, property::type::Control},
-  {921462u, property::type::Control},
-  {921463u, property::type::Control},
-  {921464u, property::type::Control},
-  {921465u, property::type::Control},
-  {921466u, property::type::Control},
-  {921467u, property::type::Control},
-  {921468u, property::type::Control},
-  {921469u, property::type::Control},
-  {921470u, property::type::Control},
-  {921471u, property::type::Control},
-  {921472u, property::type::Control},
-  {921473u, property::type::Control},
-  {921474u, property::type::Control},
-  {921475u, property::type::Control},
-  {921476u, property::type::Control},
-  {921477u, property::type::Control},
-  {921478u, property::type::Control},
-  {921479u, property::type::Control},
-  {921480u, property::type::Control},
-  {921481u, property::type::Control},
-  {921482u, property::type::Control},
-  {921483u, property::type::Control},
-  {921484u, property::type::Control},
-  {921485u, property::type::Control},
-  {921486u, property::type::Control},
-  {921487u, property::type::Control},
-  {921488u, property::type::Control},
-  {921489u, property::type::Control},
-  {921490u, property::type::Control},
-  {921491u, property::type::Control},
-  {921492u, property::type::Control},
-  {921493u, property::type::Control},
-  {921494u, property::type::Control},
-  {921495u, property::type::Control},
-  {921496u, property::type::Control},
-  {921497u, property::type::Control},
-  {921498u, property::type::Control},
-  {921499u, property::type::Control},
-  {921500u, property::type::Control},
-  {921501u, property::type::Control},
-  {921502u, property::type::Control},
-  {921503u, property::type::Control},
-  {921504u, property::type::Control},
-  {921505u, property::type::Control},
-  {921506u, property::type::Control},
-  {921507u, property::type::Control},
-  {921508u, property::type::Control},
-  {921509u, property::type::Control},
-  {921510u, property::type::Control},
-  {921511u, property::type::Control},
-  {921512u, property::type::Control},
-  {921513u, property::type::Control},
-  {921514u, property::type::Control},
-  {921515u, property::type::Control},
-  {921516u, property::type::Control},
-  {921517u, property::type::Control},
-  {921518u, property::type::Control},
-  {921519u, property::type::Control},
-  {921520u, property::type::Control},
-  {921521u, property::type::Control},
-  {921522u, property::type::Control},
-  {921523u, property::type::Control},
-  {921524u, property::type::Control},
-  {921525u, property::type::Control},
-  {921526u, property::type::Control},
-  {921527u, property::type::Control},
-  {921528u, property::type::Control},
-  {921529u, property::type::Control},
-  {921530u, property::type::Control},
-  {921531u, property::type::Control},
-  {921532u, property::type::Control},
-  {921533u, property::type::Control},
-  {921534u, property::type::Control},
-  {921535u, property::type::Control},
-  {921536u, property::type::Control},
-  {921537u, property::type::Control},
-  {921538u, property::type::Control},
-  {921539u, property::type::Control},
-  {921540u, property::type::Control},
-  {921541u, property::type::Control},
-  {921542u, property::type::Control},
-  {921543u, property::type::Control},
-  {921544u, property::type::Control},
-  {921545u, property::type::Control},
-  {921546u, property::type::Control},
-  {921547u, property::type::Control},
-  {921548u, property::type::Control},
-  {921549u, property::type::Control},
-  {921550u, property::type::Control},
-  {921551u, property::type::Control},
-  {921552u, property::type::Control},
-  {921553u, property::type::Control},
-  {921554u, property::type::Control},
-  {921555u, property::type::Control},
-  {921556u, property::type::Control},
-  {921557u, property::type::Control},
-  {921558u, property::type::Control},
-  {921559u, property::type::Control},
-  {921560u, property::type::Control},
-  {921561u, property::type::Control},
-  {921562u, property::type::Control},
-  {921563u, property::type::Control},
-  {921564u, property::type::Control},
-  {921565u, property::type::Control},
-  {921566u, property::type::Control},
-  {921567u, property::type::Control},
-  {921568u, property::type::Control},
-  {921569u, property::type::Control},
-  {921570u, property::type::Control},
-  {921571u, property::type::Control},
-  {921572u, property::type::Control},
-  {921573u, property::type::Control},
-  {921574u, property::type::Control},
-  {921575u, property::type::Control},
-  {921576u, property::type::Control},
-  {921577u, property::type::Control},
-  {921578u, property::type::Control},
-  {921579u, property::type::Control},
-  {921580u, property::type::Control},
-  {921581u, property::type::Control},
-  {921582u, property::type::Control},
-  {921583u, property::type::Control},
-  {921584u, property::type::Control},
-  {921585u, property::type::Control},
-  {921586u, property::type::Control},
-  {921587u, property::type::Control},
-  {921588u, property::type::Control},
-  {921589u, property::type::Control},
-  {921590u, property::type::Control},
-  {921591u, property::type::Control},
-  {921592u, property::type::Control},
-  {921593u, property::type::Control},
-  {921594u, property::type::Control},
-  {921595u, property::type::Control},
-  {921596u, property::type::Control},
-  {921597u, property::type::Control},
-  {921598u, property::type::Control},
-  {921599u, property::type::Control},
-  {768u, property::type::Extend},
-  {769u, property::type::Extend},
-  {770u, property::type::Extend},
-  {771u, property::type::Extend},
-  {772u, property::type::Extend},
-  {773u, property::type::Extend},
-  {774u, property::type::Extend},
-  {775u, property::type::Extend},
-  {776u, property::type::Extend},
-  {777u, property::type::Extend},
-  {778u, property::type::Extend},
-  {779u, property::type::Extend},
-  {780u, property::type::Extend},
-  {781u, property::type::Extend},
-  {782u, property::type::Extend},
-  {783u, property::type::Extend},
-  {784u, property::type::Extend},
-  {785u, property::type::Extend},
-  {786u, property::type::Extend},
-  {787u, property::type::Extend},
-  {788u, property::type::Extend},
-  {789u, property::type::Extend},
-  {790u, property::type::Extend},
-  {791u, property::type::Extend},
-  {792u, property::type::Extend},
-  {793u, property::type::Extend},
-  {794u, property::type::Extend},
-  {795u, property::type::Extend},
-  {796u, property::type::Extend},
-  {797u, property::type::Extend},
-  {798u, property::type::Extend},
-  {799u, property::type::Extend},
-  {800u, property::type::Extend},
-  {801u, property::type::Extend},
-  {802u, property::type::Extend},
-  {803u, property::type::Extend},
-  {804u, property::type::Extend},
-  {805u, property::type::Extend},
-  {806u, property::type::Extend},
-  {807u, property::type::Extend},
-  {808u, property::type::Extend},
-  {809u, property::type::Extend},
-  {810u, property::type::Extend},
-  {811u, property::type::Extend},
-  {812u, property::type::Extend},
-  {813u, property::type::Extend},
-  {814u, property::type::Extend},
-  {815u, property::type::Extend},
-  {816u, property::type::Extend},
-  {817u, property::type::Extend},
-  {818u, property::type::Extend},
-  {819u, property::type::Extend},
-  {820u, property::type::Extend},
-  {821u, property::type::Extend},
-  {822u, property::type::Extend},
-  {823u, property::type::Extend},
-  {824u, property::type::Extend},
-  {825u, property::type::Extend},
-  {826u, property::type::Extend},
-  {827u, property::type::Extend},
-  {828u, property::type::Extend},
-  {829u, property::type::Extend},
-  {830u, property::type::Extend},
-  {831u, property::type::Extend},
-  {832u, property::type::Extend},
-  {833u, property::type::Extend},
-  {834u, property::type::Extend},
-  {835u, property::type::Extend},
-  {836u, property::type::Extend},
-  {837u, property::type::Extend},
-  {838u, property::type::Extend},
-  {839u, property::type::Extend},
-  {840u, property::type::Extend},
-  {841u, property::type::Extend},
-  {842u, property::type::Extend},
-  {843u, property::type::Extend},
-  {844u, property::type::Extend},
-  {845u, property::type::Extend},
-  {846u, property::type::Extend},
-  {847u, property::type::Extend},
-  {848u, property::type::Extend},
-  {849u, property::type::Extend},
-  {850u, property::type::Extend},
-  {851u, property::type::Extend},
-  {852u, property::type::Extend},
-  {853u, property::type::Extend},
-  {854u, property::type::Extend},
-  {855u, property::type::Extend},
-  {856u, property::type::Extend},
-  {857u, property::type::Extend},
-  {858u, property::type::Extend},
-  {859u, property::type::Extend},
-  {860u, property::type::Extend},
-  {861u, property::type::Extend},
-  {862u, property::type::Extend},
-  {863u, property::type::Extend},
-  {864u, property::type::Extend},
-  {865u, property::type::Extend},
-  {866u, property::type::Extend},
-  {867u, property::type::Extend},
-  {868u, property::type::Extend},
-  {869u, property::type::Extend},
-  {870u, property::type::Extend},
-  {871u, property::type::Extend},
-  {872u, property::type::Extend},
-  {873u, property::type::Extend},
-  {874u, property::type::Extend},
-  {875u, property::type::Extend},
-  {876u, property::type::Extend},
-  {877u, property::type::Extend},
-  {878u, property::type::Extend},
-  {879u, property::type::Extend},
-  {1155u, property::type::Extend},
-  {1156u, property::type::Extend},
-  {1157u, property::type::Extend},
-  {1158u, property::type::Extend},
-  {1159u, property::type::Extend},
-  {1160u, property::type::Extend},
-  {1161u, property::type::Extend},
-  {1425u, property::type::Extend},
-  {1426u, property::type::Extend},
-  {1427u, property::type::Extend},
-  {1428u, property::type::Extend},
-  {1429u, property::type::Extend},
-  {1430u, property::type::Extend},
-  {1431u, property::type::Extend},
-  {1432u, property::type::Extend},
-  {1433u, property::type::Extend},
-  {1434u, property::type::Extend},
-  {1435u, property::type::Extend},
-  {1436u, property::type::Extend},
-  {1437u, property::type::Extend},
-  {1438u, property::type::Extend},
-  {1439u, property::type::Extend},
-  {1440u, property::type::Extend},
-  {1441u, property::type::Extend},
-  {1442u, property::type::Extend},
-  {1443u, property::type::Extend},
-  {1444u, property::type::Extend},
-  {1445u, property::type::Extend},
-  {1446u, property::type::Extend},
-  {1447u, property::type::Extend},
-  {1448u, property::type::Extend},
-  {1449u, property::type::Extend},
-  {1450u, property::type::Extend},
-  {1451u, property::type::Extend},
-  {1452u, property::type::Extend},
-  {1453u, property::type::Extend},
-  {1454u, property::type::Extend},
-  {1455u, property::type::Extend},
-  {1456u, property::type::Extend},
-  {1457u, property::type::Extend},
-  {1458u, property::type::Extend},
-  {1459u, property::type::Extend},
-  {1460u, property::type::Extend},
-  {1461u, property::type::Extend},
-  {1462u, property::type::Extend},
-  {1463u, property::type::Extend},
-  {1464u, property::type::Extend},
-  {1465u, property::type::Extend},
-  {1466u, property::type::Extend},
-  {1467u, property::type::Extend},
-  {1468u, property::type::Extend},
-  {1469u, property::type::Extend},
-  {1471u, property::type::Extend},
-  {1473u, property::type::Extend},
-  {1474u, property::type::Extend},
-  {1476u, property::type::Extend},
-  {1477u, property::type::Extend},
-  {1479u, property::type::Extend},
-  {1552u, property::type::Extend},
-  {1553u, property::type::Extend},
-  {1554u, property::type::Extend},
-  {1555u, property::type::Extend},
-  {1556u, property::type::Extend},
-  {1557u, property::type::Extend},
-  {1558u, property::type::Extend},
-  {1559u, property::type::Extend},
-  {1560u, property::type::Extend},
-  {1561u, property::type::Extend},
-  {1562u, property::type::Extend},
-  {1611u, property::type::Extend},
-  {1612u, property::type::Extend},
-  {1613u, property::type::Extend},
-  {1614u, property::type::Extend},
-  {1615u, property::type::Extend},
-  {1616u, property::type::Extend},
-  {1617u, property::type::Extend},
-  {1618u, property::type::Extend},
-  {1619u, property::type::Extend},
-  {1620u, property::type::Extend},
-  {1621u, property::type::Extend},
-  {1622u, property::type::Extend},
-  {1623u, property::type::Extend},
-  {1624u, property::type::Extend},
-  {1625u, property::type::Extend},
-  {1626u, property::type::Extend},
-  {1627u, property::type::Extend},
-  {1628u, property::type::Extend},
-  {1629u, property::type::Extend},
-  {1630u, property::type::Extend},
-  {1631u, property::type::Extend},
-  {1648u, property::type::Extend},
-  {1750u, property::type::Extend},
-  {1751u, property::type::Extend},
-  {1752u, property::type::Extend},
-  {1753u, property::type::Extend},
-  {1754u, property::type::Extend},
-  {1755u, property::type::Extend},
-  {1756u, property::type::Extend},
-  {1759u, property::type::Extend},
-  {1760u, property::type::Extend},
-  {1761u, property::type::Extend},
-  {1762u, property::type::Extend},
-  {1763u, property::type::Extend},
-  {1764u, property::type::Extend},
-  {1767u, property::type::Extend},
-  {1768u, property::type::Extend},
-  {1770u, property::type::Extend},
-  {1771u, property::type::Extend},
-  {1772u, property::type::Extend},
-  {1773u, property::type::Extend},
-  {1809u, property::type::Extend},
-  {1840u, property::type::Extend},
-  {1841u, property::type::Extend},
-  {1842u, property::type::Extend},
-  {1843u, property::type::Extend},
-  {1844u, property::type::Extend},
-  {1845u, property::type::Extend},
-  {1846u, property::type::Extend},
-  {1847u, property::type::Extend},
-  {1848u, property::type::Extend},
-  {1849u, property::type::Extend},
-  {1850u, property::type::Extend},
-  {1851u, property::type::Extend},
-  {1852u, property::type::Extend},
-  {1853u, property::type::Extend},
-  {1854u, property::type::Extend},
-  {1855u, property::type::Extend},
-  {1856u, property::type::Extend},
-  {1857u, property::type::Extend},
-  {1858u, property::type::Extend},
-  {1859u, property::type::Extend},
-  {1860u, property::type::Extend},
-  {1861u, property::type::Extend},
-  {1862u, property::type::Extend},
-  {1863u, property::type::Extend},
-  {1864u, property::type::Extend},
-  {1865u, property::type::Extend},
-  {1866u, property::type::Extend},
-  {1958u, property::type::Extend},
-  {1959u, property::type::Extend},
-  {1960u, property::type::Extend},
-  {1961u, property::type::Extend},
-  {1962u, property::type::Extend},
-  {1963u, property::type::Extend},
-  {1964u, property::type::Extend},
-  {1965u, property::type::Extend},
-  {1966u, property::type::Extend},
-  {1967u, property::type::Extend},
-  {1968u, property::type::Extend},
-  {2027u, property::type::Extend},
-  {2028u, property::type::Extend},
-  {2029u, property::type::Extend},
-  {2030u, property::type::Extend},
-  {2031u, property::type::Extend},
-  {2032u, property::type::Extend},
-  {2033u, property::type::Extend},
-  {2034u, property::type::Extend},
-  {2035u, property::type::Extend},
-  {2045u, property::type::Extend},
-  {2070u, property::type::Extend},
-  {2071u, property::type::Extend},
-  {2072u, property::type::Extend},
-  {2073u, property::type::Extend},
-  {2075u, property::type::Extend},
-  {2076u, property::type::Extend},
-  {2077u, property::type::Extend},
-  {2078u, property::type::Extend},
-  {2079u, property::type::Extend},
-  {2080u, property::type::Extend},
-  {2081u, property::type::Extend},
-  {2082u, property::type::Extend},
-  {2083u, property::type::Extend},
-  {2085u, property::type::Extend},
-  {2086u, property::type::Extend},
-  {2087u, property::type::Extend},
-  {2089u, property::type::Extend},
-  {2090u, property::type::Extend},
-  {2091u, property::type::Extend},
-  {2092u, property::type::Extend},
-  {2093u, property::type::Extend},
-  {2137u, property::type::Extend},
-  {2138u, property::type::Extend},
-  {2139u, property::type::Extend},
-  {2200u, property::type::Extend},
-  {2201u, property::type::Extend},
-  {2202u, property::type::Extend},
-  {2203u, property::type::Extend},
-  {2204u, property::type::Extend},
-  {2205u, property::type::Extend},
-  {2206u, property::type::Extend},
-  {2207u, property::type::Extend},
-  {2250u, property::type::Extend},
-  {2251u, property::type::Extend},
-  {2252u, property::type::Extend},
-  {2253u, property::type::Extend},
-  {2254u, property::type::Extend},
-  {2255u, property::type::Extend},
-  {2256u, property::type::Extend},
-  {2257u, property::type::Extend},
-  {2258u, property::type::Extend},
-  {2259u, property::type::Extend},
-  {2260u, property::type::Extend},
-  {2261u, property::type::Extend},
-  {2262u, property::type::Extend},
-  {2263u, property::type::Extend},
-  {2264u, property::type::Extend},
-  {2265u, property::type::Extend},
-  {2266u, property::type::Extend},
-  {2267u, property::type::Extend},
-  {2268u, property::type::Extend},
-  {2269u, property::type::Extend},
-  {2270u, property::type::Extend},
-  {2271u, property::type::Extend},
-  {2272u, property::type::Extend},
-  {2273u, property::type::Extend},
-  {2275u, property::type::Extend},
-  {2276u, property::type::Extend},
-  {2277u, property::type::Extend},
-  {2278u, property::type::Extend},
-  {2279u, property::type::Extend},
-  {2280u, property::type::Extend},
-  {2281u, property::type::Extend},
-  {2282u, property::type::Extend},
-  {2283u, property::type::Extend},
-  {2284u, property::type::Extend},
-  {2285u, property::type::Extend},
-  {2286u, property::type::Extend},
-  {2287u, property::type::Extend},
-  {2288u, property::type::Extend},
-  {2289u, property::type::Extend},
-  {2290u, property::type::Extend},
-  {2291u, property::type::Extend},
-  {2292u, property::type::Extend},
-  {2293u, property::type::Extend},
-  {2294u, property::type::Extend},
-  {2295u, property::type::Extend},
-  {2296u, property::type::Extend},
-  {2297u, property::type::Extend},
-  {2298u, property::type::Extend},
-  {2299u, property::type::Extend},
-  {2300u, property::type::Extend},
-  {2301u, property::type::Extend},
-  {2302u, property::type::Extend},
-  {2303u, property::type::Extend},
-  {2304u, property::type::Extend},
-  {2305u, property::type::Extend},
-  {2306u, property::type::Extend},
-  {2362u, property::type::Extend},
-  {2364u, property::type::Extend},
-  {2369u, property::type::Extend},
-  {2370u, property::type::Extend},
-  {2371u, property::type::Extend},
-  {2372u, property::type::Extend},
-  {2373u, property::type::Extend},
-  {2374u, property::type::Extend},
-  {2375u, property::type::Extend},
-  {2376u, property::type::Extend},
-  {2381u, property::type::Extend},
-  {2385u, property::type::Extend},
-  {2386u, property::type::Extend},
-  {2387u, property::type::Extend},
-  {2388u, property::type::Extend},
-  {2389u, property::type::Extend},
-  {2390u, property::type::Extend},
-  {2391u, property::type::Extend},
-  {2402u, property::type::Extend},
-  {2403u, property::type::Extend},
-  {2433u, property::type::Extend},
-  {2492u, property::type::Extend},
-  {2494u, property::type::Extend},
-  {2497u, property::type::Extend},
-  {2498u, property::type::Extend},
-  {2499u, property::type::Extend},
-  {2500u, property::type::Extend},
-  {2509u, property::type::Extend},
-  {2519u, property::type::Extend},
-  {2530u, property::type::Extend},
-  {2531u, property::type::Extend},
-  {2558u, property::type::Extend},
-  {2561u, property::type::Extend},
-  {2562u, property::type::Extend},
-  {2620u, property::type::Extend},
-  {2625u, property::type::Extend},
-  {2626u, property::type::Extend},
-  {2631u, property::type::Extend},
-  {2632u, property::type::Extend},
-  {2635u, property::type::Extend},
-  {2636u, property::type::Extend},
-  {2637u, property::type::Extend},
-  {2641u, property::type::Extend},
-  {2672u, property::type::Extend},
-  {2673u, property::type::Extend},
-  {2677u, property::type::Extend},
-  {2689u, property::type::Extend},
-  {2690u, property::type::Extend},
-  {2748u, property::type::Extend},
-  {2753u, property::type::Extend},
-  {2754u, property::type::Extend},
-  {2755u, property::type::Extend},
-  {2756u, property::type::Extend},
-  {2757u, property::type::Extend},
-  {2759u, property::type::Extend},
-  {2760u, property::type::Extend},
-  {2765u, property::type::Extend},
-  {2786u, property::type::Extend},
-  {2787u, property::type::Extend},
-  {2810u, property::type::Extend},
-  {2811u, property::type::Extend},
-  {2812u, property::type::Extend},
-  {2813u, property::type::Extend},
-  {2814u, property::type::Extend},
-  {2815u, property::type::Extend},
-  {2817u, property::type::Extend},
-  {2876u, property::type::Extend},
-  {2878u, property::type::Extend},
-  {2879u, property::type::Extend},
-  {2881u, property::type::Extend},
-  {2882u, property::type::Extend},
-  {2883u, property::type::Extend},
-  {2884u, property::type::Extend},
-  {2893u, property::type::Extend},
-  {2901u, property::type::Extend},
-  {2902u, property::type::Extend},
-  {2903u, property::type::Extend},
-  {2914u, property::type::Extend},
-  {2915u, property::type::Extend},
-  {2946u, property::type::Extend},
-  {3006u, property::type::Extend},
-  {3008u, property::type::Extend},
-  {3021u, property::type::Extend},
-  {3031u, property::type::Extend},
-  {3072u, property::type::Extend},
-  {3076u, property::type::Extend},
-  {3132u, property::type::Extend},
-  {3134u, property::type::Extend},
-  {3135u, property::type::Extend},
-  {3136u, property::type::Extend},
-  {3142u, property::type::Extend},
-  {3143u, property::type::Extend},
-  {3144u, property::type::Extend},
-  {3146u, property::type::Extend},
-  {3147u, property::type::Extend},
-  {3148u, property::type::Extend},
-  {3149u, property::type::Extend},
-  {3157u, property::type::Extend},
-  {3158u, property::type::Extend},
-  {3170u, property::type::Extend},
-  {3171u, property::type::Extend},
-  {3201u, property::type::Extend},
-  {3260u, property::type::Extend},
-  {3263u, property::type::Extend},
-  {3266u, property::type::Extend},
-  {3270u, property::type::Extend},
-  {3276u, property::type::Extend},
-  {3277u, property::type::Extend},
-  {3285u, property::type::Extend},
-  {3286u, property::type::Extend},
-  {3298u, property::type::Extend},
-  {3299u, property::type::Extend},
-  {3328u, property::type::Extend},
-  {3329u, property::type::Extend},
-  {3387u, property::type::Extend},
-  {3388u, property::type::Extend},
-  {3390u, property::type::Extend},
-  {3393u, property::type::Extend},
-  {3394u, property::type::Extend},
-  {3395u, property::type::Extend},
-  {3396u, property::type::Extend},
-  {3405u, property::type::Extend},
-  {3415u, property::type::Extend},
-  {3426u, property::type::Extend},
-  {3427u, property::type::Extend},
-  {3457u, property::type::Extend},
-  {3530u, property::type::Extend},
-  {3535u, property::type::Extend},
-  {3538u, property::type::Extend},
-  {3539u, property::type::Extend},
-  {3540u, property::type::Extend},
-  {3542u, property::type::Extend},
-  {3551u, property::type::Extend},
-  {3633u, property::type::Extend},
-  {3636u, property::type::Extend},
-  {3637u, property::type::Extend},
-  {3638u, property::type::Extend},
-  {3639u, property::type::Extend},
-  {3640u, property::type::Extend},
-  {3641u, property::type::Extend},
-  {3642u, property::type::Extend},
-  {3655u, property::type::Extend},
-  {3656u, property::type::Extend},
-  {3657u, property::type::Extend},
-  {3658u, property::type::Extend},
-  {3659u, property::type::Extend},
-  {3660u, property::type::Extend},
-  {3661u, property::type::Extend},
-  {3662u, property::type::Extend},
-  {3761u, property::type::Extend},
-  {3764u, property::type::Extend},
-  {3765u, property::type::Extend},
-  {3766u, property::type::Extend},
-  {3767u, property::type::Extend},
-  {3768u, property::type::Extend},
-  {3769u, property::type::Extend},
-  {3770u, property::type::Extend},
-  {3771u, property::type::Extend},
-  {3772u, property::type::Extend},
-  {3784u, property::type::Extend},
-  {3785u, property::type::Extend},
-  {3786u, property::type::Extend},
-  {3787u, property::type::Extend},
-  {3788u, property::type::Extend},
-  {3789u, property::type::Extend},
-  {3790u, property::type::Extend},
-  {3864u, property::type::Extend},
-  {3865u, property::type::Extend},
-  {3893u, property::type::Extend},
-  {3895u, property::type::Extend},
-  {3897u, property::type::Extend},
-  {3953u, property::type::Extend},
-  {3954u, property::type::Extend},
-  {3955u, property::type::Extend},
-  {3956u, property::type::Extend},
-  {3957u, property::type::Extend},
-  {3958u, property::type::Extend},
-  {3959u, property::type::Extend},
-  {3960u, property::type::Extend},
-  {3961u, property::type::Extend},
-  {3962u, property::type::Extend},
-  {3963u, property::type::Extend},
-  {3964u, property::type::Extend},
-  {3965u, property::type::Extend},
-  {3966u, property::type::Extend},
-  {3968u, property::type::Extend},
-  {3969u, property::type::Extend},
-  {3970u, property::type::Extend},
-  {3971u, property::type::Extend},
-  {3972u, property::type::Extend},
-  {3974u, property::type::Extend},
-  {3975u, property::type::Extend},
-  {3981u, property::type::Extend},
-  {3982u, property::type::Extend},
-  {3983u, property::type::Extend},
-  {3984u, property::type::Extend},
-  {3985u, property::type::Extend},
-  {3986u, property::type::Extend},
-  {3987u, property::type::Extend},
-  {3988u, property::type::Extend},
-  {3989u, property::type::Extend},
-  {3990u, property::type::Extend},
-  {3991u, property::type::Extend},
-  {3993u, property::type::Extend},
-  {3994u, property::type::Extend},
-  {3995u, property::type::Extend},
-  {3996u, property::type::Extend},
-  {3997u, property::type::Extend},
-  {3998u, property::type::Extend},
-  {3999u, property::type::Extend},
-  {4000u, property::type::Extend},
-  {4001u, property::type::Extend},
-  {4002u, property::type::Extend},
-  {4003u, property::type::Extend},
-  {4004u, property::type::Extend},
-  {4005u, property::type::Extend},
-  {4006u, property::type::Extend},
-  {4007u, property::type::Extend},
-  {4008u, property::type::Extend},
-  {4009u, property::type::Extend},
-  {4010u, property::type::Extend},
-  {4011u, property::type::Extend},
-  {4012u, property::type::Extend},
-  {4013u, property::type::Extend},
-  {4014u, property::type::Extend},
-  {4015u, property::type::Extend},
-  {4016u, property::type::Extend},
-  {4017u, property::type::Extend},
-  {4018u, property::type::Extend},
-  {4019u, property::type::Extend},
-  {4020u, property::type::Extend},
-  {4021u, property::type::Extend},
-  {4022u, property::type::Extend},
-  {4023u, property::type::Extend},
-  {4024u, property::type::Extend},
-  {4025u, property::type::Extend},
-  {4026u, property::type::Extend},
-  {4027u, property::type::Extend},
-  {4028u, property::type::Extend},
-  {4038u, property::type::Extend},
-  {4141u, property::type::Extend},
-  {4142u, property::type::Extend},
-  {4143u, property::type::Extend},
-  {4144u, property::type::Extend},
-  {4146u, property::type::Extend},
-  {4147u, property::type::Extend},
-  {4148u, property::type::Extend},
-  {4149u, property::type::Extend},
-  {4150u, property::type::Extend},
-  {4151u, property::type::Extend},
-  {4153u, property::type::Extend},
-  {4154u, property::type::Extend},
-  {4157u, property::type::Extend},
-  {4158u, property::type::Extend},
-  {4184u, property::type::Extend},
-  {4185u, property::type::Extend},
-  {4190u, property::type::Extend},
-  {4191u, property::type::Extend},
-  {4192u, property::type::Extend},
-  {4209u, property::type::Extend},
-  {4210u, property::type::Extend},
-  {4211u, property::type::Extend},
-  {4212u, property::type::Extend},
-  {4226u, property::type::Extend},
-  {4229u, property::type::Extend},
-  {4230u, property::type::Extend},
-  {4237u, property::type::Extend},
-  {4253u, property::type::Extend},
-  {4957u, property::type::Extend},
-  {4958u, property::type::Extend},
-  {4959u, property::type::Extend},
-  {5906u, property::type::Extend},
-  {5907u, property::type::Extend},
-  {5908u, property::type::Extend},
-  {5938u, property::type::Extend},
-  {5939u, property::type::Extend},
-  {5970u, property::type::Extend},
-  {5971u, property::type::Extend},
-  {6002u, property::type::Extend},
-  {6003u, property::type::Extend},
-  {6068u, property::type::Extend},
-  {6069u, property::type::Extend},
-  {6071u, property::type::Extend},
-  {6072u, property::type::Extend},
-  {6073u, property::type::Extend},
-  {6074u, property::type::Extend},
-  {6075u, property::type::Extend},
-  {6076u, property::type::Extend},
-  {6077u, property::type::Extend},
-  {6086u, property::type::Extend},
-  {6089u, property::type::Extend},
-  {6090u, property::type::Extend},
-  {6091u, property::type::Extend},
-  {6092u, property::type::Extend},
-  {6093u, property::type::Extend},
-  {6094u, property::type::Extend},
-  {6095u, property::type::Extend},
-  {6096u, property::type::Extend},
-  {6097u, property::type::Extend},
-  {6098u, property::type::Extend},
-  {6099u, property::type::Extend},
-  {6109u, property::type::Extend},
-  {6155u, property::type::Extend},
-  {6156u, property::type::Extend},
-  {6157u, property::type::Extend},
-  {6159u, property::type::Extend},
-  {6277u, property::type::Extend},
-  {6278u, property::type::Extend},
-  {6313u, property::type::Extend},
-  {6432u, property::type::Extend},
-  {6433u, property::type::Extend},
-  {6434u, property::type::Extend},
-  {6439u, property::type::Extend},
-  {6440u, property::type::Extend},
-  {6450u, property::type::Extend},
-  {6457u, property::type::Extend},
-  {6458u, property::type::Extend},
-  {6459u, property::type::Extend},
-  {6679u, property::type::Extend},
-  {6680u, property::type::Extend},
-  {6683u, property::type::Extend},
-  {6742u, property::type::Extend},
-  {6744u, property::type::Extend},
-  {6745u, property::type::Extend},
-  {6746u, property::type::Extend},
-  {6747u, property::type::Extend},
-  {6748u, property::type::Extend},
-  {6749u, property::type::Extend},
-  {6750u, property::type::Extend},
-  {6752u, property::type::Extend},
-  {6754u, property::type::Extend},
-  {6757u, property::type::Extend},
-  {6758u, property::type::Extend},
-  {6759u, property::type::Extend},
-  {6760u, property::type::Extend},
-  {6761u, property::type::Extend},
-  {6762u, property::type::Extend},
-  {6763u, property::type::Extend},
-  {6764u, property::type::Extend},
-  {6771u, property::type::Extend},
-  {6772u, property::type::Extend},
-  {6773u, property::type::Extend},
-  {6774u, property::type::Extend},
-  {6775u, property::type::Extend},
-  {6776u, property::type::Extend},
-  {6777u, property::type::Extend},
-  {6778u, property::type::Extend},
-  {6779u, property::type::Extend},
-  {6780u, property::type::Extend},
-  {6783u, property::type::Extend},
-  {6832u, property::type::Extend},
-  {6833u, property::type::Extend},
-  {6834u, property::type::Extend},
-  {6835u, property::type::Extend},
-  {6836u, property::type::Extend},
-  {6837u, property::type::Extend},
-  {6838u, property::type::Extend},
-  {6839u, property::type::Extend},
-  {6840u, property::type::Extend},
-  {6841u, property::type::Extend},
-  {6842u, property::type::Extend},
-  {6843u, property::type::Extend},
-  {6844u, property::type::Extend},
-  {6845u, property::type::Extend},
-  {6846u, property::type::Extend},
-  {6847u, property::type::Extend},
-  {6848u, property::type::Extend},
-  {6849u, property::type::Extend},
-  {6850u, property::type::Extend},
-  {6851u, property::type::Extend},
-  {6852u, property::type::Extend},
-  {6853u, property::type::Extend},
-  {6854u, property::type::Extend},
-  {6855u, property::type::Extend},
-  {6856u, property::type::Extend},
-  {6857u, property::type::Extend},
-  {6858u, property::type::Extend},
-  {6859u, property::type::Extend},
-  {6860u, property::type::Extend},
-  {6861u, property::type::Extend},
-  {6862u, property::type::Extend},
-  {6912u, property::type::Extend},
-  {6913u, property::type::Extend},
-  {6914u, property::type::Extend},
-  {6915u, property::type::Extend},
-  {6964u, property::type::Extend},
-  {6965u, property::type::Extend},
-  {6966u, property::type::Extend},
-  {6967u, property::type::Extend},
-  {6968u, property::type::Extend},
-  {6969u, property::type::Extend},
-  {6970u, property::type::Extend},
-  {6972u, property::type::Extend},
-  {6978u, property::type::Extend},
-  {7019u, property::type::Extend},
-  {7020u, property::type::Extend},
-  {7021u, property::type::Extend},
-  {7022u, property::type::Extend},
-  {7023u, property::type::Extend},
-  {7024u, property::type::Extend},
-  {7025u, property::type::Extend},
-  {7026u, property::type::Extend},
-  {7027u, property::type::Extend},
-  {7040u, property::type::Extend},
-  {7041u, property::type::Extend},
-  {7074u, property::type::Extend},
-  {7075u, property::type::Extend},
-  {7076u, property::type::Extend},
-  {7077u, property::type::Extend},
-  {7080u, property::type::Extend},
-  {7081u, property::type::Extend},
-  {7083u, property::type::Extend},
-  {7084u, property::type::Extend},
-  {7085u, property::type::Extend},
-  {7142u, property::type::Extend},
-  {7144u, property::type::Extend},
-  {7145u, property::type::Extend},
-  {7149u, property::type::Extend},
-  {7151u, property::type::Extend},
-  {7152u, property::type::Extend},
-  {7153u, property::type::Extend},
-  {7212u, property::type::Extend},
-  {7213u, property::type::Extend},
-  {7214u, property::type::Extend},
-  {7215u, property::type::Extend},
-  {7216u, property::type::Extend},
-  {7217u, property::type::Extend},
-  {7218u, property::type::Extend},
-  {7219u, property::type::Extend},
-  {7222u, property::type::Extend},
-  {7223u, property::type::Extend},
-  {7376u, property::type::Extend},
-  {7377u, property::type::Extend},
-  {7378u, property::type::Extend},
-  {7380u, property::type::Extend},
-  {7381u, property::type::Extend},
-  {7382u, property::type::Extend},
-  {7383u, property::type::Extend},
-  {7384u, property::type::Extend},
-  {7385u, property::type::Extend},
-  {7386u, property::type::Extend},
-  {7387u, property::type::Extend},
-  {7388u, property::type::Extend},
-  {7389u, property::type::Extend},
-  {7390u, property::type::Extend},
-  {7391u, property::type::Extend},
-  {7392u, property::type::Extend},
-  {7394u, property::type::Extend},
-  {7395u, property::type::Extend},
-  {7396u, property::type::Extend},
-  {7397u, property::type::Extend},
-  {7398u, property::type::Extend},
-  {7399u, property::type::Extend},
-  {7400u, property::type::Extend},
-  {7405u, property::type::Extend},
-  {7412u, property::type::Extend},
-  {7416u, property::type::Extend},
-  {7417u, property::type::Extend},
-  {7616u, property::type::Extend},
-  {7617u, property::type::Extend},
-  {7618u, property::type::Extend},
-  {7619u, property::type::Extend},
-  {7620u, property::type::Extend},
-  {7621u, property::type::Extend},
-  {7622u, property::type::Extend},
-  {7623u, property::type::Extend},
-  {7624u, property::type::Extend},
-  {7625u, property::type::Extend},
-  {7626u, property::type::Extend},
-  {7627u, property::type::Extend},
-  {7628u, property::type::Extend},
-  {7629u, property::type::Extend},
-  {7630u, property::type::Extend},
-  {7631u, property::type::Extend},
-  {7632u, property::type::Extend},
-  {7633u, property::type::Extend},
-  {7634u, property::type::Extend},
-  {7635u, property::type::Extend},
-  {7636u, property::type::Extend},
-  {7637u, property::type::Extend},
-  {7638u, property::type::Extend},
-  {7639u, property::type::Extend},
-  {7640u, property::type::Extend},
-  {7641u, property::type::Extend},
-  {7642u, property::type::Extend},
-  {7643u, property::type::Extend},
-  {7644u, property::type::Extend},
-  {7645u, property::type::Extend},
-  {7646u, property::type::Extend},
-  {7647u, property::type::Extend},
-  {7648u, property::type::Extend},
-  {7649u, property::type::Extend},
-  {7650u, property::type::Extend},
-  {7651u, property::type::Extend},
-  {7652u, property::type::Extend},
-  {7653u, property::type::Extend},
-  {7654u, property::type::Extend},
-  {7655u, property::type::Extend},
-  {7656u, property::type::Extend},
-  {7657u, property::type::Extend},
-  {7658u, property::type::Extend},
-  {7659u, property::type::Extend},
-  {7660u, property::type::Extend},
-  {7661u, property::type::Extend},
-  {7662u, property::type::Extend},
-  {7663u, property::type::Extend},
-  {7664u, property::type::Extend},
-  {7665u, property::type::Extend},
-  {7666u, property::type::Extend},
-  {7667u, property::type::Extend},
-  {7668u, property::type::Extend},
-  {7669u, property::type::Extend},
-  {7670u, property::type::Extend},
-  {7671u, property::type::Extend},
-  {7672u, property::type::Extend},
-  {7673u, property::type::Extend},
-  {7674u, property::type::Extend},
-  {7675u, property::type::Extend},
-  {7676u, property::type::Extend},
-  {7677u, property::type::Extend},
-  {7678u, property::type::Extend},
-  {7679u, property::type::Extend},
-  {8204u, property::type::Extend},
-  {8400u, property::type::Extend},
-  {8401u, property::type::Extend},
-  {8402u, property::type::Extend},
-  {8403u, property::type::Extend},
-  {8404u, property::type::Extend},
-  {8405u, property::type::Extend},
-  {8406u, property::type::Extend},
-  {8407u, property::type::Extend},
-  {8408u, property::type::Extend},
-  {8409u, property::type::Extend},
-  {8410u, property::type::Extend},
-  {8411u, property::type::Extend},
-  {8412u, property::type::Extend},
-  {8413u, property::type::Extend},
-  {8414u, property::type::Extend},
-  {8415u, property::type::Extend},
-  {8416u, property::type::Extend},
-  {8417u, property::type::Extend},
-  {8418u, property::type::Extend},
-  {8419u, property::type::Extend},
-  {8420u, property::type::Extend},
-  {8421u, property::type::Extend},
-  {8422u, property::type::Extend},
-  {8423u, property::type::Extend},
-  {8424u, property::type::Extend},
-  {8425u, property::type::Extend},
-  {8426u, property::type::Extend},
-  {8427u, property::type::Extend},
-  {8428u, property::type::Extend},
-  {8429u, property::type::Extend},
-  {8430u, property::type::Extend},
-  {8431u, property::type::Extend},
-  {8432u, property::type::Extend},
-  {11503u, property::type::Extend},
-  {11504u, property::type::Extend},
-  {11505u, property::type::Extend},
-  {11647u, property::type::Extend},
-  {11744u, property::type::Extend},
-  {11745u, property::type::Extend},
-  {11746u, property::type::Extend},
-  {11747u, property::type::Extend},
-  {11748u, property::type::Extend},
-  {11749u, property::type::Extend},
-  {11750u, property::type::Extend},
-  {11751u, property::type::Extend},
-  {11752u, property::type::Extend},
-  {11753u, property::type::Extend},
-  {11754u, property::type::Extend},
-  {11755u, property::type::Extend},
-  {11756u, property::type::Extend},
-  {11757u, property::type::Extend},
-  {11758u, property::type::Extend},
-  {11759u, property::type::Extend},
-  {11760u, property::type::Extend},
-  {11761u, property::type::Extend},
-  {11762u, property::type::Extend},
-  {11763u, property::type::Extend},
-  {11764u, property::type::Extend},
-  {11765u, property::type::Extend},
-  {11766u, property::type::Extend},
-  {11767u, property::type::Extend},
-  {11768u, property::type::Extend},
-  {11769u, property::type::Extend},
-  {11770u, property::type::Extend},
-  {11771u, property::type::Extend},
-  {11772u, property::type::Extend},
-  {11773u, property::type::Extend},
-  {11774u, property::type::Extend},
-  {11775u, property::type::Extend},
-  {12330u, property::type::Extend},
-  {12331u, property::type::Extend},
-  {12332u, property::type::Extend},
-  {12333u, property::type::Extend},
-  {12334u, property::type::Extend},
-  {12335u, property::type::Extend},
-  {12441u, property::type::Extend},
-  {12442u, property::type::Extend},
-  {42607u, property::type::Extend},
-  {42608u, property::type::Extend},
-  {42609u, property::type::Extend},
-  {42610u, property::type::Extend},
-  {42612u, property::type::Extend},
-  {42613u, property::type::Extend},
-  {42614u, property::type::Extend},
-  {42615u, property::type::Extend},
-  {42616u, property::type::Extend},
-  {42617u, property::type::Extend},
-  {42618u, property::type::Extend},
-  {42619u, property::type::Extend},
-  {42620u, property::type::Extend},
-  {42621u, property::type::Extend},
-  {42654u, property::type::Extend},
-  {42655u, property::type::Extend},
-  {42736u, property::type::Extend},
-  {42737u, property::type::Extend},
-  {43010u, property::type::Extend},
-  {43014u, property::type::Extend},
-  {43019u, property::type::Extend},
-  {43045u, property::type::Extend},
-  {43046u, property::type::Extend},
-  {43052u, property::type::Extend},
-  {43204u, property::type::Extend},
-  {43205u, property::type::Extend},
-  {43232u, property::type::Extend},
-  {43233u, property::type::Extend},
-  {43234u, property::type::Extend},
-  {43235u, property::type::Extend},
-  {43236u, property::type::Extend},
-  {43237u, property::type::Extend},
-  {43238u, property::type::Extend},
-  {43239u, property::type::Extend},
-  {43240u, property::type::Extend},
-  {43241u, property::type::Extend},
-  {43242u, property::type::Extend},
-  {43243u, property::type::Extend},
-  {43244u, property::type::Extend},
-  {43245u, property::type::Extend},
-  {43246u, property::type::Extend},
-  {43247u, property::type::Extend},
-  {43248u, property::type::Extend},
-  {43249u, property::type::Extend},
-  {43263u, property::type::Extend},
-  {43302u, property::type::Extend},
-  {43303u, property::type::Extend},
-  {43304u, property::type::Extend},
-  {43305u, property::type::Extend},
-  {43306u, property::type::Extend},
-  {43307u, property::type::Extend},
-  {43308u, property::type::Extend},
-  {43309u, property::type::Extend},
-  {43335u, property::type::Extend},
-  {43336u, property::type::Extend},
-  {43337u, property::type::Extend},
-  {43338u, property::type::Extend},
-  {43339u, property::type::Extend},
-  {43340u, property::type::Extend},
-  {43341u, property::type::Extend},
-  {43342u, property::type::Extend},
-  {43343u, property::type::Extend},
-  {43344u, property::type::Extend},
-  {43345u, property::type::Extend},
-  {43392u, property::type::Extend},
-  {43393u, property::type::Extend},
-  {43394u, property::type::Extend},
-  {43443u, property::type::Extend},
-  {43446u, property::type::Extend},
-  {43447u, property::type::Extend},
-  {43448u, property::type::Extend},
-  {43449u, property::type::Extend},
-  {43452u, property::type::Extend},
-  {43453u, property::type::Extend},
-  {43493u, property::type::Extend},
-  {43561u, property::type::Extend},
-  {43562u, property::type::Extend},
-  {43563u, property::type::Extend},
-  {43564u, property::type::Extend},
-  {43565u, property::type::Extend},
-  {43566u, property::type::Extend},
-  {43569u, property::type::Extend},
-  {43570u, property::type::Extend},
-  {43573u, property::type::Extend},
-  {43574u, property::type::Extend},
-  {43587u, property::type::Extend},
-  {43596u, property::type::Extend},
-  {43644u, property::type::Extend},
-  {43696u, property::type::Extend},
-  {43698u, property::type::Extend},
-  {43699u, property::type::Extend},
-  {43700u, property::type::Extend},
-  {43703u, property::type::Extend},
-  {43704u, property::type::Extend},
-  {43710u, property::type::Extend},
-  {43711u, property::type::Extend},
-  {43713u, property::type::Extend},
-  {43756u, property::type::Extend},
-  {43757u, property::type::Extend},
-  {43766u, property::type::Extend},
-  {44005u, property::type::Extend},
-  {44008u, property::type::Extend},
-  {44013u, property::type::Extend},
-  {64286u, property::type::Extend},
-  {65024u, property::type::Extend},
-  {65025u, property::type::Extend},
-  {65026u, property::type::Extend},
-  {65027u, property::type::Extend},
-  {65028u, property::type::Extend},
-  {65029u, property::type::Extend},
-  {65030u, property::type::Extend},
-  {65031u, property::type::Extend},
-  {65032u, property::type::Extend},
-  {65033u, property::type::Extend},
-  {65034u, property::type::Extend},
-  {65035u, property::type::Extend},
-  {65036u, property::type::Extend},
-  {65037u, property::type::Extend},
-  {65038u, property::type::Extend},
-  {65039u, property::type::Extend},
-  {65056u, property::type::Extend},
-  {65057u, property::type::Extend},
-  {65058u, property::type::Extend},
-  {65059u, property::type::Extend},
-  {65060u, property::type::Extend},
-  {65061u, property::type::Extend},
-  {65062u, property::type::Extend},
-  {65063u, property::type::Extend},
-  {65064u, property::type::Extend},
-  {65065u, property::type::Extend},
-  {65066u, property::type::Extend},
-  {65067u, property::type::Extend},
-  {65068u, property::type::Extend},
-  {65069u, property::type::Extend},
-  {65070u, property::type::Extend},
-  {65071u, property::type::Extend},
-  {65438u, property::type::Extend},
-  {65439u, property::type::Extend},
-  {66045u, property::type::Extend},
-  {66272u, property::type::Extend},
-  {66422u, property::type::Extend},
-  {66423u, property::type::Extend},
-  {66424u, property::type::Extend},
-  {66425u, property::type::Extend},
-  {66426u, property::type::Extend},
-  {68097u, property::type::Extend},
-  {68098u, property::type::Extend},
-  {68099u, property::type::Extend},
-  {68101u, property::type::Extend},
-  {68102u, property::type::Extend},
-  {68108u, property::type::Extend},
-  {68109u, property::type::Extend},
-  {68110u, property::type::Extend},
-  {68111u, property::type::Extend},
-  {68152u, property::type::Extend},
-  {68153u, property::type::Extend},
-  {68154u, property::type::Extend},
-  {68159u, property::type::Extend},
-  {68325u, property::type::Extend},
-  {68326u, property::type::Extend},
-  {68900u, property::type::Extend},
-  {68901u, property::type::Extend},
-  {68902u, property::type::Extend},
-  {68903u, property::type::Extend},
-  {69291u, property::type::Extend},
-  {69292u, property::type::Extend},
-  {69373u, property::type::Extend},
-  {69374u, property::type::Extend},
-  {69375u, property::type::Extend},
-  {69446u, property::type::Extend},
-  {69447u, property::type::Extend},
-  {69448u, property::type::Extend},
-  {69449u, property::type::Extend},
-  {69450u, property::type::Extend},
-  {69451u, property::type::Extend},
-  {69452u, property::type::Extend},
-  {69453u, property::type::Extend},
-  {69454u, property::type::Extend},
-  {69455u, property::type::Extend},
-  {69456u, property::type::Extend},
-  {69506u, property::type::Extend},
-  {69507u, property::type::Extend},
-  {69508u, property::type::Extend},
-  {69509u, property::type::Extend},
-  {69633u, property::type::Extend},
-  {69688u, property::type::Extend},
-  {69689u, property::type::Extend},
-  {69690u, property::type::Extend},
-  {69691u, property::type::Extend},
-  {69692u, property::type::Extend},
-  {69693u, property::type::Extend},
-  {69694u, property::type::Extend},
-  {69695u, property::type::Extend},
-  {69696u, property::type::Extend},
-  {69697u, property::type::Extend},
-  {69698u, property::type::Extend},
-  {69699u, property::type::Extend},
-  {69700u, property::type::Extend},
-  {69701u, property::type::Extend},
-  {69702u, property::type::Extend},
-  {69744u, property::type::Extend},
-  {69747u, property::type::Extend},
-  {69748u, property::type::Extend},
-  {69759u, property::type::Extend},
-  {69760u, property::type::Extend},
-  {69761u, property::type::Extend},
-  {69811u, property::type::Extend},
-  {69812u, property::type::Extend},
-  {69813u, property::type::Extend},
-  {69814u, property::type::Extend},
-  {69817u, property::type::Extend},
-  {69818u, property::type::Extend},
-  {69826u, property::type::Extend},
-  {69888u, property::type::Extend},
-  {69889u, property::type::Extend},
-  {69890u, property::type::Extend},
-  {69927u, property::type::Extend},
-  {69928u, property::type::Extend},
-  {69929u, property::type::Extend},
-  {69930u, property::type::Extend},
-  {69931u, property::type::Extend},
-  {69933u, property::type::Extend},
-  {69934u, property::type::Extend},
-  {69935u, property::type::Extend},
-  {69936u, property::type::Extend},
-  {69937u, property::type::Extend},
-  {69938u, property::type::Extend},
-  {69939u, property::type::Extend},
-  {69940u, property::type::Extend},
-  {70003u, property::type::Extend},
-  {70016u, property::type::Extend},
-  {70017u, property::type::Extend},
-  {70070u, property::type::Extend},
-  {70071u, property::type::Extend},
-  {70072u, property::type::Extend},
-  {70073u, property::type::Extend},
-  {70074u, property::type::Extend},
-  {70075u, property::type::Extend},
-  {70076u, property::type::Extend},
-  {70077u, property::type::Extend},
-  {70078u, property::type::Extend},
-  {70089u, property::type::Extend},
-  {70090u, property::type::Extend},
-  {70091u, property::type::Extend},
-  {70092u, property::type::Extend},
-  {70095u, property::type::Extend},
-  {70191u, property::type::Extend},
-  {70192u, property::type::Extend},
-  {70193u, property::type::Extend},
-  {70196u, property::type::Extend},
-  {70198u, property::type::Extend},
-  {70199u, property::type::Extend},
-  {70206u, property::type::Extend},
-  {70209u, property::type::Extend},
-  {70367u, property::type::Extend},
-  {70371u, property::type::Extend},
-  {70372u, property::type::Extend},
-  {70373u, property::type::Extend},
-  {70374u, property::type::Extend},
-  {70375u, property::type::Extend},
-  {70376u, property::type::Extend},
-  {70377u, property::type::Extend},
-  {70378u, property::type::Extend},
-  {70400u, property::type::Extend},
-  {70401u, property::type::Extend},
-  {70459u, property::type::Extend},
-  {70460u, property::type::Extend},
-  {70462u, property::type::Extend},
-  {70464u, property::type::Extend},
-  {70487u, property::type::Extend},
-  {70502u, property::type::Extend},
-  {70503u, property::type::Extend},
-  {70504u, property::type::Extend},
-  {70505u, property::type::Extend},
-  {70506u, property::type::Extend},
-  {70507u, property::type::Extend},
-  {70508u, property::type::Extend},
-  {70512u, property::type::Extend},
-  {70513u, property::type::Extend},
-  {70514u, property::type::Extend},
-  {70515u, property::type::Extend},
-  {70516u, property::type::Extend},
-  {70712u, property::type::Extend},
-  {70713u, property::type::Extend},
-  {70714u, property::type::Extend},
-  {70715u, property::type::Extend},
-  {70716u, property::type::Extend},
-  {70717u, property::type::Extend},
-  {70718u, property::type::Extend},
-  {70719u, property::type::Extend},
-  {70722u, property::type::Extend},
-  {70723u, property::type::Extend},
-  {70724u, property::type::Extend},
-  {70726u, property::type::Extend},
-  {70750u, property::type::Extend},
-  {70832u, property::type::Extend},
-  {70835u, property::type::Extend},
-  {70836u, property::type::Extend},
-  {70837u, property::type::Extend},
-  {70838u, property::type::Extend},
-  {70839u, property::type::Extend},
-  {70840u, property::type::Extend},
-  {70842u, property::type::Extend},
-  {70845u, property::type::Extend},
-  {70847u, property::type::Extend},
-  {70848u, property::type::Extend},
-  {70850u, property::type::Extend},
-  {70851u, property::type::Extend},
-  {71087u, property::type::Extend},
-  {71090u, property::type::Extend},
-  {71091u, property::type::Extend},
-  {71092u, property::type::Extend},
-  {71093u, property::type::Extend},
-  {71100u, property::type::Extend},
-  {71101u, property::type::Extend},
-  {71103u, property::type::Extend},
-  {71104u, property::type::Extend},
-  {71132u, property::type::Extend},
-  {71133u, property::type::Extend},
-  {71219u, property::type::Extend},
-  {71220u, property::type::Extend},
-  {71221u, property::type::Extend},
-  {71222u, property::type::Extend},
-  {71223u, property::type::Extend},
-  {71224u, property::type::Extend},
-  {71225u, property::type::Extend},
-  {71226u, property::type::Extend},
-  {71229u, property::type::Extend},
-  {71231u, property::type::Extend},
-  {71232u, property::type::Extend},
-  {71339u, property::type::Extend},
-  {71341u, property::type::Extend},
-  {71344u, property::type::Extend},
-  {71345u, property::type::Extend},
-  {71346u, property::type::Extend},
-  {71347u, property::type::Extend},
-  {71348u, property::type::Extend},
-  {71349u, property::type::Extend},
-  {71351u, property::type::Extend},
-  {71453u, property::type::Extend},
-  {71454u, property::type::Extend},
-  {71455u, property::type::Extend},
-  {71458u, property::type::Extend},
-  {71459u, property::type::Extend},
-  {71460u, property::type::Extend},
-  {71461u, property::type::Extend},
-  {71463u, property::type::Extend},
-  {71464u, property::type::Extend},
-  {71465u, property::type::Extend},
-  {71466u, property::type::Extend},
-  {71467u, property::type::Extend},
-  {71727u, property::type::Extend},
-  {71728u, property::type::Extend},
-  {71729u, property::type::Extend},
-  {71730u, property::type::Extend},
-  {71731u, property::type::Extend},
-  {71732u, property::type::Extend},
-  {71733u, property::type::Extend},
-  {71734u, property::type::Extend},
-  {71735u, property::type::Extend},
-  {71737u, property::type::Extend},
-  {71738u, property::type::Extend},
-  {71984u, property::type::Extend},
-  {71995u, property::type::Extend},
-  {71996u, property::type::Extend},
-  {71998u, property::type::Extend},
-  {72003u, property::type::Extend},
-  {72148u, property::type::Extend},
-  {72149u, property::type::Extend},
-  {72150u, property::type::Extend},
-  {72151u, property::type::Extend},
-  {72154u, property::type::Extend},
-  {72155u, property::type::Extend},
-  {72160u, property::type::Extend},
-  {72193u, property::type::Extend},
-  {72194u, property::type::Extend},
-  {72195u, property::type::Extend},
-  {72196u, property::type::Extend},
-  {72197u, property::type::Extend},
-  {72198u, property::type::Extend},
-  {72199u, property::type::Extend},
-  {72200u, property::type::Extend},
-  {72201u, property::type::Extend},
-  {72202u, property::type::Extend},
-  {72243u, property::type::Extend},
-  {72244u, property::type::Extend},
-  {72245u, property::type::Extend},
-  {72246u, property::type::Extend},
-  {72247u, property::type::Extend},
-  {72248u, property::type::Extend},
-  {72251u, property::type::Extend},
-  {72252u, property::type::Extend},
-  {72253u, property::type::Extend},
-  {72254u, property::type::Extend},
-  {72263u, property::type::Extend},
-  {72273u, property::type::Extend},
-  {72274u, property::type::Extend},
-  {72275u, property::type::Extend},
-  {72276u, property::type::Extend},
-  {72277u, property::type::Extend},
-  {72278u, property::type::Extend},
-  {72281u, property::type::Extend},
-  {72282u, property::type::Extend},
-  {72283u, property::type::Extend},
-  {72330u, property::type::Extend},
-  {72331u, property::type::Extend},
-  {72332u, property::type::Extend},
-  {72333u, property::type::Extend},
-  {72334u, property::type::Extend},
-  {72335u, property::type::Extend},
-  {72336u, property::type::Extend},
-  {72337u, property::type::Extend},
-  {72338u, property::type::Extend},
-  {72339u, property::type::Extend},
-  {72340u, property::type::Extend},
-  {72341u, property::type::Extend},
-  {72342u, property::type::Extend},
-  {72344u, property::type::Extend},
-  {72345u, property::type::Extend},
-  {72752u, property::type::Extend},
-  {72753u, property::type::Extend},
-  {72754u, property::type::Extend},
-  {72755u, property::type::Extend},
-  {72756u, property::type::Extend},
-  {72757u, property::type::Extend},
-  {72758u, property::type::Extend},
-  {72760u, property::type::Extend},
-  {72761u, property::type::Extend},
-  {72762u, property::type::Extend},
-  {72763u, property::type::Extend},
-  {72764u, property::type::Extend},
-  {72765u, property::type::Extend},
-  {72767u, property::type::Extend},
-  {72850u, property::type::Extend},
-  {72851u, property::type::Extend},
-  {72852u, property::type::Extend},
-  {72853u, property::type::Extend},
-  {72854u, property::type::Extend},
-  {72855u, property::type::Extend},
-  {72856u, property::type::Extend},
-  {72857u, property::type::Extend},
-  {72858u, property::type::Extend},
-  {72859u, property::type::Extend},
-  {72860u, property::type::Extend},
-  {72861u, property::type::Extend},
-  {72862u, property::type::Extend},
-  {72863u, property::type::Extend},
-  {72864u, property::type::Extend},
-  {72865u, property::type::Extend},
-  {72866u, property::type::Extend},
-  {72867u, property::type::Extend},
-  {72868u, property::type::Extend},
-  {72869u, property::type::Extend},
-  {72870u, property::type::Extend},
-  {72871u, property::type::Extend},
-  {72874u, property::type::Extend},
-  {72875u, property::type::Extend},
-  {72876u, property::type::Extend},
-  {72877u, property::type::Extend},
-  {72878u, property::type::Extend},
-  {72879u, property::type::Extend},
-  {72880u, property::type::Extend},
-  {72882u, property::type::Extend},
-  {72883u, property::type::Extend},
-  {72885u, property::type::Extend},
-  {72886u, property::type::Extend},
-  {73009u, property::type::Extend},
-  {73010u, property::type::Extend},
-  {73011u, property::type::Extend},
-  {73012u, property::type::Extend},
-  {73013u, property::type::Extend},
-  {73014u, property::type::Extend},
-  {73018u, property::type::Extend},
-  {73020u, property::type::Extend},
-  {73021u, property::type::Extend},
-  {73023u, property::type::Extend},
-  {73024u, property::type::Extend},
-  {73025u, property::type::Extend},
-  {73026u, property::type::Extend},
-  {73027u, property::type::Extend},
-  {73028u, property::type::Extend},
-  {73029u, property::type::Extend},
-  {73031u, property::type::Extend},
-  {73104u, property::type::Extend},
-  {73105u, property::type::Extend},
-  {73109u, property::type::Extend},
-  {73111u, property::type::Extend},
-  {73459u, property::type::Extend},
-  {73460u, property::type::Extend},
-  {73472u, property::type::Extend},
-  {73473u, property::type::Extend},
-  {73526u, property::type::Extend},
-  {73527u, property::type::Extend},
-  {73528u, property::type::Extend},
-  {73529u, property::type::Extend},
-  {73530u, property::type::Extend},
-  {73536u, property::type::Extend},
-  {73538u, property::type::Extend},
-  {78912u, property::type::Extend},
-  {78919u, property::type::Extend},
-  {78920u, property::type::Extend},
-  {78921u, property::type::Extend},
-  {78922u, property::type::Extend},
-  {78923u, property::type::Extend},
-  {78924u, property::type::Extend},
-  {78925u, property::type::Extend},
-  {78926u, property::type::Extend},
-  {78927u, property::type::Extend},
-  {78928u, property::type::Extend},
-  {78929u, property::type::Extend},
-  {78930u, property::type::Extend},
-  {78931u, property::type::Extend},
-  {78932u, property::type::Extend},
-  {78933u, property::type::Extend},
-  {92912u, property::type::Extend},
-  {92913u, property::type::Extend},
-  {92914u, property::type::Extend},
-  {92915u, property::type::Extend},
-  {92916u, property::type::Extend},
-  {92976u, property::type::Extend},
-  {92977u, property::type::Extend},
-  {92978u, property::type::Extend},
-  {92979u, property::type::Extend},
-  {92980u, property::type::Extend},
-  {92981u, property::type::Extend},
-  {92982u, property::type::Extend},
-  {94031u, property::type::Extend},
-  {94095u, property::type::Extend},
-  {94096u, property::type::Extend},
-  {94097u, property::type::Extend},
-  {94098u, property::type::Extend},
-  {94180u, property::type::Extend},
-  {113821u, property::type::Extend},
-  {113822u, property::type::Extend},
-  {118528u, property::type::Extend},
-  {118529u, property::type::Extend},
-  {118530u, property::type::Extend},
-  {118531u, property::type::Extend},
-  {118532u, property::type::Extend},
-  {118533u, property::type::Extend},
-  {118534u, property::type::Extend},
-  {118535u, property::type::Extend},
-  {118536u, property::type::Extend},
-  {118537u, property::type::Extend},
-  {118538u, property::type::Extend},
-  {118539u, property::type::Extend},
-  {118540u, property::type::Extend},
-  {118541u, property::type::Extend},
-  {118542u, property::type::Extend},
-  {118543u, property::type::Extend},
-  {118544u, property::type::Extend},
-  {118545u, property::type::Extend},
-  {118546u, property::type::Extend},
-  {118547u, property::type::Extend},
-  {118548u, property::type::Extend},
-  {118549u, property::type::Extend},
-  {118550u, property::type::Extend},
-  {118551u, property::type::Extend},
-  {118552u, property::type::Extend},
-  {118553u, property::type::Extend},
-  {118554u, property::type::Extend},
-  {118555u, property::type::Extend},
-  {118556u, property::type::Extend},
-  {118557u, property::type::Extend},
-  {118558u, property::type::Extend},
-  {118559u, property::type::Extend},
-  {118560u, property::type::Extend},
-  {118561u, property::type::Extend},
-  {118562u, property::type::Extend},
-  {118563u, property::type::Extend},
-  {118564u, property::type::Extend},
-  {118565u, property::type::Extend},
-  {118566u, property::type::Extend},
-  {118567u, property::type::Extend},
-  {118568u, property::type::Extend},
-  {118569u, property::type::Extend},
-  {118570u, property::type::Extend},
-  {118571u, property::type::Extend},
-  {118572u, property::type::Extend},
-  {118573u, property::type::Extend},
-  {118576u, property::type::Extend},
-  {118577u, property::type::Extend},
-  {118578u, property::type::Extend},
-  {118579u, property::type::Extend},
-  {118580u, property::type::Extend},
-  {118581u, property::type::Extend},
-  {118582u, property::type::Extend},
-  {118583u, property::type::Extend},
-  {118584u, property::type::Extend},
-  {118585u, property::type::Extend},
-  {118586u, property::type::Extend},
-  {118587u, property::type::Extend},
-  {118588u, property::type::Extend},
-  {118589u, property::type::Extend},
-  {118590u, property::type::Extend},
-  {118591u, property::type::Extend},
-  {118592u, property::type::Extend},
-  {118593u, property::type::Extend},
-  {118594u, property::type::Extend},
-  {118595u, property::type::Extend},
-  {118596u, property::type::Extend},
-  {118597u, property::type::Extend},
-  {118598u, property::type::Extend},
-  {119141u, property::type::Extend},
-  {119143u, property::type::Extend},
-  {119144u, property::type::Extend},
-  {119145u, property::type::Extend},
-  {119150u, property::type::Extend},
-  {119151u, property::type::Extend},
-  {119152u, property::type::Extend},
-  {119153u, property::type::Extend},
-  {119154u, property::type::Extend},
-  {119163u, property::type::Extend},
-  {119164u, property::type::Extend},
-  {119165u, property::type::Extend},
-  {119166u, property::type::Extend},
-  {119167u, property::type::Extend},
-  {119168u, property::type::Extend},
-  {119169u, property::type::Extend},
-  {119170u, property::type::Extend},
-  {119173u, property::type::Extend},
-  {119174u, property::type::Extend},
-  {119175u, property::type::Extend},
-  {119176u, property::type::Extend},
-  {119177u, property::type::Extend},
-  {119178u, property::type::Extend},
-  {119179u, property::type::Extend},
-  {119210u, property::type::Extend},
-  {119211u, property::type::Extend},
-  {119212u, property::type::Extend},
-  {119213u, property::type::Extend},
-  {119362u, property::type::Extend},
-  {119363u, property::type::Extend},
-  {119364u, property::type::Extend},
-  {121344u, property::type::Extend},
-  {121345u, property::type::Extend},
-  {121346u, property::type::Extend},
-  {121347u, property::type::Extend},
-  {121348u, property::type::Extend},
-  {121349u, property::type::Extend},
-  {121350u, property::type::Extend},
-  {121351u, property::type::Extend},
-  {121352u, property::type::Extend},
-  {121353u, property::type::Extend},
-  {121354u, property::type::Extend},
-  {121355u, property::type::Extend},
-  {121356u, property::type::Extend},
-  {121357u, property::type::Extend},
-  {121358u, property::type::Extend},
-  {121359u, property::type::Extend},
-  {121360u, property::type::Extend},
-  {121361u, property::type::Extend},
-  {121362u, property::type::Extend},
-  {121363u, property::type::Extend},
-  {121364u, property::type::Extend},
-  {121365u, property::type::Extend},
-  {121366u, property::type::Extend},
-  {121367u, property::type::Extend},
-  {121368u, property::type::Extend},
-  {121369u, property::type::Extend},
-  {121370u, property::type::Extend},
-  {121371u, property::type::Extend},
-  {121372u, property::type::Extend},
-  {121373u, property::type::Extend},
-  {121374u, property::type::Extend},
-  {121375u, property::type::Extend},
-  {121376u, property::type::Extend},
-  {121377u, property::type::Extend},
-  {121378u, property::type::Extend},
-  {121379u, property::type::Extend},
-  {121380u, property::type::Extend},
-  {121381u, property::type::Extend},
-  {121382u, property::type::Extend},
-  {121383u, property::type::Extend},
-  {121384u, property::type::Extend},
-  {121385u, property::type::Extend},
-  {121386u, property::type::Extend},
-  {121387u, property::type::Extend},
-  {121388u, property::type::Extend},
-  {121389u, property::type::Extend},
-  {121390u, property::type::Extend},
-  {121391u, property::type::Extend},
-  {121392u, property::type::Extend},
-  {121393u, property::type::Extend},
-  {121394u, property::type::Extend},
-  {121395u, property::type::Extend},
-  {121396u, property::type::Extend},
-  {121397u, property::type::Extend},
-  {121398u, property::type::Extend},
-  {121403u, property::type::Extend},
-  {121404u, property::type::Extend},
-  {121405u, property::type::Extend},
-  {121406u, property::type::Extend},
-  {121407u, property::type::Extend},
-  {121408u, property::type::Extend},
-  {121409u, property::type::Extend},
-  {121410u, property::type::Extend},
-  {121411u, property::type::Extend},
-  {121412u, property::type::Extend},
-  {121413u, property::type::Extend},
-  {121414u, property::type::Extend},
-  {121415u, property::type::Extend},
-  {121416u, property::type::Extend},
-  {121417u, property::type::Extend},
-  {121418u, property::type::Extend},
-  {121419u, property::type::Extend},
-  {121420u, property::type::Extend},
-  {121421u, property::type::Extend},
-  {121422u, property::type::Extend},
-  {121423u, property::type::Extend},
-  {121424u, property::type::Extend},
-  {121425u, property::type::Extend},
-  {121426u, property::type::Extend},
-  {121427u, property::type::Extend},
-  {121428u, property::type::Extend},
-  {121429u, property::type::Extend},
-  {121430u, property::type::Extend},
-  {121431u, property::type::Extend},
-  {121432u, property::type::Extend},
-  {121433u, property::type::Extend},
-  {121434u, property::type::Extend},
-  {121435u, property::type::Extend},
-  {121436u, property::type::Extend},
-  {121437u, property::type::Extend},
-  {121438u, property::type::Extend},
-  {121439u, property::type::Extend},
-  {121440u, property::type::Extend},
-  {121441u, property::type::Extend},
-  {121442u, property::type::Extend},
-  {121443u, property::type::Extend},
-  {121444u, property::type::Extend},
-  {121445u, property::type::Extend},
-  {121446u, property::type::Extend},
-  {121447u, property::type::Extend},
-  {121448u, property::type::Extend},
-  {121449u, property::type::Extend},
-  {121450u, property::type::Extend},
-  {121451u, property::type::Extend},
-  {121452u, property::type::Extend},
-  {121461u, property::type::Extend},
-  {121476u, property::type::Extend},
-  {121499u, property::type::Extend},
-  {121500u, property::type::Extend},
-  {121501u, property::type::Extend},
-  {121502u, property::type::Extend},
-  {121503u, property::type::Extend},
-  {121505u, property::type::Extend},
-  {121506u, property::type::Extend},
-  {121507u, property::type::Extend},
-  {121508u, property::type::Extend},
-  {121509u, property::type::Extend},
-  {121510u, property::type::Extend},
-  {121511u, property::type::Extend},
-  {121512u, property::type::Extend},
-  {121513u, property::type::Extend},
-  {121514u, property::type::Extend},
-  {121515u, property::type::Extend},
-  {121516u, property::type::Extend},
-  {121517u, property::type::Extend},
-  {121518u, property::type::Extend},
-  {121519u, property::type::Extend},
-  {122880u, property::type::Extend},
-  {122881u, property::type::Extend},
-  {122882u, property::type::Extend},
-  {122883u, property::type::Extend},
-  {122884u, property::type::Extend},
-  {122885u, property::type::Extend},
-  {122886u, property::type::Extend},
-  {122888u, property::type::Extend},
-  {122889u, property::type::Extend},
-  {122890u, property::type::Extend},
-  {122891u, property::type::Extend},
-  {122892u, property::type::Extend},
-  {122893u, property::type::Extend},
-  {122894u, property::type::Extend},
-  {122895u, property::type::Extend},
-  {122896u, property::type::Extend},
-  {122897u, property::type::Extend},
-  {122898u, property::type::Extend},
-  {122899u, property::type::Extend},
-  {122900u, property::type::Extend},
-  {122901u, property::type::Extend},
-  {122902u, property::type::Extend},
-  {122903u, property::type::Extend},
-  {122904u, property::type::Extend},
-  {122907u, property::type::Extend},
-  {122908u, property::type::Extend},
-  {122909u, property::type::Extend},
-  {122910u, property::type::Extend},
-  {122911u, property::type::Extend},
-  {122912u, property::type::Extend},
-  {122913u, property::type::Extend},
-  {122915u, property::type::Extend},
-  {122916u, property::type::Extend},
-  {122918u, property::type::Extend},
-  {122919u, property::type::Extend},
-  {122920u, property::type::Extend},
-  {122921u, property::type::Extend},
-  {122922u, property::type::Extend},
-  {123023u, property::type::Extend},
-  {123184u, property::type::Extend},
-  {123185u, property::type::Extend},
-  {123186u, property::type::Extend},
-  {123187u, property::type::Extend},
-  {123188u, property::type::Extend},
-  {123189u, property::type::Extend},
-  {123190u, property::type::Extend},
-  {123566u, property::type::Extend},
-  {123628u, property::type::Extend},
-  {123629u, property::type::Extend},
-  {123630u, property::type::Extend},
-  {123631u, property::type::Extend},
-  {124140u, property::type::Extend},
-  {124141u, property::type::Extend},
-  {124142u, property::type::Extend},
-  {124143u, property::type::Extend},
-  {125136u, property::type::Extend},
-  {125137u, property::type::Extend},
-  {125138u, property::type::Extend},
-  {125139u, property::type::Extend},
-  {125140u, property::type::Extend},
-  {125141u, property::type::Extend},
-  {125142u, property::type::Extend},
-  {125252u, property::type::Extend},
-  {125253u, property::type::Extend},
-  {125254u, property::type::Extend},
-  {125255u, property::type::Extend},
-  {125256u, property::type::Extend},
-  {125257u, property::type::Extend},
-  {125258u, property::type::Extend},
-  {127995u, property::type::Extend},
-  {127996u, property::type::Extend},
-  {127997u, property::type::Extend},
-  {127998u, property::type::Extend},
-  {127999u, property::type::Extend},
-  {917536u, property::type::Extend},
-  {917537u, property::type::Extend},
-  {917538u, property::type::Extend},
-  {917539u, property::type::Extend},
-  {917540u, property::type::Extend},
-  {917541u, property::type::Extend},
-  {917542u, property::type::Extend},
-  {917543u, property::type::Extend},
-  {917544u, property::type::Extend},
-  {917545u, property::type::Extend},
-  {917546u, property::type::Extend},
-  {917547u, property::type::Extend},
-  {917548u, property::type::Extend},
-  {917549u, property::type::Extend},
-  {917550u, property::type::Extend},
-  {917551u, property::type::Extend},
-  {917552u, property::type::Extend},
-  {917553u, property::type::Extend},
-  {917554u, property::type::Extend},
-  {917555u, property::type::Extend},
-  {917556u, property::type::Extend},
-  {917557u, property::type::Extend},
-  {917558u, property::type::Extend},
-  {917559u, property::type::Extend},
-  {917560u, property::type::Extend},
-  {917561u, property::type::Extend},
-  {917562u, property::type::Extend},
-  {917563u, property::type::Extend},
-  {917564u, property::type::Extend},
-  {917565u, property::type::Extend},
-  {917566u, property::type::Extend},
-  {917567u, property::type::Extend},
-  {917568u, property::type::Extend},
-  {917569u, property::type::Extend},
-  {917570u, property::type::Extend},
-  {917571u, property::type::Extend},
-  {917572u, property::type::Extend},
-  {917573u, property::type::Extend},
-  {917574u, property::type::Extend},
-  {917575u, property::type::Extend},
-  {917576u, property::type::Extend},
-  {917577u, property::type::Extend},
-  {917578u, property::type::Extend},
-  {917579u, property::type::Extend},
-  {917580u, property::type::Extend},
-  {917581u, property::type::Extend},
-  {917582u, property::type::Extend},
-  {917583u, property::type::Extend},
-  {917584u, property::type::Extend},
-  {917585u, property::type::Extend},
-  {917586u, property::type::Extend},
-  {917587u, property::type::Extend},
-  {917588u, property::type::Extend},
-  {917589u, property::type::Extend},
-  {917590u, property::type::Extend},
-  {917591u, property::type::Extend},
-  {917592u, property::type::Extend},
-  {917593u, property::type::Extend},
-  {917594u, property::type::Extend},
-  {917595u, property::type::Extend},
-  {917596u, property::type::Extend},
-  {917597u, property::type::Extend},
-  {917598u, property::type::Extend},
-  {917599u, property::type::Extend},
-  {917600u, property::type::Extend},
-  {917601u, property::type::Extend},
-  {917602u, property::type::Extend},
-  {917603u, property::type::Extend},
-  {917604u, property::type::Extend},
-  {917605u, property::type::Extend},
-  {917606u, property::type::Extend},
-  {917607u, property::type::Extend},
-  {917608u, property::type::Extend},
-  {917609u, property::type::Extend},
-  {917610u, property::type::Extend},
-  {917611u, property::type::Extend},
-  {917612u, property::type::Extend},
-  {917613u, property::type::Extend},
-  {917614u, property::type::Extend},
-  {917615u, property::type::Extend},
-  {917616u, property::type::Extend},
-  {917617u, property::type::Extend},
-  {917618u, property::type::Extend},
-  {917619u, property::type::Extend},
-  {917620u, property::type::Extend},
-  {917621u, property::type::Extend},
-  {917622u, property::type::Extend},
-  {917623u, property::type::Extend},
-  {917624u, property::type::Extend},
-  {917625u, property::type::Extend},
-  {917626u, property::type::Extend},
-  {917627u, property::type::Extend},
-  {917628u, property::type::Extend},
-  {917629u, property::type::Extend},
-  {917630u, property::type::Extend},
-  {917631u, property::type::Extend},
-  {917760u, property::type::Extend},
-  {917761u, property::type::Extend},
-  {917762u, property::type::Extend},
-  {917763u, property::type::Extend},
-  {917764u, property::type::Extend},
-  {917765u, property::type::Extend},
-  {917766u, property::type::Extend},
-  {917767u, property::type::Extend},
-  {917768u, property::type::Extend},
-  {917769u, property::type::Extend},
-  {917770u, property::type::Extend},
-  {917771u, property::type::Extend},
-  {917772u, property::type::Extend},
-  {917773u, property::type::Extend},
-  {917774u, property::type::Extend},
-  {917775u, property::type::Extend},
-  {917776u, property::type::Extend},
-  {917777u, property::type::Extend},
-  {917778u, property::type::Extend},
-  {917779u, property::type::Extend},
-  {917780u, property::type::Extend},
-  {917781u, property::type::Extend},
-  {917782u, property::type::Extend},
-  {917783u, property::type::Extend},
-  {917784u, property::type::Extend},
-  {917785u, property::type::Extend},
-  {917786u, property::type::Extend},
-  {917787u, property::type::Extend},
-  {917788u, property::type::Extend},
-  {917789u, property::type::Extend},
-  {917790u, property::type::Extend},
-  {917791u, property::type::Extend},
-  {917792u, property::type::Extend},
-  {917793u, property::type::Extend},
-  {917794u, property::type::Extend},
-  {917795u, property::type::Extend},
-  {917796u, property::type::Extend},
-  {917797u, property::type::Extend},
-  {917798u, property::type::Extend},
-  {917799u, property::type::Extend},
-  {917800u, property::type::Extend},
-  {917801u, property::type::Extend},
-  {917802u, property::type::Extend},
-  {917803u, property::type::Extend},
-  {917804u, property::type::Extend},
-  {917805u, property::type::Extend},
-  {917806u, property::type::Extend},
-  {917807u, property::type::Extend},
-  {917808u, property::type::Extend},
-  {917809u, property::type::Extend},
-  {917810u, property::type::Extend},
-  {917811u, property::type::Extend},
-  {917812u, property::type::Extend},
-  {917813u, property::type::Extend},
-  {917814u, property::type::Extend},
-  {917815u, property::type::Extend},
-  {917816u, property::type::Extend},
-  {917817u, property::type::Extend},
-  {917818u, property::type::Extend},
-  {917819u, property::type::Extend},
-  {917820u, property::type::Extend},
-  {917821u, property::type::Extend},
-  {917822u, property::type::Extend},
-  {917823u, property::type::Extend},
-  {917824u, property::type::Extend},
-  {917825u, property::type::Extend},
-  {917826u, property::type::Extend},
-  {917827u, property::type::Extend},
-  {917828u, property::type::Extend},
-  {917829u, property::type::Extend},
-  {917830u, property::type::Extend},
-  {917831u, property::type::Extend},
-  {917832u, property::type::Extend},
-  {917833u, property::type::Extend},
-  {917834u, property::type::Extend},
-  {917835u, property::type::Extend},
-  {917836u, property::type::Extend},
-  {917837u, property::type::Extend},
-  {917838u, property::type::Extend},
-  {917839u, property::type::Extend},
-  {917840u, property::type::Extend},
-  {917841u, property::type::Extend},
-  {917842u, property::type::Extend},
-  {917843u, property::type::Extend},
-  {917844u, property::type::Extend},
-  {917845u, property::type::Extend},
-  {917846u, property::type::Extend},
-  {917847u, property::type::Extend},
-  {917848u, property::type::Extend},
-  {917849u, property::type::Extend},
-  {917850u, property::type::Extend},
-  {917851u, property::type::Extend},
-  {917852u, property::type::Extend},
-  {917853u, property::type::Extend},
-  {917854u, property::type::Extend},
-  {917855u, property::type::Extend},
-  {917856u, property::type::Extend},
-  {917857u, property::type::Extend},
-  {917858u, property::type::Extend},
-  {917859u, property::type::Extend},
-  {917860u, property::type::Extend},
-  {917861u, property::type::Extend},
-  {917862u, property::type::Extend},
-  {917863u, property::type::Extend},
-  {917864u, property::type::Extend},
-  {917865u, property::type::Extend},
-  {917866u, property::type::Extend},
-  {917867u, property::type::Extend},
-  {917868u, property::type::Extend},
-  {917869u, property::type::Extend},
-  {917870u, property::type::Extend},
-  {917871u, property::type::Extend},
-  {917872u, property::type::Extend},
-  {917873u, property::type::Extend},
-  {917874u, property::type::Extend},
-  {917875u, property::type::Extend},
-  {917876u, property::type::Extend},
-  {917877u, property::type::Extend},
-  {917878u, property::type::Extend},
-  {917879u, property::type::Extend},
-  {917880u, property::type::Extend},
-  {917881u, property::type::Extend},
-  {917882u, property::type::Extend},
-  {917883u, property::type::Extend},
-  {917884u, property::type::Extend},
-  {917885u, property::type::Extend},
-  {917886u, property::type::Extend},
-  {917887u, property::type::Extend},
-  {917888u, property::type::Extend},
-  {917889u, property::type::Extend},
-  {917890u, property::type::Extend},
-  {917891u, property::type::Extend},
-  {917892u, property::type::Extend},
-  {917893u, property::type::Extend},
-  {917894u, property::type::Extend},
-  {917895u, property::type::Extend},
-  {917896u, property::type::Extend},
-  {917897u, property::type::Extend},
-  {917898u, property::type::Extend},
-  {917899u, property::type::Extend},
-  {917900u, property::type::Extend},
-  {917901u, property::type::Extend},
-  {917902u, property::type::Extend},
-  {917903u, property::type::Extend},
-  {917904u, property::type::Extend},
-  {917905u, property::type::Extend},
-  {917906u, property::type::Extend},
-  {917907u, property::type::Extend},
-  {917908u, property::type::Extend},
-  {917909u, property::type::Extend},
-  {917910u, property::type::Extend},
-  {917911u, property::type::Extend},
-  {917912u, property::type::Extend},
-  {917913u, property::type::Extend},
-  {917914u, property::type::Extend},
-  {917915u, property::type::Extend},
-  {917916u, property::type::Extend},
-  {917917u, property::type::Extend},
-  {917918u, property::type::Extend},
-  {917919u, property::type::Extend},
-  {917920u, property::type::Extend},
-  {917921u, property::type::Extend},
-  {917922u, property::type::Extend},
-  {917923u, property::type::Extend},
-  {917924u, property::type::Extend},
-  {917925u, property::type::Extend},
-  {917926u, property::type::Extend},
-  {917927u, property::type::Extend},
-  {917928u, property::type::Extend},
-  {917929u, property::type::Extend},
-  {917930u, property::type::Extend},
-  {917931u, property::type::Extend},
-  {917932u, property::type::Extend},
-  {917933u, property::type::Extend},
-  {917934u, property::type::Extend},
-  {917935u, property::type::Extend},
-  {917936u, property::type::Extend},
-  {917937u, property::type::Extend},
-  {917938u, property::type::Extend},
-  {917939u, property::type::Extend},
-  {917940u, property::type::Extend},
-  {917941u, property::type::Extend},
-  {917942u, property::type::Extend},
-  {917943u, property::type::Extend},
-  {917944u, property::type::Extend},
-  {917945u, property::type::Extend},
-  {917946u, property::type::Extend},
-  {917947u, property::type::Extend},
-  {917948u, property::type::Extend},
-  {917949u, property::type::Extend},
-  {917950u, property::type::Extend},
-  {917951u, property::type::Extend},
-  {917952u, property::type::Extend},
-  {917953u, property::type::Extend},
-  {917954u, property::type::Extend},
-  {917955u, property::type::Extend},
-  {917956u, property::type::Extend},
-  {917957u, property::type::Extend},
-  {917958u, property::type::Extend},
-  {917959u, property::type::Extend},
-  {917960u, property::type::Extend},
-  {917961u, property::type::Extend},
-  {917962u, property::type::Extend},
-  {917963u, property::type::Extend},
-  {917964u, property::type::Extend},
-  {917965u, property::type::Extend},
-  {917966u, property::type::Extend},
-  {917967u, property::type::Extend},
-  {917968u, property::type::Extend},
-  {917969u, property::type::Extend},
-  {917970u, property::type::Extend},
-  {917971u, property::type::Extend},
-  {917972u, property::type::Extend},
-  {917973u, property::type::Extend},
-  {917974u, property::type::Extend},
-  {917975u, property::type::Extend},
-  {917976u, property::type::Extend},
-  {917977u, property::type::Extend},
-  {917978u, property::type::Extend},
-  {917979u, property::type::Extend},
-  {917980u, property::type::Extend},
-  {917981u, property::type::Extend},
-  {917982u, property::type::Extend},
-  {917983u, property::type::Extend},
-  {917984u, property::type::Extend},
-  {917985u, property::type::Extend},
-  {917986u, property::type::Extend},
-  {917987u, property::type::Extend},
-  {917988u, property::type::Extend},
-  {917989u, property::type::Extend},
-  {917990u, property::type::Extend},
-  {917991u, property::type::Extend},
-  {917992u, property::type::Extend},
-  {917993u, property::type::Extend},
-  {917994u, property::type::Extend},
-  {917995u, property::type::Extend},
-  {917996u, property::type::Extend},
-  {917997u, property::type::Extend},
-  {917998u, property::type::Extend},
-  {917999u, property::type::Extend},
-  {127462u, property::type::RI},
-  {127463u, property::type::RI},
-  {127464u, property::type::RI},
-  {127465u, property::type::RI},
-  {127466u, property::type::RI},
-  {127467u, property::type::RI},
-  {127468u, property::type::RI},
-  {127469u, property::type::RI},
-  {127470u, property::type::RI},
-  {127471u, property::type::RI},
-  {127472u, property::type::RI},
-  {127473u, property::type::RI},
-  {127474u, property::type::RI},
-  {127475u, property::type::RI},
-  {127476u, property::type::RI},
-  {127477u, property::type::RI},
-  {127478u, property::type::RI},
-  {127479u, property::type::RI},
-  {127480u, property::type::RI},
-  {127481u, property::type::RI},
-  {127482u, property::type::RI},
-  {127483u, property::type::RI},
-  {127484u, property::type::RI},
-  {127485u, property::type::RI},
-  {127486u, property::type::RI},
-  {127487u, property::type::RI},
-  {2307u, property::type::SpacingMark},
-  {2363u, property::type::SpacingMark},
-  {2366u, property::type::SpacingMark},
-  {2367u, property::type::SpacingMark},
-  {2368u, property::type::SpacingMark},
-  {2377u, property::type::SpacingMark},
-  {2378u, property::type::SpacingMark},
-  {2379u, property::type::SpacingMark},
-  {2380u, property::type::SpacingMark},
-  {2382u, property::type::SpacingMark},
-  {2383u, property::type::SpacingMark},
-  {2434u, property::type::SpacingMark},
-  {2435u, property::type::SpacingMark},
-  {2495u, property::type::SpacingMark},
-  {2496u, property::type::SpacingMark},
-  {2503u, property::type::SpacingMark},
-  {2504u, property::type::SpacingMark},
-  {2507u, property::type::SpacingMark},
-  {2508u, property::type::SpacingMark},
-  {2563u, property::type::SpacingMark},
-  {2622u, property::type::SpacingMark},
-  {2623u, property::type::SpacingMark},
-  {2624u, property::type::SpacingMark},
-  {2691u, property::type::SpacingMark},
-  {2750u, property::type::SpacingMark},
-  {2751u, property::type::SpacingMark},
-  {2752u, property::type::SpacingMark},
-  {2761u, property::type::SpacingMark},
-  {2763u, property::type::SpacingMark},
-  {2764u, property::type::SpacingMark},
-  {2818u, property::type::SpacingMark},
-  {2819u, property::type::SpacingMark},
-  {2880u, property::type::SpacingMark},
-  {2887u, property::type::SpacingMark},
-  {2888u, property::type::SpacingMark},
-  {2891u, property::type::SpacingMark},
-  {2892u, property::type::SpacingMark},
-  {3007u, property::type::SpacingMark},
-  {3009u, property::type::SpacingMark},
-  {3010u, property::type::SpacingMark},
-  {3014u, property::type::SpacingMark},
-  {3015u, property::type::SpacingMark},
-  {3016u, property::type::SpacingMark},
-  {3018u, property::type::SpacingMark},
-  {3019u, property::type::SpacingMark},
-  {3020u, property::type::SpacingMark},
-  {3073u, property::type::SpacingMark},
-  {3074u, property::type::SpacingMark},
-  {3075u, property::type::SpacingMark},
-  {3137u, property::type::SpacingMark},
-  {3138u, property::type::SpacingMark},
-  {3139u, property::type::SpacingMark},
-  {3140u, property::type::SpacingMark},
-  {3202u, property::type::SpacingMark},
-  {3203u, property::type::SpacingMark},
-  {3262u, property::type::SpacingMark},
-  {3264u, property::type::SpacingMark},
-  {3265u, property::type::SpacingMark},
-  {3267u, property::type::SpacingMark},
-  {3268u, property::type::SpacingMark},
-  {3271u, property::type::SpacingMark},
-  {3272u, property::type::SpacingMark},
-  {3274u, property::type::SpacingMark},
-  {3275u, property::type::SpacingMark},
-  {3315u, property::type::SpacingMark},
-  {3330u, property::type::SpacingMark},
-  {3331u, property::type::SpacingMark},
-  {3391u, property::type::SpacingMark},
-  {3392u, property::type::SpacingMark},
-  {3398u, property::type::SpacingMark},
-  {3399u, property::type::SpacingMark},
-  {3400u, property::type::SpacingMark},
-  {3402u, property::type::SpacingMark},
-  {3403u, property::type::SpacingMark},
-  {3404u, property::type::SpacingMark},
-  {3458u, property::type::SpacingMark},
-  {3459u, property::type::SpacingMark},
-  {3536u, property::type::SpacingMark},
-  {3537u, property::type::SpacingMark},
-  {3544u, property::type::SpacingMark},
-  {3545u, property::type::SpacingMark},
-  {3546u, property::type::SpacingMark},
-  {3547u, property::type::SpacingMark},
-  {3548u, property::type::SpacingMark},
-  {3549u, property::type::SpacingMark},
-  {3550u, property::type::SpacingMark},
-  {3570u, property::type::SpacingMark},
-  {3571u, property::type::SpacingMark},
-  {3635u, property::type::SpacingMark},
-  {3763u, property::type::SpacingMark},
-  {3902u, property::type::SpacingMark},
-  {3903u, property::type::SpacingMark},
-  {3967u, property::type::SpacingMark},
-  {4145u, property::type::SpacingMark},
-  {4155u, property::type::SpacingMark},
-  {4156u, property::type::SpacingMark},
-  {4182u, property::type::SpacingMark},
-  {4183u, property::type::SpacingMark},
-  {4228u, property::type::SpacingMark},
-  {5909u, property::type::SpacingMark},
-  {5940u, property::type::SpacingMark},
-  {6070u, property::type::SpacingMark},
-  {6078u, property::type::SpacingMark},
-  {6079u, property::type::SpacingMark},
-  {6080u, property::type::SpacingMark},
-  {6081u, property::type::SpacingMark},
-  {6082u, property::type::SpacingMark},
-  {6083u, property::type::SpacingMark},
-  {6084u, property::type::SpacingMark},
-  {6085u, property::type::SpacingMark},
-  {6087u, property::type::SpacingMark},
-  {6088u, property::type::SpacingMark},
-  {6435u, property::type::SpacingMark},
-  {6436u, property::type::SpacingMark},
-  {6437u, property::type::SpacingMark},
-  {6438u, property::type::SpacingMark},
-  {6441u, property::type::SpacingMark},
-  {6442u, property::type::SpacingMark},
-  {6443u, property::type::SpacingMark},
-  {6448u, property::type::SpacingMark},
-  {6449u, property::type::SpacingMark},
-  {6451u, property::type::SpacingMark},
-  {6452u, property::type::SpacingMark},
-  {6453u, property::type::SpacingMark},
-  {6454u, property::type::SpacingMark},
-  {6455u, property::type::SpacingMark},
-  {6456u, property::type::SpacingMark},
-  {6681u, property::type::SpacingMark},
-  {6682u, property::type::SpacingMark},
-  {6741u, property::type::SpacingMark},
-  {6743u, property::type::SpacingMark},
-  {6765u, property::type::SpacingMark},
-  {6766u, property::type::SpacingMark},
-  {6767u, property::type::SpacingMark},
-  {6768u, property::type::SpacingMark},
-  {6769u, property::type::SpacingMark},
-  {6770u, property::type::SpacingMark},
-  {6916u, property::type::SpacingMark},
-  {6971u, property::type::SpacingMark},
-  {6973u, property::type::SpacingMark},
-  {6974u, property::type::SpacingMark},
-  {6975u, property::type::SpacingMark},
-  {6976u, property::type::SpacingMark},
-  {6977u, property::type::SpacingMark},
-  {6979u, property::type::SpacingMark},
-  {6980u, property::type::SpacingMark},
-  {7042u, property::type::SpacingMark},
-  {7073u, property::type::SpacingMark},
-  {7078u, property::type::SpacingMark},
-  {7079u, property::type::SpacingMark},
-  {7082u, property::type::SpacingMark},
-  {7143u, property::type::SpacingMark},
-  {7146u, property::type::SpacingMark},
-  {7147u, property::type::SpacingMark},
-  {7148u, property::type::SpacingMark},
-  {7150u, property::type::SpacingMark},
-  {7154u, property::type::SpacingMark},
-  {7155u, property::type::SpacingMark},
-  {7204u, property::type::SpacingMark},
-  {7205u, property::type::SpacingMark},
-  {7206u, property::type::SpacingMark},
-  {7207u, property::type::SpacingMark},
-  {7208u, property::type::SpacingMark},
-  {7209u, property::type::SpacingMark},
-  {7210u, property::type::SpacingMark},
-  {7211u, property::type::SpacingMark},
-  {7220u, property::type::SpacingMark},
-  {7221u, property::type::SpacingMark},
-  {7393u, property::type::SpacingMark},
-  {7415u, property::type::SpacingMark},
-  {43043u, property::type::SpacingMark},
-  {43044u, property::type::SpacingMark},
-  {43047u, property::type::SpacingMark},
-  {43136u, property::type::SpacingMark},
-  {43137u, property::type::SpacingMark},
-  {43188u, property::type::SpacingMark},
-  {43189u, property::type::SpacingMark},
-  {43190u, property::type::SpacingMark},
-  {43191u, property::type::SpacingMark},
-  {43192u, property::type::SpacingMark},
-  {43193u, property::type::SpacingMark},
-  {43194u, property::type::SpacingMark},
-  {43195u, property::type::SpacingMark},
-  {43196u, property::type::SpacingMark},
-  {43197u, property::type::SpacingMark},
-  {43198u, property::type::SpacingMark},
-  {43199u, property::type::SpacingMark},
-  {43200u, property::type::SpacingMark},
-  {43201u, property::type::SpacingMark},
-  {43202u, property::type::SpacingMark},
-  {43203u, property::type::SpacingMark},
-  {43346u, property::type::SpacingMark},
-  {43347u, property::type::SpacingMark},
-  {43395u, property::type::SpacingMark},
-  {43444u, property::type::SpacingMark},
-  {43445u, property::type::SpacingMark},
-  {43450u, property::type::SpacingMark},
-  {43451u, property::type::SpacingMark},
-  {43454u, property::type::SpacingMark},
-  {43455u, property::type::SpacingMark},
-  {43456u, property::type::SpacingMark},
-  {43567u, property::type::SpacingMark},
-  {43568u, property::type::SpacingMark},
-  {43571u, property::type::SpacingMark},
-  {43572u, property::type::SpacingMark},
-  {43597u, property::type::SpacingMark},
-  {43755u, property::type::SpacingMark},
-  {43758u, property::type::SpacingMark},
-  {43759u, property::type::SpacingMark},
-  {43765u, property::type::SpacingMark},
-  {44003u, property::type::SpacingMark},
-  {44004u, property::type::SpacingMark},
-  {44006u, property::type::SpacingMark},
-  {44007u, property::type::SpacingMark},
-  {44009u, property::type::SpacingMark},
-  {44010u, property::type::SpacingMark},
-  {44012u, property::type::SpacingMark},
-  {69632u, property::type::SpacingMark},
-  {69634u, property::type::SpacingMark},
-  {69762u, property::type::SpacingMark},
-  {69808u, property::type::SpacingMark},
-  {69809u, property::type::SpacingMark},
-  {69810u, property::type::SpacingMark},
-  {69815u, property::type::SpacingMark},
-  {69816u, property::type::SpacingMark},
-  {69932u, property::type::SpacingMark},
-  {69957u, property::type::SpacingMark},
-  {69958u, property::type::SpacingMark},
-  {70018u, property::type::SpacingMark},
-  {70067u, property::type::SpacingMark},
-  {70068u, property::type::SpacingMark},
-  {70069u, property::type::SpacingMark},
-  {70079u, property::type::SpacingMark},
-  {70080u, property::type::SpacingMark},
-  {70094u, property::type::SpacingMark},
-  {70188u, property::type::SpacingMark},
-  {70189u, property::type::SpacingMark},
-  {70190u, property::type::SpacingMark},
-  {70194u, property::type::SpacingMark},
-  {70195u, property::type::SpacingMark},
-  {70197u, property::type::SpacingMark},
-  {70368u, property::type::SpacingMark},
-  {70369u, property::type::SpacingMark},
-  {70370u, property::type::SpacingMark},
-  {70402u, property::type::SpacingMark},
-  {70403u, property::type::SpacingMark},
-  {70463u, property::type::SpacingMark},
-  {70465u, property::type::SpacingMark},
-  {70466u, property::type::SpacingMark},
-  {70467u, property::type::SpacingMark},
-  {70468u, property::type::SpacingMark},
-  {70471u, property::type::SpacingMark},
-  {70472u, property::type::SpacingMark},
-  {70475u, property::type::SpacingMark},
-  {70476u, property::type::SpacingMark},
-  {70477u, property::type::SpacingMark},
-  {70498u, property::type::SpacingMark},
-  {70499u, property::type::SpacingMark},
-  {70709u, property::type::SpacingMark},
-  {70710u, property::type::SpacingMark},
-  {70711u, property::type::SpacingMark},
-  {70720u, property::type::SpacingMark},
-  {70721u, property::type::SpacingMark},
-  {70725u, property::type::SpacingMark},
-  {70833u, property::type::SpacingMark},
-  {70834u, property::type::SpacingMark},
-  {70841u, property::type::SpacingMark},
-  {70843u, property::type::SpacingMark},
-  {70844u, property::type::SpacingMark},
-  {70846u, property::type::SpacingMark},
-  {70849u, property::type::SpacingMark},
-  {71088u, property::type::SpacingMark},
-  {71089u, property::type::SpacingMark},
-  {71096u, property::type::SpacingMark},
-  {71097u, property::type::SpacingMark},
-  {71098u, property::type::SpacingMark},
-  {71099u, property::type::SpacingMark},
-  {71102u, property::type::SpacingMark},
-  {71216u, property::type::SpacingMark},
-  {71217u, property::type::SpacingMark},
-  {71218u, property::type::SpacingMark},
-  {71227u, property::type::SpacingMark},
-  {71228u, property::type::SpacingMark},
-  {71230u, property::type::SpacingMark},
-  {71340u, property::type::SpacingMark},
-  {71342u, property::type::SpacingMark},
-  {71343u, property::type::SpacingMark},
-  {71350u, property::type::SpacingMark},
-  {71462u, property::type::SpacingMark},
-  {71724u, property::type::SpacingMark},
-  {71725u, property::type::SpacingMark},
-  {71726u, property::type::SpacingMark},
-  {71736u, property::type::SpacingMark},
-  {71985u, property::type::SpacingMark},
-  {71986u, property::type::SpacingMark},
-  {71987u, property::type::SpacingMark},
-  {71988u, property::type::SpacingMark},
-  {71989u, property::type::SpacingMark},
-  {71991u, property::type::SpacingMark},
-  {71992u, property::type::SpacingMark},
-  {71997u, property::type::SpacingMark},
-  {72000u, property::type::SpacingMark},
-  {72002u, property::type::SpacingMark},
-  {72145u, property::type::SpacingMark},
-  {72146u, property::type::SpacingMark},
-  {72147u, property::type::SpacingMark},
-  {72156u, property::type::SpacingMark},
-  {72157u, property::type::SpacingMark},
-  {72158u, property::type::SpacingMark},
-  {72159u, property::type::SpacingMark},
-  {72164u, property::type::SpacingMark},
-  {72249u, property::type::SpacingMark},
-  {72279u, property::type::SpacingMark},
-  {72280u, property::type::SpacingMark},
-  {72343u, property::type::SpacingMark},
-  {72751u, property::type::SpacingMark},
-  {72766u, property::type::SpacingMark},
-  {72873u, property::type::SpacingMark},
-  {72881u, property::type::SpacingMark},
-  {72884u, property::type::SpacingMark},
-  {73098u, property::type::SpacingMark},
-  {73099u, property::type::SpacingMark},
-  {73100u, property::type::SpacingMark},
-  {73101u, property::type::SpacingMark},
-  {73102u, property::type::SpacingMark},
-  {73107u, property::type::SpacingMark},
-  {73108u, property::type::SpacingMark},
-  {73110u, property::type::SpacingMark},
-  {73461u, property::type::SpacingMark},
-  {73462u, property::type::SpacingMark},
-  {73475u, property::type::SpacingMark},
-  {73524u, property::type::SpacingMark},
-  {73525u, property::type::SpacingMark},
-  {73534u, property::type::SpacingMark},
-  {73535u, property::type::SpacingMark},
-  {73537u, property::type::SpacingMark},
-  {94033u, property::type::SpacingMark},
-  {94034u, property::type::SpacingMark},
-  {94035u, property::type::SpacingMark},
-  {94036u, property::type::SpacingMark},
-  {94037u, property::type::SpacingMark},
-  {94038u, property::type::SpacingMark},
-  {94039u, property::type::SpacingMark},
-  {94040u, property::type::SpacingMark},
-  {94041u, property::type::SpacingMark},
-  {94042u, property::type::SpacingMark},
-  {94043u, property::type::SpacingMark},
-  {94044u, property::type::SpacingMark},
-  {94045u, property::type::SpacingMark},
-  {94046u, property::type::SpacingMark},
-  {94047u, property::type::SpacingMark},
-  {94048u, property::type::SpacingMark},
-  {94049u, property::type::SpacingMark},
-  {94050u, property::type::SpacingMark},
-  {94051u, property::type::SpacingMark},
-  {94052u, property::type::SpacingMark},
-  {94053u, property::type::SpacingMark},
-  {94054u, property::type::SpacingMark},
-  {94055u, property::type::SpacingMark},
-  {94056u, property::type::SpacingMark},
-  {94057u, property::type::SpacingMark},
-  {94058u, property::type::SpacingMark},
-  {94059u, property::type::SpacingMark},
-  {94060u, property::type::SpacingMark},
-  {94061u, property::type::SpacingMark},
-  {94062u, property::type::SpacingMark},
-  {94063u, property::type::SpacingMark},
-  {94064u, property::type::SpacingMark},
-  {94065u, property::type::SpacingMark},
-  {94066u, property::type::SpacingMark},
-  {94067u, property::type::SpacingMark},
-  {94068u, property::type::SpacingMark},
-  {94069u, property::type::SpacingMark},
-  {94070u, property::type::SpacingMark},
-  {94071u, property::type::SpacingMark},
-  {94072u, property::type::SpacingMark},
-  {94073u, property::type::SpacingMark},
-  {94074u, property::type::SpacingMark},
-  {94075u, property::type::SpacingMark},
-  {94076u, property::type::SpacingMark},
-  {94077u, property::type::SpacingMark},
-  {94078u, property::type::SpacingMark},
-  {94079u, property::type::SpacingMark},
-  {94080u, property::type::SpacingMark},
-  {94081u, property::type::SpacingMark},
-  {94082u, property::type::SpacingMark},
-  {94083u, property::type::SpacingMark},
-  {94084u, property::type::SpacingMark},
-  {94085u, property::type::SpacingMark},
-  {94086u, property::type::SpacingMark},
-  {94087u, property::type::SpacingMark},
-  {94192u, property::type::SpacingMark},
-  {94193u, property::type::SpacingMark},
-  {119142u, property::type::SpacingMark},
-  {119149u, property::type::SpacingMark},
-  {4352u, property::type::L},
-  {4353u, property::type::L},
-  {4354u, property::type::L},
-  {4355u, property::type::L},
-  {4356u, property::type::L},
-  {4357u, property::type::L},
-  {4358u, property::type::L},
-  {4359u, property::type::L},
-  {4360u, property::type::L},
-  {4361u, property::type::L},
-  {4362u, property::type::L},
-  {4363u, property::type::L},
-  {4364u, property::type::L},
-  {4365u, property::type::L},
-  {4366u, property::type::L},
-  {4367u, property::type::L},
-  {4368u, property::type::L},
-  {4369u, property::type::L},
-  {4370u, property::type::L},
-  {4371u, property::type::L},
-  {4372u, property::type::L},
-  {4373u, property::type::L},
-  {4374u, property::type::L},
-  {4375u, property::type::L},
-  {4376u, property::type::L},
-  {4377u, property::type::L},
-  {4378u, property::type::L},
-  {4379u, property::type::L},
-  {4380u, property::type::L},
-  {4381u, property::type::L},
-  {4382u, property::type::L},
-  {4383u, property::type::L},
-  {4384u, property::type::L},
-  {4385u, property::type::L},
-  {4386u, property::type::L},
-  {4387u, property::type::L},
-  {4388u, property::type::L},
-  {4389u, property::type::L},
-  {4390u, property::type::L},
-  {4391u, property::type::L},
-  {4392u, property::type::L},
-  {4393u, property::type::L},
-  {4394u, property::type::L},
-  {4395u, property::type::L},
-  {4396u, property::type::L},
-  {4397u, property::type::L},
-  {4398u, property::type::L},
-  {4399u, property::type::L},
-  {4400u, property::type::L},
-  {4401u, property::type::L},
-  {4402u, property::type::L},
-  {4403u, property::type::L},
-  {4404u, property::type::L},
-  {4405u, property::type::L},
-  {4406u, property::type::L},
-  {4407u, property::type::L},
-  {4408u, property::type::L},
-  {4409u, property::type::L},
-  {4410u, property::type::L},
-  {4411u, property::type::L},
-  {4412u, property::type::L},
-  {4413u, property::type::L},
-  {4414u, property::type::L},
-  {4415u, property::type::L},
-  {4416u, property::type::L},
-  {4417u, property::type::L},
-  {4418u, property::type::L},
-  {4419u, property::type::L},
-  {4420u, property::type::L},
-  {4421u, property::type::L},
-  {4422u, property::type::L},
-  {4423u, property::type::L},
-  {4424u, property::type::L},
-  {4425u, property::type::L},
-  {4426u, property::type::L},
-  {4427u, property::type::L},
-  {4428u, property::type::L},
-  {4429u, property::type::L},
-  {4430u, property::type::L},
-  {4431u, property::type::L},
-  {4432u, property::type::L},
-  {4433u, property::type::L},
-  {4434u, property::type::L},
-  {4435u, property::type::L},
-  {4436u, property::type::L},
-  {4437u, property::type::L},
-  {4438u, property::type::L},
-  {4439u, property::type::L},
-  {4440u, property::type::L},
-  {4441u, property::type::L},
-  {4442u, property::type::L},
-  {4443u, property::type::L},
-  {4444u, property::type::L},
-  {4445u, property::type::L},
-  {4446u, property::type::L},
-  {4447u, property::type::L},
-  {43360u, property::type::L},
-  {43361u, property::type::L},
-  {43362u, property::type::L},
-  {43363u, property::type::L},
-  {43364u, property::type::L},
-  {43365u, property::type::L},
-  {43366u, property::type::L},
-  {43367u, property::type::L},
-  {43368u, property::type::L},
-  {43369u, property::type::L},
-  {43370u, property::type::L},
-  {43371u, property::type::L},
-  {43372u, property::type::L},
-  {43373u, property::type::L},
-  {43374u, property::type::L},
-  {43375u, property::type::L},
-  {43376u, property::type::L},
-  {43377u, property::type::L},
-  {43378u, property::type::L},
-  {43379u, property::type::L},
-  {43380u, property::type::L},
-  {43381u, property::type::L},
-  {43382u, property::type::L},
-  {43383u, property::type::L},
-  {43384u, property::type::L},
-  {43385u, property::type::L},
-  {43386u, property::type::L},
-  {43387u, property::type::L},
-  {43388u, property::type::L},
-  {4448u, property::type::V},
-  {4449u, property::type::V},
-  {4450u, property::type::V},
-  {4451u, property::type::V},
-  {4452u, property::type::V},
-  {4453u, property::type::V},
-  {4454u, property::type::V},
-  {4455u, property::type::V},
-  {4456u, property::type::V},
-  {4457u, property::type::V},
-  {4458u, property::type::V},
-  {4459u, property::type::V},
-  {4460u, property::type::V},
-  {4461u, property::type::V},
-  {4462u, property::type::V},
-  {4463u, property::type::V},
-  {4464u, property::type::V},
-  {4465u, property::type::V},
-  {4466u, property::type::V},
-  {4467u, property::type::V},
-  {4468u, property::type::V},
-  {4469u, property::type::V},
-  {4470u, property::type::V},
-  {4471u, property::type::V},
-  {4472u, property::type::V},
-  {4473u, property::type::V},
-  {4474u, property::type::V},
-  {4475u, property::type::V},
-  {4476u, property::type::V},
-  {4477u, property::type::V},
-  {4478u, property::type::V},
-  {4479u, property::type::V},
-  {4480u, property::type::V},
-  {4481u, property::type::V},
-  {4482u, property::type::V},
-  {4483u, property::type::V},
-  {4484u, property::type::V},
-  {4485u, property::type::V},
-  {4486u, property::type::V},
-  {4487u, property::type::V},
-  {4488u, property::type::V},
-  {4489u, property::type::V},
-  {4490u, property::type::V},
-  {4491u, property::type::V},
-  {4492u, property::type::V},
-  {4493u, property::type::V},
-  {4494u, property::type::V},
-  {4495u, property::type::V},
-  {4496u, property::type::V},
-  {4497u, property::type::V},
-  {4498u, property::type::V},
-  {4499u, property::type::V},
-  {4500u, property::type::V},
-  {4501u, property::type::V},
-  {4502u, property::type::V},
-  {4503u, property::type::V},
-  {4504u, property::type::V},
-  {4505u, property::type::V},
-  {4506u, property::type::V},
-  {4507u, property::type::V},
-  {4508u, property::type::V},
-  {4509u, property::type::V},
-  {4510u, property::type::V},
-  {4511u, property::type::V},
-  {4512u, property::type::V},
-  {4513u, property::type::V},
-  {4514u, property::type::V},
-  {4515u, property::type::V},
-  {4516u, property::type::V},
-  {4517u, property::type::V},
-  {4518u, property::type::V},
-  {4519u, property::type::V},
-  {55216u, property::type::V},
-  {55217u, property::type::V},
-  {55218u, property::type::V},
-  {55219u, property::type::V},
-  {55220u, property::type::V},
-  {55221u, property::type::V},
-  {55222u, property::type::V},
-  {55223u, property::type::V},
-  {55224u, property::type::V},
-  {55225u, property::type::V},
-  {55226u, property::type::V},
-  {55227u, property::type::V},
-  {55228u, property::type::V},
-  {55229u, property::type::V},
-  {55230u, property::type::V},
-  {55231u, property::type::V},
-  {55232u, property::type::V},
-  {55233u, property::type::V},
-  {55234u, property::type::V},
-  {55235u, property::type::V},
-  {55236u, property::type::V},
-  {55237u, property::type::V},
-  {55238u, property::type::V},
-  {4520u, property::type::T},
-  {4521u, property::type::T},
-  {4522u, property::type::T},
-  {4523u, property::type::T},
-  {4524u, property::type::T},
-  {4525u, property::type::T},
-  {4526u, property::type::T},
-  {4527u, property::type::T},
-  {4528u, property::type::T},
-  {4529u, property::type::T},
-  {4530u, property::type::T},
-  {4531u, property::type::T},
-  {4532u, property::type::T},
-  {4533u, property::type::T},
-  {4534u, property::type::T},
-  {4535u, property::type::T},
-  {4536u, property::type::T},
-  {4537u, property::type::T},
-  {4538u, property::type::T},
-  {4539u, property::type::T},
-  {4540u, property::type::T},
-  {4541u, property::type::T},
-  {4542u, property::type::T},
-  {4543u, property::type::T},
-  {4544u, property::type::T},
-  {4545u, property::type::T},
-  {4546u, property::type::T},
-  {4547u, property::type::T},
-  {4548u, property::type::T},
-  {4549u, property::type::T},
-  {4550u, property::type::T},
-  {4551u, property::type::T},
-  {4552u, property::type::T},
-  {4553u, property::type::T},
-  {4554u, property::type::T},
-  {4555u, property::type::T},
-  {4556u, property::type::T},
-  {4557u, property::type::T},
-  {4558u, property::type::T},
-  {4559u, property::type::T},
-  {4560u, property::type::T},
-  {4561u, property::type::T},
-  {4562u, property::type::T},
-  {4563u, property::type::T},
-  {4564u, property::type::T},
-  {4565u, property::type::T},
-  {4566u, property::type::T},
-  {4567u, property::type::T},
-  {4568u, property::type::T},
-  {4569u, property::type::T},
-  {4570u, property::type::T},
-  {4571u, property::type::T},
-  {4572u, property::type::T},
-  {4573u, property::type::T},
-  {4574u, property::type::T},
-  {4575u, property::type::T},
-  {4576u, property::type::T},
-  {4577u, property::type::T},
-  {4578u, property::type::T},
-  {4579u, property::type::T},
-  {4580u, property::type::T},
-  {4581u, property::type::T},
-  {4582u, property::type::T},
-  {4583u, property::type::T},
-  {4584u, property::type::T},
-  {4585u, property::type::T},
-  {4586u, property::type::T},
-  {4587u, property::type::T},
-  {4588u, property::type::T},
-  {4589u, property::type::T},
-  {4590u, property::type::T},
-  {4591u, property::type::T},
-  {4592u, property::type::T},
-  {4593u, property::type::T},
-  {4594u, property::type::T},
-  {4595u, property::type::T},
-  {4596u, property::type::T},
-  {4597u, property::type::T},
-  {4598u, property::type::T},
-  {4599u, property::type::T},
-  {4600u, property::type::T},
-  {4601u, property::type::T},
-  {4602u, property::type::T},
-  {4603u, property::type::T},
-  {4604u, property::type::T},
-  {4605u, property::type::T},
-  {4606u, property::type::T},
-  {4607u, property::type::T},
-  {55243u, property::type::T},
-  {55244u, property::type::T},
-  {55245u, property::type::T},
-  {55246u, property::type::T},
-  {55247u, property::type::T},
-  {55248u, property::type::T},
-  {55249u, property::type::T},
-  {55250u, property::type::T},
-  {55251u, property::type::T},
-  {55252u, property::type::T},
-  {55253u, property::type::T},
-  {55254u, property::type::T},
-  {55255u, property::type::T},
-  {55256u, property::type::T},
-  {55257u, property::type::T},
-  {55258u, property::type::T},
-  {55259u, property::type::T},
-  {55260u, property::type::T},
-  {55261u, property::type::T},
-  {55262u, property::type::T},
-  {55263u, property::type::T},
-  {55264u, property::type::T},
-  {55265u, property::type::T},
-  {55266u, property::type::T},
-  {55267u, property::type::T},
-  {55268u, property::type::T},
-  {55269u, property::type::T},
-  {55270u, property::type::T},
-  {55271u, property::type::T},
-  {55272u, property::type::T},
-  {55273u, property::type::T},
-  {55274u, property::type::T},
-  {55275u, property::type::T},
-  {55276u, property::type::T},
-  {55277u, property::type::T},
-  {55278u, property::type::T},
-  {55279u, property::type::T},
-  {55280u, property::type::T},
-  {55281u, property::type::T},
-  {55282u, property::type::T},
-  {55283u, property::type::T},
-  {55284u, property::type::T},
-  {55285u, property::type::T},
-  {55286u, property::type::T},
-  {55287u, property::type::T},
-  {55288u, property::type::T},
-  {55289u, property::type::T},
-  {55290u, property::type::T},
-  {55291u, property::type::T},
-  {44032u, property::type::LV},
-  {44060u, property::type::LV},
-  {44088u, property::type::LV},
-  {44116u, property::type::LV},
-  {44144u, property::type::LV},
-  {44172u, property::type::LV},
-  {44200u, property::type::LV},
-  {44228u, property::type::LV},
-  {44256u, property::type::LV},
-  {44284u, property::type::LV},
-  {44312u, property::type::LV},
-  {44340u, property::type::LV},
-  {44368u, property::type::LV},
-  {44396u, property::type::LV},
-  {44424u, property::type::LV},
-  {44452u, property::type::LV},
-  {44480u, property::type::LV},
-  {44508u, property::type::LV},
-  {44536u, property::type::LV},
-  {44564u, property::type::LV},
-  {44592u, property::type::LV},
-  {44620u, property::type::LV},
-  {44648u, property::type::LV},
-  {44676u, property::type::LV},
-  {44704u, property::type::LV},
-  {44732u, property::type::LV},
-  {44760u, property::type::LV},
-  {44788u, property::type::LV},
-  {44816u, property::type::LV},
-  {44844u, property::type::LV},
-  {44872u, property::type::LV},
-  {44900u, property::type::LV},
-  {44928u, property::type::LV},
-  {44956u, property::type::LV},
-  {44984u, property::type::LV},
-  {45012u, property::type::LV},
-  {45040u, property::type::LV},
-  {45068u, property::type::LV},
-  {45096u, property::type::LV},
-  {45124u, property::type::LV},
-  {45152u, property::type::LV},
-  {45180u, property::type::LV},
-  {45208u, property::type::LV},
-  {45236u, property::type::LV},
-  {45264u, property::type::LV},
-  {45292u, property::type::LV},
-  {45320u, property::type::LV},
-  {45348u, property::type::LV},
-  {45376u, property::type::LV},
-  {45404u, property::type::LV},
-  {45432u, property::type::LV},
-  {45460u, property::type::LV},
-  {45488u, property::type::LV},
-  {45516u, property::type::LV},
-  {45544u, property::type::LV},
-  {45572u, property::type::LV},
-  {45600u, property::type::LV},
-  {45628u, property::type::LV},
-  {45656u, property::type::LV},
-  {45684u, property::type::LV},
-  {45712u, property::type::LV},
-  {45740u, property::type::LV},
-  {45768u, property::type::LV},
-  {45796u, property::type::LV},
-  {45824u, property::type::LV},
-  {45852u, property::type::LV},
-  {45880u, property::type::LV},
-  {45908u, property::type::LV},
-  {45936u, property::type::LV},
-  {45964u, property::type::LV},
-  {45992u, property::type::LV},
-  {46020u, property::type::LV},
-  {46048u, property::type::LV},
-  {46076u, property::type::LV},
-  {46104u, property::type::LV},
-  {46132u, property::type::LV},
-  {46160u, property::type::LV},
-  {46188u, property::type::LV},
-  {46216u, property::type::LV},
-  {46244u, property::type::LV},
-  {46272u, property::type::LV},
-  {46300u, property::type::LV},
-  {46328u, property::type::LV},
-  {46356u, property::type::LV},
-  {46384u, property::type::LV},
-  {46412u, property::type::LV},
-  {46440u, property::type::LV},
-  {46468u, property::type::LV},
-  {46496u, property::type::LV},
-  {46524u, property::type::LV},
-  {46552u, property::type::LV},
-  {46580u, property::type::LV},
-  {46608u, property::type::LV},
-  {46636u, property::type::LV},
-  {46664u, property::type::LV},
-  {46692u, property::type::LV},
-  {46720u, property::type::LV},
-  {46748u, property::type::LV},
-  {46776u, property::type::LV},
-  {46804u, property::type::LV},
-  {46832u, property::type::LV},
-  {46860u, property::type::LV},
-  {46888u, property::type::LV},
-  {46916u, property::type::LV},
-  {46944u, property::type::LV},
-  {46972u, property::type::LV},
-  {47000u, property::type::LV},
-  {47028u, property::type::LV},
-  {47056u, property::type::LV},
-  {47084u, property::type::LV},
-  {47112u, property::type::LV},
-  {47140u, property::type::LV},
-  {47168u, property::type::LV},
-  {47196u, property::type::LV},
-  {47224u, property::type::LV},
-  {47252u, property::type::LV},
-  {47280u, property::type::LV},
-  {47308u, property::type::LV},
-  {47336u, property::type::LV},
-  {47364u, property::type::LV},
-  {47392u, property::type::LV},
-  {47420u, property::type::LV},
-  {47448u, property::type::LV},
-  {47476u, property::type::LV},
-  {47504u, property::type::LV},
-  {47532u, property::type::LV},
-  {47560u, property::type::LV},
-  {47588u, property::type::LV},
-  {47616u, property::type::LV},
-  {47644u, property::type::LV},
-  {47672u, property::type::LV},
-  {47700u, property::type::LV},
-  {47728u, property::type::LV},
-  {47756u, property::type::LV},
-  {47784u, property::type::LV},
-  {47812u, property::type::LV},
-  {47840u, property::type::LV},
-  {47868u, property::type::LV},
-  {47896u, property::type::LV},
-  {47924u, property::type::LV},
-  {47952u, property::type::LV},
-  {47980u, property::type::LV},
-  {48008u, property::type::LV},
-  {48036u, property::type::LV},
-  {48064u, property::type::LV},
-  {48092u, property::type::LV},
-  {48120u, property::type::LV},
-  {48148u, property::type::LV},
-  {48176u, property::type::LV},
-  {48204u, property::type::LV},
-  {48232u, property::type::LV},
-  {48260u, property::type::LV},
-  {48288u, property::type::LV},
-  {48316u, property::type::LV},
-  {48344u, property::type::LV},
-  {48372u, property::type::LV},
-  {48400u, property::type::LV},
-  {48428u, property::type::LV},
-  {48456u, property::type::LV},
-  {48484u, property::type::LV},
-  {48512u, property::type::LV},
-  {48540u, property::type::LV},
-  {48568u, property::type::LV},
-  {48596u, property::type::LV},
-  {48624u, property::type::LV},
-  {48652u, property::type::LV},
-  {48680u, property::type::LV},
-  {48708u, property::type::LV},
-  {48736u, property::type::LV},
-  {48764u, property::type::LV},
-  {48792u, property::type::LV},
-  {48820u, property::type::LV},
-  {48848u, property::type::LV},
-  {48876u, property::type::LV},
-  {48904u, property::type::LV},
-  {48932u, property::type::LV},
-  {48960u, property::type::LV},
-  {48988u, property::type::LV},
-  {49016u, property::type::LV},
-  {49044u, property::type::LV},
-  {49072u, property::type::LV},
-  {49100u, property::type::LV},
-  {49128u, property::type::LV},
-  {49156u, property::type::LV},
-  {49184u, property::type::LV},
-  {49212u, property::type::LV},
-  {49240u, property::type::LV},
-  {49268u, property::type::LV},
-  {49296u, property::type::LV},
-  {49324u, property::type::LV},
-  {49352u, property::type::LV},
-  {49380u, property::type::LV},
-  {49408u, property::type::LV},
-  {49436u, property::type::LV},
-  {49464u, property::type::LV},
-  {49492u, property::type::LV},
-  {49520u, property::type::LV},
-  {49548u, property::type::LV},
-  {49576u, property::type::LV},
-  {49604u, property::type::LV},
-  {49632u, property::type::LV},
-  {49660u, property::type::LV},
-  {49688u, property::type::LV},
-  {49716u, property::type::LV},
-  {49744u, property::type::LV},
-  {49772u, property::type::LV},
-  {49800u, property::type::LV},
-  {49828u, property::type::LV},
-  {49856u, property::type::LV},
-  {49884u, property::type::LV},
-  {49912u, property::type::LV},
-  {49940u, property::type::LV},
-  {49968u, property::type::LV},
-  {49996u, property::type::LV},
-  {50024u, property::type::LV},
-  {50052u, property::type::LV},
-  {50080u, property::type::LV},
-  {50108u, property::type::LV},
-  {50136u, property::type::LV},
-  {50164u, property::type::LV},
-  {50192u, property::type::LV},
-  {50220u, property::type::LV},
-  {50248u, property::type::LV},
-  {50276u, property::type::LV},
-  {50304u, property::type::LV},
-  {50332u, property::type::LV},
-  {50360u, property::type::LV},
-  {50388u, property::type::LV},
-  {50416u, property::type::LV},
-  {50444u, property::type::LV},
-  {50472u, property::type::LV},
-  {50500u, property::type::LV},
-  {50528u, property::type::LV},
-  {50556u, property::type::LV},
-  {50584u, property::type::LV},
-  {50612u, property::type::LV},
-  {50640u, property::type::LV},
-  {50668u, property::type::LV},
-  {50696u, property::type::LV},
-  {50724u, property::type::LV},
-  {50752u, property::type::LV},
-  {50780u, property::type::LV},
-  {50808u, property::type::LV},
-  {50836u, property::type::LV},
-  {50864u, property::type::LV},
-  {50892u, property::type::LV},
-  {50920u, property::type::LV},
-  {50948u, property::type::LV},
-  {50976u, property::type::LV},
-  {51004u, property::type::LV},
-  {51032u, property::type::LV},
-  {51060u, property::type::LV},
-  {51088u, property::type::LV},
-  {51116u, property::type::LV},
-  {51144u, property::type::LV},
-  {51172u, property::type::LV},
-  {51200u, property::type::LV},
-  {51228u, property::type::LV},
-  {51256u, property::type::LV},
-  {51284u, property::type::LV},
-  {51312u, property::type::LV},
-  {51340u, property::type::LV},
-  {51368u, property::type::LV},
-  {51396u, property::type::LV},
-  {51424u, property::type::LV},
-  {51452u, property::type::LV},
-  {51480u, property::type::LV},
-  {51508u, property::type::LV},
-  {51536u, property::type::LV},
-  {51564u, property::type::LV},
-  {51592u, property::type::LV},
-  {51620u, property::type::LV},
-  {51648u, property::type::LV},
-  {51676u, property::type::LV},
-  {51704u, property::type::LV},
-  {51732u, property::type::LV},
-  {51760u, property::type::LV},
-  {51788u, property::type::LV},
-  {51816u, property::type::LV},
-  {51844u, property::type::LV},
-  {51872u, property::type::LV},
-  {51900u, property::type::LV},
-  {51928u, property::type::LV},
-  {51956u, property::type::LV},
-  {51984u, property::type::LV},
-  {52012u, property::type::LV},
-  {52040u, property::type::LV},
-  {52068u, property::type::LV},
-  {52096u, property::type::LV},
-  {52124u, property::type::LV},
-  {52152u, property::type::LV},
-  {52180u, property::type::LV},
-  {52208u, property::type::LV},
-  {52236u, property::type::LV},
-  {52264u, property::type::LV},
-  {52292u, property::type::LV},
-  {52320u, property::type::LV},
-  {52348u, property::type::LV},
-  {52376u, property::type::LV},
-  {52404u, property::type::LV},
-  {52432u, property::type::LV},
-  {52460u, property::type::LV},
-  {52488u, property::type::LV},
-  {52516u, property::type::LV},
-  {52544u, property::type::LV},
-  {52572u, property::type::LV},
-  {52600u, property::type::LV},
-  {52628u, property::type::LV},
-  {52656u, property::type::LV},
-  {52684u, property::type::LV},
-  {52712u, property::type::LV},
-  {52740u, property::type::LV},
-  {52768u, property::type::LV},
-  {52796u, property::type::LV},
-  {52824u, property::type::LV},
-  {52852u, property::type::LV},
-  {52880u, property::type::LV},
-  {52908u, property::type::LV},
-  {52936u, property::type::LV},
-  {52964u, property::type::LV},
-  {52992u, property::type::LV},
-  {53020u, property::type::LV},
-  {53048u, property::type::LV},
-  {53076u, property::type::LV},
-  {53104u, property::type::LV},
-  {53132u, property::type::LV},
-  {53160u, property::type::LV},
-  {53188u, property::type::LV},
-  {53216u, property::type::LV},
-  {53244u, property::type::LV},
-  {53272u, property::type::LV},
-  {53300u, property::type::LV},
-  {53328u, property::type::LV},
-  {53356u, property::type::LV},
-  {53384u, property::type::LV},
-  {53412u, property::type::LV},
-  {53440u, property::type::LV},
-  {53468u, property::type::LV},
-  {53496u, property::type::LV},
-  {53524u, property::type::LV},
-  {53552u, property::type::LV},
-  {53580u, property::type::LV},
-  {53608u, property::type::LV},
-  {53636u, property::type::LV},
-  {53664u, property::type::LV},
-  {53692u, property::type::LV},
-  {53720u, property::type::LV},
-  {53748u, property::type::LV},
-  {53776u, property::type::LV},
-  {53804u, property::type::LV},
-  {53832u, property::type::LV},
-  {53860u, property::type::LV},
-  {53888u, property::type::LV},
-  {53916u, property::type::LV},
-  {53944u, property::type::LV},
-  {53972u, property::type::LV},
-  {54000u, property::type::LV},
-  {54028u, property::type::LV},
-  {54056u, property::type::LV},
-  {54084u, property::type::LV},
-  {54112u, property::type::LV},
-  {54140u, property::type::LV},
-  {54168u, property::type::LV},
-  {54196u, property::type::LV},
-  {54224u, property::type::LV},
-  {54252u, property::type::LV},
-  {54280u, property::type::LV},
-  {54308u, property::type::LV},
-  {54336u, property::type::LV},
-  {54364u, property::type::LV},
-  {54392u, property::type::LV},
-  {54420u, property::type::LV},
-  {54448u, property::type::LV},
-  {54476u, property::type::LV},
-  {54504u, property::type::LV},
-  {54532u, property::type::LV},
-  {54560u, property::type::LV},
-  {54588u, property::type::LV},
-  {54616u, property::type::LV},
-  {54644u, property::type::LV},
-  {54672u, property::type::LV},
-  {54700u, property::type::LV},
-  {54728u, property::type::LV},
-  {54756u, property::type::LV},
-  {54784u, property::type::LV},
-  {54812u, property::type::LV},
-  {54840u, property::type::LV},
-  {54868u, property::type::LV},
-  {54896u, property::type::LV},
-  {54924u, property::type::LV},
-  {54952u, property::type::LV},
-  {54980u, property::type::LV},
-  {55008u, property::type::LV},
-  {55036u, property::type::LV},
-  {55064u, property::type::LV},
-  {55092u, property::type::LV},
-  {55120u, property::type::LV},
-  {55148u, property::type::LV},
-  {55176u, property::type::LV},
-  {44033u, property::type::LVT},
-  {44034u, property::type::LVT},
-  {44035u, property::type::LVT},
-  {44036u, property::type::LVT},
-  {44037u, property::type::LVT},
-  {44038u, property::type::LVT},
-  {44039u, property::type::LVT},
-  {44040u, property::type::LVT},
-  {44041u, property::type::LVT},
-  {44042u, property::type::LVT},
-  {44043u, property::type::LVT},
-  {44044u, property::type::LVT},
-  {44045u, property::type::LVT},
-  {44046u, property::type::LVT},
-  {44047u, property::type::LVT},
-  {44048u, property::type::LVT},
-  {44049u, property::type::LVT},
-  {44050u, property::type::LVT},
-  {44051u, property::type::LVT},
-  {44052u, property::type::LVT},
-  {44053u, property::type::LVT},
-  {44054u, property::type::LVT},
-  {44055u, property::type::LVT},
-  {44056u, property::type::LVT},
-  {44057u, property::type::LVT},
-  {44058u, property::type::LVT},
-  {44059u, property::type::LVT},
-  {44061u, property::type::LVT},
-  {44062u, property::type::LVT},
-  {44063u, property::type::LVT},
-  {44064u, property::type::LVT},
-  {44065u, property::type::LVT},
-  {44066u, property::type::LVT},
-  {44067u, property::type::LVT},
-  {44068u, property::type::LVT},
-  {44069u, property::type::LVT},
-  {44070u, property::type::LVT},
-  {44071u, property::type::LVT},
-  {44072u, property::type::LVT},
-  {44073u, property::type::LVT},
-  {44074u, property::type::LVT},
-  {44075u, property::type::LVT},
-  {44076u, property::type::LVT},
-  {44077u, property::type::LVT},
-  {44078u, property::type::LVT},
-  {44079u, property::type::LVT},
-  {44080u, property::type::LVT},
-  {44081u, property::type::LVT},
-  {44082u, property::type::LVT},
-  {44083u, property::type::LVT},
-  {44084u, property::type::LVT},
-  {44085u, property::type::LVT},
-  {44086u, property::type::LVT},
-  {44087u, property::type::LVT},
-  {44089u, property::type::LVT},
-  {44090u, property::type::LVT},
-  {44091u, property::type::LVT},
-  {44092u, property::type::LVT},
-  {44093u, property::type::LVT},
-  {44094u, property::type::LVT},
-  {44095u, property::type::LVT},
-  {44096u, property::type::LVT},
-  {44097u, property::type::LVT},
-  {44098u, property::type::LVT},
-  {44099u, property::type::LVT},
-  {44100u, property::type::LVT},
-  {44101u, property::type::LVT},
-  {44102u, property::type::LVT},
-  {44103u, property::type::LVT},
-  {44104u, property::type::LVT},
-  {44105u, property::type::LVT},
-  {44106u, property::type::LVT},
-  {44107u, property::type::LVT},
-  {44108u, property::type::LVT},
-  {44109u, property::type::LVT},
-  {44110u, property::type::LVT},
-  {44111u, property::type::LVT},
-  {44112u, property::type::LVT},
-  {44113u, property::type::LVT},
-  {44114u, property::type::LVT},
-  {44115u, property::type::LVT},
-  {44117u, property::type::LVT},
-  {44118u, property::type::LVT},
-  {44119u, property::type::LVT},
-  {44120u, property::type::LVT},
-  {44121u, property::type::LVT},
-  {44122u, property::type::LVT},
-  {44123u, property::type::LVT},
-  {44124u, property::type::LVT},
-  {44125u, property::type::LVT},
-  {44126u, property::type::LVT},
-  {44127u, property::type::LVT},
-  {44128u, property::type::LVT},
-  {44129u, property::type::LVT},
-  {44130u, property::type::LVT},
-  {44131u, property::type::LVT},
-  {44132u, property::type::LVT},
-  {44133u, property::type::LVT},
-  {44134u, property::type::LVT},
-  {44135u, property::type::LVT},
-  {44136u, property::type::LVT},
-  {44137u, property::type::LVT},
-  {44138u, property::type::LVT},
-  {44139u, property::type::LVT},
-  {44140u, property::type::LVT},
-  {44141u, property::type::LVT},
-  {44142u, property::type::LVT},
-  {44143u, property::type::LVT},
-  {44145u, property::type::LVT},
-  {44146u, property::type::LVT},
-  {44147u, property::type::LVT},
-  {44148u, property::type::LVT},
-  {44149u, property::type::LVT},
-  {44150u, property::type::LVT},
-  {44151u, property::type::LVT},
-  {44152u, property::type::LVT},
-  {44153u, property::type::LVT},
-  {44154u, property::type::LVT},
-  {44155u, property::type::LVT},
-  {44156u, property::type::LVT},
-  {44157u, property::type::LVT},
-  {44158u, property::type::LVT},
-  {44159u, property::type::LVT},
-  {44160u, property::type::LVT},
-  {44161u, property::type::LVT},
-  {44162u, property::type::LVT},
-  {44163u, property::type::LVT},
-  {44164u, property::type::LVT},
-  {44165u, property::type::LVT},
-  {44166u, property::type::LVT},
-  {44167u, property::type::LVT},
-  {44168u, property::type::LVT},
-  {44169u, property::type::LVT},
-  {44170u, property::type::LVT},
-  {44171u, property::type::LVT},
-  {44173u, property::type::LVT},
-  {44174u, property::type::LVT},
-  {44175u, property::type::LVT},
-  {44176u, property::type::LVT},
-  {44177u, property::type::LVT},
-  {44178u, property::type::LVT},
-  {44179u, property::type::LVT},
-  {44180u, property::type::LVT},
-  {44181u, property::type::LVT},
-  {44182u, property::type::LVT},
-  {44183u, property::type::LVT},
-  {44184u, property::type::LVT},
-  {44185u, property::type::LVT},
-  {44186u, property::type::LVT},
-  {44187u, property::type::LVT},
-  {44188u, property::type::LVT},
-  {44189u, property::type::LVT},
-  {44190u, property::type::LVT},
-  {44191u, property::type::LVT},
-  {44192u, property::type::LVT},
-  {44193u, property::type::LVT},
-  {44194u, property::type::LVT},
-  {44195u, property::type::LVT},
-  {44196u, property::type::LVT},
-  {44197u, property::type::LVT},
-  {44198u, property::type::LVT},
-  {44199u, property::type::LVT},
-  {44201u, property::type::LVT},
-  {44202u, property::type::LVT},
-  {44203u, property::type::LVT},
-  {44204u, property::type::LVT},
-  {44205u, property::type::LVT},
-  {44206u, property::type::LVT},
-  {44207u, property::type::LVT},
-  {44208u, property::type::LVT},
-  {44209u, property::type::LVT},
-  {44210u, property::type::LVT},
-  {44211u, property::type::LVT},
-  {44212u, property::type::LVT},
-  {44213u, property::type::LVT},
-  {44214u, property::type::LVT},
-  {44215u, property::type::LVT},
-  {44216u, property::type::LVT},
-  {44217u, property::type::LVT},
-  {44218u, property::type::LVT},
-  {44219u, property::type::LVT},
-  {44220u, property::type::LVT},
-  {44221u, property::type::LVT},
-  {44222u, property::type::LVT},
-  {44223u, property::type::LVT},
-  {44224u, property::type::LVT},
-  {44225u, property::type::LVT},
-  {44226u, property::type::LVT},
-  {44227u, property::type::LVT},
-  {44229u, property::type::LVT},
-  {44230u, property::type::LVT},
-  {44231u, property::type::LVT},
-  {44232u, property::type::LVT},
-  {44233u, property::type::LVT},
-  {44234u, property::type::LVT},
-  {44235u, property::type::LVT},
-  {44236u, property::type::LVT},
-  {44237u, property::type::LVT},
-  {44238u, property::type::LVT},
-  {44239u, property::type::LVT},
-  {44240u, property::type::LVT},
-  {44241u, property::type::LVT},
-  {44242u, property::type::LVT},
-  {44243u, property::type::LVT},
-  {44244u, property::type::LVT},
-  {44245u, property::type::LVT},
-  {44246u, property::type::LVT},
-  {44247u, property::type::LVT},
-  {44248u, property::type::LVT},
-  {44249u, property::type::LVT},
-  {44250u, property::type::LVT},
-  {44251u, property::type::LVT},
-  {44252u, property::type::LVT},
-  {44253u, property::type::LVT},
-  {44254u, property::type::LVT},
-  {44255u, property::type::LVT},
-  {44257u, property::type::LVT},
-  {44258u, property::type::LVT},
-  {44259u, property::type::LVT},
-  {44260u, property::type::LVT},
-  {44261u, property::type::LVT},
-  {44262u, property::type::LVT},
-  {44263u, property::type::LVT},
-  {44264u, property::type::LVT},
-  {44265u, property::type::LVT},
-  {44266u, property::type::LVT},
-  {44267u, property::type::LVT},
-  {44268u, property::type::LVT},
-  {44269u, property::type::LVT},
-  {44270u, property::type::LVT},
-  {44271u, property::type::LVT},
-  {44272u, property::type::LVT},
-  {44273u, property::type::LVT},
-  {44274u, property::type::LVT},
-  {44275u, property::type::LVT},
-  {44276u, property::type::LVT},
-  {44277u, property::type::LVT},
-  {44278u, property::type::LVT},
-  {44279u, property::type::LVT},
-  {44280u, property::type::LVT},
-  {44281u, property::type::LVT},
-  {44282u, property::type::LVT},
-  {44283u, property::type::LVT},
-  {44285u, property::type::LVT},
-  {44286u, property::type::LVT},
-  {44287u, property::type::LVT},
-  {44288u, property::type::LVT},
-  {44289u, property::type::LVT},
-  {44290u, property::type::LVT},
-  {44291u, property::type::LVT},
-  {44292u, property::type::LVT},
-  {44293u, property::type::LVT},
-  {44294u, property::type::LVT},
-  {44295u, property::type::LVT},
-  {44296u, property::type::LVT},
-  {44297u, property::type::LVT},
-  {44298u, property::type::LVT},
-  {44299u, property::type::LVT},
-  {44300u, property::type::LVT},
-  {44301u, property::type::LVT},
-  {44302u, property::type::LVT},
-  {44303u, property::type::LVT},
-  {44304u, property::type::LVT},
-  {44305u, property::type::LVT},
-  {44306u, property::type::LVT},
-  {44307u, property::type::LVT},
-  {44308u, property::type::LVT},
-  {44309u, property::type::LVT},
-  {44310u, property::type::LVT},
-  {44311u, property::type::LVT},
-  {44313u, property::type::LVT},
-  {44314u, property::type::LVT},
-  {44315u, property::type::LVT},
-  {44316u, property::type::LVT},
-  {44317u, property::type::LVT},
-  {44318u, property::type::LVT},
-  {44319u, property::type::LVT},
-  {44320u, property::type::LVT},
-  {44321u, property::type::LVT},
-  {44322u, property::type::LVT},
-  {44323u, property::type::LVT},
-  {44324u, property::type::LVT},
-  {44325u, property::type::LVT},
-  {44326u, property::type::LVT},
-  {44327u, property::type::LVT},
-  {44328u, property::type::LVT},
-  {44329u, property::type::LVT},
-  {44330u, property::type::LVT},
-  {44331u, property::type::LVT},
-  {44332u, property::type::LVT},
-  {44333u, property::type::LVT},
-  {44334u, property::type::LVT},
-  {44335u, property::type::LVT},
-  {44336u, property::type::LVT},
-  {44337u, property::type::LVT},
-  {44338u, property::type::LVT},
-  {44339u, property::type::LVT},
-  {44341u, property::type::LVT},
-  {44342u, property::type::LVT},
-  {44343u, property::type::LVT},
-  {44344u, property::type::LVT},
-  {44345u, property::type::LVT},
-  {44346u, property::type::LVT},
-  {44347u, property::type::LVT},
-  {44348u, property::type::LVT},
-  {44349u, property::type::LVT},
-  {44350u, property::type::LVT},
-  {44351u, property::type::LVT},
-  {44352u, property::type::LVT},
-  {44353u, property::type::LVT},
-  {44354u, property::type::LVT},
-  {44355u, property::type::LVT},
-  {44356u, property::type::LVT},
-  {44357u, property::type::LVT},
-  {44358u, property::type::LVT},
-  {44359u, property::type::LVT},
-  {44360u, property::type::LVT},
-  {44361u, property::type::LVT},
-  {44362u, property::type::LVT},
-  {44363u, property::type::LVT},
-  {44364u, property::type::LVT},
-  {44365u, property::type::LVT},
-  {44366u, property::type::LVT},
-  {44367u, property::type::LVT},
-  {44369u, property::type::LVT},
-  {44370u, property::type::LVT},
-  {44371u, property::type::LVT},
-  {44372u, property::type::LVT},
-  {44373u, property::type::LVT},
-  {44374u, property::type::LVT},
-  {44375u, property::type::LVT},
-  {44376u, property::type::LVT},
-  {44377u, property::type::LVT},
-  {44378u, property::type::LVT},
-  {44379u, property::type::LVT},
-  {44380u, property::type::LVT},
-  {44381u, property::type::LVT},
-  {44382u, property::type::LVT},
-  {44383u, property::type::LVT},
-  {44384u, property::type::LVT},
-  {44385u, property::type::LVT},
-  {44386u, property::type::LVT},
-  {44387u, property::type::LVT},
-  {44388u, property::type::LVT},
-  {44389u, property::type::LVT},
-  {44390u, property::type::LVT},
-  {44391u, property::type::LVT},
-  {44392u, property::type::LVT},
-  {44393u, property::type::LVT},
-  {44394u, property::type::LVT},
-  {44395u, property::type::LVT},
-  {44397u, property::type::LVT},
-  {44398u, property::type::LVT},
-  {44399u, property::type::LVT},
-  {44400u, property::type::LVT},
-  {44401u, property::type::LVT},
-  {44402u, property::type::LVT},
-  {44403u, property::type::LVT},
-  {44404u, property::type::LVT},
-  {44405u, property::type::LVT},
-  {44406u, property::type::LVT},
-  {44407u, property::type::LVT},
-  {44408u, property::type::LVT},
-  {44409u, property::type::LVT},
-  {44410u, property::type::LVT},
-  {44411u, property::type::LVT},
-  {44412u, property::type::LVT},
-  {44413u, property::type::LVT},
-  {44414u, property::type::LVT},
-  {44415u, property::type::LVT},
-  {44416u, property::type::LVT},
-  {44417u, property::type::LVT},
-  {44418u, property::type::LVT},
-  {44419u, property::type::LVT},
-  {44420u, property::type::LVT},
-  {44421u, property::type::LVT},
-  {44422u, property::type::LVT},
-  {44423u, property::type::LVT},
-  {44425u, property::type::LVT},
-  {44426u, property::type::LVT},
-  {44427u, property::type::LVT},
-  {44428u, property::type::LVT},
-  {44429u, property::type::LVT},
-  {44430u, property::type::LVT},
-  {44431u, property::type::LVT},
-  {44432u, property::type::LVT},
-  {44433u, property::type::LVT},
-  {44434u, property::type::LVT},
-  {44435u, property::type::LVT},
-  {44436u, property::type::LVT},
-  {44437u, property::type::LVT},
-  {44438u, property::type::LVT},
-  {44439u, property::type::LVT},
-  {44440u, property::type::LVT},
-  {44441u, property::type::LVT},
-  {44442u, property::type::LVT},
-  {44443u, property::type::LVT},
-  {44444u, property::type::LVT},
-  {44445u, property::type::LVT},
-  {44446u, property::type::LVT},
-  {44447u, property::type::LVT},
-  {44448u, property::type::LVT},
-  {44449u, property::type::LVT},
-  {44450u, property::type::LVT},
-  {44451u, property::type::LVT},
-  {44453u, property::type::LVT},
-  {44454u, property::type::LVT},
-  {44455u, property::type::LVT},
-  {44456u, property::type::LVT},
-  {44457u, property::type::LVT},
-  {44458u, property::type::LVT},
-  {44459u, property::type::LVT},
-  {44460u, property::type::LVT},
-  {44461u, property::type::LVT},
-  {44462u, property::type::LVT},
-  {44463u, property::type::LVT},
-  {44464u, property::type::LVT},
-  {44465u, property::type::LVT},
-  {44466u, property::type::LVT},
-  {44467u, property::type::LVT},
-  {44468u, property::type::LVT},
-  {44469u, property::type::LVT},
-  {44470u, property::type::LVT},
-  {44471u, property::type::LVT},
-  {44472u, property::type::LVT},
-  {44473u, property::type::LVT},
-  {44474u, property::type::LVT},
-  {44475u, property::type::LVT},
-  {44476u, property::type::LVT},
-  {44477u, property::type::LVT},
-  {44478u, property::type::LVT},
-  {44479u, property::type::LVT},
-  {44481u, property::type::LVT},
-  {44482u, property::type::LVT},
-  {44483u, property::type::LVT},
-  {44484u, property::type::LVT},
-  {44485u, property::type::LVT},
-  {44486u, property::type::LVT},
-  {44487u, property::type::LVT},
-  {44488u, property::type::LVT},
-  {44489u, property::type::LVT},
-  {44490u, property::type::LVT},
-  {44491u, property::type::LVT},
-  {44492u, property::type::LVT},
-  {44493u, property::type::LVT},
-  {44494u, property::type::LVT},
-  {44495u, property::type::LVT},
-  {44496u, property::type::LVT},
-  {44497u, property::type::LVT},
-  {44498u, property::type::LVT},
-  {44499u, property::type::LVT},
-  {44500u, property::type::LVT},
-  {44501u, property::type::LVT},
-  {44502u, property::type::LVT},
-  {44503u, property::type::LVT},
-  {44504u, property::type::LVT},
-  {44505u, property::type::LVT},
-  {44506u, property::type::LVT},
-  {44507u, property::type::LVT},
-  {44509u, property::type::LVT},
-  {44510u, property::type::LVT},
-  {44511u, property::type::LVT},
-  {44512u, property::type::LVT},
-  {44513u, property::type::LVT},
-  {44514u, property::type::LVT},
-  {44515u, property::type::LVT},
-  {44516u, property::type::LVT},
-  {44517u, property::type::LVT},
-  {44518u, property::type::LVT},
-  {44519u, property::type::LVT},
-  {44520u, property::type::LVT},
-  {44521u, property::type::LVT},
-  {44522u, property::type::LVT},
-  {44523u, property::type::LVT},
-  {44524u, property::type::LVT},
-  {44525u, property::type::LVT},
-  {44526u, property::type::LVT},
-  {44527u, property::type::LVT},
-  {44528u, property::type::LVT},
-  {44529u, property::type::LVT},
-  {44530u, property::type::LVT},
-  {44531u, property::type::LVT},
-  {44532u, property::type::LVT},
-  {44533u, property::type::LVT},
-  {44534u, property::type::LVT},
-  {44535u, property::type::LVT},
-  {44537u, property::type::LVT},
-  {44538u, property::type::LVT},
-  {44539u, property::type::LVT},
-  {44540u, property::type::LVT},
-  {44541u, property::type::LVT},
-  {44542u, property::type::LVT},
-  {44543u, property::type::LVT},
-  {44544u, property::type::LVT},
-  {44545u, property::type::LVT},
-  {44546u, property::type::LVT},
-  {44547u, property::type::LVT},
-  {44548u, property::type::LVT},
-  {44549u, property::type::LVT},
-  {44550u, property::type::LVT},
-  {44551u, property::type::LVT},
-  {44552u, property::type::LVT},
-  {44553u, property::type::LVT},
-  {44554u, property::type::LVT},
-  {44555u, property::type::LVT},
-  {44556u, property::type::LVT},
-  {44557u, property::type::LVT},
-  {44558u, property::type::LVT},
-  {44559u, property::type::LVT},
-  {44560u, property::type::LVT},
-  {44561u, property::type::LVT},
-  {44562u, property::type::LVT},
-  {44563u, property::type::LVT},
-  {44565u, property::type::LVT},
-  {44566u, property::type::LVT},
-  {44567u, property::type::LVT},
-  {44568u, property::type::LVT},
-  {44569u, property::type::LVT},
-  {44570u, property::type::LVT},
-  {44571u, property::type::LVT},
-  {44572u, property::type::LVT},
-  {44573u, property::type::LVT},
-  {44574u, property::type::LVT},
-  {44575u, property::type::LVT},
-  {44576u, property::type::LVT},
-  {44577u, property::type::LVT},
-  {44578u, property::type::LVT},
-  {44579u, property::type::LVT},
-  {44580u, property::type::LVT},
-  {44581u, property::type::LVT},
-  {44582u, property::type::LVT},
-  {44583u, property::type::LVT},
-  {44584u, property::type::LVT},
-  {44585u, property::type::LVT},
-  {44586u, property::type::LVT},
-  {44587u, property::type::LVT},
-  {44588u, property::type::LVT},
-  {44589u, property::type::LVT},
-  {44590u, property::type::LVT},
-  {44591u, property::type::LVT},
-  {44593u, property::type::LVT},
-  {44594u, property::type::LVT},
-  {44595u, property::type::LVT},
-  {44596u, property::type::LVT},
-  {44597u, property::type::LVT},
-  {44598u, property::type::LVT},
-  {44599u, property::type::LVT},
-  {44600u, property::type::LVT},
-  {44601u, property::type::LVT},
-  {44602u, property::type::LVT},
-  {44603u, property::type::LVT},
-  {44604u, property::type::LVT},
-  {44605u, property::type::LVT},
-  {44606u, property::type::LVT},
-  {44607u, property::type::LVT},
-  {44608u, property::type::LVT},
-  {44609u, property::type::LVT},
-  {44610u, property::type::LVT},
-  {44611u, property::type::LVT},
-  {44612u, property::type::LVT},
-  {44613u, property::type::LVT},
-  {44614u, property::type::LVT},
-  {44615u, property::type::LVT},
-  {44616u, property::type::LVT},
-  {44617u, property::type::LVT},
-  {44618u, property::type::LVT},
-  {44619u, property::type::LVT},
-  {44621u, property::type::LVT},
-  {44622u, property::type::LVT},
-  {44623u, property::type::LVT},
-  {44624u, property::type::LVT},
-  {44625u, property::type::LVT},
-  {44626u, property::type::LVT},
-  {44627u, property::type::LVT},
-  {44628u, property::type::LVT},
-  {44629u, property::type::LVT},
-  {44630u, property::type::LVT},
-  {44631u, property::type::LVT},
-  {44632u, property::type::LVT},
-  {44633u, property::type::LVT},
-  {44634u, property::type::LVT},
-  {44635u, property::type::LVT},
-  {44636u, property::type::LVT},
-  {44637u, property::type::LVT},
-  {44638u, property::type::LVT},
-  {44639u, property::type::LVT},
-  {44640u, property::type::LVT},
-  {44641u, property::type::LVT},
-  {44642u, property::type::LVT},
-  {44643u, property::type::LVT},
-  {44644u, property::type::LVT},
-  {44645u, property::type::LVT},
-  {44646u, property::type::LVT},
-  {44647u, property::type::LVT},
-  {44649u, property::type::LVT},
-  {44650u, property::type::LVT},
-  {44651u, property::type::LVT},
-  {44652u, property::type::LVT},
-  {44653u, property::type::LVT},
-  {44654u, property::type::LVT},
-  {44655u, property::type::LVT},
-  {44656u, property::type::LVT},
-  {44657u, property::type::LVT},
-  {44658u, property::type::LVT},
-  {44659u, property::type::LVT},
-  {44660u, property::type::LVT},
-  {44661u, property::type::LVT},
-  {44662u, property::type::LVT},
-  {44663u, property::type::LVT},
-  {44664u, property::type::LVT},
-  {44665u, property::type::LVT},
-  {44666u, property::type::LVT},
-  {44667u, property::type::LVT},
-  {44668u, property::type::LVT},
-  {44669u, property::type::LVT},
-  {44670u, property::type::LVT},
-  {44671u, property::type::LVT},
-  {44672u, property::type::LVT},
-  {44673u, property::type::LVT},
-  {44674u, property::type::LVT},
-  {44675u, property::type::LVT},
-  {44677u, property::type::LVT},
-  {44678u, property::type::LVT},
-  {44679u, property::type::LVT},
-  {44680u, property::type::LVT},
-  {44681u, property::type::LVT},
-  {44682u, property::type::LVT},
-  {44683u, property::type::LVT},
-  {44684u, property::type::LVT},
-  {44685u, property::type::LVT},
-  {44686u, property::type::LVT},
-  {44687u, property::type::LVT},
-  {44688u, property::type::LVT},
-  {44689u, property::type::LVT},
-  {44690u, property::type::LVT},
-  {44691u, property::type::LVT},
-  {44692u, property::type::LVT},
-  {44693u, property::type::LVT},
-  {44694u, property::type::LVT},
-  {44695u, property::type::LVT},
-  {44696u, property::type::LVT},
-  {44697u, property::type::LVT},
-  {44698u, property::type::LVT},
-  {44699u, property::type::LVT},
-  {44700u, property::type::LVT},
-  {44701u, property::type::LVT},
-  {44702u, property::type::LVT},
-  {44703u, property::type::LVT},
-  {44705u, property::type::LVT},
-  {44706u, property::type::LVT},
-  {44707u, property::type::LVT},
-  {44708u, property::type::LVT},
-  {44709u, property::type::LVT},
-  {44710u, property::type::LVT},
-  {44711u, property::type::LVT},
-  {44712u, property::type::LVT},
-  {44713u, property::type::LVT},
-  {44714u, property::type::LVT},
-  {44715u, property::type::LVT},
-  {44716u, property::type::LVT},
-  {44717u, property::type::LVT},
-  {44718u, property::type::LVT},
-  {44719u, property::type::LVT},
-  {44720u, property::type::LVT},
-  {44721u, property::type::LVT},
-  {44722u, property::type::LVT},
-  {44723u, property::type::LVT},
-  {44724u, property::type::LVT},
-  {44725u, property::type::LVT},
-  {44726u, property::type::LVT},
-  {44727u, property::type::LVT},
-  {44728u, property::type::LVT},
-  {44729u, property::type::LVT},
-  {44730u, property::type::LVT},
-  {44731u, property::type::LVT},
-  {44733u, property::type::LVT},
-  {44734u, property::type::LVT},
-  {44735u, property::type::LVT},
-  {44736u, property::type::LVT},
-  {44737u, property::type::LVT},
-  {44738u, property::type::LVT},
-  {44739u, property::type::LVT},
-  {44740u, property::type::LVT},
-  {44741u, property::type::LVT},
-  {44742u, property::type::LVT},
-  {44743u, property::type::LVT},
-  {44744u, property::type::LVT},
-  {44745u, property::type::LVT},
-  {44746u, property::type::LVT},
-  {44747u, property::type::LVT},
-  {44748u, property::type::LVT},
-  {44749u, property::type::LVT},
-  {44750u, property::type::LVT},
-  {44751u, property::type::LVT},
-  {44752u, property::type::LVT},
-  {44753u, property::type::LVT},
-  {44754u, property::type::LVT},
-  {44755u, property::type::LVT},
-  {44756u, property::type::LVT},
-  {44757u, property::type::LVT},
-  {44758u, property::type::LVT},
-  {44759u, property::type::LVT},
-  {44761u, property::type::LVT},
-  {44762u, property::type::LVT},
-  {44763u, property::type::LVT},
-  {44764u, property::type::LVT},
-  {44765u, property::type::LVT},
-  {44766u, property::type::LVT},
-  {44767u, property::type::LVT},
-  {44768u, property::type::LVT},
-  {44769u, property::type::LVT},
-  {44770u, property::type::LVT},
-  {44771u, property::type::LVT},
-  {44772u, property::type::LVT},
-  {44773u, property::type::LVT},
-  {44774u, property::type::LVT},
-  {44775u, property::type::LVT},
-  {44776u, property::type::LVT},
-  {44777u, property::type::LVT},
-  {44778u, property::type::LVT},
-  {44779u, property::type::LVT},
-  {44780u, property::type::LVT},
-  {44781u, property::type::LVT},
-  {44782u, property::type::LVT},
-  {44783u, property::type::LVT},
-  {44784u, property::type::LVT},
-  {44785u, property::type::LVT},
-  {44786u, property::type::LVT},
-  {44787u, property::type::LVT},
-  {44789u, property::type::LVT},
-  {44790u, property::type::LVT},
-  {44791u, property::type::LVT},
-  {44792u, property::type::LVT},
-  {44793u, property::type::LVT},
-  {44794u, property::type::LVT},
-  {44795u, property::type::LVT},
-  {44796u, property::type::LVT},
-  {44797u, property::type::LVT},
-  {44798u, property::type::LVT},
-  {44799u, property::type::LVT},
-  {44800u, property::type::LVT},
-  {44801u, property::type::LVT},
-  {44802u, property::type::LVT},
-  {44803u, property::type::LVT},
-  {44804u, property::type::LVT},
-  {44805u, property::type::LVT},
-  {44806u, property::type::LVT},
-  {44807u, property::type::LVT},
-  {44808u, property::type::LVT},
-  {44809u, property::type::LVT},
-  {44810u, property::type::LVT},
-  {44811u, property::type::LVT},
-  {44812u, property::type::LVT},
-  {44813u, property::type::LVT},
-  {44814u, property::type::LVT},
-  {44815u, property::type::LVT},
-  {44817u, property::type::LVT},
-  {44818u, property::type::LVT},
-  {44819u, property::type::LVT},
-  {44820u, property::type::LVT},
-  {44821u, property::type::LVT},
-  {44822u, property::type::LVT},
-  {44823u, property::type::LVT},
-  {44824u, property::type::LVT},
-  {44825u, property::type::LVT},
-  {44826u, property::type::LVT},
-  {44827u, property::type::LVT},
-  {44828u, property::type::LVT},
-  {44829u, property::type::LVT},
-  {44830u, property::type::LVT},
-  {44831u, property::type::LVT},
-  {44832u, property::type::LVT},
-  {44833u, property::type::LVT},
-  {44834u, property::type::LVT},
-  {44835u, property::type::LVT},
-  {44836u, property::type::LVT},
-  {44837u, property::type::LVT},
-  {44838u, property::type::LVT},
-  {44839u, property::type::LVT},
-  {44840u, property::type::LVT},
-  {44841u, property::type::LVT},
-  {44842u, property::type::LVT},
-  {44843u, property::type::LVT},
-  {44845u, property::type::LVT},
-  {44846u, property::type::LVT},
-  {44847u, property::type::LVT},
-  {44848u, property::type::LVT},
-  {44849u, property::type::LVT},
-  {44850u, property::type::LVT},
-  {44851u, property::type::LVT},
-  {44852u, property::type::LVT},
-  {44853u, property::type::LVT},
-  {44854u, property::type::LVT},
-  {44855u, property::type::LVT},
-  {44856u, property::type::LVT},
-  {44857u, property::type::LVT},
-  {44858u, property::type::LVT},
-  {44859u, property::type::LVT},
-  {44860u, property::type::LVT},
-  {44861u, property::type::LVT},
-  {44862u, property::type::LVT},
-  {44863u, property::type::LVT},
-  {44864u, property::type::LVT},
-  {44865u, property::type::LVT},
-  {44866u, property::type::LVT},
-  {44867u, property::type::LVT},
-  {44868u, property::type::LVT},
-  {44869u, property::type::LVT},
-  {44870u, property::type::LVT},
-  {44871u, property::type::LVT},
-  {44873u, property::type::LVT},
-  {44874u, property::type::LVT},
-  {44875u, property::type::LVT},
-  {44876u, property::type::LVT},
-  {44877u, property::type::LVT},
-  {44878u, property::type::LVT},
-  {44879u, property::type::LVT},
-  {44880u, property::type::LVT},
-  {44881u, property::type::LVT},
-  {44882u, property::type::LVT},
-  {44883u, property::type::LVT},
-  {44884u, property::type::LVT},
-  {44885u, property::type::LVT},
-  {44886u, property::type::LVT},
-  {44887u, property::type::LVT},
-  {44888u, property::type::LVT},
-  {44889u, property::type::LVT},
-  {44890u, property::type::LVT},
-  {44891u, property::type::LVT},
-  {44892u, property::type::LVT},
-  {44893u, property::type::LVT},
-  {44894u, property::type::LVT},
-  {44895u, property::type::LVT},
-  {44896u, property::type::LVT},
-  {44897u, property::type::LVT},
-  {44898u, property::type::LVT},
-  {44899u, property::type::LVT},
-  {44901u, property::type::LVT},
-  {44902u, property::type::LVT},
-  {44903u, property::type::LVT},
-  {44904u, property::type::LVT},
-  {44905u, property::type::LVT},
-  {44906u, property::type::LVT},
-  {44907u, property::type::LVT},
-  {44908u, property::type::LVT},
-  {44909u, property::type::LVT},
-  {44910u, property::type::LVT},
-  {44911u, property::type::LVT},
-  {44912u, property::type::LVT},
-  {44913u, property::type::LVT},
-  {44914u, property::type::LVT},
-  {44915u, property::type::LVT},
-  {44916u, property::type::LVT},
-  {44917u, property::type::LVT},
-  {44918u, property::type::LVT},
-  {44919u, property::type::LVT},
-  {44920u, property::type::LVT},
-  {44921u, property::type::LVT},
-  {44922u, property::type::LVT},
-  {44923u, property::type::LVT},
-  {44924u, property::type::LVT},
-  {44925u, property::type::LVT},
-  {44926u, property::type::LVT},
-  {44927u, property::type::LVT},
-  {44929u, property::type::LVT},
-  {44930u, property::type::LVT},
-  {44931u, property::type::LVT},
-  {44932u, property::type::LVT},
-  {44933u, property::type::LVT},
-  {44934u, property::type::LVT},
-  {44935u, property::type::LVT},
-  {44936u, property::type::LVT},
-  {44937u, property::type::LVT},
-  {44938u, property::type::LVT},
-  {44939u, property::type::LVT},
-  {44940u, property::type::LVT},
-  {44941u, property::type::LVT},
-  {44942u, property::type::LVT},
-  {44943u, property::type::LVT},
-  {44944u, property::type::LVT},
-  {44945u, property::type::LVT},
-  {44946u, property::type::LVT},
-  {44947u, property::type::LVT},
-  {44948u, property::type::LVT},
-  {44949u, property::type::LVT},
-  {44950u, property::type::LVT},
-  {44951u, property::type::LVT},
-  {44952u, property::type::LVT},
-  {44953u, property::type::LVT},
-  {44954u, property::type::LVT},
-  {44955u, property::type::LVT},
-  {44957u, property::type::LVT},
-  {44958u, property::type::LVT},
-  {44959u, property::type::LVT},
-  {44960u, property::type::LVT},
-  {44961u, property::type::LVT},
-  {44962u, property::type::LVT},
-  {44963u, property::type::LVT},
-  {44964u, property::type::LVT},
-  {44965u, property::type::LVT},
-  {44966u, property::type::LVT},
-  {44967u, property::type::LVT},
-  {44968u, property::type::LVT},
-  {44969u, property::type::LVT},
-  {44970u, property::type::LVT},
-  {44971u, property::type::LVT},
-  {44972u, property::type::LVT},
-  {44973u, property::type::LVT},
-  {44974u, property::type::LVT},
-  {44975u, property::type::LVT},
-  {44976u, property::type::LVT},
-  {44977u, property::type::LVT},
-  {44978u, property::type::LVT},
-  {44979u, property::type::LVT},
-  {44980u, property::type::LVT},
-  {44981u, property::type::LVT},
-  {44982u, property::type::LVT},
-  {44983u, property::type::LVT},
-  {44985u, property::type::LVT},
-  {44986u, property::type::LVT},
-  {44987u, property::type::LVT},
-  {44988u, property::type::LVT},
-  {44989u, property::type::LVT},
-  {44990u, property::type::LVT},
-  {44991u, property::type::LVT},
-  {44992u, property::type::LVT},
-  {44993u, property::type::LVT},
-  {44994u, property::type::LVT},
-  {44995u, property::type::LVT},
-  {44996u, property::type::LVT},
-  {44997u, property::type::LVT},
-  {44998u, property::type::LVT},
-  {44999u, property::type::LVT},
-  {45000u, property::type::LVT},
-  {45001u, property::type::LVT},
-  {45002u, property::type::LVT},
-  {45003u, property::type::LVT},
-  {45004u, property::type::LVT},
-  {45005u, property::type::LVT},
-  {45006u, property::type::LVT},
-  {45007u, property::type::LVT},
-  {45008u, property::type::LVT},
-  {45009u, property::type::LVT},
-  {45010u, property::type::LVT},
-  {45011u, property::type::LVT},
-  {45013u, property::type::LVT},
-  {45014u, property::type::LVT},
-  {45015u, property::type::LVT},
-  {45016u, property::type::LVT},
-  {45017u, property::type::LVT},
-  {45018u, property::type::LVT},
-  {45019u, property::type::LVT},
-  {45020u, property::type::LVT},
-  {45021u, property::type::LVT},
-  {45022u, property::type::LVT},
-  {45023u, property::type::LVT},
-  {45024u, property::type::LVT},
-  {45025u, property::type::LVT},
-  {45026u, property::type::LVT},
-  {45027u, property::type::LVT},
-  {45028u, property::type::LVT},
-  {45029u, property::type::LVT},
-  {45030u, property::type::LVT},
-  {45031u, property::type::LVT},
-  {45032u, property::type::LVT},
-  {45033u, property::type::LVT},
-  {45034u, property::type::LVT},
-  {45035u, property::type::LVT},
-  {45036u, property::type::LVT},
-  {45037u, property::type::LVT},
-  {45038u, property::type::LVT},
-  {45039u, property::type::LVT},
-  {45041u, property::type::LVT},
-  {45042u, property::type::LVT},
-  {45043u, property::type::LVT},
-  {45044u, property::type::LVT},
-  {45045u, property::type::LVT},
-  {45046u, property::type::LVT},
-  {45047u, property::type::LVT},
-  {45048u, property::type::LVT},
-  {45049u, property::type::LVT},
-  {45050u, property::type::LVT},
-  {45051u, property::type::LVT},
-  {45052u, property::type::LVT},
-  {45053u, property::type::LVT},
-  {45054u, property::type::LVT},
-  {45055u, property::type::LVT},
-  {45056u, property::type::LVT},
-  {45057u, property::type::LVT},
-  {45058u, property::type::LVT},
-  {45059u, property::type::LVT},
-  {45060u, property::type::LVT},
-  {45061u, property::type::LVT},
-  {45062u, property::type::LVT},
-  {45063u, property::type::LVT},
-  {45064u, property::type::LVT},
-  {45065u, property::type::LVT},
-  {45066u, property::type::LVT},
-  {45067u, property::type::LVT},
-  {45069u, property::type::LVT},
-  {45070u, property::type::LVT},
-  {45071u, property::type::LVT},
-  {45072u, property::type::LVT},
-  {45073u, property::type::LVT},
-  {45074u, property::type::LVT},
-  {45075u, property::type::LVT},
-  {45076u, property::type::LVT},
-  {45077u, property::type::LVT},
-  {45078u, property::type::LVT},
-  {45079u, property::type::LVT},
-  {45080u, property::type::LVT},
-  {45081u, property::type::LVT},
-  {45082u, property::type::LVT},
-  {45083u, property::type::LVT},
-  {45084u, property::type::LVT},
-  {45085u, property::type::LVT},
-  {45086u, property::type::LVT},
-  {45087u, property::type::LVT},
-  {45088u, property::type::LVT},
-  {45089u, property::type::LVT},
-  {45090u, property::type::LVT},
-  {45091u, property::type::LVT},
-  {45092u, property::type::LVT},
-  {45093u, property::type::LVT},
-  {45094u, property::type::LVT},
-  {45095u, property::type::LVT},
-  {45097u, property::type::LVT},
-  {45098u, property::type::LVT},
-  {45099u, property::type::LVT},
-  {45100u, property::type::LVT},
-  {45101u, property::type::LVT},
-  {45102u, property::type::LVT},
-  {45103u, property::type::LVT},
-  {45104u, property::type::LVT},
-  {45105u, property::type::LVT},
-  {45106u, property::type::LVT},
-  {45107u, property::type::LVT},
-  {45108u, property::type::LVT},
-  {45109u, property::type::LVT},
-  {45110u, property::type::LVT},
-  {45111u, property::type::LVT},
-  {45112u, property::type::LVT},
-  {45113u, property::type::LVT},
-  {45114u, property::type::LVT},
-  {45115u, property::type::LVT},
-  {45116u, property::type::LVT},
-  {45117u, property::type::LVT},
-  {45118u, property::type::LVT},
-  {45119u, property::type::LVT},
-  {45120u, property::type::LVT},
-  {45121u, property::type::LVT},
-  {45122u, property::type::LVT},
-  {45123u, property::type::LVT},
-  {45125u, property::type::LVT},
-  {45126u, property::type::LVT},
-  {45127u, property::type::LVT},
-  {45128u, property::type::LVT},
-  {45129u, property::type::LVT},
-  {45130u, property::type::LVT},
-  {45131u, property::type::LVT},
-  {45132u, property::type::LVT},
-  {45133u, property::type::LVT},
-  {45134u, property::type::LVT},
-  {45135u, property::type::LVT},
-  {45136u, property::type::LVT},
-  {45137u, property::type::LVT},
-  {45138u, property::type::LVT},
-  {45139u, property::type::LVT},
-  {45140u, property::type::LVT},
-  {45141u, property::type::LVT},
-  {45142u, property::type::LVT},
-  {45143u, property::type::LVT},
-  {45144u, property::type::LVT},
-  {45145u, property::type::LVT},
-  {45146u, property::type::LVT},
-  {45147u, property::type::LVT},
-  {45148u, property::type::LVT},
-  {45149u, property::type::LVT},
-  {45150u, property::type::LVT},
-  {45151u, property::type::LVT},
-  {45153u, property::type::LVT},
-  {45154u, property::type::LVT},
-  {45155u, property::type::LVT},
-  {45156u, property::type::LVT},
-  {45157u, property::type::LVT},
-  {45158u, property::type::LVT},
-  {45159u, property::type::LVT},
-  {45160u, property::type::LVT},
-  {45161u, property::type::LVT},
-  {45162u, property::type::LVT},
-  {45163u, property::type::LVT},
-  {45164u, property::type::LVT},
-  {45165u, property::type::LVT},
-  {45166u, property::type::LVT},
-  {45167u, property::type::LVT},
-  {45168u, property::type::LVT},
-  {45169u, property::type::LVT},
-  {45170u, property::type::LVT},
-  {45171u, property::type::LVT},
-  {45172u, property::type::LVT},
-  {45173u, property::type::LVT},
-  {45174u, property::type::LVT},
-  {45175u, property::type::LVT},
-  {45176u, property::type::LVT},
-  {45177u, property::type::LVT},
-  {45178u, property::type::LVT},
-  {45179u, property::type::LVT},
-  {45181u, property::type::LVT},
-  {45182u, property::type::LVT},
-  {45183u, property::type::LVT},
-  {45184u, property::type::LVT},
-  {45185u, property::type::LVT},
-  {45186u, property::type::LVT},
-  {45187u, property::type::LVT},
-  {45188u, property::type::LVT},
-  {45189u, property::type::LVT},
-  {45190u, property::type::LVT},
-  {45191u, property::type::LVT},
-  {45192u, property::type::LVT},
-  {45193u, property::type::LVT},
-  {45194u, property::type::LVT},
-  {45195u, property::type::LVT},
-  {45196u, property::type::LVT},
-  {45197u, property::type::LVT},
-  {45198u, property::type::LVT},
-  {45199u, property::type::LVT},
-  {45200u, property::type::LVT},
-  {45201u, property::type::LVT},
-  {45202u, property::type::LVT},
-  {45203u, property::type::LVT},
-  {45204u, property::type::LVT},
-  {45205u, property::type::LVT},
-  {45206u, property::type::LVT},
-  {45207u, property::type::LVT},
-  {45209u, property::type::LVT},
-  {45210u, property::type::LVT},
-  {45211u, property::type::LVT},
-  {45212u, property::type::LVT},
-  {45213u, property::type::LVT},
-  {45214u, property::type::LVT},
-  {45215u, property::type::LVT},
-  {45216u, property::type::LVT},
-  {45217u, property::type::LVT},
-  {45218u, property::type::LVT},
-  {45219u, property::type::LVT},
-  {45220u, property::type::LVT},
-  {45221u, property::type::LVT},
-  {45222u, property::type::LVT},
-  {45223u, property::type::LVT},
-  {45224u, property::type::LVT},
-  {45225u, property::type::LVT},
-  {45226u, property::type::LVT},
-  {45227u, property::type::LVT},
-  {45228u, property::type::LVT},
-  {45229u, property::type::LVT},
-  {45230u, property::type::LVT},
-  {45231u, property::type::LVT},
-  {45232u, property::type::LVT},
-  {45233u, property::type::LVT},
-  {45234u, property::type::LVT},
-  {45235u, property::type::LVT},
-  {45237u, property::type::LVT},
-  {45238u, property::type::LVT},
-  {45239u, property::type::LVT},
-  {45240u, property::type::LVT},
-  {45241u, property::type::LVT},
-  {45242u, property::type::LVT},
-  {45243u, property::type::LVT},
-  {45244u, property::type::LVT},
-  {45245u, property::type::LVT},
-  {45246u, property::type::LVT},
-  {45247u, property::type::LVT},
-  {45248u, property::type::LVT},
-  {45249u, property::type::LVT},
-  {45250u, property::type::LVT},
-  {45251u, property::type::LVT},
-  {45252u, property::type::LVT},
-  {45253u, property::type::LVT},
-  {45254u, property::type::LVT},
-  {45255u, property::type::LVT},
-  {45256u, property::type::LVT},
-  {45257u, property::type::LVT},
-  {45258u, property::type::LVT},
-  {45259u, property::type::LVT},
-  {45260u, property::type::LVT},
-  {45261u, property::type::LVT},
-  {45262u, property::type::LVT},
-  {45263u, property::type::LVT},
-  {45265u, property::type::LVT},
-  {45266u, property::type::LVT},
-  {45267u, property::type::LVT},
-  {45268u, property::type::LVT},
-  {45269u, property::type::LVT},
-  {45270u, property::type::LVT},
-  {45271u, property::type::LVT},
-  {45272u, property::type::LVT},
-  {45273u, property::type::LVT},
-  {45274u, property::type::LVT},
-  {45275u, property::type::LVT},
-  {45276u, property::type::LVT},
-  {45277u, property::type::LVT},
-  {45278u, property::type::LVT},
-  {45279u, property::type::LVT},
-  {45280u, property::type::LVT},
-  {45281u, property::type::LVT},
-  {45282u, property::type::LVT},
-  {45283u, property::type::LVT},
-  {45284u, property::type::LVT},
-  {45285u, property::type::LVT},
-  {45286u, property::type::LVT},
-  {45287u, property::type::LVT},
-  {45288u, property::type::LVT},
-  {45289u, property::type::LVT},
-  {45290u, property::type::LVT},
-  {45291u, property::type::LVT},
-  {45293u, property::type::LVT},
-  {45294u, property::type::LVT},
-  {45295u, property::type::LVT},
-  {45296u, property::type::LVT},
-  {45297u, property::type::LVT},
-  {45298u, property::type::LVT},
-  {45299u, property::type::LVT},
-  {45300u, property::type::LVT},
-  {45301u, property::type::LVT},
-  {45302u, property::type::LVT},
-  {45303u, property::type::LVT},
-  {45304u, property::type::LVT},
-  {45305u, property::type::LVT},
-  {45306u, property::type::LVT},
-  {45307u, property::type::LVT},
-  {45308u, property::type::LVT},
-  {45309u, property::type::LVT},
-  {45310u, property::type::LVT},
-  {45311u, property::type::LVT},
-  {45312u, property::type::LVT},
-  {45313u, property::type::LVT},
-  {45314u, property::type::LVT},
-  {45315u, property::type::LVT},
-  {45316u, property::type::LVT},
-  {45317u, property::type::LVT},
-  {45318u, property::type::LVT},
-  {45319u, property::type::LVT},
-  {45321u, property::type::LVT},
-  {45322u, property::type::LVT},
-  {45323u, property::type::LVT},
-  {45324u, property::type::LVT},
-  {45325u, property::type::LVT},
-  {45326u, property::type::LVT},
-  {45327u, property::type::LVT},
-  {45328u, property::type::LVT},
-  {45329u, property::type::LVT},
-  {45330u, property::type::LVT},
-  {45331u, property::type::LVT},
-  {45332u, property::type::LVT},
-  {45333u, property::type::LVT},
-  {45334u, property::type::LVT},
-  {45335u, property::type::LVT},
-  {45336u, property::type::LVT},
-  {45337u, property::type::LVT},
-  {45338u, property::type::LVT},
-  {45339u, property::type::LVT},
-  {45340u, property::type::LVT},
-  {45341u, property::type::LVT},
-  {45342u, property::type::LVT},
-  {45343u, property::type::LVT},
-  {45344u, property::type::LVT},
-  {45345u, property::type::LVT},
-  {45346u, property::type::LVT},
-  {45347u, property::type::LVT},
-  {45349u, property::type::LVT},
-  {45350u, property::type::LVT},
-  {45351u, property::type::LVT},
-  {45352u, property::type::LVT},
-  {45353u, property::type::LVT},
-  {45354u, property::type::LVT},
-  {45355u, property::type::LVT},
-  {45356u, property::type::LVT},
-  {45357u, property::type::LVT},
-  {45358u, property::type::LVT},
-  {45359u, property::type::LVT},
-  {45360u, property::type::LVT},
-  {45361u, property::type::LVT},
-  {45362u, property::type::LVT},
-  {45363u, property::type::LVT},
-  {45364u, property::type::LVT},
-  {45365u, property::type::LVT},
-  {45366u, property::type::LVT},
-  {45367u, property::type::LVT},
-  {45368u, property::type::LVT},
-  {45369u, property::type::LVT},
-  {45370u, property::type::LVT},
-  {45371u, property::type::LVT},
-  {45372u, property::type::LVT},
-  {45373u, property::type::LVT},
-  {45374u, property::type::LVT},
-  {45375u, property::type::LVT},
-  {45377u, property::type::LVT},
-  {45378u, property::type::LVT},
-  {45379u, property::type::LVT},
-  {45380u, property::type::LVT},
-  {45381u, property::type::LVT},
-  {45382u, property::type::LVT},
-  {45383u, property::type::LVT},
-  {45384u, property::type::LVT},
-  {45385u, property::type::LVT},
-  {45386u, property::type::LVT},
-  {45387u, property::type::LVT},
-  {45388u, property::type::LVT},
-  {45389u, property::type::LVT},
-  {45390u, property::type::LVT},
-  {45391u, property::type::LVT},
-  {45392u, property::type::LVT},
-  {45393u, property::type::LVT},
-  {45394u, property::type::LVT},
-  {45395u, property::type::LVT},
-  {45396u, property::type::LVT},
-  {45397u, property::type::LVT},
-  {45398u, property::type::LVT},
-  {45399u, property::type::LVT},
-  {45400u, property::type::LVT},
-  {45401u, property::type::LVT},
-  {45402u, property::type::LVT},
-  {45403u, property::type::LVT},
-  {45405u, property::type::LVT},
-  {45406u, property::type::LVT},
-  {45407u, property::type::LVT},
-  {45408u, property::type::LVT},
-  {45409u, property::type::LVT},
-  {45410u, property::type::LVT},
-  {45411u, property::type::LVT},
-  {45412u, property::type::LVT},
-  {45413u, property::type::LVT},
-  {45414u, property::type::LVT},
-  {45415u, property::type::LVT},
-  {45416u, property::type::LVT},
-  {45417u, property::type::LVT},
-  {45418u, property::type::LVT},
-  {45419u, property::type::LVT},
-  {45420u, property::type::LVT},
-  {45421u, property::type::LVT},
-  {45422u, property::type::LVT},
-  {45423u, property::type::LVT},
-  {45424u, property::type::LVT},
-  {45425u, property::type::LVT},
-  {45426u, property::type::LVT},
-  {45427u, property::type::LVT},
-  {45428u, property::type::LVT},
-  {45429u, property::type::LVT},
-  {45430u, property::type::LVT},
-  {45431u, property::type::LVT},
-  {45433u, property::type::LVT},
-  {45434u, property::type::LVT},
-  {45435u, property::type::LVT},
-  {45436u, property::type::LVT},
-  {45437u, property::type::LVT},
-  {45438u, property::type::LVT},
-  {45439u, property::type::LVT},
-  {45440u, property::type::LVT},
-  {45441u, property::type::LVT},
-  {45442u, property::type::LVT},
-  {45443u, property::type::LVT},
-  {45444u, property::type::LVT},
-  {45445u, property::type::LVT},
-  {45446u, property::type::LVT},
-  {45447u, property::type::LVT},
-  {45448u, property::type::LVT},
-  {45449u, property::type::LVT},
-  {45450u, property::type::LVT},
-  {45451u, property::type::LVT},
-  {45452u, property::type::LVT},
-  {45453u, property::type::LVT},
-  {45454u, property::type::LVT},
-  {45455u, property::type::LVT},
-  {45456u, property::type::LVT},
-  {45457u, property::type::LVT},
-  {45458u, property::type::LVT},
-  {45459u, property::type::LVT},
-  {45461u, property::type::LVT},
-  {45462u, property::type::LVT},
-  {45463u, property::type::LVT},
-  {45464u, property::type::LVT},
-  {45465u, property::type::LVT},
-  {45466u, property::type::LVT},
-  {45467u, property::type::LVT},
-  {45468u, property::type::LVT},
-  {45469u, property::type::LVT},
-  {45470u, property::type::LVT},
-  {45471u, property::type::LVT},
-  {45472u, property::type::LVT},
-  {45473u, property::type::LVT},
-  {45474u, property::type::LVT},
-  {45475u, property::type::LVT},
-  {45476u, property::type::LVT},
-  {45477u, property::type::LVT},
-  {45478u, property::type::LVT},
-  {45479u, property::type::LVT},
-  {45480u, property::type::LVT},
-  {45481u, property::type::LVT},
-  {45482u, property::type::LVT},
-  {45483u, property::type::LVT},
-  {45484u, property::type::LVT},
-  {45485u, property::type::LVT},
-  {45486u, property::type::LVT},
-  {45487u, property::type::LVT},
-  {45489u, property::type::LVT},
-  {45490u, property::type::LVT},
-  {45491u, property::type::LVT},
-  {45492u, property::type::LVT},
-  {45493u, property::type::LVT},
-  {45494u, property::type::LVT},
-  {45495u, property::type::LVT},
-  {45496u, property::type::LVT},
-  {45497u, property::type::LVT},
-  {45498u, property::type::LVT},
-  {45499u, property::type::LVT},
-  {45500u, property::type::LVT},
-  {45501u, property::type::LVT},
-  {45502u, property::type::LVT},
-  {45503u, property::type::LVT},
-  {45504u, property::type::LVT},
-  {45505u, property::type::LVT},
-  {45506u, property::type::LVT},
-  {45507u, property::type::LVT},
-  {45508u, property::type::LVT},
-  {45509u, property::type::LVT},
-  {45510u, property::type::LVT},
-  {45511u, property::type::LVT},
-  {45512u, property::type::LVT},
-  {45513u, property::type::LVT},
-  {45514u, property::type::LVT},
-  {45515u, property::type::LVT},
-  {45517u, property::type::LVT},
-  {45518u, property::type::LVT},
-  {45519u, property::type::LVT},
-  {45520u, property::type::LVT},
-  {45521u, property::type::LVT},
-  {45522u, property::type::LVT},
-  {45523u, property::type::LVT},
-  {45524u, property::type::LVT},
-  {45525u, property::type::LVT},
-  {45526u, property::type::LVT},
-  {45527u, property::type::LVT},
-  {45528u, property::type::LVT},
-  {45529u, property::type::LVT},
-  {45530u, property::type::LVT},
-  {45531u, property::type::LVT},
-  {45532u, property::type::LVT},
-  {45533u, property::type::LVT},
-  {45534u, property::type::LVT},
-  {45535u, property::type::LVT},
-  {45536u, property::type::LVT},
-  {45537u, property::type::LVT},
-  {45538u, property::type::LVT},
-  {45539u, property::type::LVT},
-  {45540u, property::type::LVT},
-  {45541u, property::type::LVT},
-  {45542u, property::type::LVT},
-  {45543u, property::type::LVT},
-  {45545u, property::type::LVT},
-  {45546u, property::type::LVT},
-  {45547u, property::type::LVT},
-  {45548u, property::type::LVT},
-  {45549u, property::type::LVT},
-  {45550u, property::type::LVT},
-  {45551u, property::type::LVT},
-  {45552u, property::type::LVT},
-  {45553u, property::type::LVT},
-  {45554u, property::type::LVT},
-  {45555u, property::type::LVT},
-  {45556u, property::type::LVT},
-  {45557u, property::type::LVT},
-  {45558u, property::type::LVT},
-  {45559u, property::type::LVT},
-  {45560u, property::type::LVT},
-  {45561u, property::type::LVT},
-  {45562u, property::type::LVT},
-  {45563u, property::type::LVT},
-  {45564u, property::type::LVT},
-  {45565u, property::type::LVT},
-  {45566u, property::type::LVT},
-  {45567u, property::type::LVT},
-  {45568u, property::type::LVT},
-  {45569u, property::type::LVT},
-  {45570u, property::type::LVT},
-  {45571u, property::type::LVT},
-  {45573u, property::type::LVT},
-  {45574u, property::type::LVT},
-  {45575u, property::type::LVT},
-  {45576u, property::type::LVT},
-  {45577u, property::type::LVT},
-  {45578u, property::type::LVT},
-  {45579u, property::type::LVT},
-  {45580u, property::type::LVT},
-  {45581u, property::type::LVT},
-  {45582u, property::type::LVT},
-  {45583u, property::type::LVT},
-  {45584u, property::type::LVT},
-  {45585u, property::type::LVT},
-  {45586u, property::type::LVT},
-  {45587u, property::type::LVT},
-  {45588u, property::type::LVT},
-  {45589u, property::type::LVT},
-  {45590u, property::type::LVT},
-  {45591u, property::type::LVT},
-  {45592u, property::type::LVT},
-  {45593u, property::type::LVT},
-  {45594u, property::type::LVT},
-  {45595u, property::type::LVT},
-  {45596u, property::type::LVT},
-  {45597u, property::type::LVT},
-  {45598u, property::type::LVT},
-  {45599u, property::type::LVT},
-  {45601u, property::type::LVT},
-  {45602u, property::type::LVT},
-  {45603u, property::type::LVT},
-  {45604u, property::type::LVT},
-  {45605u, property::type::LVT},
-  {45606u, property::type::LVT},
-  {45607u, property::type::LVT},
-  {45608u, property::type::LVT},
-  {45609u, property::type::LVT},
-  {45610u, property::type::LVT},
-  {45611u, property::type::LVT},
-  {45612u, property::type::LVT},
-  {45613u, property::type::LVT},
-  {45614u, property::type::LVT},
-  {45615u, property::type::LVT},
-  {45616u, property::type::LVT},
-  {45617u, property::type::LVT},
-  {45618u, property::type::LVT},
-  {45619u, property::type::LVT},
-  {45620u, property::type::LVT},
-  {45621u, property::type::LVT},
-  {45622u, property::type::LVT},
-  {45623u, property::type::LVT},
-  {45624u, property::type::LVT},
-  {45625u, property::type::LVT},
-  {45626u, property::type::LVT},
-  {45627u, property::type::LVT},
-  {45629u, property::type::LVT},
-  {45630u, property::type::LVT},
-  {45631u, property::type::LVT},
-  {45632u, property::type::LVT},
-  {45633u, property::type::LVT},
-  {45634u, property::type::LVT},
-  {45635u, property::type::LVT},
-  {45636u, property::type::LVT},
-  {45637u, property::type::LVT},
-  {45638u, property::type::LVT},
-  {45639u, property::type::LVT},
-  {45640u, property::type::LVT},
-  {45641u, property::type::LVT},
-  {45642u, property::type::LVT},
-  {45643u, property::type::LVT},
-  {45644u, property::type::LVT},
-  {45645u, property::type::LVT},
-  {45646u, property::type::LVT},
-  {45647u, property::type::LVT},
-  {45648u, property::type::LVT},
-  {45649u, property::type::LVT},
-  {45650u, property::type::LVT},
-  {45651u, property::type::LVT},
-  {45652u, property::type::LVT},
-  {45653u, property::type::LVT},
-  {45654u, property::type::LVT},
-  {45655u, property::type::LVT},
-  {45657u, property::type::LVT},
-  {45658u, property::type::LVT},
-  {45659u, property::type::LVT},
-  {45660u, property::type::LVT},
-  {45661u, property::type::LVT},
-  {45662u, property::type::LVT},
-  {45663u, property::type::LVT},
-  {45664u, property::type::LVT},
-  {45665u, property::type::LVT},
-  {45666u, property::type::LVT},
-  {45667u, property::type::LVT},
-  {45668u, property::type::LVT},
-  {45669u, property::type::LVT},
-  {45670u, property::type::LVT},
-  {45671u, property::type::LVT},
-  {45672u, property::type::LVT},
-  {45673u, property::type::LVT},
-  {45674u, property::type::LVT},
-  {45675u, property::type::LVT},
-  {45676u, property::type::LVT},
-  {45677u, property::type::LVT},
-  {45678u, property::type::LVT},
-  {45679u, property::type::LVT},
-  {45680u, property::type::LVT},
-  {45681u, property::type::LVT},
-  {45682u, property::type::LVT},
-  {45683u, property::type::LVT},
-  {45685u, property::type::LVT},
-  {45686u, property::type::LVT},
-  {45687u, property::type::LVT},
-  {45688u, property::type::LVT},
-  {45689u, property::type::LVT},
-  {45690u, property::type::LVT},
-  {45691u, property::type::LVT},
-  {45692u, property::type::LVT},
-  {45693u, property::type::LVT},
-  {45694u, property::type::LVT},
-  {45695u, property::type::LVT},
-  {45696u, property::type::LVT},
-  {45697u, property::type::LVT},
-  {45698u, property::type::LVT},
-  {45699u, property::type::LVT},
-  {45700u, property::type::LVT},
-  {45701u, property::type::LVT},
-  {45702u, property::type::LVT},
-  {45703u, property::type::LVT},
-  {45704u, property::type::LVT},
-  {45705u, property::type::LVT},
-  {45706u, property::type::LVT},
-  {45707u, property::type::LVT},
-  {45708u, property::type::LVT},
-  {45709u, property::type::LVT},
-  {45710u, property::type::LVT},
-  {45711u, property::type::LVT},
-  {45713u, property::type::LVT},
-  {45714u, property::type::LVT},
-  {45715u, property::type::LVT},
-  {45716u, property::type::LVT},
-  {45717u, property::type::LVT},
-  {45718u, property::type::LVT},
-  {45719u, property::type::LVT},
-  {45720u, property::type::LVT},
-  {45721u, property::type::LVT},
-  {45722u, property::type::LVT},
-  {45723u, property::type::LVT},
-  {45724u, property::type::LVT},
-  {45725u, property::type::LVT},
-  {45726u, property::type::LVT},
-  {45727u, property::type::LVT},
-  {45728u, property::type::LVT},
-  {45729u, property::type::LVT},
-  {45730u, property::type::LVT},
-  {45731u, property::type::LVT},
-  {45732u, property::type::LVT},
-  {45733u, property::type::LVT},
-  {45734u, property::type::LVT},
-  {45735u, property::type::LVT},
-  {45736u, property::type::LVT},
-  {45737u, property::type::LVT},
-  {45738u, property::type::LVT},
-  {45739u, property::type::LVT},
-  {45741u, property::type::LVT},
-  {45742u, property::type::LVT},
-  {45743u, property::type::LVT},
-  {45744u, property::type::LVT},
-  {45745u, property::type::LVT},
-  {45746u, property::type::LVT},
-  {45747u, property::type::LVT},
-  {45748u, property::type::LVT},
-  {45749u, property::type::LVT},
-  {45750u, property::type::LVT},
-  {45751u, property::type::LVT},
-  {45752u, property::type::LVT},
-  {45753u, property::type::LVT},
-  {45754u, property::type::LVT},
-  {45755u, property::type::LVT},
-  {45756u, property::type::LVT},
-  {45757u, property::type::LVT},
-  {45758u, property::type::LVT},
-  {45759u, property::type::LVT},
-  {45760u, property::type::LVT},
-  {45761u, property::type::LVT},
-  {45762u, property::type::LVT},
-  {45763u, property::type::LVT},
-  {45764u, property::type::LVT},
-  {45765u, property::type::LVT},
-  {45766u, property::type::LVT},
-  {45767u, property::type::LVT},
-  {45769u, property::type::LVT},
-  {45770u, property::type::LVT},
-  {45771u, property::type::LVT},
-  {45772u, property::type::LVT},
-  {45773u, property::type::LVT},
-  {45774u, property::type::LVT},
-  {45775u, property::type::LVT},
-  {45776u, property::type::LVT},
-  {45777u, property::type::LVT},
-  {45778u, property::type::LVT},
-  {45779u, property::type::LVT},
-  {45780u, property::type::LVT},
-  {45781u, property::type::LVT},
-  {45782u, property::type::LVT},
-  {45783u, property::type::LVT},
-  {45784u, property::type::LVT},
-  {45785u, property::type::LVT},
-  {45786u, property::type::LVT},
-  {45787u, property::type::LVT},
-  {45788u, property::type::LVT},
-  {45789u, property::type::LVT},
-  {45790u, property::type::LVT},
-  {45791u, property::type::LVT},
-  {45792u, property::type::LVT},
-  {45793u, property::type::LVT},
-  {45794u, property::type::LVT},
-  {45795u, property::type::LVT},
-  {45797u, property::type::LVT},
-  {45798u, property::type::LVT},
-  {45799u, property::type::LVT},
-  {45800u, property::type::LVT},
-  {45801u, property::type::LVT},
-  {45802u, property::type::LVT},
-  {45803u, property::type::LVT},
-  {45804u, property::type::LVT},
-  {45805u, property::type::LVT},
-  {45806u, property::type::LVT},
-  {45807u, property::type::LVT},
-  {45808u, property::type::LVT},
-  {45809u, property::type::LVT},
-  {45810u, property::type::LVT},
-  {45811u, property::type::LVT},
-  {45812u, property::type::LVT},
-  {45813u, property::type::LVT},
-  {45814u, property::type::LVT},
-  {45815u, property::type::LVT},
-  {45816u, property::type::LVT},
-  {45817u, property::type::LVT},
-  {45818u, property::type::LVT},
-  {45819u, property::type::LVT},
-  {45820u, property::type::LVT},
-  {45821u, property::type::LVT},
-  {45822u, property::type::LVT},
-  {45823u, property::type::LVT},
-  {45825u, property::type::LVT},
-  {45826u, property::type::LVT},
-  {45827u, property::type::LVT},
-  {45828u, property::type::LVT},
-  {45829u, property::type::LVT},
-  {45830u, property::type::LVT},
-  {45831u, property::type::LVT},
-  {45832u, property::type::LVT},
-  {45833u, property::type::LVT},
-  {45834u, property::type::LVT},
-  {45835u, property::type::LVT},
-  {45836u, property::type::LVT},
-  {45837u, property::type::LVT},
-  {45838u, property::type::LVT},
-  {45839u, property::type::LVT},
-  {45840u, property::type::LVT},
-  {45841u, property::type::LVT},
-  {45842u, property::type::LVT},
-  {45843u, property::type::LVT},
-  {45844u, property::type::LVT},
-  {45845u, property::type::LVT},
-  {45846u, property::type::LVT},
-  {45847u, property::type::LVT},
-  {45848u, property::type::LVT},
-  {45849u, property::type::LVT},
-  {45850u, property::type::LVT},
-  {45851u, property::type::LVT},
-  {45853u, property::type::LVT},
-  {45854u, property::type::LVT},
-  {45855u, property::type::LVT},
-  {45856u, property::type::LVT},
-  {45857u, property::type::LVT},
-  {45858u, property::type::LVT},
-  {45859u, property::type::LVT},
-  {45860u, property::type::LVT},
-  {45861u, property::type::LVT},
-  {45862u, property::type::LVT},
-  {45863u, property::type::LVT},
-  {45864u, property::type::LVT},
-  {45865u, property::type::LVT},
-  {45866u, property::type::LVT},
-  {45867u, property::type::LVT},
-  {45868u, property::type::LVT},
-  {45869u, property::type::LVT},
-  {45870u, property::type::LVT},
-  {45871u, property::type::LVT},
-  {45872u, property::type::LVT},
-  {45873u, property::type::LVT},
-  {45874u, property::type::LVT},
-  {45875u, property::type::LVT},
-  {45876u, property::type::LVT},
-  {45877u, property::type::LVT},
-  {45878u, property::type::LVT},
-  {45879u, property::type::LVT},
-  {45881u, property::type::LVT},
-  {45882u, property::type::LVT},
-  {45883u, property::type::LVT},
-  {45884u, property::type::LVT},
-  {45885u, property::type::LVT},
-  {45886u, property::type::LVT},
-  {45887u, property::type::LVT},
-  {45888u, property::type::LVT},
-  {45889u, property::type::LVT},
-  {45890u, property::type::LVT},
-  {45891u, property::type::LVT},
-  {45892u, property::type::LVT},
-  {45893u, property::type::LVT},
-  {45894u, property::type::LVT},
-  {45895u, property::type::LVT},
-  {45896u, property::type::LVT},
-  {45897u, property::type::LVT},
-  {45898u, property::type::LVT},
-  {45899u, property::type::LVT},
-  {45900u, property::type::LVT},
-  {45901u, property::type::LVT},
-  {45902u, property::type::LVT},
-  {45903u, property::type::LVT},
-  {45904u, property::type::LVT},
-  {45905u, property::type::LVT},
-  {45906u, property::type::LVT},
-  {45907u, property::type::LVT},
-  {45909u, property::type::LVT},
-  {45910u, property::type::LVT},
-  {45911u, property::type::LVT},
-  {45912u, property::type::LVT},
-  {45913u, property::type::LVT},
-  {45914u, property::type::LVT},
-  {45915u, property::type::LVT},
-  {45916u, property::type::LVT},
-  {45917u, property::type::LVT},
-  {45918u, property::type::LVT},
-  {45919u, property::type::LVT},
-  {45920u, property::type::LVT},
-  {45921u, property::type::LVT},
-  {45922u, property::type::LVT},
-  {45923u, property::type::LVT},
-  {45924u, property::type::LVT},
-  {45925u, property::type::LVT},
-  {45926u, property::type::LVT},
-  {45927u, property::type::LVT},
-  {45928u, property::type::LVT},
-  {45929u, property::type::LVT},
-  {45930u, property::type::LVT},
-  {45931u, property::type::LVT},
-  {45932u, property::type::LVT},
-  {45933u, property::type::LVT},
-  {45934u, property::type::LVT},
-  {45935u, property::type::LVT},
-  {45937u, property::type::LVT},
-  {45938u, property::type::LVT},
-  {45939u, property::type::LVT},
-  {45940u, property::type::LVT},
-  {45941u, property::type::LVT},
-  {45942u, property::type::LVT},
-  {45943u, property::type::LVT},
-  {45944u, property::type::LVT},
-  {45945u, property::type::LVT},
-  {45946u, property::type::LVT},
-  {45947u, property::type::LVT},
-  {45948u, property::type::LVT},
-  {45949u, property::type::LVT},
-  {45950u, property::type::LVT},
-  {45951u, property::type::LVT},
-  {45952u, property::type::LVT},
-  {45953u, property::type::LVT},
-  {45954u, property::type::LVT},
-  {45955u, property::type::LVT},
-  {45956u, property::type::LVT},
-  {45957u, property::type::LVT},
-  {45958u, property::type::LVT},
-  {45959u, property::type::LVT},
-  {45960u, property::type::LVT},
-  {45961u, property::type::LVT},
-  {45962u, property::type::LVT},
-  {45963u, property::type::LVT},
-  {45965u, property::type::LVT},
-  {45966u, property::type::LVT},
-  {45967u, property::type::LVT},
-  {45968u, property::type::LVT},
-  {45969u, property::type::LVT},
-  {45970u, property::type::LVT},
-  {45971u, property::type::LVT},
-  {45972u, property::type::LVT},
-  {45973u, property::type::LVT},
-  {45974u, property::type::LVT},
-  {45975u, property::type::LVT},
-  {45976u, property::type::LVT},
-  {45977u, property::type::LVT},
-  {45978u, property::type::LVT},
-  {45979u, property::type::LVT},
-  {45980u, property::type::LVT},
-  {45981u, property::type::LVT},
-  {45982u, property::type::LVT},
-  {45983u, property::type::LVT},
-  {45984u, property::type::LVT},
-  {45985u, property::type::LVT},
-  {45986u, property::type::LVT},
-  {45987u, property::type::LVT},
-  {45988u, property::type::LVT},
-  {45989u, property::type::LVT},
-  {45990u, property::type::LVT},
-  {45991u, property::type::LVT},
-  {45993u, property::type::LVT},
-  {45994u, property::type::LVT},
-  {45995u, property::type::LVT},
-  {45996u, property::type::LVT},
-  {45997u, property::type::LVT},
-  {45998u, property::type::LVT},
-  {45999u, property::type::LVT},
-  {46000u, property::type::LVT},
-  {46001u, property::type::LVT},
-  {46002u, property::type::LVT},
-  {46003u, property::type::LVT},
-  {46004u, property::type::LVT},
-  {46005u, property::type::LVT},
-  {46006u, property::type::LVT},
-  {46007u, property::type::LVT},
-  {46008u, property::type::LVT},
-  {46009u, property::type::LVT},
-  {46010u, property::type::LVT},
-  {46011u, property::type::LVT},
-  {46012u, property::type::LVT},
-  {46013u, property::type::LVT},
-  {46014u, property::type::LVT},
-  {46015u, property::type::LVT},
-  {46016u, property::type::LVT},
-  {46017u, property::type::LVT},
-  {46018u, property::type::LVT},
-  {46019u, property::type::LVT},
-  {46021u, property::type::LVT},
-  {46022u, property::type::LVT},
-  {46023u, property::type::LVT},
-  {46024u, property::type::LVT},
-  {46025u, property::type::LVT},
-  {46026u, property::type::LVT},
-  {46027u, property::type::LVT},
-  {46028u, property::type::LVT},
-  {46029u, property::type::LVT},
-  {46030u, property::type::LVT},
-  {46031u, property::type::LVT},
-  {46032u, property::type::LVT},
-  {46033u, property::type::LVT},
-  {46034u, property::type::LVT},
-  {46035u, property::type::LVT},
-  {46036u, property::type::LVT},
-  {46037u, property::type::LVT},
-  {46038u, property::type::LVT},
-  {46039u, property::type::LVT},
-  {46040u, property::type::LVT},
-  {46041u, property::type::LVT},
-  {46042u, property::type::LVT},
-  {46043u, property::type::LVT},
-  {46044u, property::type::LVT},
-  {46045u, property::type::LVT},
-  {46046u, property::type::LVT},
-  {46047u, property::type::LVT},
-  {46049u, property::type::LVT},
-  {46050u, property::type::LVT},
-  {46051u, property::type::LVT},
-  {46052u, property::type::LVT},
-  {46053u, property::type::LVT},
-  {46054u, property::type::LVT},
-  {46055u, property::type::LVT},
-  {46056u, property::type::LVT},
-  {46057u, property::type::LVT},
-  {46058u, property::type::LVT},
-  {46059u, property::type::LVT},
-  {46060u, property::type::LVT},
-  {46061u, property::type::LVT},
-  {46062u, property::type::LVT},
-  {46063u, property::type::LVT},
-  {46064u, property::type::LVT},
-  {46065u, property::type::LVT},
-  {46066u, property::type::LVT},
-  {46067u, property::type::LVT},
-  {46068u, property::type::LVT},
-  {46069u, property::type::LVT},
-  {46070u, property::type::LVT},
-  {46071u, property::type::LVT},
-  {46072u, property::type::LVT},
-  {46073u, property::type::LVT},
-  {46074u, property::type::LVT},
-  {46075u, property::type::LVT},
-  {46077u, property::type::LVT},
-  {46078u, property::type::LVT},
-  {46079u, property::type::LVT},
-  {46080u, property::type::LVT},
-  {46081u, property::type::LVT},
-  {46082u, property::type::LVT},
-  {46083u, property::type::LVT},
-  {46084u, property::type::LVT},
-  {46085u, property::type::LVT},
-  {46086u, property::type::LVT},
-  {46087u, property::type::LVT},
-  {46088u, property::type::LVT},
-  {46089u, property::type::LVT},
-  {46090u, property::type::LVT},
-  {46091u, property::type::LVT},
-  {46092u, property::type::LVT},
-  {46093u, property::type::LVT},
-  {46094u, property::type::LVT},
-  {46095u, property::type::LVT},
-  {46096u, property::type::LVT},
-  {46097u, property::type::LVT},
-  {46098u, property::type::LVT},
-  {46099u, property::type::LVT},
-  {46100u, property::type::LVT},
-  {46101u, property::type::LVT},
-  {46102u, property::type::LVT},
-  {46103u, property::type::LVT},
-  {46105u, property::type::LVT},
-  {46106u, property::type::LVT},
-  {46107u, property::type::LVT},
-  {46108u, property::type::LVT},
-  {46109u, property::type::LVT},
-  {46110u, property::type::LVT},
-  {46111u, property::type::LVT},
-  {46112u, property::type::LVT},
-  {46113u, property::type::LVT},
-  {46114u, property::type::LVT},
-  {46115u, property::type::LVT},
-  {46116u, property::type::LVT},
-  {46117u, property::type::LVT},
-  {46118u, property::type::LVT},
-  {46119u, property::type::LVT},
-  {46120u, property::type::LVT},
-  {46121u, property::type::LVT},
-  {46122u, property::type::LVT},
-  {46123u, property::type::LVT},
-  {46124u, property::type::LVT},
-  {46125u, property::type::LVT},
-  {46126u, property::type::LVT},
-  {46127u, property::type::LVT},
-  {46128u, property::type::LVT},
-  {46129u, property::type::LVT},
-  {46130u, property::type::LVT},
-  {46131u, property::type::LVT},
-  {46133u, property::type::LVT},
-  {46134u, property::type::LVT},
-  {46135u, property::type::LVT},
-  {46136u, property::type::LVT},
-  {46137u, property::type::LVT},
-  {46138u, property::type::LVT},
-  {46139u, property::type::LVT},
-  {46140u, property::type::LVT},
-  {46141u, property::type::LVT},
-  {46142u, property::type::LVT},
-  {46143u, property::type::LVT},
-  {46144u, property::type::LVT},
-  {46145u, property::type::LVT},
-  {46146u, property::type::LVT},
-  {46147u, property::type::LVT},
-  {46148u, property::type::LVT},
-  {46149u, property::type::LVT},
-  {46150u, property::type::LVT},
-  {46151u, property::type::LVT},
-  {46152u, property::type::LVT},
-  {46153u, property::type::LVT},
-  {46154u, property::type::LVT},
-  {46155u, property::type::LVT},
-  {46156u, property::type::LVT},
-  {46157u, property::type::LVT},
-  {46158u, property::type::LVT},
-  {46159u, property::type::LVT},
-  {46161u, property::type::LVT},
-  {46162u, property::type::LVT},
-  {46163u, property::type::LVT},
-  {46164u, property::type::LVT},
-  {46165u, property::type::LVT},
-  {46166u, property::type::LVT},
-  {46167u, property::type::LVT},
-  {46168u, property::type::LVT},
-  {46169u, property::type::LVT},
-  {46170u, property::type::LVT},
-  {46171u, property::type::LVT},
-  {46172u, property::type::LVT},
-  {46173u, property::type::LVT},
-  {46174u, property::type::LVT},
-  {46175u, property::type::LVT},
-  {46176u, property::type::LVT},
-  {46177u, property::type::LVT},
-  {46178u, property::type::LVT},
-  {46179u, property::type::LVT},
-  {46180u, property::type::LVT},
-  {46181u, property::type::LVT},
-  {46182u, property::type::LVT},
-  {46183u, property::type::LVT},
-  {46184u, property::type::LVT},
-  {46185u, property::type::LVT},
-  {46186u, property::type::LVT},
-  {46187u, property::type::LVT},
-  {46189u, property::type::LVT},
-  {46190u, property::type::LVT},
-  {46191u, property::type::LVT},
-  {46192u, property::type::LVT},
-  {46193u, property::type::LVT},
-  {46194u, property::type::LVT},
-  {46195u, property::type::LVT},
-  {46196u, property::type::LVT},
-  {46197u, property::type::LVT},
-  {46198u, property::type::LVT},
-  {46199u, property::type::LVT},
-  {46200u, property::type::LVT},
-  {46201u, property::type::LVT},
-  {46202u, property::type::LVT},
-  {46203u, property::type::LVT},
-  {46204u, property::type::LVT},
-  {46205u, property::type::LVT},
-  {46206u, property::type::LVT},
-  {46207u, property::type::LVT},
-  {46208u, property::type::LVT},
-  {46209u, property::type::LVT},
-  {46210u, property::type::LVT},
-  {46211u, property::type::LVT},
-  {46212u, property::type::LVT},
-  {46213u, property::type::LVT},
-  {46214u, property::type::LVT},
-  {46215u, property::type::LVT},
-  {46217u, property::type::LVT},
-  {46218u, property::type::LVT},
-  {46219u, property::type::LVT},
-  {46220u, property::type::LVT},
-  {46221u, property::type::LVT},
-  {46222u, property::type::LVT},
-  {46223u, property::type::LVT},
-  {46224u, property::type::LVT},
-  {46225u, property::type::LVT},
-  {46226u, property::type::LVT},
-  {46227u, property::type::LVT},
-  {46228u, property::type::LVT},
-  {46229u, property::type::LVT},
-  {46230u, property::type::LVT},
-  {46231u, property::type::LVT},
-  {46232u, property::type::LVT},
-  {46233u, property::type::LVT},
-  {46234u, property::type::LVT},
-  {46235u, property::type::LVT},
-  {46236u, property::type::LVT},
-  {46237u, property::type::LVT},
-  {46238u, property::type::LVT},
-  {46239u, property::type::LVT},
-  {46240u, property::type::LVT},
-  {46241u, property::type::LVT},
-  {46242u, property::type::LVT},
-  {46243u, property::type::LVT},
-  {46245u, property::type::LVT},
-  {46246u, property::type::LVT},
-  {46247u, property::type::LVT},
-  {46248u, property::type::LVT},
-  {46249u, property::type::LVT},
-  {46250u, property::type::LVT},
-  {46251u, property::type::LVT},
-  {46252u, property::type::LVT},
-  {46253u, property::type::LVT},
-  {46254u, property::type::LVT},
-  {46255u, property::type::LVT},
-  {46256u, property::type::LVT},
-  {46257u, property::type::LVT},
-  {46258u, property::type::LVT},
-  {46259u, property::type::LVT},
-  {46260u, property::type::LVT},
-  {46261u, property::type::LVT},
-  {46262u, property::type::LVT},
-  {46263u, property::type::LVT},
-  {46264u, property::type::LVT},
-  {46265u, property::type::LVT},
-  {46266u, property::type::LVT},
-  {46267u, property::type::LVT},
-  {46268u, property::type::LVT},
-  {46269u, property::type::LVT},
-  {46270u, property::type::LVT},
-  {46271u, property::type::LVT},
-  {46273u, property::type::LVT},
-  {46274u, property::type::LVT},
-  {46275u, property::type::LVT},
-  {46276u, property::type::LVT},
-  {46277u, property::type::LVT},
-  {46278u, property::type::LVT},
-  {46279u, property::type::LVT},
-  {46280u, property::type::LVT},
-  {46281u, property::type::LVT},
-  {46282u, property::type::LVT},
-  {46283u, property::type::LVT},
-  {46284u, property::type::LVT},
-  {46285u, property::type::LVT},
-  {46286u, property::type::LVT},
-  {46287u, property::type::LVT},
-  {46288u, property::type::LVT},
-  {46289u, property::type::LVT},
-  {46290u, property::type::LVT},
-  {46291u, property::type::LVT},
-  {46292u, property::type::LVT},
-  {46293u, property::type::LVT},
-  {46294u, property::type::LVT},
-  {46295u, property::type::LVT},
-  {46296u, property::type::LVT},
-  {46297u, property::type::LVT},
-  {46298u, property::type::LVT},
-  {46299u, property::type::LVT},
-  {46301u, property::type::LVT},
-  {46302u, property::type::LVT},
-  {46303u, property::type::LVT},
-  {46304u, property::type::LVT},
-  {46305u, property::type::LVT},
-  {46306u, property::type::LVT},
-  {46307u, property::type::LVT},
-  {46308u, property::type::LVT},
-  {46309u, property::type::LVT},
-  {46310u, property::type::LVT},
-  {46311u, property::type::LVT},
-  {46312u, property::type::LVT},
-  {46313u, property::type::LVT},
-  {46314u, property::type::LVT},
-  {46315u, property::type::LVT},
-  {46316u, property::type::LVT},
-  {46317u, property::type::LVT},
-  {46318u, property::type::LVT},
-  {46319u, property::type::LVT},
-  {46320u, property::type::LVT},
-  {46321u, property::type::LVT},
-  {46322u, property::type::LVT},
-  {46323u, property::type::LVT},
-  {46324u, property::type::LVT},
-  {46325u, property::type::LVT},
-  {46326u, property::type::LVT},
-  {46327u, property::type::LVT},
-  {46329u, property::type::LVT},
-  {46330u, property::type::LVT},
-  {46331u, property::type::LVT},
-  {46332u, property::type::LVT},
-  {46333u, property::type::LVT},
-  {46334u, property::type::LVT},
-  {46335u, property::type::LVT},
-  {46336u, property::type::LVT},
-  {46337u, property::type::LVT},
-  {46338u, property::type::LVT},
-  {46339u, property::type::LVT},
-  {46340u, property::type::LVT},
-  {46341u, property::type::LVT},
-  {46342u, property::type::LVT},
-  {46343u, property::type::LVT},
-  {46344u, property::type::LVT},
-  {46345u, property::type::LVT},
-  {46346u, property::type::LVT},
-  {46347u, property::type::LVT},
-  {46348u, property::type::LVT},
-  {46349u, property::type::LVT},
-  {46350u, property::type::LVT},
-  {46351u, property::type::LVT},
-  {46352u, property::type::LVT},
-  {46353u, property::type::LVT},
-  {46354u, property::type::LVT},
-  {46355u, property::type::LVT},
-  {46357u, property::type::LVT},
-  {46358u, property::type::LVT},
-  {46359u, property::type::LVT},
-  {46360u, property::type::LVT},
-  {46361u, property::type::LVT},
-  {46362u, property::type::LVT},
-  {46363u, property::type::LVT},
-  {46364u, property::type::LVT},
-  {46365u, property::type::LVT},
-  {46366u, property::type::LVT},
-  {46367u, property::type::LVT},
-  {46368u, property::type::LVT},
-  {46369u, property::type::LVT},
-  {46370u, property::type::LVT},
-  {46371u, property::type::LVT},
-  {46372u, property::type::LVT},
-  {46373u, property::type::LVT},
-  {46374u, property::type::LVT},
-  {46375u, property::type::LVT},
-  {46376u, property::type::LVT},
-  {46377u, property::type::LVT},
-  {46378u, property::type::LVT},
-  {46379u, property::type::LVT},
-  {46380u, property::type::LVT},
-  {46381u, property::type::LVT},
-  {46382u, property::type::LVT},
-  {46383u, property::type::LVT},
-  {46385u, property::type::LVT},
-  {46386u, property::type::LVT},
-  {46387u, property::type::LVT},
-  {46388u, property::type::LVT},
-  {46389u, property::type::LVT},
-  {46390u, property::type::LVT},
-  {46391u, property::type::LVT},
-  {46392u, property::type::LVT},
-  {46393u, property::type::LVT},
-  {46394u, property::type::LVT},
-  {46395u, property::type::LVT},
-  {46396u, property::type::LVT},
-  {46397u, property::type::LVT},
-  {46398u, property::type::LVT},
-  {46399u, property::type::LVT},
-  {46400u, property::type::LVT},
-  {46401u, property::type::LVT},
-  {46402u, property::type::LVT},
-  {46403u, property::type::LVT},
-  {46404u, property::type::LVT},
-  {46405u, property::type::LVT},
-  {46406u, property::type::LVT},
-  {46407u, property::type::LVT},
-  {46408u, property::type::LVT},
-  {46409u, property::type::LVT},
-  {46410u, property::type::LVT},
-  {46411u, property::type::LVT},
-  {46413u, property::type::LVT},
-  {46414u, property::type::LVT},
-  {46415u, property::type::LVT},
-  {46416u, property::type::LVT},
-  {46417u, property::type::LVT},
-  {46418u, property::type::LVT},
-  {46419u, property::type::LVT},
-  {46420u, property::type::LVT},
-  {46421u, property::type::LVT},
-  {46422u, property::type::LVT},
-  {46423u, property::type::LVT},
-  {46424u, property::type::LVT},
-  {46425u, property::type::LVT},
-  {46426u, property::type::LVT},
-  {46427u, property::type::LVT},
-  {46428u, property::type::LVT},
-  {46429u, property::type::LVT},
-  {46430u, property::type::LVT},
-  {46431u, property::type::LVT},
-  {46432u, property::type::LVT},
-  {46433u, property::type::LVT},
-  {46434u, property::type::LVT},
-  {46435u, property::type::LVT},
-  {46436u, property::type::LVT},
-  {46437u, property::type::LVT},
-  {46438u, property::type::LVT},
-  {46439u, property::type::LVT},
-  {46441u, property::type::LVT},
-  {46442u, property::type::LVT},
-  {46443u, property::type::LVT},
-  {46444u, property::type::LVT},
-  {46445u, property::type::LVT},
-  {46446u, property::type::LVT},
-  {46447u, property::type::LVT},
-  {46448u, property::type::LVT},
-  {46449u, property::type::LVT},
-  {46450u, property::type::LVT},
-  {46451u, property::type::LVT},
-  {46452u, property::type::LVT},
-  {46453u, property::type::LVT},
-  {46454u, property::type::LVT},
-  {46455u, property::type::LVT},
-  {46456u, property::type::LVT},
-  {46457u, property::type::LVT},
-  {46458u, property::type::LVT},
-  {46459u, property::type::LVT},
-  {46460u, property::type::LVT},
-  {46461u, property::type::LVT},
-  {46462u, property::type::LVT},
-  {46463u, property::type::LVT},
-  {46464u, property::type::LVT},
-  {46465u, property::type::LVT},
-  {46466u, property::type::LVT},
-  {46467u, property::type::LVT},
-  {46469u, property::type::LVT},
-  {46470u, property::type::LVT},
-  {46471u, property::type::LVT},
-  {46472u, property::type::LVT},
-  {46473u, property::type::LVT},
-  {46474u, property::type::LVT},
-  {46475u, property::type::LVT},
-  {46476u, property::type::LVT},
-  {46477u, property::type::LVT},
-  {46478u, property::type::LVT},
-  {46479u, property::type::LVT},
-  {46480u, property::type::LVT},
-  {46481u, property::type::LVT},
-  {46482u, property::type::LVT},
-  {46483u, property::type::LVT},
-  {46484u, property::type::LVT},
-  {46485u, property::type::LVT},
-  {46486u, property::type::LVT},
-  {46487u, property::type::LVT},
-  {46488u, property::type::LVT},
-  {46489u, property::type::LVT},
-  {46490u, property::type::LVT},
-  {46491u, property::type::LVT},
-  {46492u, property::type::LVT},
-  {46493u, property::type::LVT},
-  {46494u, property::type::LVT},
-  {46495u, property::type::LVT},
-  {46497u, property::type::LVT},
-  {46498u, property::type::LVT},
-  {46499u, property::type::LVT},
-  {46500u, property::type::LVT},
-  {46501u, property::type::LVT},
-  {46502u, property::type::LVT},
-  {46503u, property::type::LVT},
-  {46504u, property::type::LVT},
-  {46505u, property::type::LVT},
-  {46506u, property::type::LVT},
-  {46507u, property::type::LVT},
-  {46508u, property::type::LVT},
-  {46509u, property::type::LVT},
-  {46510u, property::type::LVT},
-  {46511u, property::type::LVT},
-  {46512u, property::type::LVT},
-  {46513u, property::type::LVT},
-  {46514u, property::type::LVT},
-  {46515u, property::type::LVT},
-  {46516u, property::type::LVT},
-  {46517u, property::type::LVT},
-  {46518u, property::type::LVT},
-  {46519u, property::type::LVT},
-  {46520u, property::type::LVT},
-  {46521u, property::type::LVT},
-  {46522u, property::type::LVT},
-  {46523u, property::type::LVT},
-  {46525u, property::type::LVT},
-  {46526u, property::type::LVT},
-  {46527u, property::type::LVT},
-  {46528u, property::type::LVT},
-  {46529u, property::type::LVT},
-  {46530u, property::type::LVT},
-  {46531u, property::type::LVT},
-  {46532u, property::type::LVT},
-  {46533u, property::type::LVT},
-  {46534u, property::type::LVT},
-  {46535u, property::type::LVT},
-  {46536u, property::type::LVT},
-  {46537u, property::type::LVT},
-  {46538u, property::type::LVT},
-  {46539u, property::type::LVT},
-  {46540u, property::type::LVT},
-  {46541u, property::type::LVT},
-  {46542u, property::type::LVT},
-  {46543u, property::type::LVT},
-  {46544u, property::type::LVT},
-  {46545u, property::type::LVT},
-  {46546u, property::type::LVT},
-  {46547u, property::type::LVT},
-  {46548u, property::type::LVT},
-  {46549u, property::type::LVT},
-  {46550u, property::type::LVT},
-  {46551u, property::type::LVT},
-  {46553u, property::type::LVT},
-  {46554u, property::type::LVT},
-  {46555u, property::type::LVT},
-  {46556u, property::type::LVT},
-  {46557u, property::type::LVT},
-  {46558u, property::type::LVT},
-  {46559u, property::type::LVT},
-  {46560u, property::type::LVT},
-  {46561u, property::type::LVT},
-  {46562u, property::type::LVT},
-  {46563u, property::type::LVT},
-  {46564u, property::type::LVT},
-  {46565u, property::type::LVT},
-  {46566u, property::type::LVT},
-  {46567u, property::type::LVT},
-  {46568u, property::type::LVT},
-  {46569u, property::type::LVT},
-  {46570u, property::type::LVT},
-  {46571u, property::type::LVT},
-  {46572u, property::type::LVT},
-  {46573u, property::type::LVT},
-  {46574u, property::type::LVT},
-  {46575u, property::type::LVT},
-  {46576u, property::type::LVT},
-  {46577u, property::type::LVT},
-  {46578u, property::type::LVT},
-  {46579u, property::type::LVT},
-  {46581u, property::type::LVT},
-  {46582u, property::type::LVT},
-  {46583u, property::type::LVT},
-  {46584u, property::type::LVT},
-  {46585u, property::type::LVT},
-  {46586u, property::type::LVT},
-  {46587u, property::type::LVT},
-  {46588u, property::type::LVT},
-  {46589u, property::type::LVT},
-  {46590u, property::type::LVT},
-  {46591u, property::type::LVT},
-  {46592u, property::type::LVT},
-  {46593u, property::type::LVT},
-  {46594u, property::type::LVT},
-  {46595u, property::type::LVT},
-  {46596u, property::type::LVT},
-  {46597u, property::type::LVT},
-  {46598u, property::type::LVT},
-  {46599u, property::type::LVT},
-  {46600u, property::type::LVT},
-  {46601u, property::type::LVT},
-  {46602u, property::type::LVT},
-  {46603u, property::type::LVT},
-  {46604u, property::type::LVT},
-  {46605u, property::type::LVT},
-  {46606u, property::type::LVT},
-  {46607u, property::type::LVT},
-  {46609u, property::type::LVT},
-  {46610u, property::type::LVT},
-  {46611u, property::type::LVT},
-  {46612u, property::type::LVT},
-  {46613u, property::type::LVT},
-  {46614u, property::type::LVT},
-  {46615u, property::type::LVT},
-  {46616u, property::type::LVT},
-  {46617u, property::type::LVT},
-  {46618u, property::type::LVT},
-  {46619u, property::type::LVT},
-  {46620u, property::type::LVT},
-  {46621u, property::type::LVT},
-  {46622u, property::type::LVT},
-  {46623u, property::type::LVT},
-  {46624u, property::type::LVT},
-  {46625u, property::type::LVT},
-  {46626u, property::type::LVT},
-  {46627u, property::type::LVT},
-  {46628u, property::type::LVT},
-  {46629u, property::type::LVT},
-  {46630u, property::type::LVT},
-  {46631u, property::type::LVT},
-  {46632u, property::type::LVT},
-  {46633u, property::type::LVT},
-  {46634u, property::type::LVT},
-  {46635u, property::type::LVT},
-  {46637u, property::type::LVT},
-  {46638u, property::type::LVT},
-  {46639u, property::type::LVT},
-  {46640u, property::type::LVT},
-  {46641u, property::type::LVT},
-  {46642u, property::type::LVT},
-  {46643u, property::type::LVT},
-  {46644u, property::type::LVT},
-  {46645u, property::type::LVT},
-  {46646u, property::type::LVT},
-  {46647u, property::type::LVT},
-  {46648u, property::type::LVT},
-  {46649u, property::type::LVT},
-  {46650u, property::type::LVT},
-  {46651u, property::type::LVT},
-  {46652u, property::type::LVT},
-  {46653u, property::type::LVT},
-  {46654u, property::type::LVT},
-  {46655u, property::type::LVT},
-  {46656u, property::type::LVT},
-  {46657u, property::type::LVT},
-  {46658u, property::type::LVT},
-  {46659u, property::type::LVT},
-  {46660u, property::type::LVT},
-  {46661u, property::type::LVT},
-  {46662u, property::type::LVT},
-  {46663u, property::type::LVT},
-  {46665u, property::type::LVT},
-  {46666u, property::type::LVT},
-  {46667u, property::type::LVT},
-  {46668u, property::type::LVT},
-  {46669u, property::type::LVT},
-  {46670u, property::type::LVT},
-  {46671u, property::type::LVT},
-  {46672u, property::type::LVT},
-  {46673u, property::type::LVT},
-  {46674u, property::type::LVT},
-  {46675u, property::type::LVT},
-  {46676u, property::type::LVT},
-  {46677u, property::type::LVT},
-  {46678u, property::type::LVT},
-  {46679u, property::type::LVT},
-  {46680u, property::type::LVT},
-  {46681u, property::type::LVT},
-  {46682u, property::type::LVT},
-  {46683u, property::type::LVT},
-  {46684u, property::type::LVT},
-  {46685u, property::type::LVT},
-  {46686u, property::type::LVT},
-  {46687u, property::type::LVT},
-  {46688u, property::type::LVT},
-  {46689u, property::type::LVT},
-  {46690u, property::type::LVT},
-  {46691u, property::type::LVT},
-  {46693u, property::type::LVT},
-  {46694u, property::type::LVT},
-  {46695u, property::type::LVT},
-  {46696u, property::type::LVT},
-  {46697u, property::type::LVT},
-  {46698u, property::type::LVT},
-  {46699u, property::type::LVT},
-  {46700u, property::type::LVT},
-  {46701u, property::type::LVT},
-  {46702u, property::type::LVT},
-  {46703u, property::type::LVT},
-  {46704u, property::type::LVT},
-  {46705u, property::type::LVT},
-  {46706u, property::type::LVT},
-  {46707u, property::type::LVT},
-  {46708u, property::type::LVT},
-  {46709u, property::type::LVT},
-  {46710u, property::type::LVT},
-  {46711u, property::type::LVT},
-  {46712u, property::type::LVT},
-  {46713u, property::type::LVT},
-  {46714u, property::type::LVT},
-  {46715u, property::type::LVT},
-  {46716u, property::type::LVT},
-  {46717u, property::type::LVT},
-  {46718u, property::type::LVT},
-  {46719u, property::type::LVT},
-  {46721u, property::type::LVT},
-  {46722u, property::type::LVT},
-  {46723u, property::type::LVT},
-  {46724u, property::type::LVT},
-  {46725u, property::type::LVT},
-  {46726u, property::type::LVT},
-  {46727u, property::type::LVT},
-  {46728u, property::type::LVT},
-  {46729u, property::type::LVT},
-  {46730u, property::type::LVT},
-  {46731u, property::type::LVT},
-  {46732u, property::type::LVT},
-  {46733u, property::type::LVT},
-  {46734u, property::type::LVT},
-  {46735u, property::type::LVT},
-  {46736u, property::type::LVT},
-  {46737u, property::type::LVT},
-  {46738u, property::type::LVT},
-  {46739u, property::type::LVT},
-  {46740u, property::type::LVT},
-  {46741u, property::type::LVT},
-  {46742u, property::type::LVT},
-  {46743u, property::type::LVT},
-  {46744u, property::type::LVT},
-  {46745u, property::type::LVT},
-  {46746u, property::type::LVT},
-  {46747u, property::type::LVT},
-  {46749u, property::type::LVT},
-  {46750u, property::type::LVT},
-  {46751u, property::type::LVT},
-  {46752u, property::type::LVT},
-  {46753u, property::type::LVT},
-  {46754u, property::type::LVT},
-  {46755u, property::type::LVT},
-  {46756u, property::type::LVT},
-  {46757u, property::type::LVT},
-  {46758u, property::type::LVT},
-  {46759u, property::type::LVT},
-  {46760u, property::type::LVT},
-  {46761u, property::type::LVT},
-  {46762u, property::type::LVT},
-  {46763u, property::type::LVT},
-  {46764u, property::type::LVT},
-  {46765u, property::type::LVT},
-  {46766u, property::type::LVT},
-  {46767u, property::type::LVT},
-  {46768u, property::type::LVT},
-  {46769u, property::type::LVT},
-  {46770u, property::type::LVT},
-  {46771u, property::type::LVT},
-  {46772u, property::type::LVT},
-  {46773u, property::type::LVT},
-  {46774u, property::type::LVT},
-  {46775u, property::type::LVT},
-  {46777u, property::type::LVT},
-  {46778u, property::type::LVT},
-  {46779u, property::type::LVT},
-  {46780u, property::type::LVT},
-  {46781u, property::type::LVT},
-  {46782u, property::type::LVT},
-  {46783u, property::type::LVT},
-  {46784u, property::type::LVT},
-  {46785u, property::type::LVT},
-  {46786u, property::type::LVT},
-  {46787u, property::type::LVT},
-  {46788u, property::type::LVT},
-  {46789u, property::type::LVT},
-  {46790u, property::type::LVT},
-  {46791u, property::type::LVT},
-  {46792u, property::type::LVT},
-  {46793u, property::type::LVT},
-  {46794u, property::type::LVT},
-  {46795u, property::type::LVT},
-  {46796u, property::type::LVT},
-  {46797u, property::type::LVT},
-  {46798u, property::type::LVT},
-  {46799u, property::type::LVT},
-  {46800u, property::type::LVT},
-  {46801u, property::type::LVT},
-  {46802u, property::type::LVT},
-  {46803u, property::type::LVT},
-  {46805u, property::type::LVT},
-  {46806u, property::type::LVT},
-  {46807u, property::type::LVT},
-  {46808u, property::type::LVT},
-  {46809u, property::type::LVT},
-  {46810u, property::type::LVT},
-  {46811u, property::type::LVT},
-  {46812u, property::type::LVT},
-  {46813u, property::type::LVT},
-  {46814u, property::type::LVT},
-  {46815u, property::type::LVT},
-  {46816u, property::type::LVT},
-  {46817u, property::type::LVT},
-  {46818u, property::type::LVT},
-  {46819u, property::type::LVT},
-  {46820u, property::type::LVT},
-  {46821u, property::type::LVT},
-  {46822u, property::type::LVT},
-  {46823u, property::type::LVT},
-  {46824u, property::type::LVT},
-  {46825u, property::type::LVT},
-  {46826u, property::type::LVT},
-  {46827u, property::type::LVT},
-  {46828u, property::type::LVT},
-  {46829u, property::type::LVT},
-  {46830u, property::type::LVT},
-  {46831u, property::type::LVT},
-  {46833u, property::type::LVT},
-  {46834u, property::type::LVT},
-  {46835u, property::type::LVT},
-  {46836u, property::type::LVT},
-  {46837u, property::type::LVT},
-  {46838u, property::type::LVT},
-  {46839u, property::type::LVT},
-  {46840u, property::type::LVT},
-  {46841u, property::type::LVT},
-  {46842u, property::type::LVT},
-  {46843u, property::type::LVT},
-  {46844u, property::type::LVT},
-  {46845u, property::type::LVT},
-  {46846u, property::type::LVT},
-  {46847u, property::type::LVT},
-  {46848u, property::type::LVT},
-  {46849u, property::type::LVT},
-  {46850u, property::type::LVT},
-  {46851u, property::type::LVT},
-  {46852u, property::type::LVT},
-  {46853u, property::type::LVT},
-  {46854u, property::type::LVT},
-  {46855u, property::type::LVT},
-  {46856u, property::type::LVT},
-  {46857u, property::type::LVT},
-  {46858u, property::type::LVT},
-  {46859u, property::type::LVT},
-  {46861u, property::type::LVT},
-  {46862u, property::type::LVT},
-  {46863u, property::type::LVT},
-  {46864u, property::type::LVT},
-  {46865u, property::type::LVT},
-  {46866u, property::type::LVT},
-  {46867u, property::type::LVT},
-  {46868u, property::type::LVT},
-  {46869u, property::type::LVT},
-  {46870u, property::type::LVT},
-  {46871u, property::type::LVT},
-  {46872u, property::type::LVT},
-  {46873u, property::type::LVT},
-  {46874u, property::type::LVT},
-  {46875u, property::type::LVT},
-  {46876u, property::type::LVT},
-  {46877u, property::type::LVT},
-  {46878u, property::type::LVT},
-  {46879u, property::type::LVT},
-  {46880u, property::type::LVT},
-  {46881u, property::type::LVT},
-  {46882u, property::type::LVT},
-  {46883u, property::type::LVT},
-  {46884u, property::type::LVT},
-  {46885u, property::type::LVT},
-  {46886u, property::type::LVT},
-  {46887u, property::type::LVT},
-  {46889u, property::type::LVT},
-  {46890u, property::type::LVT},
-  {46891u, property::type::LVT},
-  {46892u, property::type::LVT},
-  {46893u, property::type::LVT},
-  {46894u, property::type::LVT},
-  {46895u, property::type::LVT},
-  {46896u, property::type::LVT},
-  {46897u, property::type::LVT},
-  {46898u, property::type::LVT},
-  {46899u, property::type::LVT},
-  {46900u, property::type::LVT},
-  {46901u, property::type::LVT},
-  {46902u, property::type::LVT},
-  {46903u, property::type::LVT},
-  {46904u, property::type::LVT},
-  {46905u, property::type::LVT},
-  {46906u, property::type::LVT},
-  {46907u, property::type::LVT},
-  {46908u, property::type::LVT},
-  {46909u, property::type::LVT},
-  {46910u, property::type::LVT},
-  {46911u, property::type::LVT},
-  {46912u, property::type::LVT},
-  {46913u, property::type::LVT},
-  {46914u, property::type::LVT},
-  {46915u, property::type::LVT},
-  {46917u, property::type::LVT},
-  {46918u, property::type::LVT},
-  {46919u, property::type::LVT},
-  {46920u, property::type::LVT},
-  {46921u, property::type::LVT},
-  {46922u, property::type::LVT},
-  {46923u, property::type::LVT},
-  {46924u, property::type::LVT},
-  {46925u, property::type::LVT},
-  {46926u, property::type::LVT},
-  {46927u, property::type::LVT},
-  {46928u, property::type::LVT},
-  {46929u, property::type::LVT},
-  {46930u, property::type::LVT},
-  {46931u, property::type::LVT},
-  {46932u, property::type::LVT},
-  {46933u, property::type::LVT},
-  {46934u, property::type::LVT},
-  {46935u, property::type::LVT},
-  {46936u, property::type::LVT},
-  {46937u, property::type::LVT},
-  {46938u, property::type::LVT},
-  {46939u, property::type::LVT},
-  {46940u, property::type::LVT},
-  {46941u, property::type::LVT},
-  {46942u, property::type::LVT},
-  {46943u, property::type::LVT},
-  {46945u, property::type::LVT},
-  {46946u, property::type::LVT},
-  {46947u, property::type::LVT},
-  {46948u, property::type::LVT},
-  {46949u, property::type::LVT},
-  {46950u, property::type::LVT},
-  {46951u, property::type::LVT},
-  {46952u, property::type::LVT},
-  {46953u, property::type::LVT},
-  {46954u, property::type::LVT},
-  {46955u, property::type::LVT},
-  {46956u, property::type::LVT},
-  {46957u, property::type::LVT},
-  {46958u, property::type::LVT},
-  {46959u, property::type::LVT},
-  {46960u, property::type::LVT},
-  {46961u, property::type::LVT},
-  {46962u, property::type::LVT},
-  {46963u, property::type::LVT},
-  {46964u, property::type::LVT},
-  {46965u, property::type::LVT},
-  {46966u, property::type::LVT},
-  {46967u, property::type::LVT},
-  {46968u, property::type::LVT},
-  {46969u, property::type::LVT},
-  {46970u, property::type::LVT},
-  {46971u, property::type::LVT},
-  {46973u, property::type::LVT},
-  {46974u, property::type::LVT},
-  {46975u, property::type::LVT},
-  {46976u, property::type::LVT},
-  {46977u, property::type::LVT},
-  {46978u, property::type::LVT},
-  {46979u, property::type::LVT},
-  {46980u, property::type::LVT},
-  {46981u, property::type::LVT},
-  {46982u, property::type::LVT},
-  {46983u, property::type::LVT},
-  {46984u, property::type::LVT},
-  {46985u, property::type::LVT},
-  {46986u, property::type::LVT},
-  {46987u, property::type::LVT},
-  {46988u, property::type::LVT},
-  {46989u, property::type::LVT},
-  {46990u, property::type::LVT},
-  {46991u, property::type::LVT},
-  {46992u, property::type::LVT},
-  {46993u, property::type::LVT},
-  {46994u, property::type::LVT},
-  {46995u, property::type::LVT},
-  {46996u, property::type::LVT},
-  {46997u, property::type::LVT},
-  {46998u, property::type::LVT},
-  {46999u, property::type::LVT},
-  {47001u, property::type::LVT},
-  {47002u, property::type::LVT},
-  {47003u, property::type::LVT},
-  {47004u, property::type::LVT},
-  {47005u, property::type::LVT},
-  {47006u, property::type::LVT},
-  {47007u, property::type::LVT},
-  {47008u, property::type::LVT},
-  {47009u, property::type::LVT},
-  {47010u, property::type::LVT},
-  {47011u, property::type::LVT},
-  {47012u, property::type::LVT},
-  {47013u, property::type::LVT},
-  {47014u, property::type::LVT},
-  {47015u, property::type::LVT},
-  {47016u, property::type::LVT},
-  {47017u, property::type::LVT},
-  {47018u, property::type::LVT},
-  {47019u, property::type::LVT},
-  {47020u, property::type::LVT},
-  {47021u, property::type::LVT},
-  {47022u, property::type::LVT},
-  {47023u, property::type::LVT},
-  {47024u, property::type::LVT},
-  {47025u, property::type::LVT},
-  {47026u, property::type::LVT},
-  {47027u, property::type::LVT},
-  {47029u, property::type::LVT},
-  {47030u, property::type::LVT},
-  {47031u, property::type::LVT},
-  {47032u, property::type::LVT},
-  {47033u, property::type::LVT},
-  {47034u, property::type::LVT},
-  {47035u, property::type::LVT},
-  {47036u, property::type::LVT},
-  {47037u, property::type::LVT},
-  {47038u, property::type::LVT},
-  {47039u, property::type::LVT},
-  {47040u, property::type::LVT},
-  {47041u, property::type::LVT},
-  {47042u, property::type::LVT},
-  {47043u, property::type::LVT},
-  {47044u, property::type::LVT},
-  {47045u, property::type::LVT},
-  {47046u, property::type::LVT},
-  {47047u, property::type::LVT},
-  {47048u, property::type::LVT},
-  {47049u, property::type::LVT},
-  {47050u, property::type::LVT},
-  {47051u, property::type::LVT},
-  {47052u, property::type::LVT},
-  {47053u, property::type::LVT},
-  {47054u, property::type::LVT},
-  {47055u, property::type::LVT},
-  {47057u, property::type::LVT},
-  {47058u, property::type::LVT},
-  {47059u, property::type::LVT},
-  {47060u, property::type::LVT},
-  {47061u, property::type::LVT},
-  {47062u, property::type::LVT},
-  {47063u, property::type::LVT},
-  {47064u, property::type::LVT},
-  {47065u, property::type::LVT},
-  {47066u, property::type::LVT},
-  {47067u, property::type::LVT},
-  {47068u, property::type::LVT},
-  {47069u, property::type::LVT},
-  {47070u, property::type::LVT},
-  {47071u, property::type::LVT},
-  {47072u, property::type::LVT},
-  {47073u, property::type::LVT},
-  {47074u, property::type::LVT},
-  {47075u, property::type::LVT},
-  {47076u, property::type::LVT},
-  {47077u, property::type::LVT},
-  {47078u, property::type::LVT},
-  {47079u, property::type::LVT},
-  {47080u, property::type::LVT},
-  {47081u, property::type::LVT},
-  {47082u, property::type::LVT},
-  {47083u, property::type::LVT},
-  {47085u, property::type::LVT},
-  {47086u, property::type::LVT},
-  {47087u, property::type::LVT},
-  {47088u, property::type::LVT},
-  {47089u, property::type::LVT},
-  {47090u, property::type::LVT},
-  {47091u, property::type::LVT},
-  {47092u, property::type::LVT},
-  {47093u, property::type::LVT},
-  {47094u, property::type::LVT},
-  {47095u, property::type::LVT},
-  {47096u, property::type::LVT},
-  {47097u, property::type::LVT},
-  {47098u, property::type::LVT},
-  {47099u, property::type::LVT},
-  {47100u, property::type::LVT},
-  {47101u, property::type::LVT},
-  {47102u, property::type::LVT},
-  {47103u, property::type::LVT},
-  {47104u, property::type::LVT},
-  {47105u, property::type::LVT},
-  {47106u, property::type::LVT},
-  {47107u, property::type::LVT},
-  {47108u, property::type::LVT},
-  {47109u, property::type::LVT},
-  {47110u, property::type::LVT},
-  {47111u, property::type::LVT},
-  {47113u, property::type::LVT},
-  {47114u, property::type::LVT},
-  {47115u, property::type::LVT},
-  {47116u, property::type::LVT},
-  {47117u, property::type::LVT},
-  {47118u, property::type::LVT},
-  {47119u, property::type::LVT},
-  {47120u, property::type::LVT},
-  {47121u, property::type::LVT},
-  {47122u, property::type::LVT},
-  {47123u, property::type::LVT},
-  {47124u, property::type::LVT},
-  {47125u, property::type::LVT},
-  {47126u, property::type::LVT},
-  {47127u, property::type::LVT},
-  {47128u, property::type::LVT},
-  {47129u, property::type::LVT},
-  {47130u, property::type::LVT},
-  {47131u, property::type::LVT},
-  {47132u, property::type::LVT},
-  {47133u, property::type::LVT},
-  {47134u, property::type::LVT},
-  {47135u, property::type::LVT},
-  {47136u, property::type::LVT},
-  {47137u, property::type::LVT},
-  {47138u, property::type::LVT},
-  {47139u, property::type::LVT},
-  {47141u, property::type::LVT},
-  {47142u, property::type::LVT},
-  {47143u, property::type::LVT},
-  {47144u, property::type::LVT},
-  {47145u, property::type::LVT},
-  {47146u, property::type::LVT},
-  {47147u, property::type::LVT},
-  {47148u, property::type::LVT},
-  {47149u, property::type::LVT},
-  {47150u, property::type::LVT},
-  {47151u, property::type::LVT},
-  {47152u, property::type::LVT},
-  {47153u, property::type::LVT},
-  {47154u, property::type::LVT},
-  {47155u, property::type::LVT},
-  {47156u, property::type::LVT},
-  {47157u, property::type::LVT},
-  {47158u, property::type::LVT},
-  {47159u, property::type::LVT},
-  {47160u, property::type::LVT},
-  {47161u, property::type::LVT},
-  {47162u, property::type::LVT},
-  {47163u, property::type::LVT},
-  {47164u, property::type::LVT},
-  {47165u, property::type::LVT},
-  {47166u, property::type::LVT},
-  {47167u, property::type::LVT},
-  {47169u, property::type::LVT},
-  {47170u, property::type::LVT},
-  {47171u, property::type::LVT},
-  {47172u, property::type::LVT},
-  {47173u, property::type::LVT},
-  {47174u, property::type::LVT},
-  {47175u, property::type::LVT},
-  {47176u, property::type::LVT},
-  {47177u, property::type::LVT},
-  {47178u, property::type::LVT},
-  {47179u, property::type::LVT},
-  {47180u, property::type::LVT},
-  {47181u, property::type::LVT},
-  {47182u, property::type::LVT},
-  {47183u, property::type::LVT},
-  {47184u, property::type::LVT},
-  {47185u, property::type::LVT},
-  {47186u, property::type::LVT},
-  {47187u, property::type::LVT},
-  {47188u, property::type::LVT},
-  {47189u, property::type::LVT},
-  {47190u, property::type::LVT},
-  {47191u, property::type::LVT},
-  {47192u, property::type::LVT},
-  {47193u, property::type::LVT},
-  {47194u, property::type::LVT},
-  {47195u, property::type::LVT},
-  {47197u, property::type::LVT},
-  {47198u, property::type::LVT},
-  {47199u, property::type::LVT},
-  {47200u, property::type::LVT},
-  {47201u, property::type::LVT},
-  {47202u, property::type::LVT},
-  {47203u, property::type::LVT},
-  {47204u, property::type::LVT},
-  {47205u, property::type::LVT},
-  {47206u, property::type::LVT},
-  {47207u, property::type::LVT},
-  {47208u, property::type::LVT},
-  {47209u, property::type::LVT},
-  {47210u, property::type::LVT},
-  {47211u, property::type::LVT},
-  {47212u, property::type::LVT},
-  {47213u, property::type::LVT},
-  {47214u, property::type::LVT},
-  {47215u, property::type::LVT},
-  {47216u, property::type::LVT},
-  {47217u, property::type::LVT},
-  {47218u, property::type::LVT},
-  {47219u, property::type::LVT},
-  {47220u, property::type::LVT},
-  {47221u, property::type::LVT},
-  {47222u, property::type::LVT},
-  {47223u, property::type::LVT},
-  {47225u, property::type::LVT},
-  {47226u, property::type::LVT},
-  {47227u, property::type::LVT},
-  {47228u, property::type::LVT},
-  {47229u, property::type::LVT},
-  {47230u, property::type::LVT},
-  {47231u, property::type::LVT},
-  {47232u, property::type::LVT},
-  {47233u, property::type::LVT},
-  {47234u, property::type::LVT},
-  {47235u, property::type::LVT},
-  {47236u, property::type::LVT},
-  {47237u, property::type::LVT},
-  {47238u, property::type::LVT},
-  {47239u, property::type::LVT},
-  {47240u, property::type::LVT},
-  {47241u, property::type::LVT},
-  {47242u, property::type::LVT},
-  {47243u, property::type::LVT},
-  {47244u, property::type::LVT},
-  {47245u, property::type::LVT},
-  {47246u, property::type::LVT},
-  {47247u, property::type::LVT},
-  {47248u, property::type::LVT},
-  {47249u, property::type::LVT},
-  {47250u, property::type::LVT},
-  {47251u, property::type::LVT},
-  {47253u, property::type::LVT},
-  {47254u, property::type::LVT},
-  {47255u, property::type::LVT},
-  {47256u, property::type::LVT},
-  {47257u, property::type::LVT},
-  {47258u, property::type::LVT},
-  {47259u, property::type::LVT},
-  {47260u, property::type::LVT},
-  {47261u, property::type::LVT},
-  {47262u, property::type::LVT},
-  {47263u, property::type::LVT},
-  {47264u, property::type::LVT},
-  {47265u, property::type::LVT},
-  {47266u, property::type::LVT},
-  {47267u, property::type::LVT},
-  {47268u, property::type::LVT},
-  {47269u, property::type::LVT},
-  {47270u, property::type::LVT},
-  {47271u, property::type::LVT},
-  {47272u, property::type::LVT},
-  {47273u, property::type::LVT},
-  {47274u, property::type::LVT},
-  {47275u, property::type::LVT},
-  {47276u, property::type::LVT},
-  {47277u, property::type::LVT},
-  {47278u, property::type::LVT},
-  {47279u, property::type::LVT},
-  {47281u, property::type::LVT},
-  {47282u, property::type::LVT},
-  {47283u, property::type::LVT},
-  {47284u, property::type::LVT},
-  {47285u, property::type::LVT},
-  {47286u, property::type::LVT},
-  {47287u, property::type::LVT},
-  {47288u, property::type::LVT},
-  {47289u, property::type::LVT},
-  {47290u, property::type::LVT},
-  {47291u, property::type::LVT},
-  {47292u, property::type::LVT},
-  {47293u, property::type::LVT},
-  {47294u, property::type::LVT},
-  {47295u, property::type::LVT},
-  {47296u, property::type::LVT},
-  {47297u, property::type::LVT},
-  {47298u, property::type::LVT},
-  {47299u, property::type::LVT},
-  {47300u, property::type::LVT},
-  {47301u, property::type::LVT},
-  {47302u, property::type::LVT},
-  {47303u, property::type::LVT},
-  {47304u, property::type::LVT},
-  {47305u, property::type::LVT},
-  {47306u, property::type::LVT},
-  {47307u, property::type::LVT},
-  {47309u, property::type::LVT},
-  {47310u, property::type::LVT},
-  {47311u, property::type::LVT},
-  {47312u, property::type::LVT},
-  {47313u, property::type::LVT},
-  {47314u, property::type::LVT},
-  {47315u, property::type::LVT},
-  {47316u, property::type::LVT},
-  {47317u, property::type::LVT},
-  {47318u, property::type::LVT},
-  {47319u, property::type::LVT},
-  {47320u, property::type::LVT},
-  {47321u, property::type::LVT},
-  {47322u, property::type::LVT},
-  {47323u, property::type::LVT},
-  {47324u, property::type::LVT},
-  {47325u, property::type::LVT},
-  {47326u, property::type::LVT},
-  {47327u, property::type::LVT},
-  {47328u, property::type::LVT},
-  {47329u, property::type::LVT},
-  {47330u, property::type::LVT},
-  {47331u, property::type::LVT},
-  {47332u, property::type::LVT},
-  {47333u, property::type::LVT},
-  {47334u, property::type::LVT},
-  {47335u, property::type::LVT},
-  {47337u, property::type::LVT},
-  {47338u, property::type::LVT},
-  {47339u, property::type::LVT},
-  {47340u, property::type::LVT},
-  {47341u, property::type::LVT},
-  {47342u, property::type::LVT},
-  {47343u, property::type::LVT},
-  {47344u, property::type::LVT},
-  {47345u, property::type::LVT},
-  {47346u, property::type::LVT},
-  {47347u, property::type::LVT},
-  {47348u, property::type::LVT},
-  {47349u, property::type::LVT},
-  {47350u, property::type::LVT},
-  {47351u, property::type::LVT},
-  {47352u, property::type::LVT},
-  {47353u, property::type::LVT},
-  {47354u, property::type::LVT},
-  {47355u, property::type::LVT},
-  {47356u, property::type::LVT},
-  {47357u, property::type::LVT},
-  {47358u, property::type::LVT},
-  {47359u, property::type::LVT},
-  {47360u, property::type::LVT},
-  {47361u, property::type::LVT},
-  {47362u, property::type::LVT},
-  {47363u, property::type::LVT},
-  {47365u, property::type::LVT},
-  {47366u, property::type::LVT},
-  {47367u, property::type::LVT},
-  {47368u, property::type::LVT},
-  {47369u, property::type::LVT},
-  {47370u, property::type::LVT},
-  {47371u, property::type::LVT},
-  {47372u, property::type::LVT},
-  {47373u, property::type::LVT},
-  {47374u, property::type::LVT},
-  {47375u, property::type::LVT},
-  {47376u, property::type::LVT},
-  {47377u, property::type::LVT},
-  {47378u, property::type::LVT},
-  {47379u, property::type::LVT},
-  {47380u, property::type::LVT},
-  {47381u, property::type::LVT},
-  {47382u, property::type::LVT},
-  {47383u, property::type::LVT},
-  {47384u, property::type::LVT},
-  {47385u, property::type::LVT},
-  {47386u, property::type::LVT},
-  {47387u, property::type::LVT},
-  {47388u, property::type::LVT},
-  {47389u, property::type::LVT},
-  {47390u, property::type::LVT},
-  {47391u, property::type::LVT},
-  {47393u, property::type::LVT},
-  {47394u, property::type::LVT},
-  {47395u, property::type::LVT},
-  {47396u, property::type::LVT},
-  {47397u, property::type::LVT},
-  {47398u, property::type::LVT},
-  {47399u, property::type::LVT},
-  {47400u, property::type::LVT},
-  {47401u, property::type::LVT},
-  {47402u, property::type::LVT},
-  {47403u, property::type::LVT},
-  {47404u, property::type::LVT},
-  {47405u, property::type::LVT},
-  {47406u, property::type::LVT},
-  {47407u, property::type::LVT},
-  {47408u, property::type::LVT},
-  {47409u, property::type::LVT},
-  {47410u, property::type::LVT},
-  {47411u, property::type::LVT},
-  {47412u, property::type::LVT},
-  {47413u, property::type::LVT},
-  {47414u, property::type::LVT},
-  {47415u, property::type::LVT},
-  {47416u, property::type::LVT},
-  {47417u, property::type::LVT},
-  {47418u, property::type::LVT},
-  {47419u, property::type::LVT},
-  {47421u, property::type::LVT},
-  {47422u, property::type::LVT},
-  {47423u, property::type::LVT},
-  {47424u, property::type::LVT},
-  {47425u, property::type::LVT},
-  {47426u, property::type::LVT},
-  {47427u, property::type::LVT},
-  {47428u, property::type::LVT},
-  {47429u, property::type::LVT},
-  {47430u, property::type::LVT},
-  {47431u, property::type::LVT},
-  {47432u, property::type::LVT},
-  {47433u, property::type::LVT},
-  {47434u, property::type::LVT},
-  {47435u, property::type::LVT},
-  {47436u, property::type::LVT},
-  {47437u, property::type::LVT},
-  {47438u, property::type::LVT},
-  {47439u, property::type::LVT},
-  {47440u, property::type::LVT},
-  {47441u, property::type::LVT},
-  {47442u, property::type::LVT},
-  {47443u, property::type::LVT},
-  {47444u, property::type::LVT},
-  {47445u, property::type::LVT},
-  {47446u, property::type::LVT},
-  {47447u, property::type::LVT},
-  {47449u, property::type::LVT},
-  {47450u, property::type::LVT},
-  {47451u, property::type::LVT},
-  {47452u, property::type::LVT},
-  {47453u, property::type::LVT},
-  {47454u, property::type::LVT},
-  {47455u, property::type::LVT},
-  {47456u, property::type::LVT},
-  {47457u, property::type::LVT},
-  {47458u, property::type::LVT},
-  {47459u, property::type::LVT},
-  {47460u, property::type::LVT},
-  {47461u, property::type::LVT},
-  {47462u, property::type::LVT},
-  {47463u, property::type::LVT},
-  {47464u, property::type::LVT},
-  {47465u, property::type::LVT},
-  {47466u, property::type::LVT},
-  {47467u, property::type::LVT},
-  {47468u, property::type::LVT},
-  {47469u, property::type::LVT},
-  {47470u, property::type::LVT},
-  {47471u, property::type::LVT},
-  {47472u, property::type::LVT},
-  {47473u, property::type::LVT},
-  {47474u, property::type::LVT},
-  {47475u, property::type::LVT},
-  {47477u, property::type::LVT},
-  {47478u, property::type::LVT},
-  {47479u, property::type::LVT},
-  {47480u, property::type::LVT},
-  {47481u, property::type::LVT},
-  {47482u, property::type::LVT},
-  {47483u, property::type::LVT},
-  {47484u, property::type::LVT},
-  {47485u, property::type::LVT},
-  {47486u, property::type::LVT},
-  {47487u, property::type::LVT},
-  {47488u, property::type::LVT},
-  {47489u, property::type::LVT},
-  {47490u, property::type::LVT},
-  {47491u, property::type::LVT},
-  {47492u, property::type::LVT},
-  {47493u, property::type::LVT},
-  {47494u, property::type::LVT},
-  {47495u, property::type::LVT},
-  {47496u, property::type::LVT},
-  {47497u, property::type::LVT},
-  {47498u, property::type::LVT},
-  {47499u, property::type::LVT},
-  {47500u, property::type::LVT},
-  {47501u, property::type::LVT},
-  {47502u, property::type::LVT},
-  {47503u, property::type::LVT},
-  {47505u, property::type::LVT},
-  {47506u, property::type::LVT},
-  {47507u, property::type::LVT},
-  {47508u, property::type::LVT},
-  {47509u, property::type::LVT},
-  {47510u, property::type::LVT},
-  {47511u, property::type::LVT},
-  {47512u, property::type::LVT},
-  {47513u, property::type::LVT},
-  {47514u, property::type::LVT},
-  {47515u, property::type::LVT},
-  {47516u, property::type::LVT},
-  {47517u, property::type::LVT},
-  {47518u, property::type::LVT},
-  {47519u, property::type::LVT},
-  {47520u, property::type::LVT},
-  {47521u, property::type::LVT},
-  {47522u, property::type::LVT},
-  {47523u, property::type::LVT},
-  {47524u, property::type::LVT},
-  {47525u, property::type::LVT},
-  {47526u, property::type::LVT},
-  {47527u, property::type::LVT},
-  {47528u, property::type::LVT},
-  {47529u, property::type::LVT},
-  {47530u, property::type::LVT},
-  {47531u, property::type::LVT},
-  {47533u, property::type::LVT},
-  {47534u, property::type::LVT},
-  {47535u, property::type::LVT},
-  {47536u, property::type::LVT},
-  {47537u, property::type::LVT},
-  {47538u, property::type::LVT},
-  {47539u, property::type::LVT},
-  {47540u, property::type::LVT},
-  {47541u, property::type::LVT},
-  {47542u, property::type::LVT},
-  {47543u, property::type::LVT},
-  {47544u, property::type::LVT},
-  {47545u, property::type::LVT},
-  {47546u, property::type::LVT},
-  {47547u, property::type::LVT},
-  {47548u, property::type::LVT},
-  {47549u, property::type::LVT},
-  {47550u, property::type::LVT},
-  {47551u, property::type::LVT},
-  {47552u, property::type::LVT},
-  {47553u, property::type::LVT},
-  {47554u, property::type::LVT},
-  {47555u, property::type::LVT},
-  {47556u, property::type::LVT},
-  {47557u, property::type::LVT},
-  {47558u, property::type::LVT},
-  {47559u, property::type::LVT},
-  {47561u, property::type::LVT},
-  {47562u, property::type::LVT},
-  {47563u, property::type::LVT},
-  {47564u, property::type::LVT},
-  {47565u, property::type::LVT},
-  {47566u, property::type::LVT},
-  {47567u, property::type::LVT},
-  {47568u, property::type::LVT},
-  {47569u, property::type::LVT},
-  {47570u, property::type::LVT},
-  {47571u, property::type::LVT},
-  {47572u, property::type::LVT},
-  {47573u, property::type::LVT},
-  {47574u, property::type::LVT},
-  {47575u, property::type::LVT},
-  {47576u, property::type::LVT},
-  {47577u, property::type::LVT},
-  {47578u, property::type::LVT},
-  {47579u, property::type::LVT},
-  {47580u, property::type::LVT},
-  {47581u, property::type::LVT},
-  {47582u, property::type::LVT},
-  {47583u, property::type::LVT},
-  {47584u, property::type::LVT},
-  {47585u, property::type::LVT},
-  {47586u, property::type::LVT},
-  {47587u, property::type::LVT},
-  {47589u, property::type::LVT},
-  {47590u, property::type::LVT},
-  {47591u, property::type::LVT},
-  {47592u, property::type::LVT},
-  {47593u, property::type::LVT},
-  {47594u, property::type::LVT},
-  {47595u, property::type::LVT},
-  {47596u, property::type::LVT},
-  {47597u, property::type::LVT},
-  {47598u, property::type::LVT},
-  {47599u, property::type::LVT},
-  {47600u, property::type::LVT},
-  {47601u, property::type::LVT},
-  {47602u, property::type::LVT},
-  {47603u, property::type::LVT},
-  {47604u, property::type::LVT},
-  {47605u, property::type::LVT},
-  {47606u, property::type::LVT},
-  {47607u, property::type::LVT},
-  {47608u, property::type::LVT},
-  {47609u, property::type::LVT},
-  {47610u, property::type::LVT},
-  {47611u, property::type::LVT},
-  {47612u, property::type::LVT},
-  {47613u, property::type::LVT},
-  {47614u, property::type::LVT},
-  {47615u, property::type::LVT},
-  {47617u, property::type::LVT},
-  {47618u, property::type::LVT},
-  {47619u, property::type::LVT},
-  {47620u, property::type::LVT},
-  {47621u, property::type::LVT},
-  {47622u, property::type::LVT},
-  {47623u, property::type::LVT},
-  {47624u, property::type::LVT},
-  {47625u, property::type::LVT},
-  {47626u, property::type::LVT},
-  {47627u, property::type::LVT},
-  {47628u, property::type::LVT},
-  {47629u, property::type::LVT},
-  {47630u, property::type::LVT},
-  {47631u, property::type::LVT},
-  {47632u, property::type::LVT},
-  {47633u, property::type::LVT},
-  {47634u, property::type::LVT},
-  {47635u, property::type::LVT},
-  {47636u, property::type::LVT},
-  {47637u, property::type::LVT},
-  {47638u, property::type::LVT},
-  {47639u, property::type::LVT},
-  {47640u, property::type::LVT},
-  {47641u, property::type::LVT},
-  {47642u, property::type::LVT},
-  {47643u, property::type::LVT},
-  {47645u, property::type::LVT},
-  {47646u, property::type::LVT},
-  {47647u, property::type::LVT},
-  {47648u, property::type::LVT},
-  {47649u, property::type::LVT},
-  {47650u, property::type::LVT},
-  {47651u, property::type::LVT},
-  {47652u, property::type::LVT},
-  {47653u, property::type::LVT},
-  {47654u, property::type::LVT},
-  {47655u, property::type::LVT},
-  {47656u, property::type::LVT},
-  {47657u, property::type::LVT},
-  {47658u, property::type::LVT},
-  {47659u, property::type::LVT},
-  {47660u, property::type::LVT},
-  {47661u, property::type::LVT},
-  {47662u, property::type::LVT},
-  {47663u, property::type::LVT},
-  {47664u, property::type::LVT},
-  {47665u, property::type::LVT},
-  {47666u, property::type::LVT},
-  {47667u, property::type::LVT},
-  {47668u, property::type::LVT},
-  {47669u, property::type::LVT},
-  {47670u, property::type::LVT},
-  {47671u, property::type::LVT},
-  {47673u, property::type::LVT},
-  {47674u, property::type::LVT},
-  {47675u, property::type::LVT},
-  {47676u, property::type::LVT},
-  {47677u, property::type::LVT},
-  {47678u, property::type::LVT},
-  {47679u, property::type::LVT},
-  {47680u, property::type::LVT},
-  {47681u, property::type::LVT},
-  {47682u, property::type::LVT},
-  {47683u, property::type::LVT},
-  {47684u, property::type::LVT},
-  {47685u, property::type::LVT},
-  {47686u, property::type::LVT},
-  {47687u, property::type::LVT},
-  {47688u, property::type::LVT},
-  {47689u, property::type::LVT},
-  {47690u, property::type::LVT},
-  {47691u, property::type::LVT},
-  {47692u, property::type::LVT},
-  {47693u, property::type::LVT},
-  {47694u, property::type::LVT},
-  {47695u, property::type::LVT},
-  {47696u, property::type::LVT},
-  {47697u, property::type::LVT},
-  {47698u, property::type::LVT},
-  {47699u, property::type::LVT},
-  {47701u, property::type::LVT},
-  {47702u, property::type::LVT},
-  {47703u, property::type::LVT},
-  {47704u, property::type::LVT},
-  {47705u, property::type::LVT},
-  {47706u, property::type::LVT},
-  {47707u, property::type::LVT},
-  {47708u, property::type::LVT},
-  {47709u, property::type::LVT},
-  {47710u, property::type::LVT},
-  {47711u, property::type::LVT},
-  {47712u, property::type::LVT},
-  {47713u, property::type::LVT},
-  {47714u, property::type::LVT},
-  {47715u, property::type::LVT},
-  {47716u, property::type::LVT},
-  {47717u, property::type::LVT},
-  {47718u, property::type::LVT},
-  {47719u, property::type::LVT},
-  {47720u, property::type::LVT},
-  {47721u, property::type::LVT},
-  {47722u, property::type::LVT},
-  {47723u, property::type::LVT},
-  {47724u, property::type::LVT},
-  {47725u, property::type::LVT},
-  {47726u, property::type::LVT},
-  {47727u, property::type::LVT},
-  {47729u, property::type::LVT},
-  {47730u, property::type::LVT},
-  {47731u, property::type::LVT},
-  {47732u, property::type::LVT},
-  {47733u, property::type::LVT},
-  {47734u, property::type::LVT},
-  {47735u, property::type::LVT},
-  {47736u, property::type::LVT},
-  {47737u, property::type::LVT},
-  {47738u, property::type::LVT},
-  {47739u, property::type::LVT},
-  {47740u, property::type::LVT},
-  {47741u, property::type::LVT},
-  {47742u, property::type::LVT},
-  {47743u, property::type::LVT},
-  {47744u, property::type::LVT},
-  {47745u, property::type::LVT},
-  {47746u, property::type::LVT},
-  {47747u, property::type::LVT},
-  {47748u, property::type::LVT},
-  {47749u, property::type::LVT},
-  {47750u, property::type::LVT},
-  {47751u, property::type::LVT},
-  {47752u, property::type::LVT},
-  {47753u, property::type::LVT},
-  {47754u, property::type::LVT},
-  {47755u, property::type::LVT},
-  {47757u, property::type::LVT},
-  {47758u, property::type::LVT},
-  {47759u, property::type::LVT},
-  {47760u, property::type::LVT},
-  {47761u, property::type::LVT},
-  {47762u, property::type::LVT},
-  {47763u, property::type::LVT},
-  {47764u, property::type::LVT},
-  {47765u, property::type::LVT},
-  {47766u, property::type::LVT},
-  {47767u, property::type::LVT},
-  {47768u, property::type::LVT},
-  {47769u, property::type::LVT},
-  {47770u, property::type::LVT},
-  {47771u, property::type::LVT},
-  {47772u, property::type::LVT},
-  {47773u, property::type::LVT},
-  {47774u, property::type::LVT},
-  {47775u, property::type::LVT},
-  {47776u, property::type::LVT},
-  {47777u, property::type::LVT},
-  {47778u, property::type::LVT},
-  {47779u, property::type::LVT},
-  {47780u, property::type::LVT},
-  {47781u, property::type::LVT},
-  {47782u, property::type::LVT},
-  {47783u, property::type::LVT},
-  {47785u, property::type::LVT},
-  {47786u, property::type::LVT},
-  {47787u, property::type::LVT},
-  {47788u, property::type::LVT},
-  {47789u, property::type::LVT},
-  {47790u, property::type::LVT},
-  {47791u, property::type::LVT},
-  {47792u, property::type::LVT},
-  {47793u, property::type::LVT},
-  {47794u, property::type::LVT},
-  {47795u, property::type::LVT},
-  {47796u, property::type::LVT},
-  {47797u, property::type::LVT},
-  {47798u, property::type::LVT},
-  {47799u, property::type::LVT},
-  {47800u, property::type::LVT},
-  {47801u, property::type::LVT},
-  {47802u, property::type::LVT},
-  {47803u, property::type::LVT},
-  {47804u, property::type::LVT},
-  {47805u, property::type::LVT},
-  {47806u, property::type::LVT},
-  {47807u, property::type::LVT},
-  {47808u, property::type::LVT},
-  {47809u, property::type::LVT},
-  {47810u, property::type::LVT},
-  {47811u, property::type::LVT},
-  {47813u, property::type::LVT},
-  {47814u, property::type::LVT},
-  {47815u, property::type::LVT},
-  {47816u, property::type::LVT},
-  {47817u, property::type::LVT},
-  {47818u, property::type::LVT},
-  {47819u, property::type::LVT},
-  {47820u, property::type::LVT},
-  {47821u, property::type::LVT},
-  {47822u, property::type::LVT},
-  {47823u, property::type::LVT},
-  {47824u, property::type::LVT},
-  {47825u, property::type::LVT},
-  {47826u, property::type::LVT},
-  {47827u, property::type::LVT},
-  {47828u, property::type::LVT},
-  {47829u, property::type::LVT},
-  {47830u, property::type::LVT},
-  {47831u, property::type::LVT},
-  {47832u, property::type::LVT},
-  {47833u, property::type::LVT},
-  {47834u, property::type::LVT},
-  {47835u, property::type::LVT},
-  {47836u, property::type::LVT},
-  {47837u, property::type::LVT},
-  {47838u, property::type::LVT},
-  {47839u, property::type::LVT},
-  {47841u, property::type::LVT},
-  {47842u, property::type::LVT},
-  {47843u, property::type::LVT},
-  {47844u, property::type::LVT},
-  {47845u, property::type::LVT},
-  {47846u, property::type::LVT},
-  {47847u, property::type::LVT},
-  {47848u, property::type::LVT},
-  {47849u, property::type::LVT},
-  {47850u, property::type::LVT},
-  {47851u, property::type::LVT},
-  {47852u, property::type::LVT},
-  {47853u, property::type::LVT},
-  {47854u, property::type::LVT},
-  {47855u, property::type::LVT},
-  {47856u, property::type::LVT},
-  {47857u, property::type::LVT},
-  {47858u, property::type::LVT},
-  {47859u, property::type::LVT},
-  {47860u, property::type::LVT},
-  {47861u, property::type::LVT},
-  {47862u, property::type::LVT},
-  {47863u, property::type::LVT},
-  {47864u, property::type::LVT},
-  {47865u, property::type::LVT},
-  {47866u, property::type::LVT},
-  {47867u, property::type::LVT},
-  {47869u, property::type::LVT},
-  {47870u, property::type::LVT},
-  {47871u, property::type::LVT},
-  {47872u, property::type::LVT},
-  {47873u, property::type::LVT},
-  {47874u, property::type::LVT},
-  {47875u, property::type::LVT},
-  {47876u, property::type::LVT},
-  {47877u, property::type::LVT},
-  {47878u, property::type::LVT},
-  {47879u, property::type::LVT},
-  {47880u, property::type::LVT},
-  {47881u, property::type::LVT},
-  {47882u, property::type::LVT},
-  {47883u, property::type::LVT},
-  {47884u, property::type::LVT},
-  {47885u, property::type::LVT},
-  {47886u, property::type::LVT},
-  {47887u, property::type::LVT},
-  {47888u, property::type::LVT},
-  {47889u, property::type::LVT},
-  {47890u, property::type::LVT},
-  {47891u, property::type::LVT},
-  {47892u, property::type::LVT},
-  {47893u, property::type::LVT},
-  {47894u, property::type::LVT},
-  {47895u, property::type::LVT},
-  {47897u, property::type::LVT},
-  {47898u, property::type::LVT},
-  {47899u, property::type::LVT},
-  {47900u, property::type::LVT},
-  {47901u, property::type::LVT},
-  {47902u, property::type::LVT},
-  {47903u, property::type::LVT},
-  {47904u, property::type::LVT},
-  {47905u, property::type::LVT},
-  {47906u, property::type::LVT},
-  {47907u, property::type::LVT},
-  {47908u, property::type::LVT},
-  {47909u, property::type::LVT},
-  {47910u, property::type::LVT},
-  {47911u, property::type::LVT},
-  {47912u, property::type::LVT},
-  {47913u, property::type::LVT},
-  {47914u, property::type::LVT},
-  {47915u, property::type::LVT},
-  {47916u, property::type::LVT},
-  {47917u, property::type::LVT},
-  {47918u, property::type::LVT},
-  {47919u, property::type::LVT},
-  {47920u, property::type::LVT},
-  {47921u, property::type::LVT},
-  {47922u, property::type::LVT},
-  {47923u, property::type::LVT},
-  {47925u, property::type::LVT},
-  {47926u, property::type::LVT},
-  {47927u, property::type::LVT},
-  {47928u, property::type::LVT},
-  {47929u, property::type::LVT},
-  {47930u, property::type::LVT},
-  {47931u, property::type::LVT},
-  {47932u, property::type::LVT},
-  {47933u, property::type::LVT},
-  {47934u, property::type::LVT},
-  {47935u, property::type::LVT},
-  {47936u, property::type::LVT},
-  {47937u, property::type::LVT},
-  {47938u, property::type::LVT},
-  {47939u, property::type::LVT},
-  {47940u, property::type::LVT},
-  {47941u, property::type::LVT},
-  {47942u, property::type::LVT},
-  {47943u, property::type::LVT},
-  {47944u, property::type::LVT},
-  {47945u, property::type::LVT},
-  {47946u, property::type::LVT},
-  {47947u, property::type::LVT},
-  {47948u, property::type::LVT},
-  {47949u, property::type::LVT},
-  {47950u, property::type::LVT},
-  {47951u, property::type::LVT},
-  {47953u, property::type::LVT},
-  {47954u, property::type::LVT},
-  {47955u, property::type::LVT},
-  {47956u, property::type::LVT},
-  {47957u, property::type::LVT},
-  {47958u, property::type::LVT},
-  {47959u, property::type::LVT},
-  {47960u, property::type::LVT},
-  {47961u, property::type::LVT},
-  {47962u, property::type::LVT},
-  {47963u, property::type::LVT},
-  {47964u, property::type::LVT},
-  {47965u, property::type::LVT},
-  {47966u, property::type::LVT},
-  {47967u, property::type::LVT},
-  {47968u, property::type::LVT},
-  {47969u, property::type::LVT},
-  {47970u, property::type::LVT},
-  {47971u, property::type::LVT},
-  {47972u, property::type::LVT},
-  {47973u, property::type::LVT},
-  {47974u, property::type::LVT},
-  {47975u, property::type::LVT},
-  {47976u, property::type::LVT},
-  {47977u, property::type::LVT},
-  {47978u, property::type::LVT},
-  {47979u, property::type::LVT},
-  {47981u, property::type::LVT},
-  {47982u, property::type::LVT},
-  {47983u, property::type::LVT},
-  {47984u, property::type::LVT},
-  {47985u, property::type::LVT},
-  {47986u, property::type::LVT},
-  {47987u, property::type::LVT},
-  {47988u, property::type::LVT},
-  {47989u, property::type::LVT},
-  {47990u, property::type::LVT},
-  {47991u, property::type::LVT},
-  {47992u, property::type::LVT},
-  {47993u, property::type::LVT},
-  {47994u, property::type::LVT},
-  {47995u, property::type::LVT},
-  {47996u, property::type::LVT},
-  {47997u, property::type::LVT},
-  {47998u, property::type::LVT},
-  {47999u, property::type::LVT},
-  {48000u, property::type::LVT},
-  {48001u, property::type::LVT},
-  {48002u, property::type::LVT},
-  {48003u, property::type::LVT},
-  {48004u, property::type::LVT},
-  {48005u, property::type::LVT},
-  {48006u, property::type::LVT},
-  {48007u, property::type::LVT},
-  {48009u, property::type::LVT},
-  {48010u, property::type::LVT},
-  {48011u, property::type::LVT},
-  {48012u, property::type::LVT},
-  {48013u, property::type::LVT},
-  {48014u, property::type::LVT},
-  {48015u, property::type::LVT},
-  {48016u, property::type::LVT},
-  {48017u, property::type::LVT},
-  {48018u, property::type::LVT},
-  {48019u, property::type::LVT},
-  {48020u, property::type::LVT},
-  {48021u, property::type::LVT},
-  {48022u, property::type::LVT},
-  {48023u, property::type::LVT},
-  {48024u, property::type::LVT},
-  {48025u, property::type::LVT},
-  {48026u, property::type::LVT},
-  {48027u, property::type::LVT},
-  {48028u, property::type::LVT},
-  {48029u, property::type::LVT},
-  {48030u, property::type::LVT},
-  {48031u, property::type::LVT},
-  {48032u, property::type::LVT},
-  {48033u, property::type::LVT},
-  {48034u, property::type::LVT},
-  {48035u, property::type::LVT},
-  {48037u, property::type::LVT},
-  {48038u, property::type::LVT},
-  {48039u, property::type::LVT},
-  {48040u, property::type::LVT},
-  {48041u, property::type::LVT},
-  {48042u, property::type::LVT},
-  {48043u, property::type::LVT},
-  {48044u, property::type::LVT},
-  {48045u, property::type::LVT},
-  {48046u, property::type::LVT},
-  {48047u, property::type::LVT},
-  {48048u, property::type::LVT},
-  {48049u, property::type::LVT},
-  {48050u, property::type::LVT},
-  {48051u, property::type::LVT},
-  {48052u, property::type::LVT},
-  {48053u, property::type::LVT},
-  {48054u, property::type::LVT},
-  {48055u, property::type::LVT},
-  {48056u, property::type::LVT},
-  {48057u, property::type::LVT},
-  {48058u, property::type::LVT},
-  {48059u, property::type::LVT},
-  {48060u, property::type::LVT},
-  {48061u, property::type::LVT},
-  {48062u, property::type::LVT},
-  {48063u, property::type::LVT},
-  {48065u, property::type::LVT},
-  {48066u, property::type::LVT},
-  {48067u, property::type::LVT},
-  {48068u, property::type::LVT},
-  {48069u, property::type::LVT},
-  {48070u, property::type::LVT},
-  {48071u, property::type::LVT},
-  {48072u, property::type::LVT},
-  {48073u, property::type::LVT},
-  {48074u, property::type::LVT},
-  {48075u, property::type::LVT},
-  {48076u, property::type::LVT},
-  {48077u, property::type::LVT},
-  {48078u, property::type::LVT},
-  {48079u, property::type::LVT},
-  {48080u, property::type::LVT},
-  {48081u, property::type::LVT},
-  {48082u, property::type::LVT},
-  {48083u, property::type::LVT},
-  {48084u, property::type::LVT},
-  {48085u, property::type::LVT},
-  {48086u, property::type::LVT},
-  {48087u, property::type::LVT},
-  {48088u, property::type::LVT},
-  {48089u, property::type::LVT},
-  {48090u, property::type::LVT},
-  {48091u, property::type::LVT},
-  {48093u, property::type::LVT},
-  {48094u, property::type::LVT},
-  {48095u, property::type::LVT},
-  {48096u, property::type::LVT},
-  {48097u, property::type::LVT},
-  {48098u, property::type::LVT},
-  {48099u, property::type::LVT},
-  {48100u, property::type::LVT},
-  {48101u, property::type::LVT},
-  {48102u, property::type::LVT},
-  {48103u, property::type::LVT},
-  {48104u, property::type::LVT},
-  {48105u, property::type::LVT},
-  {48106u, property::type::LVT},
-  {48107u, property::type::LVT},
-  {48108u, property::type::LVT},
-  {48109u, property::type::LVT},
-  {48110u, property::type::LVT},
-  {48111u, property::type::LVT},
-  {48112u, property::type::LVT},
-  {48113u, property::type::LVT},
-  {48114u, property::type::LVT},
-  {48115u, property::type::LVT},
-  {48116u, property::type::LVT},
-  {48117u, property::type::LVT},
-  {48118u, property::type::LVT},
-  {48119u, property::type::LVT},
-  {48121u, property::type::LVT},
-  {48122u, property::type::LVT},
-  {48123u, property::type::LVT},
-  {48124u, property::type::LVT},
-  {48125u, property::type::LVT},
-  {48126u, property::type::LVT},
-  {48127u, property::type::LVT},
-  {48128u, property::type::LVT},
-  {48129u, property::type::LVT},
-  {48130u, property::type::LVT},
-  {48131u, property::type::LVT},
-  {48132u, property::type::LVT},
-  {48133u, property::type::LVT},
-  {48134u, property::type::LVT},
-  {48135u, property::type::LVT},
-  {48136u, property::type::LVT},
-  {48137u, property::type::LVT},
-  {48138u, property::type::LVT},
-  {48139u, property::type::LVT},
-  {48140u, property::type::LVT},
-  {48141u, property::type::LVT},
-  {48142u, property::type::LVT},
-  {48143u, property::type::LVT},
-  {48144u, property::type::LVT},
-  {48145u, property::type::LVT},
-  {48146u, property::type::LVT},
-  {48147u, property::type::LVT},
-  {48149u, property::type::LVT},
-  {48150u, property::type::LVT},
-  {48151u, property::type::LVT},
-  {48152u, property::type::LVT},
-  {48153u, property::type::LVT},
-  {48154u, property::type::LVT},
-  {48155u, property::type::LVT},
-  {48156u, property::type::LVT},
-  {48157u, property::type::LVT},
-  {48158u, property::type::LVT},
-  {48159u, property::type::LVT},
-  {48160u, property::type::LVT},
-  {48161u, property::type::LVT},
-  {48162u, property::type::LVT},
-  {48163u, property::type::LVT},
-  {48164u, property::type::LVT},
-  {48165u, property::type::LVT},
-  {48166u, property::type::LVT},
-  {48167u, property::type::LVT},
-  {48168u, property::type::LVT},
-  {48169u, property::type::LVT},
-  {48170u, property::type::LVT},
-  {48171u, property::type::LVT},
-  {48172u, property::type::LVT},
-  {48173u, property::type::LVT},
-  {48174u, property::type::LVT},
-  {48175u, property::type::LVT},
-  {48177u, property::type::LVT},
-  {48178u, property::type::LVT},
-  {48179u, property::type::LVT},
-  {48180u, property::type::LVT},
-  {48181u, property::type::LVT},
-  {48182u, property::type::LVT},
-  {48183u, property::type::LVT},
-  {48184u, property::type::LVT},
-  {48185u, property::type::LVT},
-  {48186u, property::type::LVT},
-  {48187u, property::type::LVT},
-  {48188u, property::type::LVT},
-  {48189u, property::type::LVT},
-  {48190u, property::type::LVT},
-  {48191u, property::type::LVT},
-  {48192u, property::type::LVT},
-  {48193u, property::type::LVT},
-  {48194u, property::type::LVT},
-  {48195u, property::type::LVT},
-  {48196u, property::type::LVT},
-  {48197u, property::type::LVT},
-  {48198u, property::type::LVT},
-  {48199u, property::type::LVT},
-  {48200u, property::type::LVT},
-  {48201u, property::type::LVT},
-  {48202u, property::type::LVT},
-  {48203u, property::type::LVT},
-  {48205u, property::type::LVT},
-  {48206u, property::type::LVT},
-  {48207u, property::type::LVT},
-  {48208u, property::type::LVT},
-  {48209u, property::type::LVT},
-  {48210u, property::type::LVT},
-  {48211u, property::type::LVT},
-  {48212u, property::type::LVT},
-  {48213u, property::type::LVT},
-  {48214u, property::type::LVT},
-  {48215u, property::type::LVT},
-  {48216u, property::type::LVT},
-  {48217u, property::type::LVT},
-  {48218u, property::type::LVT},
-  {48219u, property::type::LVT},
-  {48220u, property::type::LVT},
-  {48221u, property::type::LVT},
-  {48222u, property::type::LVT},
-  {48223u, property::type::LVT},
-  {48224u, property::type::LVT},
-  {48225u, property::type::LVT},
-  {48226u, property::type::LVT},
-  {48227u, property::type::LVT},
-  {48228u, property::type::LVT},
-  {48229u, property::type::LVT},
-  {48230u, property::type::LVT},
-  {48231u, property::type::LVT},
-  {48233u, property::type::LVT},
-  {48234u, property::type::LVT},
-  {48235u, property::type::LVT},
-  {48236u, property::type::LVT},
-  {48237u, property::type::LVT},
-  {48238u, property::type::LVT},
-  {48239u, property::type::LVT},
-  {48240u, property::type::LVT},
-  {48241u, property::type::LVT},
-  {48242u, property::type::LVT},
-  {48243u, property::type::LVT},
-  {48244u, property::type::LVT},
-  {48245u, property::type::LVT},
-  {48246u, property::type::LVT},
-  {48247u, property::type::LVT},
-  {48248u, property::type::LVT},
-  {48249u, property::type::LVT},
-  {48250u, property::type::LVT},
-  {48251u, property::type::LVT},
-  {48252u, property::type::LVT},
-  {48253u, property::type::LVT},
-  {48254u, property::type::LVT},
-  {48255u, property::type::LVT},
-  {48256u, property::type::LVT},
-  {48257u, property::type::LVT},
-  {48258u, property::type::LVT},
-  {48259u, property::type::LVT},
-  {48261u, property::type::LVT},
-  {48262u, property::type::LVT},
-  {48263u, property::type::LVT},
-  {48264u, property::type::LVT},
-  {48265u, property::type::LVT},
-  {48266u, property::type::LVT},
-  {48267u, property::type::LVT},
-  {48268u, property::type::LVT},
-  {48269u, property::type::LVT},
-  {48270u, property::type::LVT},
-  {48271u, property::type::LVT},
-  {48272u, property::type::LVT},
-  {48273u, property::type::LVT},
-  {48274u, property::type::LVT},
-  {48275u, property::type::LVT},
-  {48276u, property::type::LVT},
-  {48277u, property::type::LVT},
-  {48278u, property::type::LVT},
-  {48279u, property::type::LVT},
-  {48280u, property::type::LVT},
-  {48281u, property::type::LVT},
-  {48282u, property::type::LVT},
-  {48283u, property::type::LVT},
-  {48284u, property::type::LVT},
-  {48285u, property::type::LVT},
-  {48286u, property::type::LVT},
-  {48287u, property::type::LVT},
-  {48289u, property::type::LVT},
-  {48290u, property::type::LVT},
-  {48291u, property::type::LVT},
-  {48292u, property::type::LVT},
-  {48293u, property::type::LVT},
-  {48294u, property::type::LVT},
-  {48295u, property::type::LVT},
-  {48296u, property::type::LVT},
-  {48297u, property::type::LVT},
-  {48298u, property::type::LVT},
-  {48299u, property::type::LVT},
-  {48300u, property::type::LVT},
-  {48301u, property::type::LVT},
-  {48302u, property::type::LVT},
-  {48303u, property::type::LVT},
-  {48304u, property::type::LVT},
-  {48305u, property::type::LVT},
-  {48306u, property::type::LVT},
-  {48307u, property::type::LVT},
-  {48308u, property::type::LVT},
-  {48309u, property::type::LVT},
-  {48310u, property::type::LVT},
-  {48311u, property::type::LVT},
-  {48312u, property::type::LVT},
-  {48313u, property::type::LVT},
-  {48314u, property::type::LVT},
-  {48315u, property::type::LVT},
-  {48317u, property::type::LVT},
-  {48318u, property::type::LVT},
-  {48319u, property::type::LVT},
-  {48320u, property::type::LVT},
-  {48321u, property::type::LVT},
-  {48322u, property::type::LVT},
-  {48323u, property::type::LVT},
-  {48324u, property::type::LVT},
-  {48325u, property::type::LVT},
-  {48326u, property::type::LVT},
-  {48327u, property::type::LVT},
-  {48328u, property::type::LVT},
-  {48329u, property::type::LVT},
-  {48330u, property::type::LVT},
-  {48331u, property::type::LVT},
-  {48332u, property::type::LVT},
-  {48333u, property::type::LVT},
-  {48334u, property::type::LVT},
-  {48335u, property::type::LVT},
-  {48336u, property::type::LVT},
-  {48337u, property::type::LVT},
-  {48338u, property::type::LVT},
-  {48339u, property::type::LVT},
-  {48340u, property::type::LVT},
-  {48341u, property::type::LVT},
-  {48342u, property::type::LVT},
-  {48343u, property::type::LVT},
-  {48345u, property::type::LVT},
-  {48346u, property::type::LVT},
-  {48347u, property::type::LVT},
-  {48348u, property::type::LVT},
-  {48349u, property::type::LVT},
-  {48350u, property::type::LVT},
-  {48351u, property::type::LVT},
-  {48352u, property::type::LVT},
-  {48353u, property::type::LVT},
-  {48354u, property::type::LVT},
-  {48355u, property::type::LVT},
-  {48356u, property::type::LVT},
-  {48357u, property::type::LVT},
-  {48358u, property::type::LVT},
-  {48359u, property::type::LVT},
-  {48360u, property::type::LVT},
-  {48361u, property::type::LVT},
-  {48362u, property::type::LVT},
-  {48363u, property::type::LVT},
-  {48364u, property::type::LVT},
-  {48365u, property::type::LVT},
-  {48366u, property::type::LVT},
-  {48367u, property::type::LVT},
-  {48368u, property::type::LVT},
-  {48369u, property::type::LVT},
-  {48370u, property::type::LVT},
-  {48371u, property::type::LVT},
-  {48373u, property::type::LVT},
-  {48374u, property::type::LVT},
-  {48375u, property::type::LVT},
-  {48376u, property::type::LVT},
-  {48377u, property::type::LVT},
-  {48378u, property::type::LVT},
-  {48379u, property::type::LVT},
-  {48380u, property::type::LVT},
-  {48381u, property::type::LVT},
-  {48382u, property::type::LVT},
-  {48383u, property::type::LVT},
-  {48384u, property::type::LVT},
-  {48385u, property::type::LVT},
-  {48386u, property::type::LVT},
-  {48387u, property::type::LVT},
-  {48388u, property::type::LVT},
-  {48389u, property::type::LVT},
-  {48390u, property::type::LVT},
-  {48391u, property::type::LVT},
-  {48392u, property::type::LVT},
-  {48393u, property::type::LVT},
-  {48394u, property::type::LVT},
-  {48395u, property::type::LVT},
-  {48396u, property::type::LVT},
-  {48397u, property::type::LVT},
-  {48398u, property::type::LVT},
-  {48399u, property::type::LVT},
-  {48401u, property::type::LVT},
-  {48402u, property::type::LVT},
-  {48403u, property::type::LVT},
-  {48404u, property::type::LVT},
-  {48405u, property::type::LVT},
-  {48406u, property::type::LVT},
-  {48407u, property::type::LVT},
-  {48408u, property::type::LVT},
-  {48409u, property::type::LVT},
-  {48410u, property::type::LVT},
-  {48411u, property::type::LVT},
-  {48412u, property::type::LVT},
-  {48413u, property::type::LVT},
-  {48414u, property::type::LVT},
-  {48415u, property::type::LVT},
-  {48416u, property::type::LVT},
-  {48417u, property::type::LVT},
-  {48418u, property::type::LVT},
-  {48419u, property::type::LVT},
-  {48420u, property::type::LVT},
-  {48421u, property::type::LVT},
-  {48422u, property::type::LVT},
-  {48423u, property::type::LVT},
-  {48424u, property::type::LVT},
-  {48425u, property::type::LVT},
-  {48426u, property::type::LVT},
-  {48427u, property::type::LVT},
-  {48429u, property::type::LVT},
-  {48430u, property::type::LVT},
-  {48431u, property::type::LVT},
-  {48432u, property::type::LVT},
-  {48433u, property::type::LVT},
-  {48434u, property::type::LVT},
-  {48435u, property::type::LVT},
-  {48436u, property::type::LVT},
-  {48437u, property::type::LVT},
-  {48438u, property::type::LVT},
-  {48439u, property::type::LVT},
-  {48440u, property::type::LVT},
-  {48441u, property::type::LVT},
-  {48442u, property::type::LVT},
-  {48443u, property::type::LVT},
-  {48444u, property::type::LVT},
-  {48445u, property::type::LVT},
-  {48446u, property::type::LVT},
-  {48447u, property::type::LVT},
-  {48448u, property::type::LVT},
-  {48449u, property::type::LVT},
-  {48450u, property::type::LVT},
-  {48451u, property::type::LVT},
-  {48452u, property::type::LVT},
-  {48453u, property::type::LVT},
-  {48454u, property::type::LVT},
-  {48455u, property::type::LVT},
-  {48457u, property::type::LVT},
-  {48458u, property::type::LVT},
-  {48459u, property::type::LVT},
-  {48460u, property::type::LVT},
-  {48461u, property::type::LVT},
-  {48462u, property::type::LVT},
-  {48463u, property::type::LVT},
-  {48464u, property::type::LVT},
-  {48465u, property::type::LVT},
-  {48466u, property::type::LVT},
-  {48467u, property::type::LVT},
-  {48468u, property::type::LVT},
-  {48469u, property::type::LVT},
-  {48470u, property::type::LVT},
-  {48471u, property::type::LVT},
-  {48472u, property::type::LVT},
-  {48473u, property::type::LVT},
-  {48474u, property::type::LVT},
-  {48475u, property::type::LVT},
-  {48476u, property::type::LVT},
-  {48477u, property::type::LVT},
-  {48478u, property::type::LVT},
-  {48479u, property::type::LVT},
-  {48480u, property::type::LVT},
-  {48481u, property::type::LVT},
-  {48482u, property::type::LVT},
-  {48483u, property::type::LVT},
-  {48485u, property::type::LVT},
-  {48486u, property::type::LVT},
-  {48487u, property::type::LVT},
-  {48488u, property::type::LVT},
-  {48489u, property::type::LVT},
-  {48490u, property::type::LVT},
-  {48491u, property::type::LVT},
-  {48492u, property::type::LVT},
-  {48493u, property::type::LVT},
-  {48494u, property::type::LVT},
-  {48495u, property::type::LVT},
-  {48496u, property::type::LVT},
-  {48497u, property::type::LVT},
-  {48498u, property::type::LVT},
-  {48499u, property::type::LVT},
-  {48500u, property::type::LVT},
-  {48501u, property::type::LVT},
-  {48502u, property::type::LVT},
-  {48503u, property::type::LVT},
-  {48504u, property::type::LVT},
-  {48505u, property::type::LVT},
-  {48506u, property::type::LVT},
-  {48507u, property::type::LVT},
-  {48508u, property::type::LVT},
-  {48509u, property::type::LVT},
-  {48510u, property::type::LVT},
-  {48511u, property::type::LVT},
-  {48513u, property::type::LVT},
-  {48514u, property::type::LVT},
-  {48515u, property::type::LVT},
-  {48516u, property::type::LVT},
-  {48517u, property::type::LVT},
-  {48518u, property::type::LVT},
-  {48519u, property::type::LVT},
-  {48520u, property::type::LVT},
-  {48521u, property::type::LVT},
-  {48522u, property::type::LVT},
-  {48523u, property::type::LVT},
-  {48524u, property::type::LVT},
-  {48525u, property::type::LVT},
-  {48526u, property::type::LVT},
-  {48527u, property::type::LVT},
-  {48528u, property::type::LVT},
-  {48529u, property::type::LVT},
-  {48530u, property::type::LVT},
-  {48531u, property::type::LVT},
-  {48532u, property::type::LVT},
-  {48533u, property::type::LVT},
-  {48534u, property::type::LVT},
-  {48535u, property::type::LVT},
-  {48536u, property::type::LVT},
-  {48537u, property::type::LVT},
-  {48538u, property::type::LVT},
-  {48539u, property::type::LVT},
-  {48541u, property::type::LVT},
-  {48542u, property::type::LVT},
-  {48543u, property::type::LVT},
-  {48544u, property::type::LVT},
-  {48545u, property::type::LVT},
-  {48546u, property::type::LVT},
-  {48547u, property::type::LVT},
-  {48548u, property::type::LVT},
-  {48549u, property::type::LVT},
-  {48550u, property::type::LVT},
-  {48551u, property::type::LVT},
-  {48552u, property::type::LVT},
-  {48553u, property::type::LVT},
-  {48554u, property::type::LVT},
-  {48555u, property::type::LVT},
-  {48556u, property::type::LVT},
-  {48557u, property::type::LVT},
-  {48558u, property::type::LVT},
-  {48559u, property::type::LVT},
-  {48560u, property::type::LVT},
-  {48561u, property::type::LVT},
-  {48562u, property::type::LVT},
-  {48563u, property::type::LVT},
-  {48564u, property::type::LVT},
-  {48565u, property::type::LVT},
-  {48566u, property::type::LVT},
-  {48567u, property::type::LVT},
-  {48569u, property::type::LVT},
-  {48570u, property::type::LVT},
-  {48571u, property::type::LVT},
-  {48572u, property::type::LVT},
-  {48573u, property::type::LVT},
-  {48574u, property::type::LVT},
-  {48575u, property::type::LVT},
-  {48576u, property::type::LVT},
-  {48577u, property::type::LVT},
-  {48578u, property::type::LVT},
-  {48579u, property::type::LVT},
-  {48580u, property::type::LVT},
-  {48581u, property::type::LVT},
-  {48582u, property::type::LVT},
-  {48583u, property::type::LVT},
-  {48584u, property::type::LVT},
-  {48585u, property::type::LVT},
-  {48586u, property::type::LVT},
-  {48587u, property::type::LVT},
-  {48588u, property::type::LVT},
-  {48589u, property::type::LVT},
-  {48590u, property::type::LVT},
-  {48591u, property::type::LVT},
-  {48592u, property::type::LVT},
-  {48593u, property::type::LVT},
-  {48594u, property::type::LVT},
-  {48595u, property::type::LVT},
-  {48597u, property::type::LVT},
-  {48598u, property::type::LVT},
-  {48599u, property::type::LVT},
-  {48600u, property::type::LVT},
-  {48601u, property::type::LVT},
-  {48602u, property::type::LVT},
-  {48603u, property::type::LVT},
-  {48604u, property::type::LVT},
-  {48605u, property::type::LVT},
-  {48606u, property::type::LVT},
-  {48607u, property::type::LVT},
-  {48608u, property::type::LVT},
-  {48609u, property::type::LVT},
-  {48610u, property::type::LVT},
-  {48611u, property::type::LVT},
-  {48612u, property::type::LVT},
-  {48613u, property::type::LVT},
-  {48614u, property::type::LVT},
-  {48615u, property::type::LVT},
-  {48616u, property::type::LVT},
-  {48617u, property::type::LVT},
-  {48618u, property::type::LVT},
-  {48619u, property::type::LVT},
-  {48620u, property::type::LVT},
-  {48621u, property::type::LVT},
-  {48622u, property::type::LVT},
-  {48623u, property::type::LVT},
-  {48625u, property::type::LVT},
-  {48626u, property::type::LVT},
-  {48627u, property::type::LVT},
-  {48628u, property::type::LVT},
-  {48629u, property::type::LVT},
-  {48630u, property::type::LVT},
-  {48631u, property::type::LVT},
-  {48632u, property::type::LVT},
-  {48633u, property::type::LVT},
-  {48634u, property::type::LVT},
-  {48635u, property::type::LVT},
-  {48636u, property::type::LVT},
-  {48637u, property::type::LVT},
-  {48638u, property::type::LVT},
-  {48639u, property::type::LVT},
-  {48640u, property::type::LVT},
-  {48641u, property::type::LVT},
-  {48642u, property::type::LVT},
-  {48643u, property::type::LVT},
-  {48644u, property::type::LVT},
-  {48645u, property::type::LVT},
-  {48646u, property::type::LVT},
-  {48647u, property::type::LVT},
-  {48648u, property::type::LVT},
-  {48649u, property::type::LVT},
-  {48650u, property::type::LVT},
-  {48651u, property::type::LVT},
-  {48653u, property::type::LVT},
-  {48654u, property::type::LVT},
-  {48655u, property::type::LVT},
-  {48656u, property::type::LVT},
-  {48657u, property::type::LVT},
-  {48658u, property::type::LVT},
-  {48659u, property::type::LVT},
-  {48660u, property::type::LVT},
-  {48661u, property::type::LVT},
-  {48662u, property::type::LVT},
-  {48663u, property::type::LVT},
-  {48664u, property::type::LVT},
-  {48665u, property::type::LVT},
-  {48666u, property::type::LVT},
-  {48667u, property::type::LVT},
-  {48668u, property::type::LVT},
-  {48669u, property::type::LVT},
-  {48670u, property::type::LVT},
-  {48671u, property::type::LVT},
-  {48672u, property::type::LVT},
-  {48673u, property::type::LVT},
-  {48674u, property::type::LVT},
-  {48675u, property::type::LVT},
-  {48676u, property::type::LVT},
-  {48677u, property::type::LVT},
-  {48678u, property::type::LVT},
-  {48679u, property::type::LVT},
-  {48681u, property::type::LVT},
-  {48682u, property::type::LVT},
-  {48683u, property::type::LVT},
-  {48684u, property::type::LVT},
-  {48685u, property::type::LVT},
-  {48686u, property::type::LVT},
-  {48687u, property::type::LVT},
-  {48688u, property::type::LVT},
-  {48689u, property::type::LVT},
-  {48690u, property::type::LVT},
-  {48691u, property::type::LVT},
-  {48692u, property::type::LVT},
-  {48693u, property::type::LVT},
-  {48694u, property::type::LVT},
-  {48695u, property::type::LVT},
-  {48696u, property::type::LVT},
-  {48697u, property::type::LVT},
-  {48698u, property::type::LVT},
-  {48699u, property::type::LVT},
-  {48700u, property::type::LVT},
-  {48701u, property::type::LVT},
-  {48702u, property::type::LVT},
-  {48703u, property::type::LVT},
-  {48704u, property::type::LVT},
-  {48705u, property::type::LVT},
-  {48706u, property::type::LVT},
-  {48707u, property::type::LVT},
-  {48709u, property::type::LVT},
-  {48710u, property::type::LVT},
-  {48711u, property::type::LVT},
-  {48712u, property::type::LVT},
-  {48713u, property::type::LVT},
-  {48714u, property::type::LVT},
-  {48715u, property::type::LVT},
-  {48716u, property::type::LVT},
-  {48717u, property::type::LVT},
-  {48718u, property::type::LVT},
-  {48719u, property::type::LVT},
-  {48720u, property::type::LVT},
-  {48721u, property::type::LVT},
-  {48722u, property::type::LVT},
-  {48723u, property::type::LVT},
-  {48724u, property::type::LVT},
-  {48725u, property::type::LVT},
-  {48726u, property::type::LVT},
-  {48727u, property::type::LVT},
-  {48728u, property::type::LVT},
-  {48729u, property::type::LVT},
-  {48730u, property::type::LVT},
-  {48731u, property::type::LVT},
-  {48732u, property::type::LVT},
-  {48733u, property::type::LVT},
-  {48734u, property::type::LVT},
-  {48735u, property::type::LVT},
-  {48737u, property::type::LVT},
-  {48738u, property::type::LVT},
-  {48739u, property::type::LVT},
-  {48740u, property::type::LVT},
-  {48741u, property::type::LVT},
-  {48742u, property::type::LVT},
-  {48743u, property::type::LVT},
-  {48744u, property::type::LVT},
-  {48745u, property::type::LVT},
-  {48746u, property::type::LVT},
-  {48747u, property::type::LVT},
-  {48748u, property::type::LVT},
-  {48749u, property::type::LVT},
-  {48750u, property::type::LVT},
-  {48751u, property::type::LVT},
-  {48752u, property::type::LVT},
-  {48753u, property::type::LVT},
-  {48754u, property::type::LVT},
-  {48755u, property::type::LVT},
-  {48756u, property::type::LVT},
-  {48757u, property::type::LVT},
-  {48758u, property::type::LVT},
-  {48759u, property::type::LVT},
-  {48760u, property::type::LVT},
-  {48761u, property::type::LVT},
-  {48762u, property::type::LVT},
-  {48763u, property::type::LVT},
-  {48765u, property::type::LVT},
-  {48766u, property::type::LVT},
-  {48767u, property::type::LVT},
-  {48768u, property::type::LVT},
-  {48769u, property::type::LVT},
-  {48770u, property::type::LVT},
-  {48771u, property::type::LVT},
-  {48772u, property::type::LVT},
-  {48773u, property::type::LVT},
-  {48774u, property::type::LVT},
-  {48775u, property::type::LVT},
-  {48776u, property::type::LVT},
-  {48777u, property::type::LVT},
-  {48778u, property::type::LVT},
-  {48779u, property::type::LVT},
-  {48780u, property::type::LVT},
-  {48781u, property::type::LVT},
-  {48782u, property::type::LVT},
-  {48783u, property::type::LVT},
-  {48784u, property::type::LVT},
-  {48785u, property::type::LVT},
-  {48786u, property::type::LVT},
-  {48787u, property::type::LVT},
-  {48788u, property::type::LVT},
-  {48789u, property::type::LVT},
-  {48790u, property::type::LVT},
-  {48791u, property::type::LVT},
-  {48793u, property::type::LVT},
-  {48794u, property::type::LVT},
-  {48795u, property::type::LVT},
-  {48796u, property::type::LVT},
-  {48797u, property::type::LVT},
-  {48798u, property::type::LVT},
-  {48799u, property::type::LVT},
-  {48800u, property::type::LVT},
-  {48801u, property::type::LVT},
-  {48802u, property::type::LVT},
-  {48803u, property::type::LVT},
-  {48804u, property::type::LVT},
-  {48805u, property::type::LVT},
-  {48806u, property::type::LVT},
-  {48807u, property::type::LVT},
-  {48808u, property::type::LVT},
-  {48809u, property::type::LVT},
-  {48810u, property::type::LVT},
-  {48811u, property::type::LVT},
-  {48812u, property::type::LVT},
-  {48813u, property::type::LVT},
-  {48814u, property::type::LVT},
-  {48815u, property::type::LVT},
-  {48816u, property::type::LVT},
-  {48817u, property::type::LVT},
-  {48818u, property::type::LVT},
-  {48819u, property::type::LVT},
-  {48821u, property::type::LVT},
-  {48822u, property::type::LVT},
-  {48823u, property::type::LVT},
-  {48824u, property::type::LVT},
-  {48825u, property::type::LVT},
-  {48826u, property::type::LVT},
-  {48827u, property::type::LVT},
-  {48828u, property::type::LVT},
-  {48829u, property::type::LVT},
-  {48830u, property::type::LVT},
-  {48831u, property::type::LVT},
-  {48832u, property::type::LVT},
-  {48833u, property::type::LVT},
-  {48834u, property::type::LVT},
-  {48835u, property::type::LVT},
-  {48836u, property::type::LVT},
-  {48837u, property::type::LVT},
-  {48838u, property::type::LVT},
-  {48839u, property::type::LVT},
-  {48840u, property::type::LVT},
-  {48841u, property::type::LVT},
-  {48842u, property::type::LVT},
-  {48843u, property::type::LVT},
-  {48844u, property::type::LVT},
-  {48845u, property::type::LVT},
-  {48846u, property::type::LVT},
-  {48847u, property::type::LVT},
-  {48849u, property::type::LVT},
-  {48850u, property::type::LVT},
-  {48851u, property::type::LVT},
-  {48852u, property::type::LVT},
-  {48853u, property::type::LVT},
-  {48854u, property::type::LVT},
-  {48855u, property::type::LVT},
-  {48856u, property::type::LVT},
-  {48857u, property::type::LVT},
-  {48858u, property::type::LVT},
-  {48859u, property::type::LVT},
-  {48860u, property::type::LVT},
-  {48861u, property::type::LVT},
-  {48862u, property::type::LVT},
-  {48863u, property::type::LVT},
-  {48864u, property::type::LVT},
-  {48865u, property::type::LVT},
-  {48866u, property::type::LVT},
-  {48867u, property::type::LVT},
-  {48868u, property::type::LVT},
-  {48869u, property::type::LVT},
-  {48870u, property::type::LVT},
-  {48871u, property::type::LVT},
-  {48872u, property::type::LVT},
-  {48873u, property::type::LVT},
-  {48874u, property::type::LVT},
-  {48875u, property::type::LVT},
-  {48877u, property::type::LVT},
-  {48878u, property::type::LVT},
-  {48879u, property::type::LVT},
-  {48880u, property::type::LVT},
-  {48881u, property::type::LVT},
-  {48882u, property::type::LVT},
-  {48883u, property::type::LVT},
-  {48884u, property::type::LVT},
-  {48885u, property::type::LVT},
-  {48886u, property::type::LVT},
-  {48887u, property::type::LVT},
-  {48888u, property::type::LVT},
-  {48889u, property::type::LVT},
-  {48890u, property::type::LVT},
-  {48891u, property::type::LVT},
-  {48892u, property::type::LVT},
-  {48893u, property::type::LVT},
-  {48894u, property::type::LVT},
-  {48895u, property::type::LVT},
-  {48896u, property::type::LVT},
-  {48897u, property::type::LVT},
-  {48898u, property::type::LVT},
-  {48899u, property::type::LVT},
-  {48900u, property::type::LVT},
-  {48901u, property::type::LVT},
-  {48902u, property::type::LVT},
-  {48903u, property::type::LVT},
-  {48905u, property::type::LVT},
-  {48906u, property::type::LVT},
-  {48907u, property::type::LVT},
-  {48908u, property::type::LVT},
-  {48909u, property::type::LVT},
-  {48910u, property::type::LVT},
-  {48911u, property::type::LVT},
-  {48912u, property::type::LVT},
-  {48913u, property::type::LVT},
-  {48914u, property::type::LVT},
-  {48915u, property::type::LVT},
-  {48916u, property::type::LVT},
-  {48917u, property::type::LVT},
-  {48918u, property::type::LVT},
-  {48919u, property::type::LVT},
-  {48920u, property::type::LVT},
-  {48921u, property::type::LVT},
-  {48922u, property::type::LVT},
-  {48923u, property::type::LVT},
-  {48924u, property::type::LVT},
-  {48925u, property::type::LVT},
-  {48926u, property::type::LVT},
-  {48927u, property::type::LVT},
-  {48928u, property::type::LVT},
-  {48929u, property::type::LVT},
-  {48930u, property::type::LVT},
-  {48931u, property::type::LVT},
-  {48933u, property::type::LVT},
-  {48934u, property::type::LVT},
-  {48935u, property::type::LVT},
-  {48936u, property::type::LVT},
-  {48937u, property::type::LVT},
-  {48938u, property::type::LVT},
-  {48939u, property::type::LVT},
-  {48940u, property::type::LVT},
-  {48941u, property::type::LVT},
-  {48942u, property::type::LVT},
-  {48943u, property::type::LVT},
-  {48944u, property::type::LVT},
-  {48945u, property::type::LVT},
-  {48946u, property::type::LVT},
-  {48947u, property::type::LVT},
-  {48948u, property::type::LVT},
-  {48949u, property::type::LVT},
-  {48950u, property::type::LVT},
-  {48951u, property::type::LVT},
-  {48952u, property::type::LVT},
-  {48953u, property::type::LVT},
-  {48954u, property::type::LVT},
-  {48955u, property::type::LVT},
-  {48956u, property::type::LVT},
-  {48957u, property::type::LVT},
-  {48958u, property::type::LVT},
-  {48959u, property::type::LVT},
-  {48961u, property::type::LVT},
-  {48962u, property::type::LVT},
-  {48963u, property::type::LVT},
-  {48964u, property::type::LVT},
-  {48965u, property::type::LVT},
-  {48966u, property::type::LVT},
-  {48967u, property::type::LVT},
-  {48968u, property::type::LVT},
-  {48969u, property::type::LVT},
-  {48970u, property::type::LVT},
-  {48971u, property::type::LVT},
-  {48972u, property::type::LVT},
-  {48973u, property::type::LVT},
-  {48974u, property::type::LVT},
-  {48975u, property::type::LVT},
-  {48976u, property::type::LVT},
-  {48977u, property::type::LVT},
-  {48978u, property::type::LVT},
-  {48979u, property::type::LVT},
-  {48980u, property::type::LVT},
-  {48981u, property::type::LVT},
-  {48982u, property::type::LVT},
-  {48983u, property::type::LVT},
-  {48984u, property::type::LVT},
-  {48985u, property::type::LVT},
-  {48986u, property::type::LVT},
-  {48987u, property::type::LVT},
-  {48989u, property::type::LVT},
-  {48990u, property::type::LVT},
-  {48991u, property::type::LVT},
-  {48992u, property::type::LVT},
-  {48993u, property::type::LVT},
-  {48994u, property::type::LVT},
-  {48995u, property::type::LVT},
-  {48996u, property::type::LVT},
-  {48997u, property::type::LVT},
-  {48998u, property::type::LVT},
-  {48999u, property::type::LVT},
-  {49000u, property::type::LVT},
-  {49001u, property::type::LVT},
-  {49002u, property::type::LVT},
-  {49003u, property::type::LVT},
-  {49004u, property::type::LVT},
-  {49005u, property::type::LVT},
-  {49006u, property::type::LVT},
-  {49007u, property::type::LVT},
-  {49008u, property::type::LVT},
-  {49009u, property::type::LVT},
-  {49010u, property::type::LVT},
-  {49011u, property::type::LVT},
-  {49012u, property::type::LVT},
-  {49013u, property::type::LVT},
-  {49014u, property::type::LVT},
-  {49015u, property::type::LVT},
-  {49017u, property::type::LVT},
-  {49018u, property::type::LVT},
-  {49019u, property::type::LVT},
-  {49020u, property::type::LVT},
-  {49021u, property::type::LVT},
-  {49022u, property::type::LVT},
-  {49023u, property::type::LVT},
-  {49024u, property::type::LVT},
-  {49025u, property::type::LVT},
-  {49026u, property::type::LVT},
-  {49027u, property::type::LVT},
-  {49028u, property::type::LVT},
-  {49029u, property::type::LVT},
-  {49030u, property::type::LVT},
-  {49031u, property::type::LVT},
-  {49032u, property::type::LVT},
-  {49033u, property::type::LVT},
-  {49034u, property::type::LVT},
-  {49035u, property::type::LVT},
-  {49036u, property::type::LVT},
-  {49037u, property::type::LVT},
-  {49038u, property::type::LVT},
-  {49039u, property::type::LVT},
-  {49040u, property::type::LVT},
-  {49041u, property::type::LVT},
-  {49042u, property::type::LVT},
-  {49043u, property::type::LVT},
-  {49045u, property::type::LVT},
-  {49046u, property::type::LVT},
-  {49047u, property::type::LVT},
-  {49048u, property::type::LVT},
-  {49049u, property::type::LVT},
-  {49050u, property::type::LVT},
-  {49051u, property::type::LVT},
-  {49052u, property::type::LVT},
-  {49053u, property::type::LVT},
-  {49054u, property::type::LVT},
-  {49055u, property::type::LVT},
-  {49056u, property::type::LVT},
-  {49057u, property::type::LVT},
-  {49058u, property::type::LVT},
-  {49059u, property::type::LVT},
-  {49060u, property::type::LVT},
-  {49061u, property::type::LVT},
-  {49062u, property::type::LVT},
-  {49063u, property::type::LVT},
-  {49064u, property::type::LVT},
-  {49065u, property::type::LVT},
-  {49066u, property::type::LVT},
-  {49067u, property::type::LVT},
-  {49068u, property::type::LVT},
-  {49069u, property::type::LVT},
-  {49070u, property::type::LVT},
-  {49071u, property::type::LVT},
-  {49073u, property::type::LVT},
-  {49074u, property::type::LVT},
-  {49075u, property::type::LVT},
-  {49076u, property::type::LVT},
-  {49077u, property::type::LVT},
-  {49078u, property::type::LVT},
-  {49079u, property::type::LVT},
-  {49080u, property::type::LVT},
-  {49081u, property::type::LVT},
-  {49082u, property::type::LVT},
-  {49083u, property::type::LVT},
-  {49084u, property::type::LVT},
-  {49085u, property::type::LVT},
-  {49086u, property::type::LVT},
-  {49087u, property::type::LVT},
-  {49088u, property::type::LVT},
-  {49089u, property::type::LVT},
-  {49090u, property::type::LVT},
-  {49091u, property::type::LVT},
-  {49092u, property::type::LVT},
-  {49093u, property::type::LVT},
-  {49094u, property::type::LVT},
-  {49095u, property::type::LVT},
-  {49096u, property::type::LVT},
-  {49097u, property::type::LVT},
-  {49098u, property::type::LVT},
-  {49099u, property::type::LVT},
-  {49101u, property::type::LVT},
-  {49102u, property::type::LVT},
-  {49103u, property::type::LVT},
-  {49104u, property::type::LVT},
-  {49105u, property::type::LVT},
-  {49106u, property::type::LVT},
-  {49107u, property::type::LVT},
-  {49108u, property::type::LVT},
-  {49109u, property::type::LVT},
-  {49110u, property::type::LVT},
-  {49111u, property::type::LVT},
-  {49112u, property::type::LVT},
-  {49113u, property::type::LVT},
-  {49114u, property::type::LVT},
-  {49115u, property::type::LVT},
-  {49116u, property::type::LVT},
-  {49117u, property::type::LVT},
-  {49118u, property::type::LVT},
-  {49119u, property::type::LVT},
-  {49120u, property::type::LVT},
-  {49121u, property::type::LVT},
-  {49122u, property::type::LVT},
-  {49123u, property::type::LVT},
-  {49124u, property::type::LVT},
-  {49125u, property::type::LVT},
-  {49126u, property::type::LVT},
-  {49127u, property::type::LVT},
-  {49129u, property::type::LVT},
-  {49130u, property::type::LVT},
-  {49131u, property::type::LVT},
-  {49132u, property::type::LVT},
-  {49133u, property::type::LVT},
-  {49134u, property::type::LVT},
-  {49135u, property::type::LVT},
-  {49136u, property::type::LVT},
-  {49137u, property::type::LVT},
-  {49138u, property::type::LVT},
-  {49139u, property::type::LVT},
-  {49140u, property::type::LVT},
-  {49141u, property::type::LVT},
-  {49142u, property::type::LVT},
-  {49143u, property::type::LVT},
-  {49144u, property::type::LVT},
-  {49145u, property::type::LVT},
-  {49146u, property::type::LVT},
-  {49147u, property::type::LVT},
-  {49148u, property::type::LVT},
-  {49149u, property::type::LVT},
-  {49150u, property::type::LVT},
-  {49151u, property::type::LVT},
-  {49152u, property::type::LVT},
-  {49153u, property::type::LVT},
-  {49154u, property::type::LVT},
-  {49155u, property::type::LVT},
-  {49157u, property::type::LVT},
-  {49158u, property::type::LVT},
-  {49159u, property::type::LVT},
-  {49160u, property::type::LVT},
-  {49161u, property::type::LVT},
-  {49162u, property::type::LVT},
-  {49163u, property::type::LVT},
-  {49164u, property::type::LVT},
-  {49165u, property::type::LVT},
-  {49166u, property::type::LVT},
-  {49167u, property::type::LVT},
-  {49168u, property::type::LVT},
-  {49169u, property::type::LVT},
-  {49170u, property::type::LVT},
-  {49171u, property::type::LVT},
-  {49172u, property::type::LVT},
-  {49173u, property::type::LVT},
-  {49174u, property::type::LVT},
-  {49175u, property::type::LVT},
-  {49176u, property::type::LVT},
-  {49177u, property::type::LVT},
-  {49178u, property::type::LVT},
-  {49179u, property::type::LVT},
-  {49180u, property::type::LVT},
-  {49181u, property::type::LVT},
-  {49182u, property::type::LVT},
-  {49183u, property::type::LVT},
-  {49185u, property::type::LVT},
-  {49186u, property::type::LVT},
-  {49187u, property::type::LVT},
-  {49188u, property::type::LVT},
-  {49189u, property::type::LVT},
-  {49190u, property::type::LVT},
-  {49191u, property::type::LVT},
-  {49192u, property::type::LVT},
-  {49193u, property::type::LVT},
-  {49194u, property::type::LVT},
-  {49195u, property::type::LVT},
-  {49196u, property::type::LVT},
-  {49197u, property::type::LVT},
-  {49198u, property::type::LVT},
-  {49199u, property::type::LVT},
-  {49200u, property::type::LVT},
-  {49201u, property::type::LVT},
-  {49202u, property::type::LVT},
-  {49203u, property::type::LVT},
-  {49204u, property::type::LVT},
-  {49205u, property::type::LVT},
-  {49206u, property::type::LVT},
-  {49207u, property::type::LVT},
-  {49208u, property::type::LVT},
-  {49209u, property::type::LVT},
-  {49210u, property::type::LVT},
-  {49211u, property::type::LVT},
-  {49213u, property::type::LVT},
-  {49214u, property::type::LVT},
-  {49215u, property::type::LVT},
-  {49216u, property::type::LVT},
-  {49217u, property::type::LVT},
-  {49218u, property::type::LVT},
-  {49219u, property::type::LVT},
-  {49220u, property::type::LVT},
-  {49221u, property::type::LVT},
-  {49222u, property::type::LVT},
-  {49223u, property::type::LVT},
-  {49224u, property::type::LVT},
-  {49225u, property::type::LVT},
-  {49226u, property::type::LVT},
-  {49227u, property::type::LVT},
-  {49228u, property::type::LVT},
-  {49229u, property::type::LVT},
-  {49230u, property::type::LVT},
-  {49231u, property::type::LVT},
-  {49232u, property::type::LVT},
-  {49233u, property::type::LVT},
-  {49234u, property::type::LVT},
-  {49235u, property::type::LVT},
-  {49236u, property::type::LVT},
-  {49237u, property::type::LVT},
-  {49238u, property::type::LVT},
-  {49239u, property::type::LVT},
-  {49241u, property::type::LVT},
-  {49242u, property::type::LVT},
-  {49243u, property::type::LVT},
-  {49244u, property::type::LVT},
-  {49245u, property::type::LVT},
-  {49246u, property::type::LVT},
-  {49247u, property::type::LVT},
-  {49248u, property::type::LVT},
-  {49249u, property::type::LVT},
-  {49250u, property::type::LVT},
-  {49251u, property::type::LVT},
-  {49252u, property::type::LVT},
-  {49253u, property::type::LVT},
-  {49254u, property::type::LVT},
-  {49255u, property::type::LVT},
-  {49256u, property::type::LVT},
-  {49257u, property::type::LVT},
-  {49258u, property::type::LVT},
-  {49259u, property::type::LVT},
-  {49260u, property::type::LVT},
-  {49261u, property::type::LVT},
-  {49262u, property::type::LVT},
-  {49263u, property::type::LVT},
-  {49264u, property::type::LVT},
-  {49265u, property::type::LVT},
-  {49266u, property::type::LVT},
-  {49267u, property::type::LVT},
-  {49269u, property::type::LVT},
-  {49270u, property::type::LVT},
-  {49271u, property::type::LVT},
-  {49272u, property::type::LVT},
-  {49273u, property::type::LVT},
-  {49274u, property::type::LVT},
-  {49275u, property::type::LVT},
-  {49276u, property::type::LVT},
-  {49277u, property::type::LVT},
-  {49278u, property::type::LVT},
-  {49279u, property::type::LVT},
-  {49280u, property::type::LVT},
-  {49281u, property::type::LVT},
-  {49282u, property::type::LVT},
-  {49283u, property::type::LVT},
-  {49284u, property::type::LVT},
-  {49285u, property::type::LVT},
-  {49286u, property::type::LVT},
-  {49287u, property::type::LVT},
-  {49288u, property::type::LVT},
-  {49289u, property::type::LVT},
-  {49290u, property::type::LVT},
-  {49291u, property::type::LVT},
-  {49292u, property::type::LVT},
-  {49293u, property::type::LVT},
-  {49294u, property::type::LVT},
-  {49295u, property::type::LVT},
-  {49297u, property::type::LVT},
-  {49298u, property::type::LVT},
-  {49299u, property::type::LVT},
-  {49300u, property::type::LVT},
-  {49301u, property::type::LVT},
-  {49302u, property::type::LVT},
-  {49303u, property::type::LVT},
-  {49304u, property::type::LVT},
-  {49305u, property::type::LVT},
-  {49306u, property::type::LVT},
-  {49307u, property::type::LVT},
-  {49308u, property::type::LVT},
-  {49309u, property::type::LVT},
-  {49310u, property::type::LVT},
-  {49311u, property::type::LVT},
-  {49312u, property::type::LVT},
-  {49313u, property::type::LVT},
-  {49314u, property::type::LVT},
-  {49315u, property::type::LVT},
-  {49316u, property::type::LVT},
-  {49317u, property::type::LVT},
-  {49318u, property::type::LVT},
-  {49319u, property::type::LVT},
-  {49320u, property::type::LVT},
-  {49321u, property::type::LVT},
-  {49322u, property::type::LVT},
-  {49323u, property::type::LVT},
-  {49325u, property::type::LVT},
-  {49326u, property::type::LVT},
-  {49327u, property::type::LVT},
-  {49328u, property::type::LVT},
-  {49329u, property::type::LVT},
-  {49330u, property::type::LVT},
-  {49331u, property::type::LVT},
-  {49332u, property::type::LVT},
-  {49333u, property::type::LVT},
-  {49334u, property::type::LVT},
-  {49335u, property::type::LVT},
-  {49336u, property::type::LVT},
-  {49337u, property::type::LVT},
-  {49338u, property::type::LVT},
-  {49339u, property::type::LVT},
-  {49340u, property::type::LVT},
-  {49341u, property::type::LVT},
-  {49342u, property::type::LVT},
-  {49343u, property::type::LVT},
-  {49344u, property::type::LVT},
-  {49345u, property::type::LVT},
-  {49346u, property::type::LVT},
-  {49347u, property::type::LVT},
-  {49348u, property::type::LVT},
-  {49349u, property::type::LVT},
-  {49350u, property::type::LVT},
-  {49351u, property::type::LVT},
-  {49353u, property::type::LVT},
-  {49354u, property::type::LVT},
-  {49355u, property::type::LVT},
-  {49356u, property::type::LVT},
-  {49357u, property::type::LVT},
-  {49358u, property::type::LVT},
-  {49359u, property::type::LVT},
-  {49360u, property::type::LVT},
-  {49361u, property::type::LVT},
-  {49362u, property::type::LVT},
-  {49363u, property::type::LVT},
-  {49364u, property::type::LVT},
-  {49365u, property::type::LVT},
-  {49366u, property::type::LVT},
-  {49367u, property::type::LVT},
-  {49368u, property::type::LVT},
-  {49369u, property::type::LVT},
-  {49370u, property::type::LVT},
-  {49371u, property::type::LVT},
-  {49372u, property::type::LVT},
-  {49373u, property::type::LVT},
-  {49374u, property::type::LVT},
-  {49375u, property::type::LVT},
-  {49376u, property::type::LVT},
-  {49377u, property::type::LVT},
-  {49378u, property::type::LVT},
-  {49379u, property::type::LVT},
-  {49381u, property::type::LVT},
-  {49382u, property::type::LVT},
-  {49383u, property::type::LVT},
-  {49384u, property::type::LVT},
-  {49385u, property::type::LVT},
-  {49386u, property::type::LVT},
-  {49387u, property::type::LVT},
-  {49388u, property::type::LVT},
-  {49389u, property::type::LVT},
-  {49390u, property::type::LVT},
-  {49391u, property::type::LVT},
-  {49392u, property::type::LVT},
-  {49393u, property::type::LVT},
-  {49394u, property::type::LVT},
-  {49395u, property::type::LVT},
-  {49396u, property::type::LVT},
-  {49397u, property::type::LVT},
-  {49398u, property::type::LVT},
-  {49399u, property::type::LVT},
-  {49400u, property::type::LVT},
-  {49401u, property::type::LVT},
-  {49402u, property::type::LVT},
-  {49403u, property::type::LVT},
-  {49404u, property::type::LVT},
-  {49405u, property::type::LVT},
-  {49406u, property::type::LVT},
-  {49407u, property::type::LVT},
-  {49409u, property::type::LVT},
-  {49410u, property::type::LVT},
-  {49411u, property::type::LVT},
-  {49412u, property::type::LVT},
-  {49413u, property::type::LVT},
-  {49414u, property::type::LVT},
-  {49415u, property::type::LVT},
-  {49416u, property::type::LVT},
-  {49417u, property::type::LVT},
-  {49418u, property::type::LVT},
-  {49419u, property::type::LVT},
-  {49420u, property::type::LVT},
-  {49421u, property::type::LVT},
-  {49422u, property::type::LVT},
-  {49423u, property::type::LVT},
-  {49424u, property::type::LVT},
-  {49425u, property::type::LVT},
-  {49426u, property::type::LVT},
-  {49427u, property::type::LVT},
-  {49428u, property::type::LVT},
-  {49429u, property::type::LVT},
-  {49430u, property::type::LVT},
-  {49431u, property::type::LVT},
-  {49432u, property::type::LVT},
-  {49433u, property::type::LVT},
-  {49434u, property::type::LVT},
-  {49435u, property::type::LVT},
-  {49437u, property::type::LVT},
-  {49438u, property::type::LVT},
-  {49439u, property::type::LVT},
-  {49440u, property::type::LVT},
-  {49441u, property::type::LVT},
-  {49442u, property::type::LVT},
-  {49443u, property::type::LVT},
-  {49444u, property::type::LVT},
-  {49445u, property::type::LVT},
-  {49446u, property::type::LVT},
-  {49447u, property::type::LVT},
-  {49448u, property::type::LVT},
-  {49449u, property::type::LVT},
-  {49450u, property::type::LVT},
-  {49451u, property::type::LVT},
-  {49452u, property::type::LVT},
-  {49453u, property::type::LVT},
-  {49454u, property::type::LVT},
-  {49455u, property::type::LVT},
-  {49456u, property::type::LVT},
-  {49457u, property::type::LVT},
-  {49458u, property::type::LVT},
-  {49459u, property::type::LVT},
-  {49460u, property::type::LVT},
-  {49461u, property::type::LVT},
-  {49462u, property::type::LVT},
-  {49463u, property::type::LVT},
-  {49465u, property::type::LVT},
-  {49466u, property::type::LVT},
-  {49467u, property::type::LVT},
-  {49468u, property::type::LVT},
-  {49469u, property::type::LVT},
-  {49470u, property::type::LVT},
-  {49471u, property::type::LVT},
-  {49472u, property::type::LVT},
-  {49473u, property::type::LVT},
-  {49474u, property::type::LVT},
-  {49475u, property::type::LVT},
-  {49476u, property::type::LVT},
-  {49477u, property::type::LVT},
-  {49478u, property::type::LVT},
-  {49479u, property::type::LVT},
-  {49480u, property::type::LVT},
-  {49481u, property::type::LVT},
-  {49482u, property::type::LVT},
-  {49483u, property::type::LVT},
-  {49484u, property::type::LVT},
-  {49485u, property::type::LVT},
-  {49486u, property::type::LVT},
-  {49487u, property::type::LVT},
-  {49488u, property::type::LVT},
-  {49489u, property::type::LVT},
-  {49490u, property::type::LVT},
-  {49491u, property::type::LVT},
-  {49493u, property::type::LVT},
-  {49494u, property::type::LVT},
-  {49495u, property::type::LVT},
-  {49496u, property::type::LVT},
-  {49497u, property::type::LVT},
-  {49498u, property::type::LVT},
-  {49499u, property::type::LVT},
-  {49500u, property::type::LVT},
-  {49501u, property::type::LVT},
-  {49502u, property::type::LVT},
-  {49503u, property::type::LVT},
-  {49504u, property::type::LVT},
-  {49505u, property::type::LVT},
-  {49506u, property::type::LVT},
-  {49507u, property::type::LVT},
-  {49508u, property::type::LVT},
-  {49509u, property::type::LVT},
-  {49510u, property::type::LVT},
-  {49511u, property::type::LVT},
-  {49512u, property::type::LVT},
-  {49513u, property::type::LVT},
-  {49514u, property::type::LVT},
-  {49515u, property::type::LVT},
-  {49516u, property::type::LVT},
-  {49517u, property::type::LVT},
-  {49518u, property::type::LVT},
-  {49519u, property::type::LVT},
-  {49521u, property::type::LVT},
-  {49522u, property::type::LVT},
-  {49523u, property::type::LVT},
-  {49524u, property::type::LVT},
-  {49525u, property::type::LVT},
-  {49526u, property::type::LVT},
-  {49527u, property::type::LVT},
-  {49528u, property::type::LVT},
-  {49529u, property::type::LVT},
-  {49530u, property::type::LVT},
-  {49531u, property::type::LVT},
-  {49532u, property::type::LVT},
-  {49533u, property::type::LVT},
-  {49534u, property::type::LVT},
-  {49535u, property::type::LVT},
-  {49536u, property::type::LVT},
-  {49537u, property::type::LVT},
-  {49538u, property::type::LVT},
-  {49539u, property::type::LVT},
-  {49540u, property::type::LVT},
-  {49541u, property::type::LVT},
-  {49542u, property::type::LVT},
-  {49543u, property::type::LVT},
-  {49544u, property::type::LVT},
-  {49545u, property::type::LVT},
-  {49546u, property::type::LVT},
-  {49547u, property::type::LVT},
-  {49549u, property::type::LVT},
-  {49550u, property::type::LVT},
-  {49551u, property::type::LVT},
-  {49552u, property::type::LVT},
-  {49553u, property::type::LVT},
-  {49554u, property::type::LVT},
-  {49555u, property::type::LVT},
-  {49556u, property::type::LVT},
-  {49557u, property::type::LVT},
-  {49558u, property::type::LVT},
-  {49559u, property::type::LVT},
-  {49560u, property::type::LVT},
-  {49561u, property::type::LVT},
-  {49562u, property::type::LVT},
-  {49563u, property::type::LVT},
-  {49564u, property::type::LVT},
-  {49565u, property::type::LVT},
-  {49566u, property::type::LVT},
-  {49567u, property::type::LVT},
-  {49568u, property::type::LVT},
-  {49569u, property::type::LVT},
-  {49570u, property::type::LVT},
-  {49571u, property::type::LVT},
-  {49572u, property::type::LVT},
-  {49573u, property::type::LVT},
-  {49574u, property::type::LVT},
-  {49575u, property::type::LVT},
-  {49577u, property::type::LVT},
-  {49578u, property::type::LVT},
-  {49579u, property::type::LVT},
-  {49580u, property::type::LVT},
-  {49581u, property::type::LVT},
-  {49582u, property::type::LVT},
-  {49583u, property::type::LVT},
-  {49584u, property::type::LVT},
-  {49585u, property::type::LVT},
-  {49586u, property::type::LVT},
-  {49587u, property::type::LVT},
-  {49588u, property::type::LVT},
-  {49589u, property::type::LVT},
-  {49590u, property::type::LVT},
-  {49591u, property::type::LVT},
-  {49592u, property::type::LVT},
-  {49593u, property::type::LVT},
-  {49594u, property::type::LVT},
-  {49595u, property::type::LVT},
-  {49596u, property::type::LVT},
-  {49597u, property::type::LVT},
-  {49598u, property::type::LVT},
-  {49599u, property::type::LVT},
-  {49600u, property::type::LVT},
-  {49601u, property::type::LVT},
-  {49602u, property::type::LVT},
-  {49603u, property::type::LVT},
-  {49605u, property::type::LVT},
-  {49606u, property::type::LVT},
-  {49607u, property::type::LVT},
-  {49608u, property::type::LVT},
-  {49609u, property::type::LVT},
-  {49610u, property::type::LVT},
-  {49611u, property::type::LVT},
-  {49612u, property::type::LVT},
-  {49613u, property::type::LVT},
-  {49614u, property::type::LVT},
-  {49615u, property::type::LVT},
-  {49616u, property::type::LVT},
-  {49617u, property::type::LVT},
-  {49618u, property::type::LVT},
-  {49619u, property::type::LVT},
-  {49620u, property::type::LVT},
-  {49621u, property::type::LVT},
-  {49622u, property::type::LVT},
-  {49623u, property::type::LVT},
-  {49624u, property::type::LVT},
-  {49625u, property::type::LVT},
-  {49626u, property::type::LVT},
-  {49627u, property::type::LVT},
-  {49628u, property::type::LVT},
-  {49629u, property::type::LVT},
-  {49630u, property::type::LVT},
-  {49631u, property::type::LVT},
-  {49633u, property::type::LVT},
-  {49634u, property::type::LVT},
-  {49635u, property::type::LVT},
-  {49636u, property::type::LVT},
-  {49637u, property::type::LVT},
-  {49638u, property::type::LVT},
-  {49639u, property::type::LVT},
-  {49640u, property::type::LVT},
-  {49641u, property::type::LVT},
-  {49642u, property::type::LVT},
-  {49643u, property::type::LVT},
-  {49644u, property::type::LVT},
-  {49645u, property::type::LVT},
-  {49646u, property::type::LVT},
-  {49647u, property::type::LVT},
-  {49648u, property::type::LVT},
-  {49649u, property::type::LVT},
-  {49650u, property::type::LVT},
-  {49651u, property::type::LVT},
-  {49652u, property::type::LVT},
-  {49653u, property::type::LVT},
-  {49654u, property::type::LVT},
-  {49655u, property::type::LVT},
-  {49656u, property::type::LVT},
-  {49657u, property::type::LVT},
-  {49658u, property::type::LVT},
-  {49659u, property::type::LVT},
-  {49661u, property::type::LVT},
-  {49662u, property::type::LVT},
-  {49663u, property::type::LVT},
-  {49664u, property::type::LVT},
-  {49665u, property::type::LVT},
-  {49666u, property::type::LVT},
-  {49667u, property::type::LVT},
-  {49668u, property::type::LVT},
-  {49669u, property::type::LVT},
-  {49670u, property::type::LVT},
-  {49671u, property::type::LVT},
-  {49672u, property::type::LVT},
-  {49673u, property::type::LVT},
-  {49674u, property::type::LVT},
-  {49675u, property::type::LVT},
-  {49676u, property::type::LVT},
-  {49677u, property::type::LVT},
-  {49678u, property::type::LVT},
-  {49679u, property::type::LVT},
-  {49680u, property::type::LVT},
-  {49681u, property::type::LVT},
-  {49682u, property::type::LVT},
-  {49683u, property::type::LVT},
-  {49684u, property::type::LVT},
-  {49685u, property::type::LVT},
-  {49686u, property::type::LVT},
-  {49687u, property::type::LVT},
-  {49689u, property::type::LVT},
-  {49690u, property::type::LVT},
-  {49691u, property::type::LVT},
-  {49692u, property::type::LVT},
-  {49693u, property::type::LVT},
-  {49694u, property::type::LVT},
-  {49695u, property::type::LVT},
-  {49696u, property::type::LVT},
-  {49697u, property::type::LVT},
-  {49698u, property::type::LVT},
-  {49699u, property::type::LVT},
-  {49700u, property::type::LVT},
-  {49701u, property::type::LVT},
-  {49702u, property::type::LVT},
-  {49703u, property::type::LVT},
-  {49704u, property::type::LVT},
-  {49705u, property::type::LVT},
-  {49706u, property::type::LVT},
-  {49707u, property::type::LVT},
-  {49708u, property::type::LVT},
-  {49709u, property::type::LVT},
-  {49710u, property::type::LVT},
-  {49711u, property::type::LVT},
-  {49712u, property::type::LVT},
-  {49713u, property::type::LVT},
-  {49714u, property::type::LVT},
-  {49715u, property::type::LVT},
-  {49717u, property::type::LVT},
-  {49718u, property::type::LVT},
-  {49719u, property::type::LVT},
-  {49720u, property::type::LVT},
-  {49721u, property::type::LVT},
-  {49722u, property::type::LVT},
-  {49723u, property::type::LVT},
-  {49724u, property::type::LVT},
-  {49725u, property::type::LVT},
-  {49726u, property::type::LVT},
-  {49727u, property::type::LVT},
-  {49728u, property::type::LVT},
-  {49729u, property::type::LVT},
-  {49730u, property::type::LVT},
-  {49731u, property::type::LVT},
-  {49732u, property::type::LVT},
-  {49733u, property::type::LVT},
-  {49734u, property::type::LVT},
-  {49735u, property::type::LVT},
-  {49736u, property::type::LVT},
-  {49737u, property::type::LVT},
-  {49738u, property::type::LVT},
-  {49739u, property::type::LVT},
-  {49740u, property::type::LVT},
-  {49741u, property::type::LVT},
-  {49742u, property::type::LVT},
-  {49743u, property::type::LVT},
-  {49745u, property::type::LVT},
-  {49746u, property::type::LVT},
-  {49747u, property::type::LVT},
-  {49748u, property::type::LVT},
-  {49749u, property::type::LVT},
-  {49750u, property::type::LVT},
-  {49751u, property::type::LVT},
-  {49752u, property::type::LVT},
-  {49753u, property::type::LVT},
-  {49754u, property::type::LVT},
-  {49755u, property::type::LVT},
-  {49756u, property::type::LVT},
-  {49757u, property::type::LVT},
-  {49758u, property::type::LVT},
-  {49759u, property::type::LVT},
-  {49760u, property::type::LVT},
-  {49761u, property::type::LVT},
-  {49762u, property::type::LVT},
-  {49763u, property::type::LVT},
-  {49764u, property::type::LVT},
-  {49765u, property::type::LVT},
-  {49766u, property::type::LVT},
-  {49767u, property::type::LVT},
-  {49768u, property::type::LVT},
-  {49769u, property::type::LVT},
-  {49770u, property::type::LVT},
-  {49771u, property::type::LVT},
-  {49773u, property::type::LVT},
-  {49774u, property::type::LVT},
-  {49775u, property::type::LVT},
-  {49776u, property::type::LVT},
-  {49777u, property::type::LVT},
-  {49778u, property::type::LVT},
-  {49779u, property::type::LVT},
-  {49780u, property::type::LVT},
-  {49781u, property::type::LVT},
-  {49782u, property::type::LVT},
-  {49783u, property::type::LVT},
-  {49784u, property::type::LVT},
-  {49785u, property::type::LVT},
-  {49786u, property::type::LVT},
-  {49787u, property::type::LVT},
-  {49788u, property::type::LVT},
-  {49789u, property::type::LVT},
-  {49790u, property::type::LVT},
-  {49791u, property::type::LVT},
-  {49792u, property::type::LVT},
-  {49793u, property::type::LVT},
-  {49794u, property::type::LVT},
-  {49795u, property::type::LVT},
-  {49796u, property::type::LVT},
-  {49797u, property::type::LVT},
-  {49798u, property::type::LVT},
-  {49799u, property::type::LVT},
-  {49801u, property::type::LVT},
-  {49802u, property::type::LVT},
-  {49803u, property::type::LVT},
-  {49804u, property::type::LVT},
-  {49805u, property::type::LVT},
-  {49806u, property::type::LVT},
-  {49807u, property::type::LVT},
-  {49808u, property::type::LVT},
-  {49809u, property::type::LVT},
-  {49810u, property::type::LVT},
-  {49811u, property::type::LVT},
-  {49812u, property::type::LVT},
-  {49813u, property::type::LVT},
-  {49814u, property::type::LVT},
-  {49815u, property::type::LVT},
-  {49816u, property::type::LVT},
-  {49817u, property::type::LVT},
-  {49818u, property::type::LVT},
-  {49819u, property::type::LVT},
-  {49820u, property::type::LVT},
-  {49821u, property::type::LVT},
-  {49822u, property::type::LVT},
-  {49823u, property::type::LVT},
-  {49824u, property::type::LVT},
-  {49825u, property::type::LVT},
-  {49826u, property::type::LVT},
-  {49827u, property::type::LVT},
-  {49829u, property::type::LVT},
-  {49830u, property::type::LVT},
-  {49831u, property::type::LVT},
-  {49832u, property::type::LVT},
-  {49833u, property::type::LVT},
-  {49834u, property::type::LVT},
-  {49835u, property::type::LVT},
-  {49836u, property::type::LVT},
-  {49837u, property::type::LVT},
-  {49838u, property::type::LVT},
-  {49839u, property::type::LVT},
-  {49840u, property::type::LVT},
-  {49841u, property::type::LVT},
-  {49842u, property::type::LVT},
-  {49843u, property::type::LVT},
-  {49844u, property::type::LVT},
-  {49845u, property::type::LVT},
-  {49846u, property::type::LVT},
-  {49847u, property::type::LVT},
-  {49848u, property::type::LVT},
-  {49849u, property::type::LVT},
-  {49850u, property::type::LVT},
-  {49851u, property::type::LVT},
-  {49852u, property::type::LVT},
-  {49853u, property::type::LVT},
-  {49854u, property::type::LVT},
-  {49855u, property::type::LVT},
-  {49857u, property::type::LVT},
-  {49858u, property::type::LVT},
-  {49859u, property::type::LVT},
-  {49860u, property::type::LVT},
-  {49861u, property::type::LVT},
-  {49862u, property::type::LVT},
-  {49863u, property::type::LVT},
-  {49864u, property::type::LVT},
-  {49865u, property::type::LVT},
-  {49866u, property::type::LVT},
-  {49867u, property::type::LVT},
-  {49868u, property::type::LVT},
-  {49869u, property::type::LVT},
-  {49870u, property::type::LVT},
-  {49871u, property::type::LVT},
-  {49872u, property::type::LVT},
-  {49873u, property::type::LVT},
-  {49874u, property::type::LVT},
-  {49875u, property::type::LVT},
-  {49876u, property::type::LVT},
-  {49877u, property::type::LVT},
-  {49878u, property::type::LVT},
-  {49879u, property::type::LVT},
-  {49880u, property::type::LVT},
-  {49881u, property::type::LVT},
-  {49882u, property::type::LVT},
-  {49883u, property::type::LVT},
-  {49885u, property::type::LVT},
-  {49886u, property::type::LVT},
-  {49887u, property::type::LVT},
-  {49888u, property::type::LVT},
-  {49889u, property::type::LVT},
-  {49890u, property::type::LVT},
-  {49891u, property::type::LVT},
-  {49892u, property::type::LVT},
-  {49893u, property::type::LVT},
-  {49894u, property::type::LVT},
-  {49895u, property::type::LVT},
-  {49896u, property::type::LVT},
-  {49897u, property::type::LVT},
-  {49898u, property::type::LVT},
-  {49899u, property::type::LVT},
-  {49900u, property::type::LVT},
-  {49901u, property::type::LVT},
-  {49902u, property::type::LVT},
-  {49903u, property::type::LVT},
-  {49904u, property::type::LVT},
-  {49905u, property::type::LVT},
-  {49906u, property::type::LVT},
-  {49907u, property::type::LVT},
-  {49908u, property::type::LVT},
-  {49909u, property::type::LVT},
-  {49910u, property::type::LVT},
-  {49911u, property::type::LVT},
-  {49913u, property::type::LVT},
-  {49914u, property::type::LVT},
-  {49915u, property::type::LVT},
-  {49916u, property::type::LVT},
-  {49917u, property::type::LVT},
-  {49918u, property::type::LVT},
-  {49919u, property::type::LVT},
-  {49920u, property::type::LVT},
-  {49921u, property::type::LVT},
-  {49922u, property::type::LVT},
-  {49923u, property::type::LVT},
-  {49924u, property::type::LVT},
-  {49925u, property::type::LVT},
-  {49926u, property::type::LVT},
-  {49927u, property::type::LVT},
-  {49928u, property::type::LVT},
-  {49929u, property::type::LVT},
-  {49930u, property::type::LVT},
-  {49931u, property::type::LVT},
-  {49932u, property::type::LVT},
-  {49933u, property::type::LVT},
-  {49934u, property::type::LVT},
-  {49935u, property::type::LVT},
-  {49936u, property::type::LVT},
-  {49937u, property::type::LVT},
-  {49938u, property::type::LVT},
-  {49939u, property::type::LVT},
-  {49941u, property::type::LVT},
-  {49942u, property::type::LVT},
-  {49943u, property::type::LVT},
-  {49944u, property::type::LVT},
-  {49945u, property::type::LVT},
-  {49946u, property::type::LVT},
-  {49947u, property::type::LVT},
-  {49948u, property::type::LVT},
-  {49949u, property::type::LVT},
-  {49950u, property::type::LVT},
-  {49951u, property::type::LVT},
-  {49952u, property::type::LVT},
-  {49953u, property::type::LVT},
-  {49954u, property::type::LVT},
-  {49955u, property::type::LVT},
-  {49956u, property::type::LVT},
-  {49957u, property::type::LVT},
-  {49958u, property::type::LVT},
-  {49959u, property::type::LVT},
-  {49960u, property::type::LVT},
-  {49961u, property::type::LVT},
-  {49962u, property::type::LVT},
-  {49963u, property::type::LVT},
-  {49964u, property::type::LVT},
-  {49965u, property::type::LVT},
-  {49966u, property::type::LVT},
-  {49967u, property::type::LVT},
-  {49969u, property::type::LVT},
-  {49970u, property::type::LVT},
-  {49971u, property::type::LVT},
-  {49972u, property::type::LVT},
-  {49973u, property::type::LVT},
-  {49974u, property::type::LVT},
-  {49975u, property::type::LVT},
-  {49976u, property::type::LVT},
-  {49977u, property::type::LVT},
-  {49978u, property::type::LVT},
-  {49979u, property::type::LVT},
-  {49980u, property::type::LVT},
-  {49981u, property::type::LVT},
-  {49982u, property::type::LVT},
-  {49983u, property::type::LVT},
-  {49984u, property::type::LVT},
-  {49985u, property::type::LVT},
-  {49986u, property::type::LVT},
-  {49987u, property::type::LVT},
-  {49988u, property::type::LVT},
-  {49989u, property::type::LVT},
-  {49990u, property::type::LVT},
-  {49991u, property::type::LVT},
-  {49992u, property::type::LVT},
-  {49993u, property::type::LVT},
-  {49994u, property::type::LVT},
-  {49995u, property::type::LVT},
-  {49997u, property::type::LVT},
-  {49998u, property::type::LVT},
-  {49999u, property::type::LVT},
-  {50000u, property::type::LVT},
-  {50001u, property::type::LVT},
-  {50002u, property::type::LVT},
-  {50003u, property::type::LVT},
-  {50004u, property::type::LVT},
-  {50005u, property::type::LVT},
-  {50006u, property::type::LVT},
-  {50007u, property::type::LVT},
-  {50008u, property::type::LVT},
-  {50009u, property::type::LVT},
-  {50010u, property::type::LVT},
-  {50011u, property::type::LVT},
-  {50012u, property::type::LVT},
-  {50013u, property::type::LVT},
-  {50014u, property::type::LVT},
-  {50015u, property::type::LVT},
-  {50016u, property::type::LVT},
-  {50017u, property::type::LVT},
-  {50018u, property::type::LVT},
-  {50019u, property::type::LVT},
-  {50020u, property::type::LVT},
-  {50021u, property::type::LVT},
-  {50022u, property::type::LVT},
-  {50023u, property::type::LVT},
-  {50025u, property::type::LVT},
-  {50026u, property::type::LVT},
-  {50027u, property::type::LVT},
-  {50028u, property::type::LVT},
-  {50029u, property::type::LVT},
-  {50030u, property::type::LVT},
-  {50031u, property::type::LVT},
-  {50032u, property::type::LVT},
-  {50033u, property::type::LVT},
-  {50034u, property::type::LVT},
-  {50035u, property::type::LVT},
-  {50036u, property::type::LVT},
-  {50037u, property::type::LVT},
-  {50038u, property::type::LVT},
-  {50039u, property::type::LVT},
-  {50040u, property::type::LVT},
-  {50041u, property::type::LVT},
-  {50042u, property::type::LVT},
-  {50043u, property::type::LVT},
-  {50044u, property::type::LVT},
-  {50045u, property::type::LVT},
-  {50046u, property::type::LVT},
-  {50047u, property::type::LVT},
-  {50048u, property::type::LVT},
-  {50049u, property::type::LVT},
-  {50050u, property::type::LVT},
-  {50051u, property::type::LVT},
-  {50053u, property::type::LVT},
-  {50054u, property::type::LVT},
-  {50055u, property::type::LVT},
-  {50056u, property::type::LVT},
-  {50057u, property::type::LVT},
-  {50058u, property::type::LVT},
-  {50059u, property::type::LVT},
-  {50060u, property::type::LVT},
-  {50061u, property::type::LVT},
-  {50062u, property::type::LVT},
-  {50063u, property::type::LVT},
-  {50064u, property::type::LVT},
-  {50065u, property::type::LVT},
-  {50066u, property::type::LVT},
-  {50067u, property::type::LVT},
-  {50068u, property::type::LVT},
-  {50069u, property::type::LVT},
-  {50070u, property::type::LVT},
-  {50071u, property::type::LVT},
-  {50072u, property::type::LVT},
-  {50073u, property::type::LVT},
-  {50074u, property::type::LVT},
-  {50075u, property::type::LVT},
-  {50076u, property::type::LVT},
-  {50077u, property::type::LVT},
-  {50078u, property::type::LVT},
-  {50079u, property::type::LVT},
-  {50081u, property::type::LVT},
-  {50082u, property::type::LVT},
-  {50083u, property::type::LVT},
-  {50084u, property::type::LVT},
-  {50085u, property::type::LVT},
-  {50086u, property::type::LVT},
-  {50087u, property::type::LVT},
-  {50088u, property::type::LVT},
-  {50089u, property::type::LVT},
-  {50090u, property::type::LVT},
-  {50091u, property::type::LVT},
-  {50092u, property::type::LVT},
-  {50093u, property::type::LVT},
-  {50094u, property::type::LVT},
-  {50095u, property::type::LVT},
-  {50096u, property::type::LVT},
-  {50097u, property::type::LVT},
-  {50098u, property::type::LVT},
-  {50099u, property::type::LVT},
-  {50100u, property::type::LVT},
-  {50101u, property::type::LVT},
-  {50102u, property::type::LVT},
-  {50103u, property::type::LVT},
-  {50104u, property::type::LVT},
-  {50105u, property::type::LVT},
-  {50106u, property::type::LVT},
-  {50107u, property::type::LVT},
-  {50109u, property::type::LVT},
-  {50110u, property::type::LVT},
-  {50111u, property::type::LVT},
-  {50112u, property::type::LVT},
-  {50113u, property::type::LVT},
-  {50114u, property::type::LVT},
-  {50115u, property::type::LVT},
-  {50116u, property::type::LVT},
-  {50117u, property::type::LVT},
-  {50118u, property::type::LVT},
-  {50119u, property::type::LVT},
-  {50120u, property::type::LVT},
-  {50121u, property::type::LVT},
-  {50122u, property::type::LVT},
-  {50123u, property::type::LVT},
-  {50124u, property::type::LVT},
-  {50125u, property::type::LVT},
-  {50126u, property::type::LVT},
-  {50127u, property::type::LVT},
-  {50128u, property::type::LVT},
-  {50129u, property::type::LVT},
-  {50130u, property::type::LVT},
-  {50131u, property::type::LVT},
-  {50132u, property::type::LVT},
-  {50133u, property::type::LVT},
-  {50134u, property::type::LVT},
-  {50135u, property::type::LVT},
-  {50137u, property::type::LVT},
-  {50138u, property::type::LVT},
-  {50139u, property::type::LVT},
-  {50140u, property::type::LVT},
-  {50141u, property::type::LVT},
-  {50142u, property::type::LVT},
-  {50143u, property::type::LVT},
-  {50144u, property::type::LVT},
-  {50145u, property::type::LVT},
-  {50146u, property::type::LVT},
-  {50147u, property::type::LVT},
-  {50148u, property::type::LVT},
-  {50149u, property::type::LVT},
-  {50150u, property::type::LVT},
-  {50151u, property::type::LVT},
-  {50152u, property::type::LVT},
-  {50153u, property::type::LVT},
-  {50154u, property::type::LVT},
-  {50155u, property::type::LVT},
-  {50156u, property::type::LVT},
-  {50157u, property::type::LVT},
-  {50158u, property::type::LVT},
-  {50159u, property::type::LVT},
-  {50160u, property::type::LVT},
-  {50161u, property::type::LVT},
-  {50162u, property::type::LVT},
-  {50163u, property::type::LVT},
-  {50165u, property::type::LVT},
-  {50166u, property::type::LVT},
-  {50167u, property::type::LVT},
-  {50168u, property::type::LVT},
-  {50169u, property::type::LVT},
-  {50170u, property::type::LVT},
-  {50171u, property::type::LVT},
-  {50172u, property::type::LVT},
-  {50173u, property::type::LVT},
-  {50174u, property::type::LVT},
-  {50175u, property::type::LVT},
-  {50176u, property::type::LVT},
-  {50177u, property::type::LVT},
-  {50178u, property::type::LVT},
-  {50179u, property::type::LVT},
-  {50180u, property::type::LVT},
-  {50181u, property::type::LVT},
-  {50182u, property::type::LVT},
-  {50183u, property::type::LVT},
-  {50184u, property::type::LVT},
-  {50185u, property::type::LVT},
-  {50186u, property::type::LVT},
-  {50187u, property::type::LVT},
-  {50188u, property::type::LVT},
-  {50189u, property::type::LVT},
-  {50190u, property::type::LVT},
-  {50191u, property::type::LVT},
-  {50193u, property::type::LVT},
-  {50194u, property::type::LVT},
-  {50195u, property::type::LVT},
-  {50196u, property::type::LVT},
-  {50197u, property::type::LVT},
-  {50198u, property::type::LVT},
-  {50199u, property::type::LVT},
-  {50200u, property::type::LVT},
-  {50201u, property::type::LVT},
-  {50202u, property::type::LVT},
-  {50203u, property::type::LVT},
-  {50204u, property::type::LVT},
-  {50205u, property::type::LVT},
-  {50206u, property::type::LVT},
-  {50207u, property::type::LVT},
-  {50208u, property::type::LVT},
-  {50209u, property::type::LVT},
-  {50210u, property::type::LVT},
-  {50211u, property::type::LVT},
-  {50212u, property::type::LVT},
-  {50213u, property::type::LVT},
-  {50214u, property::type::LVT},
-  {50215u, property::type::LVT},
-  {50216u, property::type::LVT},
-  {50217u, property::type::LVT},
-  {50218u, property::type::LVT},
-  {50219u, property::type::LVT},
-  {50221u, property::type::LVT},
-  {50222u, property::type::LVT},
-  {50223u, property::type::LVT},
-  {50224u, property::type::LVT},
-  {50225u, property::type::LVT},
-  {50226u, property::type::LVT},
-  {50227u, property::type::LVT},
-  {50228u, property::type::LVT},
-  {50229u, property::type::LVT},
-  {50230u, property::type::LVT},
-  {50231u, property::type::LVT},
-  {50232u, property::type::LVT},
-  {50233u, property::type::LVT},
-  {50234u, property::type::LVT},
-  {50235u, property::type::LVT},
-  {50236u, property::type::LVT},
-  {50237u, property::type::LVT},
-  {50238u, property::type::LVT},
-  {50239u, property::type::LVT},
-  {50240u, property::type::LVT},
-  {50241u, property::type::LVT},
-  {50242u, property::type::LVT},
-  {50243u, property::type::LVT},
-  {50244u, property::type::LVT},
-  {50245u, property::type::LVT},
-  {50246u, property::type::LVT},
-  {50247u, property::type::LVT},
-  {50249u, property::type::LVT},
-  {50250u, property::type::LVT},
-  {50251u, property::type::LVT},
-  {50252u, property::type::LVT},
-  {50253u, property::type::LVT},
-  {50254u, property::type::LVT},
-  {50255u, property::type::LVT},
-  {50256u, property::type::LVT},
-  {50257u, property::type::LVT},
-  {50258u, property::type::LVT},
-  {50259u, property::type::LVT},
-  {50260u, property::type::LVT},
-  {50261u, property::type::LVT},
-  {50262u, property::type::LVT},
-  {50263u, property::type::LVT},
-  {50264u, property::type::LVT},
-  {50265u, property::type::LVT},
-  {50266u, property::type::LVT},
-  {50267u, property::type::LVT},
-  {50268u, property::type::LVT},
-  {50269u, property::type::LVT},
-  {50270u, property::type::LVT},
-  {50271u, property::type::LVT},
-  {50272u, property::type::LVT},
-  {50273u, property::type::LVT},
-  {50274u, property::type::LVT},
-  {50275u, property::type::LVT},
-  {50277u, property::type::LVT},
-  {50278u, property::type::LVT},
-  {50279u, property::type::LVT},
-  {50280u, property::type::LVT},
-  {50281u, property::type::LVT},
-  {50282u, property::type::LVT},
-  {50283u, property::type::LVT},
-  {50284u, property::type::LVT},
-  {50285u, property::type::LVT},
-  {50286u, property::type::LVT},
-  {50287u, property::type::LVT},
-  {50288u, property::type::LVT},
-  {50289u, property::type::LVT},
-  {50290u, property::type::LVT},
-  {50291u, property::type::LVT},
-  {50292u, property::type::LVT},
-  {50293u, property::type::LVT},
-  {50294u, property::type::LVT},
-  {50295u, property::type::LVT},
-  {50296u, property::type::LVT},
-  {50297u, property::type::LVT},
-  {50298u, property::type::LVT},
-  {50299u, property::type::LVT},
-  {50300u, property::type::LVT},
-  {50301u, property::type::LVT},
-  {50302u, property::type::LVT},
-  {50303u, property::type::LVT},
-  {50305u, property::type::LVT},
-  {50306u, property::type::LVT},
-  {50307u, property::type::LVT},
-  {50308u, property::type::LVT},
-  {50309u, property::type::LVT},
-  {50310u, property::type::LVT},
-  {50311u, property::type::LVT},
-  {50312u, property::type::LVT},
-  {50313u, property::type::LVT},
-  {50314u, property::type::LVT},
-  {50315u, property::type::LVT},
-  {50316u, property::type::LVT},
-  {50317u, property::type::LVT},
-  {50318u, property::type::LVT},
-  {50319u, property::type::LVT},
-  {50320u, property::type::LVT},
-  {50321u, property::type::LVT},
-  {50322u, property::type::LVT},
-  {50323u, property::type::LVT},
-  {50324u, property::type::LVT},
-  {50325u, property::type::LVT},
-  {50326u, property::type::LVT},
-  {50327u, property::type::LVT},
-  {50328u, property::type::LVT},
-  {50329u, property::type::LVT},
-  {50330u, property::type::LVT},
-  {50331u, property::type::LVT},
-  {50333u, property::type::LVT},
-  {50334u, property::type::LVT},
-  {50335u, property::type::LVT},
-  {50336u, property::type::LVT},
-  {50337u, property::type::LVT},
-  {50338u, property::type::LVT},
-  {50339u, property::type::LVT},
-  {50340u, property::type::LVT},
-  {50341u, property::type::LVT},
-  {50342u, property::type::LVT},
-  {50343u, property::type::LVT},
-  {50344u, property::type::LVT},
-  {50345u, property::type::LVT},
-  {50346u, property::type::LVT},
-  {50347u, property::type::LVT},
-  {50348u, property::type::LVT},
-  {50349u, property::type::LVT},
-  {50350u, property::type::LVT},
-  {50351u, property::type::LVT},
-  {50352u, property::type::LVT},
-  {50353u, property::type::LVT},
-  {50354u, property::type::LVT},
-  {50355u, property::type::LVT},
-  {50356u, property::type::LVT},
-  {50357u, property::type::LVT},
-  {50358u, property::type::LVT},
-  {50359u, property::type::LVT},
-  {50361u, property::type::LVT},
-  {50362u, property::type::LVT},
-  {50363u, property::type::LVT},
-  {50364u, property::type::LVT},
-  {50365u, property::type::LVT},
-  {50366u, property::type::LVT},
-  {50367u, property::type::LVT},
-  {50368u, property::type::LVT},
-  {50369u, property::type::LVT},
-  {50370u, property::type::LVT},
-  {50371u, property::type::LVT},
-  {50372u, property::type::LVT},
-  {50373u, property::type::LVT},
-  {50374u, property::type::LVT},
-  {50375u, property::type::LVT},
-  {50376u, property::type::LVT},
-  {50377u, property::type::LVT},
-  {50378u, property::type::LVT},
-  {50379u, property::type::LVT},
-  {50380u, property::type::LVT},
-  {50381u, property::type::LVT},
-  {50382u, property::type::LVT},
-  {50383u, property::type::LVT},
-  {50384u, property::type::LVT},
-  {50385u, property::type::LVT},
-  {50386u, property::type::LVT},
-  {50387u, property::type::LVT},
-  {50389u, property::type::LVT},
-  {50390u, property::type::LVT},
-  {50391u, property::type::LVT},
-  {50392u, property::type::LVT},
-  {50393u, property::type::LVT},
-  {50394u, property::type::LVT},
-  {50395u, property::type::LVT},
-  {50396u, property::type::LVT},
-  {50397u, property::type::LVT},
-  {50398u, property::type::LVT},
-  {50399u, property::type::LVT},
-  {50400u, property::type::LVT},
-  {50401u, property::type::LVT},
-  {50402u, property::type::LVT},
-  {50403u, property::type::LVT},
-  {50404u, property::type::LVT},
-  {50405u, property::type::LVT},
-  {50406u, property::type::LVT},
-  {50407u, property::type::LVT},
-  {50408u, property::type::LVT},
-  {50409u, property::type::LVT},
-  {50410u, property::type::LVT},
-  {50411u, property::type::LVT},
-  {50412u, property::type::LVT},
-  {50413u, property::type::LVT},
-  {50414u, property::type::LVT},
-  {50415u, property::type::LVT},
-  {50417u, property::type::LVT},
-  {50418u, property::type::LVT},
-  {50419u, property::type::LVT},
-  {50420u, property::type::LVT},
-  {50421u, property::type::LVT},
-  {50422u, property::type::LVT},
-  {50423u, property::type::LVT},
-  {50424u, property::type::LVT},
-  {50425u, property::type::LVT},
-  {50426u, property::type::LVT},
-  {50427u, property::type::LVT},
-  {50428u, property::type::LVT},
-  {50429u, property::type::LVT},
-  {50430u, property::type::LVT},
-  {50431u, property::type::LVT},
-  {50432u, property::type::LVT},
-  {50433u, property::type::LVT},
-  {50434u, property::type::LVT},
-  {50435u, property::type::LVT},
-  {50436u, property::type::LVT},
-  {50437u, property::type::LVT},
-  {50438u, property::type::LVT},
-  {50439u, property::type::LVT},
-  {50440u, property::type::LVT},
-  {50441u, property::type::LVT},
-  {50442u, property::type::LVT},
-  {50443u, property::type::LVT},
-  {50445u, property::type::LVT},
-  {50446u, property::type::LVT},
-  {50447u, property::type::LVT},
-  {50448u, property::type::LVT},
-  {50449u, property::type::LVT},
-  {50450u, property::type::LVT},
-  {50451u, property::type::LVT},
-  {50452u, property::type::LVT},
-  {50453u, property::type::LVT},
-  {50454u, property::type::LVT},
-  {50455u, property::type::LVT},
-  {50456u, property::type::LVT},
-  {50457u, property::type::LVT},
-  {50458u, property::type::LVT},
-  {50459u, property::type::LVT},
-  {50460u, property::type::LVT},
-  {50461u, property::type::LVT},
-  {50462u, property::type::LVT},
-  {50463u, property::type::LVT},
-  {50464u, property::type::LVT},
-  {50465u, property::type::LVT},
-  {50466u, property::type::LVT},
-  {50467u, property::type::LVT},
-  {50468u, property::type::LVT},
-  {50469u, property::type::LVT},
-  {50470u, property::type::LVT},
-  {50471u, property::type::LVT},
-  {50473u, property::type::LVT},
-  {50474u, property::type::LVT},
-  {50475u, property::type::LVT},
-  {50476u, property::type::LVT},
-  {50477u, property::type::LVT},
-  {50478u, property::type::LVT},
-  {50479u, property::type::LVT},
-  {50480u, property::type::LVT},
-  {50481u, property::type::LVT},
-  {50482u, property::type::LVT},
-  {50483u, property::type::LVT},
-  {50484u, property::type::LVT},
-  {50485u, property::type::LVT},
-  {50486u, property::type::LVT},
-  {50487u, property::type::LVT},
-  {50488u, property::type::LVT},
-  {50489u, property::type::LVT},
-  {50490u, property::type::LVT},
-  {50491u, property::type::LVT},
-  {50492u, property::type::LVT},
-  {50493u, property::type::LVT},
-  {50494u, property::type::LVT},
-  {50495u, property::type::LVT},
-  {50496u, property::type::LVT},
-  {50497u, property::type::LVT},
-  {50498u, property::type::LVT},
-  {50499u, property::type::LVT},
-  {50501u, property::type::LVT},
-  {50502u, property::type::LVT},
-  {50503u, property::type::LVT},
-  {50504u, property::type::LVT},
-  {50505u, property::type::LVT},
-  {50506u, property::type::LVT},
-  {50507u, property::type::LVT},
-  {50508u, property::type::LVT},
-  {50509u, property::type::LVT},
-  {50510u, property::type::LVT},
-  {50511u, property::type::LVT},
-  {50512u, property::type::LVT},
-  {50513u, property::type::LVT},
-  {50514u, property::type::LVT},
-  {50515u, property::type::LVT},
-  {50516u, property::type::LVT},
-  {50517u, property::type::LVT},
-  {50518u, property::type::LVT},
-  {50519u, property::type::LVT},
-  {50520u, property::type::LVT},
-  {50521u, property::type::LVT},
-  {50522u, property::type::LVT},
-  {50523u, property::type::LVT},
-  {50524u, property::type::LVT},
-  {50525u, property::type::LVT},
-  {50526u, property::type::LVT},
-  {50527u, property::type::LVT},
-  {50529u, property::type::LVT},
-  {50530u, property::type::LVT},
-  {50531u, property::type::LVT},
-  {50532u, property::type::LVT},
-  {50533u, property::type::LVT},
-  {50534u, property::type::LVT},
-  {50535u, property::type::LVT},
-  {50536u, property::type::LVT},
-  {50537u, property::type::LVT},
-  {50538u, property::type::LVT},
-  {50539u, property::type::LVT},
-  {50540u, property::type::LVT},
-  {50541u, property::type::LVT},
-  {50542u, property::type::LVT},
-  {50543u, property::type::LVT},
-  {50544u, property::type::LVT},
-  {50545u, property::type::LVT},
-  {50546u, property::type::LVT},
-  {50547u, property::type::LVT},
-  {50548u, property::type::LVT},
-  {50549u, property::type::LVT},
-  {50550u, property::type::LVT},
-  {50551u, property::type::LVT},
-  {50552u, property::type::LVT},
-  {50553u, property::type::LVT},
-  {50554u, property::type::LVT},
-  {50555u, property::type::LVT},
-  {50557u, property::type::LVT},
-  {50558u, property::type::LVT},
-  {50559u, property::type::LVT},
-  {50560u, property::type::LVT},
-  {50561u, property::type::LVT},
-  {50562u, property::type::LVT},
-  {50563u, property::type::LVT},
-  {50564u, property::type::LVT},
-  {50565u, property::type::LVT},
-  {50566u, property::type::LVT},
-  {50567u, property::type::LVT},
-  {50568u, property::type::LVT},
-  {50569u, property::type::LVT},
-  {50570u, property::type::LVT},
-  {50571u, property::type::LVT},
-  {50572u, property::type::LVT},
-  {50573u, property::type::LVT},
-  {50574u, property::type::LVT},
-  {50575u, property::type::LVT},
-  {50576u, property::type::LVT},
-  {50577u, property::type::LVT},
-  {50578u, property::type::LVT},
-  {50579u, property::type::LVT},
-  {50580u, property::type::LVT},
-  {50581u, property::type::LVT},
-  {50582u, property::type::LVT},
-  {50583u, property::type::LVT},
-  {50585u, property::type::LVT},
-  {50586u, property::type::LVT},
-  {50587u, property::type::LVT},
-  {50588u, property::type::LVT},
-  {50589u, property::type::LVT},
-  {50590u, property::type::LVT},
-  {50591u, property::type::LVT},
-  {50592u, property::type::LVT},
-  {50593u, property::type::LVT},
-  {50594u, property::type::LVT},
-  {50595u, property::type::LVT},
-  {50596u, property::type::LVT},
-  {50597u, property::type::LVT},
-  {50598u, property::type::LVT},
-  {50599u, property::type::LVT},
-  {50600u, property::type::LVT},
-  {50601u, property::type::LVT},
-  {50602u, property::type::LVT},
-  {50603u, property::type::LVT},
-  {50604u, property::type::LVT},
-  {50605u, property::type::LVT},
-  {50606u, property::type::LVT},
-  {50607u, property::type::LVT},
-  {50608u, property::type::LVT},
-  {50609u, property::type::LVT},
-  {50610u, property::type::LVT},
-  {50611u, property::type::LVT},
-  {50613u, property::type::LVT},
-  {50614u, property::type::LVT},
-  {50615u, property::type::LVT},
-  {50616u, property::type::LVT},
-  {50617u, property::type::LVT},
-  {50618u, property::type::LVT},
-  {50619u, property::type::LVT},
-  {50620u, property::type::LVT},
-  {50621u, property::type::LVT},
-  {50622u, property::type::LVT},
-  {50623u, property::type::LVT},
-  {50624u, property::type::LVT},
-  {50625u, property::type::LVT},
-  {50626u, property::type::LVT},
-  {50627u, property::type::LVT},
-  {50628u, property::type::LVT},
-  {50629u, property::type::LVT},
-  {50630u, property::type::LVT},
-  {50631u, property::type::LVT},
-  {50632u, property::type::LVT},
-  {50633u, property::type::LVT},
-  {50634u, property::type::LVT},
-  {50635u, property::type::LVT},
-  {50636u, property::type::LVT},
-  {50637u, property::type::LVT},
-  {50638u, property::type::LVT},
-  {50639u, property::type::LVT},
-  {50641u, property::type::LVT},
-  {50642u, property::type::LVT},
-  {50643u, property::type::LVT},
-  {50644u, property::type::LVT},
-  {50645u, property::type::LVT},
-  {50646u, property::type::LVT},
-  {50647u, property::type::LVT},
-  {50648u, property::type::LVT},
-  {50649u, property::type::LVT},
-  {50650u, property::type::LVT},
-  {50651u, property::type::LVT},
-  {50652u, property::type::LVT},
-  {50653u, property::type::LVT},
-  {50654u, property::type::LVT},
-  {50655u, property::type::LVT},
-  {50656u, property::type::LVT},
-  {50657u, property::type::LVT},
-  {50658u, property::type::LVT},
-  {50659u, property::type::LVT},
-  {50660u, property::type::LVT},
-  {50661u, property::type::LVT},
-  {50662u, property::type::LVT},
-  {50663u, property::type::LVT},
-  {50664u, property::type::LVT},
-  {50665u, property::type::LVT},
-  {50666u, property::type::LVT},
-  {50667u, property::type::LVT},
-  {50669u, property::type::LVT},
-  {50670u, property::type::LVT},
-  {50671u, property::type::LVT},
-  {50672u, property::type::LVT},
-  {50673u, property::type::LVT},
-  {50674u, property::type::LVT},
-  {50675u, property::type::LVT},
-  {50676u, property::type::LVT},
-  {50677u, property::type::LVT},
-  {50678u, property::type::LVT},
-  {50679u, property::type::LVT},
-  {50680u, property::type::LVT},
-  {50681u, property::type::LVT},
-  {50682u, property::type::LVT},
-  {50683u, property::type::LVT},
-  {50684u, property::type::LVT},
-  {50685u, property::type::LVT},
-  {50686u, property::type::LVT},
-  {50687u, property::type::LVT},
-  {50688u, property::type::LVT},
-  {50689u, property::type::LVT},
-  {50690u, property::type::LVT},
-  {50691u, property::type::LVT},
-  {50692u, property::type::LVT},
-  {50693u, property::type::LVT},
-  {50694u, property::type::LVT},
-  {50695u, property::type::LVT},
-  {50697u, property::type::LVT},
-  {50698u, property::type::LVT},
-  {50699u, property::type::LVT},
-  {50700u, property::type::LVT},
-  {50701u, property::type::LVT},
-  {50702u, property::type::LVT},
-  {50703u, property::type::LVT},
-  {50704u, property::type::LVT},
-  {50705u, property::type::LVT},
-  {50706u, property::type::LVT},
-  {50707u, property::type::LVT},
-  {50708u, property::type::LVT},
-  {50709u, property::type::LVT},
-  {50710u, property::type::LVT},
-  {50711u, property::type::LVT},
-  {50712u, property::type::LVT},
-  {50713u, property::type::LVT},
-  {50714u, property::type::LVT},
-  {50715u, property::type::LVT},
-  {50716u, property::type::LVT},
-  {50717u, property::type::LVT},
-  {50718u, property::type::LVT},
-  {50719u, property::type::LVT},
-  {50720u, property::type::LVT},
-  {50721u, property::type::LVT},
-  {50722u, property::type::LVT},
-  {50723u, property::type::LVT},
-  {50725u, property::type::LVT},
-  {50726u, property::type::LVT},
-  {50727u, property::type::LVT},
-  {50728u, property::type::LVT},
-  {50729u, property::type::LVT},
-  {50730u, property::type::LVT},
-  {50731u, property::type::LVT},
-  {50732u, property::type::LVT},
-  {50733u, property::type::LVT},
-  {50734u, property::type::LVT},
-  {50735u, property::type::LVT},
-  {50736u, property::type::LVT},
-  {50737u, property::type::LVT},
-  {50738u, property::type::LVT},
-  {50739u, property::type::LVT},
-  {50740u, property::type::LVT},
-  {50741u, property::type::LVT},
-  {50742u, property::type::LVT},
-  {50743u, property::type::LVT},
-  {50744u, property::type::LVT},
-  {50745u, property::type::LVT},
-  {50746u, property::type::LVT},
-  {50747u, property::type::LVT},
-  {50748u, property::type::LVT},
-  {50749u, property::type::LVT},
-  {50750u, property::type::LVT},
-  {50751u, property::type::LVT},
-  {50753u, property::type::LVT},
-  {50754u, property::type::LVT},
-  {50755u, property::type::LVT},
-  {50756u, property::type::LVT},
-  {50757u, property::type::LVT},
-  {50758u, property::type::LVT},
-  {50759u, property::type::LVT},
-  {50760u, property::type::LVT},
-  {50761u, property::type::LVT},
-  {50762u, property::type::LVT},
-  {50763u, property::type::LVT},
-  {50764u, property::type::LVT},
-  {50765u, property::type::LVT},
-  {50766u, property::type::LVT},
-  {50767u, property::type::LVT},
-  {50768u, property::type::LVT},
-  {50769u, property::type::LVT},
-  {50770u, property::type::LVT},
-  {50771u, property::type::LVT},
-  {50772u, property::type::LVT},
-  {50773u, property::type::LVT},
-  {50774u, property::type::LVT},
-  {50775u, property::type::LVT},
-  {50776u, property::type::LVT},
-  {50777u, property::type::LVT},
-  {50778u, property::type::LVT},
-  {50779u, property::type::LVT},
-  {50781u, property::type::LVT},
-  {50782u, property::type::LVT},
-  {50783u, property::type::LVT},
-  {50784u, property::type::LVT},
-  {50785u, property::type::LVT},
-  {50786u, property::type::LVT},
-  {50787u, property::type::LVT},
-  {50788u, property::type::LVT},
-  {50789u, property::type::LVT},
-  {50790u, property::type::LVT},
-  {50791u, property::type::LVT},
-  {50792u, property::type::LVT},
-  {50793u, property::type::LVT},
-  {50794u, property::type::LVT},
-  {50795u, property::type::LVT},
-  {50796u, property::type::LVT},
-  {50797u, property::type::LVT},
-  {50798u, property::type::LVT},
-  {50799u, property::type::LVT},
-  {50800u, property::type::LVT},
-  {50801u, property::type::LVT},
-  {50802u, property::type::LVT},
-  {50803u, property::type::LVT},
-  {50804u, property::type::LVT},
-  {50805u, property::type::LVT},
-  {50806u, property::type::LVT},
-  {50807u, property::type::LVT},
-  {50809u, property::type::LVT},
-  {50810u, property::type::LVT},
-  {50811u, property::type::LVT},
-  {50812u, property::type::LVT},
-  {50813u, property::type::LVT},
-  {50814u, property::type::LVT},
-  {50815u, property::type::LVT},
-  {50816u, property::type::LVT},
-  {50817u, property::type::LVT},
-  {50818u, property::type::LVT},
-  {50819u, property::type::LVT},
-  {50820u, property::type::LVT},
-  {50821u, property::type::LVT},
-  {50822u, property::type::LVT},
-  {50823u, property::type::LVT},
-  {50824u, property::type::LVT},
-  {50825u, property::type::LVT},
-  {50826u, property::type::LVT},
-  {50827u, property::type::LVT},
-  {50828u, property::type::LVT},
-  {50829u, property::type::LVT},
-  {50830u, property::type::LVT},
-  {50831u, property::type::LVT},
-  {50832u, property::type::LVT},
-  {50833u, property::type::LVT},
-  {50834u, property::type::LVT},
-  {50835u, property::type::LVT},
-  {50837u, property::type::LVT},
-  {50838u, property::type::LVT},
-  {50839u, property::type::LVT},
-  {50840u, property::type::LVT},
-  {50841u, property::type::LVT},
-  {50842u, property::type::LVT},
-  {50843u, property::type::LVT},
-  {50844u, property::type::LVT},
-  {50845u, property::type::LVT},
-  {50846u, property::type::LVT},
-  {50847u, property::type::LVT},
-  {50848u, property::type::LVT},
-  {50849u, property::type::LVT},
-  {50850u, property::type::LVT},
-  {50851u, property::type::LVT},
-  {50852u, property::type::LVT},
-  {50853u, property::type::LVT},
-  {50854u, property::type::LVT},
-  {50855u, property::type::LVT},
-  {50856u, property::type::LVT},
-  {50857u, property::type::LVT},
-  {50858u, property::type::LVT},
-  {50859u, property::type::LVT},
-  {50860u, property::type::LVT},
-  {50861u, property::type::LVT},
-  {50862u, property::type::LVT},
-  {50863u, property::type::LVT},
-  {50865u, property::type::LVT},
-  {50866u, property::type::LVT},
-  {50867u, property::type::LVT},
-  {50868u, property::type::LVT},
-  {50869u, property::type::LVT},
-  {50870u, property::type::LVT},
-  {50871u, property::type::LVT},
-  {50872u, property::type::LVT},
-  {50873u, property::type::LVT},
-  {50874u, property::type::LVT},
-  {50875u, property::type::LVT},
-  {50876u, property::type::LVT},
-  {50877u, property::type::LVT},
-  {50878u, property::type::LVT},
-  {50879u, property::type::LVT},
-  {50880u, property::type::LVT},
-  {50881u, property::type::LVT},
-  {50882u, property::type::LVT},
-  {50883u, property::type::LVT},
-  {50884u, property::type::LVT},
-  {50885u, property::type::LVT},
-  {50886u, property::type::LVT},
-  {50887u, property::type::LVT},
-  {50888u, property::type::LVT},
-  {50889u, property::type::LVT},
-  {50890u, property::type::LVT},
-  {50891u, property::type::LVT},
-  {50893u, property::type::LVT},
-  {50894u, property::type::LVT},
-  {50895u, property::type::LVT},
-  {50896u, property::type::LVT},
-  {50897u, property::type::LVT},
-  {50898u, property::type::LVT},
-  {50899u, property::type::LVT},
-  {50900u, property::type::LVT},
-  {50901u, property::type::LVT},
-  {50902u, property::type::LVT},
-  {50903u, property::type::LVT},
-  {50904u, property::type::LVT},
-  {50905u, property::type::LVT},
-  {50906u, property::type::LVT},
-  {50907u, property::type::LVT},
-  {50908u, property::type::LVT},
-  {50909u, property::type::LVT},
-  {50910u, property::type::LVT},
-  {50911u, property::type::LVT},
-  {50912u, property::type::LVT},
-  {50913u, property::type::LVT},
-  {50914u, property::type::LVT},
-  {50915u, property::type::LVT},
-  {50916u, property::type::LVT},
-  {50917u, property::type::LVT},
-  {50918u, property::type::LVT},
-  {50919u, property::type::LVT},
-  {50921u, property::type::LVT},
-  {50922u, property::type::LVT},
-  {50923u, property::type::LVT},
-  {50924u, property::type::LVT},
-  {50925u, property::type::LVT},
-  {50926u, property::type::LVT},
-  {50927u, property::type::LVT},
-  {50928u, property::type::LVT},
-  {50929u, property::type::LVT},
-  {50930u, property::type::LVT},
-  {50931u, property::type::LVT},
-  {50932u, property::type::LVT},
-  {50933u, property::type::LVT},
-  {50934u, property::type::LVT},
-  {50935u, property::type::LVT},
-  {50936u, property::type::LVT},
-  {50937u, property::type::LVT},
-  {50938u, property::type::LVT},
-  {50939u, property::type::LVT},
-  {50940u, property::type::LVT},
-  {50941u, property::type::LVT},
-  {50942u, property::type::LVT},
-  {50943u, property::type::LVT},
-  {50944u, property::type::LVT},
-  {50945u, property::type::LVT},
-  {50946u, property::type::LVT},
-  {50947u, property::type::LVT},
-  {50949u, property::type::LVT},
-  {50950u, property::type::LVT},
-  {50951u, property::type::LVT},
-  {50952u, property::type::LVT},
-  {50953u, property::type::LVT},
-  {50954u, property::type::LVT},
-  {50955u, property::type::LVT},
-  {50956u, property::type::LVT},
-  {50957u, property::type::LVT},
-  {50958u, property::type::LVT},
-  {50959u, property::type::LVT},
-  {50960u, property::type::LVT},
-  {50961u, property::type::LVT},
-  {50962u, property::type::LVT},
-  {50963u, property::type::LVT},
-  {50964u, property::type::LVT},
-  {50965u, property::type::LVT},
-  {50966u, property::type::LVT},
-  {50967u, property::type::LVT},
-  {50968u, property::type::LVT},
-  {50969u, property::type::LVT},
-  {50970u, property::type::LVT},
-  {50971u, property::type::LVT},
-  {50972u, property::type::LVT},
-  {50973u, property::type::LVT},
-  {50974u, property::type::LVT},
-  {50975u, property::type::LVT},
-  {50977u, property::type::LVT},
-  {50978u, property::type::LVT},
-  {50979u, property::type::LVT},
-  {50980u, property::type::LVT},
-  {50981u, property::type::LVT},
-  {50982u, property::type::LVT},
-  {50983u, property::type::LVT},
-  {50984u, property::type::LVT},
-  {50985u, property::type::LVT},
-  {50986u, property::type::LVT},
-  {50987u, property::type::LVT},
-  {50988u, property::type::LVT},
-  {50989u, property::type::LVT},
-  {50990u, property::type::LVT},
-  {50991u, property::type::LVT},
-  {50992u, property::type::LVT},
-  {50993u, property::type::LVT},
-  {50994u, property::type::LVT},
-  {50995u, property::type::LVT},
-  {50996u, property::type::LVT},
-  {50997u, property::type::LVT},
-  {50998u, property::type::LVT},
-  {50999u, property::type::LVT},
-  {51000u, property::type::LVT},
-  {51001u, property::type::LVT},
-  {51002u, property::type::LVT},
-  {51003u, property::type::LVT},
-  {51005u, property::type::LVT},
-  {51006u, property::type::LVT},
-  {51007u, property::type::LVT},
-  {51008u, property::type::LVT},
-  {51009u, property::type::LVT},
-  {51010u, property::type::LVT},
-  {51011u, property::type::LVT},
-  {51012u, property::type::LVT},
-  {51013u, property::type::LVT},
-  {51014u, property::type::LVT},
-  {51015u, property::type::LVT},
-  {51016u, property::type::LVT},
-  {51017u, property::type::LVT},
-  {51018u, property::type::LVT},
-  {51019u, property::type::LVT},
-  {51020u, property::type::LVT},
-  {51021u, property::type::LVT},
-  {51022u, property::type::LVT},
-  {51023u, property::type::LVT},
-  {51024u, property::type::LVT},
-  {51025u, property::type::LVT},
-  {51026u, property::type::LVT},
-  {51027u, property::type::LVT},
-  {51028u, property::type::LVT},
-  {51029u, property::type::LVT},
-  {51030u, property::type::LVT},
-  {51031u, property::type::LVT},
-  {51033u, property::type::LVT},
-  {51034u, property::type::LVT},
-  {51035u, property::type::LVT},
-  {51036u, property::type::LVT},
-  {51037u, property::type::LVT},
-  {51038u, property::type::LVT},
-  {51039u, property::type::LVT},
-  {51040u, property::type::LVT},
-  {51041u, property::type::LVT},
-  {51042u, property::type::LVT},
-  {51043u, property::type::LVT},
-  {51044u, property::type::LVT},
-  {51045u, property::type::LVT},
-  {51046u, property::type::LVT},
-  {51047u, property::type::LVT},
-  {51048u, property::type::LVT},
-  {51049u, property::type::LVT},
-  {51050u, property::type::LVT},
-  {51051u, property::type::LVT},
-  {51052u, property::type::LVT},
-  {51053u, property::type::LVT},
-  {51054u, property::type::LVT},
-  {51055u, property::type::LVT},
-  {51056u, property::type::LVT},
-  {51057u, property::type::LVT},
-  {51058u, property::type::LVT},
-  {51059u, property::type::LVT},
-  {51061u, property::type::LVT},
-  {51062u, property::type::LVT},
-  {51063u, property::type::LVT},
-  {51064u, property::type::LVT},
-  {51065u, property::type::LVT},
-  {51066u, property::type::LVT},
-  {51067u, property::type::LVT},
-  {51068u, property::type::LVT},
-  {51069u, property::type::LVT},
-  {51070u, property::type::LVT},
-  {51071u, property::type::LVT},
-  {51072u, property::type::LVT},
-  {51073u, property::type::LVT},
-  {51074u, property::type::LVT},
-  {51075u, property::type::LVT},
-  {51076u, property::type::LVT},
-  {51077u, property::type::LVT},
-  {51078u, property::type::LVT},
-  {51079u, property::type::LVT},
-  {51080u, property::type::LVT},
-  {51081u, property::type::LVT},
-  {51082u, property::type::LVT},
-  {51083u, property::type::LVT},
-  {51084u, property::type::LVT},
-  {51085u, property::type::LVT},
-  {51086u, property::type::LVT},
-  {51087u, property::type::LVT},
-  {51089u, property::type::LVT},
-  {51090u, property::type::LVT},
-  {51091u, property::type::LVT},
-  {51092u, property::type::LVT},
-  {51093u, property::type::LVT},
-  {51094u, property::type::LVT},
-  {51095u, property::type::LVT},
-  {51096u, property::type::LVT},
-  {51097u, property::type::LVT},
-  {51098u, property::type::LVT},
-  {51099u, property::type::LVT},
-  {51100u, property::type::LVT},
-  {51101u, property::type::LVT},
-  {51102u, property::type::LVT},
-  {51103u, property::type::LVT},
-  {51104u, property::type::LVT},
-  {51105u, property::type::LVT},
-  {51106u, property::type::LVT},
-  {51107u, property::type::LVT},
-  {51108u, property::type::LVT},
-  {51109u, property::type::LVT},
-  {51110u, property::type::LVT},
-  {51111u, property::type::LVT},
-  {51112u, property::type::LVT},
-  {51113u, property::type::LVT},
-  {51114u, property::type::LVT},
-  {51115u, property::type::LVT},
-  {51117u, property::type::LVT},
-  {51118u, property::type::LVT},
-  {51119u, property::type::LVT},
-  {51120u, property::type::LVT},
-  {51121u, property::type::LVT},
-  {51122u, property::type::LVT},
-  {51123u, property::type::LVT},
-  {51124u, property::type::LVT},
-  {51125u, property::type::LVT},
-  {51126u, property::type::LVT},
-  {51127u, property::type::LVT},
-  {51128u, property::type::LVT},
-  {51129u, property::type::LVT},
-  {51130u, property::type::LVT},
-  {51131u, property::type::LVT},
-  {51132u, property::type::LVT},
-  {51133u, property::type::LVT},
-  {51134u, property::type::LVT},
-  {51135u, property::type::LVT},
-  {51136u, property::type::LVT},
-  {51137u, property::type::LVT},
-  {51138u, property::type::LVT},
-  {51139u, property::type::LVT},
-  {51140u, property::type::LVT},
-  {51141u, property::type::LVT},
-  {51142u, property::type::LVT},
-  {51143u, property::type::LVT},
-  {51145u, property::type::LVT},
-  {51146u, property::type::LVT},
-  {51147u, property::type::LVT},
-  {51148u, property::type::LVT},
-  {51149u, property::type::LVT},
-  {51150u, property::type::LVT},
-  {51151u, property::type::LVT},
-  {51152u, property::type::LVT},
-  {51153u, property::type::LVT},
-  {51154u, property::type::LVT},
-  {51155u, property::type::LVT},
-  {51156u, property::type::LVT},
-  {51157u, property::type::LVT},
-  {51158u, property::type::LVT},
-  {51159u, property::type::LVT},
-  {51160u, property::type::LVT},
-  {51161u, property::type::LVT},
-  {51162u, property::type::LVT},
-  {51163u, property::type::LVT},
-  {51164u, property::type::LVT},
-  {51165u, property::type::LVT},
-  {51166u, property::type::LVT},
-  {51167u, property::type::LVT},
-  {51168u, property::type::LVT},
-  {51169u, property::type::LVT},
-  {51170u, property::type::LVT},
-  {51171u, property::type::LVT},
-  {51173u, property::type::LVT},
-  {51174u, property::type::LVT},
-  {51175u, property::type::LVT},
-  {51176u, property::type::LVT},
-  {51177u, property::type::LVT},
-  {51178u, property::type::LVT},
-  {51179u, property::type::LVT},
-  {51180u, property::type::LVT},
-  {51181u, property::type::LVT},
-  {51182u, property::type::LVT},
-  {51183u, property::type::LVT},
-  {51184u, property::type::LVT},
-  {51185u, property::type::LVT},
-  {51186u, property::type::LVT},
-  {51187u, property::type::LVT},
-  {51188u, property::type::LVT},
-  {51189u, property::type::LVT},
-  {51190u, property::type::LVT},
-  {51191u, property::type::LVT},
-  {51192u, property::type::LVT},
-  {51193u, property::type::LVT},
-  {51194u, property::type::LVT},
-  {51195u, property::type::LVT},
-  {51196u, property::type::LVT},
-  {51197u, property::type::LVT},
-  {51198u, property::type::LVT},
-  {51199u, property::type::LVT},
-  {51201u, property::type::LVT},
-  {51202u, property::type::LVT},
-  {51203u, property::type::LVT},
-  {51204u, property::type::LVT},
-  {51205u, property::type::LVT},
-  {51206u, property::type::LVT},
-  {51207u, property::type::LVT},
-  {51208u, property::type::LVT},
-  {51209u, property::type::LVT},
-  {51210u, property::type::LVT},
-  {51211u, property::type::LVT},
-  {51212u, property::type::LVT},
-  {51213u, property::type::LVT},
-  {51214u, property::type::LVT},
-  {51215u, property::type::LVT},
-  {51216u, property::type::LVT},
-  {51217u, property::type::LVT},
-  {51218u, property::type::LVT},
-  {51219u, property::type::LVT},
-  {51220u, property::type::LVT},
-  {51221u, property::type::LVT},
-  {51222u, property::type::LVT},
-  {51223u, property::type::LVT},
-  {51224u, property::type::LVT},
-  {51225u, property::type::LVT},
-  {51226u, property::type::LVT},
-  {51227u, property::type::LVT},
-  {51229u, property::type::LVT},
-  {51230u, property::type::LVT},
-  {51231u, property::type::LVT},
-  {51232u, property::type::LVT},
-  {51233u, property::type::LVT},
-  {51234u, property::type::LVT},
-  {51235u, property::type::LVT},
-  {51236u, property::type::LVT},
-  {51237u, property::type::LVT},
-  {51238u, property::type::LVT},
-  {51239u, property::type::LVT},
-  {51240u, property::type::LVT},
-  {51241u, property::type::LVT},
-  {51242u, property::type::LVT},
-  {51243u, property::type::LVT},
-  {51244u, property::type::LVT},
-  {51245u, property::type::LVT},
-  {51246u, property::type::LVT},
-  {51247u, property::type::LVT},
-  {51248u, property::type::LVT},
-  {51249u, property::type::LVT},
-  {51250u, property::type::LVT},
-  {51251u, property::type::LVT},
-  {51252u, property::type::LVT},
-  {51253u, property::type::LVT},
-  {51254u, property::type::LVT},
-  {51255u, property::type::LVT},
-  {51257u, property::type::LVT},
-  {51258u, property::type::LVT},
-  {51259u, property::type::LVT},
-  {51260u, property::type::LVT},
-  {51261u, property::type::LVT},
-  {51262u, property::type::LVT},
-  {51263u, property::type::LVT},
-  {51264u, property::type::LVT},
-  {51265u, property::type::LVT},
-  {51266u, property::type::LVT},
-  {51267u, property::type::LVT},
-  {51268u, property::type::LVT},
-  {51269u, property::type::LVT},
-  {51270u, property::type::LVT},
-  {51271u, property::type::LVT},
-  {51272u, property::type::LVT},
-  {51273u, property::type::LVT},
-  {51274u, property::type::LVT},
-  {51275u, property::type::LVT},
-  {51276u, property::type::LVT},
-  {51277u, property::type::LVT},
-  {51278u, property::type::LVT},
-  {51279u, property::type::LVT},
-  {51280u, property::type::LVT},
-  {51281u, property::type::LVT},
-  {51282u, property::type::LVT},
-  {51283u, property::type::LVT},
-  {51285u, property::type::LVT},
-  {51286u, property::type::LVT},
-  {51287u, property::type::LVT},
-  {51288u, property::type::LVT},
-  {51289u, property::type::LVT},
-  {51290u, property::type::LVT},
-  {51291u, property::type::LVT},
-  {51292u, property::type::LVT},
-  {51293u, property::type::LVT},
-  {51294u, property::type::LVT},
-  {51295u, property::type::LVT},
-  {51296u, property::type::LVT},
-  {51297u, property::type::LVT},
-  {51298u, property::type::LVT},
-  {51299u, property::type::LVT},
-  {51300u, property::type::LVT},
-  {51301u, property::type::LVT},
-  {51302u, property::type::LVT},
-  {51303u, property::type::LVT},
-  {51304u, property::type::LVT},
-  {51305u, property::type::LVT},
-  {51306u, property::type::LVT},
-  {51307u, property::type::LVT},
-  {51308u, property::type::LVT},
-  {51309u, property::type::LVT},
-  {51310u, property::type::LVT},
-  {51311u, property::type::LVT},
-  {51313u, property::type::LVT},
-  {51314u, property::type::LVT},
-  {51315u, property::type::LVT},
-  {51316u, property::type::LVT},
-  {51317u, property::type::LVT},
-  {51318u, property::type::LVT},
-  {51319u, property::type::LVT},
-  {51320u, property::type::LVT},
-  {51321u, property::type::LVT},
-  {51322u, property::type::LVT},
-  {51323u, property::type::LVT},
-  {51324u, property::type::LVT},
-  {51325u, property::type::LVT},
-  {51326u, property::type::LVT},
-  {51327u, property::type::LVT},
-  {51328u, property::type::LVT},
-  {51329u, property::type::LVT},
-  {51330u, property::type::LVT},
-  {51331u, property::type::LVT},
-  {51332u, property::type::LVT},
-  {51333u, property::type::LVT},
-  {51334u, property::type::LVT},
-  {51335u, property::type::LVT},
-  {51336u, property::type::LVT},
-  {51337u, property::type::LVT},
-  {51338u, property::type::LVT},
-  {51339u, property::type::LVT},
-  {51341u, property::type::LVT},
-  {51342u, property::type::LVT},
-  {51343u, property::type::LVT},
-  {51344u, property::type::LVT},
-  {51345u, property::type::LVT},
-  {51346u, property::type::LVT},
-  {51347u, property::type::LVT},
-  {51348u, property::type::LVT},
-  {51349u, property::type::LVT},
-  {51350u, property::type::LVT},
-  {51351u, property::type::LVT},
-  {51352u, property::type::LVT},
-  {51353u, property::type::LVT},
-  {51354u, property::type::LVT},
-  {51355u, property::type::LVT},
-  {51356u, property::type::LVT},
-  {51357u, property::type::LVT},
-  {51358u, property::type::LVT},
-  {51359u, property::type::LVT},
-  {51360u, property::type::LVT},
-  {51361u, property::type::LVT},
-  {51362u, property::type::LVT},
-  {51363u, property::type::LVT},
-  {51364u, property::type::LVT},
-  {51365u, property::type::LVT},
-  {51366u, property::type::LVT},
-  {51367u, property::type::LVT},
-  {51369u, property::type::LVT},
-  {51370u, property::type::LVT},
-  {51371u, property::type::LVT},
-  {51372u, property::type::LVT},
-  {51373u, property::type::LVT},
-  {51374u, property::type::LVT},
-  {51375u, property::type::LVT},
-  {51376u, property::type::LVT},
-  {51377u, property::type::LVT},
-  {51378u, property::type::LVT},
-  {51379u, property::type::LVT},
-  {51380u, property::type::LVT},
-  {51381u, property::type::LVT},
-  {51382u, property::type::LVT},
-  {51383u, property::type::LVT},
-  {51384u, property::type::LVT},
-  {51385u, property::type::LVT},
-  {51386u, property::type::LVT},
-  {51387u, property::type::LVT},
-  {51388u, property::type::LVT},
-  {51389u, property::type::LVT},
-  {51390u, property::type::LVT},
-  {51391u, property::type::LVT},
-  {51392u, property::type::LVT},
-  {51393u, property::type::LVT},
-  {51394u, property::type::LVT},
-  {51395u, property::type::LVT},
-  {51397u, property::type::LVT},
-  {51398u, property::type::LVT},
-  {51399u, property::type::LVT},
-  {51400u, property::type::LVT},
-  {51401u, property::type::LVT},
-  {51402u, property::type::LVT},
-  {51403u, property::type::LVT},
-  {51404u, property::type::LVT},
-  {51405u, property::type::LVT},
-  {51406u, property::type::LVT},
-  {51407u, property::type::LVT},
-  {51408u, property::type::LVT},
-  {51409u, property::type::LVT},
-  {51410u, property::type::LVT},
-  {51411u, property::type::LVT},
-  {51412u, property::type::LVT},
-  {51413u, property::type::LVT},
-  {51414u, property::type::LVT},
-  {51415u, property::type::LVT},
-  {51416u, property::type::LVT},
-  {51417u, property::type::LVT},
-  {51418u, property::type::LVT},
-  {51419u, property::type::LVT},
-  {51420u, property::type::LVT},
-  {51421u, property::type::LVT},
-  {51422u, property::type::LVT},
-  {51423u, property::type::LVT},
-  {51425u, property::type::LVT},
-  {51426u, property::type::LVT},
-  {51427u, property::type::LVT},
-  {51428u, property::type::LVT},
-  {51429u, property::type::LVT},
-  {51430u, property::type::LVT},
-  {51431u, property::type::LVT},
-  {51432u, property::type::LVT},
-  {51433u, property::type::LVT},
-  {51434u, property::type::LVT},
-  {51435u, property::type::LVT},
-  {51436u, property::type::LVT},
-  {51437u, property::type::LVT},
-  {51438u, property::type::LVT},
-  {51439u, property::type::LVT},
-  {51440u, property::type::LVT},
-  {51441u, property::type::LVT},
-  {51442u, property::type::LVT},
-  {51443u, property::type::LVT},
-  {51444u, property::type::LVT},
-  {51445u, property::type::LVT},
-  {51446u, property::type::LVT},
-  {51447u, property::type::LVT},
-  {51448u, property::type::LVT},
-  {51449u, property::type::LVT},
-  {51450u, property::type::LVT},
-  {51451u, property::type::LVT},
-  {51453u, property::type::LVT},
-  {51454u, property::type::LVT},
-  {51455u, property::type::LVT},
-  {51456u, property::type::LVT},
-  {51457u, property::type::LVT},
-  {51458u, property::type::LVT},
-  {51459u, property::type::LVT},
-  {51460u, property::type::LVT},
-  {51461u, property::type::LVT},
-  {51462u, property::type::LVT},
-  {51463u, property::type::LVT},
-  {51464u, property::type::LVT},
-  {51465u, property::type::LVT},
-  {51466u, property::type::LVT},
-  {51467u, property::type::LVT},
-  {51468u, property::type::LVT},
-  {51469u, property::type::LVT},
-  {51470u, property::type::LVT},
-  {51471u, property::type::LVT},
-  {51472u, property::type::LVT},
-  {51473u, property::type::LVT},
-  {51474u, property::type::LVT},
-  {51475u, property::type::LVT},
-  {51476u, property::type::LVT},
-  {51477u, property::type::LVT},
-  {51478u, property::type::LVT},
-  {51479u, property::type::LVT},
-  {51481u, property::type::LVT},
-  {51482u, property::type::LVT},
-  {51483u, property::type::LVT},
-  {51484u, property::type::LVT},
-  {51485u, property::type::LVT},
-  {51486u, property::type::LVT},
-  {51487u, property::type::LVT},
-  {51488u, property::type::LVT},
-  {51489u, property::type::LVT},
-  {51490u, property::type::LVT},
-  {51491u, property::type::LVT},
-  {51492u, property::type::LVT},
-  {51493u, property::type::LVT},
-  {51494u, property::type::LVT},
-  {51495u, property::type::LVT},
-  {51496u, property::type::LVT},
-  {51497u, property::type::LVT},
-  {51498u, property::type::LVT},
-  {51499u, property::type::LVT},
-  {51500u, property::type::LVT},
-  {51501u, property::type::LVT},
-  {51502u, property::type::LVT},
-  {51503u, property::type::LVT},
-  {51504u, property::type::LVT},
-  {51505u, property::type::LVT},
-  {51506u, property::type::LVT},
-  {51507u, property::type::LVT},
-  {51509u, property::type::LVT},
-  {51510u, property::type::LVT},
-  {51511u, property::type::LVT},
-  {51512u, property::type::LVT},
-  {51513u, property::type::LVT},
-  {51514u, property::type::LVT},
-  {51515u, property::type::LVT},
-  {51516u, property::type::LVT},
-  {51517u, property::type::LVT},
-  {51518u, property::type::LVT},
-  {51519u, property::type::LVT},
-  {51520u, property::type::LVT},
-  {51521u, property::type::LVT},
-  {51522u, property::type::LVT},
-  {51523u, property::type::LVT},
-  {51524u, property::type::LVT},
-  {51525u, property::type::LVT},
-  {51526u, property::type::LVT},
-  {51527u, property::type::LVT},
-  {51528u, property::type::LVT},
-  {51529u, property::type::LVT},
-  {51530u, property::type::LVT},
-  {51531u, property::type::LVT},
-  {51532u, property::type::LVT},
-  {51533u, property::type::LVT},
-  {51534u, property::type::LVT},
-  {51535u, property::type::LVT},
-  {51537u, property::type::LVT},
-  {51538u, property::type::LVT},
-  {51539u, property::type::LVT},
-  {51540u, property::type::LVT},
-  {51541u, property::type::LVT},
-  {51542u, property::type::LVT},
-  {51543u, property::type::LVT},
-  {51544u, property::type::LVT},
-  {51545u, property::type::LVT},
-  {51546u, property::type::LVT},
-  {51547u, property::type::LVT},
-  {51548u, property::type::LVT},
-  {51549u, property::type::LVT},
-  {51550u, property::type::LVT},
-  {51551u, property::type::LVT},
-  {51552u, property::type::LVT},
-  {51553u, property::type::LVT},
-  {51554u, property::type::LVT},
-  {51555u, property::type::LVT},
-  {51556u, property::type::LVT},
-  {51557u, property::type::LVT},
-  {51558u, property::type::LVT},
-  {51559u, property::type::LVT},
-  {51560u, property::type::LVT},
-  {51561u, property::type::LVT},
-  {51562u, property::type::LVT},
-  {51563u, property::type::LVT},
-  {51565u, property::type::LVT},
-  {51566u, property::type::LVT},
-  {51567u, property::type::LVT},
-  {51568u, property::type::LVT},
-  {51569u, property::type::LVT},
-  {51570u, property::type::LVT},
-  {51571u, property::type::LVT},
-  {51572u, property::type::LVT},
-  {51573u, property::type::LVT},
-  {51574u, property::type::LVT},
-  {51575u, property::type::LVT},
-  {51576u, property::type::LVT},
-  {51577u, property::type::LVT},
-  {51578u, property::type::LVT},
-  {51579u, property::type::LVT},
-  {51580u, property::type::LVT},
-  {51581u, property::type::LVT},
-  {51582u, property::type::LVT},
-  {51583u, property::type::LVT},
-  {51584u, property::type::LVT},
-  {51585u, property::type::LVT},
-  {51586u, property::type::LVT},
-  {51587u, property::type::LVT},
-  {51588u, property::type::LVT},
-  {51589u, property::type::LVT},
-  {51590u, property::type::LVT},
-  {51591u, property::type::LVT},
-  {51593u, property::type::LVT},
-  {51594u, property::type::LVT},
-  {51595u, property::type::LVT},
-  {51596u, property::type::LVT},
-  {51597u, property::type::LVT},
-  {51598u, property::type::LVT},
-  {51599u, property::type::LVT},
-  {51600u, property::type::LVT},
-  {51601u, property::type::LVT},
-  {51602u, property::type::LVT},
-  {51603u, property::type::LVT},
-  {51604u, property::type::LVT},
-  {51605u, property::type::LVT},
-  {51606u, property::type::LVT},
-  {51607u, property::type::LVT},
-  {51608u, property::type::LVT},
-  {51609u, property::type::LVT},
-  {51610u, property::type::LVT},
-  {51611u, property::type::LVT},
-  {51612u, property::type::LVT},
-  {51613u, property::type::LVT},
-  {51614u, property::type::LVT},
-  {51615u, property::type::LVT},
-  {51616u, property::type::LVT},
-  {51617u, property::type::LVT},
-  {51618u, property::type::LVT},
-  {51619u, property::type::LVT},
-  {51621u, property::type::LVT},
-  {51622u, property::type::LVT},
-  {51623u, property::type::LVT},
-  {51624u, property::type::LVT},
-  {51625u, property::type::LVT},
-  {51626u, property::type::LVT},
-  {51627u, property::type::LVT},
-  {51628u, property::type::LVT},
-  {51629u, property::type::LVT},
-  {51630u, property::type::LVT},
-  {51631u, property::type::LVT},
-  {51632u, property::type::LVT},
-  {51633u, property::type::LVT},
-  {51634u, property::type::LVT},
-  {51635u, property::type::LVT},
-  {51636u, property::type::LVT},
-  {51637u, property::type::LVT},
-  {51638u, property::type::LVT},
-  {51639u, property::type::LVT},
-  {51640u, property::type::LVT},
-  {51641u, property::type::LVT},
-  {51642u, property::type::LVT},
-  {51643u, property::type::LVT},
-  {51644u, property::type::LVT},
-  {51645u, property::type::LVT},
-  {51646u, property::type::LVT},
-  {51647u, property::type::LVT},
-  {51649u, property::type::LVT},
-  {51650u, property::type::LVT},
-  {51651u, property::type::LVT},
-  {51652u, property::type::LVT},
-  {51653u, property::type::LVT},
-  {51654u, property::type::LVT},
-  {51655u, property::type::LVT},
-  {51656u, property::type::LVT},
-  {51657u, property::type::LVT},
-  {51658u, property::type::LVT},
-  {51659u, property::type::LVT},
-  {51660u, property::type::LVT},
-  {51661u, property::type::LVT},
-  {51662u, property::type::LVT},
-  {51663u, property::type::LVT},
-  {51664u, property::type::LVT},
-  {51665u, property::type::LVT},
-  {51666u, property::type::LVT},
-  {51667u, property::type::LVT},
-  {51668u, property::type::LVT},
-  {51669u, property::type::LVT},
-  {51670u, property::type::LVT},
-  {51671u, property::type::LVT},
-  {51672u, property::type::LVT},
-  {51673u, property::type::LVT},
-  {51674u, property::type::LVT},
-  {51675u, property::type::LVT},
-  {51677u, property::type::LVT},
-  {51678u, property::type::LVT},
-  {51679u, property::type::LVT},
-  {51680u, property::type::LVT},
-  {51681u, property::type::LVT},
-  {51682u, property::type::LVT},
-  {51683u, property::type::LVT},
-  {51684u, property::type::LVT},
-  {51685u, property::type::LVT},
-  {51686u, property::type::LVT},
-  {51687u, property::type::LVT},
-  {51688u, property::type::LVT},
-  {51689u, property::type::LVT},
-  {51690u, property::type::LVT},
-  {51691u, property::type::LVT},
-  {51692u, property::type::LVT},
-  {51693u, property::type::LVT},
-  {51694u, property::type::LVT},
-  {51695u, property::type::LVT},
-  {51696u, property::type::LVT},
-  {51697u, property::type::LVT},
-  {51698u, property::type::LVT},
-  {51699u, property::type::LVT},
-  {51700u, property::type::LVT},
-  {51701u, property::type::LVT},
-  {51702u, property::type::LVT},
-  {51703u, property::type::LVT},
-  {51705u, property::type::LVT},
-  {51706u, property::type::LVT},
-  {51707u, property::type::LVT},
-  {51708u, property::type::LVT},
-  {51709u, property::type::LVT},
-  {51710u, property::type::LVT},
-  {51711u, property::type::LVT},
-  {51712u, property::type::LVT},
-  {51713u, property::type::LVT},
-  {51714u, property::type::LVT},
-  {51715u, property::type::LVT},
-  {51716u, property::type::LVT},
-  {51717u, property::type::LVT},
-  {51718u, property::type::LVT},
-  {51719u, property::type::LVT},
-  {51720u, property::type::LVT},
-  {51721u, property::type::LVT},
-  {51722u, property::type::LVT},
-  {51723u, property::type::LVT},
-  {51724u, property::type::LVT},
-  {51725u, property::type::LVT},
-  {51726u, property::type::LVT},
-  {51727u, property::type::LVT},
-  {51728u, property::type::LVT},
-  {51729u, property::type::LVT},
-  {51730u, property::type::LVT},
-  {51731u, property::type::LVT},
-  {51733u, property::type::LVT},
-  {51734u, property::type::LVT},
-  {51735u, property::type::LVT},
-  {51736u, property::type::LVT},
-  {51737u, property::type::LVT},
-  {51738u, property::type::LVT},
-  {51739u, property::type::LVT},
-  {51740u, property::type::LVT},
-  {51741u, property::type::LVT},
-  {51742u, property::type::LVT},
-  {51743u, property::type::LVT},
-  {51744u, property::type::LVT},
-  {51745u, property::type::LVT},
-  {51746u, property::type::LVT},
-  {51747u, property::type::LVT},
-  {51748u, property::type::LVT},
-  {51749u, property::type::LVT},
-  {51750u, property::type::LVT},
-  {51751u, property::type::LVT},
-  {51752u, property::type::LVT},
-  {51753u, property::type::LVT},
-  {51754u, property::type::LVT},
-  {51755u, property::type::LVT},
-  {51756u, property::type::LVT},
-  {51757u, property::type::LVT},
-  {51758u, property::type::LVT},
-  {51759u, property::type::LVT},
-  {51761u, property::type::LVT},
-  {51762u, property::type::LVT},
-  {51763u, property::type::LVT},
-  {51764u, property::type::LVT},
-  {51765u, property::type::LVT},
-  {51766u, property::type::LVT},
-  {51767u, property::type::LVT},
-  {51768u, property::type::LVT},
-  {51769u, property::type::LVT},
-  {51770u, property::type::LVT},
-  {51771u, property::type::LVT},
-  {51772u, property::type::LVT},
-  {51773u, property::type::LVT},
-  {51774u, property::type::LVT},
-  {51775u, property::type::LVT},
-  {51776u, property::type::LVT},
-  {51777u, property::type::LVT},
-  {51778u, property::type::LVT},
-  {51779u, property::type::LVT},
-  {51780u, property::type::LVT},
-  {51781u, property::type::LVT},
-  {51782u, property::type::LVT},
-  {51783u, property::type::LVT},
-  {51784u, property::type::LVT},
-  {51785u, property::type::LVT},
-  {51786u, property::type::LVT},
-  {51787u, property::type::LVT},
-  {51789u, property::type::LVT},
-  {51790u, property::type::LVT},
-  {51791u, property::type::LVT},
-  {51792u, property::type::LVT},
-  {51793u, property::type::LVT},
-  {51794u, property::type::LVT},
-  {51795u, property::type::LVT},
-  {51796u, property::type::LVT},
-  {51797u, property::type::LVT},
-  {51798u, property::type::LVT},
-  {51799u, property::type::LVT},
-  {51800u, property::type::LVT},
-  {51801u, property::type::LVT},
-  {51802u, property::type::LVT},
-  {51803u, property::type::LVT},
-  {51804u, property::type::LVT},
-  {51805u, property::type::LVT},
-  {51806u, property::type::LVT},
-  {51807u, property::type::LVT},
-  {51808u, property::type::LVT},
-  {51809u, property::type::LVT},
-  {51810u, property::type::LVT},
-  {51811u, property::type::LVT},
-  {51812u, property::type::LVT},
-  {51813u, property::type::LVT},
-  {51814u, property::type::LVT},
-  {51815u, property::type::LVT},
-  {51817u, property::type::LVT},
-  {51818u, property::type::LVT},
-  {51819u, property::type::LVT},
-  {51820u, property::type::LVT},
-  {51821u, property::type::LVT},
-  {51822u, property::type::LVT},
-  {51823u, property::type::LVT},
-  {51824u, property::type::LVT},
-  {51825u, property::type::LVT},
-  {51826u, property::type::LVT},
-  {51827u, property::type::LVT},
-  {51828u, property::type::LVT},
-  {51829u, property::type::LVT},
-  {51830u, property::type::LVT},
-  {51831u, property::type::LVT},
-  {51832u, property::type::LVT},
-  {51833u, property::type::LVT},
-  {51834u, property::type::LVT},
-  {51835u, property::type::LVT},
-  {51836u, property::type::LVT},
-  {51837u, property::type::LVT},
-  {51838u, property::type::LVT},
-  {51839u, property::type::LVT},
-  {51840u, property::type::LVT},
-  {51841u, property::type::LVT},
-  {51842u, property::type::LVT},
-  {51843u, property::type::LVT},
-  {51845u, property::type::LVT},
-  {51846u, property::type::LVT},
-  {51847u, property::type::LVT},
-  {51848u, property::type::LVT},
-  {51849u, property::type::LVT},
-  {51850u, property::type::LVT},
-  {51851u, property::type::LVT},
-  {51852u, property::type::LVT},
-  {51853u, property::type::LVT},
-  {51854u, property::type::LVT},
-  {51855u, property::type::LVT},
-  {51856u, property::type::LVT},
-  {51857u, property::type::LVT},
-  {51858u, property::type::LVT},
-  {51859u, property::type::LVT},
-  {51860u, property::type::LVT},
-  {51861u, property::type::LVT},
-  {51862u, property::type::LVT},
-  {51863u, property::type::LVT},
-  {51864u, property::type::LVT},
-  {51865u, property::type::LVT},
-  {51866u, property::type::LVT},
-  {51867u, property::type::LVT},
-  {51868u, property::type::LVT},
-  {51869u, property::type::LVT},
-  {51870u, property::type::LVT},
-  {51871u, property::type::LVT},
-  {51873u, property::type::LVT},
-  {51874u, property::type::LVT},
-  {51875u, property::type::LVT},
-  {51876u, property::type::LVT},
-  {51877u, property::type::LVT},
-  {51878u, property::type::LVT},
-  {51879u, property::type::LVT},
-  {51880u, property::type::LVT},
-  {51881u, property::type::LVT},
-  {51882u, property::type::LVT},
-  {51883u, property::type::LVT},
-  {51884u, property::type::LVT},
-  {51885u, property::type::LVT},
-  {51886u, property::type::LVT},
-  {51887u, property::type::LVT},
-  {51888u, property::type::LVT},
-  {51889u, property::type::LVT},
-  {51890u, property::type::LVT},
-  {51891u, property::type::LVT},
-  {51892u, property::type::LVT},
-  {51893u, property::type::LVT},
-  {51894u, property::type::LVT},
-  {51895u, property::type::LVT},
-  {51896u, property::type::LVT},
-  {51897u, property::type::LVT},
-  {51898u, property::type::LVT},
-  {51899u, property::type::LVT},
-  {51901u, property::type::LVT},
-  {51902u, property::type::LVT},
-  {51903u, property::type::LVT},
-  {51904u, property::type::LVT},
-  {51905u, property::type::LVT},
-  {51906u, property::type::LVT},
-  {51907u, property::type::LVT},
-  {51908u, property::type::LVT},
-  {51909u, property::type::LVT},
-  {51910u, property::type::LVT},
-  {51911u, property::type::LVT},
-  {51912u, property::type::LVT},
-  {51913u, property::type::LVT},
-  {51914u, property::type::LVT},
-  {51915u, property::type::LVT},
-  {51916u, property::type::LVT},
-  {51917u, property::type::LVT},
-  {51918u, property::type::LVT},
-  {51919u, property::type::LVT},
-  {51920u, property::type::LVT},
-  {51921u, property::type::LVT},
-  {51922u, property::type::LVT},
-  {51923u, property::type::LVT},
-  {51924u, property::type::LVT},
-  {51925u, property::type::LVT},
-  {51926u, property::type::LVT},
-  {51927u, property::type::LVT},
-  {51929u, property::type::LVT},
-  {51930u, property::type::LVT},
-  {51931u, property::type::LVT},
-  {51932u, property::type::LVT},
-  {51933u, property::type::LVT},
-  {51934u, property::type::LVT},
-  {51935u, property::type::LVT},
-  {51936u, property::type::LVT},
-  {51937u, property::type::LVT},
-  {51938u, property::type::LVT},
-  {51939u, property::type::LVT},
-  {51940u, property::type::LVT},
-  {51941u, property::type::LVT},
-  {51942u, property::type::LVT},
-  {51943u, property::type::LVT},
-  {51944u, property::type::LVT},
-  {51945u, property::type::LVT},
-  {51946u, property::type::LVT},
-  {51947u, property::type::LVT},
-  {51948u, property::type::LVT},
-  {51949u, property::type::LVT},
-  {51950u, property::type::LVT},
-  {51951u, property::type::LVT},
-  {51952u, property::type::LVT},
-  {51953u, property::type::LVT},
-  {51954u, property::type::LVT},
-  {51955u, property::type::LVT},
-  {51957u, property::type::LVT},
-  {51958u, property::type::LVT},
-  {51959u, property::type::LVT},
-  {51960u, property::type::LVT},
-  {51961u, property::type::LVT},
-  {51962u, property::type::LVT},
-  {51963u, property::type::LVT},
-  {51964u, property::type::LVT},
-  {51965u, property::type::LVT},
-  {51966u, property::type::LVT},
-  {51967u, property::type::LVT},
-  {51968u, property::type::LVT},
-  {51969u, property::type::LVT},
-  {51970u, property::type::LVT},
-  {51971u, property::type::LVT},
-  {51972u, property::type::LVT},
-  {51973u, property::type::LVT},
-  {51974u, property::type::LVT},
-  {51975u, property::type::LVT},
-  {51976u, property::type::LVT},
-  {51977u, property::type::LVT},
-  {51978u, property::type::LVT},
-  {51979u, property::type::LVT},
-  {51980u, property::type::LVT},
-  {51981u, property::type::LVT},
-  {51982u, property::type::LVT},
-  {51983u, property::type::LVT},
-  {51985u, property::type::LVT},
-  {51986u, property::type::LVT},
-  {51987u, property::type::LVT},
-  {51988u, property::type::LVT},
-  {51989u, property::type::LVT},
-  {51990u, property::type::LVT},
-  {51991u, property::type::LVT},
-  {51992u, property::type::LVT},
-  {51993u, property::type::LVT},
-  {51994u, property::type::LVT},
-  {51995u, property::type::LVT},
-  {51996u, property::type::LVT},
-  {51997u, property::type::LVT},
-  {51998u, property::type::LVT},
-  {51999u, property::type::LVT},
-  {52000u, property::type::LVT},
-  {52001u, property::type::LVT},
-  {52002u, property::type::LVT},
-  {52003u, property::type::LVT},
-  {52004u, property::type::LVT},
-  {52005u, property::type::LVT},
-  {52006u, property::type::LVT},
-  {52007u, property::type::LVT},
-  {52008u, property::type::LVT},
-  {52009u, property::type::LVT},
-  {52010u, property::type::LVT},
-  {52011u, property::type::LVT},
-  {52013u, property::type::LVT},
-  {52014u, property::type::LVT},
-  {52015u, property::type::LVT},
-  {52016u, property::type::LVT},
-  {52017u, property::type::LVT},
-  {52018u, property::type::LVT},
-  {52019u, property::type::LVT},
-  {52020u, property::type::LVT},
-  {52021u, property::type::LVT},
-  {52022u, property::type::LVT},
-  {52023u, property::type::LVT},
-  {52024u, property::type::LVT},
-  {52025u, property::type::LVT},
-  {52026u, property::type::LVT},
-  {52027u, property::type::LVT},
-  {52028u, property::type::LVT},
-  {52029u, property::type::LVT},
-  {52030u, property::type::LVT},
-  {52031u, property::type::LVT},
-  {52032u, property::type::LVT},
-  {52033u, property::type::LVT},
-  {52034u, property::type::LVT},
-  {52035u, property::type::LVT},
-  {52036u, property::type::LVT},
-  {52037u, property::type::LVT},
-  {52038u, property::type::LVT},
-  {52039u, property::type::LVT},
-  {52041u, property::type::LVT},
-  {52042u, property::type::LVT},
-  {52043u, property::type::LVT},
-  {52044u, property::type::LVT},
-  {52045u, property::type::LVT},
-  {52046u, property::type::LVT},
-  {52047u, property::type::LVT},
-  {52048u, property::type::LVT},
-  {52049u, property::type::LVT},
-  {52050u, property::type::LVT},
-  {52051u, property::type::LVT},
-  {52052u, property::type::LVT},
-  {52053u, property::type::LVT},
-  {52054u, property::type::LVT},
-  {52055u, property::type::LVT},
-  {52056u, property::type::LVT},
-  {52057u, property::type::LVT},
-  {52058u, property::type::LVT},
-  {52059u, property::type::LVT},
-  {52060u, property::type::LVT},
-  {52061u, property::type::LVT},
-  {52062u, property::type::LVT},
-  {52063u, property::type::LVT},
-  {52064u, property::type::LVT},
-  {52065u, property::type::LVT},
-  {52066u, property::type::LVT},
-  {52067u, property::type::LVT},
-  {52069u, property::type::LVT},
-  {52070u, property::type::LVT},
-  {52071u, property::type::LVT},
-  {52072u, property::type::LVT},
-  {52073u, property::type::LVT},
-  {52074u, property::type::LVT},
-  {52075u, property::type::LVT},
-  {52076u, property::type::LVT},
-  {52077u, property::type::LVT},
-  {52078u, property::type::LVT},
-  {52079u, property::type::LVT},
-  {52080u, property::type::LVT},
-  {52081u, property::type::LVT},
-  {52082u, property::type::LVT},
-  {52083u, property::type::LVT},
-  {52084u, property::type::LVT},
-  {52085u, property::type::LVT},
-  {52086u, property::type::LVT},
-  {52087u, property::type::LVT},
-  {52088u, property::type::LVT},
-  {52089u, property::type::LVT},
-  {52090u, property::type::LVT},
-  {52091u, property::type::LVT},
-  {52092u, property::type::LVT},
-  {52093u, property::type::LVT},
-  {52094u, property::type::LVT},
-  {52095u, property::type::LVT},
-  {52097u, property::type::LVT},
-  {52098u, property::type::LVT},
-  {52099u, property::type::LVT},
-  {52100u, property::type::LVT},
-  {52101u, property::type::LVT},
-  {52102u, property::type::LVT},
-  {52103u, property::type::LVT},
-  {52104u, property::type::LVT},
-  {52105u, property::type::LVT},
-  {52106u, property::type::LVT},
-  {52107u, property::type::LVT},
-  {52108u, property::type::LVT},
-  {52109u, property::type::LVT},
-  {52110u, property::type::LVT},
-  {52111u, property::type::LVT},
-  {52112u, property::type::LVT},
-  {52113u, property::type::LVT},
-  {52114u, property::type::LVT},
-  {52115u, property::type::LVT},
-  {52116u, property::type::LVT},
-  {52117u, property::type::LVT},
-  {52118u, property::type::LVT},
-  {52119u, property::type::LVT},
-  {52120u, property::type::LVT},
-  {52121u, property::type::LVT},
-  {52122u, property::type::LVT},
-  {52123u, property::type::LVT},
-  {52125u, property::type::LVT},
-  {52126u, property::type::LVT},
-  {52127u, property::type::LVT},
-  {52128u, property::type::LVT},
-  {52129u, property::type::LVT},
-  {52130u, property::type::LVT},
-  {52131u, property::type::LVT},
-  {52132u, property::type::LVT},
-  {52133u, property::type::LVT},
-  {52134u, property::type::LVT},
-  {52135u, property::type::LVT},
-  {52136u, property::type::LVT},
-  {52137u, property::type::LVT},
-  {52138u, property::type::LVT},
-  {52139u, property::type::LVT},
-  {52140u, property::type::LVT},
-  {52141u, property::type::LVT},
-  {52142u, property::type::LVT},
-  {52143u, property::type::LVT},
-  {52144u, property::type::LVT},
-  {52145u, property::type::LVT},
-  {52146u, property::type::LVT},
-  {52147u, property::type::LVT},
-  {52148u, property::type::LVT},
-  {52149u, property::type::LVT},
-  {52150u, property::type::LVT},
-  {52151u, property::type::LVT},
-  {52153u, property::type::LVT},
-  {52154u, property::type::LVT},
-  {52155u, property::type::LVT},
-  {52156u, property::type::LVT},
-  {52157u, property::type::LVT},
-  {52158u, property::type::LVT},
-  {52159u, property::type::LVT},
-  {52160u, property::type::LVT},
-  {52161u, property::type::LVT},
-  {52162u, property::type::LVT},
-  {52163u, property::type::LVT},
-  {52164u, property::type::LVT},
-  {52165u, property::type::LVT},
-  {52166u, property::type::LVT},
-  {52167u, property::type::LVT},
-  {52168u, property::type::LVT},
-  {52169u, property::type::LVT},
-  {52170u, property::type::LVT},
-  {52171u, property::type::LVT},
-  {52172u, property::type::LVT},
-  {52173u, property::type::LVT},
-  {52174u, property::type::LVT},
-  {52175u, property::type::LVT},
-  {52176u, property::type::LVT},
-  {52177u, property::type::LVT},
-  {52178u, property::type::LVT},
-  {52179u, property::type::LVT},
-  {52181u, property::type::LVT},
-  {52182u, property::type::LVT},
-  {52183u, property::type::LVT},
-  {52184u, property::type::LVT},
-  {52185u, property::type::LVT},
-  {52186u, property::type::LVT},
-  {52187u, property::type::LVT},
-  {52188u, property::type::LVT},
-  {52189u, property::type::LVT},
-  {52190u, property::type::LVT},
-  {52191u, property::type::LVT},
-  {52192u, property::type::LVT},
-  {52193u, property::type::LVT},
-  {52194u, property::type::LVT},
-  {52195u, property::type::LVT},
-  {52196u, property::type::LVT},
-  {52197u, property::type::LVT},
-  {52198u, property::type::LVT},
-  {52199u, property::type::LVT},
-  {52200u, property::type::LVT},
-  {52201u, property::type::LVT},
-  {52202u, property::type::LVT},
-  {52203u, property::type::LVT},
-  {52204u, property::type::LVT},
-  {52205u, property::type::LVT},
-  {52206u, property::type::LVT},
-  {52207u, property::type::LVT},
-  {52209u, property::type::LVT},
-  {52210u, property::type::LVT},
-  {52211u, property::type::LVT},
-  {52212u, property::type::LVT},
-  {52213u, property::type::LVT},
-  {52214u, property::type::LVT},
-  {52215u, property::type::LVT},
-  {52216u, property::type::LVT},
-  {52217u, property::type::LVT},
-  {52218u, property::type::LVT},
-  {52219u, property::type::LVT},
-  {52220u, property::type::LVT},
-  {52221u, property::type::LVT},
-  {52222u, property::type::LVT},
-  {52223u, property::type::LVT},
-  {52224u, property::type::LVT},
-  {52225u, property::type::LVT},
-  {52226u, property::type::LVT},
-  {52227u, property::type::LVT},
-  {52228u, property::type::LVT},
-  {52229u, property::type::LVT},
-  {52230u, property::type::LVT},
-  {52231u, property::type::LVT},
-  {52232u, property::type::LVT},
-  {52233u, property::type::LVT},
-  {52234u, property::type::LVT},
-  {52235u, property::type::LVT},
-  {52237u, property::type::LVT},
-  {52238u, property::type::LVT},
-  {52239u, property::type::LVT},
-  {52240u, property::type::LVT},
-  {52241u, property::type::LVT},
-  {52242u, property::type::LVT},
-  {52243u, property::type::LVT},
-  {52244u, property::type::LVT},
-  {52245u, property::type::LVT},
-  {52246u, property::type::LVT},
-  {52247u, property::type::LVT},
-  {52248u, property::type::LVT},
-  {52249u, property::type::LVT},
-  {52250u, property::type::LVT},
-  {52251u, property::type::LVT},
-  {52252u, property::type::LVT},
-  {52253u, property::type::LVT},
-  {52254u, property::type::LVT},
-  {52255u, property::type::LVT},
-  {52256u, property::type::LVT},
-  {52257u, property::type::LVT},
-  {52258u, property::type::LVT},
-  {52259u, property::type::LVT},
-  {52260u, property::type::LVT},
-  {52261u, property::type::LVT},
-  {52262u, property::type::LVT},
-  {52263u, property::type::LVT},
-  {52265u, property::type::LVT},
-  {52266u, property::type::LVT},
-  {52267u, property::type::LVT},
-  {52268u, property::type::LVT},
-  {52269u, property::type::LVT},
-  {52270u, property::type::LVT},
-  {52271u, property::type::LVT},
-  {52272u, property::type::LVT},
-  {52273u, property::type::LVT},
-  {52274u, property::type::LVT},
-  {52275u, property::type::LVT},
-  {52276u, property::type::LVT},
-  {52277u, property::type::LVT},
-  {52278u, property::type::LVT},
-  {52279u, property::type::LVT},
-  {52280u, property::type::LVT},
-  {52281u, property::type::LVT},
-  {52282u, property::type::LVT},
-  {52283u, property::type::LVT},
-  {52284u, property::type::LVT},
-  {52285u, property::type::LVT},
-  {52286u, property::type::LVT},
-  {52287u, property::type::LVT},
-  {52288u, property::type::LVT},
-  {52289u, property::type::LVT},
-  {52290u, property::type::LVT},
-  {52291u, property::type::LVT},
-  {52293u, property::type::LVT},
-  {52294u, property::type::LVT},
-  {52295u, property::type::LVT},
-  {52296u, property::type::LVT},
-  {52297u, property::type::LVT},
-  {52298u, property::type::LVT},
-  {52299u, property::type::LVT},
-  {52300u, property::type::LVT},
-  {52301u, property::type::LVT},
-  {52302u, property::type::LVT},
-  {52303u, property::type::LVT},
-  {52304u, property::type::LVT},
-  {52305u, property::type::LVT},
-  {52306u, property::type::LVT},
-  {52307u, property::type::LVT},
-  {52308u, property::type::LVT},
-  {52309u, property::type::LVT},
-  {52310u, property::type::LVT},
-  {52311u, property::type::LVT},
-  {52312u, property::type::LVT},
-  {52313u, property::type::LVT},
-  {52314u, property::type::LVT},
-  {52315u, property::type::LVT},
-  {52316u, property::type::LVT},
-  {52317u, property::type::LVT},
-  {52318u, property::type::LVT},
-  {52319u, property::type::LVT},
-  {52321u, property::type::LVT},
-  {52322u, property::type::LVT},
-  {52323u, property::type::LVT},
-  {52324u, property::type::LVT},
-  {52325u, property::type::LVT},
-  {52326u, property::type::LVT},
-  {52327u, property::type::LVT},
-  {52328u, property::type::LVT},
-  {52329u, property::type::LVT},
-  {52330u, property::type::LVT},
-  {52331u, property::type::LVT},
-  {52332u, property::type::LVT},
-  {52333u, property::type::LVT},
-  {52334u, property::type::LVT},
-  {52335u, property::type::LVT},
-  {52336u, property::type::LVT},
-  {52337u, property::type::LVT},
-  {52338u, property::type::LVT},
-  {52339u, property::type::LVT},
-  {52340u, property::type::LVT},
-  {52341u, property::type::LVT},
-  {52342u, property::type::LVT},
-  {52343u, property::type::LVT},
-  {52344u, property::type::LVT},
-  {52345u, property::type::LVT},
-  {52346u, property::type::LVT},
-  {52347u, property::type::LVT},
-  {52349u, property::type::LVT},
-  {52350u, property::type::LVT},
-  {52351u, property::type::LVT},
-  {52352u, property::type::LVT},
-  {52353u, property::type::LVT},
-  {52354u, property::type::LVT},
-  {52355u, property::type::LVT},
-  {52356u, property::type::LVT},
-  {52357u, property::type::LVT},
-  {52358u, property::type::LVT},
-  {52359u, property::type::LVT},
-  {52360u, property::type::LVT},
-  {52361u, property::type::LVT},
-  {52362u, property::type::LVT},
-  {52363u, property::type::LVT},
-  {52364u, property::type::LVT},
-  {52365u, property::type::LVT},
-  {52366u, property::type::LVT},
-  {52367u, property::type::LVT},
-  {52368u, property::type::LVT},
-  {52369u, property::type::LVT},
-  {52370u, property::type::LVT},
-  {52371u, property::type::LVT},
-  {52372u, property::type::LVT},
-  {52373u, property::type::LVT},
-  {52374u, property::type::LVT},
-  {52375u, property::type::LVT},
-  {52377u, property::type::LVT},
-  {52378u, property::type::LVT},
-  {52379u, property::type::LVT},
-  {52380u, property::type::LVT},
-  {52381u, property::type::LVT},
-  {52382u, property::type::LVT},
-  {52383u, property::type::LVT},
-  {52384u, property::type::LVT},
-  {52385u, property::type::LVT},
-  {52386u, property::type::LVT},
-  {52387u, property::type::LVT},
-  {52388u, property::type::LVT},
-  {52389u, property::type::LVT},
-  {52390u, property::type::LVT},
-  {52391u, property::type::LVT},
-  {52392u, property::type::LVT},
-  {52393u, property::type::LVT},
-  {52394u, property::type::LVT},
-  {52395u, property::type::LVT},
-  {52396u, property::type::LVT},
-  {52397u, property::type::LVT},
-  {52398u, property::type::LVT},
-  {52399u, property::type::LVT},
-  {52400u, property::type::LVT},
-  {52401u, property::type::LVT},
-  {52402u, property::type::LVT},
-  {52403u, property::type::LVT},
-  {52405u, property::type::LVT},
-  {52406u, property::type::LVT},
-  {52407u, property::type::LVT},
-  {52408u, property::type::LVT},
-  {52409u, property::type::LVT},
-  {52410u, property::type::LVT},
-  {52411u, property::type::LVT},
-  {52412u, property::type::LVT},
-  {52413u, property::type::LVT},
-  {52414u, property::type::LVT},
-  {52415u, property::type::LVT},
-  {52416u, property::type::LVT},
-  {52417u, property::type::LVT},
-  {52418u, property::type::LVT},
-  {52419u, property::type::LVT},
-  {52420u, property::type::LVT},
-  {52421u, property::type::LVT},
-  {52422u, property::type::LVT},
-  {52423u, property::type::LVT},
-  {52424u, property::type::LVT},
-  {52425u, property::type::LVT},
-  {52426u, property::type::LVT},
-  {52427u, property::type::LVT},
-  {52428u, property::type::LVT},
-  {52429u, property::type::LVT},
-  {52430u, property::type::LVT},
-  {52431u, property::type::LVT},
-  {52433u, property::type::LVT},
-  {52434u, property::type::LVT},
-  {52435u, property::type::LVT},
-  {52436u, property::type::LVT},
-  {52437u, property::type::LVT},
-  {52438u, property::type::LVT},
-  {52439u, property::type::LVT},
-  {52440u, property::type::LVT},
-  {52441u, property::type::LVT},
-  {52442u, property::type::LVT},
-  {52443u, property::type::LVT},
-  {52444u, property::type::LVT},
-  {52445u, property::type::LVT},
-  {52446u, property::type::LVT},
-  {52447u, property::type::LVT},
-  {52448u, property::type::LVT},
-  {52449u, property::type::LVT},
-  {52450u, property::type::LVT},
-  {52451u, property::type::LVT},
-  {52452u, property::type::LVT},
-  {52453u, property::type::LVT},
-  {52454u, property::type::LVT},
-  {52455u, property::type::LVT},
-  {52456u, property::type::LVT},
-  {52457u, property::type::LVT},
-  {52458u, property::type::LVT},
-  {52459u, property::type::LVT},
-  {52461u, property::type::LVT},
-  {52462u, property::type::LVT},
-  {52463u, property::type::LVT},
-  {52464u, property::type::LVT},
-  {52465u, property::type::LVT},
-  {52466u, property::type::LVT},
-  {52467u, property::type::LVT},
-  {52468u, property::type::LVT},
-  {52469u, property::type::LVT},
-  {52470u, property::type::LVT},
-  {52471u, property::type::LVT},
-  {52472u, property::type::LVT},
-  {52473u, property::type::LVT},
-  {52474u, property::type::LVT},
-  {52475u, property::type::LVT},
-  {52476u, property::type::LVT},
-  {52477u, property::type::LVT},
-  {52478u, property::type::LVT},
-  {52479u, property::type::LVT},
-  {52480u, property::type::LVT},
-  {52481u, property::type::LVT},
-  {52482u, property::type::LVT},
-  {52483u, property::type::LVT},
-  {52484u, property::type::LVT},
-  {52485u, property::type::LVT},
-  {52486u, property::type::LVT},
-  {52487u, property::type::LVT},
-  {52489u, property::type::LVT},
-  {52490u, property::type::LVT},
-  {52491u, property::type::LVT},
-  {52492u, property::type::LVT},
-  {52493u, property::type::LVT},
-  {52494u, property::type::LVT},
-  {52495u, property::type::LVT},
-  {52496u, property::type::LVT},
-  {52497u, property::type::LVT},
-  {52498u, property::type::LVT},
-  {52499u, property::type::LVT},
-  {52500u, property::type::LVT},
-  {52501u, property::type::LVT},
-  {52502u, property::type::LVT},
-  {52503u, property::type::LVT},
-  {52504u, property::type::LVT},
-  {52505u, property::type::LVT},
-  {52506u, property::type::LVT},
-  {52507u, property::type::LVT},
-  {52508u, property::type::LVT},
-  {52509u, property::type::LVT},
-  {52510u, property::type::LVT},
-  {52511u, property::type::LVT},
-  {52512u, property::type::LVT},
-  {52513u, property::type::LVT},
-  {52514u, property::type::LVT},
-  {52515u, property::type::LVT},
-  {52517u, property::type::LVT},
-  {52518u, property::type::LVT},
-  {52519u, property::type::LVT},
-  {52520u, property::type::LVT},
-  {52521u, property::type::LVT},
-  {52522u, property::type::LVT},
-  {52523u, property::type::LVT},
-  {52524u, property::type::LVT},
-  {52525u, property::type::LVT},
-  {52526u, property::type::LVT},
-  {52527u, property::type::LVT},
-  {52528u, property::type::LVT},
-  {52529u, property::type::LVT},
-  {52530u, property::type::LVT},
-  {52531u, property::type::LVT},
-  {52532u, property::type::LVT},
-  {52533u, property::type::LVT},
-  {52534u, property::type::LVT},
-  {52535u, property::type::LVT},
-  {52536u, property::type::LVT},
-  {52537u, property::type::LVT},
-  {52538u, property::type::LVT},
-  {52539u, property::type::LVT},
-  {52540u, property::type::LVT},
-  {52541u, property::type::LVT},
-  {52542u, property::type::LVT},
-  {52543u, property::type::LVT},
-  {52545u, property::type::LVT},
-  {52546u, property::type::LVT},
-  {52547u, property::type::LVT},
-  {52548u, property::type::LVT},
-  {52549u, property::type::LVT},
-  {52550u, property::type::LVT},
-  {52551u, property::type::LVT},
-  {52552u, property::type::LVT},
-  {52553u, property::type::LVT},
-  {52554u, property::type::LVT},
-  {52555u, property::type::LVT},
-  {52556u, property::type::LVT},
-  {52557u, property::type::LVT},
-  {52558u, property::type::LVT},
-  {52559u, property::type::LVT},
-  {52560u, property::type::LVT},
-  {52561u, property::type::LVT},
-  {52562u, property::type::LVT},
-  {52563u, property::type::LVT},
-  {52564u, property::type::LVT},
-  {52565u, property::type::LVT},
-  {52566u, property::type::LVT},
-  {52567u, property::type::LVT},
-  {52568u, property::type::LVT},
-  {52569u, property::type::LVT},
-  {52570u, property::type::LVT},
-  {52571u, property::type::LVT},
-  {52573u, property::type::LVT},
-  {52574u, property::type::LVT},
-  {52575u, property::type::LVT},
-  {52576u, property::type::LVT},
-  {52577u, property::type::LVT},
-  {52578u, property::type::LVT},
-  {52579u, property::type::LVT},
-  {52580u, property::type::LVT},
-  {52581u, property::type::LVT},
-  {52582u, property::type::LVT},
-  {52583u, property::type::LVT},
-  {52584u, property::type::LVT},
-  {52585u, property::type::LVT},
-  {52586u, property::type::LVT},
-  {52587u, property::type::LVT},
-  {52588u, property::type::LVT},
-  {52589u, property::type::LVT},
-  {52590u, property::type::LVT},
-  {52591u, property::type::LVT},
-  {52592u, property::type::LVT},
-  {52593u, property::type::LVT},
-  {52594u, property::type::LVT},
-  {52595u, property::type::LVT},
-  {52596u, property::type::LVT},
-  {52597u, property::type::LVT},
-  {52598u, property::type::LVT},
-  {52599u, property::type::LVT},
-  {52601u, property::type::LVT},
-  {52602u, property::type::LVT},
-  {52603u, property::type::LVT},
-  {52604u, property::type::LVT},
-  {52605u, property::type::LVT},
-  {52606u, property::type::LVT},
-  {52607u, property::type::LVT},
-  {52608u, property::type::LVT},
-  {52609u, property::type::LVT},
-  {52610u, property::type::LVT},
-  {52611u, property::type::LVT},
-  {52612u, property::type::LVT},
-  {52613u, property::type::LVT},
-  {52614u, property::type::LVT},
-  {52615u, property::type::LVT},
-  {52616u, property::type::LVT},
-  {52617u, property::type::LVT},
-  {52618u, property::type::LVT},
-  {52619u, property::type::LVT},
-  {52620u, property::type::LVT},
-  {52621u, property::type::LVT},
-  {52622u, property::type::LVT},
-  {52623u, property::type::LVT},
-  {52624u, property::type::LVT},
-  {52625u, property::type::LVT},
-  {52626u, property::type::LVT},
-  {52627u, property::type::LVT},
-  {52629u, property::type::LVT},
-  {52630u, property::type::LVT},
-  {52631u, property::type::LVT},
-  {52632u, property::type::LVT},
-  {52633u, property::type::LVT},
-  {52634u, property::type::LVT},
-  {52635u, property::type::LVT},
-  {52636u, property::type::LVT},
-  {52637u, property::type::LVT},
-  {52638u, property::type::LVT},
-  {52639u, property::type::LVT},
-  {52640u, property::type::LVT},
-  {52641u, property::type::LVT},
-  {52642u, property::type::LVT},
-  {52643u, property::type::LVT},
-  {52644u, property::type::LVT},
-  {52645u, property::type::LVT},
-  {52646u, property::type::LVT},
-  {52647u, property::type::LVT},
-  {52648u, property::type::LVT},
-  {52649u, property::type::LVT},
-  {52650u, property::type::LVT},
-  {52651u, property::type::LVT},
-  {52652u, property::type::LVT},
-  {52653u, property::type::LVT},
-  {52654u, property::type::LVT},
-  {52655u, property::type::LVT},
-  {52657u, property::type::LVT},
-  {52658u, property::type::LVT},
-  {52659u, property::type::LVT},
-  {52660u, property::type::LVT},
-  {52661u, property::type::LVT},
-  {52662u, property::type::LVT},
-  {52663u, property::type::LVT},
-  {52664u, property::type::LVT},
-  {52665u, property::type::LVT},
-  {52666u, property::type::LVT},
-  {52667u, property::type::LVT},
-  {52668u, property::type::LVT},
-  {52669u, property::type::LVT},
-  {52670u, property::type::LVT},
-  {52671u, property::type::LVT},
-  {52672u, property::type::LVT},
-  {52673u, property::type::LVT},
-  {52674u, property::type::LVT},
-  {52675u, property::type::LVT},
-  {52676u, property::type::LVT},
-  {52677u, property::type::LVT},
-  {52678u, property::type::LVT},
-  {52679u, property::type::LVT},
-  {52680u, property::type::LVT},
-  {52681u, property::type::LVT},
-  {52682u, property::type::LVT},
-  {52683u, property::type::LVT},
-  {52685u, property::type::LVT},
-  {52686u, property::type::LVT},
-  {52687u, property::type::LVT},
-  {52688u, property::type::LVT},
-  {52689u, property::type::LVT},
-  {52690u, property::type::LVT},
-  {52691u, property::type::LVT},
-  {52692u, property::type::LVT},
-  {52693u, property::type::LVT},
-  {52694u, property::type::LVT},
-  {52695u, property::type::LVT},
-  {52696u, property::type::LVT},
-  {52697u, property::type::LVT},
-  {52698u, property::type::LVT},
-  {52699u, property::type::LVT},
-  {52700u, property::type::LVT},
-  {52701u, property::type::LVT},
-  {52702u, property::type::LVT},
-  {52703u, property::type::LVT},
-  {52704u, property::type::LVT},
-  {52705u, property::type::LVT},
-  {52706u, property::type::LVT},
-  {52707u, property::type::LVT},
-  {52708u, property::type::LVT},
-  {52709u, property::type::LVT},
-  {52710u, property::type::LVT},
-  {52711u, property::type::LVT},
-  {52713u, property::type::LVT},
-  {52714u, property::type::LVT},
-  {52715u, property::type::LVT},
-  {52716u, property::type::LVT},
-  {52717u, property::type::LVT},
-  {52718u, property::type::LVT},
-  {52719u, property::type::LVT},
-  {52720u, property::type::LVT},
-  {52721u, property::type::LVT},
-  {52722u, property::type::LVT},
-  {52723u, property::type::LVT},
-  {52724u, property::type::LVT},
-  {52725u, property::type::LVT},
-  {52726u, property::type::LVT},
-  {52727u, property::type::LVT},
-  {52728u, property::type::LVT},
-  {52729u, property::type::LVT},
-  {52730u, property::type::LVT},
-  {52731u, property::type::LVT},
-  {52732u, property::type::LVT},
-  {52733u, property::type::LVT},
-  {52734u, property::type::LVT},
-  {52735u, property::type::LVT},
-  {52736u, property::type::LVT},
-  {52737u, property::type::LVT},
-  {52738u, property::type::LVT},
-  {52739u, property::type::LVT},
-  {52741u, property::type::LVT},
-  {52742u, property::type::LVT},
-  {52743u, property::type::LVT},
-  {52744u, property::type::LVT},
-  {52745u, property::type::LVT},
-  {52746u, property::type::LVT},
-  {52747u, property::type::LVT},
-  {52748u, property::type::LVT},
-  {52749u, property::type::LVT},
-  {52750u, property::type::LVT},
-  {52751u, property::type::LVT},
-  {52752u, property::type::LVT},
-  {52753u, property::type::LVT},
-  {52754u, property::type::LVT},
-  {52755u, property::type::LVT},
-  {52756u, property::type::LVT},
-  {52757u, property::type::LVT},
-  {52758u, property::type::LVT},
-  {52759u, property::type::LVT},
-  {52760u, property::type::LVT},
-  {52761u, property::type::LVT},
-  {52762u, property::type::LVT},
-  {52763u, property::type::LVT},
-  {52764u, property::type::LVT},
-  {52765u, property::type::LVT},
-  {52766u, property::type::LVT},
-  {52767u, property::type::LVT},
-  {52769u, property::type::LVT},
-  {52770u, property::type::LVT},
-  {52771u, property::type::LVT},
-  {52772u, property::type::LVT},
-  {52773u, property::type::LVT},
-  {52774u, property::type::LVT},
-  {52775u, property::type::LVT},
-  {52776u, property::type::LVT},
-  {52777u, property::type::LVT},
-  {52778u, property::type::LVT},
-  {52779u, property::type::LVT},
-  {52780u, property::type::LVT},
-  {52781u, property::type::LVT},
-  {52782u, property::type::LVT},
-  {52783u, property::type::LVT},
-  {52784u, property::type::LVT},
-  {52785u, property::type::LVT},
-  {52786u, property::type::LVT},
-  {52787u, property::type::LVT},
-  {52788u, property::type::LVT},
-  {52789u, property::type::LVT},
-  {52790u, property::type::LVT},
-  {52791u, property::type::LVT},
-  {52792u, property::type::LVT},
-  {52793u, property::type::LVT},
-  {52794u, property::type::LVT},
-  {52795u, property::type::LVT},
-  {52797u, property::type::LVT},
-  {52798u, property::type::LVT},
-  {52799u, property::type::LVT},
-  {52800u, property::type::LVT},
-  {52801u, property::type::LVT},
-  {52802u, property::type::LVT},
-  {52803u, property::type::LVT},
-  {52804u, property::type::LVT},
-  {52805u, property::type::LVT},
-  {52806u, property::type::LVT},
-  {52807u, property::type::LVT},
-  {52808u, property::type::LVT},
-  {52809u, property::type::LVT},
-  {52810u, property::type::LVT},
-  {52811u, property::type::LVT},
-  {52812u, property::type::LVT},
-  {52813u, property::type::LVT},
-  {52814u, property::type::LVT},
-  {52815u, property::type::LVT},
-  {52816u, property::type::LVT},
-  {52817u, property::type::LVT},
-  {52818u, property::type::LVT},
-  {52819u, property::type::LVT},
-  {52820u, property::type::LVT},
-  {52821u, property::type::LVT},
-  {52822u, property::type::LVT},
-  {52823u, property::type::LVT},
-  {52825u, property::type::LVT},
-  {52826u, property::type::LVT},
-  {52827u, property::type::LVT},
-  {52828u, property::type::LVT},
-  {52829u, property::type::LVT},
-  {52830u, property::type::LVT},
-  {52831u, property::type::LVT},
-  {52832u, property::type::LVT},
-  {52833u, property::type::LVT},
-  {52834u, property::type::LVT},
-  {52835u, property::type::LVT},
-  {52836u, property::type::LVT},
-  {52837u, property::type::LVT},
-  {52838u, property::type::LVT},
-  {52839u, property::type::LVT},
-  {52840u, property::type::LVT},
-  {52841u, property::type::LVT},
-  {52842u, property::type::LVT},
-  {52843u, property::type::LVT},
-  {52844u, property::type::LVT},
-  {52845u, property::type::LVT},
-  {52846u, property::type::LVT},
-  {52847u, property::type::LVT},
-  {52848u, property::type::LVT},
-  {52849u, property::type::LVT},
-  {52850u, property::type::LVT},
-  {52851u, property::type::LVT},
-  {52853u, property::type::LVT},
-  {52854u, property::type::LVT},
-  {52855u, property::type::LVT},
-  {52856u, property::type::LVT},
-  {52857u, property::type::LVT},
-  {52858u, property::type::LVT},
-  {52859u, property::type::LVT},
-  {52860u, property::type::LVT},
-  {52861u, property::type::LVT},
-  {52862u, property::type::LVT},
-  {52863u, property::type::LVT},
-  {52864u, property::type::LVT},
-  {52865u, property::type::LVT},
-  {52866u, property::type::LVT},
-  {52867u, property::type::LVT},
-  {52868u, property::type::LVT},
-  {52869u, property::type::LVT},
-  {52870u, property::type::LVT},
-  {52871u, property::type::LVT},
-  {52872u, property::type::LVT},
-  {52873u, property::type::LVT},
-  {52874u, property::type::LVT},
-  {52875u, property::type::LVT},
-  {52876u, property::type::LVT},
-  {52877u, property::type::LVT},
-  {52878u, property::type::LVT},
-  {52879u, property::type::LVT},
-  {52881u, property::type::LVT},
-  {52882u, property::type::LVT},
-  {52883u, property::type::LVT},
-  {52884u, property::type::LVT},
-  {52885u, property::type::LVT},
-  {52886u, property::type::LVT},
-  {52887u, property::type::LVT},
-  {52888u, property::type::LVT},
-  {52889u, property::type::LVT},
-  {52890u, property::type::LVT},
-  {52891u, property::type::LVT},
-  {52892u, property::type::LVT},
-  {52893u, property::type::LVT},
-  {52894u, property::type::LVT},
-  {52895u, property::type::LVT},
-  {52896u, property::type::LVT},
-  {52897u, property::type::LVT},
-  {52898u, property::type::LVT},
-  {52899u, property::type::LVT},
-  {52900u, property::type::LVT},
-  {52901u, property::type::LVT},
-  {52902u, property::type::LVT},
-  {52903u, property::type::LVT},
-  {52904u, property::type::LVT},
-  {52905u, property::type::LVT},
-  {52906u, property::type::LVT},
-  {52907u, property::type::LVT},
-  {52909u, property::type::LVT},
-  {52910u, property::type::LVT},
-  {52911u, property::type::LVT},
-  {52912u, property::type::LVT},
-  {52913u, property::type::LVT},
-  {52914u, property::type::LVT},
-  {52915u, property::type::LVT},
-  {52916u, property::type::LVT},
-  {52917u, property::type::LVT},
-  {52918u, property::type::LVT},
-  {52919u, property::type::LVT},
-  {52920u, property::type::LVT},
-  {52921u, property::type::LVT},
-  {52922u, property::type::LVT},
-  {52923u, property::type::LVT},
-  {52924u, property::type::LVT},
-  {52925u, property::type::LVT},
-  {52926u, property::type::LVT},
-  {52927u, property::type::LVT},
-  {52928u, property::type::LVT},
-  {52929u, property::type::LVT},
-  {52930u, property::type::LVT},
-  {52931u, property::type::LVT},
-  {52932u, property::type::LVT},
-  {52933u, property::type::LVT},
-  {52934u, property::type::LVT},
-  {52935u, property::type::LVT},
-  {52937u, property::type::LVT},
-  {52938u, property::type::LVT},
-  {52939u, property::type::LVT},
-  {52940u, property::type::LVT},
-  {52941u, property::type::LVT},
-  {52942u, property::type::LVT},
-  {52943u, property::type::LVT},
-  {52944u, property::type::LVT},
-  {52945u, property::type::LVT},
-  {52946u, property::type::LVT},
-  {52947u, property::type::LVT},
-  {52948u, property::type::LVT},
-  {52949u, property::type::LVT},
-  {52950u, property::type::LVT},
-  {52951u, property::type::LVT},
-  {52952u, property::type::LVT},
-  {52953u, property::type::LVT},
-  {52954u, property::type::LVT},
-  {52955u, property::type::LVT},
-  {52956u, property::type::LVT},
-  {52957u, property::type::LVT},
-  {52958u, property::type::LVT},
-  {52959u, property::type::LVT},
-  {52960u, property::type::LVT},
-  {52961u, property::type::LVT},
-  {52962u, property::type::LVT},
-  {52963u, property::type::LVT},
-  {52965u, property::type::LVT},
-  {52966u, property::type::LVT},
-  {52967u, property::type::LVT},
-  {52968u, property::type::LVT},
-  {52969u, property::type::LVT},
-  {52970u, property::type::LVT},
-  {52971u, property::type::LVT},
-  {52972u, property::type::LVT},
-  {52973u, property::type::LVT},
-  {52974u, property::type::LVT},
-  {52975u, property::type::LVT},
-  {52976u, property::type::LVT},
-  {52977u, property::type::LVT},
-  {52978u, property::type::LVT},
-  {52979u, property::type::LVT},
-  {52980u, property::type::LVT},
-  {52981u, property::type::LVT},
-  {52982u, property::type::LVT},
-  {52983u, property::type::LVT},
-  {52984u, property::type::LVT},
-  {52985u, property::type::LVT},
-  {52986u, property::type::LVT},
-  {52987u, property::type::LVT},
-  {52988u, property::type::LVT},
-  {52989u, property::type::LVT},
-  {52990u, property::type::LVT},
-  {52991u, property::type::LVT},
-  {52993u, property::type::LVT},
-  {52994u, property::type::LVT},
-  {52995u, property::type::LVT},
-  {52996u, property::type::LVT},
-  {52997u, property::type::LVT},
-  {52998u, property::type::LVT},
-  {52999u, property::type::LVT},
-  {53000u, property::type::LVT},
-  {53001u, property::type::LVT},
-  {53002u, property::type::LVT},
-  {53003u, property::type::LVT},
-  {53004u, property::type::LVT},
-  {53005u, property::type::LVT},
-  {53006u, property::type::LVT},
-  {53007u, property::type::LVT},
-  {53008u, property::type::LVT},
-  {53009u, property::type::LVT},
-  {53010u, property::type::LVT},
-  {53011u, property::type::LVT},
-  {53012u, property::type::LVT},
-  {53013u, property::type::LVT},
-  {53014u, property::type::LVT},
-  {53015u, property::type::LVT},
-  {53016u, property::type::LVT},
-  {53017u, property::type::LVT},
-  {53018u, property::type::LVT},
-  {53019u, property::type::LVT},
-  {53021u, property::type::LVT},
-  {53022u, property::type::LVT},
-  {53023u, property::type::LVT},
-  {53024u, property::type::LVT},
-  {53025u, property::type::LVT},
-  {53026u, property::type::LVT},
-  {53027u, property::type::LVT},
-  {53028u, property::type::LVT},
-  {53029u, property::type::LVT},
-  {53030u, property::type::LVT},
-  {53031u, property::type::LVT},
-  {53032u, property::type::LVT},
-  {53033u, property::type::LVT},
-  {53034u, property::type::LVT},
-  {53035u, property::type::LVT},
-  {53036u, property::type::LVT},
-  {53037u, property::type::LVT},
-  {53038u, property::type::LVT},
-  {53039u, property::type::LVT},
-  {53040u, property::type::LVT},
-  {53041u, property::type::LVT},
-  {53042u, property::type::LVT},
-  {53043u, property::type::LVT},
-  {53044u, property::type::LVT},
-  {53045u, property::type::LVT},
-  {53046u, property::type::LVT},
-  {53047u, property::type::LVT},
-  {53049u, property::type::LVT},
-  {53050u, property::type::LVT},
-  {53051u, property::type::LVT},
-  {53052u, property::type::LVT},
-  {53053u, property::type::LVT},
-  {53054u, property::type::LVT},
-  {53055u, property::type::LVT},
-  {53056u, property::type::LVT},
-  {53057u, property::type::LVT},
-  {53058u, property::type::LVT},
-  {53059u, property::type::LVT},
-  {53060u, property::type::LVT},
-  {53061u, property::type::LVT},
-  {53062u, property::type::LVT},
-  {53063u, property::type::LVT},
-  {53064u, property::type::LVT},
-  {53065u, property::type::LVT},
-  {53066u, property::type::LVT},
-  {53067u, property::type::LVT},
-  {53068u, property::type::LVT},
-  {53069u, property::type::LVT},
-  {53070u, property::type::LVT},
-  {53071u, property::type::LVT},
-  {53072u, property::type::LVT},
-  {53073u, property::type::LVT},
-  {53074u, property::type::LVT},
-  {53075u, property::type::LVT},
-  {53077u, property::type::LVT},
-  {53078u, property::type::LVT},
-  {53079u, property::type::LVT},
-  {53080u, property::type::LVT},
-  {53081u, property::type::LVT},
-  {53082u, property::type::LVT},
-  {53083u, property::type::LVT},
-  {53084u, property::type::LVT},
-  {53085u, property::type::LVT},
-  {53086u, property::type::LVT},
-  {53087u, property::type::LVT},
-  {53088u, property::type::LVT},
-  {53089u, property::type::LVT},
-  {53090u, property::type::LVT},
-  {53091u, property::type::LVT},
-  {53092u, property::type::LVT},
-  {53093u, property::type::LVT},
-  {53094u, property::type::LVT},
-  {53095u, property::type::LVT},
-  {53096u, property::type::LVT},
-  {53097u, property::type::LVT},
-  {53098u, property::type::LVT},
-  {53099u, property::type::LVT},
-  {53100u, property::type::LVT},
-  {53101u, property::type::LVT},
-  {53102u, property::type::LVT},
-  {53103u, property::type::LVT},
-  {53105u, property::type::LVT},
-  {53106u, property::type::LVT},
-  {53107u, property::type::LVT},
-  {53108u, property::type::LVT},
-  {53109u, property::type::LVT},
-  {53110u, property::type::LVT},
-  {53111u, property::type::LVT},
-  {53112u, property::type::LVT},
-  {53113u, property::type::LVT},
-  {53114u, property::type::LVT},
-  {53115u, property::type::LVT},
-  {53116u, property::type::LVT},
-  {53117u, property::type::LVT},
-  {53118u, property::type::LVT},
-  {53119u, property::type::LVT},
-  {53120u, property::type::LVT},
-  {53121u, property::type::LVT},
-  {53122u, property::type::LVT},
-  {53123u, property::type::LVT},
-  {53124u, property::type::LVT},
-  {53125u, property::type::LVT},
-  {53126u, property::type::LVT},
-  {53127u, property::type::LVT},
-  {53128u, property::type::LVT},
-  {53129u, property::type::LVT},
-  {53130u, property::type::LVT},
-  {53131u, property::type::LVT},
-  {53133u, property::type::LVT},
-  {53134u, property::type::LVT},
-  {53135u, property::type::LVT},
-  {53136u, property::type::LVT},
-  {53137u, property::type::LVT},
-  {53138u, property::type::LVT},
-  {53139u, property::type::LVT},
-  {53140u, property::type::LVT},
-  {53141u, property::type::LVT},
-  {53142u, property::type::LVT},
-  {53143u, property::type::LVT},
-  {53144u, property::type::LVT},
-  {53145u, property::type::LVT},
-  {53146u, property::type::LVT},
-  {53147u, property::type::LVT},
-  {53148u, property::type::LVT},
-  {53149u, property::type::LVT},
-  {53150u, property::type::LVT},
-  {53151u, property::type::LVT},
-  {53152u, property::type::LVT},
-  {53153u, property::type::LVT},
-  {53154u, property::type::LVT},
-  {53155u, property::type::LVT},
-  {53156u, property::type::LVT},
-  {53157u, property::type::LVT},
-  {53158u, property::type::LVT},
-  {53159u, property::type::LVT},
-  {53161u, property::type::LVT},
-  {53162u, property::type::LVT},
-  {53163u, property::type::LVT},
-  {53164u, property::type::LVT},
-  {53165u, property::type::LVT},
-  {53166u, property::type::LVT},
-  {53167u, property::type::LVT},
-  {53168u, property::type::LVT},
-  {53169u, property::type::LVT},
-  {53170u, property::type::LVT},
-  {53171u, property::type::LVT},
-  {53172u, property::type::LVT},
-  {53173u, property::type::LVT},
-  {53174u, property::type::LVT},
-  {53175u, property::type::LVT},
-  {53176u, property::type::LVT},
-  {53177u, property::type::LVT},
-  {53178u, property::type::LVT},
-  {53179u, property::type::LVT},
-  {53180u, property::type::LVT},
-  {53181u, property::type::LVT},
-  {53182u, property::type::LVT},
-  {53183u, property::type::LVT},
-  {53184u, property::type::LVT},
-  {53185u, property::type::LVT},
-  {53186u, property::type::LVT},
-  {53187u, property::type::LVT},
-  {53189u, property::type::LVT},
-  {53190u, property::type::LVT},
-  {53191u, property::type::LVT},
-  {53192u, property::type::LVT},
-  {53193u, property::type::LVT},
-  {53194u, property::type::LVT},
-  {53195u, property::type::LVT},
-  {53196u, property::type::LVT},
-  {53197u, property::type::LVT},
-  {53198u, property::type::LVT},
-  {53199u, property::type::LVT},
-  {53200u, property::type::LVT},
-  {53201u, property::type::LVT},
-  {53202u, property::type::LVT},
-  {53203u, property::type::LVT},
-  {53204u, property::type::LVT},
-  {53205u, property::type::LVT},
-  {53206u, property::type::LVT},
-  {53207u, property::type::LVT},
-  {53208u, property::type::LVT},
-  {53209u, property::type::LVT},
-  {53210u, property::type::LVT},
-  {53211u, property::type::LVT},
-  {53212u, property::type::LVT},
-  {53213u, property::type::LVT},
-  {53214u, property::type::LVT},
-  {53215u, property::type::LVT},
-  {53217u, property::type::LVT},
-  {53218u, property::type::LVT},
-  {53219u, property::type::LVT},
-  {53220u, property::type::LVT},
-  {53221u, property::type::LVT},
-  {53222u, property::type::LVT},
-  {53223u, property::type::LVT},
-  {53224u, property::type::LVT},
-  {53225u, property::type::LVT},
-  {53226u, property::type::LVT},
-  {53227u, property::type::LVT},
-  {53228u, property::type::LVT},
-  {53229u, property::type::LVT},
-  {53230u, property::type::LVT},
-  {53231u, property::type::LVT},
-  {53232u, property::type::LVT},
-  {53233u, property::type::LVT},
-  {53234u, property::type::LVT},
-  {53235u, property::type::LVT},
-  {53236u, property::type::LVT},
-  {53237u, property::type::LVT},
-  {53238u, property::type::LVT},
-  {53239u, property::type::LVT},
-  {53240u, property::type::LVT},
-  {53241u, property::type::LVT},
-  {53242u, property::type::LVT},
-  {53243u, property::type::LVT},
-  {53245u, property::type::LVT},
-  {53246u, property::type::LVT},
-  {53247u, property::type::LVT},
-  {53248u, property::type::LVT},
-  {53249u, property::type::LVT},
-  {53250u, property::type::LVT},
-  {53251u, property::type::LVT},
-  {53252u, property::type::LVT},
-  {53253u, property::type::LVT},
-  {53254u, property::type::LVT},
-  {53255u, property::type::LVT},
-  {53256u, property::type::LVT},
-  {53257u, property::type::LVT},
-  {53258u, property::type::LVT},
-  {53259u, property::type::LVT},
-  {53260u, property::type::LVT},
-  {53261u, property::type::LVT},
-  {53262u, property::type::LVT},
-  {53263u, property::type::LVT},
-  {53264u, property::type::LVT},
-  {53265u, property::type::LVT},
-  {53266u, property::type::LVT},
-  {53267u, property::type::LVT},
-  {53268u, property::type::LVT},
-  {53269u, property::type::LVT},
-  {53270u, property::type::LVT},
-  {53271u, property::type::LVT},
-  {53273u, property::type::LVT},
-  {53274u, property::type::LVT},
-  {53275u, property::type::LVT},
-  {53276u, property::type::LVT},
-  {53277u, property::type::LVT},
-  {53278u, property::type::LVT},
-  {53279u, property::type::LVT},
-  {53280u, property::type::LVT},
-  {53281u, property::type::LVT},
-  {53282u, property::type::LVT},
-  {53283u, property::type::LVT},
-  {53284u, property::type::LVT},
-  {53285u, property::type::LVT},
-  {53286u, property::type::LVT},
-  {53287u, property::type::LVT},
-  {53288u, property::type::LVT},
-  {53289u, property::type::LVT},
-  {53290u, property::type::LVT},
-  {53291u, property::type::LVT},
-  {53292u, property::type::LVT},
-  {53293u, property::type::LVT},
-  {53294u, property::type::LVT},
-  {53295u, property::type::LVT},
-  {53296u, property::type::LVT},
-  {53297u, property::type::LVT},
-  {53298u, property::type::LVT},
-  {53299u, property::type::LVT},
-  {53301u, property::type::LVT},
-  {53302u, property::type::LVT},
-  {53303u, property::type::LVT},
-  {53304u, property::type::LVT},
-  {53305u, property::type::LVT},
-  {53306u, property::type::LVT},
-  {53307u, property::type::LVT},
-  {53308u, property::type::LVT},
-  {53309u, property::type::LVT},
-  {53310u, property::type::LVT},
-  {53311u, property::type::LVT},
-  {53312u, property::type::LVT},
-  {53313u, property::type::LVT},
-  {53314u, property::type::LVT},
-  {53315u, property::type::LVT},
-  {53316u, property::type::LVT},
-  {53317u, property::type::LVT},
-  {53318u, property::type::LVT},
-  {53319u, property::type::LVT},
-  {53320u, property::type::LVT},
-  {53321u, property::type::LVT},
-  {53322u, property::type::LVT},
-  {53323u, property::type::LVT},
-  {53324u, property::type::LVT},
-  {53325u, property::type::LVT},
-  {53326u, property::type::LVT},
-  {53327u, property::type::LVT},
-  {53329u, property::type::LVT},
-  {53330u, property::type::LVT},
-  {53331u, property::type::LVT},
-  {53332u, property::type::LVT},
-  {53333u, property::type::LVT},
-  {53334u, property::type::LVT},
-  {53335u, property::type::LVT},
-  {53336u, property::type::LVT},
-  {53337u, property::type::LVT},
-  {53338u, property::type::LVT},
-  {53339u, property::type::LVT},
-  {53340u, property::type::LVT},
-  {53341u, property::type::LVT},
-  {53342u, property::type::LVT},
-  {53343u, property::type::LVT},
-  {53344u, property::type::LVT},
-  {53345u, property::type::LVT},
-  {53346u, property::type::LVT},
-  {53347u, property::type::LVT},
-  {53348u, property::type::LVT},
-  {53349u, property::type::LVT},
-  {53350u, property::type::LVT},
-  {53351u, property::type::LVT},
-  {53352u, property::type::LVT},
-  {53353u, property::type::LVT},
-  {53354u, property::type::LVT},
-  {53355u, property::type::LVT},
-  {53357u, property::type::LVT},
-  {53358u, property::type::LVT},
-  {53359u, property::type::LVT},
-  {53360u, property::type::LVT},
-  {53361u, property::type::LVT},
-  {53362u, property::type::LVT},
-  {53363u, property::type::LVT},
-  {53364u, property::type::LVT},
-  {53365u, property::type::LVT},
-  {53366u, property::type::LVT},
-  {53367u, property::type::LVT},
-  {53368u, property::type::LVT},
-  {53369u, property::type::LVT},
-  {53370u, property::type::LVT},
-  {53371u, property::type::LVT},
-  {53372u, property::type::LVT},
-  {53373u, property::type::LVT},
-  {53374u, property::type::LVT},
-  {53375u, property::type::LVT},
-  {53376u, property::type::LVT},
-  {53377u, property::type::LVT},
-  {53378u, property::type::LVT},
-  {53379u, property::type::LVT},
-  {53380u, property::type::LVT},
-  {53381u, property::type::LVT},
-  {53382u, property::type::LVT},
-  {53383u, property::type::LVT},
-  {53385u, property::type::LVT},
-  {53386u, property::type::LVT},
-  {53387u, property::type::LVT},
-  {53388u, property::type::LVT},
-  {53389u, property::type::LVT},
-  {53390u, property::type::LVT},
-  {53391u, property::type::LVT},
-  {53392u, property::type::LVT},
-  {53393u, property::type::LVT},
-  {53394u, property::type::LVT},
-  {53395u, property::type::LVT},
-  {53396u, property::type::LVT},
-  {53397u, property::type::LVT},
-  {53398u, property::type::LVT},
-  {53399u, property::type::LVT},
-  {53400u, property::type::LVT},
-  {53401u, property::type::LVT},
-  {53402u, property::type::LVT},
-  {53403u, property::type::LVT},
-  {53404u, property::type::LVT},
-  {53405u, property::type::LVT},
-  {53406u, property::type::LVT},
-  {53407u, property::type::LVT},
-  {53408u, property::type::LVT},
-  {53409u, property::type::LVT},
-  {53410u, property::type::LVT},
-  {53411u, property::type::LVT},
-  {53413u, property::type::LVT},
-  {53414u, property::type::LVT},
-  {53415u, property::type::LVT},
-  {53416u, property::type::LVT},
-  {53417u, property::type::LVT},
-  {53418u, property::type::LVT},
-  {53419u, property::type::LVT},
-  {53420u, property::type::LVT},
-  {53421u, property::type::LVT},
-  {53422u, property::type::LVT},
-  {53423u, property::type::LVT},
-  {53424u, property::type::LVT},
-  {53425u, property::type::LVT},
-  {53426u, property::type::LVT},
-  {53427u, property::type::LVT},
-  {53428u, property::type::LVT},
-  {53429u, property::type::LVT},
-  {53430u, property::type::LVT},
-  {53431u, property::type::LVT},
-  {53432u, property::type::LVT},
-  {53433u, property::type::LVT},
-  {53434u, property::type::LVT},
-  {53435u, property::type::LVT},
-  {53436u, property::type::LVT},
-  {53437u, property::type::LVT},
-  {53438u, property::type::LVT},
-  {53439u, property::type::LVT},
-  {53441u, property::type::LVT},
-  {53442u, property::type::LVT},
-  {53443u, property::type::LVT},
-  {53444u, property::type::LVT},
-  {53445u, property::type::LVT},
-  {53446u, property::type::LVT},
-  {53447u, property::type::LVT},
-  {53448u, property::type::LVT},
-  {53449u, property::type::LVT},
-  {53450u, property::type::LVT},
-  {53451u, property::type::LVT},
-  {53452u, property::type::LVT},
-  {53453u, property::type::LVT},
-  {53454u, property::type::LVT},
-  {53455u, property::type::LVT},
-  {53456u, property::type::LVT},
-  {53457u, property::type::LVT},
-  {53458u, property::type::LVT},
-  {53459u, property::type::LVT},
-  {53460u, property::type::LVT},
-  {53461u, property::type::LVT},
-  {53462u, property::type::LVT},
-  {53463u, property::type::LVT},
-  {53464u, property::type::LVT},
-  {53465u, property::type::LVT},
-  {53466u, property::type::LVT},
-  {53467u, property::type::LVT},
-  {53469u, property::type::LVT},
-  {53470u, property::type::LVT},
-  {53471u, property::type::LVT},
-  {53472u, property::type::LVT},
-  {53473u, property::type::LVT},
-  {53474u, property::type::LVT},
-  {53475u, property::type::LVT},
-  {53476u, property::type::LVT},
-  {53477u, property::type::LVT},
-  {53478u, property::type::LVT},
-  {53479u, property::type::LVT},
-  {53480u, property::type::LVT},
-  {53481u, property::type::LVT},
-  {53482u, property::type::LVT},
-  {53483u, property::type::LVT},
-  {53484u, property::type::LVT},
-  {53485u, property::type::LVT},
-  {53486u, property::type::LVT},
-  {53487u, property::type::LVT},
-  {53488u, property::type::LVT},
-  {53489u, property::type::LVT},
-  {53490u, property::type::LVT},
-  {53491u, property::type::LVT},
-  {53492u, property::type::LVT},
-  {53493u, property::type::LVT},
-  {53494u, property::type::LVT},
-  {53495u, property::type::LVT},
-  {53497u, property::type::LVT},
-  {53498u, property::type::LVT},
-  {53499u, property::type::LVT},
-  {53500u, property::type::LVT},
-  {53501u, property::type::LVT},
-  {53502u, property::type::LVT},
-  {53503u, property::type::LVT},
-  {53504u, property::type::LVT},
-  {53505u, property::type::LVT},
-  {53506u, property::type::LVT},
-  {53507u, property::type::LVT},
-  {53508u, property::type::LVT},
-  {53509u, property::type::LVT},
-  {53510u, property::type::LVT},
-  {53511u, property::type::LVT},
-  {53512u, property::type::LVT},
-  {53513u, property::type::LVT},
-  {53514u, property::type::LVT},
-  {53515u, property::type::LVT},
-  {53516u, property::type::LVT},
-  {53517u, property::type::LVT},
-  {53518u, property::type::LVT},
-  {53519u, property::type::LVT},
-  {53520u, property::type::LVT},
-  {53521u, property::type::LVT},
-  {53522u, property::type::LVT},
-  {53523u, property::type::LVT},
-  {53525u, property::type::LVT},
-  {53526u, property::type::LVT},
-  {53527u, property::type::LVT},
-  {53528u, property::type::LVT},
-  {53529u, property::type::LVT},
-  {53530u, property::type::LVT},
-  {53531u, property::type::LVT},
-  {53532u, property::type::LVT},
-  {53533u, property::type::LVT},
-  {53534u, property::type::LVT},
-  {53535u, property::type::LVT},
-  {53536u, property::type::LVT},
-  {53537u, property::type::LVT},
-  {53538u, property::type::LVT},
-  {53539u, property::type::LVT},
-  {53540u, property::type::LVT},
-  {53541u, property::type::LVT},
-  {53542u, property::type::LVT},
-  {53543u, property::type::LVT},
-  {53544u, property::type::LVT},
-  {53545u, property::type::LVT},
-  {53546u, property::type::LVT},
-  {53547u, property::type::LVT},
-  {53548u, property::type::LVT},
-  {53549u, property::type::LVT},
-  {53550u, property::type::LVT},
-  {53551u, property::type::LVT},
-  {53553u, property::type::LVT},
-  {53554u, property::type::LVT},
-  {53555u, property::type::LVT},
-  {53556u, property::type::LVT},
-  {53557u, property::type::LVT},
-  {53558u, property::type::LVT},
-  {53559u, property::type::LVT},
-  {53560u, property::type::LVT},
-  {53561u, property::type::LVT},
-  {53562u, property::type::LVT},
-  {53563u, property::type::LVT},
-  {53564u, property::type::LVT},
-  {53565u, property::type::LVT},
-  {53566u, property::type::LVT},
-  {53567u, property::type::LVT},
-  {53568u, property::type::LVT},
-  {53569u, property::type::LVT},
-  {53570u, property::type::LVT},
-  {53571u, property::type::LVT},
-  {53572u, property::type::LVT},
-  {53573u, property::type::LVT},
-  {53574u, property::type::LVT},
-  {53575u, property::type::LVT},
-  {53576u, property::type::LVT},
-  {53577u, property::type::LVT},
-  {53578u, property::type::LVT},
-  {53579u, property::type::LVT},
-  {53581u, property::type::LVT},
-  {53582u, property::type::LVT},
-  {53583u, property::type::LVT},
-  {53584u, property::type::LVT},
-  {53585u, property::type::LVT},
-  {53586u, property::type::LVT},
-  {53587u, property::type::LVT},
-  {53588u, property::type::LVT},
-  {53589u, property::type::LVT},
-  {53590u, property::type::LVT},
-  {53591u, property::type::LVT},
-  {53592u, property::type::LVT},
-  {53593u, property::type::LVT},
-  {53594u, property::type::LVT},
-  {53595u, property::type::LVT},
-  {53596u, property::type::LVT},
-  {53597u, property::type::LVT},
-  {53598u, property::type::LVT},
-  {53599u, property::type::LVT},
-  {53600u, property::type::LVT},
-  {53601u, property::type::LVT},
-  {53602u, property::type::LVT},
-  {53603u, property::type::LVT},
-  {53604u, property::type::LVT},
-  {53605u, property::type::LVT},
-  {53606u, property::type::LVT},
-  {53607u, property::type::LVT},
-  {53609u, property::type::LVT},
-  {53610u, property::type::LVT},
-  {53611u, property::type::LVT},
-  {53612u, property::type::LVT},
-  {53613u, property::type::LVT},
-  {53614u, property::type::LVT},
-  {53615u, property::type::LVT},
-  {53616u, property::type::LVT},
-  {53617u, property::type::LVT},
-  {53618u, property::type::LVT},
-  {53619u, property::type::LVT},
-  {53620u, property::type::LVT},
-  {53621u, property::type::LVT},
-  {53622u, property::type::LVT},
-  {53623u, property::type::LVT},
-  {53624u, property::type::LVT},
-  {53625u, property::type::LVT},
-  {53626u, property::type::LVT},
-  {53627u, property::type::LVT},
-  {53628u, property::type::LVT},
-  {53629u, property::type::LVT},
-  {53630u, property::type::LVT},
-  {53631u, property::type::LVT},
-  {53632u, property::type::LVT},
-  {53633u, property::type::LVT},
-  {53634u, property::type::LVT},
-  {53635u, property::type::LVT},
-  {53637u, property::type::LVT},
-  {53638u, property::type::LVT},
-  {53639u, property::type::LVT},
-  {53640u, property::type::LVT},
-  {53641u, property::type::LVT},
-  {53642u, property::type::LVT},
-  {53643u, property::type::LVT},
-  {53644u, property::type::LVT},
-  {53645u, property::type::LVT},
-  {53646u, property::type::LVT},
-  {53647u, property::type::LVT},
-  {53648u, property::type::LVT},
-  {53649u, property::type::LVT},
-  {53650u, property::type::LVT},
-  {53651u, property::type::LVT},
-  {53652u, property::type::LVT},
-  {53653u, property::type::LVT},
-  {53654u, property::type::LVT},
-  {53655u, property::type::LVT},
-  {53656u, property::type::LVT},
-  {53657u, property::type::LVT},
-  {53658u, property::type::LVT},
-  {53659u, property::type::LVT},
-  {53660u, property::type::LVT},
-  {53661u, property::type::LVT},
-  {53662u, property::type::LVT},
-  {53663u, property::type::LVT},
-  {53665u, property::type::LVT},
-  {53666u, property::type::LVT},
-  {53667u, property::type::LVT},
-  {53668u, property::type::LVT},
-  {53669u, property::type::LVT},
-  {53670u, property::type::LVT},
-  {53671u, property::type::LVT},
-  {53672u, property::type::LVT},
-  {53673u, property::type::LVT},
-  {53674u, property::type::LVT},
-  {53675u, property::type::LVT},
-  {53676u, property::type::LVT},
-  {53677u, property::type::LVT},
-  {53678u, property::type::LVT},
-  {53679u, property::type::LVT},
-  {53680u, property::type::LVT},
-  {53681u, property::type::LVT},
-  {53682u, property::type::LVT},
-  {53683u, property::type::LVT},
-  {53684u, property::type::LVT},
-  {53685u, property::type::LVT},
-  {53686u, property::type::LVT},
-  {53687u, property::type::LVT},
-  {53688u, property::type::LVT},
-  {53689u, property::type::LVT},
-  {53690u, property::type::LVT},
-  {53691u, property::type::LVT},
-  {53693u, property::type::LVT},
-  {53694u, property::type::LVT},
-  {53695u, property::type::LVT},
-  {53696u, property::type::LVT},
-  {53697u, property::type::LVT},
-  {53698u, property::type::LVT},
-  {53699u, property::type::LVT},
-  {53700u, property::type::LVT},
-  {53701u, property::type::LVT},
-  {53702u, property::type::LVT},
-  {53703u, property::type::LVT},
-  {53704u, property::type::LVT},
-  {53705u, property::type::LVT},
-  {53706u, property::type::LVT},
-  {53707u, property::type::LVT},
-  {53708u, property::type::LVT},
-  {53709u, property::type::LVT},
-  {53710u, property::type::LVT},
-  {53711u, property::type::LVT},
-  {53712u, property::type::LVT},
-  {53713u, property::type::LVT},
-  {53714u, property::type::LVT},
-  {53715u, property::type::LVT},
-  {53716u, property::type::LVT},
-  {53717u, property::type::LVT},
-  {53718u, property::type::LVT},
-  {53719u, property::type::LVT},
-  {53721u, property::type::LVT},
-  {53722u, property::type::LVT},
-  {53723u, property::type::LVT},
-  {53724u, property::type::LVT},
-  {53725u, property::type::LVT},
-  {53726u, property::type::LVT},
-  {53727u, property::type::LVT},
-  {53728u, property::type::LVT},
-  {53729u, property::type::LVT},
-  {53730u, property::type::LVT},
-  {53731u, property::type::LVT},
-  {53732u, property::type::LVT},
-  {53733u, property::type::LVT},
-  {53734u, property::type::LVT},
-  {53735u, property::type::LVT},
-  {53736u, property::type::LVT},
-  {53737u, property::type::LVT},
-  {53738u, property::type::LVT},
-  {53739u, property::type::LVT},
-  {53740u, property::type::LVT},
-  {53741u, property::type::LVT},
-  {53742u, property::type::LVT},
-  {53743u, property::type::LVT},
-  {53744u, property::type::LVT},
-  {53745u, property::type::LVT},
-  {53746u, property::type::LVT},
-  {53747u, property::type::LVT},
-  {53749u, property::type::LVT},
-  {53750u, property::type::LVT},
-  {53751u, property::type::LVT},
-  {53752u, property::type::LVT},
-  {53753u, property::type::LVT},
-  {53754u, property::type::LVT},
-  {53755u, property::type::LVT},
-  {53756u, property::type::LVT},
-  {53757u, property::type::LVT},
-  {53758u, property::type::LVT},
-  {53759u, property::type::LVT},
-  {53760u, property::type::LVT},
-  {53761u, property::type::LVT},
-  {53762u, property::type::LVT},
-  {53763u, property::type::LVT},
-  {53764u, property::type::LVT},
-  {53765u, property::type::LVT},
-  {53766u, property::type::LVT},
-  {53767u, property::type::LVT},
-  {53768u, property::type::LVT},
-  {53769u, property::type::LVT},
-  {53770u, property::type::LVT},
-  {53771u, property::type::LVT},
-  {53772u, property::type::LVT},
-  {53773u, property::type::LVT},
-  {53774u, property::type::LVT},
-  {53775u, property::type::LVT},
-  {53777u, property::type::LVT},
-  {53778u, property::type::LVT},
-  {53779u, property::type::LVT},
-  {53780u, property::type::LVT},
-  {53781u, property::type::LVT},
-  {53782u, property::type::LVT},
-  {53783u, property::type::LVT},
-  {53784u, property::type::LVT},
-  {53785u, property::type::LVT},
-  {53786u, property::type::LVT},
-  {53787u, property::type::LVT},
-  {53788u, property::type::LVT},
-  {53789u, property::type::LVT},
-  {53790u, property::type::LVT},
-  {53791u, property::type::LVT},
-  {53792u, property::type::LVT},
-  {53793u, property::type::LVT},
-  {53794u, property::type::LVT},
-  {53795u, property::type::LVT},
-  {53796u, property::type::LVT},
-  {53797u, property::type::LVT},
-  {53798u, property::type::LVT},
-  {53799u, property::type::LVT},
-  {53800u, property::type::LVT},
-  {53801u, property::type::LVT},
-  {53802u, property::type::LVT},
-  {53803u, property::type::LVT},
-  {53805u, property::type::LVT},
-  {53806u, property::type::LVT},
-  {53807u, property::type::LVT},
-  {53808u, property::type::LVT},
-  {53809u, property::type::LVT},
-  {53810u, property::type::LVT},
-  {53811u, property::type::LVT},
-  {53812u, property::type::LVT},
-  {53813u, property::type::LVT},
-  {53814u, property::type::LVT},
-  {53815u, property::type::LVT},
-  {53816u, property::type::LVT},
-  {53817u, property::type::LVT},
-  {53818u, property::type::LVT},
-  {53819u, property::type::LVT},
-  {53820u, property::type::LVT},
-  {53821u, property::type::LVT},
-  {53822u, property::type::LVT},
-  {53823u, property::type::LVT},
-  {53824u, property::type::LVT},
-  {53825u, property::type::LVT},
-  {53826u, property::type::LVT},
-  {53827u, property::type::LVT},
-  {53828u, property::type::LVT},
-  {53829u, property::type::LVT},
-  {53830u, property::type::LVT},
-  {53831u, property::type::LVT},
-  {53833u, property::type::LVT},
-  {53834u, property::type::LVT},
-  {53835u, property::type::LVT},
-  {53836u, property::type::LVT},
-  {53837u, property::type::LVT},
-  {53838u, property::type::LVT},
-  {53839u, property::type::LVT},
-  {53840u, property::type::LVT},
-  {53841u, property::type::LVT},
-  {53842u, property::type::LVT},
-  {53843u, property::type::LVT},
-  {53844u, property::type::LVT},
-  {53845u, property::type::LVT},
-  {53846u, property::type::LVT},
-  {53847u, property::type::LVT},
-  {53848u, property::type::LVT},
-  {53849u, property::type::LVT},
-  {53850u, property::type::LVT},
-  {53851u, property::type::LVT},
-  {53852u, property::type::LVT},
-  {53853u, property::type::LVT},
-  {53854u, property::type::LVT},
-  {53855u, property::type::LVT},
-  {53856u, property::type::LVT},
-  {53857u, property::type::LVT},
-  {53858u, property::type::LVT},
-  {53859u, property::type::LVT},
-  {53861u, property::type::LVT},
-  {53862u, property::type::LVT},
-  {53863u, property::type::LVT},
-  {53864u, property::type::LVT},
-  {53865u, property::type::LVT},
-  {53866u, property::type::LVT},
-  {53867u, property::type::LVT},
-  {53868u, property::type::LVT},
-  {53869u, property::type::LVT},
-  {53870u, property::type::LVT},
-  {53871u, property::type::LVT},
-  {53872u, property::type::LVT},
-  {53873u, property::type::LVT},
-  {53874u, property::type::LVT},
-  {53875u, property::type::LVT},
-  {53876u, property::type::LVT},
-  {53877u, property::type::LVT},
-  {53878u, property::type::LVT},
-  {53879u, property::type::LVT},
-  {53880u, property::type::LVT},
-  {53881u, property::type::LVT},
-  {53882u, property::type::LVT},
-  {53883u, property::type::LVT},
-  {53884u, property::type::LVT},
-  {53885u, property::type::LVT},
-  {53886u, property::type::LVT},
-  {53887u, property::type::LVT},
-  {53889u, property::type::LVT},
-  {53890u, property::type::LVT},
-  {53891u, property::type::LVT},
-  {53892u, property::type::LVT},
-  {53893u, property::type::LVT},
-  {53894u, property::type::LVT},
-  {53895u, property::type::LVT},
-  {53896u, property::type::LVT},
-  {53897u, property::type::LVT},
-  {53898u, property::type::LVT},
-  {53899u, property::type::LVT},
-  {53900u, property::type::LVT},
-  {53901u, property::type::LVT},
-  {53902u, property::type::LVT},
-  {53903u, property::type::LVT},
-  {53904u, property::type::LVT},
-  {53905u, property::type::LVT},
-  {53906u, property::type::LVT},
-  {53907u, property::type::LVT},
-  {53908u, property::type::LVT},
-  {53909u, property::type::LVT},
-  {53910u, property::type::LVT},
-  {53911u, property::type::LVT},
-  {53912u, property::type::LVT},
-  {53913u, property::type::LVT},
-  {53914u, property::type::LVT},
-  {53915u, property::type::LVT},
-  {53917u, property::type::LVT},
-  {53918u, property::type::LVT},
-  {53919u, property::type::LVT},
-  {53920u, property::type::LVT},
-  {53921u, property::type::LVT},
-  {53922u, property::type::LVT},
-  {53923u, property::type::LVT},
-  {53924u, property::type::LVT},
-  {53925u, property::type::LVT},
-  {53926u, property::type::LVT},
-  {53927u, property::type::LVT},
-  {53928u, property::type::LVT},
-  {53929u, property::type::LVT},
-  {53930u, property::type::LVT},
-  {53931u, property::type::LVT},
-  {53932u, property::type::LVT},
-  {53933u, property::type::LVT},
-  {53934u, property::type::LVT},
-  {53935u, property::type::LVT},
-  {53936u, property::type::LVT},
-  {53937u, property::type::LVT},
-  {53938u, property::type::LVT},
-  {53939u, property::type::LVT},
-  {53940u, property::type::LVT},
-  {53941u, property::type::LVT},
-  {53942u, property::type::LVT},
-  {53943u, property::type::LVT},
-  {53945u, property::type::LVT},
-  {53946u, property::type::LVT},
-  {53947u, property::type::LVT},
-  {53948u, property::type::LVT},
-  {53949u, property::type::LVT},
-  {53950u, property::type::LVT},
-  {53951u, property::type::LVT},
-  {53952u, property::type::LVT},
-  {53953u, property::type::LVT},
-  {53954u, property::type::LVT},
-  {53955u, property::type::LVT},
-  {53956u, property::type::LVT},
-  {53957u, property::type::LVT},
-  {53958u, property::type::LVT},
-  {53959u, property::type::LVT},
-  {53960u, property::type::LVT},
-  {53961u, property::type::LVT},
-  {53962u, property::type::LVT},
-  {53963u, property::type::LVT},
-  {53964u, property::type::LVT},
-  {53965u, property::type::LVT},
-  {53966u, property::type::LVT},
-  {53967u, property::type::LVT},
-  {53968u, property::type::LVT},
-  {53969u, property::type::LVT},
-  {53970u, property::type::LVT},
-  {53971u, property::type::LVT},
-  {53973u, property::type::LVT},
-  {53974u, property::type::LVT},
-  {53975u, property::type::LVT},
-  {53976u, property::type::LVT},
-  {53977u, property::type::LVT},
-  {53978u, property::type::LVT},
-  {53979u, property::type::LVT},
-  {53980u, property::type::LVT},
-  {53981u, property::type::LVT},
-  {53982u, property::type::LVT},
-  {53983u, property::type::LVT},
-  {53984u, property::type::LVT},
-  {53985u, property::type::LVT},
-  {53986u, property::type::LVT},
-  {53987u, property::type::LVT},
-  {53988u, property::type::LVT},
-  {53989u, property::type::LVT},
-  {53990u, property::type::LVT},
-  {53991u, property::type::LVT},
-  {53992u, property::type::LVT},
-  {53993u, property::type::LVT},
-  {53994u, property::type::LVT},
-  {53995u, property::type::LVT},
-  {53996u, property::type::LVT},
-  {53997u, property::type::LVT},
-  {53998u, property::type::LVT},
-  {53999u, property::type::LVT},
-  {54001u, property::type::LVT},
-  {54002u, property::type::LVT},
-  {54003u, property::type::LVT},
-  {54004u, property::type::LVT},
-  {54005u, property::type::LVT},
-  {54006u, property::type::LVT},
-  {54007u, property::type::LVT},
-  {54008u, property::type::LVT},
-  {54009u, property::type::LVT},
-  {54010u, property::type::LVT},
-  {54011u, property::type::LVT},
-  {54012u, property::type::LVT},
-  {54013u, property::type::LVT},
-  {54014u, property::type::LVT},
-  {54015u, property::type::LVT},
-  {54016u, property::type::LVT},
-  {54017u, property::type::LVT},
-  {54018u, property::type::LVT},
-  {54019u, property::type::LVT},
-  {54020u, property::type::LVT},
-  {54021u, property::type::LVT},
-  {54022u, property::type::LVT},
-  {54023u, property::type::LVT},
-  {54024u, property::type::LVT},
-  {54025u, property::type::LVT},
-  {54026u, property::type::LVT},
-  {54027u, property::type::LVT},
-  {54029u, property::type::LVT},
-  {54030u, property::type::LVT},
-  {54031u, property::type::LVT},
-  {54032u, property::type::LVT},
-  {54033u, property::type::LVT},
-  {54034u, property::type::LVT},
-  {54035u, property::type::LVT},
-  {54036u, property::type::LVT},
-  {54037u, property::type::LVT},
-  {54038u, property::type::LVT},
-  {54039u, property::type::LVT},
-  {54040u, property::type::LVT},
-  {54041u, property::type::LVT},
-  {54042u, property::type::LVT},
-  {54043u, property::type::LVT},
-  {54044u, property::type::LVT},
-  {54045u, property::type::LVT},
-  {54046u, property::type::LVT},
-  {54047u, property::type::LVT},
-  {54048u, property::type::LVT},
-  {54049u, property::type::LVT},
-  {54050u, property::type::LVT},
-  {54051u, property::type::LVT},
-  {54052u, property::type::LVT},
-  {54053u, property::type::LVT},
-  {54054u, property::type::LVT},
-  {54055u, property::type::LVT},
-  {54057u, property::type::LVT},
-  {54058u, property::type::LVT},
-  {54059u, property::type::LVT},
-  {54060u, property::type::LVT},
-  {54061u, property::type::LVT},
-  {54062u, property::type::LVT},
-  {54063u, property::type::LVT},
-  {54064u, property::type::LVT},
-  {54065u, property::type::LVT},
-  {54066u, property::type::LVT},
-  {54067u, property::type::LVT},
-  {54068u, property::type::LVT},
-  {54069u, property::type::LVT},
-  {54070u, property::type::LVT},
-  {54071u, property::type::LVT},
-  {54072u, property::type::LVT},
-  {54073u, property::type::LVT},
-  {54074u, property::type::LVT},
-  {54075u, property::type::LVT},
-  {54076u, property::type::LVT},
-  {54077u, property::type::LVT},
-  {54078u, property::type::LVT},
-  {54079u, property::type::LVT},
-  {54080u, property::type::LVT},
-  {54081u, property::type::LVT},
-  {54082u, property::type::LVT},
-  {54083u, property::type::LVT},
-  {54085u, property::type::LVT},
-  {54086u, property::type::LVT},
-  {54087u, property::type::LVT},
-  {54088u, property::type::LVT},
-  {54089u, property::type::LVT},
-  {54090u, property::type::LVT},
-  {54091u, property::type::LVT},
-  {54092u, property::type::LVT},
-  {54093u, property::type::LVT},
-  {54094u, property::type::LVT},
-  {54095u, property::type::LVT},
-  {54096u, property::type::LVT},
-  {54097u, property::type::LVT},
-  {54098u, property::type::LVT},
-  {54099u, property::type::LVT},
-  {54100u, property::type::LVT},
-  {54101u, property::type::LVT},
-  {54102u, property::type::LVT},
-  {54103u, property::type::LVT},
-  {54104u, property::type::LVT},
-  {54105u, property::type::LVT},
-  {54106u, property::type::LVT},
-  {54107u, property::type::LVT},
-  {54108u, property::type::LVT},
-  {54109u, property::type::LVT},
-  {54110u, property::type::LVT},
-  {54111u, property::type::LVT},
-  {54113u, property::type::LVT},
-  {54114u, property::type::LVT},
-  {54115u, property::type::LVT},
-  {54116u, property::type::LVT},
-  {54117u, property::type::LVT},
-  {54118u, property::type::LVT},
-  {54119u, property::type::LVT},
-  {54120u, property::type::LVT},
-  {54121u, property::type::LVT},
-  {54122u, property::type::LVT},
-  {54123u, property::type::LVT},
-  {54124u, property::type::LVT},
-  {54125u, property::type::LVT},
-  {54126u, property::type::LVT},
-  {54127u, property::type::LVT},
-  {54128u, property::type::LVT},
-  {54129u, property::type::LVT},
-  {54130u, property::type::LVT},
-  {54131u, property::type::LVT},
-  {54132u, property::type::LVT},
-  {54133u, property::type::LVT},
-  {54134u, property::type::LVT},
-  {54135u, property::type::LVT},
-  {54136u, property::type::LVT},
-  {54137u, property::type::LVT},
-  {54138u, property::type::LVT},
-  {54139u, property::type::LVT},
-  {54141u, property::type::LVT},
-  {54142u, property::type::LVT},
-  {54143u, property::type::LVT},
-  {54144u, property::type::LVT},
-  {54145u, property::type::LVT},
-  {54146u, property::type::LVT},
-  {54147u, property::type::LVT},
-  {54148u, property::type::LVT},
-  {54149u, property::type::LVT},
-  {54150u, property::type::LVT},
-  {54151u, property::type::LVT},
-  {54152u, property::type::LVT},
-  {54153u, property::type::LVT},
-  {54154u, property::type::LVT},
-  {54155u, property::type::LVT},
-  {54156u, property::type::LVT},
-  {54157u, property::type::LVT},
-  {54158u, property::type::LVT},
-  {54159u, property::type::LVT},
-  {54160u, property::type::LVT},
-  {54161u, property::type::LVT},
-  {54162u, property::type::LVT},
-  {54163u, property::type::LVT},
-  {54164u, property::type::LVT},
-  {54165u, property::type::LVT},
-  {54166u, property::type::LVT},
-  {54167u, property::type::LVT},
-  {54169u, property::type::LVT},
-  {54170u, property::type::LVT},
-  {54171u, property::type::LVT},
-  {54172u, property::type::LVT},
-  {54173u, property::type::LVT},
-  {54174u, property::type::LVT},
-  {54175u, property::type::LVT},
-  {54176u, property::type::LVT},
-  {54177u, property::type::LVT},
-  {54178u, property::type::LVT},
-  {54179u, property::type::LVT},
-  {54180u, property::type::LVT},
-  {54181u, property::type::LVT},
-  {54182u, property::type::LVT},
-  {54183u, property::type::LVT},
-  {54184u, property::type::LVT},
-  {54185u, property::type::LVT},
-  {54186u, property::type::LVT},
-  {54187u, property::type::LVT},
-  {54188u, property::type::LVT},
-  {54189u, property::type::LVT},
-  {54190u, property::type::LVT},
-  {54191u, property::type::LVT},
-  {54192u, property::type::LVT},
-  {54193u, property::type::LVT},
-  {54194u, property::type::LVT},
-  {54195u, property::type::LVT},
-  {54197u, property::type::LVT},
-  {54198u, property::type::LVT},
-  {54199u, property::type::LVT},
-  {54200u, property::type::LVT},
-  {54201u, property::type::LVT},
-  {54202u, property::type::LVT},
-  {54203u, property::type::LVT},
-  {54204u, property::type::LVT},
-  {54205u, property::type::LVT},
-  {54206u, property::type::LVT},
-  {54207u, property::type::LVT},
-  {54208u, property::type::LVT},
-  {54209u, property::type::LVT},
-  {54210u, property::type::LVT},
-  {54211u, property::type::LVT},
-  {54212u, property::type::LVT},
-  {54213u, property::type::LVT},
-  {54214u, property::type::LVT},
-  {54215u, property::type::LVT},
-  {54216u, property::type::LVT},
-  {54217u, property::type::LVT},
-  {54218u, property::type::LVT},
-  {54219u, property::type::LVT},
-  {54220u, property::type::LVT},
-  {54221u, property::type::LVT},
-  {54222u, property::type::LVT},
-  {54223u, property::type::LVT},
-  {54225u, property::type::LVT},
-  {54226u, property::type::LVT},
-  {54227u, property::type::LVT},
-  {54228u, property::type::LVT},
-  {54229u, property::type::LVT},
-  {54230u, property::type::LVT},
-  {54231u, property::type::LVT},
-  {54232u, property::type::LVT},
-  {54233u, property::type::LVT},
-  {54234u, property::type::LVT},
-  {54235u, property::type::LVT},
-  {54236u, property::type::LVT},
-  {54237u, property::type::LVT},
-  {54238u, property::type::LVT},
-  {54239u, property::type::LVT},
-  {54240u, property::type::LVT},
-  {54241u, property::type::LVT},
-  {54242u, property::type::LVT},
-  {54243u, property::type::LVT},
-  {54244u, property::type::LVT},
-  {54245u, property::type::LVT},
-  {54246u, property::type::LVT},
-  {54247u, property::type::LVT},
-  {54248u, property::type::LVT},
-  {54249u, property::type::LVT},
-  {54250u, property::type::LVT},
-  {54251u, property::type::LVT},
-  {54253u, property::type::LVT},
-  {54254u, property::type::LVT},
-  {54255u, property::type::LVT},
-  {54256u, property::type::LVT},
-  {54257u, property::type::LVT},
-  {54258u, property::type::LVT},
-  {54259u, property::type::LVT},
-  {54260u, property::type::LVT},
-  {54261u, property::type::LVT},
-  {54262u, property::type::LVT},
-  {54263u, property::type::LVT},
-  {54264u, property::type::LVT},
-  {54265u, property::type::LVT},
-  {54266u, property::type::LVT},
-  {54267u, property::type::LVT},
-  {54268u, property::type::LVT},
-  {54269u, property::type::LVT},
-  {54270u, property::type::LVT},
-  {54271u, property::type::LVT},
-  {54272u, property::type::LVT},
-  {54273u, property::type::LVT},
-  {54274u, property::type::LVT},
-  {54275u, property::type::LVT},
-  {54276u, property::type::LVT},
-  {54277u, property::type::LVT},
-  {54278u, property::type::LVT},
-  {54279u, property::type::LVT},
-  {54281u, property::type::LVT},
-  {54282u, property::type::LVT},
-  {54283u, property::type::LVT},
-  {54284u, property::type::LVT},
-  {54285u, property::type::LVT},
-  {54286u, property::type::LVT},
-  {54287u, property::type::LVT},
-  {54288u, property::type::LVT},
-  {54289u, property::type::LVT},
-  {54290u, property::type::LVT},
-  {54291u, property::type::LVT},
-  {54292u, property::type::LVT},
-  {54293u, property::type::LVT},
-  {54294u, property::type::LVT},
-  {54295u, property::type::LVT},
-  {54296u, property::type::LVT},
-  {54297u, property::type::LVT},
-  {54298u, property::type::LVT},
-  {54299u, property::type::LVT},
-  {54300u, property::type::LVT},
-  {54301u, property::type::LVT},
-  {54302u, property::type::LVT},
-  {54303u, property::type::LVT},
-  {54304u, property::type::LVT},
-  {54305u, property::type::LVT},
-  {54306u, property::type::LVT},
-  {54307u, property::type::LVT},
-  {54309u, property::type::LVT},
-  {54310u, property::type::LVT},
-  {54311u, property::type::LVT},
-  {54312u, property::type::LVT},
-  {54313u, property::type::LVT},
-  {54314u, property::type::LVT},
-  {54315u, property::type::LVT},
-  {54316u, property::type::LVT},
-  {54317u, property::type::LVT},
-  {54318u, property::type::LVT},
-  {54319u, property::type::LVT},
-  {54320u, property::type::LVT},
-  {54321u, property::type::LVT},
-  {54322u, property::type::LVT},
-  {54323u, property::type::LVT},
-  {54324u, property::type::LVT},
-  {54325u, property::type::LVT},
-  {54326u, property::type::LVT},
-  {54327u, property::type::LVT},
-  {54328u, property::type::LVT},
-  {54329u, property::type::LVT},
-  {54330u, property::type::LVT},
-  {54331u, property::type::LVT},
-  {54332u, property::type::LVT},
-  {54333u, property::type::LVT},
-  {54334u, property::type::LVT},
-  {54335u, property::type::LVT},
-  {54337u, property::type::LVT},
-  {54338u, property::type::LVT},
-  {54339u, property::type::LVT},
-  {54340u, property::type::LVT},
-  {54341u, property::type::LVT},
-  {54342u, property::type::LVT},
-  {54343u, property::type::LVT},
-  {54344u, property::type::LVT},
-  {54345u, property::type::LVT},
-  {54346u, property::type::LVT},
-  {54347u, property::type::LVT},
-  {54348u, property::type::LVT},
-  {54349u, property::type::LVT},
-  {54350u, property::type::LVT},
-  {54351u, property::type::LVT},
-  {54352u, property::type::LVT},
-  {54353u, property::type::LVT},
-  {54354u, property::type::LVT},
-  {54355u, property::type::LVT},
-  {54356u, property::type::LVT},
-  {54357u, property::type::LVT},
-  {54358u, property::type::LVT},
-  {54359u, property::type::LVT},
-  {54360u, property::type::LVT},
-  {54361u, property::type::LVT},
-  {54362u, property::type::LVT},
-  {54363u, property::type::LVT},
-  {54365u, property::type::LVT},
-  {54366u, property::type::LVT},
-  {54367u, property::type::LVT},
-  {54368u, property::type::LVT},
-  {54369u, property::type::LVT},
-  {54370u, property::type::LVT},
-  {54371u, property::type::LVT},
-  {54372u, property::type::LVT},
-  {54373u, property::type::LVT},
-  {54374u, property::type::LVT},
-  {54375u, property::type::LVT},
-  {54376u, property::type::LVT},
-  {54377u, property::type::LVT},
-  {54378u, property::type::LVT},
-  {54379u, property::type::LVT},
-  {54380u, property::type::LVT},
-  {54381u, property::type::LVT},
-  {54382u, property::type::LVT},
-  {54383u, property::type::LVT},
-  {54384u, property::type::LVT},
-  {54385u, property::type::LVT},
-  {54386u, property::type::LVT},
-  {54387u, property::type::LVT},
-  {54388u, property::type::LVT},
-  {54389u, property::type::LVT},
-  {54390u, property::type::LVT},
-  {54391u, property::type::LVT},
-  {54393u, property::type::LVT},
-  {54394u, property::type::LVT},
-  {54395u, property::type::LVT},
-  {54396u, property::type::LVT},
-  {54397u, property::type::LVT},
-  {54398u, property::type::LVT},
-  {54399u, property::type::LVT},
-  {54400u, property::type::LVT},
-  {54401u, property::type::LVT},
-  {54402u, property::type::LVT},
-  {54403u, property::type::LVT},
-  {54404u, property::type::LVT},
-  {54405u, property::type::LVT},
-  {54406u, property::type::LVT},
-  {54407u, property::type::LVT},
-  {54408u, property::type::LVT},
-  {54409u, property::type::LVT},
-  {54410u, property::type::LVT},
-  {54411u, property::type::LVT},
-  {54412u, property::type::LVT},
-  {54413u, property::type::LVT},
-  {54414u, property::type::LVT},
-  {54415u, property::type::LVT},
-  {54416u, property::type::LVT},
-  {54417u, property::type::LVT},
-  {54418u, property::type::LVT},
-  {54419u, property::type::LVT},
-  {54421u, property::type::LVT},
-  {54422u, property::type::LVT},
-  {54423u, property::type::LVT},
-  {54424u, property::type::LVT},
-  {54425u, property::type::LVT},
-  {54426u, property::type::LVT},
-  {54427u, property::type::LVT},
-  {54428u, property::type::LVT},
-  {54429u, property::type::LVT},
-  {54430u, property::type::LVT},
-  {54431u, property::type::LVT},
-  {54432u, property::type::LVT},
-  {54433u, property::type::LVT},
-  {54434u, property::type::LVT},
-  {54435u, property::type::LVT},
-  {54436u, property::type::LVT},
-  {54437u, property::type::LVT},
-  {54438u, property::type::LVT},
-  {54439u, property::type::LVT},
-  {54440u, property::type::LVT},
-  {54441u, property::type::LVT},
-  {54442u, property::type::LVT},
-  {54443u, property::type::LVT},
-  {54444u, property::type::LVT},
-  {54445u, property::type::LVT},
-  {54446u, property::type::LVT},
-  {54447u, property::type::LVT},
-  {54449u, property::type::LVT},
-  {54450u, property::type::LVT},
-  {54451u, property::type::LVT},
-  {54452u, property::type::LVT},
-  {54453u, property::type::LVT},
-  {54454u, property::type::LVT},
-  {54455u, property::type::LVT},
-  {54456u, property::type::LVT},
-  {54457u, property::type::LVT},
-  {54458u, property::type::LVT},
-  {54459u, property::type::LVT},
-  {54460u, property::type::LVT},
-  {54461u, property::type::LVT},
-  {54462u, property::type::LVT},
-  {54463u, property::type::LVT},
-  {54464u, property::type::LVT},
-  {54465u, property::type::LVT},
-  {54466u, property::type::LVT},
-  {54467u, property::type::LVT},
-  {54468u, property::type::LVT},
-  {54469u, property::type::LVT},
-  {54470u, property::type::LVT},
-  {54471u, property::type::LVT},
-  {54472u, property::type::LVT},
-  {54473u, property::type::LVT},
-  {54474u, property::type::LVT},
-  {54475u, property::type::LVT},
-  {54477u, property::type::LVT},
-  {54478u, property::type::LVT},
-  {54479u, property::type::LVT},
-  {54480u, property::type::LVT},
-  {54481u, property::type::LVT},
-  {54482u, property::type::LVT},
-  {54483u, property::type::LVT},
-  {54484u, property::type::LVT},
-  {54485u, property::type::LVT},
-  {54486u, property::type::LVT},
-  {54487u, property::type::LVT},
-  {54488u, property::type::LVT},
-  {54489u, property::type::LVT},
-  {54490u, property::type::LVT},
-  {54491u, property::type::LVT},
-  {54492u, property::type::LVT},
-  {54493u, property::type::LVT},
-  {54494u, property::type::LVT},
-  {54495u, property::type::LVT},
-  {54496u, property::type::LVT},
-  {54497u, property::type::LVT},
-  {54498u, property::type::LVT},
-  {54499u, property::type::LVT},
-  {54500u, property::type::LVT},
-  {54501u, property::type::LVT},
-  {54502u, property::type::LVT},
-  {54503u, property::type::LVT},
-  {54505u, property::type::LVT},
-  {54506u, property::type::LVT},
-  {54507u, property::type::LVT},
-  {54508u, property::type::LVT},
-  {54509u, property::type::LVT},
-  {54510u, property::type::LVT},
-  {54511u, property::type::LVT},
-  {54512u, property::type::LVT},
-  {54513u, property::type::LVT},
-  {54514u, property::type::LVT},
-  {54515u, property::type::LVT},
-  {54516u, property::type::LVT},
-  {54517u, property::type::LVT},
-  {54518u, property::type::LVT},
-  {54519u, property::type::LVT},
-  {54520u, property::type::LVT},
-  {54521u, property::type::LVT},
-  {54522u, property::type::LVT},
-  {54523u, property::type::LVT},
-  {54524u, property::type::LVT},
-  {54525u, property::type::LVT},
-  {54526u, property::type::LVT},
-  {54527u, property::type::LVT},
-  {54528u, property::type::LVT},
-  {54529u, property::type::LVT},
-  {54530u, property::type::LVT},
-  {54531u, property::type::LVT},
-  {54533u, property::type::LVT},
-  {54534u, property::type::LVT},
-  {54535u, property::type::LVT},
-  {54536u, property::type::LVT},
-  {54537u, property::type::LVT},
-  {54538u, property::type::LVT},
-  {54539u, property::type::LVT},
-  {54540u, property::type::LVT},
-  {54541u, property::type::LVT},
-  {54542u, property::type::LVT},
-  {54543u, property::type::LVT},
-  {54544u, property::type::LVT},
-  {54545u, property::type::LVT},
-  {54546u, property::type::LVT},
-  {54547u, property::type::LVT},
-  {54548u, property::type::LVT},
-  {54549u, property::type::LVT},
-  {54550u, property::type::LVT},
-  {54551u, property::type::LVT},
-  {54552u, property::type::LVT},
-  {54553u, property::type::LVT},
-  {54554u, property::type::LVT},
-  {54555u, property::type::LVT},
-  {54556u, property::type::LVT},
-  {54557u, property::type::LVT},
-  {54558u, property::type::LVT},
-  {54559u, property::type::LVT},
-  {54561u, property::type::LVT},
-  {54562u, property::type::LVT},
-  {54563u, property::type::LVT},
-  {54564u, property::type::LVT},
-  {54565u, property::type::LVT},
-  {54566u, property::type::LVT},
-  {54567u, property::type::LVT},
-  {54568u, property::type::LVT},
-  {54569u, property::type::LVT},
-  {54570u, property::type::LVT},
-  {54571u, property::type::LVT},
-  {54572u, property::type::LVT},
-  {54573u, property::type::LVT},
-  {54574u, property::type::LVT},
-  {54575u, property::type::LVT},
-  {54576u, property::type::LVT},
-  {54577u, property::type::LVT},
-  {54578u, property::type::LVT},
-  {54579u, property::type::LVT},
-  {54580u, property::type::LVT},
-  {54581u, property::type::LVT},
-  {54582u, property::type::LVT},
-  {54583u, property::type::LVT},
-  {54584u, property::type::LVT},
-  {54585u, property::type::LVT},
-  {54586u, property::type::LVT},
-  {54587u, property::type::LVT},
-  {54589u, property::type::LVT},
-  {54590u, property::type::LVT},
-  {54591u, property::type::LVT},
-  {54592u, property::type::LVT},
-  {54593u, property::type::LVT},
-  {54594u, property::type::LVT},
-  {54595u, property::type::LVT},
-  {54596u, property::type::LVT},
-  {54597u, property::type::LVT},
-  {54598u, property::type::LVT},
-  {54599u, property::type::LVT},
-  {54600u, property::type::LVT},
-  {54601u, property::type::LVT},
-  {54602u, property::type::LVT},
-  {54603u, property::type::LVT},
-  {54604u, property::type::LVT},
-  {54605u, property::type::LVT},
-  {54606u, property::type::LVT},
-  {54607u, property::type::LVT},
-  {54608u, property::type::LVT},
-  {54609u, property::type::LVT},
-  {54610u, property::type::LVT},
-  {54611u, property::type::LVT},
-  {54612u, property::type::LVT},
-  {54613u, property::type::LVT},
-  {54614u, property::type::LVT},
-  {54615u, property::type::LVT},
-  {54617u, property::type::LVT},
-  {54618u, property::type::LVT},
-  {54619u, property::type::LVT},
-  {54620u, property::type::LVT},
-  {54621u, property::type::LVT},
-  {54622u, property::type::LVT},
-  {54623u, property::type::LVT},
-  {54624u, property::type::LVT},
-  {54625u, property::type::LVT},
-  {54626u, property::type::LVT},
-  {54627u, property::type::LVT},
-  {54628u, property::type::LVT},
-  {54629u, property::type::LVT},
-  {54630u, property::type::LVT},
-  {54631u, property::type::LVT},
-  {54632u, property::type::LVT},
-  {54633u, property::type::LVT},
-  {54634u, property::type::LVT},
-  {54635u, property::type::LVT},
-  {54636u, property::type::LVT},
-  {54637u, property::type::LVT},
-  {54638u, property::type::LVT},
-  {54639u, property::type::LVT},
-  {54640u, property::type::LVT},
-  {54641u, property::type::LVT},
-  {54642u, property::type::LVT},
-  {54643u, property::type::LVT},
-  {54645u, property::type::LVT},
-  {54646u, property::type::LVT},
-  {54647u, property::type::LVT},
-  {54648u, property::type::LVT},
-  {54649u, property::type::LVT},
-  {54650u, property::type::LVT},
-  {54651u, property::type::LVT},
-  {54652u, property::type::LVT},
-  {54653u, property::type::LVT},
-  {54654u, property::type::LVT},
-  {54655u, property::type::LVT},
-  {54656u, property::type::LVT},
-  {54657u, property::type::LVT},
-  {54658u, property::type::LVT},
-  {54659u, property::type::LVT},
-  {54660u, property::type::LVT},
-  {54661u, property::type::LVT},
-  {54662u, property::type::LVT},
-  {54663u, property::type::LVT},
-  {54664u, property::type::LVT},
-  {54665u, property::type::LVT},
-  {54666u, property::type::LVT},
-  {54667u, property::type::LVT},
-  {54668u, property::type::LVT},
-  {54669u, property::type::LVT},
-  {54670u, property::type::LVT},
-  {54671u, property::type::LVT},
-  {54673u, property::type::LVT},
-  {54674u, property::type::LVT},
-  {54675u, property::type::LVT},
-  {54676u, property::type::LVT},
-  {54677u, property::type::LVT},
-  {54678u, property::type::LVT},
-  {54679u, property::type::LVT},
-  {54680u, property::type::LVT},
-  {54681u, property::type::LVT},
-  {54682u, property::type::LVT},
-  {54683u, property::type::LVT},
-  {54684u, property::type::LVT},
-  {54685u, property::type::LVT},
-  {54686u, property::type::LVT},
-  {54687u, property::type::LVT},
-  {54688u, property::type::LVT},
-  {54689u, property::type::LVT},
-  {54690u, property::type::LVT},
-  {54691u, property::type::LVT},
-  {54692u, property::type::LVT},
-  {54693u, property::type::LVT},
-  {54694u, property::type::LVT},
-  {54695u, property::type::LVT},
-  {54696u, property::type::LVT},
-  {54697u, property::type::LVT},
-  {54698u, property::type::LVT},
-  {54699u, property::type::LVT},
-  {54701u, property::type::LVT},
-  {54702u, property::type::LVT},
-  {54703u, property::type::LVT},
-  {54704u, property::type::LVT},
-  {54705u, property::type::LVT},
-  {54706u, property::type::LVT},
-  {54707u, property::type::LVT},
-  {54708u, property::type::LVT},
-  {54709u, property::type::LVT},
-  {54710u, property::type::LVT},
-  {54711u, property::type::LVT},
-  {54712u, property::type::LVT},
-  {54713u, property::type::LVT},
-  {54714u, property::type::LVT},
-  {54715u, property::type::LVT},
-  {54716u, property::type::LVT},
-  {54717u, property::type::LVT},
-  {54718u, property::type::LVT},
-  {54719u, property::type::LVT},
-  {54720u, property::type::LVT},
-  {54721u, property::type::LVT},
-  {54722u, property::type::LVT},
-  {54723u, property::type::LVT},
-  {54724u, property::type::LVT},
-  {54725u, property::type::LVT},
-  {54726u, property::type::LVT},
-  {54727u, property::type::LVT},
-  {54729u, property::type::LVT},
-  {54730u, property::type::LVT},
-  {54731u, property::type::LVT},
-  {54732u, property::type::LVT},
-  {54733u, property::type::LVT},
-  {54734u, property::type::LVT},
-  {54735u, property::type::LVT},
-  {54736u, property::type::LVT},
-  {54737u, property::type::LVT},
-  {54738u, property::type::LVT},
-  {54739u, property::type::LVT},
-  {54740u, property::type::LVT},
-  {54741u, property::type::LVT},
-  {54742u, property::type::LVT},
-  {54743u, property::type::LVT},
-  {54744u, property::type::LVT},
-  {54745u, property::type::LVT},
-  {54746u, property::type::LVT},
-  {54747u, property::type::LVT},
-  {54748u, property::type::LVT},
-  {54749u, property::type::LVT},
-  {54750u, property::type::LVT},
-  {54751u, property::type::LVT},
-  {54752u, property::type::LVT},
-  {54753u, property::type::LVT},
-  {54754u, property::type::LVT},
-  {54755u, property::type::LVT},
-  {54757u, property::type::LVT},
-  {54758u, property::type::LVT},
-  {54759u, property::type::LVT},
-  {54760u, property::type::LVT},
-  {54761u, property::type::LVT},
-  {54762u, property::type::LVT},
-  {54763u, property::type::LVT},
-  {54764u, property::type::LVT},
-  {54765u, property::type::LVT},
-  {54766u, property::type::LVT},
-  {54767u, property::type::LVT},
-  {54768u, property::type::LVT},
-  {54769u, property::type::LVT},
-  {54770u, property::type::LVT},
-  {54771u, property::type::LVT},
-  {54772u, property::type::LVT},
-  {54773u, property::type::LVT},
-  {54774u, property::type::LVT},
-  {54775u, property::type::LVT},
-  {54776u, property::type::LVT},
-  {54777u, property::type::LVT},
-  {54778u, property::type::LVT},
-  {54779u, property::type::LVT},
-  {54780u, property::type::LVT},
-  {54781u, property::type::LVT},
-  {54782u, property::type::LVT},
-  {54783u, property::type::LVT},
-  {54785u, property::type::LVT},
-  {54786u, property::type::LVT},
-  {54787u, property::type::LVT},
-  {54788u, property::type::LVT},
-  {54789u, property::type::LVT},
-  {54790u, property::type::LVT},
-  {54791u, property::type::LVT},
-  {54792u, property::type::LVT},
-  {54793u, property::type::LVT},
-  {54794u, property::type::LVT},
-  {54795u, property::type::LVT},
-  {54796u, property::type::LVT},
-  {54797u, property::type::LVT},
-  {54798u, property::type::LVT},
-  {54799u, property::type::LVT},
-  {54800u, property::type::LVT},
-  {54801u, property::type::LVT},
-  {54802u, property::type::LVT},
-  {54803u, property::type::LVT},
-  {54804u, property::type::LVT},
-  {54805u, property::type::LVT},
-  {54806u, property::type::LVT},
-  {54807u, property::type::LVT},
-  {54808u, property::type::LVT},
-  {54809u, property::type::LVT},
-  {54810u, property::type::LVT},
-  {54811u, property::type::LVT},
-  {54813u, property::type::LVT},
-  {54814u, property::type::LVT},
-  {54815u, property::type::LVT},
-  {54816u, property::type::LVT},
-  {54817u, property::type::LVT},
-  {54818u, property::type::LVT},
-  {54819u, property::type::LVT},
-  {54820u, property::type::LVT},
-  {54821u, property::type::LVT},
-  {54822u, property::type::LVT},
-  {54823u, property::type::LVT},
-  {54824u, property::type::LVT},
-  {54825u, property::type::LVT},
-  {54826u, property::type::LVT},
-  {54827u, property::type::LVT},
-  {54828u, property::type::LVT},
-  {54829u, property::type::LVT},
-  {54830u, property::type::LVT},
-  {54831u, property::type::LVT},
-  {54832u, property::type::LVT},
-  {54833u, property::type::LVT},
-  {54834u, property::type::LVT},
-  {54835u, property::type::LVT},
-  {54836u, property::type::LVT},
-  {54837u, property::type::LVT},
-  {54838u, property::type::LVT},
-  {54839u, property::type::LVT},
-  {54841u, property::type::LVT},
-  {54842u, property::type::LVT},
-  {54843u, property::type::LVT},
-  {54844u, property::type::LVT},
-  {54845u, property::type::LVT},
-  {54846u, property::type::LVT},
-  {54847u, property::type::LVT},
-  {54848u, property::type::LVT},
-  {54849u, property::type::LVT},
-  {54850u, property::type::LVT},
-  {54851u, property::type::LVT},
-  {54852u, property::type::LVT},
-  {54853u, property::type::LVT},
-  {54854u, property::type::LVT},
-  {54855u, property::type::LVT},
-  {54856u, property::type::LVT},
-  {54857u, property::type::LVT},
-  {54858u, property::type::LVT},
-  {54859u, property::type::LVT},
-  {54860u, property::type::LVT},
-  {54861u, property::type::LVT},
-  {54862u, property::type::LVT},
-  {54863u, property::type::LVT},
-  {54864u, property::type::LVT},
-  {54865u, property::type::LVT},
-  {54866u, property::type::LVT},
-  {54867u, property::type::LVT},
-  {54869u, property::type::LVT},
-  {54870u, property::type::LVT},
-  {54871u, property::type::LVT},
-  {54872u, property::type::LVT},
-  {54873u, property::type::LVT},
-  {54874u, property::type::LVT},
-  {54875u, property::type::LVT},
-  {54876u, property::type::LVT},
-  {54877u, property::type::LVT},
-  {54878u, property::type::LVT},
-  {54879u, property::type::LVT},
-  {54880u, property::type::LVT},
-  {54881u, property::type::LVT},
-  {54882u, property::type::LVT},
-  {54883u, property::type::LVT},
-  {54884u, property::type::LVT},
-  {54885u, property::type::LVT},
-  {54886u, property::type::LVT},
-  {54887u, property::type::LVT},
-  {54888u, property::type::LVT},
-  {54889u, property::type::LVT},
-  {54890u, property::type::LVT},
-  {54891u, property::type::LVT},
-  {54892u, property::type::LVT},
-  {54893u, property::type::LVT},
-  {54894u, property::type::LVT},
-  {54895u, property::type::LVT},
-  {54897u, property::type::LVT},
-  {54898u, property::type::LVT},
-  {54899u, property::type::LVT},
-  {54900u, property::type::LVT},
-  {54901u, property::type::LVT},
-  {54902u, property::type::LVT},
-  {54903u, property::type::LVT},
-  {54904u, property::type::LVT},
-  {54905u, property::type::LVT},
-  {54906u, property::type::LVT},
-  {54907u, property::type::LVT},
-  {54908u, property::type::LVT},
-  {54909u, property::type::LVT},
-  {54910u, property::type::LVT},
-  {54911u, property::type::LVT},
-  {54912u, property::type::LVT},
-  {54913u, property::type::LVT},
-  {54914u, property::type::LVT},
-  {54915u, property::type::LVT},
-  {54916u, property::type::LVT},
-  {54917u, property::type::LVT},
-  {54918u, property::type::LVT},
-  {54919u, property::type::LVT},
-  {54920u, property::type::LVT},
-  {54921u, property::type::LVT},
-  {54922u, property::type::LVT},
-  {54923u, property::type::LVT},
-  {54925u, property::type::LVT},
-  {54926u, property::type::LVT},
-  {54927u, property::type::LVT},
-  {54928u, property::type::LVT},
-  {54929u, property::type::LVT},
-  {54930u, property::type::LVT},
-  {54931u, property::type::LVT},
-  {54932u, property::type::LVT},
-  {54933u, property::type::LVT},
-  {54934u, property::type::LVT},
-  {54935u, property::type::LVT},
-  {54936u, property::type::LVT},
-  {54937u, property::type::LVT},
-  {54938u, property::type::LVT},
-  {54939u, property::type::LVT},
-  {54940u, property::type::LVT},
-  {54941u, property::type::LVT},
-  {54942u, property::type::LVT},
-  {54943u, property::type::LVT},
-  {54944u, property::type::LVT},
-  {54945u, property::type::LVT},
-  {54946u, property::type::LVT},
-  {54947u, property::type::LVT},
-  {54948u, property::type::LVT},
-  {54949u, property::type::LVT},
-  {54950u, property::type::LVT},
-  {54951u, property::type::LVT},
-  {54953u, property::type::LVT},
-  {54954u, property::type::LVT},
-  {54955u, property::type::LVT},
-  {54956u, property::type::LVT},
-  {54957u, property::type::LVT},
-  {54958u, property::type::LVT},
-  {54959u, property::type::LVT},
-  {54960u, property::type::LVT},
-  {54961u, property::type::LVT},
-  {54962u, property::type::LVT},
-  {54963u, property::type::LVT},
-  {54964u, property::type::LVT},
-  {54965u, property::type::LVT},
-  {54966u, property::type::LVT},
-  {54967u, property::type::LVT},
-  {54968u, property::type::LVT},
-  {54969u, property::type::LVT},
-  {54970u, property::type::LVT},
-  {54971u, property::type::LVT},
-  {54972u, property::type::LVT},
-  {54973u, property::type::LVT},
-  {54974u, property::type::LVT},
-  {54975u, property::type::LVT},
-  {54976u, property::type::LVT},
-  {54977u, property::type::LVT},
-  {54978u, property::type::LVT},
-  {54979u, property::type::LVT},
-  {54981u, property::type::LVT},
-  {54982u, property::type::LVT},
-  {54983u, property::type::LVT},
-  {54984u, property::type::LVT},
-  {54985u, property::type::LVT},
-  {54986u, property::type::LVT},
-  {54987u, property::type::LVT},
-  {54988u, property::type::LVT},
-  {54989u, property::type::LVT},
-  {54990u, property::type::LVT},
-  {54991u, property::type::LVT},
-  {54992u, property::type::LVT},
-  {54993u, property::type::LVT},
-  {54994u, property::type::LVT},
-  {54995u, property::type::LVT},
-  {54996u, property::type::LVT},
-  {54997u, property::type::LVT},
-  {54998u, property::type::LVT},
-  {54999u, property::type::LVT},
-  {55000u, property::type::LVT},
-  {55001u, property::type::LVT},
-  {55002u, property::type::LVT},
-  {55003u, property::type::LVT},
-  {55004u, property::type::LVT},
-  {55005u, property::type::LVT},
-  {55006u, property::type::LVT},
-  {55007u, property::type::LVT},
-  {55009u, property::type::LVT},
-  {55010u, property::type::LVT},
-  {55011u, property::type::LVT},
-  {55012u, property::type::LVT},
-  {55013u, property::type::LVT},
-  {55014u, property::type::LVT},
-  {55015u, property::type::LVT},
-  {55016u, property::type::LVT},
-  {55017u, property::type::LVT},
-  {55018u, property::type::LVT},
-  {55019u, property::type::LVT},
-  {55020u, property::type::LVT},
-  {55021u, property::type::LVT},
-  {55022u, property::type::LVT},
-  {55023u, property::type::LVT},
-  {55024u, property::type::LVT},
-  {55025u, property::type::LVT},
-  {55026u, property::type::LVT},
-  {55027u, property::type::LVT},
-  {55028u, property::type::LVT},
-  {55029u, property::type::LVT},
-  {55030u, property::type::LVT},
-  {55031u, property::type::LVT},
-  {55032u, property::type::LVT},
-  {55033u, property::type::LVT},
-  {55034u, property::type::LVT},
-  {55035u, property::type::LVT},
-  {55037u, property::type::LVT},
-  {55038u, property::type::LVT},
-  {55039u, property::type::LVT},
-  {55040u, property::type::LVT},
-  {55041u, property::type::LVT},
-  {55042u, property::type::LVT},
-  {55043u, property::type::LVT},
-  {55044u, property::type::LVT},
-  {55045u, property::type::LVT},
-  {55046u, property::type::LVT},
-  {55047u, property::type::LVT},
-  {55048u, property::type::LVT},
-  {55049u, property::type::LVT},
-  {55050u, property::type::LVT},
-  {55051u, property::type::LVT},
-  {55052u, property::type::LVT},
-  {55053u, property::type::LVT},
-  {55054u, property::type::LVT},
-  {55055u, property::type::LVT},
-  {55056u, property::type::LVT},
-  {55057u, property::type::LVT},
-  {55058u, property::type::LVT},
-  {55059u, property::type::LVT},
-  {55060u, property::type::LVT},
-  {55061u, property::type::LVT},
-  {55062u, property::type::LVT},
-  {55063u, property::type::LVT},
-  {55065u, property::type::LVT},
-  {55066u, property::type::LVT},
-  {55067u, property::type::LVT},
-  {55068u, property::type::LVT},
-  {55069u, property::type::LVT},
-  {55070u, property::type::LVT},
-  {55071u, property::type::LVT},
-  {55072u, property::type::LVT},
-  {55073u, property::type::LVT},
-  {55074u, property::type::LVT},
-  {55075u, property::type::LVT},
-  {55076u, property::type::LVT},
-  {55077u, property::type::LVT},
-  {55078u, property::type::LVT},
-  {55079u, property::type::LVT},
-  {55080u, property::type::LVT},
-  {55081u, property::type::LVT},
-  {55082u, property::type::LVT},
-  {55083u, property::type::LVT},
-  {55084u, property::type::LVT},
-  {55085u, property::type::LVT},
-  {55086u, property::type::LVT},
-  {55087u, property::type::LVT},
-  {55088u, property::type::LVT},
-  {55089u, property::type::LVT},
-  {55090u, property::type::LVT},
-  {55091u, property::type::LVT},
-  {55093u, property::type::LVT},
-  {55094u, property::type::LVT},
-  {55095u, property::type::LVT},
-  {55096u, property::type::LVT},
-  {55097u, property::type::LVT},
-  {55098u, property::type::LVT},
-  {55099u, property::type::LVT},
-  {55100u, property::type::LVT},
-  {55101u, property::type::LVT},
-  {55102u, property::type::LVT},
-  {55103u, property::type::LVT},
-  {55104u, property::type::LVT},
-  {55105u, property::type::LVT},
-  {55106u, property::type::LVT},
-  {55107u, property::type::LVT},
-  {55108u, property::type::LVT},
-  {55109u, property::type::LVT},
-  {55110u, property::type::LVT},
-  {55111u, property::type::LVT},
-  {55112u, property::type::LVT},
-  {55113u, property::type::LVT},
-  {55114u, property::type::LVT},
-  {55115u, property::type::LVT},
-  {55116u, property::type::LVT},
-  {55117u, property::type::LVT},
-  {55118u, property::type::LVT},
-  {55119u, property::type::LVT},
-  {55121u, property::type::LVT},
-  {55122u, property::type::LVT},
-  {55123u, property::type::LVT},
-  {55124u, property::type::LVT},
-  {55125u, property::type::LVT},
-  {55126u, property::type::LVT},
-  {55127u, property::type::LVT},
-  {55128u, property::type::LVT},
-  {55129u, property::type::LVT},
-  {55130u, property::type::LVT},
-  {55131u, property::type::LVT},
-  {55132u, property::type::LVT},
-  {55133u, property::type::LVT},
-  {55134u, property::type::LVT},
-  {55135u, property::type::LVT},
-  {55136u, property::type::LVT},
-  {55137u, property::type::LVT},
-  {55138u, property::type::LVT},
-  {55139u, property::type::LVT},
-  {55140u, property::type::LVT},
-  {55141u, property::type::LVT},
-  {55142u, property::type::LVT},
-  {55143u, property::type::LVT},
-  {55144u, property::type::LVT},
-  {55145u, property::type::LVT},
-  {55146u, property::type::LVT},
-  {55147u, property::type::LVT},
-  {55149u, property::type::LVT},
-  {55150u, property::type::LVT},
-  {55151u, property::type::LVT},
-  {55152u, property::type::LVT},
-  {55153u, property::type::LVT},
-  {55154u, property::type::LVT},
-  {55155u, property::type::LVT},
-  {55156u, property::type::LVT},
-  {55157u, property::type::LVT},
-  {55158u, property::type::LVT},
-  {55159u, property::type::LVT},
-  {55160u, property::type::LVT},
-  {55161u, property::type::LVT},
-  {55162u, property::type::LVT},
-  {55163u, property::type::LVT},
-  {55164u, property::type::LVT},
-  {55165u, property::type::LVT},
-  {55166u, property::type::LVT},
-  {55167u, property::type::LVT},
-  {55168u, property::type::LVT},
-  {55169u, property::type::LVT},
-  {55170u, property::type::LVT},
-  {55171u, property::type::LVT},
-  {55172u, property::type::LVT},
-  {55173u, property::type::LVT},
-  {55174u, property::type::LVT},
-  {55175u, property::type::LVT},
-  {55177u, property::type::LVT},
-  {55178u, property::type::LVT},
-  {55179u, property::type::LVT},
-  {55180u, property::type::LVT},
-  {55181u, property::type::LVT},
-  {55182u, property::type::LVT},
-  {55183u, property::type::LVT},
-  {55184u, property::type::LVT},
-  {55185u, property::type::LVT},
-  {55186u, property::type::LVT},
-  {55187u, property::type::LVT},
-  {55188u, property::type::LVT},
-  {55189u, property::type::LVT},
-  {55190u, property::type::LVT},
-  {55191u, property::type::LVT},
-  {55192u, property::type::LVT},
-  {55193u, property::type::LVT},
-  {55194u, property::type::LVT},
-  {55195u, property::type::LVT},
-  {55196u, property::type::LVT},
-  {55197u, property::type::LVT},
-  {55198u, property::type::LVT},
-  {55199u, property::type::LVT},
-  {55200u, property::type::LVT},
-  {55201u, property::type::LVT},
-  {55202u, property::type::LVT},
-  {55203u, property::type::LVT},
-  {8205u, property::type::ZWJ}
-};
-
-} // namespace detail
-} // namespace auc
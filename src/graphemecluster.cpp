@@ -1,171 +1,376 @@
+#include "ascii.hpp"
+
+#include <auc/decode.hpp>
+#include <auc/encode.hpp>
 #include <auc/graphemecluster.hpp>
 #include <auc/property.hpp>
 
 #include <algorithm>
-#include <tuple>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
 
 namespace auc {
 
 namespace detail {
 
-property get_prop(const u8char& c) {
-  return property{c.get_codepoint().get_num()};
-}
+namespace {
 
-int num_current_regind_props(const std::vector<u8char>& current_cluster) {
-  return std::count_if(current_cluster.begin(), current_cluster.end(),
-                       [](const u8char& c) {
-                         return (get_prop(c).has_property(property::type::RI));
-                       });
+struct decoded_char {
+  std::uint32_t codepoint_{0u};
+  std::size_t num_bytes_{0u};
 };
 
-bool is_emoji_sequence(const std::vector<u8char>& current_cluster) {
-  if (current_cluster.size() < 2u) {
-    return false;
-  }
-  bool is_seq =
-      (get_prop(current_cluster.front())
-           .has_property(property::type::Ext_Pict)) &&
-      (get_prop(current_cluster.back()).has_property(property::type::ZWJ));
+decoded_char front_char(std::string_view bytes) {
+  const char* p = bytes.data();
+  const decode_result decoded = decode_next(p, bytes.data() + bytes.size());
+  return decoded_char{decoded.codepoint_,
+                      static_cast<std::size_t>(p - bytes.data())};
+}
 
-  if (current_cluster.size() > 2u) {
-    for (std::size_t c_idx = 1u; c_idx < current_cluster.size() - 1u; ++c_idx) {
-      const u8char& c = current_cluster[c_idx];
-      is_seq &= (get_prop(c).has_property(property::type::Extend));
-    }
-  }
+// Whether there is a break between two characters, given just their break
+// classes. Only GB11 and GB12/GB13 need to know what came before the pair.
+enum class pair_break : std::uint8_t { Break, NoBreak, NeedsContext };
 
-  return is_seq;
+// The Grapheme_Cluster_Break values, plus Extended_Pictographic for GB11.
+// Extended_Pictographic characters all have a Grapheme_Cluster_Break value
+// of Other.
+constexpr std::size_t num_break_classes =
+    static_cast<std::size_t>(property::type::ZWJ) + 2u;
+constexpr std::size_t ext_pict_class = num_break_classes - 1u;
+
+std::size_t break_class(const property& prop) {
+  return prop.has_property(property::type::Ext_Pict)
+             ? ext_pict_class
+             : static_cast<std::size_t>(prop.grapheme_break());
 }
 
 // https://www.unicode.org/reports/tr29/#Grapheme_Cluster_Boundary_Rules
-bool has_break(const std::vector<u8char>& current_cluster,
-               const codepoint& previous,
-               const codepoint& current) {
-  const auto previous_prop = property{previous.get_num()};
-  const auto current_prop = property{current.get_num()};
+constexpr pair_break pair_rule(std::size_t previous, std::size_t current) {
+  using type = property::type;
+  const auto is = [](std::size_t cls, std::initializer_list<type> types) {
+    for (const type t : types) {
+      if (cls == static_cast<std::size_t>(t))
+        return true;
+    }
+    return false;
+  };
 
   // Break at the start and end of text, unless the text is empty.
   // GB1/GB2 are handled implicitly
 
   // Do not break between a CR and LF. Otherwise, break before and after
   // controls.
-  if (previous_prop.has_property(property::type::CR) &&
-      current_prop.has_property(property::type::LF)) {
+  if (is(previous, {type::CR}) && is(current, {type::LF})) {
     // GB3
-    return false;
-  } else if (previous_prop.has_property({property::type::Control,
-                                         property::type::CR,
-                                         property::type::LF})) {
+    return pair_break::NoBreak;
+  } else if (is(previous, {type::Control, type::CR, type::LF})) {
     // GB4
-    return true;
-  } else if (current_prop.has_property({property::type::Control,
-                                        property::type::CR,
-                                        property::type::LF})) {
+    return pair_break::Break;
+  } else if (is(current, {type::Control, type::CR, type::LF})) {
     // GB5
-    return true;
+    return pair_break::Break;
   }
   // Do not break Hangul syllable sequences.
-  else if (previous_prop.has_property(property::type::L) &&
-           current_prop.has_property({property::type::L, property::type::V,
-                                      property::type::LV,
-                                      property::type::LVT})) {
+  else if (is(previous, {type::L}) &&
+           is(current, {type::L, type::V, type::LV, type::LVT})) {
     // GB6
-    return false;
-  } else if (previous_prop.has_property(
-                 {property::type::LV, property::type::V}) &&
-             current_prop.has_property(
-                 {property::type::V, property::type::T})) {
+    return pair_break::NoBreak;
+  } else if (is(previous, {type::LV, type::V}) &&
+             is(current, {type::V, type::T})) {
     // GB7
-    return false;
-  } else if (previous_prop.has_property(
-                 {property::type::LVT, property::type::T}) &&
-             current_prop.has_property(property::type::T)) {
+    return pair_break::NoBreak;
+  } else if (is(previous, {type::LVT, type::T}) && is(current, {type::T})) {
     // GB8
-    return false;
+    return pair_break::NoBreak;
   }
   // Do not break before extending characters or ZWJ.
-  else if (current_prop.has_property(
-               {property::type::Extend, property::type::ZWJ})) {
+  else if (is(current, {type::Extend, type::ZWJ})) {
     // GB9
-    return false;
+    return pair_break::NoBreak;
   }
   // NOTE: Currently we always assume we support extended grapheme clusters over
   // legacy grapheme clusters
 
   // Do not break before SpacingMarks, or after Prepend characters.
-  else if (current_prop.has_property(property::type::SpacingMark)) {
+  else if (is(current, {type::SpacingMark})) {
     // GB9a
-    return false;
-  } else if (previous_prop.has_property(property::type::Prepend)) {
+    return pair_break::NoBreak;
+  } else if (is(previous, {type::Prepend})) {
     // GB9b
-    return false;
+    return pair_break::NoBreak;
   }
   // Do not break within emoji modifier sequences or emoji zwj sequences.
-  else if (current_prop.has_property(property::type::Ext_Pict)) {
+  else if (is(previous, {type::ZWJ}) && current == ext_pict_class) {
     // GB11
-    return !is_emoji_sequence(current_cluster);
+    return pair_break::NeedsContext;
   }
   // Do not break within emoji flag sequences. That is, do not break between
   // regional indicator (RI) symbols if there is an odd number of RI characters
   // before the break point.
-  else if (previous_prop.has_property(property::type::RI) &&
-           current_prop.has_property(property::type::RI)) {
+  else if (is(previous, {type::RI}) && is(current, {type::RI})) {
     // GB12 and GB13
-    return !(num_current_regind_props(current_cluster) <= 1);
+    return pair_break::NeedsContext;
   }
   // Otherwise, break everywhere.
   else {
     // GB999
-    return true;
+    return pair_break::Break;
+  }
+}
+
+// Indexed by (previous class * num_break_classes + current class)
+constexpr std::array<pair_break, num_break_classes * num_break_classes>
+    pair_break_table = [] {
+      std::array<pair_break, num_break_classes * num_break_classes> table{};
+      for (std::size_t previous = 0u; previous < num_break_classes;
+           ++previous) {
+        for (std::size_t current = 0u; current < num_break_classes;
+             ++current) {
+          table[previous * num_break_classes + current] =
+              pair_rule(previous, current);
+        }
+      }
+      return table;
+    }();
+
+}  // namespace
+
+bool grapheme_break_state::advance(std::uint32_t cp) {
+  const std::size_t current = break_class(property{cp});
+
+  bool boundary = false;
+  if (previous_class_ != no_class) {
+    switch (pair_break_table[previous_class_ * num_break_classes + current]) {
+      case pair_break::Break:
+        boundary = true;
+        break;
+      case pair_break::NoBreak:
+        boundary = false;
+        break;
+      case pair_break::NeedsContext:
+      default:
+        // GB11, otherwise GB12 and GB13
+        boundary = (current == ext_pict_class)
+                       ? (emoji_ != emoji_state::ExtPictZwj)
+                       : !odd_ri_;
+        break;
+    }
+  }
+
+  if (current == ext_pict_class) {
+    emoji_ = emoji_state::ExtPict;
+  } else if (current == static_cast<std::size_t>(property::type::ZWJ)) {
+    emoji_ = (emoji_ == emoji_state::ExtPict) ? emoji_state::ExtPictZwj
+                                              : emoji_state::None;
+  } else if (current != static_cast<std::size_t>(property::type::Extend) ||
+             emoji_ != emoji_state::ExtPict) {
+    emoji_ = emoji_state::None;
   }
+  odd_ri_ = (current == static_cast<std::size_t>(property::type::RI)) &&
+            !odd_ri_;
+  previous_class_ = static_cast<std::uint8_t>(current);
+
+  return boundary;
 }
 
-std::vector<graphemecluster> build_grapheme_clusters(
-    const std::vector<u8char>& chars) {
-  std::vector<u8char> cluster;
-  std::vector<graphemecluster> grapheme_clusters;
-
-  // Trivial cases
-  if (chars.empty())
-    return {};
-  else if (chars.size() == 1u) {
-    grapheme_clusters.push_back(graphemecluster{chars});
-    return grapheme_clusters;
-  } else if (chars.size() == 2u) {
-    if (has_break(cluster, chars[0].get_codepoint(),
-                  chars[1].get_codepoint())) {
-      grapheme_clusters.push_back(graphemecluster{{chars[0]}});
-      grapheme_clusters.push_back(graphemecluster{{chars[1]}});
-    } else {
-      grapheme_clusters.push_back(graphemecluster{chars});
+std::size_t grapheme_cluster_size(std::string_view bytes) {
+  if (bytes.empty())
+    return 0u;
+
+  // ASCII has no Extend, ZWJ, SpacingMark, Prepend or Regional_Indicator
+  // characters, so the only pair of ASCII characters without a break
+  // between them is CR LF (GB3)
+  const auto is_ascii = [](char byte) {
+    return static_cast<unsigned char>(byte) < 0x80u;
+  };
+  if (is_ascii(bytes[0]) && (bytes.size() == 1u || is_ascii(bytes[1]))) {
+    return (bytes.size() > 1u && bytes[0] == '\r' && bytes[1] == '\n') ? 2u
+                                                                        : 1u;
+  }
+
+  grapheme_break_state state;
+  std::size_t cluster_size = 0u;
+  while (cluster_size < bytes.size()) {
+    const decoded_char current = front_char(bytes.substr(cluster_size));
+    if (state.advance(current.codepoint_)) {
+      break;
     }
-    return grapheme_clusters;
-  }
-
-  // Non-trivial cases
-  for (std::size_t current_codepoint_idx = 1u;
-       current_codepoint_idx < chars.size(); ++current_codepoint_idx) {
-    const std::size_t previous_codepoint_idx = current_codepoint_idx - 1u;
-    const codepoint previous_codepoint =
-        chars[previous_codepoint_idx].get_codepoint();
-    const codepoint current_codepoint =
-        chars[current_codepoint_idx].get_codepoint();
-
-    cluster.push_back(chars[previous_codepoint_idx]);
-    if (has_break(cluster, previous_codepoint, current_codepoint)) {
-      grapheme_clusters.push_back(graphemecluster{cluster});
-      cluster.clear();
+    cluster_size += current.num_bytes_;
+  }
+
+  return cluster_size;
+}
+
+namespace {
+
+bool is_continuation(char byte) {
+  return (static_cast<unsigned char>(byte) & 0xC0u) == 0x80u;
+}
+
+// Start of the character holding the byte before offset. The nearest lead
+// byte within 3 bytes starts a character, but an ill-formed sequence may end
+// before offset so the characters are decoded forward from it.
+std::size_t previous_char(std::string_view text, std::size_t offset) {
+  std::size_t start = offset - 1u;
+  for (std::size_t num = 0u; num < 3u && start > 0u; ++num) {
+    if (!is_continuation(text[start]))
+      break;
+    --start;
+  }
+  if (is_continuation(text[start])) {
+    // No character has more than 3 continuation bytes, so this is a stray one
+    return offset - 1u;
+  }
+
+  for (;;) {
+    const std::size_t next = start + front_char(text.substr(start)).num_bytes_;
+    if (next >= offset)
+      return start;
+    start = next;
+  }
+}
+
+// Characters other than Extend, ZWJ and RI leave the state machine in the
+// same state whatever came before them, so it can be restarted from them
+constexpr property::mask context_props = property::mask_of(
+    {property::type::Extend, property::type::ZWJ, property::type::RI});
+
+// Start of the last character before offset that segmentation can restart
+// from, or the start of the text
+std::size_t restart_offset(std::string_view text, std::size_t offset) {
+  while (offset > 0u) {
+    offset = previous_char(text, offset);
+    if (!property{front_char(text.substr(offset)).codepoint_}.has_any(
+            context_props)) {
+      break;
     }
-    if (current_codepoint_idx + 1u == chars.size()) {
-      cluster.push_back(chars.back());
-      grapheme_clusters.push_back(graphemecluster{cluster});
+  }
+  return offset;
+}
+
+}  // namespace
+
+}  // namespace detail
+
+// https://www.unicode.org/reports/tr29/#Random_Access
+std::size_t next_grapheme_boundary(std::string_view text, std::size_t offset) {
+  if (offset >= text.size())
+    return text.size();
+
+  detail::grapheme_break_state state;
+  for (std::size_t idx = detail::restart_offset(text, offset);
+       idx < text.size();) {
+    const detail::decoded_char c = detail::front_char(text.substr(idx));
+    if (state.advance(c.codepoint_) && idx > offset)
+      return idx;
+    idx += c.num_bytes_;
+  }
+  return text.size();
+}
+
+std::size_t previous_grapheme_boundary(std::string_view text,
+                                       std::size_t offset) {
+  offset = std::min(offset, text.size());
+
+  // Whether there is a boundary before the character segmentation restarts
+  // from isn't known. When there is none between it and offset, restart
+  // further back and look up to and including the previous restart point.
+  std::size_t end = offset;
+  std::size_t stop = offset;
+  while (end > 0u) {
+    const std::size_t restart = detail::restart_offset(text, end);
+
+    detail::grapheme_break_state state;
+    std::size_t boundary = restart;
+    for (std::size_t idx = restart; idx < stop;) {
+      const detail::decoded_char c = detail::front_char(text.substr(idx));
+      if (state.advance(c.codepoint_))
+        boundary = idx;
+      idx += c.num_bytes_;
     }
+    if (boundary != restart || restart == 0u)
+      return boundary;
+
+    end = restart;
+    stop = restart + 1u;
   }
+  return 0u;
+}
 
-  return grapheme_clusters;
+namespace detail {
+
+std::size_t previous_cluster_start(std::string_view text,
+                                   std::size_t boundary) {
+  // Regional indicators all take up 4 bytes
+  constexpr std::size_t ri_size = 4u;
+  const auto is_ri_at = [text](std::size_t offset) {
+    return offset < text.size() &&
+           property{front_char(text.substr(offset)).codepoint_}.has_property(
+               property::type::RI);
+  };
+
+  // A boundary between two regional indicators has an even number of them
+  // before it in their run (GB12/GB13), so the two before it are a flag.
+  // With a third before that, there is a boundary before the flag too.
+  if (boundary >= 3u * ri_size && is_ri_at(boundary) &&
+      is_ri_at(boundary - ri_size) && is_ri_at(boundary - 2u * ri_size) &&
+      is_ri_at(boundary - 3u * ri_size)) {
+    return boundary - 2u * ri_size;
+  }
+  return previous_grapheme_boundary(text, boundary);
 }
 
 }  // namespace detail
 
+std::size_t count_graphemes(std::string_view text) {
+  std::size_t count = 0u;
+  for (std::size_t idx = 0u; idx < text.size();) {
+    // The last character of an ASCII run is left to the rules, as it could
+    // still be extended by what follows it
+    if (static_cast<unsigned char>(text[idx]) < 0x80u) {
+      const std::size_t run_end =
+          idx + detail::ascii_prefix_length(text.data() + idx,
+                                            text.size() - idx);
+      while (idx + 1u < run_end) {
+        ++count;
+        idx += (text[idx] == '\r' && text[idx + 1u] == '\n') ? 2u : 1u;
+      }
+      if (idx == run_end) {
+        continue;
+      }
+    }
+
+    ++count;
+    idx += detail::grapheme_cluster_size(text.substr(idx));
+  }
+  return count;
+}
+
+std::string_view truncate_graphemes(std::string_view text,
+                                    truncation_limits limits) {
+  if (text.size() <= limits.max_bytes_ &&
+      limits.max_clusters_ == std::string_view::npos) {
+    return text;
+  }
+
+  // Whether there is a boundary at max_bytes_ is known once the character
+  // starting there is, so segmentation is limited to the bytes up to its end
+  const std::string_view bytes =
+      (limits.max_bytes_ < text.size())
+          ? text.substr(0u, limits.max_bytes_ + max_encoded_size)
+          : text;
+  std::size_t size = 0u;
+  for (std::size_t num_clusters = 0u;
+       num_clusters < limits.max_clusters_ && size < bytes.size();
+       ++num_clusters) {
+    const std::size_t cluster_size =
+        detail::grapheme_cluster_size(bytes.substr(size));
+    if (cluster_size > limits.max_bytes_ - size)
+      break;
+    size += cluster_size;
+  }
+  return text.substr(0u, size);
+}
+
 }  // namespace auc
\ No newline at end of file
@@ -0,0 +1,692 @@
+// NOTE: This file was autogenerated via scripts/gen_property_lookup.py
+#include <auc/property.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// https://www.unicode.org/Public/15.0.0/ucd/auxiliary/GraphemeBreakProperty.txt
+// https://www.unicode.org/Public/15.0.0/ucd/emoji/emoji-data.txt
+namespace auc {
+namespace detail {
+
+struct property_entry {
+  property::type break_prop_;
+  // Bit N is set for property::type::Emoji + N
+  std::uint8_t emoji_props_;
+};
+
+inline constexpr property_entry property_entries[23] = {
+  {property::type::Other, 0u},
+  {property::type::Control, 0u},
+  {property::type::LF, 0u},
+  {property::type::CR, 0u},
+  {property::type::Other, 17u},
+  {property::type::Other, 33u},
+  {property::type::Extend, 0u},
+  {property::type::Prepend, 0u},
+  {property::type::SpacingMark, 0u},
+  {property::type::L, 0u},
+  {property::type::V, 0u},
+  {property::type::T, 0u},
+  {property::type::ZWJ, 16u},
+  {property::type::Extend, 16u},
+  {property::type::Other, 35u},
+  {property::type::Other, 32u},
+  {property::type::Other, 41u},
+  {property::type::Other, 43u},
+  {property::type::LV, 0u},
+  {property::type::LVT, 0u},
+  {property::type::RI, 19u},
+  {property::type::Extend, 23u},
+  {property::type::Other, 51u}
+};
+
+inline constexpr std::uint8_t property_stage1[2176] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 10,
+  15, 16, 17, 18, 19, 20, 21, 10, 22, 23, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 27, 28, 29,
+  30, 31, 32, 33, 27, 28, 29, 30, 31, 32, 33, 34, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 35, 10, 36,
+  37, 38, 10, 10, 10, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 50, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 51, 10, 52, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 53, 10,
+  10, 10, 10, 10, 10, 10, 10, 54, 55, 56, 10, 10, 10, 57, 10, 10,
+  58, 59, 60, 10, 61, 10, 10, 10, 62, 63, 64, 65, 66, 67, 68, 69,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  70, 71, 71, 71, 71, 71, 71, 71, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10
+};
+
+inline constexpr std::uint16_t property_stage2[2304] = {
+  0, 1, 2, 3, 4, 4, 4, 5, 1, 1, 6, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  7, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 9, 7, 10, 11, 4, 4, 4,
+  12, 13, 4, 4, 14, 7, 4, 15, 4, 4, 4, 4, 4, 16, 17, 4,
+  18, 19, 4, 7, 20, 4, 4, 4, 4, 4, 21, 15, 4, 4, 14, 22,
+  4, 23, 24, 4, 4, 25, 4, 4, 4, 26, 4, 4, 27, 7, 28, 7,
+  29, 4, 4, 30, 31, 32, 33, 4, 34, 4, 4, 35, 36, 37, 33, 38,
+  39, 4, 4, 40, 41, 19, 4, 42, 39, 4, 4, 40, 43, 4, 33, 27,
+  34, 4, 4, 44, 36, 45, 33, 4, 46, 4, 4, 47, 48, 37, 4, 4,
+  49, 4, 4, 44, 50, 51, 33, 4, 34, 4, 4, 52, 53, 51, 33, 54,
+  55, 4, 4, 56, 57, 37, 33, 4, 34, 4, 4, 4, 58, 59, 4, 60,
+  4, 4, 4, 61, 62, 4, 4, 4, 4, 4, 4, 63, 64, 4, 4, 4,
+  4, 65, 4, 66, 4, 4, 4, 67, 68, 69, 7, 70, 71, 4, 4, 4,
+  4, 4, 72, 73, 4, 74, 15, 75, 76, 77, 4, 4, 4, 4, 4, 4,
+  78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 80, 81, 81, 81, 81, 81,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 72, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 82, 4, 83, 4, 33, 4, 33, 4, 4, 4, 84, 85, 22, 4, 4,
+  86, 4, 4, 4, 4, 4, 4, 4, 51, 4, 87, 4, 4, 4, 4, 4,
+  4, 4, 88, 89, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 90, 4, 4, 4, 91, 92, 93, 4, 4, 4, 7, 94, 4, 4, 4,
+  95, 4, 4, 96, 97, 4, 14, 98, 99, 4, 100, 4, 4, 4, 101, 55,
+  4, 4, 102, 103, 4, 4, 4, 4, 4, 4, 4, 4, 4, 104, 105, 106,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7,
+  107, 4, 108, 109, 110, 4, 1, 4, 4, 4, 4, 4, 4, 7, 111, 15,
+  4, 4, 112, 110, 4, 4, 4, 4, 4, 113, 114, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 115, 116, 4, 4, 4, 4, 4, 117, 4, 4, 4, 118, 4, 119, 120,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 112, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 121, 122, 123, 4, 4, 124,
+  125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
+  141, 142, 143, 144, 145, 146, 147, 4, 4, 148, 149, 150, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 151, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  152, 153, 4, 4, 4, 154, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 155, 156,
+  4, 4, 4, 4, 4, 4, 4, 155, 4, 4, 4, 4, 4, 4, 7, 7,
+  4, 4, 27, 157, 4, 4, 4, 4, 4, 158, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 159, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 155, 160, 4, 161, 4, 4, 4, 4, 4, 156,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  162, 4, 163, 4, 4, 4, 4, 4, 164, 4, 4, 165, 166, 4, 7, 167,
+  4, 4, 168, 4, 169, 55, 78, 170, 29, 4, 4, 171, 172, 4, 173, 4,
+  4, 4, 174, 175, 176, 4, 4, 177, 4, 4, 4, 178, 19, 4, 179, 180,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 181, 4,
+  182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183,
+  184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185,
+  184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186,
+  184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182,
+  183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184,
+  185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184,
+  186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184,
+  182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183,
+  184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185,
+  184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186,
+  184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182,
+  183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184,
+  185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184,
+  186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184,
+  182, 183, 184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 186, 184, 182, 183,
+  184, 185, 184, 186, 184, 182, 183, 184, 185, 184, 187, 79, 188, 81, 81, 189,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 38, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  190, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 161, 4, 4, 4, 4, 4, 191,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 77,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 15, 4,
+  4, 4, 4, 4, 4, 4, 4, 192, 4, 4, 4, 4, 4, 4, 4, 4,
+  193, 4, 4, 194, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 51, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 195, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 196, 4, 4, 4, 4, 72,
+  4, 4, 4, 4, 21, 15, 4, 4, 197, 4, 4, 4, 4, 4, 4, 4,
+  198, 4, 4, 199, 200, 4, 4, 201, 99, 4, 4, 202, 203, 4, 4, 4,
+  204, 4, 205, 206, 207, 4, 4, 208, 99, 4, 4, 209, 210, 4, 4, 4,
+  4, 4, 211, 212, 19, 4, 4, 4, 4, 4, 4, 4, 4, 155, 213, 4,
+  55, 4, 4, 56, 214, 37, 215, 206, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 216, 217, 38, 4, 4, 4, 4, 4, 218, 219, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 155, 220, 15, 221, 4, 4,
+  4, 4, 4, 222, 15, 4, 4, 4, 4, 4, 223, 224, 4, 4, 4, 4,
+  4, 72, 225, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 211, 226, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 227, 228, 4, 4, 4, 4, 4, 4, 4, 4, 229, 230, 4,
+  231, 4, 4, 232, 37, 233, 4, 4, 234, 235, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 236, 237, 4, 4, 4, 4, 4, 238, 239, 240, 4, 4, 4, 4,
+  4, 4, 4, 241, 242, 4, 4, 4, 243, 244, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 245,
+  246, 4, 4, 247, 248, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 1, 249, 250, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 206,
+  4, 4, 4, 200, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 155, 251, 252, 252, 253, 204, 4, 4, 4, 4, 254, 164,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 255, 256, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  7, 7, 257, 7, 200, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 258, 259, 260, 4, 261, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 262, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  7, 7, 7, 263, 7, 7, 70, 173, 254, 14, 9, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  264, 265, 266, 4, 4, 4, 4, 4, 155, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 200, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 38, 4, 4, 4, 267, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 267, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 200, 4, 4,
+  4, 4, 4, 4, 268, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  269, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 271, 270, 270, 270,
+  272, 4, 273, 4, 4, 4, 274, 275, 276, 277, 272, 270, 270, 270, 278, 279,
+  280, 281, 282, 283, 284, 285, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+  286, 286, 287, 288, 286, 286, 286, 289, 290, 291, 286, 286, 292, 293, 286, 294,
+  286, 286, 286, 295, 296, 297, 298, 299, 300, 301, 302, 286, 286, 286, 286, 303,
+  286, 286, 286, 304, 305, 286, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+  286, 286, 286, 286, 316, 4, 4, 4, 286, 286, 317, 318, 319, 320, 321, 322,
+  4, 4, 4, 4, 4, 4, 4, 323, 4, 4, 4, 4, 4, 324, 325, 326,
+  274, 4, 4, 4, 327, 328, 4, 4, 327, 4, 329, 270, 270, 270, 270, 270,
+  330, 331, 332, 333, 334, 286, 286, 335, 286, 286, 286, 336, 337, 338, 286, 286,
+  270, 270, 270, 270, 270, 270, 270, 339, 340, 286, 286, 341, 342, 325, 340, 343,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+  270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+  270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+  270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 344,
+  1, 1, 345, 345, 345, 345, 345, 345, 1, 1, 1, 1, 1, 1, 1, 1,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+inline constexpr std::uint8_t property_stage3[5536] = {
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 3, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 1, 5, 0,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0,
+  0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6,
+  0, 6, 6, 0, 6, 6, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+  6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 7, 0, 6,
+  6, 6, 6, 6, 6, 0, 0, 6, 6, 0, 6, 6, 6, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+  0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 0, 6, 6, 6, 0, 6, 6, 6, 6, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0, 0, 0,
+  7, 7, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6,
+  6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 8, 6, 0, 8, 8,
+  8, 6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8, 8, 6, 8, 8,
+  0, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 6, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 6, 8,
+  8, 6, 6, 6, 6, 0, 0, 8, 8, 0, 0, 8, 8, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0,
+  0, 6, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 8, 8,
+  8, 6, 6, 0, 0, 0, 0, 6, 6, 0, 0, 6, 6, 6, 0, 0,
+  6, 6, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  8, 6, 6, 6, 6, 6, 0, 6, 6, 8, 0, 8, 8, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 6, 6,
+  0, 0, 0, 0, 0, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 8,
+  6, 8, 8, 0, 0, 0, 8, 8, 8, 0, 8, 8, 8, 6, 0, 0,
+  6, 8, 8, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 8, 8, 8, 8, 0, 6, 6, 6, 0, 6, 6, 6, 6, 0, 0,
+  0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 8, 6,
+  8, 8, 6, 8, 8, 0, 6, 8, 8, 0, 8, 8, 6, 6, 0, 0,
+  0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 6, 8,
+  8, 6, 6, 6, 6, 0, 8, 8, 8, 0, 8, 8, 8, 6, 7, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 6,
+  8, 8, 6, 6, 6, 0, 6, 0, 8, 8, 8, 8, 8, 8, 8, 6,
+  0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 6, 0, 8, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0,
+  0, 6, 0, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 6, 0, 6, 0, 6, 0, 0, 0, 0, 8, 8,
+  0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8,
+  6, 6, 6, 6, 6, 0, 6, 6, 0, 0, 0, 0, 0, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6,
+  6, 8, 6, 6, 6, 6, 6, 6, 0, 6, 6, 8, 8, 6, 6, 0,
+  0, 0, 0, 0, 0, 0, 8, 8, 6, 6, 0, 0, 0, 0, 6, 6,
+  0, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 0, 8, 6, 6, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  0, 0, 6, 6, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 8, 6, 6, 6, 6, 6, 6, 6, 8, 8,
+  8, 8, 8, 8, 8, 8, 6, 8, 8, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 1, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 8, 8, 8, 8, 6, 6, 8, 8, 8, 0, 0, 0, 0,
+  8, 8, 6, 8, 8, 8, 8, 8, 8, 6, 6, 6, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 6, 6, 8, 8, 6, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 8, 6, 8, 6, 6, 6, 6, 6, 6, 6, 0,
+  6, 0, 6, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8,
+  8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0,
+  6, 6, 6, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 8, 6, 8, 8, 8,
+  8, 8, 6, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 8, 6, 6, 6, 6, 8, 8, 6, 6, 8, 6, 6, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 6, 8, 6, 6, 8, 8, 8, 6, 8, 6,
+  0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 6, 6, 6, 6,
+  6, 6, 6, 6, 8, 8, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 8, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 6, 0, 0,
+  0, 0, 0, 0, 6, 0, 0, 8, 6, 6, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 6, 12, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 13, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 5, 5, 5,
+  14, 5, 5, 14, 0, 0, 0, 0, 5, 5, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 14, 14, 0,
+  5, 5, 5, 5, 5, 15, 0, 15, 15, 15, 15, 15, 15, 15, 5, 15,
+  15, 5, 15, 0, 14, 14, 15, 15, 5, 15, 15, 15, 15, 16, 15, 15,
+  5, 15, 5, 5, 15, 15, 5, 15, 15, 15, 5, 15, 15, 15, 5, 5,
+  15, 15, 15, 15, 15, 15, 15, 15, 5, 5, 5, 15, 15, 15, 15, 15,
+  5, 15, 5, 15, 15, 15, 15, 15, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 5,
+  5, 15, 15, 5, 15, 5, 5, 15, 5, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 5, 15, 15, 5, 14,
+  15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 15, 5, 14, 5, 5, 5, 5, 15, 5, 15, 5, 5, 15, 15, 15,
+  5, 14, 15, 15, 15, 15, 15, 5, 15, 15, 14, 14, 15, 15, 15, 15,
+  5, 5, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 15,
+  15, 15, 15, 15, 14, 14, 15, 15, 5, 15, 15, 15, 15, 15, 14, 5,
+  15, 5, 15, 5, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 5, 14, 15, 15, 15, 15, 15,
+  5, 5, 14, 14, 5, 14, 15, 5, 5, 16, 14, 15, 15, 14, 15, 15,
+  15, 15, 5, 15, 15, 14, 0, 0, 5, 5, 17, 17, 16, 16, 15, 5,
+  15, 15, 5, 0, 5, 0, 5, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 5, 0, 0, 0, 0, 14, 0, 14, 0,
+  0, 0, 0, 14, 14, 14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+  0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0, 0,
+  14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+  6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6,
+  0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 0, 6, 0, 0, 0, 0,
+  0, 0, 0, 8, 8, 6, 6, 8, 0, 0, 0, 0, 6, 0, 0, 0,
+  8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+  0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0,
+  0, 0, 0, 6, 8, 8, 6, 6, 6, 6, 8, 8, 6, 6, 8, 8,
+  8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 8,
+  8, 6, 6, 8, 8, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 6, 8, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0,
+  6, 0, 6, 6, 6, 0, 0, 6, 6, 0, 0, 0, 0, 0, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 6, 6, 8, 8,
+  0, 0, 0, 0, 0, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 8, 8, 6, 8, 8, 6, 8, 8, 0, 8, 6, 0, 0,
+  18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+  19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 19, 19, 19,
+  19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+  19, 19, 19, 19, 19, 19, 19, 19, 18, 19, 19, 19, 19, 19, 19, 19,
+  19, 19, 19, 19, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+  19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 13,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+  0, 6, 6, 6, 0, 6, 6, 0, 0, 0, 0, 0, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0, 0, 0, 6,
+  0, 0, 0, 0, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0,
+  0, 0, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  8, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+  8, 8, 8, 6, 6, 6, 6, 8, 8, 6, 6, 0, 0, 7, 0, 0,
+  0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+  6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 8, 6, 6, 6,
+  6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8,
+  8, 0, 7, 7, 0, 0, 0, 0, 0, 6, 6, 6, 6, 0, 8, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 6,
+  6, 6, 8, 8, 6, 8, 6, 6, 0, 0, 0, 0, 0, 0, 6, 0,
+  8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+  6, 8, 8, 8, 8, 0, 0, 8, 8, 0, 0, 8, 8, 8, 0, 0,
+  0, 0, 8, 8, 0, 0, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0,
+  0, 0, 0, 0, 0, 8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6,
+  8, 8, 6, 6, 6, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 8, 8, 6, 6, 6, 6, 6, 6, 8, 6, 8, 8, 6, 8, 6,
+  6, 8, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  8, 8, 6, 6, 6, 6, 0, 0, 8, 8, 8, 8, 6, 6, 8, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0,
+  8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 6, 8, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 8, 6, 8, 8,
+  6, 6, 6, 6, 6, 6, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 6, 6, 6, 8, 6, 6, 6, 6, 6, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 6, 6, 6, 8, 6, 6, 0, 0, 0, 0, 0,
+  6, 8, 8, 8, 8, 8, 0, 8, 8, 0, 0, 6, 6, 8, 6, 7,
+  8, 7, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 8, 8, 8, 6, 6, 6, 6, 0, 0, 6, 6, 8, 8, 8, 8,
+  6, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 6, 6, 6, 8, 7, 6, 6, 6, 6, 0,
+  0, 6, 6, 6, 6, 6, 6, 8, 8, 6, 6, 6, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 8, 6, 6, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+  6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 8, 6,
+  0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 0, 8, 6, 6, 6, 6, 6, 6,
+  6, 8, 6, 6, 8, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 6, 6, 6, 6, 6, 6, 0, 0, 0, 6, 0, 6, 6, 0, 6,
+  6, 6, 6, 6, 6, 6, 7, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 0,
+  6, 6, 0, 8, 8, 6, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 8, 8, 6, 6, 6, 6, 6, 0, 0, 0, 8, 8,
+  6, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 6,
+  0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0,
+  1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0,
+  0, 0, 0, 0, 0, 6, 8, 6, 6, 6, 0, 0, 0, 8, 6, 6,
+  6, 6, 6, 1, 1, 1, 1, 1, 1, 1, 1, 6, 6, 6, 6, 6,
+  6, 6, 6, 0, 0, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 0, 0,
+  0, 0, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 6, 6, 6, 6, 6,
+  6, 6, 0, 6, 6, 0, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+  15, 15, 15, 15, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15,
+  5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+  0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0,
+  15, 15, 15, 15, 15, 15, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  0, 14, 5, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+  0, 0, 14, 14, 14, 14, 14, 5, 14, 14, 14, 0, 15, 15, 15, 15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15,
+  14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 5, 15, 15, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5, 14, 14,
+  14, 14, 14, 14, 14, 17, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 15, 15, 5, 5, 15, 5, 5, 5, 15, 15, 5, 5,
+  14, 14, 17, 17, 17, 14, 14, 17, 14, 14, 17, 16, 16, 5, 5, 14,
+  14, 14, 14, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  14, 15, 15, 5, 14, 5, 15, 5, 14, 14, 14, 21, 21, 21, 21, 21,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5,
+  14, 5, 17, 17, 14, 14, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+  17, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+  17, 17, 17, 17, 17, 17, 17, 17, 17, 14, 14, 14, 17, 14, 14, 14,
+  14, 17, 17, 17, 14, 17, 17, 17, 14, 14, 14, 14, 14, 14, 14, 17,
+  14, 17, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 17, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5, 15, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 15, 15, 5, 5, 14, 14, 14, 14, 15,
+  14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 5,
+  5, 15, 15, 5, 16, 16, 5, 5, 5, 5, 17, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 5, 15, 15, 5, 5, 5, 5, 15, 15,
+  16, 15, 15, 15, 15, 17, 17, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 14, 5, 15, 15, 5, 15, 15, 15, 15, 15, 15, 15,
+  15, 5, 5, 15, 15, 15, 15, 15, 15, 15, 15, 15, 5, 15, 15, 15,
+  15, 15, 5, 5, 5, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 5, 5, 5, 15, 15, 15, 15, 15, 15, 15, 15, 5, 5, 5, 15,
+  15, 5, 15, 5, 15, 15, 15, 15, 5, 15, 15, 15, 15, 15, 15, 5,
+  15, 15, 15, 5, 15, 15, 15, 15, 15, 15, 5, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 17, 17, 17, 14, 14, 14, 17, 17, 17, 17, 17,
+  14, 14, 14, 17, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 17, 17, 17, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  17, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 5, 17, 5, 5, 5,
+  14, 14, 14, 15, 15, 14, 14, 14, 15, 15, 15, 15, 14, 14, 14, 14,
+  5, 5, 5, 5, 5, 5, 15, 15, 15, 5, 15, 14, 14, 15, 15, 15,
+  5, 15, 15, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15,
+  0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15,
+  14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 14, 14, 17,
+  14, 14, 14, 14, 14, 14, 14, 14, 17, 17, 17, 17, 17, 17, 17, 17,
+  14, 14, 14, 14, 14, 14, 17, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 14, 0, 17, 17, 17, 14,
+  14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 17, 14, 14, 14, 14, 14, 14, 14, 14,
+  22, 22, 22, 22, 14, 17, 17, 14, 17, 17, 14, 17, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 17, 17, 17,
+  14, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 14,
+  14, 14, 14, 17, 17, 17, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14,
+  17, 17, 17, 17, 17, 17, 17, 17, 17, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13
+};
+
+// Usable at compile time, the tables are constant initialized read-only
+// data so there is nothing to construct at startup
+constexpr const property_entry& lookup_property(std::uint32_t cp) {
+  if (cp > 0x10FFFFu)
+    return property_entries[0];
+
+  const std::uint32_t middle = property_stage1[cp >> 9u];
+  const std::uint32_t low = property_stage2[
+      (middle << 5u) | ((cp >> 4u) & 31u)];
+  return property_entries[
+      property_stage3[(low << 4u) | (cp & 15u)]];
+}
+
+} // namespace detail
+} // namespace auc
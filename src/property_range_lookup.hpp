@@ -0,0 +1,2224 @@
+// NOTE: This file was autogenerated via scripts/gen_property_lookup.py
+#include <auc/property.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// https://www.unicode.org/Public/15.0.0/ucd/auxiliary/GraphemeBreakProperty.txt
+// https://www.unicode.org/Public/15.0.0/ucd/emoji/emoji-data.txt
+namespace auc {
+namespace detail {
+
+struct property_entry {
+  property::type break_prop_;
+  // Bit N is set for property::type::Emoji + N
+  std::uint8_t emoji_props_;
+};
+
+inline constexpr property_entry property_entries[23] = {
+  {property::type::Other, 0u},
+  {property::type::Control, 0u},
+  {property::type::LF, 0u},
+  {property::type::CR, 0u},
+  {property::type::Other, 17u},
+  {property::type::Other, 33u},
+  {property::type::Extend, 0u},
+  {property::type::Prepend, 0u},
+  {property::type::SpacingMark, 0u},
+  {property::type::L, 0u},
+  {property::type::V, 0u},
+  {property::type::T, 0u},
+  {property::type::ZWJ, 16u},
+  {property::type::Extend, 16u},
+  {property::type::Other, 35u},
+  {property::type::Other, 32u},
+  {property::type::Other, 41u},
+  {property::type::Other, 43u},
+  {property::type::LV, 0u},
+  {property::type::LVT, 0u},
+  {property::type::RI, 19u},
+  {property::type::Extend, 23u},
+  {property::type::Other, 51u}
+};
+
+// Each range runs up to the start of the next one
+struct property_range {
+  std::uint32_t start_ : 24;
+  std::uint32_t entry_ : 8;
+};
+static_assert(sizeof(property_range) == 4u);
+
+inline constexpr property_range property_ranges[2149] = {
+  {0x0u, 1u},
+  {0xAu, 2u},
+  {0xBu, 1u},
+  {0xDu, 3u},
+  {0xEu, 1u},
+  {0x20u, 0u},
+  {0x2Au, 4u},
+  {0x2Bu, 0u},
+  {0x30u, 4u},
+  {0x3Au, 0u},
+  {0x7Fu, 1u},
+  {0xA0u, 0u},
+  {0xA9u, 5u},
+  {0xAAu, 0u},
+  {0xADu, 1u},
+  {0xAEu, 5u},
+  {0xAFu, 0u},
+  {0x300u, 6u},
+  {0x370u, 0u},
+  {0x483u, 6u},
+  {0x48Au, 0u},
+  {0x591u, 6u},
+  {0x5BEu, 0u},
+  {0x5BFu, 6u},
+  {0x5C0u, 0u},
+  {0x5C1u, 6u},
+  {0x5C3u, 0u},
+  {0x5C4u, 6u},
+  {0x5C6u, 0u},
+  {0x5C7u, 6u},
+  {0x5C8u, 0u},
+  {0x600u, 7u},
+  {0x606u, 0u},
+  {0x610u, 6u},
+  {0x61Bu, 0u},
+  {0x61Cu, 1u},
+  {0x61Du, 0u},
+  {0x64Bu, 6u},
+  {0x660u, 0u},
+  {0x670u, 6u},
+  {0x671u, 0u},
+  {0x6D6u, 6u},
+  {0x6DDu, 7u},
+  {0x6DEu, 0u},
+  {0x6DFu, 6u},
+  {0x6E5u, 0u},
+  {0x6E7u, 6u},
+  {0x6E9u, 0u},
+  {0x6EAu, 6u},
+  {0x6EEu, 0u},
+  {0x70Fu, 7u},
+  {0x710u, 0u},
+  {0x711u, 6u},
+  {0x712u, 0u},
+  {0x730u, 6u},
+  {0x74Bu, 0u},
+  {0x7A6u, 6u},
+  {0x7B1u, 0u},
+  {0x7EBu, 6u},
+  {0x7F4u, 0u},
+  {0x7FDu, 6u},
+  {0x7FEu, 0u},
+  {0x816u, 6u},
+  {0x81Au, 0u},
+  {0x81Bu, 6u},
+  {0x824u, 0u},
+  {0x825u, 6u},
+  {0x828u, 0u},
+  {0x829u, 6u},
+  {0x82Eu, 0u},
+  {0x859u, 6u},
+  {0x85Cu, 0u},
+  {0x890u, 7u},
+  {0x892u, 0u},
+  {0x898u, 6u},
+  {0x8A0u, 0u},
+  {0x8CAu, 6u},
+  {0x8E2u, 7u},
+  {0x8E3u, 6u},
+  {0x903u, 8u},
+  {0x904u, 0u},
+  {0x93Au, 6u},
+  {0x93Bu, 8u},
+  {0x93Cu, 6u},
+  {0x93Du, 0u},
+  {0x93Eu, 8u},
+  {0x941u, 6u},
+  {0x949u, 8u},
+  {0x94Du, 6u},
+  {0x94Eu, 8u},
+  {0x950u, 0u},
+  {0x951u, 6u},
+  {0x958u, 0u},
+  {0x962u, 6u},
+  {0x964u, 0u},
+  {0x981u, 6u},
+  {0x982u, 8u},
+  {0x984u, 0u},
+  {0x9BCu, 6u},
+  {0x9BDu, 0u},
+  {0x9BEu, 6u},
+  {0x9BFu, 8u},
+  {0x9C1u, 6u},
+  {0x9C5u, 0u},
+  {0x9C7u, 8u},
+  {0x9C9u, 0u},
+  {0x9CBu, 8u},
+  {0x9CDu, 6u},
+  {0x9CEu, 0u},
+  {0x9D7u, 6u},
+  {0x9D8u, 0u},
+  {0x9E2u, 6u},
+  {0x9E4u, 0u},
+  {0x9FEu, 6u},
+  {0x9FFu, 0u},
+  {0xA01u, 6u},
+  {0xA03u, 8u},
+  {0xA04u, 0u},
+  {0xA3Cu, 6u},
+  {0xA3Du, 0u},
+  {0xA3Eu, 8u},
+  {0xA41u, 6u},
+  {0xA43u, 0u},
+  {0xA47u, 6u},
+  {0xA49u, 0u},
+  {0xA4Bu, 6u},
+  {0xA4Eu, 0u},
+  {0xA51u, 6u},
+  {0xA52u, 0u},
+  {0xA70u, 6u},
+  {0xA72u, 0u},
+  {0xA75u, 6u},
+  {0xA76u, 0u},
+  {0xA81u, 6u},
+  {0xA83u, 8u},
+  {0xA84u, 0u},
+  {0xABCu, 6u},
+  {0xABDu, 0u},
+  {0xABEu, 8u},
+  {0xAC1u, 6u},
+  {0xAC6u, 0u},
+  {0xAC7u, 6u},
+  {0xAC9u, 8u},
+  {0xACAu, 0u},
+  {0xACBu, 8u},
+  {0xACDu, 6u},
+  {0xACEu, 0u},
+  {0xAE2u, 6u},
+  {0xAE4u, 0u},
+  {0xAFAu, 6u},
+  {0xB00u, 0u},
+  {0xB01u, 6u},
+  {0xB02u, 8u},
+  {0xB04u, 0u},
+  {0xB3Cu, 6u},
+  {0xB3Du, 0u},
+  {0xB3Eu, 6u},
+  {0xB40u, 8u},
+  {0xB41u, 6u},
+  {0xB45u, 0u},
+  {0xB47u, 8u},
+  {0xB49u, 0u},
+  {0xB4Bu, 8u},
+  {0xB4Du, 6u},
+  {0xB4Eu, 0u},
+  {0xB55u, 6u},
+  {0xB58u, 0u},
+  {0xB62u, 6u},
+  {0xB64u, 0u},
+  {0xB82u, 6u},
+  {0xB83u, 0u},
+  {0xBBEu, 6u},
+  {0xBBFu, 8u},
+  {0xBC0u, 6u},
+  {0xBC1u, 8u},
+  {0xBC3u, 0u},
+  {0xBC6u, 8u},
+  {0xBC9u, 0u},
+  {0xBCAu, 8u},
+  {0xBCDu, 6u},
+  {0xBCEu, 0u},
+  {0xBD7u, 6u},
+  {0xBD8u, 0u},
+  {0xC00u, 6u},
+  {0xC01u, 8u},
+  {0xC04u, 6u},
+  {0xC05u, 0u},
+  {0xC3Cu, 6u},
+  {0xC3Du, 0u},
+  {0xC3Eu, 6u},
+  {0xC41u, 8u},
+  {0xC45u, 0u},
+  {0xC46u, 6u},
+  {0xC49u, 0u},
+  {0xC4Au, 6u},
+  {0xC4Eu, 0u},
+  {0xC55u, 6u},
+  {0xC57u, 0u},
+  {0xC62u, 6u},
+  {0xC64u, 0u},
+  {0xC81u, 6u},
+  {0xC82u, 8u},
+  {0xC84u, 0u},
+  {0xCBCu, 6u},
+  {0xCBDu, 0u},
+  {0xCBEu, 8u},
+  {0xCBFu, 6u},
+  {0xCC0u, 8u},
+  {0xCC2u, 6u},
+  {0xCC3u, 8u},
+  {0xCC5u, 0u},
+  {0xCC6u, 6u},
+  {0xCC7u, 8u},
+  {0xCC9u, 0u},
+  {0xCCAu, 8u},
+  {0xCCCu, 6u},
+  {0xCCEu, 0u},
+  {0xCD5u, 6u},
+  {0xCD7u, 0u},
+  {0xCE2u, 6u},
+  {0xCE4u, 0u},
+  {0xCF3u, 8u},
+  {0xCF4u, 0u},
+  {0xD00u, 6u},
+  {0xD02u, 8u},
+  {0xD04u, 0u},
+  {0xD3Bu, 6u},
+  {0xD3Du, 0u},
+  {0xD3Eu, 6u},
+  {0xD3Fu, 8u},
+  {0xD41u, 6u},
+  {0xD45u, 0u},
+  {0xD46u, 8u},
+  {0xD49u, 0u},
+  {0xD4Au, 8u},
+  {0xD4Du, 6u},
+  {0xD4Eu, 7u},
+  {0xD4Fu, 0u},
+  {0xD57u, 6u},
+  {0xD58u, 0u},
+  {0xD62u, 6u},
+  {0xD64u, 0u},
+  {0xD81u, 6u},
+  {0xD82u, 8u},
+  {0xD84u, 0u},
+  {0xDCAu, 6u},
+  {0xDCBu, 0u},
+  {0xDCFu, 6u},
+  {0xDD0u, 8u},
+  {0xDD2u, 6u},
+  {0xDD5u, 0u},
+  {0xDD6u, 6u},
+  {0xDD7u, 0u},
+  {0xDD8u, 8u},
+  {0xDDFu, 6u},
+  {0xDE0u, 0u},
+  {0xDF2u, 8u},
+  {0xDF4u, 0u},
+  {0xE31u, 6u},
+  {0xE32u, 0u},
+  {0xE33u, 8u},
+  {0xE34u, 6u},
+  {0xE3Bu, 0u},
+  {0xE47u, 6u},
+  {0xE4Fu, 0u},
+  {0xEB1u, 6u},
+  {0xEB2u, 0u},
+  {0xEB3u, 8u},
+  {0xEB4u, 6u},
+  {0xEBDu, 0u},
+  {0xEC8u, 6u},
+  {0xECFu, 0u},
+  {0xF18u, 6u},
+  {0xF1Au, 0u},
+  {0xF35u, 6u},
+  {0xF36u, 0u},
+  {0xF37u, 6u},
+  {0xF38u, 0u},
+  {0xF39u, 6u},
+  {0xF3Au, 0u},
+  {0xF3Eu, 8u},
+  {0xF40u, 0u},
+  {0xF71u, 6u},
+  {0xF7Fu, 8u},
+  {0xF80u, 6u},
+  {0xF85u, 0u},
+  {0xF86u, 6u},
+  {0xF88u, 0u},
+  {0xF8Du, 6u},
+  {0xF98u, 0u},
+  {0xF99u, 6u},
+  {0xFBDu, 0u},
+  {0xFC6u, 6u},
+  {0xFC7u, 0u},
+  {0x102Du, 6u},
+  {0x1031u, 8u},
+  {0x1032u, 6u},
+  {0x1038u, 0u},
+  {0x1039u, 6u},
+  {0x103Bu, 8u},
+  {0x103Du, 6u},
+  {0x103Fu, 0u},
+  {0x1056u, 8u},
+  {0x1058u, 6u},
+  {0x105Au, 0u},
+  {0x105Eu, 6u},
+  {0x1061u, 0u},
+  {0x1071u, 6u},
+  {0x1075u, 0u},
+  {0x1082u, 6u},
+  {0x1083u, 0u},
+  {0x1084u, 8u},
+  {0x1085u, 6u},
+  {0x1087u, 0u},
+  {0x108Du, 6u},
+  {0x108Eu, 0u},
+  {0x109Du, 6u},
+  {0x109Eu, 0u},
+  {0x1100u, 9u},
+  {0x1160u, 10u},
+  {0x11A8u, 11u},
+  {0x1200u, 0u},
+  {0x135Du, 6u},
+  {0x1360u, 0u},
+  {0x1712u, 6u},
+  {0x1715u, 8u},
+  {0x1716u, 0u},
+  {0x1732u, 6u},
+  {0x1734u, 8u},
+  {0x1735u, 0u},
+  {0x1752u, 6u},
+  {0x1754u, 0u},
+  {0x1772u, 6u},
+  {0x1774u, 0u},
+  {0x17B4u, 6u},
+  {0x17B6u, 8u},
+  {0x17B7u, 6u},
+  {0x17BEu, 8u},
+  {0x17C6u, 6u},
+  {0x17C7u, 8u},
+  {0x17C9u, 6u},
+  {0x17D4u, 0u},
+  {0x17DDu, 6u},
+  {0x17DEu, 0u},
+  {0x180Bu, 6u},
+  {0x180Eu, 1u},
+  {0x180Fu, 6u},
+  {0x1810u, 0u},
+  {0x1885u, 6u},
+  {0x1887u, 0u},
+  {0x18A9u, 6u},
+  {0x18AAu, 0u},
+  {0x1920u, 6u},
+  {0x1923u, 8u},
+  {0x1927u, 6u},
+  {0x1929u, 8u},
+  {0x192Cu, 0u},
+  {0x1930u, 8u},
+  {0x1932u, 6u},
+  {0x1933u, 8u},
+  {0x1939u, 6u},
+  {0x193Cu, 0u},
+  {0x1A17u, 6u},
+  {0x1A19u, 8u},
+  {0x1A1Bu, 6u},
+  {0x1A1Cu, 0u},
+  {0x1A55u, 8u},
+  {0x1A56u, 6u},
+  {0x1A57u, 8u},
+  {0x1A58u, 6u},
+  {0x1A5Fu, 0u},
+  {0x1A60u, 6u},
+  {0x1A61u, 0u},
+  {0x1A62u, 6u},
+  {0x1A63u, 0u},
+  {0x1A65u, 6u},
+  {0x1A6Du, 8u},
+  {0x1A73u, 6u},
+  {0x1A7Du, 0u},
+  {0x1A7Fu, 6u},
+  {0x1A80u, 0u},
+  {0x1AB0u, 6u},
+  {0x1ACFu, 0u},
+  {0x1B00u, 6u},
+  {0x1B04u, 8u},
+  {0x1B05u, 0u},
+  {0x1B34u, 6u},
+  {0x1B3Bu, 8u},
+  {0x1B3Cu, 6u},
+  {0x1B3Du, 8u},
+  {0x1B42u, 6u},
+  {0x1B43u, 8u},
+  {0x1B45u, 0u},
+  {0x1B6Bu, 6u},
+  {0x1B74u, 0u},
+  {0x1B80u, 6u},
+  {0x1B82u, 8u},
+  {0x1B83u, 0u},
+  {0x1BA1u, 8u},
+  {0x1BA2u, 6u},
+  {0x1BA6u, 8u},
+  {0x1BA8u, 6u},
+  {0x1BAAu, 8u},
+  {0x1BABu, 6u},
+  {0x1BAEu, 0u},
+  {0x1BE6u, 6u},
+  {0x1BE7u, 8u},
+  {0x1BE8u, 6u},
+  {0x1BEAu, 8u},
+  {0x1BEDu, 6u},
+  {0x1BEEu, 8u},
+  {0x1BEFu, 6u},
+  {0x1BF2u, 8u},
+  {0x1BF4u, 0u},
+  {0x1C24u, 8u},
+  {0x1C2Cu, 6u},
+  {0x1C34u, 8u},
+  {0x1C36u, 6u},
+  {0x1C38u, 0u},
+  {0x1CD0u, 6u},
+  {0x1CD3u, 0u},
+  {0x1CD4u, 6u},
+  {0x1CE1u, 8u},
+  {0x1CE2u, 6u},
+  {0x1CE9u, 0u},
+  {0x1CEDu, 6u},
+  {0x1CEEu, 0u},
+  {0x1CF4u, 6u},
+  {0x1CF5u, 0u},
+  {0x1CF7u, 8u},
+  {0x1CF8u, 6u},
+  {0x1CFAu, 0u},
+  {0x1DC0u, 6u},
+  {0x1E00u, 0u},
+  {0x200Bu, 1u},
+  {0x200Cu, 6u},
+  {0x200Du, 12u},
+  {0x200Eu, 1u},
+  {0x2010u, 0u},
+  {0x2028u, 1u},
+  {0x202Fu, 0u},
+  {0x203Cu, 5u},
+  {0x203Du, 0u},
+  {0x2049u, 5u},
+  {0x204Au, 0u},
+  {0x2060u, 1u},
+  {0x2070u, 0u},
+  {0x20D0u, 6u},
+  {0x20E3u, 13u},
+  {0x20E4u, 6u},
+  {0x20F1u, 0u},
+  {0x2122u, 5u},
+  {0x2123u, 0u},
+  {0x2139u, 5u},
+  {0x213Au, 0u},
+  {0x2194u, 5u},
+  {0x219Au, 0u},
+  {0x21A9u, 5u},
+  {0x21ABu, 0u},
+  {0x231Au, 14u},
+  {0x231Cu, 0u},
+  {0x2328u, 5u},
+  {0x2329u, 0u},
+  {0x2388u, 15u},
+  {0x2389u, 0u},
+  {0x23CFu, 5u},
+  {0x23D0u, 0u},
+  {0x23E9u, 14u},
+  {0x23EDu, 5u},
+  {0x23F0u, 14u},
+  {0x23F1u, 5u},
+  {0x23F3u, 14u},
+  {0x23F4u, 0u},
+  {0x23F8u, 5u},
+  {0x23FBu, 0u},
+  {0x24C2u, 5u},
+  {0x24C3u, 0u},
+  {0x25AAu, 5u},
+  {0x25ACu, 0u},
+  {0x25B6u, 5u},
+  {0x25B7u, 0u},
+  {0x25C0u, 5u},
+  {0x25C1u, 0u},
+  {0x25FBu, 5u},
+  {0x25FDu, 14u},
+  {0x25FFu, 0u},
+  {0x2600u, 5u},
+  {0x2605u, 15u},
+  {0x2606u, 0u},
+  {0x2607u, 15u},
+  {0x260Eu, 5u},
+  {0x260Fu, 15u},
+  {0x2611u, 5u},
+  {0x2612u, 15u},
+  {0x2613u, 0u},
+  {0x2614u, 14u},
+  {0x2616u, 15u},
+  {0x2618u, 5u},
+  {0x2619u, 15u},
+  {0x261Du, 16u},
+  {0x261Eu, 15u},
+  {0x2620u, 5u},
+  {0x2621u, 15u},
+  {0x2622u, 5u},
+  {0x2624u, 15u},
+  {0x2626u, 5u},
+  {0x2627u, 15u},
+  {0x262Au, 5u},
+  {0x262Bu, 15u},
+  {0x262Eu, 5u},
+  {0x2630u, 15u},
+  {0x2638u, 5u},
+  {0x263Bu, 15u},
+  {0x2640u, 5u},
+  {0x2641u, 15u},
+  {0x2642u, 5u},
+  {0x2643u, 15u},
+  {0x2648u, 14u},
+  {0x2654u, 15u},
+  {0x265Fu, 5u},
+  {0x2661u, 15u},
+  {0x2663u, 5u},
+  {0x2664u, 15u},
+  {0x2665u, 5u},
+  {0x2667u, 15u},
+  {0x2668u, 5u},
+  {0x2669u, 15u},
+  {0x267Bu, 5u},
+  {0x267Cu, 15u},
+  {0x267Eu, 5u},
+  {0x267Fu, 14u},
+  {0x2680u, 15u},
+  {0x2686u, 0u},
+  {0x2690u, 15u},
+  {0x2692u, 5u},
+  {0x2693u, 14u},
+  {0x2694u, 5u},
+  {0x2698u, 15u},
+  {0x2699u, 5u},
+  {0x269Au, 15u},
+  {0x269Bu, 5u},
+  {0x269Du, 15u},
+  {0x26A0u, 5u},
+  {0x26A1u, 14u},
+  {0x26A2u, 15u},
+  {0x26A7u, 5u},
+  {0x26A8u, 15u},
+  {0x26AAu, 14u},
+  {0x26ACu, 15u},
+  {0x26B0u, 5u},
+  {0x26B2u, 15u},
+  {0x26BDu, 14u},
+  {0x26BFu, 15u},
+  {0x26C4u, 14u},
+  {0x26C6u, 15u},
+  {0x26C8u, 5u},
+  {0x26C9u, 15u},
+  {0x26CEu, 14u},
+  {0x26CFu, 5u},
+  {0x26D0u, 15u},
+  {0x26D1u, 5u},
+  {0x26D2u, 15u},
+  {0x26D3u, 5u},
+  {0x26D4u, 14u},
+  {0x26D5u, 15u},
+  {0x26E9u, 5u},
+  {0x26EAu, 14u},
+  {0x26EBu, 15u},
+  {0x26F0u, 5u},
+  {0x26F2u, 14u},
+  {0x26F4u, 5u},
+  {0x26F5u, 14u},
+  {0x26F6u, 15u},
+  {0x26F7u, 5u},
+  {0x26F9u, 16u},
+  {0x26FAu, 14u},
+  {0x26FBu, 15u},
+  {0x26FDu, 14u},
+  {0x26FEu, 15u},
+  {0x2702u, 5u},
+  {0x2703u, 15u},
+  {0x2705u, 14u},
+  {0x2706u, 0u},
+  {0x2708u, 5u},
+  {0x270Au, 17u},
+  {0x270Cu, 16u},
+  {0x270Eu, 15u},
+  {0x270Fu, 5u},
+  {0x2710u, 15u},
+  {0x2712u, 5u},
+  {0x2713u, 0u},
+  {0x2714u, 5u},
+  {0x2715u, 0u},
+  {0x2716u, 5u},
+  {0x2717u, 0u},
+  {0x271Du, 5u},
+  {0x271Eu, 0u},
+  {0x2721u, 5u},
+  {0x2722u, 0u},
+  {0x2728u, 14u},
+  {0x2729u, 0u},
+  {0x2733u, 5u},
+  {0x2735u, 0u},
+  {0x2744u, 5u},
+  {0x2745u, 0u},
+  {0x2747u, 5u},
+  {0x2748u, 0u},
+  {0x274Cu, 14u},
+  {0x274Du, 0u},
+  {0x274Eu, 14u},
+  {0x274Fu, 0u},
+  {0x2753u, 14u},
+  {0x2756u, 0u},
+  {0x2757u, 14u},
+  {0x2758u, 0u},
+  {0x2763u, 5u},
+  {0x2765u, 15u},
+  {0x2768u, 0u},
+  {0x2795u, 14u},
+  {0x2798u, 0u},
+  {0x27A1u, 5u},
+  {0x27A2u, 0u},
+  {0x27B0u, 14u},
+  {0x27B1u, 0u},
+  {0x27BFu, 14u},
+  {0x27C0u, 0u},
+  {0x2934u, 5u},
+  {0x2936u, 0u},
+  {0x2B05u, 5u},
+  {0x2B08u, 0u},
+  {0x2B1Bu, 14u},
+  {0x2B1Du, 0u},
+  {0x2B50u, 14u},
+  {0x2B51u, 0u},
+  {0x2B55u, 14u},
+  {0x2B56u, 0u},
+  {0x2CEFu, 6u},
+  {0x2CF2u, 0u},
+  {0x2D7Fu, 6u},
+  {0x2D80u, 0u},
+  {0x2DE0u, 6u},
+  {0x2E00u, 0u},
+  {0x302Au, 6u},
+  {0x3030u, 5u},
+  {0x3031u, 0u},
+  {0x303Du, 5u},
+  {0x303Eu, 0u},
+  {0x3099u, 6u},
+  {0x309Bu, 0u},
+  {0x3297u, 5u},
+  {0x3298u, 0u},
+  {0x3299u, 5u},
+  {0x329Au, 0u},
+  {0xA66Fu, 6u},
+  {0xA673u, 0u},
+  {0xA674u, 6u},
+  {0xA67Eu, 0u},
+  {0xA69Eu, 6u},
+  {0xA6A0u, 0u},
+  {0xA6F0u, 6u},
+  {0xA6F2u, 0u},
+  {0xA802u, 6u},
+  {0xA803u, 0u},
+  {0xA806u, 6u},
+  {0xA807u, 0u},
+  {0xA80Bu, 6u},
+  {0xA80Cu, 0u},
+  {0xA823u, 8u},
+  {0xA825u, 6u},
+  {0xA827u, 8u},
+  {0xA828u, 0u},
+  {0xA82Cu, 6u},
+  {0xA82Du, 0u},
+  {0xA880u, 8u},
+  {0xA882u, 0u},
+  {0xA8B4u, 8u},
+  {0xA8C4u, 6u},
+  {0xA8C6u, 0u},
+  {0xA8E0u, 6u},
+  {0xA8F2u, 0u},
+  {0xA8FFu, 6u},
+  {0xA900u, 0u},
+  {0xA926u, 6u},
+  {0xA92Eu, 0u},
+  {0xA947u, 6u},
+  {0xA952u, 8u},
+  {0xA954u, 0u},
+  {0xA960u, 9u},
+  {0xA97Du, 0u},
+  {0xA980u, 6u},
+  {0xA983u, 8u},
+  {0xA984u, 0u},
+  {0xA9B3u, 6u},
+  {0xA9B4u, 8u},
+  {0xA9B6u, 6u},
+  {0xA9BAu, 8u},
+  {0xA9BCu, 6u},
+  {0xA9BEu, 8u},
+  {0xA9C1u, 0u},
+  {0xA9E5u, 6u},
+  {0xA9E6u, 0u},
+  {0xAA29u, 6u},
+  {0xAA2Fu, 8u},
+  {0xAA31u, 6u},
+  {0xAA33u, 8u},
+  {0xAA35u, 6u},
+  {0xAA37u, 0u},
+  {0xAA43u, 6u},
+  {0xAA44u, 0u},
+  {0xAA4Cu, 6u},
+  {0xAA4Du, 8u},
+  {0xAA4Eu, 0u},
+  {0xAA7Cu, 6u},
+  {0xAA7Du, 0u},
+  {0xAAB0u, 6u},
+  {0xAAB1u, 0u},
+  {0xAAB2u, 6u},
+  {0xAAB5u, 0u},
+  {0xAAB7u, 6u},
+  {0xAAB9u, 0u},
+  {0xAABEu, 6u},
+  {0xAAC0u, 0u},
+  {0xAAC1u, 6u},
+  {0xAAC2u, 0u},
+  {0xAAEBu, 8u},
+  {0xAAECu, 6u},
+  {0xAAEEu, 8u},
+  {0xAAF0u, 0u},
+  {0xAAF5u, 8u},
+  {0xAAF6u, 6u},
+  {0xAAF7u, 0u},
+  {0xABE3u, 8u},
+  {0xABE5u, 6u},
+  {0xABE6u, 8u},
+  {0xABE8u, 6u},
+  {0xABE9u, 8u},
+  {0xABEBu, 0u},
+  {0xABECu, 8u},
+  {0xABEDu, 6u},
+  {0xABEEu, 0u},
+  {0xAC00u, 18u},
+  {0xAC01u, 19u},
+  {0xAC1Cu, 18u},
+  {0xAC1Du, 19u},
+  {0xAC38u, 18u},
+  {0xAC39u, 19u},
+  {0xAC54u, 18u},
+  {0xAC55u, 19u},
+  {0xAC70u, 18u},
+  {0xAC71u, 19u},
+  {0xAC8Cu, 18u},
+  {0xAC8Du, 19u},
+  {0xACA8u, 18u},
+  {0xACA9u, 19u},
+  {0xACC4u, 18u},
+  {0xACC5u, 19u},
+  {0xACE0u, 18u},
+  {0xACE1u, 19u},
+  {0xACFCu, 18u},
+  {0xACFDu, 19u},
+  {0xAD18u, 18u},
+  {0xAD19u, 19u},
+  {0xAD34u, 18u},
+  {0xAD35u, 19u},
+  {0xAD50u, 18u},
+  {0xAD51u, 19u},
+  {0xAD6Cu, 18u},
+  {0xAD6Du, 19u},
+  {0xAD88u, 18u},
+  {0xAD89u, 19u},
+  {0xADA4u, 18u},
+  {0xADA5u, 19u},
+  {0xADC0u, 18u},
+  {0xADC1u, 19u},
+  {0xADDCu, 18u},
+  {0xADDDu, 19u},
+  {0xADF8u, 18u},
+  {0xADF9u, 19u},
+  {0xAE14u, 18u},
+  {0xAE15u, 19u},
+  {0xAE30u, 18u},
+  {0xAE31u, 19u},
+  {0xAE4Cu, 18u},
+  {0xAE4Du, 19u},
+  {0xAE68u, 18u},
+  {0xAE69u, 19u},
+  {0xAE84u, 18u},
+  {0xAE85u, 19u},
+  {0xAEA0u, 18u},
+  {0xAEA1u, 19u},
+  {0xAEBCu, 18u},
+  {0xAEBDu, 19u},
+  {0xAED8u, 18u},
+  {0xAED9u, 19u},
+  {0xAEF4u, 18u},
+  {0xAEF5u, 19u},
+  {0xAF10u, 18u},
+  {0xAF11u, 19u},
+  {0xAF2Cu, 18u},
+  {0xAF2Du, 19u},
+  {0xAF48u, 18u},
+  {0xAF49u, 19u},
+  {0xAF64u, 18u},
+  {0xAF65u, 19u},
+  {0xAF80u, 18u},
+  {0xAF81u, 19u},
+  {0xAF9Cu, 18u},
+  {0xAF9Du, 19u},
+  {0xAFB8u, 18u},
+  {0xAFB9u, 19u},
+  {0xAFD4u, 18u},
+  {0xAFD5u, 19u},
+  {0xAFF0u, 18u},
+  {0xAFF1u, 19u},
+  {0xB00Cu, 18u},
+  {0xB00Du, 19u},
+  {0xB028u, 18u},
+  {0xB029u, 19u},
+  {0xB044u, 18u},
+  {0xB045u, 19u},
+  {0xB060u, 18u},
+  {0xB061u, 19u},
+  {0xB07Cu, 18u},
+  {0xB07Du, 19u},
+  {0xB098u, 18u},
+  {0xB099u, 19u},
+  {0xB0B4u, 18u},
+  {0xB0B5u, 19u},
+  {0xB0D0u, 18u},
+  {0xB0D1u, 19u},
+  {0xB0ECu, 18u},
+  {0xB0EDu, 19u},
+  {0xB108u, 18u},
+  {0xB109u, 19u},
+  {0xB124u, 18u},
+  {0xB125u, 19u},
+  {0xB140u, 18u},
+  {0xB141u, 19u},
+  {0xB15Cu, 18u},
+  {0xB15Du, 19u},
+  {0xB178u, 18u},
+  {0xB179u, 19u},
+  {0xB194u, 18u},
+  {0xB195u, 19u},
+  {0xB1B0u, 18u},
+  {0xB1B1u, 19u},
+  {0xB1CCu, 18u},
+  {0xB1CDu, 19u},
+  {0xB1E8u, 18u},
+  {0xB1E9u, 19u},
+  {0xB204u, 18u},
+  {0xB205u, 19u},
+  {0xB220u, 18u},
+  {0xB221u, 19u},
+  {0xB23Cu, 18u},
+  {0xB23Du, 19u},
+  {0xB258u, 18u},
+  {0xB259u, 19u},
+  {0xB274u, 18u},
+  {0xB275u, 19u},
+  {0xB290u, 18u},
+  {0xB291u, 19u},
+  {0xB2ACu, 18u},
+  {0xB2ADu, 19u},
+  {0xB2C8u, 18u},
+  {0xB2C9u, 19u},
+  {0xB2E4u, 18u},
+  {0xB2E5u, 19u},
+  {0xB300u, 18u},
+  {0xB301u, 19u},
+  {0xB31Cu, 18u},
+  {0xB31Du, 19u},
+  {0xB338u, 18u},
+  {0xB339u, 19u},
+  {0xB354u, 18u},
+  {0xB355u, 19u},
+  {0xB370u, 18u},
+  {0xB371u, 19u},
+  {0xB38Cu, 18u},
+  {0xB38Du, 19u},
+  {0xB3A8u, 18u},
+  {0xB3A9u, 19u},
+  {0xB3C4u, 18u},
+  {0xB3C5u, 19u},
+  {0xB3E0u, 18u},
+  {0xB3E1u, 19u},
+  {0xB3FCu, 18u},
+  {0xB3FDu, 19u},
+  {0xB418u, 18u},
+  {0xB419u, 19u},
+  {0xB434u, 18u},
+  {0xB435u, 19u},
+  {0xB450u, 18u},
+  {0xB451u, 19u},
+  {0xB46Cu, 18u},
+  {0xB46Du, 19u},
+  {0xB488u, 18u},
+  {0xB489u, 19u},
+  {0xB4A4u, 18u},
+  {0xB4A5u, 19u},
+  {0xB4C0u, 18u},
+  {0xB4C1u, 19u},
+  {0xB4DCu, 18u},
+  {0xB4DDu, 19u},
+  {0xB4F8u, 18u},
+  {0xB4F9u, 19u},
+  {0xB514u, 18u},
+  {0xB515u, 19u},
+  {0xB530u, 18u},
+  {0xB531u, 19u},
+  {0xB54Cu, 18u},
+  {0xB54Du, 19u},
+  {0xB568u, 18u},
+  {0xB569u, 19u},
+  {0xB584u, 18u},
+  {0xB585u, 19u},
+  {0xB5A0u, 18u},
+  {0xB5A1u, 19u},
+  {0xB5BCu, 18u},
+  {0xB5BDu, 19u},
+  {0xB5D8u, 18u},
+  {0xB5D9u, 19u},
+  {0xB5F4u, 18u},
+  {0xB5F5u, 19u},
+  {0xB610u, 18u},
+  {0xB611u, 19u},
+  {0xB62Cu, 18u},
+  {0xB62Du, 19u},
+  {0xB648u, 18u},
+  {0xB649u, 19u},
+  {0xB664u, 18u},
+  {0xB665u, 19u},
+  {0xB680u, 18u},
+  {0xB681u, 19u},
+  {0xB69Cu, 18u},
+  {0xB69Du, 19u},
+  {0xB6B8u, 18u},
+  {0xB6B9u, 19u},
+  {0xB6D4u, 18u},
+  {0xB6D5u, 19u},
+  {0xB6F0u, 18u},
+  {0xB6F1u, 19u},
+  {0xB70Cu, 18u},
+  {0xB70Du, 19u},
+  {0xB728u, 18u},
+  {0xB729u, 19u},
+  {0xB744u, 18u},
+  {0xB745u, 19u},
+  {0xB760u, 18u},
+  {0xB761u, 19u},
+  {0xB77Cu, 18u},
+  {0xB77Du, 19u},
+  {0xB798u, 18u},
+  {0xB799u, 19u},
+  {0xB7B4u, 18u},
+  {0xB7B5u, 19u},
+  {0xB7D0u, 18u},
+  {0xB7D1u, 19u},
+  {0xB7ECu, 18u},
+  {0xB7EDu, 19u},
+  {0xB808u, 18u},
+  {0xB809u, 19u},
+  {0xB824u, 18u},
+  {0xB825u, 19u},
+  {0xB840u, 18u},
+  {0xB841u, 19u},
+  {0xB85Cu, 18u},
+  {0xB85Du, 19u},
+  {0xB878u, 18u},
+  {0xB879u, 19u},
+  {0xB894u, 18u},
+  {0xB895u, 19u},
+  {0xB8B0u, 18u},
+  {0xB8B1u, 19u},
+  {0xB8CCu, 18u},
+  {0xB8CDu, 19u},
+  {0xB8E8u, 18u},
+  {0xB8E9u, 19u},
+  {0xB904u, 18u},
+  {0xB905u, 19u},
+  {0xB920u, 18u},
+  {0xB921u, 19u},
+  {0xB93Cu, 18u},
+  {0xB93Du, 19u},
+  {0xB958u, 18u},
+  {0xB959u, 19u},
+  {0xB974u, 18u},
+  {0xB975u, 19u},
+  {0xB990u, 18u},
+  {0xB991u, 19u},
+  {0xB9ACu, 18u},
+  {0xB9ADu, 19u},
+  {0xB9C8u, 18u},
+  {0xB9C9u, 19u},
+  {0xB9E4u, 18u},
+  {0xB9E5u, 19u},
+  {0xBA00u, 18u},
+  {0xBA01u, 19u},
+  {0xBA1Cu, 18u},
+  {0xBA1Du, 19u},
+  {0xBA38u, 18u},
+  {0xBA39u, 19u},
+  {0xBA54u, 18u},
+  {0xBA55u, 19u},
+  {0xBA70u, 18u},
+  {0xBA71u, 19u},
+  {0xBA8Cu, 18u},
+  {0xBA8Du, 19u},
+  {0xBAA8u, 18u},
+  {0xBAA9u, 19u},
+  {0xBAC4u, 18u},
+  {0xBAC5u, 19u},
+  {0xBAE0u, 18u},
+  {0xBAE1u, 19u},
+  {0xBAFCu, 18u},
+  {0xBAFDu, 19u},
+  {0xBB18u, 18u},
+  {0xBB19u, 19u},
+  {0xBB34u, 18u},
+  {0xBB35u, 19u},
+  {0xBB50u, 18u},
+  {0xBB51u, 19u},
+  {0xBB6Cu, 18u},
+  {0xBB6Du, 19u},
+  {0xBB88u, 18u},
+  {0xBB89u, 19u},
+  {0xBBA4u, 18u},
+  {0xBBA5u, 19u},
+  {0xBBC0u, 18u},
+  {0xBBC1u, 19u},
+  {0xBBDCu, 18u},
+  {0xBBDDu, 19u},
+  {0xBBF8u, 18u},
+  {0xBBF9u, 19u},
+  {0xBC14u, 18u},
+  {0xBC15u, 19u},
+  {0xBC30u, 18u},
+  {0xBC31u, 19u},
+  {0xBC4Cu, 18u},
+  {0xBC4Du, 19u},
+  {0xBC68u, 18u},
+  {0xBC69u, 19u},
+  {0xBC84u, 18u},
+  {0xBC85u, 19u},
+  {0xBCA0u, 18u},
+  {0xBCA1u, 19u},
+  {0xBCBCu, 18u},
+  {0xBCBDu, 19u},
+  {0xBCD8u, 18u},
+  {0xBCD9u, 19u},
+  {0xBCF4u, 18u},
+  {0xBCF5u, 19u},
+  {0xBD10u, 18u},
+  {0xBD11u, 19u},
+  {0xBD2Cu, 18u},
+  {0xBD2Du, 19u},
+  {0xBD48u, 18u},
+  {0xBD49u, 19u},
+  {0xBD64u, 18u},
+  {0xBD65u, 19u},
+  {0xBD80u, 18u},
+  {0xBD81u, 19u},
+  {0xBD9Cu, 18u},
+  {0xBD9Du, 19u},
+  {0xBDB8u, 18u},
+  {0xBDB9u, 19u},
+  {0xBDD4u, 18u},
+  {0xBDD5u, 19u},
+  {0xBDF0u, 18u},
+  {0xBDF1u, 19u},
+  {0xBE0Cu, 18u},
+  {0xBE0Du, 19u},
+  {0xBE28u, 18u},
+  {0xBE29u, 19u},
+  {0xBE44u, 18u},
+  {0xBE45u, 19u},
+  {0xBE60u, 18u},
+  {0xBE61u, 19u},
+  {0xBE7Cu, 18u},
+  {0xBE7Du, 19u},
+  {0xBE98u, 18u},
+  {0xBE99u, 19u},
+  {0xBEB4u, 18u},
+  {0xBEB5u, 19u},
+  {0xBED0u, 18u},
+  {0xBED1u, 19u},
+  {0xBEECu, 18u},
+  {0xBEEDu, 19u},
+  {0xBF08u, 18u},
+  {0xBF09u, 19u},
+  {0xBF24u, 18u},
+  {0xBF25u, 19u},
+  {0xBF40u, 18u},
+  {0xBF41u, 19u},
+  {0xBF5Cu, 18u},
+  {0xBF5Du, 19u},
+  {0xBF78u, 18u},
+  {0xBF79u, 19u},
+  {0xBF94u, 18u},
+  {0xBF95u, 19u},
+  {0xBFB0u, 18u},
+  {0xBFB1u, 19u},
+  {0xBFCCu, 18u},
+  {0xBFCDu, 19u},
+  {0xBFE8u, 18u},
+  {0xBFE9u, 19u},
+  {0xC004u, 18u},
+  {0xC005u, 19u},
+  {0xC020u, 18u},
+  {0xC021u, 19u},
+  {0xC03Cu, 18u},
+  {0xC03Du, 19u},
+  {0xC058u, 18u},
+  {0xC059u, 19u},
+  {0xC074u, 18u},
+  {0xC075u, 19u},
+  {0xC090u, 18u},
+  {0xC091u, 19u},
+  {0xC0ACu, 18u},
+  {0xC0ADu, 19u},
+  {0xC0C8u, 18u},
+  {0xC0C9u, 19u},
+  {0xC0E4u, 18u},
+  {0xC0E5u, 19u},
+  {0xC100u, 18u},
+  {0xC101u, 19u},
+  {0xC11Cu, 18u},
+  {0xC11Du, 19u},
+  {0xC138u, 18u},
+  {0xC139u, 19u},
+  {0xC154u, 18u},
+  {0xC155u, 19u},
+  {0xC170u, 18u},
+  {0xC171u, 19u},
+  {0xC18Cu, 18u},
+  {0xC18Du, 19u},
+  {0xC1A8u, 18u},
+  {0xC1A9u, 19u},
+  {0xC1C4u, 18u},
+  {0xC1C5u, 19u},
+  {0xC1E0u, 18u},
+  {0xC1E1u, 19u},
+  {0xC1FCu, 18u},
+  {0xC1FDu, 19u},
+  {0xC218u, 18u},
+  {0xC219u, 19u},
+  {0xC234u, 18u},
+  {0xC235u, 19u},
+  {0xC250u, 18u},
+  {0xC251u, 19u},
+  {0xC26Cu, 18u},
+  {0xC26Du, 19u},
+  {0xC288u, 18u},
+  {0xC289u, 19u},
+  {0xC2A4u, 18u},
+  {0xC2A5u, 19u},
+  {0xC2C0u, 18u},
+  {0xC2C1u, 19u},
+  {0xC2DCu, 18u},
+  {0xC2DDu, 19u},
+  {0xC2F8u, 18u},
+  {0xC2F9u, 19u},
+  {0xC314u, 18u},
+  {0xC315u, 19u},
+  {0xC330u, 18u},
+  {0xC331u, 19u},
+  {0xC34Cu, 18u},
+  {0xC34Du, 19u},
+  {0xC368u, 18u},
+  {0xC369u, 19u},
+  {0xC384u, 18u},
+  {0xC385u, 19u},
+  {0xC3A0u, 18u},
+  {0xC3A1u, 19u},
+  {0xC3BCu, 18u},
+  {0xC3BDu, 19u},
+  {0xC3D8u, 18u},
+  {0xC3D9u, 19u},
+  {0xC3F4u, 18u},
+  {0xC3F5u, 19u},
+  {0xC410u, 18u},
+  {0xC411u, 19u},
+  {0xC42Cu, 18u},
+  {0xC42Du, 19u},
+  {0xC448u, 18u},
+  {0xC449u, 19u},
+  {0xC464u, 18u},
+  {0xC465u, 19u},
+  {0xC480u, 18u},
+  {0xC481u, 19u},
+  {0xC49Cu, 18u},
+  {0xC49Du, 19u},
+  {0xC4B8u, 18u},
+  {0xC4B9u, 19u},
+  {0xC4D4u, 18u},
+  {0xC4D5u, 19u},
+  {0xC4F0u, 18u},
+  {0xC4F1u, 19u},
+  {0xC50Cu, 18u},
+  {0xC50Du, 19u},
+  {0xC528u, 18u},
+  {0xC529u, 19u},
+  {0xC544u, 18u},
+  {0xC545u, 19u},
+  {0xC560u, 18u},
+  {0xC561u, 19u},
+  {0xC57Cu, 18u},
+  {0xC57Du, 19u},
+  {0xC598u, 18u},
+  {0xC599u, 19u},
+  {0xC5B4u, 18u},
+  {0xC5B5u, 19u},
+  {0xC5D0u, 18u},
+  {0xC5D1u, 19u},
+  {0xC5ECu, 18u},
+  {0xC5EDu, 19u},
+  {0xC608u, 18u},
+  {0xC609u, 19u},
+  {0xC624u, 18u},
+  {0xC625u, 19u},
+  {0xC640u, 18u},
+  {0xC641u, 19u},
+  {0xC65Cu, 18u},
+  {0xC65Du, 19u},
+  {0xC678u, 18u},
+  {0xC679u, 19u},
+  {0xC694u, 18u},
+  {0xC695u, 19u},
+  {0xC6B0u, 18u},
+  {0xC6B1u, 19u},
+  {0xC6CCu, 18u},
+  {0xC6CDu, 19u},
+  {0xC6E8u, 18u},
+  {0xC6E9u, 19u},
+  {0xC704u, 18u},
+  {0xC705u, 19u},
+  {0xC720u, 18u},
+  {0xC721u, 19u},
+  {0xC73Cu, 18u},
+  {0xC73Du, 19u},
+  {0xC758u, 18u},
+  {0xC759u, 19u},
+  {0xC774u, 18u},
+  {0xC775u, 19u},
+  {0xC790u, 18u},
+  {0xC791u, 19u},
+  {0xC7ACu, 18u},
+  {0xC7ADu, 19u},
+  {0xC7C8u, 18u},
+  {0xC7C9u, 19u},
+  {0xC7E4u, 18u},
+  {0xC7E5u, 19u},
+  {0xC800u, 18u},
+  {0xC801u, 19u},
+  {0xC81Cu, 18u},
+  {0xC81Du, 19u},
+  {0xC838u, 18u},
+  {0xC839u, 19u},
+  {0xC854u, 18u},
+  {0xC855u, 19u},
+  {0xC870u, 18u},
+  {0xC871u, 19u},
+  {0xC88Cu, 18u},
+  {0xC88Du, 19u},
+  {0xC8A8u, 18u},
+  {0xC8A9u, 19u},
+  {0xC8C4u, 18u},
+  {0xC8C5u, 19u},
+  {0xC8E0u, 18u},
+  {0xC8E1u, 19u},
+  {0xC8FCu, 18u},
+  {0xC8FDu, 19u},
+  {0xC918u, 18u},
+  {0xC919u, 19u},
+  {0xC934u, 18u},
+  {0xC935u, 19u},
+  {0xC950u, 18u},
+  {0xC951u, 19u},
+  {0xC96Cu, 18u},
+  {0xC96Du, 19u},
+  {0xC988u, 18u},
+  {0xC989u, 19u},
+  {0xC9A4u, 18u},
+  {0xC9A5u, 19u},
+  {0xC9C0u, 18u},
+  {0xC9C1u, 19u},
+  {0xC9DCu, 18u},
+  {0xC9DDu, 19u},
+  {0xC9F8u, 18u},
+  {0xC9F9u, 19u},
+  {0xCA14u, 18u},
+  {0xCA15u, 19u},
+  {0xCA30u, 18u},
+  {0xCA31u, 19u},
+  {0xCA4Cu, 18u},
+  {0xCA4Du, 19u},
+  {0xCA68u, 18u},
+  {0xCA69u, 19u},
+  {0xCA84u, 18u},
+  {0xCA85u, 19u},
+  {0xCAA0u, 18u},
+  {0xCAA1u, 19u},
+  {0xCABCu, 18u},
+  {0xCABDu, 19u},
+  {0xCAD8u, 18u},
+  {0xCAD9u, 19u},
+  {0xCAF4u, 18u},
+  {0xCAF5u, 19u},
+  {0xCB10u, 18u},
+  {0xCB11u, 19u},
+  {0xCB2Cu, 18u},
+  {0xCB2Du, 19u},
+  {0xCB48u, 18u},
+  {0xCB49u, 19u},
+  {0xCB64u, 18u},
+  {0xCB65u, 19u},
+  {0xCB80u, 18u},
+  {0xCB81u, 19u},
+  {0xCB9Cu, 18u},
+  {0xCB9Du, 19u},
+  {0xCBB8u, 18u},
+  {0xCBB9u, 19u},
+  {0xCBD4u, 18u},
+  {0xCBD5u, 19u},
+  {0xCBF0u, 18u},
+  {0xCBF1u, 19u},
+  {0xCC0Cu, 18u},
+  {0xCC0Du, 19u},
+  {0xCC28u, 18u},
+  {0xCC29u, 19u},
+  {0xCC44u, 18u},
+  {0xCC45u, 19u},
+  {0xCC60u, 18u},
+  {0xCC61u, 19u},
+  {0xCC7Cu, 18u},
+  {0xCC7Du, 19u},
+  {0xCC98u, 18u},
+  {0xCC99u, 19u},
+  {0xCCB4u, 18u},
+  {0xCCB5u, 19u},
+  {0xCCD0u, 18u},
+  {0xCCD1u, 19u},
+  {0xCCECu, 18u},
+  {0xCCEDu, 19u},
+  {0xCD08u, 18u},
+  {0xCD09u, 19u},
+  {0xCD24u, 18u},
+  {0xCD25u, 19u},
+  {0xCD40u, 18u},
+  {0xCD41u, 19u},
+  {0xCD5Cu, 18u},
+  {0xCD5Du, 19u},
+  {0xCD78u, 18u},
+  {0xCD79u, 19u},
+  {0xCD94u, 18u},
+  {0xCD95u, 19u},
+  {0xCDB0u, 18u},
+  {0xCDB1u, 19u},
+  {0xCDCCu, 18u},
+  {0xCDCDu, 19u},
+  {0xCDE8u, 18u},
+  {0xCDE9u, 19u},
+  {0xCE04u, 18u},
+  {0xCE05u, 19u},
+  {0xCE20u, 18u},
+  {0xCE21u, 19u},
+  {0xCE3Cu, 18u},
+  {0xCE3Du, 19u},
+  {0xCE58u, 18u},
+  {0xCE59u, 19u},
+  {0xCE74u, 18u},
+  {0xCE75u, 19u},
+  {0xCE90u, 18u},
+  {0xCE91u, 19u},
+  {0xCEACu, 18u},
+  {0xCEADu, 19u},
+  {0xCEC8u, 18u},
+  {0xCEC9u, 19u},
+  {0xCEE4u, 18u},
+  {0xCEE5u, 19u},
+  {0xCF00u, 18u},
+  {0xCF01u, 19u},
+  {0xCF1Cu, 18u},
+  {0xCF1Du, 19u},
+  {0xCF38u, 18u},
+  {0xCF39u, 19u},
+  {0xCF54u, 18u},
+  {0xCF55u, 19u},
+  {0xCF70u, 18u},
+  {0xCF71u, 19u},
+  {0xCF8Cu, 18u},
+  {0xCF8Du, 19u},
+  {0xCFA8u, 18u},
+  {0xCFA9u, 19u},
+  {0xCFC4u, 18u},
+  {0xCFC5u, 19u},
+  {0xCFE0u, 18u},
+  {0xCFE1u, 19u},
+  {0xCFFCu, 18u},
+  {0xCFFDu, 19u},
+  {0xD018u, 18u},
+  {0xD019u, 19u},
+  {0xD034u, 18u},
+  {0xD035u, 19u},
+  {0xD050u, 18u},
+  {0xD051u, 19u},
+  {0xD06Cu, 18u},
+  {0xD06Du, 19u},
+  {0xD088u, 18u},
+  {0xD089u, 19u},
+  {0xD0A4u, 18u},
+  {0xD0A5u, 19u},
+  {0xD0C0u, 18u},
+  {0xD0C1u, 19u},
+  {0xD0DCu, 18u},
+  {0xD0DDu, 19u},
+  {0xD0F8u, 18u},
+  {0xD0F9u, 19u},
+  {0xD114u, 18u},
+  {0xD115u, 19u},
+  {0xD130u, 18u},
+  {0xD131u, 19u},
+  {0xD14Cu, 18u},
+  {0xD14Du, 19u},
+  {0xD168u, 18u},
+  {0xD169u, 19u},
+  {0xD184u, 18u},
+  {0xD185u, 19u},
+  {0xD1A0u, 18u},
+  {0xD1A1u, 19u},
+  {0xD1BCu, 18u},
+  {0xD1BDu, 19u},
+  {0xD1D8u, 18u},
+  {0xD1D9u, 19u},
+  {0xD1F4u, 18u},
+  {0xD1F5u, 19u},
+  {0xD210u, 18u},
+  {0xD211u, 19u},
+  {0xD22Cu, 18u},
+  {0xD22Du, 19u},
+  {0xD248u, 18u},
+  {0xD249u, 19u},
+  {0xD264u, 18u},
+  {0xD265u, 19u},
+  {0xD280u, 18u},
+  {0xD281u, 19u},
+  {0xD29Cu, 18u},
+  {0xD29Du, 19u},
+  {0xD2B8u, 18u},
+  {0xD2B9u, 19u},
+  {0xD2D4u, 18u},
+  {0xD2D5u, 19u},
+  {0xD2F0u, 18u},
+  {0xD2F1u, 19u},
+  {0xD30Cu, 18u},
+  {0xD30Du, 19u},
+  {0xD328u, 18u},
+  {0xD329u, 19u},
+  {0xD344u, 18u},
+  {0xD345u, 19u},
+  {0xD360u, 18u},
+  {0xD361u, 19u},
+  {0xD37Cu, 18u},
+  {0xD37Du, 19u},
+  {0xD398u, 18u},
+  {0xD399u, 19u},
+  {0xD3B4u, 18u},
+  {0xD3B5u, 19u},
+  {0xD3D0u, 18u},
+  {0xD3D1u, 19u},
+  {0xD3ECu, 18u},
+  {0xD3EDu, 19u},
+  {0xD408u, 18u},
+  {0xD409u, 19u},
+  {0xD424u, 18u},
+  {0xD425u, 19u},
+  {0xD440u, 18u},
+  {0xD441u, 19u},
+  {0xD45Cu, 18u},
+  {0xD45Du, 19u},
+  {0xD478u, 18u},
+  {0xD479u, 19u},
+  {0xD494u, 18u},
+  {0xD495u, 19u},
+  {0xD4B0u, 18u},
+  {0xD4B1u, 19u},
+  {0xD4CCu, 18u},
+  {0xD4CDu, 19u},
+  {0xD4E8u, 18u},
+  {0xD4E9u, 19u},
+  {0xD504u, 18u},
+  {0xD505u, 19u},
+  {0xD520u, 18u},
+  {0xD521u, 19u},
+  {0xD53Cu, 18u},
+  {0xD53Du, 19u},
+  {0xD558u, 18u},
+  {0xD559u, 19u},
+  {0xD574u, 18u},
+  {0xD575u, 19u},
+  {0xD590u, 18u},
+  {0xD591u, 19u},
+  {0xD5ACu, 18u},
+  {0xD5ADu, 19u},
+  {0xD5C8u, 18u},
+  {0xD5C9u, 19u},
+  {0xD5E4u, 18u},
+  {0xD5E5u, 19u},
+  {0xD600u, 18u},
+  {0xD601u, 19u},
+  {0xD61Cu, 18u},
+  {0xD61Du, 19u},
+  {0xD638u, 18u},
+  {0xD639u, 19u},
+  {0xD654u, 18u},
+  {0xD655u, 19u},
+  {0xD670u, 18u},
+  {0xD671u, 19u},
+  {0xD68Cu, 18u},
+  {0xD68Du, 19u},
+  {0xD6A8u, 18u},
+  {0xD6A9u, 19u},
+  {0xD6C4u, 18u},
+  {0xD6C5u, 19u},
+  {0xD6E0u, 18u},
+  {0xD6E1u, 19u},
+  {0xD6FCu, 18u},
+  {0xD6FDu, 19u},
+  {0xD718u, 18u},
+  {0xD719u, 19u},
+  {0xD734u, 18u},
+  {0xD735u, 19u},
+  {0xD750u, 18u},
+  {0xD751u, 19u},
+  {0xD76Cu, 18u},
+  {0xD76Du, 19u},
+  {0xD788u, 18u},
+  {0xD789u, 19u},
+  {0xD7A4u, 0u},
+  {0xD7B0u, 10u},
+  {0xD7C7u, 0u},
+  {0xD7CBu, 11u},
+  {0xD7FCu, 0u},
+  {0xFB1Eu, 6u},
+  {0xFB1Fu, 0u},
+  {0xFE00u, 6u},
+  {0xFE0Fu, 13u},
+  {0xFE10u, 0u},
+  {0xFE20u, 6u},
+  {0xFE30u, 0u},
+  {0xFEFFu, 1u},
+  {0xFF00u, 0u},
+  {0xFF9Eu, 6u},
+  {0xFFA0u, 0u},
+  {0xFFF0u, 1u},
+  {0xFFFCu, 0u},
+  {0x101FDu, 6u},
+  {0x101FEu, 0u},
+  {0x102E0u, 6u},
+  {0x102E1u, 0u},
+  {0x10376u, 6u},
+  {0x1037Bu, 0u},
+  {0x10A01u, 6u},
+  {0x10A04u, 0u},
+  {0x10A05u, 6u},
+  {0x10A07u, 0u},
+  {0x10A0Cu, 6u},
+  {0x10A10u, 0u},
+  {0x10A38u, 6u},
+  {0x10A3Bu, 0u},
+  {0x10A3Fu, 6u},
+  {0x10A40u, 0u},
+  {0x10AE5u, 6u},
+  {0x10AE7u, 0u},
+  {0x10D24u, 6u},
+  {0x10D28u, 0u},
+  {0x10EABu, 6u},
+  {0x10EADu, 0u},
+  {0x10EFDu, 6u},
+  {0x10F00u, 0u},
+  {0x10F46u, 6u},
+  {0x10F51u, 0u},
+  {0x10F82u, 6u},
+  {0x10F86u, 0u},
+  {0x11000u, 8u},
+  {0x11001u, 6u},
+  {0x11002u, 8u},
+  {0x11003u, 0u},
+  {0x11038u, 6u},
+  {0x11047u, 0u},
+  {0x11070u, 6u},
+  {0x11071u, 0u},
+  {0x11073u, 6u},
+  {0x11075u, 0u},
+  {0x1107Fu, 6u},
+  {0x11082u, 8u},
+  {0x11083u, 0u},
+  {0x110B0u, 8u},
+  {0x110B3u, 6u},
+  {0x110B7u, 8u},
+  {0x110B9u, 6u},
+  {0x110BBu, 0u},
+  {0x110BDu, 7u},
+  {0x110BEu, 0u},
+  {0x110C2u, 6u},
+  {0x110C3u, 0u},
+  {0x110CDu, 7u},
+  {0x110CEu, 0u},
+  {0x11100u, 6u},
+  {0x11103u, 0u},
+  {0x11127u, 6u},
+  {0x1112Cu, 8u},
+  {0x1112Du, 6u},
+  {0x11135u, 0u},
+  {0x11145u, 8u},
+  {0x11147u, 0u},
+  {0x11173u, 6u},
+  {0x11174u, 0u},
+  {0x11180u, 6u},
+  {0x11182u, 8u},
+  {0x11183u, 0u},
+  {0x111B3u, 8u},
+  {0x111B6u, 6u},
+  {0x111BFu, 8u},
+  {0x111C1u, 0u},
+  {0x111C2u, 7u},
+  {0x111C4u, 0u},
+  {0x111C9u, 6u},
+  {0x111CDu, 0u},
+  {0x111CEu, 8u},
+  {0x111CFu, 6u},
+  {0x111D0u, 0u},
+  {0x1122Cu, 8u},
+  {0x1122Fu, 6u},
+  {0x11232u, 8u},
+  {0x11234u, 6u},
+  {0x11235u, 8u},
+  {0x11236u, 6u},
+  {0x11238u, 0u},
+  {0x1123Eu, 6u},
+  {0x1123Fu, 0u},
+  {0x11241u, 6u},
+  {0x11242u, 0u},
+  {0x112DFu, 6u},
+  {0x112E0u, 8u},
+  {0x112E3u, 6u},
+  {0x112EBu, 0u},
+  {0x11300u, 6u},
+  {0x11302u, 8u},
+  {0x11304u, 0u},
+  {0x1133Bu, 6u},
+  {0x1133Du, 0u},
+  {0x1133Eu, 6u},
+  {0x1133Fu, 8u},
+  {0x11340u, 6u},
+  {0x11341u, 8u},
+  {0x11345u, 0u},
+  {0x11347u, 8u},
+  {0x11349u, 0u},
+  {0x1134Bu, 8u},
+  {0x1134Eu, 0u},
+  {0x11357u, 6u},
+  {0x11358u, 0u},
+  {0x11362u, 8u},
+  {0x11364u, 0u},
+  {0x11366u, 6u},
+  {0x1136Du, 0u},
+  {0x11370u, 6u},
+  {0x11375u, 0u},
+  {0x11435u, 8u},
+  {0x11438u, 6u},
+  {0x11440u, 8u},
+  {0x11442u, 6u},
+  {0x11445u, 8u},
+  {0x11446u, 6u},
+  {0x11447u, 0u},
+  {0x1145Eu, 6u},
+  {0x1145Fu, 0u},
+  {0x114B0u, 6u},
+  {0x114B1u, 8u},
+  {0x114B3u, 6u},
+  {0x114B9u, 8u},
+  {0x114BAu, 6u},
+  {0x114BBu, 8u},
+  {0x114BDu, 6u},
+  {0x114BEu, 8u},
+  {0x114BFu, 6u},
+  {0x114C1u, 8u},
+  {0x114C2u, 6u},
+  {0x114C4u, 0u},
+  {0x115AFu, 6u},
+  {0x115B0u, 8u},
+  {0x115B2u, 6u},
+  {0x115B6u, 0u},
+  {0x115B8u, 8u},
+  {0x115BCu, 6u},
+  {0x115BEu, 8u},
+  {0x115BFu, 6u},
+  {0x115C1u, 0u},
+  {0x115DCu, 6u},
+  {0x115DEu, 0u},
+  {0x11630u, 8u},
+  {0x11633u, 6u},
+  {0x1163Bu, 8u},
+  {0x1163Du, 6u},
+  {0x1163Eu, 8u},
+  {0x1163Fu, 6u},
+  {0x11641u, 0u},
+  {0x116ABu, 6u},
+  {0x116ACu, 8u},
+  {0x116ADu, 6u},
+  {0x116AEu, 8u},
+  {0x116B0u, 6u},
+  {0x116B6u, 8u},
+  {0x116B7u, 6u},
+  {0x116B8u, 0u},
+  {0x1171Du, 6u},
+  {0x11720u, 0u},
+  {0x11722u, 6u},
+  {0x11726u, 8u},
+  {0x11727u, 6u},
+  {0x1172Cu, 0u},
+  {0x1182Cu, 8u},
+  {0x1182Fu, 6u},
+  {0x11838u, 8u},
+  {0x11839u, 6u},
+  {0x1183Bu, 0u},
+  {0x11930u, 6u},
+  {0x11931u, 8u},
+  {0x11936u, 0u},
+  {0x11937u, 8u},
+  {0x11939u, 0u},
+  {0x1193Bu, 6u},
+  {0x1193Du, 8u},
+  {0x1193Eu, 6u},
+  {0x1193Fu, 7u},
+  {0x11940u, 8u},
+  {0x11941u, 7u},
+  {0x11942u, 8u},
+  {0x11943u, 6u},
+  {0x11944u, 0u},
+  {0x119D1u, 8u},
+  {0x119D4u, 6u},
+  {0x119D8u, 0u},
+  {0x119DAu, 6u},
+  {0x119DCu, 8u},
+  {0x119E0u, 6u},
+  {0x119E1u, 0u},
+  {0x119E4u, 8u},
+  {0x119E5u, 0u},
+  {0x11A01u, 6u},
+  {0x11A0Bu, 0u},
+  {0x11A33u, 6u},
+  {0x11A39u, 8u},
+  {0x11A3Au, 7u},
+  {0x11A3Bu, 6u},
+  {0x11A3Fu, 0u},
+  {0x11A47u, 6u},
+  {0x11A48u, 0u},
+  {0x11A51u, 6u},
+  {0x11A57u, 8u},
+  {0x11A59u, 6u},
+  {0x11A5Cu, 0u},
+  {0x11A84u, 7u},
+  {0x11A8Au, 6u},
+  {0x11A97u, 8u},
+  {0x11A98u, 6u},
+  {0x11A9Au, 0u},
+  {0x11C2Fu, 8u},
+  {0x11C30u, 6u},
+  {0x11C37u, 0u},
+  {0x11C38u, 6u},
+  {0x11C3Eu, 8u},
+  {0x11C3Fu, 6u},
+  {0x11C40u, 0u},
+  {0x11C92u, 6u},
+  {0x11CA8u, 0u},
+  {0x11CA9u, 8u},
+  {0x11CAAu, 6u},
+  {0x11CB1u, 8u},
+  {0x11CB2u, 6u},
+  {0x11CB4u, 8u},
+  {0x11CB5u, 6u},
+  {0x11CB7u, 0u},
+  {0x11D31u, 6u},
+  {0x11D37u, 0u},
+  {0x11D3Au, 6u},
+  {0x11D3Bu, 0u},
+  {0x11D3Cu, 6u},
+  {0x11D3Eu, 0u},
+  {0x11D3Fu, 6u},
+  {0x11D46u, 7u},
+  {0x11D47u, 6u},
+  {0x11D48u, 0u},
+  {0x11D8Au, 8u},
+  {0x11D8Fu, 0u},
+  {0x11D90u, 6u},
+  {0x11D92u, 0u},
+  {0x11D93u, 8u},
+  {0x11D95u, 6u},
+  {0x11D96u, 8u},
+  {0x11D97u, 6u},
+  {0x11D98u, 0u},
+  {0x11EF3u, 6u},
+  {0x11EF5u, 8u},
+  {0x11EF7u, 0u},
+  {0x11F00u, 6u},
+  {0x11F02u, 7u},
+  {0x11F03u, 8u},
+  {0x11F04u, 0u},
+  {0x11F34u, 8u},
+  {0x11F36u, 6u},
+  {0x11F3Bu, 0u},
+  {0x11F3Eu, 8u},
+  {0x11F40u, 6u},
+  {0x11F41u, 8u},
+  {0x11F42u, 6u},
+  {0x11F43u, 0u},
+  {0x13430u, 1u},
+  {0x13440u, 6u},
+  {0x13441u, 0u},
+  {0x13447u, 6u},
+  {0x13456u, 0u},
+  {0x16AF0u, 6u},
+  {0x16AF5u, 0u},
+  {0x16B30u, 6u},
+  {0x16B37u, 0u},
+  {0x16F4Fu, 6u},
+  {0x16F50u, 0u},
+  {0x16F51u, 8u},
+  {0x16F88u, 0u},
+  {0x16F8Fu, 6u},
+  {0x16F93u, 0u},
+  {0x16FE4u, 6u},
+  {0x16FE5u, 0u},
+  {0x16FF0u, 8u},
+  {0x16FF2u, 0u},
+  {0x1BC9Du, 6u},
+  {0x1BC9Fu, 0u},
+  {0x1BCA0u, 1u},
+  {0x1BCA4u, 0u},
+  {0x1CF00u, 6u},
+  {0x1CF2Eu, 0u},
+  {0x1CF30u, 6u},
+  {0x1CF47u, 0u},
+  {0x1D165u, 6u},
+  {0x1D166u, 8u},
+  {0x1D167u, 6u},
+  {0x1D16Au, 0u},
+  {0x1D16Du, 8u},
+  {0x1D16Eu, 6u},
+  {0x1D173u, 1u},
+  {0x1D17Bu, 6u},
+  {0x1D183u, 0u},
+  {0x1D185u, 6u},
+  {0x1D18Cu, 0u},
+  {0x1D1AAu, 6u},
+  {0x1D1AEu, 0u},
+  {0x1D242u, 6u},
+  {0x1D245u, 0u},
+  {0x1DA00u, 6u},
+  {0x1DA37u, 0u},
+  {0x1DA3Bu, 6u},
+  {0x1DA6Du, 0u},
+  {0x1DA75u, 6u},
+  {0x1DA76u, 0u},
+  {0x1DA84u, 6u},
+  {0x1DA85u, 0u},
+  {0x1DA9Bu, 6u},
+  {0x1DAA0u, 0u},
+  {0x1DAA1u, 6u},
+  {0x1DAB0u, 0u},
+  {0x1E000u, 6u},
+  {0x1E007u, 0u},
+  {0x1E008u, 6u},
+  {0x1E019u, 0u},
+  {0x1E01Bu, 6u},
+  {0x1E022u, 0u},
+  {0x1E023u, 6u},
+  {0x1E025u, 0u},
+  {0x1E026u, 6u},
+  {0x1E02Bu, 0u},
+  {0x1E08Fu, 6u},
+  {0x1E090u, 0u},
+  {0x1E130u, 6u},
+  {0x1E137u, 0u},
+  {0x1E2AEu, 6u},
+  {0x1E2AFu, 0u},
+  {0x1E2ECu, 6u},
+  {0x1E2F0u, 0u},
+  {0x1E4ECu, 6u},
+  {0x1E4F0u, 0u},
+  {0x1E8D0u, 6u},
+  {0x1E8D7u, 0u},
+  {0x1E944u, 6u},
+  {0x1E94Bu, 0u},
+  {0x1F000u, 15u},
+  {0x1F004u, 14u},
+  {0x1F005u, 15u},
+  {0x1F0CFu, 14u},
+  {0x1F0D0u, 15u},
+  {0x1F100u, 0u},
+  {0x1F10Du, 15u},
+  {0x1F110u, 0u},
+  {0x1F12Fu, 15u},
+  {0x1F130u, 0u},
+  {0x1F16Cu, 15u},
+  {0x1F170u, 5u},
+  {0x1F172u, 0u},
+  {0x1F17Eu, 5u},
+  {0x1F180u, 0u},
+  {0x1F18Eu, 14u},
+  {0x1F18Fu, 0u},
+  {0x1F191u, 14u},
+  {0x1F19Bu, 0u},
+  {0x1F1ADu, 15u},
+  {0x1F1E6u, 20u},
+  {0x1F200u, 0u},
+  {0x1F201u, 14u},
+  {0x1F202u, 5u},
+  {0x1F203u, 15u},
+  {0x1F210u, 0u},
+  {0x1F21Au, 14u},
+  {0x1F21Bu, 0u},
+  {0x1F22Fu, 14u},
+  {0x1F230u, 0u},
+  {0x1F232u, 14u},
+  {0x1F237u, 5u},
+  {0x1F238u, 14u},
+  {0x1F23Bu, 0u},
+  {0x1F23Cu, 15u},
+  {0x1F240u, 0u},
+  {0x1F249u, 15u},
+  {0x1F250u, 14u},
+  {0x1F252u, 15u},
+  {0x1F300u, 14u},
+  {0x1F321u, 5u},
+  {0x1F322u, 15u},
+  {0x1F324u, 5u},
+  {0x1F32Du, 14u},
+  {0x1F336u, 5u},
+  {0x1F337u, 14u},
+  {0x1F37Du, 5u},
+  {0x1F37Eu, 14u},
+  {0x1F385u, 17u},
+  {0x1F386u, 14u},
+  {0x1F394u, 15u},
+  {0x1F396u, 5u},
+  {0x1F398u, 15u},
+  {0x1F399u, 5u},
+  {0x1F39Cu, 15u},
+  {0x1F39Eu, 5u},
+  {0x1F3A0u, 14u},
+  {0x1F3C2u, 17u},
+  {0x1F3C5u, 14u},
+  {0x1F3C7u, 17u},
+  {0x1F3C8u, 14u},
+  {0x1F3CAu, 17u},
+  {0x1F3CBu, 16u},
+  {0x1F3CDu, 5u},
+  {0x1F3CFu, 14u},
+  {0x1F3D4u, 5u},
+  {0x1F3E0u, 14u},
+  {0x1F3F1u, 15u},
+  {0x1F3F3u, 5u},
+  {0x1F3F4u, 14u},
+  {0x1F3F5u, 5u},
+  {0x1F3F6u, 15u},
+  {0x1F3F7u, 5u},
+  {0x1F3F8u, 14u},
+  {0x1F3FBu, 21u},
+  {0x1F400u, 14u},
+  {0x1F43Fu, 5u},
+  {0x1F440u, 14u},
+  {0x1F441u, 5u},
+  {0x1F442u, 17u},
+  {0x1F444u, 14u},
+  {0x1F446u, 17u},
+  {0x1F451u, 14u},
+  {0x1F466u, 17u},
+  {0x1F479u, 14u},
+  {0x1F47Cu, 17u},
+  {0x1F47Du, 14u},
+  {0x1F481u, 17u},
+  {0x1F484u, 14u},
+  {0x1F485u, 17u},
+  {0x1F488u, 14u},
+  {0x1F48Fu, 17u},
+  {0x1F490u, 14u},
+  {0x1F491u, 17u},
+  {0x1F492u, 14u},
+  {0x1F4AAu, 17u},
+  {0x1F4ABu, 14u},
+  {0x1F4FDu, 5u},
+  {0x1F4FEu, 15u},
+  {0x1F4FFu, 14u},
+  {0x1F53Eu, 0u},
+  {0x1F546u, 15u},
+  {0x1F549u, 5u},
+  {0x1F54Bu, 14u},
+  {0x1F54Fu, 15u},
+  {0x1F550u, 14u},
+  {0x1F568u, 15u},
+  {0x1F56Fu, 5u},
+  {0x1F571u, 15u},
+  {0x1F573u, 5u},
+  {0x1F574u, 16u},
+  {0x1F576u, 5u},
+  {0x1F57Au, 17u},
+  {0x1F57Bu, 15u},
+  {0x1F587u, 5u},
+  {0x1F588u, 15u},
+  {0x1F58Au, 5u},
+  {0x1F58Eu, 15u},
+  {0x1F590u, 16u},
+  {0x1F591u, 15u},
+  {0x1F595u, 17u},
+  {0x1F597u, 15u},
+  {0x1F5A4u, 14u},
+  {0x1F5A5u, 5u},
+  {0x1F5A6u, 15u},
+  {0x1F5A8u, 5u},
+  {0x1F5A9u, 15u},
+  {0x1F5B1u, 5u},
+  {0x1F5B3u, 15u},
+  {0x1F5BCu, 5u},
+  {0x1F5BDu, 15u},
+  {0x1F5C2u, 5u},
+  {0x1F5C5u, 15u},
+  {0x1F5D1u, 5u},
+  {0x1F5D4u, 15u},
+  {0x1F5DCu, 5u},
+  {0x1F5DFu, 15u},
+  {0x1F5E1u, 5u},
+  {0x1F5E2u, 15u},
+  {0x1F5E3u, 5u},
+  {0x1F5E4u, 15u},
+  {0x1F5E8u, 5u},
+  {0x1F5E9u, 15u},
+  {0x1F5EFu, 5u},
+  {0x1F5F0u, 15u},
+  {0x1F5F3u, 5u},
+  {0x1F5F4u, 15u},
+  {0x1F5FAu, 5u},
+  {0x1F5FBu, 14u},
+  {0x1F645u, 17u},
+  {0x1F648u, 14u},
+  {0x1F64Bu, 17u},
+  {0x1F650u, 0u},
+  {0x1F680u, 14u},
+  {0x1F6A3u, 17u},
+  {0x1F6A4u, 14u},
+  {0x1F6B4u, 17u},
+  {0x1F6B7u, 14u},
+  {0x1F6C0u, 17u},
+  {0x1F6C1u, 14u},
+  {0x1F6C6u, 15u},
+  {0x1F6CBu, 5u},
+  {0x1F6CCu, 17u},
+  {0x1F6CDu, 5u},
+  {0x1F6D0u, 14u},
+  {0x1F6D3u, 15u},
+  {0x1F6D5u, 14u},
+  {0x1F6D8u, 15u},
+  {0x1F6DCu, 14u},
+  {0x1F6E0u, 5u},
+  {0x1F6E6u, 15u},
+  {0x1F6E9u, 5u},
+  {0x1F6EAu, 15u},
+  {0x1F6EBu, 14u},
+  {0x1F6EDu, 15u},
+  {0x1F6F0u, 5u},
+  {0x1F6F1u, 15u},
+  {0x1F6F3u, 5u},
+  {0x1F6F4u, 14u},
+  {0x1F6FDu, 15u},
+  {0x1F700u, 0u},
+  {0x1F774u, 15u},
+  {0x1F780u, 0u},
+  {0x1F7D5u, 15u},
+  {0x1F7E0u, 14u},
+  {0x1F7ECu, 15u},
+  {0x1F7F0u, 14u},
+  {0x1F7F1u, 15u},
+  {0x1F800u, 0u},
+  {0x1F80Cu, 15u},
+  {0x1F810u, 0u},
+  {0x1F848u, 15u},
+  {0x1F850u, 0u},
+  {0x1F85Au, 15u},
+  {0x1F860u, 0u},
+  {0x1F888u, 15u},
+  {0x1F890u, 0u},
+  {0x1F8AEu, 15u},
+  {0x1F900u, 0u},
+  {0x1F90Cu, 17u},
+  {0x1F90Du, 14u},
+  {0x1F90Fu, 17u},
+  {0x1F910u, 14u},
+  {0x1F918u, 17u},
+  {0x1F920u, 14u},
+  {0x1F926u, 17u},
+  {0x1F927u, 14u},
+  {0x1F930u, 17u},
+  {0x1F93Au, 14u},
+  {0x1F93Bu, 0u},
+  {0x1F93Cu, 17u},
+  {0x1F93Fu, 14u},
+  {0x1F946u, 0u},
+  {0x1F947u, 14u},
+  {0x1F977u, 17u},
+  {0x1F978u, 14u},
+  {0x1F9B0u, 22u},
+  {0x1F9B4u, 14u},
+  {0x1F9B5u, 17u},
+  {0x1F9B7u, 14u},
+  {0x1F9B8u, 17u},
+  {0x1F9BAu, 14u},
+  {0x1F9BBu, 17u},
+  {0x1F9BCu, 14u},
+  {0x1F9CDu, 17u},
+  {0x1F9D0u, 14u},
+  {0x1F9D1u, 17u},
+  {0x1F9DEu, 14u},
+  {0x1FA00u, 15u},
+  {0x1FA70u, 14u},
+  {0x1FA7Du, 15u},
+  {0x1FA80u, 14u},
+  {0x1FA89u, 15u},
+  {0x1FA90u, 14u},
+  {0x1FABEu, 15u},
+  {0x1FABFu, 14u},
+  {0x1FAC3u, 17u},
+  {0x1FAC6u, 15u},
+  {0x1FACEu, 14u},
+  {0x1FADCu, 15u},
+  {0x1FAE0u, 14u},
+  {0x1FAE9u, 15u},
+  {0x1FAF0u, 17u},
+  {0x1FAF9u, 15u},
+  {0x1FB00u, 0u},
+  {0x1FC00u, 15u},
+  {0x1FFFEu, 0u},
+  {0xE0000u, 1u},
+  {0xE0020u, 13u},
+  {0xE0080u, 1u},
+  {0xE0100u, 6u},
+  {0xE01F0u, 1u},
+  {0xE1000u, 0u}
+};
+
+// Usable at compile time, the tables are constant initialized read-only
+// data so there is nothing to construct at startup
+constexpr const property_entry& lookup_property(std::uint32_t cp) {
+  if (cp > 0x10FFFFu)
+    return property_entries[0];
+
+  // Binary search for the last range starting at or before cp, the
+  // first one starts at 0 so there always is one
+  std::size_t low = 1u;
+  std::size_t high = 2149u;
+  while (low < high) {
+    const std::size_t mid = low + (high - low) / 2u;
+    if (property_ranges[mid].start_ <= cp) {
+      low = mid + 1u;
+    } else {
+      high = mid;
+    }
+  }
+  return property_entries[property_ranges[low - 1u].entry_];
+}
+
+} // namespace detail
+} // namespace auc
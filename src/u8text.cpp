@@ -1,8 +1,18 @@
+#include "ascii.hpp"
+
 #include <algorithm>
 #include <array>
+#include <auc/decode.hpp>
+#include <auc/encode.hpp>
 #include <auc/graphemecluster.hpp>
 #include <auc/u8text.hpp>
+#include <auc/validation.hpp>
 #include <cstring>
+#include <future>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
 
 namespace auc {
 
@@ -10,113 +20,205 @@ namespace detail {
 
 std::size_t parse_bom(const char* bytes, const std::size_t length) {
   //  https://www.rfc-editor.org/rfc/rfc3629#section-6
-  if (length < 3)
-    return 0;
+  // Only a single leading EF BB BF is a BOM. Any U+FEFF after it is part of
+  // the text, as a ZERO WIDTH NO-BREAK SPACE.
+  constexpr std::string_view bom = "\xEF\xBB\xBF";
+  return std::string_view(bytes, length).starts_with(bom) ? bom.size() : 0u;
+}
 
-  auto bom_seq = [&bytes](std::size_t idx) -> bool {
-    return ((bytes[idx] & 0xEF) == 0xEF && (bytes[idx + 1u] & 0xBB) == 0xBB &&
-            (bytes[idx + 2u] & 0xBF) == 0xBF);
-  };
+}  // namespace detail
+
+namespace {
+
+// Below this many bytes per chunk, starting a thread costs more than it saves
+constexpr std::size_t min_parallel_chunk_size = 256u * 1024u;
+
+// Records the offset of every character in [first, last) of the text
+// starting at begin, first being the start of a character
+void index_chars(const char* begin,
+                 const char* first,
+                 const char* last,
+                 std::vector<std::uint32_t>& char_offsets) {
+  for (const char* p = first; p != last;) {
+    // Every byte of an ASCII run is a character of its own
+    if (static_cast<unsigned char>(*p) < 0x80u) {
+      const std::size_t run =
+          detail::ascii_prefix_length(p, static_cast<std::size_t>(last - p));
+      const std::size_t num_chars = char_offsets.size();
+      char_offsets.resize(num_chars + run);
+      std::iota(char_offsets.begin() + num_chars, char_offsets.end(),
+                static_cast<std::uint32_t>(p - begin));
+      p += run;
+      continue;
+    }
+
+    char_offsets.push_back(static_cast<std::uint32_t>(p - begin));
 
-  std::size_t idx{0};
+    // Skip to beginning of next utf8 character
+    decode_next(p, last);
+  }
+}
 
-  while (idx < length) {
-    if (bom_seq(idx)) {
-      idx += 3u;
-    } else {
+// The first character boundary at or after offset. Any byte other than a
+// continuation byte starts a character, as does the fourth of a run of
+// continuation bytes since no character has more than three.
+std::size_t next_char_boundary(std::string_view bytes, std::size_t offset) {
+  for (std::size_t num = 0u; num < 3u && offset < bytes.size(); ++num) {
+    if ((static_cast<unsigned char>(bytes[offset]) & 0xC0u) != 0x80u) {
       break;
     }
+    ++offset;
   }
-
-  return idx;
+  return offset;
 }
 
-}  // namespace detail
+}  // namespace
 
 u8text::u8text(std::string_view bytes) {
-  parse_chars(bytes.data(), bytes.length());
-  grapheme_clusters_ = detail::build_grapheme_clusters(chars_);
+  const std::size_t bom_length =
+      detail::parse_bom(bytes.data(), bytes.length());
+  bytes_.assign(bytes.substr(bom_length));
+  parse_chars();
 }
 
 // https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2019/p1423r2.html#reinterpret_cast
 // This shenangians needs to be done since the C++ Standard committee  decided
 // to make breaking changes to u8 string literals for C++20
 u8text::u8text(std::u8string_view bytes)
-    : u8text(std::string_view(reinterpret_cast<const char*>(bytes.data()))) {}
-
-u8text::u8text(const std::vector<u8char> chars) : chars_(chars) {
-  grapheme_clusters_ = detail::build_grapheme_clusters(chars_);
+    : u8text(std::string_view(reinterpret_cast<const char*>(bytes.data()),
+                              bytes.length())) {}
+
+u8text u8text::parse_parallel(std::string_view bytes,
+                              unsigned int num_threads) {
+  const std::size_t bom_length =
+      detail::parse_bom(bytes.data(), bytes.length());
+  u8text text;
+  text.bytes_.assign(bytes.substr(bom_length));
+  text.parse_chars_parallel(num_threads);
+  return text;
 }
 
 u8text u8text::from_codepoints(const std::vector<codepoint>& cps) {
-  std::vector<u8char> chars;
-  chars.reserve(cps.size());
+  u8text text;
 
-  for (const auto& cp : cps) {
-    chars.push_back(u8char::from_codepoint(cp));
-  }
+  // Codepoints that cannot be encoded leave no bytes behind, but still
+  // make the text invalid
+  text.valid_ = std::ranges::all_of(cps, [](const codepoint& cp) {
+    return cp.get_num() <= max_codepoint;
+  });
+
+  text.bytes_.resize(encoded_size(cps));
+  encode(cps, text.bytes_);
 
-  return u8text(chars);
+  text.parse_chars();
+  return text;
 }
 
 bool u8text::is_valid() const {
-  bool valid = true;
-  for (const auto& c : chars_) {
-    valid &= c.is_valid();
-  }
-  return valid;
+  return valid_;
 }
 
 std::vector<codepoint> u8text::get_codepoints() const {
   std::vector<codepoint> codepoints;
-  codepoints.reserve(chars_.size());
-  for (const auto& c : chars_) {
-    codepoints.push_back(c.get_codepoint());
+  codepoints.reserve(char_offsets_.size());
+
+  // Decoding stops at the same boundaries that parse_chars recorded
+  const char* p = bytes_.data();
+  const char* end = bytes_.data() + bytes_.size();
+  while (p != end) {
+    codepoints.emplace_back(decode_next(p, end).codepoint_);
   }
   return codepoints;
 }
 
-std::string u8text::data() const {
-  std::string raw_data;
-
-  for (const auto& c : chars_) {
-    raw_data.append(c.data());
+std::vector<graphemecluster> u8text::get_grapheme_clusters() const {
+  std::vector<graphemecluster> grapheme_clusters;
+
+  std::size_t char_idx = 0u;
+  for (const graphemecluster_view cluster_view : graphemes()) {
+    const std::string_view cluster_bytes = cluster_view.data();
+    const auto cluster_end =
+        static_cast<std::size_t>(cluster_bytes.data() - bytes_.data()) +
+        cluster_bytes.size();
+
+    graphemecluster cluster;
+    for (; char_idx < char_offsets_.size() &&
+           char_offsets_[char_idx] < cluster_end;
+         ++char_idx) {
+      cluster.chars_.emplace_back(char_bytes(char_idx));
+    }
+    grapheme_clusters.push_back(std::move(cluster));
   }
 
-  return raw_data;
+  return grapheme_clusters;
 }
 
-const std::vector<graphemecluster>& u8text::get_grapheme_clusters() const {
-  return grapheme_clusters_;
+std::string_view u8text::char_bytes(std::size_t char_idx) const {
+  const std::size_t begin = char_offsets_[char_idx];
+  const std::size_t end = (char_idx + 1u < char_offsets_.size())
+                              ? char_offsets_[char_idx + 1u]
+                              : bytes_.size();
+  return std::string_view{bytes_}.substr(begin, end - begin);
 }
 
-void u8text::parse_chars(const char* bytes, const std::size_t length) {
-  std::size_t idx = detail::parse_bom(bytes, length);
+void u8text::parse_chars() {
+  if (bytes_.size() > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::length_error("auc::u8text is limited to 4 GiB of UTF-8 data");
+  }
 
-  for (; idx < length;) {
-    const char initial_byte = bytes[idx];
+  valid_ &= validate_utf8(bytes_.data(), bytes_.size());
+  index_chars(bytes_.data(), bytes_.data(), bytes_.data() + bytes_.size(),
+              char_offsets_);
+}
 
-    // Peek first to get number of octets in the given utf8 character
-    const std::size_t num_octets = detail::num_octets(initial_byte);
-    if (num_octets < 1 || num_octets > 4) {
-      // Data is not valid utf-8, continue on to parse all characters
-      chars_.push_back(u8char{initial_byte});
-      ++idx;
-      continue;
-    }
+void u8text::parse_chars_parallel(unsigned int num_threads) {
+  if (bytes_.size() > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::length_error("auc::u8text is limited to 4 GiB of UTF-8 data");
+  }
 
-    // Up until the start + 1 index and last index
-    std::vector<char> u8bytes;
-    u8bytes.reserve(num_octets);
-    u8bytes.push_back(initial_byte);
-    for (std::size_t seq = idx + 1; seq < idx + num_octets; ++seq) {
-      u8bytes.push_back(bytes[seq]);
-    }
+  if (num_threads == 0u) {
+    num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  const std::size_t num_chunks = std::clamp<std::size_t>(
+      bytes_.size() / min_parallel_chunk_size, 1u, num_threads);
+
+  // Splitting at character boundaries lets each chunk be validated and
+  // indexed on its own: a sequence can only be ill-formed within a chunk
+  std::vector<std::size_t> chunk_offsets(num_chunks + 1u, bytes_.size());
+  chunk_offsets[0] = 0u;
+  for (std::size_t chunk_idx = 1u; chunk_idx < num_chunks; ++chunk_idx) {
+    chunk_offsets[chunk_idx] = next_char_boundary(
+        bytes_, std::max(chunk_offsets[chunk_idx - 1u],
+                         bytes_.size() / num_chunks * chunk_idx));
+  }
 
-    chars_.emplace_back(std::string_view{u8bytes.data(), num_octets});
+  struct parsed_chunk {
+    bool valid_{true};
+    std::vector<std::uint32_t> char_offsets_;
+  };
+  const auto parse_chunk = [this, &chunk_offsets](std::size_t chunk_idx) {
+    const char* first = bytes_.data() + chunk_offsets[chunk_idx];
+    const char* last = bytes_.data() + chunk_offsets[chunk_idx + 1u];
+    parsed_chunk chunk;
+    chunk.valid_ =
+        validate_utf8(first, static_cast<std::size_t>(last - first));
+    index_chars(bytes_.data(), first, last, chunk.char_offsets_);
+    return chunk;
+  };
 
-    // Skip to beginning of next utf8 character
-    idx += num_octets;
+  // The calling thread parses the first chunk itself
+  std::vector<std::future<parsed_chunk>> chunks;
+  for (std::size_t chunk_idx = 1u; chunk_idx < num_chunks; ++chunk_idx) {
+    chunks.push_back(std::async(std::launch::async, parse_chunk, chunk_idx));
+  }
+  parsed_chunk first_chunk = parse_chunk(0u);
+  valid_ &= first_chunk.valid_;
+  char_offsets_ = std::move(first_chunk.char_offsets_);
+  for (std::future<parsed_chunk>& chunk_future : chunks) {
+    const parsed_chunk chunk = chunk_future.get();
+    valid_ &= chunk.valid_;
+    char_offsets_.insert(char_offsets_.end(), chunk.char_offsets_.begin(),
+                         chunk.char_offsets_.end());
   }
 }
 
@@ -0,0 +1,19 @@
+#include <auc/u8text.hpp>
+#include <auc/u8text_view.hpp>
+#include <auc/validation.hpp>
+
+namespace auc {
+
+u8text_view::u8text_view(std::string_view bytes) : bytes_(bytes) {
+  bytes_.remove_prefix(detail::parse_bom(bytes.data(), bytes.length()));
+}
+
+u8text_view::u8text_view(std::u8string_view bytes)
+    : u8text_view(std::string_view(reinterpret_cast<const char*>(bytes.data()),
+                                   bytes.length())) {}
+
+bool u8text_view::is_valid() const {
+  return validate_utf8(bytes_.data(), bytes_.size());
+}
+
+}  // namespace auc
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <array>
+#include <auc/decode.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// https://www.rfc-editor.org/rfc/rfc3629#section-4
+// A table driven DFA accepting exactly the well-formed UTF-8 sequences:
+//
+//   UTF8-1      = %x00-7F
+//   UTF8-2      = %xC2-DF UTF8-tail
+//   UTF8-3      = %xE0 %xA0-BF UTF8-tail / %xE1-EC 2( UTF8-tail ) /
+//                 %xED %x80-9F UTF8-tail / %xEE-EF 2( UTF8-tail )
+//   UTF8-4      = %xF0 %x90-BF 2( UTF8-tail ) / %xF1-F3 3( UTF8-tail ) /
+//                 %xF4 %x80-8F 2( UTF8-tail )
+//   UTF8-tail   = %x80-BF
+//
+// Bytes are first mapped to one of 12 classes, which together with the
+// current state index the transition table. Overlong encodings (C0, C1,
+// E0 80-9F, F0 80-8F), surrogates (ED A0-BF), codepoints past U+10FFFF
+// (F4 90-BF, F5-FF) and stray or missing continuation bytes all end up in
+// the Utf8Reject state, which is a sink.
+namespace auc {
+namespace detail {
+
+enum utf8_state : std::uint8_t {
+  Utf8Accept = 0,  // At the start of a character
+  Utf8Reject = 1,
+  Utf8Tail1 = 2,   // Expecting 1 more UTF8-tail
+  Utf8Tail2 = 3,   // Expecting 2 more UTF8-tail
+  Utf8Tail3 = 4,   // Expecting 3 more UTF8-tail
+  Utf8LeadE0 = 5,  // Expecting %xA0-BF then 1 UTF8-tail
+  Utf8LeadED = 6,  // Expecting %x80-9F then 1 UTF8-tail
+  Utf8LeadF0 = 7,  // Expecting %x90-BF then 2 UTF8-tail
+  Utf8LeadF4 = 8   // Expecting %x80-8F then 2 UTF8-tail
+};
+constexpr std::size_t utf8_num_states = 9u;
+
+enum utf8_class : std::uint8_t {
+  ClassAscii = 0,    // 00-7F
+  ClassTail80 = 1,   // 80-8F
+  ClassTail90 = 2,   // 90-9F
+  ClassTailA0 = 3,   // A0-BF
+  ClassInvalid = 4,  // C0-C1, F5-FF
+  ClassLead2 = 5,    // C2-DF
+  ClassE0 = 6,       // E0
+  ClassLead3 = 7,    // E1-EC, EE-EF
+  ClassED = 8,       // ED
+  ClassF0 = 9,       // F0
+  ClassLead4 = 10,   // F1-F3
+  ClassF4 = 11       // F4
+};
+constexpr std::size_t utf8_num_classes = 12u;
+
+constexpr utf8_class classify(std::uint8_t byte) {
+  if (byte < 0x80u)
+    return ClassAscii;
+  if (byte < 0x90u)
+    return ClassTail80;
+  if (byte < 0xA0u)
+    return ClassTail90;
+  if (byte < 0xC0u)
+    return ClassTailA0;
+  if (byte < 0xC2u)
+    return ClassInvalid;
+  if (byte < 0xE0u)
+    return ClassLead2;
+  if (byte == 0xE0u)
+    return ClassE0;
+  if (byte == 0xEDu)
+    return ClassED;
+  if (byte < 0xF0u)
+    return ClassLead3;
+  if (byte == 0xF0u)
+    return ClassF0;
+  if (byte < 0xF4u)
+    return ClassLead4;
+  if (byte == 0xF4u)
+    return ClassF4;
+  return ClassInvalid;
+}
+
+constexpr utf8_state transition(utf8_state state, utf8_class byte_class) {
+  const bool is_tail = (byte_class == ClassTail80 ||
+                        byte_class == ClassTail90 || byte_class == ClassTailA0);
+  switch (state) {
+    case Utf8Accept:
+      switch (byte_class) {
+        case ClassAscii:
+          return Utf8Accept;
+        case ClassLead2:
+          return Utf8Tail1;
+        case ClassE0:
+          return Utf8LeadE0;
+        case ClassLead3:
+          return Utf8Tail2;
+        case ClassED:
+          return Utf8LeadED;
+        case ClassF0:
+          return Utf8LeadF0;
+        case ClassLead4:
+          return Utf8Tail3;
+        case ClassF4:
+          return Utf8LeadF4;
+        default:
+          return Utf8Reject;
+      }
+    case Utf8Tail1:
+      return is_tail ? Utf8Accept : Utf8Reject;
+    case Utf8Tail2:
+      return is_tail ? Utf8Tail1 : Utf8Reject;
+    case Utf8Tail3:
+      return is_tail ? Utf8Tail2 : Utf8Reject;
+    case Utf8LeadE0:
+      return (byte_class == ClassTailA0) ? Utf8Tail1 : Utf8Reject;
+    case Utf8LeadED:
+      return (byte_class == ClassTail80 || byte_class == ClassTail90)
+                 ? Utf8Tail1
+                 : Utf8Reject;
+    case Utf8LeadF0:
+      return (byte_class == ClassTail90 || byte_class == ClassTailA0)
+                 ? Utf8Tail2
+                 : Utf8Reject;
+    case Utf8LeadF4:
+      return (byte_class == ClassTail80) ? Utf8Tail2 : Utf8Reject;
+    case Utf8Reject:
+    default:
+      return Utf8Reject;
+  }
+}
+
+inline constexpr std::array<utf8_class, 256> utf8_class_table = [] {
+  std::array<utf8_class, 256> table{};
+  for (std::size_t byte = 0u; byte < table.size(); ++byte) {
+    table[byte] = classify(static_cast<std::uint8_t>(byte));
+  }
+  return table;
+}();
+
+// Indexed by (state * utf8_num_classes + class)
+inline constexpr std::array<utf8_state, utf8_num_states * utf8_num_classes>
+    utf8_transition_table = [] {
+      std::array<utf8_state, utf8_num_states * utf8_num_classes> table{};
+      for (std::size_t state = 0u; state < utf8_num_states; ++state) {
+        for (std::size_t byte_class = 0u; byte_class < utf8_num_classes;
+             ++byte_class) {
+          table[state * utf8_num_classes + byte_class] =
+              transition(static_cast<utf8_state>(state),
+                         static_cast<utf8_class>(byte_class));
+        }
+      }
+      return table;
+    }();
+
+inline utf8_state next_state(utf8_state state, char byte) {
+  const std::size_t byte_class =
+      utf8_class_table[static_cast<std::uint8_t>(byte)];
+  return utf8_transition_table[state * utf8_num_classes + byte_class];
+}
+
+// The payload bits of a lead byte, by class
+inline constexpr std::array<std::uint8_t, utf8_num_classes> utf8_lead_mask = {
+    0x7Fu,  // ClassAscii
+    0x00u,  // ClassTail80
+    0x00u,  // ClassTail90
+    0x00u,  // ClassTailA0
+    0x00u,  // ClassInvalid
+    0x1Fu,  // ClassLead2
+    0x0Fu,  // ClassE0
+    0x0Fu,  // ClassLead3
+    0x0Fu,  // ClassED
+    0x07u,  // ClassF0
+    0x07u,  // ClassLead4
+    0x07u   // ClassF4
+};
+
+// Runs the DFA over a single character, accumulating its codepoint on the
+// way. Each byte costs two table lookups, a shift and a mask; there is no
+// branching on the length of the sequence.
+inline decode_result decode_char(const char*& p, const char* end) {
+  const auto lead = static_cast<std::uint8_t>(*p);
+  if (lead < 0x80u) {
+    ++p;
+    return decode_result{lead, decode_status::Ok};
+  }
+
+  const char* begin = p;
+  utf8_state state = Utf8Accept;
+  std::uint32_t codepoint = 0u;
+  do {
+    const auto byte = static_cast<std::uint8_t>(*p);
+    const utf8_class byte_class = utf8_class_table[byte];
+    const utf8_state next =
+        utf8_transition_table[state * utf8_num_classes + byte_class];
+    if (next == Utf8Reject) {
+      // The byte which made the sequence ill-formed starts the next one,
+      // unless it is the lead byte itself
+      p += (p == begin) ? 1 : 0;
+      return decode_result{};
+    }
+
+    codepoint = (state == Utf8Accept)
+                    ? (byte & utf8_lead_mask[byte_class])
+                    : ((codepoint << 6u) | (byte & 0x3Fu));
+    state = next;
+    ++p;
+  } while (state != Utf8Accept && p != end);
+
+  if (state != Utf8Accept) {
+    return decode_result{replacement_character, decode_status::Truncated};
+  }
+  return decode_result{codepoint, decode_status::Ok};
+}
+
+}  // namespace detail
+}  // namespace auc
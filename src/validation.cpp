@@ -0,0 +1,246 @@
+#include "ascii.hpp"
+#include "utf8_dfa.hpp"
+#include "validation_kernels.hpp"
+
+#include <auc/validation.hpp>
+
+#if defined(AUC_X86_64_KERNELS)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace auc {
+
+namespace detail {
+
+bool validate_utf8_scalar(const char* bytes, std::size_t length) {
+  utf8_state state = Utf8Accept;
+  for (std::size_t idx = 0u; idx < length; ++idx) {
+    // ASCII runs between characters can be skipped a word at a time
+    if (state == Utf8Accept) {
+      idx += ascii_prefix_length_words(bytes + idx, length - idx);
+      if (idx == length) {
+        break;
+      }
+    }
+    state = next_state(state, bytes[idx]);
+    if (state == Utf8Reject) {
+      return false;
+    }
+  }
+  return (state == Utf8Accept);
+}
+
+#if defined(AUC_X86_64_KERNELS)
+namespace {
+
+void cpuid(unsigned int leaf, unsigned int subleaf, unsigned int (&regs)[4]) {
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+  for (int idx = 0; idx < 4; ++idx) {
+    regs[idx] = static_cast<unsigned int>(info[idx]);
+  }
+#else
+  __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+unsigned long long xgetbv() {
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  unsigned int eax = 0u;
+  unsigned int edx = 0u;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0u));
+  return (static_cast<unsigned long long>(edx) << 32u) | eax;
+#endif
+}
+
+}  // namespace
+#endif
+
+simd_level detect_simd_level() {
+#if defined(AUC_X86_64_KERNELS)
+  unsigned int regs[4] = {};
+  cpuid(0u, 0u, regs);
+  const unsigned int max_leaf = regs[0];
+
+  cpuid(1u, 0u, regs);
+  const bool sse42 = (regs[2] >> 20u) & 1u;
+  const bool osxsave = (regs[2] >> 27u) & 1u;
+  if (!sse42) {
+    return simd_level::Scalar;
+  }
+  if (!osxsave || max_leaf < 7u) {
+    return simd_level::SSE42;
+  }
+
+  // The OS has to save the YMM (and for AVX-512 the opmask and ZMM) state
+  // across context switches for the wider registers to be usable
+  const unsigned long long xcr0 = xgetbv();
+  const bool ymm_state = (xcr0 & 0x6u) == 0x6u;
+  const bool zmm_state = (xcr0 & 0xE6u) == 0xE6u;
+
+  cpuid(7u, 0u, regs);
+  const bool avx2 = (regs[1] >> 5u) & 1u;
+  const bool avx512f = (regs[1] >> 16u) & 1u;
+  const bool avx512bw = (regs[1] >> 30u) & 1u;
+
+  if (avx512f && avx512bw && zmm_state) {
+    return simd_level::AVX512;
+  }
+  if (avx2 && ymm_state) {
+    return simd_level::AVX2;
+  }
+  return simd_level::SSE42;
+#else
+  return simd_level::Scalar;
+#endif
+}
+
+namespace {
+
+using validate_kernel = bool (*)(const char*, std::size_t);
+
+validate_kernel select_kernel(simd_level level) {
+  switch (level) {
+#if defined(AUC_X86_64_KERNELS)
+    case simd_level::AVX512:
+      return validate_utf8_avx512;
+    case simd_level::AVX2:
+      return validate_utf8_avx2;
+    case simd_level::SSE42:
+      return validate_utf8_sse42;
+#endif
+    case simd_level::Scalar:
+    default:
+      return validate_utf8_scalar;
+  }
+}
+
+using ascii_kernel = std::size_t (*)(const char*, std::size_t);
+
+ascii_kernel select_ascii_kernel(simd_level level) {
+  switch (level) {
+#if defined(AUC_X86_64_KERNELS)
+    case simd_level::AVX512:
+      return ascii_prefix_length_avx512;
+    case simd_level::AVX2:
+      return ascii_prefix_length_avx2;
+    case simd_level::SSE42:
+      return ascii_prefix_length_sse42;
+#endif
+    case simd_level::Scalar:
+    default:
+      return ascii_prefix_length_words;
+  }
+}
+
+}  // namespace
+
+bool validate_utf8(simd_level level, const char* bytes, std::size_t length) {
+  return select_kernel(level)(bytes, length);
+}
+
+std::size_t ascii_prefix_length(const char* bytes, std::size_t length) {
+  static const ascii_kernel kernel = select_ascii_kernel(detect_simd_level());
+  return kernel(bytes, length);
+}
+
+}  // namespace detail
+
+bool validate_utf8(const char* bytes, std::size_t length) {
+  static const detail::validate_kernel kernel =
+      detail::select_kernel(detail::detect_simd_level());
+  return kernel(bytes, length);
+}
+
+namespace {
+
+// Offset of the first ill-formed sequence in bytes, the maximal subpart
+// ending at the byte the DFA rejects
+std::size_t ill_formed_offset(const char* bytes, std::size_t length) {
+  detail::utf8_state state = detail::Utf8Accept;
+  std::size_t sequence_offset = 0u;
+  for (std::size_t idx = 0u; idx < length; ++idx) {
+    if (state == detail::Utf8Accept) {
+      sequence_offset = idx;
+    }
+    state = detail::next_state(state, bytes[idx]);
+    if (state == detail::Utf8Reject) {
+      break;
+    }
+  }
+  return sequence_offset;
+}
+
+// Where the character which the end of bytes cuts short starts, or the end
+// of bytes if there isn't one. Its lead byte has to be one of the last 3.
+std::size_t partial_char_offset(std::string_view bytes) {
+  const std::size_t limit = (bytes.size() > 3u) ? bytes.size() - 3u : 0u;
+  for (std::size_t idx = bytes.size(); idx > limit; --idx) {
+    const auto byte = static_cast<std::uint8_t>(bytes[idx - 1u]);
+    if ((byte & 0xC0u) == 0x80u) {
+      continue;
+    }
+    const std::size_t num_bytes =
+        (byte >= 0xF0u) ? 4u : (byte >= 0xE0u) ? 3u : (byte >= 0xC0u) ? 2u : 1u;
+    return (idx - 1u + num_bytes > bytes.size()) ? idx - 1u : bytes.size();
+  }
+  return bytes.size();
+}
+
+}  // namespace
+
+bool utf8_validator::update(std::string_view chunk) {
+  if (error_offset_) {
+    return false;
+  }
+
+  // Finish off the character split by the previous chunk first
+  auto state = static_cast<detail::utf8_state>(partial_state_);
+  std::size_t idx = 0u;
+  for (; idx < chunk.size() && state != detail::Utf8Accept; ++idx) {
+    state = detail::next_state(state, chunk[idx]);
+    if (state == detail::Utf8Reject) {
+      error_offset_ = partial_offset_;
+      return false;
+    }
+  }
+
+  // The whole characters after it are validated in bulk, and the one the
+  // end of the chunk cuts short is carried over to the next chunk
+  const std::string_view rest = chunk.substr(idx);
+  const std::size_t partial = partial_char_offset(rest);
+  if (!validate_utf8(rest.data(), partial)) {
+    error_offset_ = offset_ + idx + ill_formed_offset(rest.data(), partial);
+    return false;
+  }
+  if (partial < rest.size()) {
+    partial_offset_ = offset_ + idx + partial;
+    for (const char byte : rest.substr(partial)) {
+      state = detail::next_state(state, byte);
+      if (state == detail::Utf8Reject) {
+        error_offset_ = partial_offset_;
+        return false;
+      }
+    }
+  }
+
+  partial_state_ = state;
+  offset_ += chunk.size();
+  return true;
+}
+
+bool utf8_validator::finish() {
+  if (!error_offset_ && partial_state_ != detail::Utf8Accept) {
+    error_offset_ = partial_offset_;
+  }
+  return !error_offset_;
+}
+
+}  // namespace auc
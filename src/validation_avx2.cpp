@@ -0,0 +1,63 @@
+#include "validation_kernels.hpp"
+#include "validation_lookup.hpp"
+
+#include <immintrin.h>
+
+namespace auc {
+namespace detail {
+namespace {
+
+struct avx2 {
+  using vec = __m256i;
+  static constexpr std::size_t width = 32u;
+
+  static vec load(const char* bytes) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+  }
+  static vec table(const std::uint8_t (&values)[16]) {
+    return _mm256_broadcastsi128_si256(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(values)));
+  }
+  static vec zero() { return _mm256_setzero_si256(); }
+  static vec splat(std::uint8_t value) {
+    return _mm256_set1_epi8(static_cast<char>(value));
+  }
+
+  static vec bit_and(vec a, vec b) { return _mm256_and_si256(a, b); }
+  static vec bit_or(vec a, vec b) { return _mm256_or_si256(a, b); }
+  static vec bit_xor(vec a, vec b) { return _mm256_xor_si256(a, b); }
+  static vec saturating_sub(vec a, vec b) { return _mm256_subs_epu8(a, b); }
+
+  static vec high_nibble(vec v) {
+    return _mm256_and_si256(_mm256_srli_epi16(v, 4), splat(0x0Fu));
+  }
+  static vec low_nibble(vec v) { return _mm256_and_si256(v, splat(0x0Fu)); }
+  static vec lookup(vec nibbles, vec values) {
+    return _mm256_shuffle_epi8(values, nibbles);
+  }
+
+  // The last N bytes of prev_input followed by the first bytes of input.
+  // alignr works within 128-bit lanes, so the lanes are first lined up as
+  // [prev_input.hi, input.lo] to shift from.
+  template <int N>
+  static vec prev(vec input, vec prev_input) {
+    return _mm256_alignr_epi8(
+        input, _mm256_permute2x128_si256(prev_input, input, 0x21), 16 - N);
+  }
+
+  static bool is_ascii(vec v) { return _mm256_movemask_epi8(v) == 0; }
+  static bool any(vec v) { return !_mm256_testz_si256(v, v); }
+};
+
+}  // namespace
+
+bool validate_utf8_avx2(const char* bytes, std::size_t length) {
+  return lookup_validator<avx2>{}.validate(bytes, length);
+}
+
+std::size_t ascii_prefix_length_avx2(const char* bytes, std::size_t length) {
+  return ascii_prefix_length_blocks<avx2>(bytes, length);
+}
+
+}  // namespace detail
+}  // namespace auc
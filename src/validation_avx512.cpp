@@ -0,0 +1,63 @@
+#include "validation_kernels.hpp"
+#include "validation_lookup.hpp"
+
+#include <immintrin.h>
+
+namespace auc {
+namespace detail {
+namespace {
+
+struct avx512 {
+  using vec = __m512i;
+  static constexpr std::size_t width = 64u;
+
+  static vec load(const char* bytes) { return _mm512_loadu_si512(bytes); }
+  static vec table(const std::uint8_t (&values)[16]) {
+    return _mm512_broadcast_i32x4(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(values)));
+  }
+  static vec zero() { return _mm512_setzero_si512(); }
+  static vec splat(std::uint8_t value) {
+    return _mm512_set1_epi8(static_cast<char>(value));
+  }
+
+  static vec bit_and(vec a, vec b) { return _mm512_and_si512(a, b); }
+  static vec bit_or(vec a, vec b) { return _mm512_or_si512(a, b); }
+  static vec bit_xor(vec a, vec b) { return _mm512_xor_si512(a, b); }
+  static vec saturating_sub(vec a, vec b) { return _mm512_subs_epu8(a, b); }
+
+  static vec high_nibble(vec v) {
+    return _mm512_and_si512(_mm512_srli_epi16(v, 4), splat(0x0Fu));
+  }
+  static vec low_nibble(vec v) { return _mm512_and_si512(v, splat(0x0Fu)); }
+  static vec lookup(vec nibbles, vec values) {
+    return _mm512_shuffle_epi8(values, nibbles);
+  }
+
+  // The last N bytes of prev_input followed by the first bytes of input.
+  // alignr works within 128-bit lanes, so the lanes are first lined up as
+  // [prev_input.3, input.0, input.1, input.2] to shift from.
+  template <int N>
+  static vec prev(vec input, vec prev_input) {
+    const vec shifted_lanes = _mm512_permutex2var_epi64(
+        prev_input, _mm512_set_epi64(13, 12, 11, 10, 9, 8, 7, 6), input);
+    return _mm512_alignr_epi8(input, shifted_lanes, 16 - N);
+  }
+
+  static bool is_ascii(vec v) { return _mm512_movepi8_mask(v) == 0u; }
+  static bool any(vec v) { return _mm512_test_epi8_mask(v, v) != 0u; }
+};
+
+}  // namespace
+
+bool validate_utf8_avx512(const char* bytes, std::size_t length) {
+  return lookup_validator<avx512>{}.validate(bytes, length);
+}
+
+std::size_t ascii_prefix_length_avx512(const char* bytes,
+                                       std::size_t length) {
+  return ascii_prefix_length_blocks<avx512>(bytes, length);
+}
+
+}  // namespace detail
+}  // namespace auc
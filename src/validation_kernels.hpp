@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+namespace auc {
+namespace detail {
+
+bool validate_utf8_scalar(const char* bytes, std::size_t length);
+
+#if defined(AUC_X86_64_KERNELS)
+bool validate_utf8_sse42(const char* bytes, std::size_t length);
+bool validate_utf8_avx2(const char* bytes, std::size_t length);
+bool validate_utf8_avx512(const char* bytes, std::size_t length);
+
+std::size_t ascii_prefix_length_sse42(const char* bytes, std::size_t length);
+std::size_t ascii_prefix_length_avx2(const char* bytes, std::size_t length);
+std::size_t ascii_prefix_length_avx512(const char* bytes, std::size_t length);
+#endif
+
+}  // namespace detail
+}  // namespace auc
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "ascii.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// NOTE: This header is only included by the validation_<isa>.cpp kernels,
+// each of which is compiled for its own instruction set. Everything here has
+// internal linkage so that none of it can leak into code that runs on CPUs
+// without that instruction set.
+
+// Vectorized validation as described in "Validating UTF-8 In Less Than One
+// Instruction Per Byte" (John Keiser, Daniel Lemire).
+//   https://arxiv.org/abs/2010.03090
+// Every byte is classified from the high and low nibble of the byte before
+// it and the high nibble of the byte itself via three 16 entry lookup
+// tables. Each error category owns a bit in the lookup values, so a byte
+// pair is invalid when a bit survives ANDing the three lookups together.
+// Checking that 3rd and 4th octets are continuations is done separately.
+namespace auc {
+namespace detail {
+namespace {
+
+// 11______ 0_______
+// 11______ 11______
+constexpr std::uint8_t TooShort = 1u << 0u;
+// 0_______ 10______
+constexpr std::uint8_t TooLong = 1u << 1u;
+// 11100000 100_____
+constexpr std::uint8_t Overlong3 = 1u << 2u;
+// 11110100 1001____
+// 11110100 101_____
+// 11110101 1001____
+// 11110101 101_____
+// 1111011_ 1001____
+// 1111011_ 101_____
+// 11111___ 1001____
+// 11111___ 101_____
+constexpr std::uint8_t TooLarge = 1u << 3u;
+// 11101101 101_____
+constexpr std::uint8_t Surrogate = 1u << 4u;
+// 1100000_ 10______
+constexpr std::uint8_t Overlong2 = 1u << 5u;
+// 11110101 1000____
+// 1111011_ 1000____
+// 11111___ 1000____
+constexpr std::uint8_t TooLarge1000 = 1u << 6u;
+// 11110000 1000____
+constexpr std::uint8_t Overlong4 = 1u << 6u;
+// 10______ 10______
+constexpr std::uint8_t TwoConts = 1u << 7u;
+// These all have ____ in byte 1
+constexpr std::uint8_t Carry = TooShort | TooLong | TwoConts;
+
+alignas(16) constexpr std::uint8_t byte_1_high_table[16] = {
+    // 0_______ ________ <ASCII in byte 1>
+    TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+    // 10______ ________ <continuation in byte 1>
+    TwoConts, TwoConts, TwoConts, TwoConts,
+    // 1100____ ________ <two byte lead in byte 1>
+    TooShort | Overlong2,
+    // 1101____ ________ <two byte lead in byte 1>
+    TooShort,
+    // 1110____ ________ <three byte lead in byte 1>
+    TooShort | Overlong3 | Surrogate,
+    // 1111____ ________ <four+ byte lead in byte 1>
+    TooShort | TooLarge | TooLarge1000 | Overlong4};
+
+alignas(16) constexpr std::uint8_t byte_1_low_table[16] = {
+    // ____0000 ________
+    Carry | Overlong3 | Overlong2 | Overlong4,
+    // ____0001 ________
+    Carry | Overlong2,
+    // ____001_ ________
+    Carry, Carry,
+    // ____0100 ________
+    Carry | TooLarge,
+    // ____0101 ________
+    Carry | TooLarge | TooLarge1000,
+    // ____011_ ________
+    Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000,
+    // ____1___ ________
+    Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,
+    // ____1101 ________
+    Carry | TooLarge | TooLarge1000 | Surrogate,
+    Carry | TooLarge | TooLarge1000, Carry | TooLarge | TooLarge1000};
+
+alignas(16) constexpr std::uint8_t byte_2_high_table[16] = {
+    // ________ 0_______ <ASCII in byte 2>
+    TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+    TooShort,
+    // ________ 1000____
+    TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,
+    // ________ 1001____
+    TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+    // ________ 101_____
+    TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+    TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+    // ________ 11______
+    TooShort, TooShort, TooShort, TooShort};
+
+// A block is incomplete when any of its last 3 bytes is a lead byte whose
+// sequence doesn't fit within the block. Kernels load the last simd::width
+// bytes of this as the per byte maximum.
+alignas(64) constexpr std::uint8_t incomplete_max_table[64] = {
+    255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u,
+    255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u,
+    255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u,
+    255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u,
+    255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u,
+    255u, 0xF0u - 1u, 0xE0u - 1u, 0xC0u - 1u};
+static_assert(incomplete_max_table[60] == 255u);
+
+template <class simd>
+class lookup_validator {
+ public:
+  using vec = typename simd::vec;
+
+  bool validate(const char* bytes, std::size_t length) {
+    std::size_t idx = 0u;
+    for (; idx + simd::width <= length; idx += simd::width) {
+      check_block(simd::load(bytes + idx));
+    }
+
+    if (idx < length) {
+      // Pad the tail with ASCII NULs, which can't hide errors in the last
+      // sequence as they are never continuation bytes
+      alignas(64) char tail[simd::width] = {};
+      std::memcpy(tail, bytes + idx, length - idx);
+      check_block(simd::load(tail));
+    }
+
+    error_ = simd::bit_or(error_, prev_incomplete_);
+    return !simd::any(error_);
+  }
+
+ private:
+  void check_block(vec input) {
+    if (simd::is_ascii(input)) {
+      // An ASCII block can't contain errors, though it can be where an
+      // incomplete sequence from the previous block was cut short
+      error_ = simd::bit_or(error_, prev_incomplete_);
+      prev_incomplete_ = simd::zero();
+    } else {
+      const vec prev1 = simd::template prev<1>(input, prev_input_);
+      const vec special_cases = simd::bit_and(
+          simd::bit_and(simd::lookup(simd::high_nibble(prev1), byte_1_high_),
+                        simd::lookup(simd::low_nibble(prev1), byte_1_low_)),
+          simd::lookup(simd::high_nibble(input), byte_2_high_));
+
+      // Only 111_____ will be >= 0x80 after subtracting, likewise 1111____
+      const vec prev2 = simd::template prev<2>(input, prev_input_);
+      const vec prev3 = simd::template prev<3>(input, prev_input_);
+      const vec is_third_byte =
+          simd::saturating_sub(prev2, simd::splat(0xE0u - 0x80u));
+      const vec is_fourth_byte =
+          simd::saturating_sub(prev3, simd::splat(0xF0u - 0x80u));
+      const vec must_be_continuation = simd::bit_and(
+          simd::bit_or(is_third_byte, is_fourth_byte), simd::splat(0x80u));
+
+      error_ = simd::bit_or(error_,
+                            simd::bit_xor(must_be_continuation, special_cases));
+      prev_incomplete_ = simd::saturating_sub(input, incomplete_max_);
+    }
+    prev_input_ = input;
+  }
+
+  const vec byte_1_high_ = simd::table(byte_1_high_table);
+  const vec byte_1_low_ = simd::table(byte_1_low_table);
+  const vec byte_2_high_ = simd::table(byte_2_high_table);
+  const vec incomplete_max_ = simd::load(reinterpret_cast<const char*>(
+      incomplete_max_table + sizeof(incomplete_max_table) - simd::width));
+
+  vec error_ = simd::zero();
+  vec prev_input_ = simd::zero();
+  vec prev_incomplete_ = simd::zero();
+};
+
+// Skips whole ASCII blocks before finishing off a word at a time
+template <class simd>
+std::size_t ascii_prefix_length_blocks(const char* bytes, std::size_t length) {
+  std::size_t idx = 0u;
+  while (idx + simd::width <= length &&
+         simd::is_ascii(simd::load(bytes + idx))) {
+    idx += simd::width;
+  }
+  return idx + ascii_prefix_length_words(bytes + idx, length - idx);
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace auc
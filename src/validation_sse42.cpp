@@ -0,0 +1,59 @@
+#include "validation_kernels.hpp"
+#include "validation_lookup.hpp"
+
+#include <immintrin.h>
+
+namespace auc {
+namespace detail {
+namespace {
+
+struct sse42 {
+  using vec = __m128i;
+  static constexpr std::size_t width = 16u;
+
+  static vec load(const char* bytes) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+  }
+  static vec table(const std::uint8_t (&values)[16]) {
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(values));
+  }
+  static vec zero() { return _mm_setzero_si128(); }
+  static vec splat(std::uint8_t value) {
+    return _mm_set1_epi8(static_cast<char>(value));
+  }
+
+  static vec bit_and(vec a, vec b) { return _mm_and_si128(a, b); }
+  static vec bit_or(vec a, vec b) { return _mm_or_si128(a, b); }
+  static vec bit_xor(vec a, vec b) { return _mm_xor_si128(a, b); }
+  static vec saturating_sub(vec a, vec b) { return _mm_subs_epu8(a, b); }
+
+  static vec high_nibble(vec v) {
+    return _mm_and_si128(_mm_srli_epi16(v, 4), splat(0x0Fu));
+  }
+  static vec low_nibble(vec v) { return _mm_and_si128(v, splat(0x0Fu)); }
+  static vec lookup(vec nibbles, vec values) {
+    return _mm_shuffle_epi8(values, nibbles);
+  }
+
+  // The last N bytes of prev_input followed by the first bytes of input
+  template <int N>
+  static vec prev(vec input, vec prev_input) {
+    return _mm_alignr_epi8(input, prev_input, 16 - N);
+  }
+
+  static bool is_ascii(vec v) { return _mm_movemask_epi8(v) == 0; }
+  static bool any(vec v) { return !_mm_testz_si128(v, v); }
+};
+
+}  // namespace
+
+bool validate_utf8_sse42(const char* bytes, std::size_t length) {
+  return lookup_validator<sse42>{}.validate(bytes, length);
+}
+
+std::size_t ascii_prefix_length_sse42(const char* bytes, std::size_t length) {
+  return ascii_prefix_length_blocks<sse42>(bytes, length);
+}
+
+}  // namespace detail
+}  // namespace auc
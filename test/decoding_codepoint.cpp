@@ -1,6 +1,13 @@
 ﻿#include <gtest/gtest.h>
 
+#include <auc/decode.hpp>
 #include <auc/u8text.hpp>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "random_input.hpp"
 
 TEST(decoding_codepoint, valid_utf8) {
   char8_t utf8_chars[] = u8"߿က$£ह€한𐍈򟿿";
@@ -19,3 +26,112 @@ TEST(decoding_codepoint, valid_utf8) {
   EXPECT_EQ(codepoints[7].get_num(), 0x10348);
   EXPECT_EQ(codepoints[8].get_num(), 0x9FFFF);
 }
+
+TEST(decoding_codepoint, decode_next) {
+  const std::string_view bytes{"$\xC2\xA3\xE2\x82\xAC\xF0\x90\x8D\x88"};
+  const char* p = bytes.data();
+  const char* end = bytes.data() + bytes.size();
+
+  const std::uint32_t expected[] = {0x24u, 0xA3u, 0x20ACu, 0x10348u};
+  const std::size_t sizes[] = {1u, 2u, 3u, 4u};
+  for (std::size_t idx = 0u; idx < 4u; ++idx) {
+    const char* before = p;
+    const auc::decode_result decoded = auc::decode_next(p, end);
+    EXPECT_EQ(decoded.status_, auc::decode_status::Ok);
+    EXPECT_EQ(decoded.codepoint_, expected[idx]);
+    EXPECT_EQ(static_cast<std::size_t>(p - before), sizes[idx]);
+  }
+  EXPECT_EQ(p, end);
+}
+
+TEST(decoding_codepoint, decode_next_invalid) {
+  // Overlong, surrogate, stray continuation and a 3 byte sequence cut short
+  // by ASCII; each decodes to U+FFFD and resumes after its maximal subpart
+  const std::string_view bytes{"\xC0\xAF\xED\xA0\x80\x80\xE2\x82$"};
+  const char* p = bytes.data();
+  const char* end = bytes.data() + bytes.size();
+
+  const std::size_t sizes[] = {1u, 1u, 1u, 1u, 1u, 1u, 2u};
+  for (const std::size_t size : sizes) {
+    const char* before = p;
+    const auc::decode_result decoded = auc::decode_next(p, end);
+    EXPECT_EQ(decoded.status_, auc::decode_status::Invalid);
+    EXPECT_EQ(decoded.codepoint_, auc::replacement_character);
+    EXPECT_EQ(static_cast<std::size_t>(p - before), size);
+  }
+
+  const auc::decode_result decoded = auc::decode_next(p, end);
+  EXPECT_EQ(decoded.status_, auc::decode_status::Ok);
+  EXPECT_EQ(decoded.codepoint_, 0x24u);
+  EXPECT_EQ(p, end);
+}
+
+TEST(decoding_codepoint, decode_next_truncated) {
+  const std::string_view bytes{"\xF0\x90\x8D"};
+  const char* p = bytes.data();
+  const auc::decode_result decoded =
+      auc::decode_next(p, bytes.data() + bytes.size());
+  EXPECT_EQ(decoded.status_, auc::decode_status::Truncated);
+  EXPECT_EQ(decoded.codepoint_, auc::replacement_character);
+  EXPECT_EQ(p, bytes.data() + bytes.size());
+}
+
+TEST(decoding_codepoint, invalid_utf8) {
+  auc::u8text utf8_text(std::string_view{"a\xFF\xE2\x82z"});
+  EXPECT_FALSE(utf8_text.is_valid());
+
+  const std::vector<auc::codepoint> codepoints = utf8_text.get_codepoints();
+  ASSERT_EQ(codepoints.size(), 4);
+  EXPECT_EQ(codepoints[0].get_num(), 0x61);
+  EXPECT_EQ(codepoints[1].get_num(), auc::replacement_character);
+  EXPECT_EQ(codepoints[2].get_num(), auc::replacement_character);
+  EXPECT_EQ(codepoints[3].get_num(), 0x7A);
+}
+
+TEST(decoding_codepoint, decode_utf8_to_utf32) {
+  const char* utf8_chars = reinterpret_cast<const char*>(u8"߿က$£ह€한𐍈򟿿");
+  ASSERT_EQ(auc::count_codepoints(utf8_chars), 9u);
+
+  std::u32string utf32(auc::count_codepoints(utf8_chars), U'\0');
+  EXPECT_EQ(auc::decode_utf8_to_utf32(utf8_chars, utf32), 9u);
+  EXPECT_EQ(utf32, U"\u07FF\u1000$\u00A3\u0939\u20AC\uD55C\U00010348"
+                   U"\U0009FFFF");
+
+  // Maximal subparts decode to U+FFFD, just like with decode_next
+  const std::string_view invalid{"a\xFF\xE2\x82z\xF0\x90"};
+  ASSERT_EQ(auc::count_codepoints(invalid), 5u);
+  utf32.assign(auc::count_codepoints(invalid), U'\0');
+  EXPECT_EQ(auc::decode_utf8_to_utf32(invalid, utf32), 5u);
+  EXPECT_EQ(utf32, U"a\uFFFD\uFFFDz\uFFFD");
+}
+
+TEST(decoding_codepoint, kernels_match_scalar) {
+  // Runs of whole characters, with a byte overwritten every few inputs, so
+  // blocks mix character lengths and the odd ill-formed sequence. Every
+  // kernel must decode and count the same codepoints as the scalar decoder,
+  // into an output sized for exactly that many.
+  using auc::detail::split_chars;
+  const std::vector<std::vector<std::string>> alphabets = {
+      split_chars(u8"abc\r\n"), split_chars(u8"aé߿"),
+      split_chars(u8"a€한"), split_chars(u8"aé€𐍈\U0001F476")};
+  auc::detail::for_each_random_input(
+      alphabets, 100u,
+      [](const std::vector<std::string>& chars, std::mt19937& rng) {
+        const std::string bytes = auc::detail::join_chars(chars, rng);
+        std::u32string expected(bytes.size(), U'\0');
+        expected.resize(auc::detail::decode_utf8_to_utf32(
+            auc::detail::simd_level::Scalar, bytes, expected));
+        ASSERT_EQ(expected.size(), auc::count_codepoints(bytes));
+
+        for (const auto level : auc::detail::supported_simd_levels()) {
+          std::vector<char32_t> out(expected.size());
+          const std::size_t num_cps =
+              auc::detail::decode_utf8_to_utf32(level, bytes, out);
+          EXPECT_EQ(expected, std::u32string_view(out.data(), num_cps))
+              << "simd level " << static_cast<int>(level);
+          EXPECT_EQ(expected.size(),
+                    auc::detail::count_codepoints(level, bytes))
+              << "simd level " << static_cast<int>(level);
+        }
+      });
+}
@@ -1,14 +1,98 @@
 ﻿#include <gtest/gtest.h>
 
+#include <algorithm>
+#include <auc/encode.hpp>
 #include <auc/u8text.hpp>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "random_input.hpp"
 
 TEST(encoding_codepoint, valid_utf8) {
   const auto utf8_text =
       auc::u8text::from_codepoints({0x07FF, 0x1000, 0x0024, 0x00A3, 0x0939,
                                     0x20AC, 0xD55C, 0x10348, 0x9FFFF});
 
-  std::string raw_data = utf8_text.data();
+  const std::string_view raw_data = utf8_text.data();
   const char* utf8_chars =
       reinterpret_cast<const char*>(u8"߿က$£ह€한𐍈򟿿");
   EXPECT_STREQ(utf8_chars, raw_data.data());
 }
+
+TEST(encoding_codepoint, encode_into) {
+  char out[auc::max_encoded_size] = {};
+
+  EXPECT_EQ(auc::encode_into(0x24u, out), 1u);
+  EXPECT_EQ(std::string_view(out, 1u), "$");
+  EXPECT_EQ(auc::encode_into(0xA3u, out), 2u);
+  EXPECT_EQ(std::string_view(out, 2u), "\xC2\xA3");
+  EXPECT_EQ(auc::encode_into(0x20ACu, out), 3u);
+  EXPECT_EQ(std::string_view(out, 3u), "\xE2\x82\xAC");
+  EXPECT_EQ(auc::encode_into(0x10348u, out), 4u);
+  EXPECT_EQ(std::string_view(out, 4u), "\xF0\x90\x8D\x88");
+  EXPECT_EQ(auc::encode_into(0x10FFFFu, out), 4u);
+  EXPECT_EQ(std::string_view(out, 4u), "\xF4\x8F\xBF\xBF");
+
+  EXPECT_EQ(auc::encode_into(0x110000u, out), 0u);
+}
+
+TEST(encoding_codepoint, encode) {
+  const std::vector<auc::codepoint> cps = {0x24, 0x110000, 0xA3, 0x10348};
+  ASSERT_EQ(auc::encoded_size(cps), 7u);
+
+  std::vector<char> out(auc::encoded_size(cps));
+  EXPECT_EQ(auc::encode(cps, out), out.size());
+  EXPECT_EQ(std::string_view(out.data(), out.size()),
+            "$\xC2\xA3\xF0\x90\x8D\x88");
+
+  const std::u32string_view utf32 = U"$\u00A3\u20AC\U00010348";
+  ASSERT_EQ(auc::encoded_size(utf32), 10u);
+  std::string utf8(auc::encoded_size(utf32), '\0');
+  EXPECT_EQ(auc::encode(utf32, utf8), utf8.size());
+  EXPECT_EQ(utf8, "$\xC2\xA3\xE2\x82\xAC\xF0\x90\x8D\x88");
+}
+
+TEST(encoding_codepoint, kernels_match_scalar) {
+  // Runs of codepoints of each encoded length, plus ones past U+10FFFF that
+  // are skipped, so a block can mix lengths anywhere. The kernels must write
+  // the same bytes as the scalar encoder into a buffer sized by
+  // encoded_size(), which is exact so that writing past it is caught.
+  const std::vector<std::vector<std::uint32_t>> alphabets = {
+      {'a', 0x7F},
+      {0x80, 0xE9, 0x7FF},
+      {0x800, 0x20AC, 0xD55C, 0xFFFF},
+      {0x10000, 0x1F476, 0x10FFFF},
+      {0x110000}};
+  auc::detail::for_each_random_input(
+      alphabets, 200u,
+      [](const std::vector<std::uint32_t>& nums, std::mt19937&) {
+        const std::vector<auc::codepoint> cps(nums.begin(), nums.end());
+        std::string expected(cps.size() * auc::max_encoded_size, '\0');
+        expected.resize(auc::detail::encode(auc::detail::simd_level::Scalar,
+                                            cps, expected));
+        ASSERT_EQ(expected.size(), auc::encoded_size(cps));
+
+        // Codepoints past U+10FFFF leave no bytes behind
+        std::vector<auc::codepoint> valid_cps;
+        std::copy_if(cps.begin(), cps.end(), std::back_inserter(valid_cps),
+                     [](const auc::codepoint& cp) {
+                       return cp.get_num() <= 0x10FFFFu;
+                     });
+        std::string valid_expected(expected.size(), '\0');
+        EXPECT_EQ(auc::detail::encode(auc::detail::simd_level::Scalar,
+                                      valid_cps, valid_expected),
+                  expected.size());
+        EXPECT_EQ(expected, valid_expected);
+
+        for (const auto level : auc::detail::supported_simd_levels()) {
+          std::vector<char> out(expected.size());
+          const std::size_t num_bytes = auc::detail::encode(level, cps, out);
+          EXPECT_EQ(expected, std::string_view(out.data(), num_bytes))
+              << "simd level " << static_cast<int>(level);
+        }
+      });
+}
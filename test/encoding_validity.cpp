@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
 #include <auc/u8text.hpp>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 TEST(encoding_validity, valid_utf8) {
   char8_t utf8_chars[] = u8"߿က$£ह€한𐍈򟿿";
@@ -24,3 +28,91 @@ TEST(encoding_validity, valid_7bit_ascii) {
   auc::u8text ascii_text(ascii_chars);
   EXPECT_TRUE(ascii_text.is_valid());
 }
+
+TEST(encoding_validity, invalid_overlong) {
+  EXPECT_FALSE(auc::u8text(std::string_view("\xC0\x80")).is_valid());
+  EXPECT_FALSE(auc::u8text(std::string_view("\xE0\x80\xAF")).is_valid());
+  EXPECT_FALSE(auc::u8text(std::string_view("\xF0\x80\x80\xAF")).is_valid());
+}
+
+TEST(encoding_validity, invalid_surrogate) {
+  EXPECT_FALSE(auc::u8text(std::string_view("\xED\xA0\x80")).is_valid());
+  EXPECT_FALSE(auc::u8text::from_codepoints({0xD800}).is_valid());
+  EXPECT_FALSE(auc::u8char::from_codepoint(0xDFFF).is_valid());
+}
+
+TEST(encoding_validity, invalid_out_of_range) {
+  EXPECT_FALSE(auc::u8text(std::string_view("\xF4\x90\x80\x80")).is_valid());
+  EXPECT_FALSE(auc::u8text(std::string_view("\xF5\x80\x80\x80")).is_valid());
+  EXPECT_FALSE(auc::u8text::from_codepoints({0x110000}).is_valid());
+}
+
+TEST(encoding_validity, invalid_truncated) {
+  // The truncated sequence at the end must not be read past
+  const std::string bytes = "a\xF0\x9F\x98\x80\xF0\x9F";
+  auc::u8text truncated(std::string_view(bytes.data(), bytes.size()));
+  EXPECT_FALSE(truncated.is_valid());
+  EXPECT_EQ(3u, truncated.get_codepoints().size());
+  EXPECT_EQ(bytes, truncated.data());
+}
+
+TEST(encoding_validity, invalid_maximal_subparts) {
+  // Each maximal subpart of an ill-formed sequence is a character of its
+  // own, as in the example from The Unicode Standard, section 3.9:
+  // <61> <F1 80 80> <E1 80> <C2> <62> <80> <63> <80> <BF> <64>
+  auc::u8text invalid(std::string_view(
+      "\x61\xF1\x80\x80\xE1\x80\xC2\x62\x80\x63\x80\xBF\x64"));
+  EXPECT_FALSE(invalid.is_valid());
+  EXPECT_EQ(10u, invalid.get_codepoints().size());
+  EXPECT_EQ(0x64u, invalid.get_codepoints().back().get_num());
+}
+
+TEST(encoding_validity, u8char_strict) {
+  EXPECT_TRUE(auc::u8char(std::string_view("\xF4\x8F\xBF\xBF")).is_valid());
+  EXPECT_FALSE(auc::u8char(std::string_view("\xC1\xBF")).is_valid());
+  EXPECT_FALSE(auc::u8char(std::string_view("\xE2\x82")).is_valid());
+  EXPECT_FALSE(auc::u8char(std::string_view("\xC3\xA9\x80")).is_valid());
+}
+
+namespace {
+
+// The characters of each grapheme cluster, as codepoint and size
+std::vector<std::vector<std::pair<std::uint32_t, std::size_t>>> parsed_chars(
+    const auc::u8text& text) {
+  std::vector<std::vector<std::pair<std::uint32_t, std::size_t>>> clusters;
+  for (const auc::graphemecluster& cluster : text.get_grapheme_clusters()) {
+    auto& chars = clusters.emplace_back();
+    for (const auc::u8char& c : cluster.chars_) {
+      chars.emplace_back(c.get_codepoint().get_num(), c.get_num_bytes());
+    }
+  }
+  return clusters;
+}
+
+}  // namespace
+
+TEST(encoding_validity, parse_parallel) {
+  // Large enough to be split into a chunk per thread, with the chunk
+  // boundaries landing in the middle of characters
+  std::string valid;
+  std::string invalid;
+  while (valid.size() < 1200000u) {
+    valid += reinterpret_cast<const char*>(u8"ab\r\n߿က£ह€한𐍈ä🇦🇨");
+    invalid += "ab\xE2\x82\x80\x80\x80\x80\x80\xF0\x9F\x98\xED\xA0\x80\xC3";
+  }
+
+  for (const bool is_valid : {true, false}) {
+    const std::string& bytes = is_valid ? valid : invalid;
+    const auc::u8text text(bytes);
+    EXPECT_EQ(text.is_valid(), is_valid);
+    const auto expected_chars = parsed_chars(text);
+    for (unsigned int num_threads = 1u; num_threads <= 5u; ++num_threads) {
+      const auto parallel_text =
+          auc::u8text::parse_parallel(bytes, num_threads);
+      EXPECT_EQ(parallel_text.is_valid(), text.is_valid()) << num_threads;
+      EXPECT_EQ(parallel_text.data(), text.data()) << num_threads;
+      EXPECT_TRUE(parsed_chars(parallel_text) == expected_chars)
+          << num_threads;
+    }
+  }
+}
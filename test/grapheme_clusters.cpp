@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <auc/u8text.hpp>
+#include <auc/u8text_view.hpp>
+#include <ranges>
+#include <string>
+#include <string_view>
 
 #include "graphemebreaktest_data.hpp"
 
@@ -364,3 +369,292 @@ TEST(grapheme_clusters, sample24) {
                     {{auc::codepoint{0x0061u}, auc::codepoint{0x200Du}},
                      {auc::codepoint{0x2701u}}});
 }
+
+TEST(grapheme_clusters, ascii_runs) {
+  // Long enough for the SIMD ASCII checks, with CR LF straddling blocks and
+  // runs ending in characters that the next non-ASCII one extends
+  std::string bytes;
+  std::vector<std::vector<auc::codepoint>> expected_clusters;
+  for (int idx = 0; idx < 40; ++idx) {
+    bytes += "abcdefghijklmn\r\n";
+    for (const char c : std::string_view{"abcdefghijklmn"}) {
+      expected_clusters.push_back(
+          {auc::codepoint{static_cast<std::uint32_t>(c)}});
+    }
+    expected_clusters.push_back({auc::codepoint{0x000Du},
+                                 auc::codepoint{0x000Au}});
+  }
+  bytes += "\r\r\n\n\ra\xCC\x88z";
+  expected_clusters.push_back({auc::codepoint{0x000Du}});
+  expected_clusters.push_back({auc::codepoint{0x000Du},
+                               auc::codepoint{0x000Au}});
+  expected_clusters.push_back({auc::codepoint{0x000Au}});
+  expected_clusters.push_back({auc::codepoint{0x000Du}});
+  expected_clusters.push_back({auc::codepoint{0x0061u},
+                               auc::codepoint{0x0308u}});
+  expected_clusters.push_back({auc::codepoint{0x007Au}});
+
+  const auc::u8text utf8_text(bytes);
+  EXPECT_TRUE(utf8_text.is_valid());
+  EXPECT_EQ(utf8_text.get_codepoints().size(), bytes.size() - 1u);
+  validate_clusters(utf8_text.get_grapheme_clusters(), expected_clusters);
+}
+
+TEST(grapheme_clusters, long_clusters) {
+  // Stacked combining marks make up a single cluster however many there are
+  std::string marks = "a";
+  for (int idx = 0; idx < 20000; ++idx) {
+    marks += "\xCC\x88";
+  }
+  const auto mark_clusters = auc::u8text(marks).get_grapheme_clusters();
+  ASSERT_EQ(mark_clusters.size(), 1u);
+  EXPECT_EQ(mark_clusters[0].chars_.size(), 20001u);
+
+  // A run of regional indicators pairs up into flags, with an odd one out
+  std::string flags;
+  for (int idx = 0; idx < 2001; ++idx) {
+    flags += "\xF0\x9F\x87\xA6";
+  }
+  const auto flag_clusters = auc::u8text(flags).get_grapheme_clusters();
+  ASSERT_EQ(flag_clusters.size(), 1001u);
+  EXPECT_EQ(flag_clusters[0].chars_.size(), 2u);
+  EXPECT_EQ(flag_clusters[1000].chars_.size(), 1u);
+
+  // GB11 joins emoji ZWJ sequences wherever they are in a cluster, e.g. after
+  // a Prepend character, however long they are
+  std::string emoji = "\xD8\x80";
+  for (int idx = 0; idx < 2000; ++idx) {
+    emoji += "\xE2\x9D\xA4\xE2\x80\x8D";
+  }
+  emoji += "\xE2\x9D\xA4";
+  const auto emoji_clusters = auc::u8text(emoji).get_grapheme_clusters();
+  ASSERT_EQ(emoji_clusters.size(), 1u);
+  EXPECT_EQ(emoji_clusters[0].chars_.size(), 4002u);
+
+  // but a ZWJ only joins an emoji that follows it to an emoji before it
+  const auto zwj_clusters =
+      auc::u8text("a\xE2\x80\x8D\xE2\x9D\xA4").get_grapheme_clusters();
+  ASSERT_EQ(zwj_clusters.size(), 2u);
+  EXPECT_EQ(zwj_clusters[0].chars_.size(), 2u);
+  EXPECT_EQ(zwj_clusters[1].chars_.size(), 1u);
+}
+
+TEST(grapheme_clusters, lazy_graphemes) {
+  const auc::u8text utf8_text(
+      u8"a\u0308\r\n\U0001F1E6\U0001F1E8\U0001F476\U0001F3FF\u0915");
+
+  std::vector<std::string_view> clusters;
+  for (const auc::graphemecluster_view cluster : utf8_text.graphemes()) {
+    EXPECT_EQ(cluster.byte_size(), cluster.data().size());
+    clusters.push_back(cluster.data());
+  }
+
+  const std::vector<std::string_view> expected_clusters = {
+      "\x61\xCC\x88", "\r\n", "\xF0\x9F\x87\xA6\xF0\x9F\x87\xA8",
+      "\xF0\x9F\x91\xB6\xF0\x9F\x8F\xBF", "\xE0\xA4\x95"};
+  EXPECT_EQ(clusters, expected_clusters);
+  EXPECT_EQ(utf8_text.get_grapheme_clusters().size(), clusters.size());
+}
+
+namespace {
+
+// Checks the boundaries found around every byte offset of bytes against
+// segmenting all of it
+void expect_boundaries(std::string_view bytes, const std::string& name) {
+  std::vector<std::size_t> boundaries = {0u};
+  for (const auc::graphemecluster_view cluster :
+       auc::u8text_view(bytes).get_grapheme_clusters()) {
+    boundaries.push_back(boundaries.back() + cluster.byte_size());
+  }
+
+  for (std::size_t offset = 0u; offset <= bytes.size(); ++offset) {
+    const auto next = std::upper_bound(boundaries.begin(), boundaries.end(),
+                                       offset);
+    const auto previous =
+        std::lower_bound(boundaries.begin(), boundaries.end(), offset);
+    EXPECT_EQ(auc::next_grapheme_boundary(bytes, offset),
+              (next == boundaries.end()) ? bytes.size() : *next)
+        << name << " at " << offset;
+    EXPECT_EQ(auc::previous_grapheme_boundary(bytes, offset),
+              (previous == boundaries.begin()) ? 0u : *(previous - 1))
+        << name << " at " << offset;
+  }
+}
+
+}  // namespace
+
+TEST(grapheme_clusters, boundaries_at_offsets) {
+  for (const auto& test : auc::detail::grapheme_cluster_break_tests) {
+    const auto utf8 = auc::u8text::from_codepoints(test.codepoints_);
+    expect_boundaries(utf8.data(), test.name_);
+  }
+
+  std::string flags = "a";
+  for (int idx = 0; idx < 9; ++idx) {
+    flags += "\xF0\x9F\x87\xA6";
+  }
+  expect_boundaries(flags, "flags");
+  expect_boundaries(
+      "\xE2\x9D\xA4\xCC\x88\xE2\x80\x8D\xE2\x9D\xA4\xCC\x88\xCC\x88\xE0\xA4\x95"
+      "\xE0\xA4\xBE\xE0\xA4\xBE\xE0\xA4\xBE\xCC\x88",
+      "emoji and spacing marks");
+  expect_boundaries("a\x80\x80\x80\x80\xCC\xE2\x82\xCC\x88\xF0\x9F\x87",
+                    "ill-formed");
+}
+
+TEST(grapheme_clusters, reverse_graphemes) {
+  for (const auto& test : auc::detail::grapheme_cluster_break_tests) {
+    const auto utf8 = auc::u8text::from_codepoints(test.codepoints_);
+
+    std::vector<std::string_view> forward_clusters;
+    for (const auc::graphemecluster_view cluster : utf8.graphemes()) {
+      forward_clusters.push_back(cluster.data());
+    }
+    std::vector<std::string_view> reverse_clusters;
+    for (const auc::graphemecluster_view cluster :
+         utf8.graphemes() | std::views::reverse) {
+      reverse_clusters.push_back(cluster.data());
+    }
+    std::reverse(reverse_clusters.begin(), reverse_clusters.end());
+    EXPECT_EQ(forward_clusters, reverse_clusters) << test.name_;
+  }
+
+  // Going back and forth lands on the same clusters
+  const auc::u8text flags(u8"\U0001F1E6\U0001F1E8\U0001F1E6\U0001F1E8a");
+  auto itr = flags.graphemes().end();
+  --itr;
+  EXPECT_EQ((*itr).data(), "a");
+  --itr;
+  EXPECT_EQ((*itr).data(), "\xF0\x9F\x87\xA6\xF0\x9F\x87\xA8");
+  ++itr;
+  EXPECT_EQ((*itr).data(), "a");
+  --itr;
+  --itr;
+  EXPECT_EQ(itr, flags.graphemes().begin());
+}
+
+TEST(grapheme_clusters, reverse_regional_indicators) {
+  // Runs of regional indicators long enough that counting each run over
+  // again at every step back would take far too long, after characters that
+  // do and don't start a cluster with them
+  for (const std::string_view before : {"", "a", "\xD8\x80", "\xCC\x88"}) {
+    for (const std::size_t num_ris : {100000u, 100001u}) {
+      std::string bytes(before);
+      for (std::size_t idx = 0u; idx < num_ris; ++idx) {
+        bytes += "\xF0\x9F\x87\xA6";
+      }
+      for (const std::string_view after : {"", "a"}) {
+        const std::string text = bytes + std::string(after);
+        std::vector<std::string_view> forward_clusters;
+        for (const auc::graphemecluster_view cluster :
+             auc::make_graphemecluster_range(text)) {
+          forward_clusters.push_back(cluster.data());
+        }
+        std::vector<std::string_view> reverse_clusters;
+        for (const auc::graphemecluster_view cluster :
+             auc::make_graphemecluster_range(text) | std::views::reverse) {
+          reverse_clusters.push_back(cluster.data());
+        }
+        std::reverse(reverse_clusters.begin(), reverse_clusters.end());
+        EXPECT_EQ(forward_clusters.size(), auc::count_graphemes(text));
+        EXPECT_EQ(forward_clusters, reverse_clusters)
+            << before.size() << ' ' << num_ris << ' ' << after;
+      }
+    }
+  }
+}
+
+TEST(grapheme_clusters, truncate_graphemes) {
+  // a + diaeresis, a flag, CR LF, a family emoji and x
+  const std::string_view text =
+      "a\xCC\x88\xF0\x9F\x87\xA6\xF0\x9F\x87\xA8\r\n"
+      "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7"
+      "x";
+  const std::vector<std::size_t> boundaries = {0u, 3u, 11u, 13u, 31u, 32u};
+
+  for (std::size_t max_bytes = 0u; max_bytes <= text.size() + 1u;
+       ++max_bytes) {
+    const std::size_t expected =
+        *(std::upper_bound(boundaries.begin(), boundaries.end(), max_bytes) -
+          1);
+    EXPECT_EQ(auc::truncate_graphemes(text, {.max_bytes_ = max_bytes}),
+              text.substr(0u, expected))
+        << max_bytes;
+  }
+
+  for (std::size_t max_clusters = 0u; max_clusters < boundaries.size();
+       ++max_clusters) {
+    EXPECT_EQ(auc::truncate_graphemes(text, {.max_clusters_ = max_clusters}),
+              text.substr(0u, boundaries[max_clusters]))
+        << max_clusters;
+  }
+  EXPECT_EQ(auc::truncate_graphemes(text, {.max_clusters_ = 10u}), text);
+
+  // Whichever limit is reached first applies
+  EXPECT_EQ(auc::truncate_graphemes(text, {12u, 3u}), text.substr(0u, 11u));
+  EXPECT_EQ(auc::truncate_graphemes(text, {40u, 3u}), text.substr(0u, 13u));
+  EXPECT_EQ(auc::truncate_graphemes("", {0u, 0u}), "");
+}
+
+TEST(grapheme_clusters, counts) {
+  for (const auto& test : auc::detail::grapheme_cluster_break_tests) {
+    const auto utf8 = auc::u8text::from_codepoints(test.codepoints_);
+    EXPECT_EQ(auc::count_graphemes(utf8.data()), test.clusters_.size())
+        << test.name_;
+    EXPECT_EQ(utf8.grapheme_count(), test.clusters_.size()) << test.name_;
+    EXPECT_EQ(utf8.codepoint_count(), test.codepoints_.size()) << test.name_;
+  }
+
+  // ASCII runs with CR LF straddling SIMD blocks, extended by what follows
+  std::string bytes;
+  for (int idx = 0; idx < 40; ++idx) {
+    bytes += "abcdefghijklmn\r\n";
+  }
+  bytes += "\r\r\n\n\ra\xCC\x88z\xE2\x82";
+  const auc::u8text text(bytes);
+  EXPECT_EQ(auc::count_graphemes(bytes), 40u * 15u + 7u);
+  EXPECT_EQ(text.byte_size(), bytes.size());
+  EXPECT_EQ(text.codepoint_count(), bytes.size() - 2u);
+  EXPECT_EQ(text.grapheme_count(), 40u * 15u + 7u);
+
+  // Copies keep the memoized count, and a text assigned to another, counted
+  // or not, has the other's count rather than its own
+  const auc::u8text copy = text;
+  EXPECT_EQ(copy.grapheme_count(), 40u * 15u + 7u);
+  auc::u8text assigned = text;
+  assigned = auc::u8text("a\xCC\x88z");
+  EXPECT_EQ(assigned.grapheme_count(), 2u);
+  assigned = text;
+  EXPECT_EQ(assigned.grapheme_count(), 40u * 15u + 7u);
+  assigned = auc::u8text("");
+  EXPECT_EQ(assigned.grapheme_count(), 0u);
+}
+
+TEST(grapheme_clusters, memoized_count) {
+  int num_computed = 0;
+  const auto compute = [&num_computed] {
+    ++num_computed;
+    return std::size_t{7u};
+  };
+
+  // Computed once, then kept by copies made after that
+  auc::detail::memoized_count memoized;
+  EXPECT_EQ(memoized.get(compute), 7u);
+  EXPECT_EQ(memoized.get(compute), 7u);
+  const auc::detail::memoized_count copy = memoized;
+  EXPECT_EQ(copy.get(compute), 7u);
+  auc::detail::memoized_count assigned;
+  assigned = memoized;
+  EXPECT_EQ(assigned.get(compute), 7u);
+  EXPECT_EQ(num_computed, 1);
+
+  // Copies of a count not yet computed compute their own, and assigning one
+  // forgets the count computed before
+  const auc::detail::memoized_count unknown;
+  const auc::detail::memoized_count unknown_copy = unknown;
+  EXPECT_EQ(unknown_copy.get([] { return std::size_t{3u}; }), 3u);
+  assigned = unknown;
+  EXPECT_EQ(assigned.get([] { return std::size_t{5u}; }), 5u);
+  EXPECT_EQ(unknown.get(compute), 7u);
+  EXPECT_EQ(num_computed, 2);
+}
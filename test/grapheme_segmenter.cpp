@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <auc/grapheme_segmenter.hpp>
+#include <auc/u8text.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "graphemebreaktest_data.hpp"
+
+namespace {
+
+std::vector<std::size_t> expected_boundaries(std::string_view bytes) {
+  std::vector<std::size_t> boundaries;
+  const auc::u8text text(bytes);
+  for (const auc::graphemecluster_view cluster : text.graphemes()) {
+    boundaries.push_back(
+        static_cast<std::size_t>(cluster.data().data() - text.data().data()) +
+        cluster.byte_size());
+  }
+  return boundaries;
+}
+
+std::vector<std::size_t> segment(std::string_view bytes,
+                                 std::size_t chunk_size) {
+  std::vector<std::size_t> boundaries;
+  auc::grapheme_segmenter segmenter(
+      [&boundaries](std::size_t offset) { boundaries.push_back(offset); });
+  for (std::size_t idx = 0u; idx < bytes.size(); idx += chunk_size) {
+    segmenter.feed(bytes.substr(idx, chunk_size));
+  }
+  segmenter.finish();
+  return boundaries;
+}
+
+}  // namespace
+
+TEST(grapheme_segmenter, chunked_break_tests) {
+  for (const auto& test : auc::detail::grapheme_cluster_break_tests) {
+    const auto utf8 = auc::u8text::from_codepoints(test.codepoints_);
+    const std::vector<std::size_t> expected = expected_boundaries(utf8.data());
+    for (std::size_t chunk_size = 1u; chunk_size <= 5u; ++chunk_size) {
+      EXPECT_EQ(expected, segment(utf8.data(), chunk_size))
+          << test.name_ << " in chunks of " << chunk_size;
+    }
+  }
+}
+
+TEST(grapheme_segmenter, ill_formed_chunks) {
+  // Truncated sequences, a stray continuation byte and a sequence the end of
+  // the stream truncates
+  const std::string bytes = "a\xE2\x82" "b\xF0\x9F\x87\xA6\x80\xF0\x9F\x87";
+  const std::vector<std::size_t> expected = {1u, 3u, 4u, 8u, 9u, 12u};
+  for (std::size_t chunk_size = 1u; chunk_size <= bytes.size(); ++chunk_size) {
+    EXPECT_EQ(expected, segment(bytes, chunk_size)) << chunk_size;
+  }
+}
+
+TEST(grapheme_segmenter, reuse_after_finish) {
+  std::vector<std::size_t> boundaries;
+  auc::grapheme_segmenter segmenter(
+      [&boundaries](std::size_t offset) { boundaries.push_back(offset); });
+  segmenter.finish();
+  EXPECT_TRUE(boundaries.empty());
+
+  segmenter.feed("\xF0\x9F\x87");
+  segmenter.finish();
+  segmenter.feed("\r");
+  segmenter.feed("\n");
+  segmenter.finish();
+  EXPECT_EQ(boundaries, (std::vector<std::size_t>{3u, 2u}));
+}
@@ -3,6 +3,7 @@
 #include <auc/u8text.hpp>
 #include <fstream>
 #include <string>
+#include <string_view>
 
 TEST(parse_bom, valid_utf8) {
   std::ifstream bom_utf8_file("../../test/bom.txt");
@@ -10,8 +11,34 @@ TEST(parse_bom, valid_utf8) {
   std::string bytes;
   std::getline(bom_utf8_file, bytes);
 
+  // Only the first of the two leading U+FEFF is a BOM
   auc::u8text bom_utf8(bytes);
   const char* utf8_chars =
-      reinterpret_cast<const char*>(u8"߿က$£ह€한𐍈򟿿");
+      reinterpret_cast<const char*>(u8"\uFEFF߿က$£ह€한𐍈򟿿");
   EXPECT_STREQ(utf8_chars, bom_utf8.data().data());
 }
+
+TEST(parse_bom, exact_match) {
+  EXPECT_EQ(3u, auc::detail::parse_bom("\xEF\xBB\xBF" "abc", 6u));
+  EXPECT_EQ(3u, auc::detail::parse_bom("\xEF\xBB\xBF\xEF\xBB\xBF", 6u));
+  EXPECT_EQ(0u, auc::detail::parse_bom("\xFF\xFF\xFF" "abc", 6u));
+  EXPECT_EQ(0u, auc::detail::parse_bom("\xEF\xFB\xFF", 3u));
+  EXPECT_EQ(0u, auc::detail::parse_bom("\xEF\xBB", 2u));
+  EXPECT_EQ(0u, auc::detail::parse_bom("\xEF", 1u));
+  EXPECT_EQ(0u, auc::detail::parse_bom("", 0u));
+}
+
+TEST(parse_bom, invalid_prefix) {
+  const auc::u8text ff_prefixed(std::string_view("\xFF\xFF\xFF" "abc", 6u));
+  EXPECT_FALSE(ff_prefixed.is_valid());
+  EXPECT_EQ(6u, ff_prefixed.data().size());
+
+  // A BOM cut short is an ill-formed sequence, not a BOM
+  for (const std::string_view truncated :
+       {std::string_view("\xEF\xBB", 2u), std::string_view("\xEF", 1u),
+        std::string_view("\xEF\xBB" "abc", 5u)}) {
+    const auc::u8text text(truncated);
+    EXPECT_FALSE(text.is_valid());
+    EXPECT_EQ(truncated, text.data());
+  }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <auc/validation.hpp>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Helpers for checking the SIMD kernels against the scalar ones on random
+// input
+namespace auc {
+namespace detail {
+
+// The instruction sets supported by both the build and the CPU, slowest
+// first
+inline std::vector<simd_level> supported_simd_levels() {
+  std::vector<simd_level> levels;
+  const int max_level = static_cast<int>(detect_simd_level());
+  for (int level = 0; level <= max_level; ++level) {
+    levels.push_back(static_cast<simd_level>(level));
+  }
+  return levels;
+}
+
+// The UTF-8 characters of chars, one string each
+inline std::vector<std::string> split_chars(std::u8string_view chars) {
+  const std::string_view bytes(reinterpret_cast<const char*>(chars.data()),
+                               chars.size());
+  std::vector<std::string> split;
+  for (const char byte : bytes) {
+    if ((static_cast<unsigned char>(byte) & 0xC0u) != 0x80u) {
+      split.emplace_back();
+    }
+    split.back().push_back(byte);
+  }
+  return split;
+}
+
+// Calls check with a fixed sequence of random inputs of up to max_length
+// items. Each input is made of runs of 1 to 40 items, every run drawn from
+// one of alphabets, so inputs switch between kinds of items (e.g. ASCII and
+// not) at random points. check is also handed the generator, e.g. to
+// corrupt the input with.
+template <class Item, class Check>
+void for_each_random_input(const std::vector<std::vector<Item>>& alphabets,
+                           std::size_t max_length,
+                           Check check) {
+  std::mt19937 rng{2023u};
+  for (int iteration = 0; iteration < 2000; ++iteration) {
+    std::vector<Item> items;
+    const std::size_t length = rng() % max_length;
+    while (items.size() < length) {
+      const std::vector<Item>& alphabet = alphabets[rng() % alphabets.size()];
+      const std::size_t run = 1u + rng() % 40u;
+      for (std::size_t idx = 0u; idx < run; ++idx) {
+        items.push_back(alphabet[rng() % alphabet.size()]);
+      }
+    }
+    check(items, rng);
+  }
+}
+
+// Joins the characters of a random input back into UTF-8, overwriting one
+// byte with a random one every few inputs
+inline std::string join_chars(const std::vector<std::string>& chars,
+                              std::mt19937& rng) {
+  std::string bytes;
+  for (const std::string& c : chars) {
+    bytes += c;
+  }
+  if (rng() % 4u == 0u && !bytes.empty()) {
+    bytes[rng() % bytes.size()] = static_cast<char>(rng() % 256u);
+  }
+  return bytes;
+}
+
+}  // namespace detail
+}  // namespace auc
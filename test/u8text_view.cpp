@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <auc/u8text.hpp>
+#include <auc/u8text_view.hpp>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "graphemebreaktest_data.hpp"
+
+static_assert(std::ranges::forward_range<auc::codepoint_range>);
+static_assert(
+    std::is_same_v<
+        std::iterator_traits<auc::codepoint_iterator>::iterator_category,
+        std::input_iterator_tag>);
+static_assert(std::ranges::bidirectional_range<auc::graphemecluster_range>);
+static_assert(std::ranges::common_range<auc::graphemecluster_range>);
+static_assert(std::bidirectional_iterator<auc::graphemecluster_iterator>);
+static_assert(
+    std::is_same_v<
+        std::iterator_traits<auc::graphemecluster_iterator>::iterator_category,
+        std::input_iterator_tag>);
+
+TEST(u8text_view, valid_utf8) {
+  char8_t utf8_chars[] = u8"߿က$£ह€한𐍈򟿿";
+  auc::u8text_view utf8_view(utf8_chars);
+  EXPECT_TRUE(utf8_view.is_valid());
+}
+
+TEST(u8text_view, invalid_utf8) {
+  const std::string invalid_chars = "abc\xE2\x82";
+  auc::u8text_view invalid_view(invalid_chars);
+  EXPECT_FALSE(invalid_view.is_valid());
+}
+
+TEST(u8text_view, borrows_bytes) {
+  const std::string bytes = "\xEF\xBB\xBFHello";
+  auc::u8text_view view(bytes);
+  EXPECT_EQ(bytes.data() + 3, view.data().data());
+  EXPECT_EQ(5u, view.data().size());
+}
+
+TEST(u8text_view, bounded_bom) {
+  // Exactly sized heap buffers, so reading past them is caught by ASan
+  for (const std::string_view bytes :
+       {"\xEF\xBB\xBF\xEF", "\xEF\xBB", "\xEF", "\xEF\xBB\xBF"}) {
+    const auto buffer = std::make_unique<char[]>(bytes.size());
+    std::copy(bytes.begin(), bytes.end(), buffer.get());
+    auc::u8text_view view(std::string_view(buffer.get(), bytes.size()));
+    const bool is_bom = bytes.starts_with("\xEF\xBB\xBF");
+    EXPECT_EQ(view.data().data(), buffer.get() + (is_bom ? 3 : 0));
+    EXPECT_EQ(view.is_valid(), bytes.size() == 3u);
+  }
+}
+
+TEST(u8text_view, invalid_prefix) {
+  const std::string bytes = "\xFF\xFF\xFF";
+  auc::u8text_view view(bytes);
+  EXPECT_FALSE(view.is_valid());
+  EXPECT_EQ(view.data(), bytes);
+}
+
+TEST(u8text_view, codepoints) {
+  char8_t utf8_chars[] = u8"߿က$£ह€한𐍈򟿿";
+  auc::u8text_view utf8_view(utf8_chars);
+
+  std::vector<auc::codepoint> codepoints;
+  for (const auc::codepoint cp : utf8_view.get_codepoints()) {
+    codepoints.push_back(cp);
+  }
+  EXPECT_EQ(auc::u8text(utf8_chars).get_codepoints(), codepoints);
+}
+
+TEST(u8text_view, grapheme_clusters) {
+  for (const auto& test : auc::detail::grapheme_cluster_break_tests) {
+    const auto utf8 = auc::u8text::from_codepoints(test.codepoints_);
+    auc::u8text_view utf8_view(utf8.data());
+
+    std::vector<std::vector<auc::codepoint>> actual_clusters;
+    for (const auc::graphemecluster_view cluster :
+         utf8_view.get_grapheme_clusters()) {
+      std::vector<auc::codepoint> codepoints;
+      for (const auc::codepoint cp : cluster.get_codepoints()) {
+        codepoints.push_back(cp);
+      }
+      EXPECT_EQ(cluster.codepoint_count(), codepoints.size());
+      actual_clusters.push_back(codepoints);
+    }
+    EXPECT_EQ(test.clusters_, actual_clusters) << test.name_;
+  }
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <auc/validation.hpp>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "random_input.hpp"
+
+namespace {
+
+using auc::detail::supported_simd_levels;
+
+// Embed bytes at every position of a block sized prefix/suffix, so the
+// sequence under test also straddles the SIMD block boundaries
+void expect_validity(const std::string& bytes, bool expected) {
+  for (const auto level : supported_simd_levels()) {
+    for (std::size_t padding = 0u; padding <= 70u; ++padding) {
+      const std::string padded = std::string(padding, 'a') + bytes;
+      EXPECT_EQ(expected, auc::detail::validate_utf8(level, padded.data(),
+                                                     padded.size()))
+          << "simd level " << static_cast<int>(level) << ", padding "
+          << padding;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(validation, valid_utf8) {
+  const char* utf8_chars = reinterpret_cast<const char*>(u8"߿က$£ह€한𐍈򟿿");
+  expect_validity(utf8_chars, true);
+  expect_validity("", true);
+  expect_validity("Hello, World!", true);
+  expect_validity("\x7F", true);
+  expect_validity("\xC2\x80", true);
+  expect_validity("\xDF\xBF", true);
+  expect_validity("\xE0\xA0\x80", true);
+  expect_validity("\xED\x9F\xBF", true);
+  expect_validity("\xEE\x80\x80", true);
+  expect_validity("\xF0\x90\x80\x80", true);
+  expect_validity("\xF4\x8F\xBF\xBF", true);
+}
+
+TEST(validation, invalid_utf8) {
+  // Stray continuation bytes and invalid lead bytes
+  expect_validity("\x80", false);
+  expect_validity("\xBF", false);
+  expect_validity("\xC0\x80", false);
+  expect_validity("\xC1\xBF", false);
+  expect_validity("\xF5\x80\x80\x80", false);
+  expect_validity("\xFF", false);
+
+  // Overlong encodings
+  expect_validity("\xE0\x80\x80", false);
+  expect_validity("\xE0\x9F\xBF", false);
+  expect_validity("\xF0\x80\x80\x80", false);
+  expect_validity("\xF0\x8F\xBF\xBF", false);
+
+  // UTF-16 surrogates
+  expect_validity("\xED\xA0\x80", false);
+  expect_validity("\xED\xBF\xBF", false);
+
+  // Past U+10FFFF
+  expect_validity("\xF4\x90\x80\x80", false);
+
+  // Truncated sequences
+  expect_validity("\xC2", false);
+  expect_validity("\xE0\xA0", false);
+  expect_validity("\xF0\x90\x80", false);
+  expect_validity("\xE2\x82" "a", false);
+
+  // Too many continuation bytes
+  expect_validity("\xC2\x80\x80", false);
+}
+
+TEST(validation, kernels_match_scalar) {
+  // Bytes picked at random from a mix of characters rather than whole
+  // characters, so most inputs have ill-formed sequences somewhere in a
+  // block or its tail. Every kernel must reach the same verdict as the DFA.
+  const std::string mixed =
+      reinterpret_cast<const char*>(u8"aé€𐍈\r\n한\U0001F476");
+  const std::vector<std::vector<char>> alphabets = {
+      {mixed.begin(), mixed.end()}, {'a', 'b', '\r', '\n'}};
+  auc::detail::for_each_random_input(
+      alphabets, 200u, [](const std::vector<char>& bytes, std::mt19937&) {
+        const bool expected = auc::detail::validate_utf8(
+            auc::detail::simd_level::Scalar, bytes.data(), bytes.size());
+        for (const auto level : supported_simd_levels()) {
+          EXPECT_EQ(expected, auc::detail::validate_utf8(level, bytes.data(),
+                                                         bytes.size()))
+              << "simd level " << static_cast<int>(level);
+        }
+      });
+}
+
+namespace {
+
+std::optional<std::size_t> chunked_error_offset(const std::string& bytes,
+                                                std::size_t chunk_size) {
+  auc::utf8_validator validator;
+  bool valid = true;
+  for (std::size_t idx = 0u; idx < bytes.size(); idx += chunk_size) {
+    valid = validator.update(std::string_view{bytes}.substr(idx, chunk_size));
+    if (!valid) {
+      break;
+    }
+  }
+  const bool finished = valid && validator.finish();
+  EXPECT_EQ(finished, !validator.error_offset());
+  return validator.error_offset();
+}
+
+}  // namespace
+
+TEST(validation, chunked_validator) {
+  const std::string valid =
+      "\x61\xC2\x80\xDF\xBF\xE0\xA0\x80\xED\x9F\xBF\xEF\xBF\xBF\xF0\x90\x80"
+      "\x80\xF4\x8F\xBF\xBF\x7F";
+  const std::vector<std::pair<std::string, std::size_t>> invalid = {
+      {"\x80", 0u},
+      {"ab\xC0\xAF", 2u},
+      {"abc\xE0\x80\x80", 3u},
+      {"abcd\xED\xA0\x80", 4u},
+      {"abc\xF4\x90\x80\x80", 3u},
+      {"abc\xE2\x82\x41", 3u},
+      {"abc\xE2\x82\xAC\xAC", 6u},
+      {"abc\xF0\x9F\x98", 3u},
+      {"abc\xFF", 3u}};
+
+  for (std::size_t chunk_size = 1u; chunk_size <= 24u; ++chunk_size) {
+    const std::string long_valid = std::string(40u, 'a') + valid;
+    EXPECT_FALSE(chunked_error_offset(valid, chunk_size)) << chunk_size;
+    EXPECT_FALSE(chunked_error_offset(long_valid, chunk_size)) << chunk_size;
+    for (const auto& [bytes, offset] : invalid) {
+      const std::string prefixed = valid + bytes;
+      EXPECT_EQ(chunked_error_offset(prefixed, chunk_size),
+                valid.size() + offset)
+          << chunk_size;
+    }
+  }
+}